@@ -80,6 +80,7 @@ $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-v
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"usb-storage\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DVMKERNEL -DVMKERNEL_MODULE -DVMKLNX_ALLOW_DEPRECATED -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/storage -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/usb-storage -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/option_ms.o vmkdrivers/src_92/drivers/usb/storage/option_ms.c
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"usb-storage\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DVMKERNEL -DVMKERNEL_MODULE -DVMKLNX_ALLOW_DEPRECATED -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/storage -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/usb-storage -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/usual-tables.o vmkdrivers/src_92/drivers/usb/storage/usual-tables.c
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"usb-storage\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DVMKERNEL -DVMKERNEL_MODULE -DVMKLNX_ALLOW_DEPRECATED -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/storage -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/usb-storage -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/debug.o vmkdrivers/src_92/drivers/usb/storage/debug.c
+$CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"usb-storage\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DVMKERNEL -DVMKERNEL_MODULE -DVMKLNX_ALLOW_DEPRECATED -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/storage -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/usb-storage -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/uas.o vmkdrivers/src_92/drivers/usb/storage/uas.c
 $LD $LD_OPTS -r -o BLD/build/vmkdriver-hid/release/vmkernel64/hid --whole-archive BLD/build/vmkdriver-hid/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/input/hid-core.o BLD/build/vmkdriver-hid/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/input/hid-quirks.o BLD/build/vmkdriver-hid/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/common/vmklinux_module.o
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"usb-storage\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_usb_storage -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DVMKERNEL -DVMKERNEL_MODULE -DVMKLNX_ALLOW_DEPRECATED -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/storage -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/usb-storage -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/common/vmklinux_module.o vmkdrivers/src_92/common/vmklinux_module.c
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"xhci\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DUSB_DRIVER -DVMKERNEL -DVMKERNEL_MODULE -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/host/xhci -Ivmkdrivers/src_92/drivers/usb/host/xhci/compat -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -Ivmkdrivers/src_92/drivers/usb/core -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/xhci -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-xhci/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/host/xhci/xhci.o vmkdrivers/src_92/drivers/usb/host/xhci/xhci.c
@@ -90,7 +91,7 @@ $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-v
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"xhci\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DUSB_DRIVER -DVMKERNEL -DVMKERNEL_MODULE -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/host/xhci -Ivmkdrivers/src_92/drivers/usb/host/xhci/compat -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -Ivmkdrivers/src_92/drivers/usb/core -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/xhci -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-xhci/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/host/xhci/xhci-hub.o vmkdrivers/src_92/drivers/usb/host/xhci/xhci-hub.c
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"xhci\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DUSB_DRIVER -DVMKERNEL -DVMKERNEL_MODULE -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/host/xhci -Ivmkdrivers/src_92/drivers/usb/host/xhci/compat -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -Ivmkdrivers/src_92/drivers/usb/core -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/xhci -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-xhci/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/host/xhci/xhci-dbg.o vmkdrivers/src_92/drivers/usb/host/xhci/xhci-dbg.c
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"xhci\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DUSB_DRIVER -DVMKERNEL -DVMKERNEL_MODULE -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/host/xhci -Ivmkdrivers/src_92/drivers/usb/host/xhci/compat -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -Ivmkdrivers/src_92/drivers/usb/core -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/xhci -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-xhci/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/host/xhci/compat/xhci_compat.o vmkdrivers/src_92/drivers/usb/host/xhci/compat/xhci_compat.c
-$LD $LD_OPTS -r -o BLD/build/vmkdriver-usb-storage/release/vmkernel64/usb-storage --whole-archive BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/scsiglue.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/protocol.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/transport.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/usb.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/initializers.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/option_ms.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/usual-tables.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/debug.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/common/vmklinux_module.o
+$LD $LD_OPTS -r -o BLD/build/vmkdriver-usb-storage/release/vmkernel64/usb-storage --whole-archive BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/scsiglue.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/protocol.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/transport.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/usb.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/initializers.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/option_ms.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/usual-tables.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/debug.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/storage/uas.o BLD/build/vmkdriver-usb-storage/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/common/vmklinux_module.o
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"xhci\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_xhci -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DUSB_DRIVER -DVMKERNEL -DVMKERNEL_MODULE -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/host/xhci -Ivmkdrivers/src_92/drivers/usb/host/xhci/compat -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -Ivmkdrivers/src_92/drivers/usb/core -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/xhci -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-xhci/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/common/vmklinux_module.o vmkdrivers/src_92/common/vmklinux_module.c
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"ehci-hcd\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_ehci_hcd -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_ehci_hcd -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DUSB_DRIVER -DVMKERNEL -DVMKERNEL_MODULE -DVMKLINUX_MODULE_HEAP_2GB_MEM -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/host/ehci -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -Ivmkdrivers/src_92/drivers/usb/core -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/ehci-hcd -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-ehci-hcd/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/drivers/usb/host/ehci/ehci-hcd.o vmkdrivers/src_92/drivers/usb/host/ehci/ehci-hcd.c
 $CC --sysroot=$SYS_ROOT -fwrapv -pipe -fno-strict-aliasing -Wno-unused-but-set-variable -fno-working-directory -g -ggdb3 -O2 -mcmodel=smallhigh -Wall -Werror -Wstrict-prototypes -fno-strict-aliasing -freg-struct-return -falign-jumps=1 -falign-functions=4 -falign-loops=1 -m64 -mno-red-zone -mpreferred-stack-boundary=4 -minline-all-stringops -mno-mmx -mno-3dnow -mno-sse -mno-sse2 -mcld -finline-limit=2000 -fno-common -ffreestanding -nostdinc -fomit-frame-pointer -nostdlib --sysroot=$SYS_ROOT -Wdeclaration-after-statement -Wno-pointer-sign -Wno-strict-prototypes -Wno-enum-compare -Wno-switch -Wno-declaration-after-statement -Wno-declaration-after-statement -Wno-declaration-after-statement -DCONFIG_COMPAT -DCONFIG_PM -DCONFIG_PM_RUNTIME -DCONFIG_USB_SUSPEND -DCPU=x86-64 -DEXPORT_SYMTAB -DGPLED_CODE -DKBUILD_MODNAME=\"ehci-hcd\" -DLINUX_MODULE_AUX_HEAP_NAME=vmklnx_ehci_hcd -DLINUX_MODULE_HEAP_INITIAL=256*1024 -DLINUX_MODULE_HEAP_MAX=4*1024*1024 -DLINUX_MODULE_HEAP_NAME=vmklnx_ehci_hcd -DLINUX_MODULE_VERSION=\"1.0\" -DMODULE -DNO_FLOATING_POINT -DUSB_DRIVER -DVMKERNEL -DVMKERNEL_MODULE -DVMKLINUX_MODULE_HEAP_2GB_MEM -DVMK_DEVKIT_HAS_API_VMKAPI_BASE -DVMK_DEVKIT_HAS_API_VMKAPI_DEVICE -DVMK_DEVKIT_HAS_API_VMKAPI_ISCSI -DVMK_DEVKIT_HAS_API_VMKAPI_NET -DVMK_DEVKIT_HAS_API_VMKAPI_RDMA -DVMK_DEVKIT_HAS_API_VMKAPI_SCSI -DVMK_DEVKIT_HAS_API_VMKAPI_SOCKETS -DVMK_DEVKIT_IS_DDK -DVMK_DEVKIT_USES_BINARY_COMPATIBLE_APIS -DVMK_DEVKIT_USES_PUBLIC_APIS -DVMNIX -DVMX86_RELEASE -DVMX86_SERVER -D_LINUX -D_VMKDRVEI -D__KERNEL__ -D__VMKERNEL_MODULE__ -D__VMKERNEL__ -D__VMKLNX__ -D__VMK_GCC_BUG_ALIGNMENT_PADDING__ -D__VMWARE__ -isystem $I_SYSTEM -Ivmkdrivers/src_92/drivers/usb/host/ehci -IBLD/build/HEADERS/vmkdrivers-vmkernel/vmkernel64/release -IBLD/build/version -Ivmkdrivers/src_92/include -Ivmkdrivers/src_92/include/vmklinux_92 -IBLD/build/HEADERS/92-vmkdrivers-asm-x64/vmkernel64/release -IBLD/build/HEADERS/vmkapi-v2_3_0_0-all-public-bincomp/generic/release -Ivmkdrivers/src_92/drivers/usb/core -IBLD/build/HEADERS/vmkapi-current-all-public-bincomp/generic/release -IBLD/build/HEADERS/92-vmkdrivers-namespace/vmkernel64/release/ehci-hcd -include vmkdrivers/src_92/include/linux/autoconf.h -c -o BLD/build/vmkdriver-ehci-hcd/release/vmkernel64/SUBDIRS/vmkdrivers/src_92/common/vmklinux_module.o vmkdrivers/src_92/common/vmklinux_module.c
@@ -337,6 +337,7 @@ static struct scsi_host_template ahci_sht = {
 	.eh_abort_handler	= ahci_scsi_abort,
 	.eh_device_reset_handler = ahci_scsi_device_reset,
 	.eh_bus_reset_handler	= ahci_scsi_device_reset,
+	.proc_info		= ata_scsi_proc_info,
 #endif /* defined(__VMKLNX__) */
 	.cmd_per_lun		= ATA_SHT_CMD_PER_LUN,
 	.emulated		= ATA_SHT_EMULATED,
@@ -2114,6 +2115,9 @@ static irqreturn_t ahci_interrupt(int irq, void *dev_instance)
 	unsigned int i, handled = 0;
 	void __iomem *mmio;
 	u32 irq_stat, irq_ack = 0;
+#if defined(__VMKLNX__)
+	struct ata_done_batch batch;
+#endif
 
 	VPRINTK("ENTER\n");
 
@@ -2136,7 +2140,22 @@ static irqreturn_t ahci_interrupt(int irq, void *dev_instance)
 
 		ap = host->ports[i];
 		if (ap) {
+#if defined(__VMKLNX__)
+			/*
+			 * Collect everything this port finished and hand it
+			 * to SCSI in one go once the host lock is dropped.
+			 */
+			ata_port_done_batch_begin(ap, &batch);
 			ahci_port_intr(ap);
+			ata_port_done_batch_end(ap);
+			if (batch.nr) {
+				spin_unlock(&host->lock);
+				ata_done_batch_complete(&batch);
+				spin_lock(&host->lock);
+			}
+#else
+			ahci_port_intr(ap);
+#endif /* defined(__VMKLNX__) */
 			VPRINTK("port %u\n", i);
 		} else {
 			VPRINTK("port %u (no irq)\n", i);
@@ -308,6 +308,7 @@ static int cciss_proc_get_info(char *buffer, char **start, off_t offset,
 	drive_info_struct *drv;
 	unsigned long flags;
 	sector_t vol_sz, vol_sz_frac;
+	unsigned long refills = 0, steals = 0;
 
 	ctlr = h->ctlr;
 
@@ -322,6 +323,13 @@ static int cciss_proc_get_info(char *buffer, char **start, off_t offset,
 	h->busy_configuring = 1;
 	spin_unlock_irqrestore(CCISS_LOCK(ctlr), flags);
 
+	for (i = 0; i < h->nr_tag_caches; i++) {
+		struct cciss_tag_cache *tc = &h->tag_cache[i];
+
+		refills += tc->refills;
+		steals += tc->steals;
+	}
+
 	size = sprintf(buffer, "%s: HP %s Controller\n"
 		       "Board ID: 0x%08lx\n"
 		       "Firmware Version: %c%c%c%c\n"
@@ -331,14 +339,26 @@ static int cciss_proc_get_info(char *buffer, char **start, off_t offset,
 		       "Current # commands on controller: %d\n"
 		       "Max Q depth since init: %d\n"
 		       "Max # commands on controller since init: %d\n"
-		       "Max SG entries since init: %d\n\n",
+		       "Max SG entries since init: %d\n"
+		       "Command blocks in use: %d of %d\n"
+		       "Commands per submission: %lu avg, %u max\n"
+		       "Completions per interrupt: %lu avg, %u max\n"
+		       "Tag cache refills: %lu, steals: %lu\n\n",
 		       h->devname,
 		       h->product_name,
 		       (unsigned long)h->board_id,
 		       h->firm_ver[0], h->firm_ver[1], h->firm_ver[2],
 		       h->firm_ver[3], (unsigned int)h->intr[SIMPLE_MODE_INT],
 		       h->num_luns, h->Qdepth, h->commands_outstanding,
-		       h->maxQsinceinit, h->max_outstanding, h->maxSG);
+		       h->maxQsinceinit, h->max_outstanding, h->maxSG,
+		       atomic_read(&h->cmds_in_use), h->nr_cmds,
+		       h->submit_batches ?
+				h->submit_cmds / h->submit_batches : 0,
+		       h->max_submit_batch,
+		       h->intr_batches ?
+				h->intr_completions / h->intr_batches : 0,
+		       h->max_intr_completions,
+		       refills, steals);
 
 	pos += size;
 	len += size;
@@ -426,10 +446,117 @@ static void __devinit cciss_procinit(int i)
 }
 #endif				/* CONFIG_PROC_FS */
 
+static inline struct cciss_tag_cache *cciss_tag_cache(ctlr_info_t *h, int cpu)
+{
+	return &h->tag_cache[cpu % h->nr_tag_caches];
+}
+
+/*
+ * Moves up to CCISS_TAG_CACHE_BATCH free command indices from
+ * cmd_pool_bits into a CPU's cache.  Called with tc->lock held.
+ */
+static int cciss_tag_cache_refill(ctlr_info_t *h, struct cciss_tag_cache *tc)
+{
+	int i = 0;
+
+	while (tc->count < CCISS_TAG_CACHE_BATCH) {
+		i = find_next_zero_bit(h->cmd_pool_bits, h->nr_cmds, i);
+		if (i >= h->nr_cmds)
+			break;
+		if (test_and_set_bit(i & (BITS_PER_LONG - 1),
+				     h->cmd_pool_bits + (i / BITS_PER_LONG)) == 0)
+			tc->tags[tc->count++] = i;
+		i++;
+	}
+	return tc->count;
+}
+
+/* Takes one free index out of another CPU's cache, or returns -1. */
+static int cciss_tag_steal(ctlr_info_t *h, int this_cpu)
+{
+	struct cciss_tag_cache *tc;
+	unsigned long flags;
+	int cpu, tag = -1;
+
+	for (cpu = 0; cpu < h->nr_tag_caches; cpu++) {
+		tc = &h->tag_cache[cpu];
+		if (tc == cciss_tag_cache(h, this_cpu))
+			continue;
+		if (!tc->count)		/* benignly racy */
+			continue;
+		spin_lock_irqsave(&tc->lock, flags);
+		if (tc->count)
+			tag = tc->tags[--tc->count];
+		spin_unlock_irqrestore(&tc->lock, flags);
+		if (tag >= 0)
+			break;
+	}
+	return tag;
+}
+
+/* Returns a free command index, or -1 if all of them are in use. */
+static int cciss_tag_get(ctlr_info_t *h)
+{
+	struct cciss_tag_cache *tc;
+	unsigned long flags;
+	int cpu, tag = -1;
+
+	cpu = raw_smp_processor_id();
+	tc = cciss_tag_cache(h, cpu);
+	spin_lock_irqsave(&tc->lock, flags);
+	if (!tc->count && cciss_tag_cache_refill(h, tc))
+		tc->refills++;
+	if (tc->count)
+		tag = tc->tags[--tc->count];
+	spin_unlock_irqrestore(&tc->lock, flags);
+
+	if (tag < 0) {
+		tag = cciss_tag_steal(h, cpu);
+		if (tag >= 0) {
+			spin_lock_irqsave(&tc->lock, flags);
+			tc->steals++;
+			spin_unlock_irqrestore(&tc->lock, flags);
+		}
+	}
+	if (tag >= 0)
+		atomic_inc(&h->cmds_in_use);
+	return tag;
+}
+
+static void cciss_tag_put(ctlr_info_t *h, int tag)
+{
+	struct cciss_tag_cache *tc;
+	unsigned long flags;
+	int i;
+
+	tc = cciss_tag_cache(h, raw_smp_processor_id());
+	spin_lock_irqsave(&tc->lock, flags);
+	if (tc->count == CCISS_TAG_CACHE_SIZE) {
+		/* hand the older half back to the shared bitmap */
+		for (i = 0; i < CCISS_TAG_CACHE_BATCH; i++)
+			clear_bit(tc->tags[i] & (BITS_PER_LONG - 1),
+				  h->cmd_pool_bits +
+				  (tc->tags[i] / BITS_PER_LONG));
+		tc->count -= CCISS_TAG_CACHE_BATCH;
+		memmove(tc->tags, tc->tags + CCISS_TAG_CACHE_BATCH,
+			tc->count * sizeof(tc->tags[0]));
+	}
+	tc->tags[tc->count++] = tag;
+	spin_unlock_irqrestore(&tc->lock, flags);
+	atomic_dec(&h->cmds_in_use);
+}
+
+/* Returns nonzero if cmd_alloc(h, 1) can still find a command block. */
+static inline int cciss_cmds_available(ctlr_info_t *h)
+{
+	return atomic_read(&h->cmds_in_use) < h->nr_cmds;
+}
+
 /*
  * For operations that cannot sleep, a command block is allocated at init,
- * and managed by cmd_alloc() and cmd_free() using a simple bitmap to track
- * which ones are free or in use.  For operations that can wait for kmalloc
+ * and managed by cmd_alloc() and cmd_free().  Free blocks are cached per
+ * CPU (see cciss_tag_get()) in front of a simple bitmap that tracks which
+ * ones are free or in use.  For operations that can wait for kmalloc
  * to possible sleep, this routine can be called with get_from_pool set to 0.
  * cmd_free() MUST be called with a got_from_pool set to 0 if cmd_alloc was.
  */
@@ -461,13 +588,9 @@ static CommandList_struct *cmd_alloc(ctlr_info_t *h, int get_from_pool)
 		memset(c->err_info, 0, sizeof(ErrorInfo_struct));
 	} else {		/* get it out of the controllers pool */
 
-		do {
-			i = find_first_zero_bit(h->cmd_pool_bits, h->nr_cmds);
-			if (i == h->nr_cmds)
-				return NULL;
-		} while (test_and_set_bit
-			 (i & (BITS_PER_LONG - 1),
-			  h->cmd_pool_bits + (i / BITS_PER_LONG)) != 0);
+		i = cciss_tag_get(h);
+		if (i < 0)
+			return NULL;
 #ifdef CCISS_DEBUG
 		printk(KERN_DEBUG "cciss: using command buffer %d\n", i);
 #endif
@@ -511,8 +634,7 @@ static void cmd_free(ctlr_info_t *h, CommandList_struct *c, int got_from_pool)
 				    c, (dma_addr_t) c->busaddr);
 	} else {
 		i = c - h->cmd_pool;
-		clear_bit(i & (BITS_PER_LONG - 1),
-			  h->cmd_pool_bits + (i / BITS_PER_LONG));
+		cciss_tag_put(h, i);
 		h->nr_frees++;
 	}
 }
@@ -1468,7 +1590,7 @@ static void cciss_check_queues(ctlr_info_t *h)
 	 * in case the interrupt we serviced was from an ioctl and did not
 	 * free any new commands.
 	 */
-	if ((find_first_zero_bit(h->cmd_pool_bits, h->nr_cmds)) == h->nr_cmds)
+	if (!cciss_cmds_available(h))
 		return;
 
 	/* We have room on the queue for more commands.  Now we need to queue
@@ -1490,7 +1612,7 @@ static void cciss_check_queues(ctlr_info_t *h)
 		/* check to see if we have maxed out the number of commands
 		 * that can be placed on the queue.
 		 */
-		if ((find_first_zero_bit(h->cmd_pool_bits, h->nr_cmds)) == h->nr_cmds) {
+		if (!cciss_cmds_available(h)) {
 			if (curr_queue == start_queue) {
 				h->next_to_run =
 				    (start_queue + 1) % (h->highest_lun + 1);
@@ -1505,45 +1627,62 @@ static void cciss_check_queues(ctlr_info_t *h)
 	}
 }
 
+/*
+ * rq heads a chain of commands that one pass of do_cciss_intr() completed
+ * (see cciss_flush_completions()).  The buffers of every command in the
+ * chain are completed first, then the lock is taken once to retire them
+ * all and restart the queues.
+ */
 static void cciss_softirq_done(struct request *rq)
 {
-	CommandList_struct *cmd = rq->completion_data;
-	ctlr_info_t *h = hba[cmd->ctlr];
+	CommandList_struct *batch = rq->completion_data;
+	CommandList_struct *cmd, *next;
+	ctlr_info_t *h = hba[batch->ctlr];
 	unsigned long flags;
 	u64bit temp64;
 	int i, ddir;
 
-	if (cmd->Request.Type.Direction == XFER_READ)
-		ddir = PCI_DMA_FROMDEVICE;
-	else
-		ddir = PCI_DMA_TODEVICE;
+	for (cmd = batch; cmd != NULL; cmd = cmd->next) {
+		rq = cmd->rq;
 
-	/* command did not need to be retried */
-	/* unmap the DMA mapping for all the scatter gather elements */
-	for (i = 0; i < cmd->Header.SGList; i++) {
-		temp64.val32.lower = cmd->SG[i].Addr.lower;
-		temp64.val32.upper = cmd->SG[i].Addr.upper;
-		pci_unmap_page(h->pdev, temp64.val, cmd->SG[i].Len, ddir);
-	}
+		if (cmd->Request.Type.Direction == XFER_READ)
+			ddir = PCI_DMA_FROMDEVICE;
+		else
+			ddir = PCI_DMA_TODEVICE;
+
+		/* command did not need to be retried */
+		/* unmap the DMA mapping for all the scatter gather elements */
+		for (i = 0; i < cmd->Header.SGList; i++) {
+			temp64.val32.lower = cmd->SG[i].Addr.lower;
+			temp64.val32.upper = cmd->SG[i].Addr.upper;
+			pci_unmap_page(h->pdev, temp64.val, cmd->SG[i].Len,
+				       ddir);
+		}
 
-	complete_buffers(rq->bio, rq->errors);
+		complete_buffers(rq->bio, rq->errors);
 
 #if !defined(__VMKLNX__)
-	if (blk_fs_request(rq)) {
-		const int rw = rq_data_dir(rq);
+		if (blk_fs_request(rq)) {
+			const int rw = rq_data_dir(rq);
 
-		disk_stat_add(rq->rq_disk, sectors[rw], rq->nr_sectors);
-	}
+			disk_stat_add(rq->rq_disk, sectors[rw],
+				      rq->nr_sectors);
+		}
 #endif /* !defined(__VMKLNX__) */
 
 #ifdef CCISS_DEBUG
-	printk("Done with %p\n", rq);
+		printk("Done with %p\n", rq);
 #endif				/* CCISS_DEBUG */
 
-	add_disk_randomness(rq->rq_disk);
+		add_disk_randomness(rq->rq_disk);
+	}
+
 	spin_lock_irqsave(&h->lock, flags);
-	end_that_request_last(rq, rq->errors);
-	cmd_free(h, cmd, 1);
+	for (cmd = batch; cmd != NULL; cmd = next) {
+		next = cmd->next;
+		end_that_request_last(cmd->rq, cmd->rq->errors);
+		cmd_free(h, cmd, 1);
+	}
 	cciss_check_queues(h);
 	spin_unlock_irqrestore(&h->lock, flags);
 }
@@ -2542,9 +2681,37 @@ static inline void resend_cciss_cmd(ctlr_info_t *h, CommandList_struct *c)
 	start_io(h);
 }
 
-/* checks the status of the job and calls complete buffers to mark all
- * buffers for the completed job. Note that this function does not need
- * to hold the hba/queue lock.
+/*
+ * Completed read/write commands are chained through c->next, which is
+ * free once they are off cmpQ, and handed to the block layer as one
+ * request so that cciss_softirq_done() retires them together.
+ * Both are called with CCISS_LOCK held.
+ */
+static inline void cciss_queue_completion(ctlr_info_t *h,
+					  CommandList_struct *c)
+{
+	c->next = NULL;
+	if (h->cmpl_tail)
+		h->cmpl_tail->next = c;
+	else
+		h->cmpl_head = c;
+	h->cmpl_tail = c;
+}
+
+static void cciss_flush_completions(ctlr_info_t *h)
+{
+	CommandList_struct *c = h->cmpl_head;
+
+	if (c == NULL)
+		return;
+	h->cmpl_head = h->cmpl_tail = NULL;
+	c->rq->completion_data = c;
+	blk_complete_request(c->rq);
+}
+
+/* checks the status of the job and queues it for cciss_softirq_done(),
+ * which completes the buffers of the job.  Called with the hba/queue
+ * lock held.
  */
 static inline void complete_command(ctlr_info_t *h, CommandList_struct *cmd,
 				    int timeout)
@@ -2650,21 +2817,19 @@ static inline void complete_command(ctlr_info_t *h, CommandList_struct *cmd,
 		return;
 	}
 
-	cmd->rq->completion_data = cmd;
 	cmd->rq->errors = status;
 	blk_add_trace_rq(cmd->rq->q, cmd->rq, BLK_TA_COMPLETE);
-	blk_complete_request(cmd->rq);
+	cciss_queue_completion(h, cmd);
 }
 
 /*
- * Get a request and submit it to the controller.
+ * Fills in a read/write command for the request in c->rq.  Called
+ * without the queue lock held.
  */
-static void do_cciss_request(request_queue_t *q)
+static void cciss_build_rw_cmd(ctlr_info_t *h, CommandList_struct *c)
 {
-	ctlr_info_t *h = q->queuedata;
-	CommandList_struct *c;
+	struct request *creq = c->rq;
 	int start_blk, seg;
-	struct request *creq;
 	u64bit temp64;
 #if defined(__VMKLNX__)
 	struct scatterlist *sglist, *sg;
@@ -2674,28 +2839,7 @@ static void do_cciss_request(request_queue_t *q)
 	drive_info_struct *drv;
 	int i, dir;
 
-	/* We call start_io here in case there is a command waiting on the
-	 * queue that has not been sent.
-	 */
-	if (blk_queue_plugged(q))
-		goto startio;
-
-      queue:
-	creq = elv_next_request(q);
-	if (!creq)
-		goto startio;
-
-	BUG_ON(creq->nr_phys_segments > MAXSGENTRIES);
-
-	if ((c = cmd_alloc(h, 1)) == NULL)
-		goto full;
-
-	blkdev_dequeue_request(creq);
-
-	spin_unlock_irq(q->queue_lock);
-
 	c->cmd_type = CMD_RWREQ;
-	c->rq = creq;
 
 	/* fill in the request */
 	drv = creq->rq_disk->private_data;
@@ -2724,7 +2868,7 @@ static void do_cciss_request(request_queue_t *q)
 #if defined(__VMKLNX__)
 	seg = vmklnx_blk_rq_map_sg(creq, &sglist);
 #else /* !defined(__VMKLNX__) */
-	seg = blk_rq_map_sg(q, creq, tmp_sg);
+	seg = blk_rq_map_sg(creq->q, creq, tmp_sg);
 #endif /* defined(__VMKLNX__) */
 
 	/* get the DMA records for the setup */
@@ -2770,21 +2914,74 @@ static void do_cciss_request(request_queue_t *q)
 	c->Request.CDB[7] = (creq->nr_sectors >> 8) & 0xff;
 	c->Request.CDB[8] = creq->nr_sectors & 0xff;
 	c->Request.CDB[9] = c->Request.CDB[11] = c->Request.CDB[12] = 0;
+}
 
-	spin_lock_irq(q->queue_lock);
+/*
+ * Get requests and submit them to the controller.  Up to
+ * CCISS_SUBMIT_BATCH requests are taken off the queue per lock round
+ * trip; their commands are built with the lock dropped and then posted
+ * to the controller back-to-back.
+ */
+static void do_cciss_request(request_queue_t *q)
+{
+	ctlr_info_t *h = q->queuedata;
+	CommandList_struct *c;
+	CommandList_struct *batch[CCISS_SUBMIT_BATCH];
+	struct request *creq;
+	int n, i;
 
-	addQ(&(h->reqQ), c);
-	h->Qdepth++;
-	if (h->Qdepth > h->maxQsinceinit)
-		h->maxQsinceinit = h->Qdepth;
+	/* We call start_io here in case there is a command waiting on the
+	 * queue that has not been sent.
+	 */
+	if (blk_queue_plugged(q))
+		goto startio;
+
+	do {
+		n = 0;
+		while (n < CCISS_SUBMIT_BATCH &&
+		       (creq = elv_next_request(q)) != NULL) {
+			BUG_ON(creq->nr_phys_segments > MAXSGENTRIES);
+
+			if ((c = cmd_alloc(h, 1)) == NULL) {
+				blk_stop_queue(q);
+				break;
+			}
+
+			blkdev_dequeue_request(creq);
+			c->rq = creq;
+			batch[n++] = c;
+		}
+		/* nothing new, but earlier commands may still be on reqQ */
+		if (n == 0)
+			goto startio;
+
+		spin_unlock_irq(q->queue_lock);
+
+		for (i = 0; i < n; i++)
+			cciss_build_rw_cmd(h, batch[i]);
+
+		spin_lock_irq(q->queue_lock);
+
+		for (i = 0; i < n; i++) {
+			addQ(&(h->reqQ), batch[i]);
+			h->Qdepth++;
+		}
+		if (h->Qdepth > h->maxQsinceinit)
+			h->maxQsinceinit = h->Qdepth;
+
+		h->submit_batches++;
+		h->submit_cmds += n;
+		if (n > h->max_submit_batch)
+			h->max_submit_batch = n;
+
+		/* We will already have the driver lock here so not need
+		 * to lock it.
+		 */
+		start_io(h);
+	} while (n == CCISS_SUBMIT_BATCH);
+	return;
 
-	goto queue;
-      full:
-	blk_stop_queue(q);
       startio:
-	/* We will already have the driver lock here so not need
-	 * to lock it.
-	 */
 	start_io(h);
 }
 
@@ -2839,6 +3036,7 @@ static irqreturn_t do_cciss_intr(int irq, void *dev_id, struct pt_regs *regs)
 	ctlr_info_t *h = dev_id;
 	CommandList_struct *c;
 	unsigned long flags;
+	unsigned int completions = 0;
 	__u32 a, a1, a2;
 
 	if (interrupt_not_for_us(h))
@@ -2851,6 +3049,7 @@ static irqreturn_t do_cciss_intr(int irq, void *dev_id, struct pt_regs *regs)
 	while (interrupt_pending(h)) {
 		while ((a = get_next_completion(h)) != FIFO_EMPTY) {
 			a1 = a;
+			completions++;
 			if ((a & 0x04)) {
 				a2 = (a >> 3);
 				if (a2 >= h->nr_cmds) {
@@ -2898,6 +3097,14 @@ static irqreturn_t do_cciss_intr(int irq, void *dev_id, struct pt_regs *regs)
 		}
 	}
 
+	/* hand everything this pass completed to one softirq run */
+	cciss_flush_completions(h);
+
+	h->intr_batches++;
+	h->intr_completions += completions;
+	if (completions > h->max_intr_completions)
+		h->max_intr_completions = completions;
+
 	spin_unlock_irqrestore(CCISS_LOCK(h->ctlr), flags);
 	return IRQ_HANDLED;
 }
@@ -3500,9 +3707,13 @@ static int __devinit cciss_init_one(struct pci_dev *pdev,
 	    pci_alloc_consistent(hba[i]->pdev,
 		    hba[i]->nr_cmds * sizeof(ErrorInfo_struct),
 		    &(hba[i]->errinfo_pool_dhandle));
+	hba[i]->nr_tag_caches = num_online_cpus();
+	hba[i]->tag_cache = kzalloc(hba[i]->nr_tag_caches *
+				    sizeof(struct cciss_tag_cache), GFP_KERNEL);
 	if ((hba[i]->cmd_pool_bits == NULL)
 	    || (hba[i]->cmd_pool == NULL)
-	    || (hba[i]->errinfo_pool == NULL)) {
+	    || (hba[i]->errinfo_pool == NULL)
+	    || (hba[i]->tag_cache == NULL)) {
 		printk(KERN_ERR "cciss: out of memory");
 		goto clean4;
 	}
@@ -3525,6 +3736,9 @@ static int __devinit cciss_init_one(struct pci_dev *pdev,
 	memset(hba[i]->cmd_pool_bits, 0,
 	       ((hba[i]->nr_cmds + BITS_PER_LONG -
 		 1) / BITS_PER_LONG) * sizeof(unsigned long));
+	for (j = 0; j < hba[i]->nr_tag_caches; j++)
+		spin_lock_init(&hba[i]->tag_cache[j].lock);
+	atomic_set(&hba[i]->cmds_in_use, 0);
 
 #ifdef CCISS_DEBUG
 	printk(KERN_DEBUG "Scanning for drives on controller cciss%d\n", i);
@@ -3624,6 +3838,7 @@ static int __devinit cciss_init_one(struct pci_dev *pdev,
 	kfree(hba[i]->scsi_rejects.complete);
 #endif
 	kfree(hba[i]->cmd_pool_bits);
+	kfree(hba[i]->tag_cache);
 	if (hba[i]->cmd_pool)
 		pci_free_consistent(hba[i]->pdev,
 				    hba[i]->nr_cmds * sizeof(CommandList_struct),
@@ -3734,6 +3949,7 @@ static void __devexit cciss_remove_one(struct pci_dev *pdev)
 	pci_free_consistent(hba[i]->pdev, hba[i]->nr_cmds * sizeof(ErrorInfo_struct),
 			    hba[i]->errinfo_pool, hba[i]->errinfo_pool_dhandle);
 	kfree(hba[i]->cmd_pool_bits);
+	kfree(hba[i]->tag_cache);
 #ifdef CONFIG_CISS_SCSI_TAPE
 	kfree(hba[i]->scsi_rejects.complete);
 #endif
@@ -3828,6 +4044,7 @@ static void fail_all_cmds(unsigned long ctlr)
 			complete_scsi_command(c, 0, 0);
 #endif
 	}
+	cciss_flush_completions(h);
 	spin_unlock_irqrestore(CCISS_LOCK(ctlr), flags);
 	return;
 }
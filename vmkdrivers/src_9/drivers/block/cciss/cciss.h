@@ -42,6 +42,28 @@ typedef struct _drive_info_struct
 				  */
 } drive_info_struct;
 
+/*
+ * Free command blocks are handed out from small per-CPU caches so the
+ * submission path doesn't scan cmd_pool_bits for every request.  A cache
+ * moves CCISS_TAG_CACHE_BATCH indices at a time to and from the bitmap;
+ * a bit set in cmd_pool_bits means the block is in use or cached.
+ * The caches are a plain array of nr_tag_caches entries, one per online
+ * CPU; each has its own lock, so two CPUs sharing one is harmless.
+ */
+#define CCISS_TAG_CACHE_SIZE	16
+#define CCISS_TAG_CACHE_BATCH	(CCISS_TAG_CACHE_SIZE / 2)
+
+struct cciss_tag_cache {
+	spinlock_t	lock;
+	int		count;
+	int		tags[CCISS_TAG_CACHE_SIZE];
+	unsigned long	refills;
+	unsigned long	steals;
+};
+
+/* Max requests do_cciss_request() builds per queue lock round trip */
+#define CCISS_SUBMIT_BATCH	8
+
 #ifdef CONFIG_CISS_SCSI_TAPE
 
 struct sendcmd_reject_list {
@@ -99,6 +121,21 @@ struct ctlr_info
         unsigned long  		*cmd_pool_bits;
 	int			nr_allocs;
 	int			nr_frees; 
+	struct cciss_tag_cache	*tag_cache;	/* nr_tag_caches entries */
+	int			nr_tag_caches;
+	atomic_t		cmds_in_use;	/* pool commands */
+
+	/* read/write completions gathered for one cciss_softirq_done() */
+	CommandList_struct	*cmpl_head;
+	CommandList_struct	*cmpl_tail;
+
+	/* submission and completion batching, reported in /proc */
+	unsigned long		submit_batches;
+	unsigned long		submit_cmds;
+	unsigned int		max_submit_batch;
+	unsigned long		intr_batches;
+	unsigned long		intr_completions;
+	unsigned int		max_intr_completions;
 	int			busy_configuring;
 	int			busy_initializing;
 
@@ -2825,9 +2825,9 @@ int bnx2x_close(struct net_device *dev);
 #endif
 
 #if !defined(BNX2X_UPSTREAM) || defined(BNX2X_USE_INIT_VALUES) /* ! BNX2X_UPSTREAM */
-void bnx2x_init_e1_firmware(struct bnx2x *bp);
-void bnx2x_init_e1h_firmware(struct bnx2x *bp);
-void bnx2x_init_e2_firmware(struct bnx2x *bp);
+extern const struct bnx2x_init_values bnx2x_init_values_e1;
+extern const struct bnx2x_init_values bnx2x_init_values_e1h;
+extern const struct bnx2x_init_values bnx2x_init_values_e2;
 #endif
 
 #define VF_ACQUIRE_THRESH		3
@@ -101,6 +101,30 @@ union init_op {
 	struct op_if_mode	if_mode;
 };
 
+/* Per chip init arrays as linked into the driver. The ops, ops offsets and
+ * data arrays are zipped in the firmware file layout; *_len is the size of
+ * each once inflated.
+ */
+struct bnx2x_init_values {
+	const u8	*ops;
+	u32		ops_zlen;
+	u32		ops_len;
+	const u8	*ops_offsets;
+	u32		ops_offsets_zlen;
+	u32		ops_offsets_len;
+	const u8	*data;
+	u32		data_zlen;
+	u32		data_len;
+	/* Zipped PRAM blobs - used in place */
+	const u8	*tsem_int_table_data;
+	const u8	*tsem_pram_data;
+	const u8	*usem_int_table_data;
+	const u8	*usem_pram_data;
+	const u8	*xsem_int_table_data;
+	const u8	*xsem_pram_data;
+	const u8	*csem_int_table_data;
+	const u8	*csem_pram_data;
+};
 
 /* Init Phases */
 enum {
@@ -16,6 +16,10 @@
 * OP_WR_64       - write a 64-bit pattern to consecutive registers.
 * OP_IF_MODE_OR  - skip next ops if all modes do not match.
 * OP_IF_MODE_AND - skip next ops if at least one mode does not match.
+*
+* The operations, their block offsets and the data blob are stored zipped in
+* the big endian layout of the bnx2x firmware file and are inflated by
+* bnx2x_init_firmware() only for the chip being initialized.
 */
 #ifdef __KERNEL__
 #include <linux/version.h>
@@ -28,1458 +32,524 @@
 #include "bnx2x_init.h"
 #endif
 
-static const struct raw_op init_ops_e1[] = {
-/* #define BRB1_COMMON_START        22 */
-	{OP_WR, 0x600dc, 0x1},
-	{OP_SW, 0x61000, 0x2000000},
-	{OP_RD, 0x600d8, 0x0},
-	{OP_SW, 0x60200, 0x30200},
-	{OP_WR, 0x600dc, 0x0},
-/* #define BRB1_COMMON_END          23 */
-/* #define BRB1_PORT0_START        24 */
-	{OP_WR, 0x60068, 0xb8},
-	{OP_WR, 0x60078, 0x114},
-	{OP_RD, 0x600b8, 0x0},
-	{OP_RD, 0x600c8, 0x0},
-/* #define BRB1_PORT0_END          25 */
-/* #define BRB1_PORT1_START        26 */
-	{OP_WR, 0x6006c, 0xb8},
-	{OP_WR, 0x6007c, 0x114},
-	{OP_RD, 0x600bc, 0x0},
-	{OP_RD, 0x600cc, 0x0},
-/* #define BRB1_PORT1_END          27 */
-/* #define CCM_COMMON_START        44 */
-	{OP_WR, 0xd0044, 0x32},
-	{OP_SW, 0xd004c, 0x40203},
-	{OP_ZR, 0xd005c, 0x4},
-	{OP_SW, 0xd008c, 0x110207},
-	{OP_WR, 0xd015c, 0x1},
-	{OP_SW, 0xd0164, 0x20218},
-	{OP_WR, 0xd0204, 0x1},
-	{OP_SW, 0xd020c, 0x3021a},
-	{OP_SW, 0xd0220, 0x2021d},
-	{OP_ZR, 0xd0280, 0x12},
-	{OP_SW, 0xd0300, 0x18021f},
-	{OP_ZR, 0xd0360, 0xc},
-	{OP_ZR, 0xd4000, 0xa00},
-	{OP_SW, 0xd0004, 0xf0237},
-/* #define CCM_COMMON_END          45 */
-/* #define CCM_PORT0_START        46 */
-	{OP_WR, 0xd0114, 0xd},
-/* #define CCM_PORT0_END          47 */
-/* #define CCM_PORT1_START        48 */
-	{OP_WR, 0xd0118, 0x2d},
-/* #define CCM_PORT1_END          49 */
-/* #define CDU_COMMON_START        66 */
-	{OP_SW, 0x101000, 0x30246},
-	{OP_WR, 0x101010, 0x264},
-	{OP_WB, 0x101100, 0x100249},
-	{OP_WB_ZR, 0x101140, 0x8},
-	{OP_WB, 0x101160, 0x100259},
-	{OP_WB_ZR, 0x1011a0, 0x18},
-	{OP_WB, 0x101800, 0x2000269},
-	{OP_WR, 0x101010, 0x0},
-/* #define CDU_COMMON_END          67 */
-/* #define CFC_COMMON_START        88 */
-	{OP_ZR, 0x104c00, 0x100},
-	{OP_WR, 0x104028, 0x10},
-	{OP_WR, 0x104044, 0x3fff},
-	{OP_WR, 0x104058, 0x280000},
-	{OP_WR, 0x104084, 0x84924a},
-	{OP_WR, 0x104058, 0x0},
-/* #define CFC_COMMON_END          89 */
-/* #define CSDM_COMMON_START        110 */
-	{OP_SW, 0xc2008, 0x30469},
-	{OP_SW, 0xc201c, 0x4046c},
-	{OP_SW, 0xc2038, 0x110470},
-	{OP_ZR, 0xc207c, 0x4f},
-	{OP_SW, 0xc21b8, 0x110481},
-	{OP_ZR, 0xc21fc, 0xf},
-	{OP_SW, 0xc2238, 0x40492},
-	{OP_RD, 0xc2248, 0x0},
-	{OP_RD, 0xc224c, 0x0},
-	{OP_RD, 0xc2250, 0x0},
-	{OP_RD, 0xc2254, 0x0},
-	{OP_RD, 0xc2258, 0x0},
-	{OP_RD, 0xc225c, 0x0},
-	{OP_RD, 0xc2260, 0x0},
-	{OP_RD, 0xc2264, 0x0},
-	{OP_RD, 0xc2268, 0x0},
-	{OP_RD, 0xc226c, 0x0},
-	{OP_RD, 0xc2270, 0x0},
-	{OP_RD, 0xc2274, 0x0},
-	{OP_RD, 0xc2278, 0x0},
-	{OP_RD, 0xc227c, 0x0},
-	{OP_WR, 0xc24bc, 0x1},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0xc2000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0xc2000, 0xa},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0xc2000, 0x1},
-/* #define CSDM_COMMON_END          111 */
-/* #define CSEM_COMMON_START        132 */
-	{OP_ZP, 0x200400, 0x850000},
-	{OP_WR_64, 0x200780, 0x100496},
-	{OP_ZR, 0x220000, 0x1600},
-	{OP_ZR, 0x228000, 0x40},
-	{OP_ZR, 0x223bd0, 0x8},
-	{OP_ZR, 0x224800, 0x6},
-	{OP_SW, 0x224818, 0x40498},
-	{OP_ZR, 0x224828, 0xc},
-	{OP_SW, 0x224858, 0x4049c},
-	{OP_ZR, 0x224868, 0xc},
-	{OP_SW, 0x224898, 0x404a0},
-	{OP_ZR, 0x2248a8, 0xc},
-	{OP_SW, 0x2248d8, 0x404a4},
-	{OP_ZR, 0x2248e8, 0xc},
-	{OP_SW, 0x224918, 0x404a8},
-	{OP_ZR, 0x224928, 0xc},
-	{OP_SW, 0x224958, 0x404ac},
-	{OP_ZR, 0x224968, 0xc},
-	{OP_SW, 0x224998, 0x404b0},
-	{OP_ZR, 0x2249a8, 0xc},
-	{OP_SW, 0x2249d8, 0x404b4},
-	{OP_ZR, 0x2249e8, 0xc},
-	{OP_SW, 0x224a18, 0x404b8},
-	{OP_ZR, 0x224a28, 0xc},
-	{OP_SW, 0x224a58, 0x404bc},
-	{OP_ZR, 0x224a68, 0xc},
-	{OP_SW, 0x224a98, 0x404c0},
-	{OP_ZR, 0x224aa8, 0xc},
-	{OP_SW, 0x224ad8, 0x404c4},
-	{OP_ZR, 0x224ae8, 0xc},
-	{OP_SW, 0x224b18, 0x404c8},
-	{OP_ZR, 0x224b28, 0xc},
-	{OP_SW, 0x224b58, 0x404cc},
-	{OP_ZR, 0x224b68, 0xc},
-	{OP_SW, 0x224b98, 0x404d0},
-	{OP_ZR, 0x224ba8, 0xc},
-	{OP_SW, 0x224bd8, 0x404d4},
-	{OP_ZR, 0x224be8, 0xc},
-	{OP_SW, 0x224c18, 0x404d8},
-	{OP_ZR, 0x224c28, 0xc},
-	{OP_SW, 0x224c58, 0x404dc},
-	{OP_ZR, 0x224c68, 0xc},
-	{OP_SW, 0x224c98, 0x404e0},
-	{OP_ZR, 0x224ca8, 0xc},
-	{OP_SW, 0x224cd8, 0x404e4},
-	{OP_ZR, 0x224ce8, 0xc},
-	{OP_SW, 0x224d18, 0x404e8},
-	{OP_ZR, 0x224d28, 0xc},
-	{OP_SW, 0x224d58, 0x404ec},
-	{OP_ZR, 0x224d68, 0xc},
-	{OP_SW, 0x224d98, 0x404f0},
-	{OP_ZR, 0x224da8, 0xc},
-	{OP_SW, 0x224dd8, 0x404f4},
-	{OP_ZR, 0x224de8, 0xc},
-	{OP_SW, 0x224e18, 0x404f8},
-	{OP_ZR, 0x224e28, 0xc},
-	{OP_SW, 0x224e58, 0x404fc},
-	{OP_ZR, 0x224e68, 0xc},
-	{OP_SW, 0x224e98, 0x40500},
-	{OP_ZR, 0x224ea8, 0xc},
-	{OP_SW, 0x224ed8, 0x40504},
-	{OP_ZR, 0x224ee8, 0xc},
-	{OP_SW, 0x224f18, 0x40508},
-	{OP_ZR, 0x224f28, 0xc},
-	{OP_SW, 0x224f58, 0x4050c},
-	{OP_ZR, 0x224f68, 0xc},
-	{OP_SW, 0x224f98, 0x40510},
-	{OP_ZR, 0x224fa8, 0xc},
-	{OP_SW, 0x224fd8, 0x40514},
-	{OP_ZR, 0x224fe8, 0x6},
-	{OP_SW, 0x225198, 0x40518},
-	{OP_WR, 0x238000, 0x10},
-	{OP_WR, 0x238040, 0x12},
-	{OP_WR, 0x238080, 0x30},
-	{OP_WR, 0x2380c0, 0xe},
-	{OP_WR, 0x238380, 0x7a120},
-	{OP_WR, 0x2383c0, 0x1f4},
-	{OP_WR, 0x238bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x1}, /* asic */
-	{OP_WR, 0x238300, 0x7a120},
-	{OP_WR, 0x238340, 0x1f4},
-	{OP_IF_MODE_AND, 2, 0x2}, /* fpga */
-	{OP_WR, 0x238300, 0x1388},
-	{OP_WR, 0x238340, 0x5},
-	{OP_IF_MODE_AND, 2, 0x4}, /* emul */
-	{OP_WR, 0x238300, 0x138},
-	{OP_WR, 0x238340, 0x0},
-	{OP_ZP, 0x240000, 0x336a0000},
-	{OP_ZP, 0x248000, 0xf440cdb},
-	{OP_WR_64, 0x249cc0, 0x6ace051c},
-	{OP_RD, 0x200000, 0x0},
-	{OP_RD, 0x200004, 0x0},
-	{OP_RD, 0x200008, 0x0},
-	{OP_RD, 0x20000c, 0x0},
-	{OP_RD, 0x200010, 0x0},
-	{OP_RD, 0x200014, 0x0},
-	{OP_SW, 0x200020, 0x1a051e},
-	{OP_SW, 0x2000a4, 0x20538},
-	{OP_WR, 0x200224, 0x0},
-	{OP_WR, 0x200234, 0x0},
-	{OP_WR, 0x20024c, 0x0},
-	{OP_WR, 0x2002e4, 0xffff},
-	{OP_WB_ZR, 0x202000, 0x800},
-/* #define CSEM_COMMON_END          133 */
-/* #define CSEM_PORT0_START        134 */
-	{OP_ZR, 0x221400, 0x2},
-	{OP_ZR, 0x221490, 0x30},
-	{OP_ZR, 0x223900, 0x10},
-	{OP_ZR, 0x225108, 0x2},
-	{OP_ZR, 0x2251a8, 0x6},
-/* #define CSEM_PORT0_END          135 */
-/* #define CSEM_PORT1_START        136 */
-	{OP_ZR, 0x221408, 0x2},
-	{OP_ZR, 0x221550, 0x30},
-	{OP_ZR, 0x223940, 0x10},
-	{OP_ZR, 0x225110, 0x2},
-	{OP_ZR, 0x2251c0, 0x6},
-/* #define CSEM_PORT1_END          137 */
-/* #define DMAE_COMMON_START        176 */
-	{OP_ZR, 0x102400, 0xe0},
-	{OP_SW, 0x10201c, 0x2053a},
-	{OP_WR, 0x1020c0, 0x1},
-	{OP_SW, 0x102004, 0x2053c},
-/* #define DMAE_COMMON_END          177 */
-/* #define DORQ_COMMON_START        198 */
-	{OP_WR, 0x170008, 0x2},
-	{OP_WR, 0x17002c, 0x3},
-	{OP_SW, 0x170038, 0x2053e},
-	{OP_SW, 0x170044, 0x60540},
-	{OP_SW, 0x170060, 0x50546},
-	{OP_SW, 0x170078, 0x2054b},
-	{OP_WR, 0x170004, 0xf},
-/* #define DORQ_COMMON_END          199 */
-/* #define HC_COMMON_START        220 */
-	{OP_ZR, 0x108068, 0x4},
-/* #define HC_COMMON_END          221 */
-/* #define HC_PORT0_START        222 */
-	{OP_WR, 0x108000, 0x1080},
-	{OP_ZR, 0x108040, 0x2},
-	{OP_ZR, 0x108028, 0x2},
-	{OP_WR, 0x108038, 0x10},
-	{OP_SW, 0x108040, 0x2054d},
-	{OP_WR, 0x108050, 0x0},
-	{OP_WR, 0x108100, 0x0},
-	{OP_ZR, 0x108120, 0x2},
-	{OP_WR, 0x108008, 0x2b5},
-	{OP_WR, 0x108010, 0x0},
-	{OP_WR, 0x108108, 0x1ffff},
-	{OP_ZR, 0x108200, 0x4a},
-	{OP_ZR, 0x108140, 0x2},
-	{OP_WR, 0x108000, 0x1a80},
-	{OP_ZR, 0x109000, 0x24},
-	{OP_ZR, 0x109120, 0x4a},
-	{OP_ZR, 0x109370, 0x4a},
-	{OP_ZR, 0x1095c0, 0x4a},
-/* #define HC_PORT0_END          223 */
-/* #define HC_PORT1_START        224 */
-	{OP_WR, 0x108004, 0x1080},
-	{OP_ZR, 0x108048, 0x2},
-	{OP_ZR, 0x108030, 0x2},
-	{OP_WR, 0x10803c, 0x10},
-	{OP_SW, 0x108048, 0x2054f},
-	{OP_WR, 0x108054, 0x0},
-	{OP_WR, 0x108104, 0x0},
-	{OP_ZR, 0x108128, 0x2},
-	{OP_WR, 0x10800c, 0x2b5},
-	{OP_WR, 0x108014, 0x0},
-	{OP_WR, 0x10810c, 0x1ffff},
-	{OP_ZR, 0x108400, 0x4a},
-	{OP_ZR, 0x108148, 0x2},
-	{OP_WR, 0x108004, 0x1a80},
-	{OP_ZR, 0x109090, 0x24},
-	{OP_ZR, 0x109248, 0x4a},
-	{OP_ZR, 0x109498, 0x4a},
-	{OP_ZR, 0x1096e8, 0x4a},
-/* #define HC_PORT1_END          225 */
-/* #define MISC_COMMON_START        264 */
-	{OP_WR, 0xa468, 0xaffdc},
-	{OP_WR, 0xa280, 0x1},
-	{OP_SW, 0xa294, 0x40551},
-	{OP_WR, 0xa4fc, 0xff000000},
-/* #define MISC_COMMON_END          265 */
-/* #define NIG_COMMON_START        286 */
-	{OP_SW, 0x100b4, 0x20555},
-	{OP_WR, 0x100dc, 0x1},
-	{OP_SW, 0x10100, 0x20557},
-/* #define NIG_COMMON_END          287 */
-/* #define NIG_PORT0_START        288 */
-	{OP_WR, 0x1007c, 0x300000},
-	{OP_WR, 0x10084, 0x28},
-	{OP_WR, 0x1008c, 0x0},
-	{OP_WR, 0x10130, 0x4},
-	{OP_ZR, 0x10138, 0x11},
-	{OP_WR, 0x10328, 0x0},
-	{OP_WR, 0x10554, 0x30},
-	{OP_WR, 0x100c4, 0x1},
-	{OP_WR, 0x100cc, 0x1},
-	{OP_WR, 0x100f8, 0x1},
-	{OP_WR, 0x100f0, 0x1},
-/* #define NIG_PORT0_END          289 */
-/* #define NIG_PORT1_START        290 */
-	{OP_WR, 0x10080, 0x300000},
-	{OP_WR, 0x10088, 0x28},
-	{OP_WR, 0x10090, 0x0},
-	{OP_WR, 0x10134, 0x4},
-	{OP_ZR, 0x1017c, 0x11},
-	{OP_WR, 0x1032c, 0x0},
-	{OP_WR, 0x10564, 0x30},
-	{OP_WR, 0x100c8, 0x1},
-	{OP_WR, 0x100d0, 0x1},
-	{OP_WR, 0x100fc, 0x1},
-	{OP_WR, 0x100f4, 0x1},
-/* #define NIG_PORT1_END          291 */
-/* #define PBF_COMMON_START        308 */
-	{OP_WR, 0x140000, 0x1},
-	{OP_WR, 0x14000c, 0x1},
-	{OP_SW, 0x140040, 0x20559},
-	{OP_WR, 0x14000c, 0x0},
-	{OP_WR, 0x140000, 0x0},
-	{OP_WR, 0x14006c, 0x0},
-/* #define PBF_COMMON_END          309 */
-/* #define PBF_PORT0_START        310 */
-	{OP_WR, 0x140004, 0x1},
-	{OP_WR, 0x140030, 0x1},
-	{OP_WR, 0x140004, 0x0},
-	{OP_WR, 0x14005c, 0x0},
-/* #define PBF_PORT0_END          311 */
-/* #define PBF_PORT1_START        312 */
-	{OP_WR, 0x140008, 0x1},
-	{OP_WR, 0x140034, 0x1},
-	{OP_WR, 0x140008, 0x0},
-	{OP_WR, 0x140060, 0x0},
-/* #define PBF_PORT1_END          313 */
-/* #define PRS_COMMON_START        352 */
-	{OP_SW, 0x40004, 0x12055b},
-	{OP_SW, 0x40054, 0x3056d},
-	{OP_WR, 0x40070, 0x4},
-	{OP_SW, 0x40078, 0x40570},
-	{OP_ZR, 0x40088, 0x5},
-	{OP_SW, 0x4009c, 0x30574},
-	{OP_ZR, 0x400a8, 0x4},
-	{OP_SW, 0x400b8, 0x50577},
-	{OP_ZR, 0x400cc, 0x4},
-	{OP_SW, 0x400dc, 0x4057c},
-	{OP_ZR, 0x400ec, 0x4},
-	{OP_RD, 0x40124, 0x0},
-	{OP_RD, 0x40128, 0x0},
-	{OP_RD, 0x4012c, 0x0},
-	{OP_RD, 0x40130, 0x0},
-	{OP_WR, 0x40134, 0xf},
-/* #define PRS_COMMON_END          353 */
-/* #define PXP2_COMMON_START        374 */
-	{OP_SW, 0x120490, 0x220580},
-	{OP_WR, 0x120520, 0x2},
-	{OP_WR, 0x120388, 0x64},
-	{OP_WR, 0x120390, 0x8},
-	{OP_SW, 0x12039c, 0x305a2},
-	{OP_WR, 0x1203bc, 0x4},
-	{OP_WR, 0x1203c4, 0x4},
-	{OP_WR, 0x1203d0, 0x0},
-	{OP_WR, 0x1203dc, 0x0},
-	{OP_WR, 0x12036c, 0x1},
-	{OP_WR, 0x120368, 0x3f},
-	{OP_SW, 0x1201bc, 0x3c05a5},
-	{OP_SW, 0x1202b0, 0x205e1},
-	{OP_SW, 0x120324, 0x205e3},
-	{OP_WR, 0x1201b0, 0x1},
-/* #define PXP2_COMMON_END          375 */
-/* #define PXP_COMMON_START        396 */
-	{OP_WB, 0x103800, 0x505e5},
-	{OP_WB, 0x103c00, 0x505ea},
-	{OP_WB, 0x103c20, 0x505ef},
-/* #define PXP_COMMON_END          397 */
-/* #define QM_COMMON_START        418 */
-	{OP_SW, 0x168030, 0x805f4},
-	{OP_WR, 0x168054, 0x2},
-	{OP_SW, 0x168060, 0x505fc},
-	{OP_ZR, 0x168074, 0x7},
-	{OP_SW, 0x168090, 0x20601},
-	{OP_SW, 0x16809c, 0x50603},
-	{OP_ZR, 0x1680b0, 0x7},
-	{OP_SW, 0x1680cc, 0x80608},
-	{OP_WR, 0x1680f0, 0x7},
-	{OP_ZR, 0x1680f4, 0xc},
-	{OP_SW, 0x168124, 0x40610},
-	{OP_ZR, 0x168134, 0xc},
-	{OP_SW, 0x168164, 0x3b0614},
-	{OP_ZR, 0x168250, 0x4},
-	{OP_SW, 0x168260, 0x2064f},
-	{OP_ZR, 0x168268, 0x8},
-	{OP_SW, 0x168288, 0x80651},
-	{OP_ZR, 0x1682a8, 0xa},
-	{OP_WR, 0x168804, 0x4},
-	{OP_SW, 0x16880c, 0x100659},
-	{OP_WR, 0x1680ec, 0xff},
-/* #define QM_COMMON_END          419 */
-/* #define SRC_COMMON_START        440 */
-	{OP_SW, 0x40408, 0x140669},
-/* #define SRC_COMMON_END          441 */
-/* #define TCM_COMMON_START        462 */
-	{OP_SW, 0x50044, 0x2067d},
-	{OP_SW, 0x50050, 0x4067f},
-	{OP_ZR, 0x50060, 0x4},
-	{OP_SW, 0x50090, 0x130683},
-	{OP_WR, 0x50114, 0x1},
-	{OP_SW, 0x5011c, 0x20696},
-	{OP_WR, 0x50204, 0x1},
-	{OP_SW, 0x5020c, 0x20698},
-	{OP_SW, 0x5021c, 0x3069a},
-	{OP_ZR, 0x50240, 0xa},
-	{OP_SW, 0x50280, 0x20069d},
-	{OP_ZR, 0x54000, 0xd00},
-	{OP_SW, 0x50004, 0x1006bd},
-/* #define TCM_COMMON_END          463 */
-/* #define TCM_PORT0_START        464 */
-	{OP_WR, 0x500e0, 0xe},
-/* #define TCM_PORT0_END          465 */
-/* #define TCM_PORT1_START        466 */
-	{OP_WR, 0x500e4, 0x2e},
-/* #define TCM_PORT1_END          467 */
-/* #define TM_COMMON_START        484 */
-	{OP_ZR, 0x164024, 0x2},
-	{OP_SW, 0x164030, 0x306cd},
-	{OP_WR, 0x164044, 0x20},
-	{OP_WR, 0x164070, 0x1c},
-	{OP_WR, 0x164208, 0x1},
-	{OP_WR, 0x164210, 0x1},
-	{OP_WR, 0x164220, 0x1},
-	{OP_WR, 0x164228, 0x1},
-	{OP_WR, 0x164230, 0x1},
-	{OP_WR, 0x164238, 0x1},
-	{OP_WR, 0x164260, 0x1},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0x16401c, 0x3d090},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x16401c, 0x9c4},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x16401c, 0x9c},
-	{OP_WR, 0x164000, 0x1},
-	{OP_WR, 0x1640d8, 0x1},
-	{OP_SW, 0x164008, 0x306d0},
-/* #define TM_COMMON_END          485 */
-/* #define TM_PORT0_START        486 */
-	{OP_WR, 0x164240, 0x0},
-	{OP_WR, 0x164248, 0x0},
-	{OP_WB_ZR, 0x164270, 0x2},
-/* #define TM_PORT0_END          487 */
-/* #define TM_PORT1_START        488 */
-	{OP_WR, 0x164250, 0x0},
-	{OP_WR, 0x164258, 0x0},
-	{OP_WB_ZR, 0x164280, 0x2},
-/* #define TM_PORT1_END          489 */
-/* #define TSDM_COMMON_START        506 */
-	{OP_SW, 0x42008, 0x406d3},
-	{OP_SW, 0x4201c, 0x406d7},
-	{OP_ZR, 0x42038, 0x80},
-	{OP_SW, 0x42238, 0x406db},
-	{OP_RD, 0x42248, 0x0},
-	{OP_RD, 0x4224c, 0x0},
-	{OP_RD, 0x42250, 0x0},
-	{OP_RD, 0x42254, 0x0},
-	{OP_RD, 0x42258, 0x0},
-	{OP_RD, 0x4225c, 0x0},
-	{OP_RD, 0x42260, 0x0},
-	{OP_RD, 0x42264, 0x0},
-	{OP_RD, 0x42268, 0x0},
-	{OP_RD, 0x4226c, 0x0},
-	{OP_RD, 0x42270, 0x0},
-	{OP_RD, 0x42274, 0x0},
-	{OP_RD, 0x42278, 0x0},
-	{OP_RD, 0x4227c, 0x0},
-	{OP_WR, 0x424bc, 0x1},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0x42000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x42000, 0xa},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x42000, 0x1},
-/* #define TSDM_COMMON_END          507 */
-/* #define TSEM_COMMON_START        528 */
-	{OP_ZP, 0x180400, 0x6a0000},
-	{OP_WR_64, 0x180760, 0x1406df},
-	{OP_ZR, 0x1a0000, 0x1600},
-	{OP_ZR, 0x1a8000, 0x40},
-	{OP_SW, 0x1a08b0, 0x206e1},
-	{OP_SW, 0x1a19c8, 0x206e3},
-	{OP_SW, 0x1a2fc0, 0x406e5},
-	{OP_ZR, 0x1a2fd0, 0x6},
-	{OP_SW, 0x1a2fe8, 0x206e9},
-	{OP_SW, 0x1a3000, 0x3f906eb},
-	{OP_ZR, 0x1a3fe4, 0x7},
-	{OP_SW, 0x1a4870, 0x40ae4},
-	{OP_WR, 0x1b8000, 0x34},
-	{OP_WR, 0x1b8040, 0x18},
-	{OP_WR, 0x1b8080, 0xc},
-	{OP_WR, 0x1b80c0, 0x20},
-	{OP_WR, 0x1b8380, 0x7a120},
-	{OP_WR, 0x1b83c0, 0x1f4},
-	{OP_WR, 0x1b8bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x1}, /* asic */
-	{OP_WR, 0x1b8300, 0x7a120},
-	{OP_WR, 0x1b8340, 0x1f4},
-	{OP_IF_MODE_AND, 2, 0x2}, /* fpga */
-	{OP_WR, 0x1b8300, 0x1388},
-	{OP_WR, 0x1b8340, 0x5},
-	{OP_IF_MODE_AND, 2, 0x4}, /* emul */
-	{OP_WR, 0x1b8300, 0x138},
-	{OP_WR, 0x1b8340, 0x0},
-	{OP_ZP, 0x1c0000, 0x2d070000},
-	{OP_ZP, 0x1c8000, 0x34480b42},
-	{OP_ZP, 0x1d0000, 0x215a1854},
-	{OP_WR_64, 0x1d4d70, 0x56520ae8},
-	{OP_RD, 0x180000, 0x0},
-	{OP_RD, 0x180004, 0x0},
-	{OP_RD, 0x180008, 0x0},
-	{OP_RD, 0x18000c, 0x0},
-	{OP_RD, 0x180010, 0x0},
-	{OP_RD, 0x180014, 0x0},
-	{OP_SW, 0x180020, 0x1a0aea},
-	{OP_SW, 0x1800a4, 0x20b04},
-	{OP_WR, 0x180224, 0x0},
-	{OP_WR, 0x180234, 0x0},
-	{OP_WR, 0x18024c, 0x0},
-	{OP_WR, 0x1802e4, 0xff},
-	{OP_WB_ZR, 0x181000, 0x400},
-/* #define TSEM_COMMON_END          529 */
-/* #define TSEM_PORT0_START        530 */
-	{OP_ZR, 0x1a0800, 0x2},
-	{OP_ZR, 0x1a0820, 0x12},
-	{OP_ZR, 0x1a09c0, 0x48},
-	{OP_ZR, 0x1a2500, 0x10},
-	{OP_ZR, 0x1a2580, 0x12},
-	{OP_ZR, 0x1a2610, 0x12},
-	{OP_SW, 0x1a2fb0, 0x20b06},
-	{OP_ZR, 0x1a4000, 0x6},
-	{OP_ZR, 0x1a4030, 0x2},
-	{OP_ZR, 0x1a4820, 0x2},
-	{OP_SW, 0x1a4c50, 0x20b08},
-/* #define TSEM_PORT0_END          531 */
-/* #define TSEM_PORT1_START        532 */
-	{OP_ZR, 0x1a0810, 0x2},
-	{OP_ZR, 0x1a0868, 0x12},
-	{OP_ZR, 0x1a0ae0, 0x48},
-	{OP_ZR, 0x1a2540, 0x10},
-	{OP_ZR, 0x1a25c8, 0x12},
-	{OP_ZR, 0x1a2658, 0x12},
-	{OP_SW, 0x1a2fb8, 0x20b0a},
-	{OP_ZR, 0x1a4018, 0x6},
-	{OP_ZR, 0x1a4038, 0x2},
-	{OP_ZR, 0x1a4828, 0x2},
-	{OP_SW, 0x1a4c58, 0x20b0c},
-/* #define TSEM_PORT1_END          533 */
-/* #define UCM_COMMON_START        550 */
-	{OP_WR, 0xe004c, 0x32},
-	{OP_SW, 0xe0054, 0x40b0e},
-	{OP_ZR, 0xe0064, 0x4},
-	{OP_SW, 0xe0094, 0x130b12},
-	{OP_WR, 0xe0144, 0x1},
-	{OP_SW, 0xe014c, 0x20b25},
-	{OP_WR, 0xe0204, 0x1},
-	{OP_SW, 0xe020c, 0x20b27},
-	{OP_SW, 0xe021c, 0x40b29},
-	{OP_SW, 0xe0280, 0x1b0b2d},
-	{OP_ZR, 0xe02ec, 0x17},
-	{OP_ZR, 0xe2000, 0x800},
-	{OP_SW, 0xe0004, 0x110b48},
-/* #define UCM_COMMON_END          551 */
-/* #define UCM_PORT0_START        552 */
-	{OP_WR, 0xe0110, 0xf},
-/* #define UCM_PORT0_END          553 */
-/* #define UCM_PORT1_START        554 */
-	{OP_WR, 0xe0114, 0x2f},
-/* #define UCM_PORT1_END          555 */
-/* #define UPB_COMMON_START        572 */
-	{OP_WR, 0xc1000, 0x28},
-/* #define UPB_COMMON_END          573 */
-/* #define USDM_COMMON_START        594 */
-	{OP_SW, 0xc4008, 0x40b59},
-	{OP_SW, 0xc401c, 0x40b5d},
-	{OP_SW, 0xc4038, 0x20b61},
-	{OP_ZR, 0xc4040, 0x5e},
-	{OP_WR, 0xc41b8, 0x1},
-	{OP_ZR, 0xc41bc, 0x1f},
-	{OP_SW, 0xc4238, 0x40b63},
-	{OP_RD, 0xc4248, 0x0},
-	{OP_RD, 0xc424c, 0x0},
-	{OP_RD, 0xc4250, 0x0},
-	{OP_RD, 0xc4254, 0x0},
-	{OP_RD, 0xc4258, 0x0},
-	{OP_RD, 0xc425c, 0x0},
-	{OP_RD, 0xc4260, 0x0},
-	{OP_RD, 0xc4264, 0x0},
-	{OP_RD, 0xc4268, 0x0},
-	{OP_RD, 0xc426c, 0x0},
-	{OP_RD, 0xc4270, 0x0},
-	{OP_RD, 0xc4274, 0x0},
-	{OP_RD, 0xc4278, 0x0},
-	{OP_RD, 0xc427c, 0x0},
-	{OP_RD, 0xc4280, 0x0},
-	{OP_WR, 0xc44c0, 0x1},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0xc4000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0xc4000, 0xa},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0xc4000, 0x1},
-/* #define USDM_COMMON_END          595 */
-/* #define USEM_COMMON_START        616 */
-	{OP_ZP, 0x300400, 0x9a0000},
-	{OP_WR_64, 0x300768, 0x130b67},
-	{OP_ZR, 0x320000, 0x1600},
-	{OP_ZR, 0x328000, 0x40},
-	{OP_SW, 0x321830, 0x20b69},
-	{OP_SW, 0x322e70, 0x40b6b},
-	{OP_ZR, 0x325080, 0x8},
-	{OP_SW, 0x3250a0, 0x20b6f},
-	{OP_WR, 0x338000, 0x1a},
-	{OP_WR, 0x338040, 0x4e},
-	{OP_WR, 0x338080, 0x10},
-	{OP_WR, 0x3380c0, 0x20},
-	{OP_WR, 0x338380, 0x7a120},
-	{OP_WR, 0x3383c0, 0x1f4},
-	{OP_WR, 0x338bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x1}, /* asic */
-	{OP_WR, 0x338300, 0x7a120},
-	{OP_WR, 0x338340, 0x1f4},
-	{OP_IF_MODE_AND, 2, 0x2}, /* fpga */
-	{OP_WR, 0x338300, 0x1388},
-	{OP_WR, 0x338340, 0x5},
-	{OP_IF_MODE_AND, 2, 0x4}, /* emul */
-	{OP_WR, 0x338300, 0x138},
-	{OP_WR, 0x338340, 0x0},
-	{OP_ZP, 0x340000, 0x37030000},
-	{OP_ZP, 0x348000, 0x31d50dc1},
-	{OP_ZP, 0x350000, 0x2cd91a37},
-	{OP_WR_64, 0x356510, 0x535e0b71},
-	{OP_RD, 0x300000, 0x0},
-	{OP_RD, 0x300004, 0x0},
-	{OP_RD, 0x300008, 0x0},
-	{OP_RD, 0x30000c, 0x0},
-	{OP_RD, 0x300010, 0x0},
-	{OP_RD, 0x300014, 0x0},
-	{OP_SW, 0x300020, 0x1a0b73},
-	{OP_SW, 0x3000a4, 0x20b8d},
-	{OP_WR, 0x300224, 0x0},
-	{OP_WR, 0x300234, 0x0},
-	{OP_WR, 0x30024c, 0x0},
-	{OP_WR, 0x3002e4, 0xffff},
-	{OP_WB_ZR, 0x302000, 0x800},
-/* #define USEM_COMMON_END          617 */
-/* #define USEM_PORT0_START        618 */
-	{OP_ZR, 0x322de0, 0x2},
-	{OP_ZR, 0x324000, 0xd8},
-	{OP_ZR, 0x3246c0, 0x120},
-	{OP_ZR, 0x3250c8, 0x24},
-/* #define USEM_PORT0_END          619 */
-/* #define USEM_PORT1_START        620 */
-	{OP_ZR, 0x322de8, 0x2},
-	{OP_ZR, 0x324360, 0xd8},
-	{OP_ZR, 0x324b40, 0x120},
-	{OP_ZR, 0x325158, 0x24},
-/* #define USEM_PORT1_END          621 */
-/* #define XCM_COMMON_START        638 */
-	{OP_WR, 0x20058, 0x32},
-	{OP_SW, 0x20060, 0x40b8f},
-	{OP_ZR, 0x20070, 0x4},
-	{OP_SW, 0x200a0, 0xe0b93},
-	{OP_SW, 0x200dc, 0x70ba1},
-	{OP_WR, 0x200fc, 0x6},
-	{OP_WR, 0x20120, 0x0},
-	{OP_WR, 0x20134, 0x2},
-	{OP_WR, 0x201b0, 0x1},
-	{OP_WR, 0x2020c, 0x1},
-	{OP_SW, 0x20214, 0x20ba8},
-	{OP_WR, 0x20404, 0x1},
-	{OP_SW, 0x2040c, 0x20baa},
-	{OP_SW, 0x2041c, 0x40bac},
-	{OP_SW, 0x20480, 0x1f0bb0},
-	{OP_ZR, 0x204fc, 0x13},
-	{OP_ZR, 0x28000, 0x2000},
-	{OP_SW, 0x20004, 0x140bcf},
-/* #define XCM_COMMON_END          639 */
-/* #define XCM_PORT0_START        640 */
-	{OP_WR, 0x20108, 0xc8},
-	{OP_WR, 0x20118, 0x2},
-	{OP_WR, 0x201c4, 0x0},
-	{OP_WR, 0x201cc, 0x0},
-	{OP_WR, 0x201d4, 0x2},
-	{OP_WR, 0x201dc, 0x2},
-	{OP_WR, 0x201e4, 0xff},
-	{OP_WR, 0x201ec, 0xff},
-/* #define XCM_PORT0_END          641 */
-/* #define XCM_PORT1_START        642 */
-	{OP_WR, 0x2010c, 0xc8},
-	{OP_WR, 0x2011c, 0x2},
-	{OP_WR, 0x201c8, 0x0},
-	{OP_WR, 0x201d0, 0x0},
-	{OP_WR, 0x201d8, 0x2},
-	{OP_WR, 0x201e0, 0x2},
-	{OP_WR, 0x201e8, 0xff},
-	{OP_WR, 0x201f0, 0xff},
-/* #define XCM_PORT1_END          643 */
-/* #define XPB_COMMON_START        660 */
-	{OP_WR, 0x161000, 0x28},
-/* #define XPB_COMMON_END          661 */
-/* #define XSDM_COMMON_START        682 */
-	{OP_SW, 0x166008, 0x30be3},
-	{OP_SW, 0x16601c, 0x40be6},
-	{OP_SW, 0x166038, 0xd0bea},
-	{OP_ZR, 0x16606c, 0x13},
-	{OP_SW, 0x1660b8, 0x20bf7},
-	{OP_ZR, 0x1660c0, 0x3e},
-	{OP_WR, 0x1661b8, 0x1},
-	{OP_ZR, 0x1661bc, 0x1f},
-	{OP_SW, 0x166238, 0x40bf9},
-	{OP_RD, 0x166248, 0x0},
-	{OP_RD, 0x16624c, 0x0},
-	{OP_RD, 0x166250, 0x0},
-	{OP_RD, 0x166254, 0x0},
-	{OP_RD, 0x166258, 0x0},
-	{OP_RD, 0x16625c, 0x0},
-	{OP_RD, 0x166260, 0x0},
-	{OP_RD, 0x166264, 0x0},
-	{OP_RD, 0x166268, 0x0},
-	{OP_RD, 0x16626c, 0x0},
-	{OP_RD, 0x166270, 0x0},
-	{OP_RD, 0x166274, 0x0},
-	{OP_RD, 0x166278, 0x0},
-	{OP_RD, 0x16627c, 0x0},
-	{OP_WR, 0x1664bc, 0x1},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0x166000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x166000, 0xa},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x166000, 0x1},
-/* #define XSDM_COMMON_END          683 */
-/* #define XSEM_COMMON_START        704 */
-	{OP_ZP, 0x280400, 0x8a0000},
-	{OP_WR_64, 0x280768, 0x130bfd},
-	{OP_ZR, 0x2a0000, 0x1600},
-	{OP_ZR, 0x2a8000, 0x40},
-	{OP_SW, 0x2a2500, 0x20bff},
-	{OP_SW, 0x2a2960, 0x40c01},
-	{OP_SW, 0x2a2f48, 0x20c05},
-	{OP_SW, 0x2a3368, 0x20c07},
-	{OP_SW, 0x2a3920, 0x20c09},
-	{OP_SW, 0x2a3930, 0x20c0b},
-	{OP_SW, 0x2a3ac8, 0x20c0d},
-	{OP_ZR, 0x2a3ad0, 0x6},
-	{OP_SW, 0x2a3b98, 0x20c0f},
-	{OP_SW, 0x2a3c20, 0x40c11},
-	{OP_WR, 0x2a3cd0, 0x0},
-	{OP_WR, 0x2b8000, 0x0},
-	{OP_WR, 0x2b8040, 0x18},
-	{OP_WR, 0x2b8080, 0xc},
-	{OP_WR, 0x2b80c0, 0x66},
-	{OP_WR, 0x2b8380, 0x7a120},
-	{OP_WR, 0x2b83c0, 0x1f4},
-	{OP_WR, 0x2b8bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x1}, /* asic */
-	{OP_WR, 0x2b8300, 0x7a120},
-	{OP_WR, 0x2b8340, 0x1f4},
-	{OP_IF_MODE_AND, 2, 0x2}, /* fpga */
-	{OP_WR, 0x2b8300, 0x1388},
-	{OP_WR, 0x2b8340, 0x5},
-	{OP_IF_MODE_AND, 2, 0x4}, /* emul */
-	{OP_WR, 0x2b8300, 0x138},
-	{OP_WR, 0x2b8340, 0x0},
-	{OP_IF_MODE_AND, 1, 0x20}, /* port2 */
-	{OP_WR, 0x2a3cd4, 0x0},
-	{OP_ZP, 0x2c0000, 0x36b20000},
-	{OP_ZP, 0x2c8000, 0x39e90dad},
-	{OP_ZP, 0x2d0000, 0x3b021c28},
-	{OP_ZP, 0x2d8000, 0x17b52ae9},
-	{OP_WR_64, 0x2db030, 0x49fa0c15},
-	{OP_RD, 0x280000, 0x0},
-	{OP_RD, 0x280004, 0x0},
-	{OP_RD, 0x280008, 0x0},
-	{OP_RD, 0x28000c, 0x0},
-	{OP_RD, 0x280010, 0x0},
-	{OP_RD, 0x280014, 0x0},
-	{OP_SW, 0x280020, 0x1a0c17},
-	{OP_SW, 0x2800a4, 0x20c31},
-	{OP_WR, 0x280224, 0x0},
-	{OP_WR, 0x280234, 0x0},
-	{OP_WR, 0x28024c, 0x0},
-	{OP_WR, 0x2802e4, 0xffff},
-	{OP_WB_ZR, 0x282000, 0x800},
-/* #define XSEM_COMMON_END          705 */
-/* #define XSEM_PORT0_START        706 */
-	{OP_ZR, 0x2a3910, 0x2},
-	{OP_ZR, 0x2a3938, 0x20},
-	{OP_ZR, 0x2a3a38, 0x10},
-	{OP_SW, 0x2a3ae8, 0x20c33},
-	{OP_SW, 0x2a3af8, 0x100c35},
-	{OP_ZR, 0x2a3c30, 0x2},
-	{OP_ZR, 0x2a5000, 0x2},
-	{OP_ZR, 0x2a5010, 0x2},
-	{OP_ZR, 0x2a5020, 0x2},
-	{OP_ZR, 0x2a5030, 0x2},
-	{OP_WR, 0x2a5040, 0x0},
-	{OP_ZR, 0x2a5048, 0xe},
-/* #define XSEM_PORT0_END          707 */
-/* #define XSEM_PORT1_START        708 */
-	{OP_ZR, 0x2a3918, 0x2},
-	{OP_ZR, 0x2a39b8, 0x20},
-	{OP_ZR, 0x2a3a78, 0x10},
-	{OP_SW, 0x2a3af0, 0x20c45},
-	{OP_SW, 0x2a3b38, 0x100c47},
-	{OP_ZR, 0x2a3c38, 0x2},
-	{OP_ZR, 0x2a5008, 0x2},
-	{OP_ZR, 0x2a5018, 0x2},
-	{OP_ZR, 0x2a5028, 0x2},
-	{OP_ZR, 0x2a5038, 0x2},
-	{OP_WR, 0x2a5044, 0x0},
-	{OP_ZR, 0x2a5080, 0xe},
-/* #define XSEM_PORT1_END          709 */
-/* #define MISC_AEU_COMMON_START        726 */
-	{OP_ZR, 0xa000, 0x16},
-/* #define MISC_AEU_COMMON_END          727 */
-/* #define MISC_AEU_PORT0_START        728 */
-	{OP_SW, 0xa06c, 0x60c57},
-	{OP_ZR, 0xa084, 0x5},
-	{OP_WR, 0xa098, 0xfe00000},
-	{OP_ZR, 0xa09c, 0x14},
-	{OP_SW, 0xa0ec, 0x80c5d},
-	{OP_ZR, 0xa22c, 0x4},
-	{OP_WR, 0xa060, 0x307},
-/* #define MISC_AEU_PORT0_END          729 */
-/* #define MISC_AEU_PORT1_START        730 */
-	{OP_SW, 0xa10c, 0x60c65},
-	{OP_ZR, 0xa124, 0x5},
-	{OP_WR, 0xa138, 0xfe00000},
-	{OP_ZR, 0xa13c, 0x14},
-	{OP_SW, 0xa18c, 0x80c6b},
-	{OP_ZR, 0xa23c, 0x4},
-	{OP_WR, 0xa064, 0x307},
-/* #define MISC_AEU_PORT1_END          731 */
-};
+static const u8 init_ops_zipped_e1[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x5d, 0x98, 
+	0x51, 0x6c, 0x5c, 0x47, 0x15, 0x86, 0xcf, 0x9d, 0x3b, 0xf7, 0xee, 0xd6, 
+	0x7b, 0xd7, 0xbe, 0xd9, 0xb8, 0x9b, 0x65, 0x9d, 0xd2, 0xed, 0xd6, 0x85, 
+	0xed, 0x3a, 0x6e, 0xb6, 0x76, 0x4a, 0x9d, 0xc4, 0x6a, 0xb7, 0x4b, 0x28, 
+	0x4e, 0xe2, 0xc4, 0x0e, 0x04, 0xea, 0x40, 0x5a, 0xb9, 0xc5, 0x05, 0xa7, 
+	0x35, 0xc2, 0x88, 0x48, 0xe4, 0x21, 0x88, 0x4d, 0x5a, 0xa4, 0x08, 0x8a, 
+	0x08, 0x6d, 0xa9, 0xa2, 0x2a, 0x48, 0x76, 0x54, 0xa4, 0x08, 0x15, 0x29, 
+	0x42, 0xad, 0xe4, 0x87, 0x20, 0x19, 0x29, 0x0f, 0x7e, 0x08, 0x60, 0x89, 
+	0x22, 0x82, 0x1a, 0x89, 0x54, 0x4d, 0x91, 0x5b, 0x22, 0x91, 0x87, 0x48, 
+	0xb4, 0x28, 0xc8, 0xfc, 0x67, 0xe6, 0x6f, 0x45, 0xfc, 0x10, 0x7d, 0xfe, 
+	0x67, 0xe6, 0x3f, 0x3b, 0x77, 0xee, 0x9c, 0xb9, 0x67, 0x62, 0x62, 0xb9, 
+	0x2c, 0x22, 0x41, 0x18, 0xa7, 0x62, 0xf4, 0x8f, 0x58, 0x2e, 0x01, 0x12, 
+	0xc6, 0x50, 0xa1, 0x11, 0xe3, 0xfb, 0x95, 0xd3, 0xc0, 0x02, 0x78, 0x04, 
+	0xa3, 0xba, 0x31, 0x6e, 0x41, 0xfc, 0xf8, 0x25, 0xf6, 0xcf, 0xb0, 0xff, 
+	0x28, 0xfb, 0xcf, 0xb3, 0xff, 0xa2, 0xeb, 0xcf, 0xcb, 0x0e, 0x60, 0x20, 
+	0xcc, 0xcb, 0xa8, 0x58, 0x13, 0xda, 0xbc, 0x1c, 0x84, 0xb6, 0xd0, 0x2f, 
+	0xc8, 0x3a, 0x93, 0x31, 0xf9, 0xe0, 0xa0, 0x9b, 0x47, 0x3e, 0x98, 0x12, 
+	0x63, 0x4a, 0x26, 0x6f, 0xac, 0xd7, 0x26, 0xc1, 0x3c, 0xca, 0x60, 0x05, 
+	0xed, 0x77, 0xd8, 0xbc, 0x69, 0xa3, 0xbd, 0x10, 0xe6, 0x43, 0x91, 0x92, 
+	0xb9, 0xd3, 0xe6, 0xc3, 0x49, 0xe8, 0xc4, 0xe6, 0x9b, 0x40, 0x87, 0x20, 
+	0x9e, 0x95, 0x2e, 0xf3, 0x20, 0xe2, 0x75, 0xa3, 0x21, 0x0f, 0x96, 0xc0, 
+	0xfe, 0x30, 0x4d, 0xf5, 0x79, 0x1e, 0x35, 0xa9, 0xfe, 0x61, 0xa6, 0x32, 
+	0xe9, 0x3a, 0x91, 0xd4, 0xec, 0xcc, 0xa6, 0xeb, 0xd4, 0x98, 0x85, 0x9e, 
+	0x84, 0x3e, 0x00, 0x3d, 0x07, 0x5d, 0xca, 0xa4, 0x25, 0xac, 0x87, 0x39, 
+	0xe4, 0xc7, 0x63, 0xa2, 0xe9, 0xa8, 0x4e, 0x47, 0x4c, 0xda, 0xac, 0x89, 
+	0x3a, 0xd3, 0x26, 0x9e, 0xe7, 0xe1, 0x55, 0x70, 0x42, 0xd0, 0x02, 0x3e, 
+	0x2f, 0xcf, 0xbf, 0xb8, 0xcb, 0x69, 0x5d, 0xbf, 0xa4, 0x92, 0x95, 0xd0, 
+	0x1e, 0x02, 0x37, 0x8a, 0xb5, 0x33, 0xe0, 0x90, 0xac, 0xb3, 0xb3, 0x36, 
+	0xa9, 0x60, 0x7d, 0x64, 0x2c, 0x4c, 0xee, 0x5a, 0x80, 0x3e, 0x66, 0x93, 
+	0xbb, 0x6e, 0x42, 0x77, 0x85, 0x49, 0x75, 0x08, 0xe3, 0x5e, 0x0c, 0x92, 
+	0xea, 0x88, 0x5b, 0xb7, 0xa4, 0x3a, 0x4a, 0x8e, 0x93, 0xfb, 0xc9, 0x09, 
+	0xf2, 0x20, 0x39, 0x49, 0x4e, 0x91, 0xd3, 0xe4, 0x0c, 0x39, 0x4b, 0x1e, 
+	0x26, 0x8f, 0x90, 0x47, 0xdd, 0x7b, 0x49, 0x7a, 0xf5, 0x3d, 0x05, 0x1d, 
+	0xfa, 0x70, 0xf8, 0x67, 0x92, 0x8a, 0xce, 0x7e, 0x85, 0xda, 0x78, 0x2d, 
+	0x1d, 0xd4, 0x96, 0x3a, 0x88, 0x2a, 0x78, 0x3d, 0x3f, 0x12, 0x89, 0x2b, 
+	0x99, 0xb6, 0xa4, 0xf6, 0x15, 0x5b, 0xd5, 0xe6, 0xa2, 0xd8, 0xaa, 0xbe, 
+	0x1e, 0x69, 0xda, 0xea, 0xf6, 0x65, 0x5d, 0x57, 0xeb, 0x1f, 0x27, 0x0e, 
+	0xab, 0x23, 0x25, 0x3c, 0xdf, 0x29, 0x68, 0x5d, 0xbf, 0x04, 0x7a, 0x02, 
+	0xfa, 0x34, 0xf4, 0x34, 0xf5, 0x29, 0xe8, 0x39, 0xe8, 0xb3, 0xd4, 0x97, 
+	0xa0, 0x5f, 0x83, 0x5e, 0xf1, 0x7a, 0xa7, 0xfa, 0xcf, 0xda, 0xea, 0x4e, 
+	0xfa, 0x77, 0xaa, 0xff, 0x75, 0x68, 0xfa, 0x77, 0xaa, 0xff, 0x1c, 0x34, 
+	0xfd, 0x3b, 0xd5, 0xff, 0x06, 0x34, 0xfd, 0xbb, 0xd4, 0xbf, 0x60, 0xab, 
+	0xbb, 0xe8, 0xdf, 0xa5, 0xfe, 0xf3, 0xd0, 0xf4, 0xef, 0x52, 0xff, 0x22, 
+	0x34, 0xfd, 0xbb, 0xd4, 0x7f, 0x01, 0x9a, 0xfe, 0xdd, 0xea, 0x5f, 0xb2, 
+	0xd5, 0xdd, 0xf4, 0xef, 0x56, 0xff, 0x45, 0x68, 0xfa, 0x77, 0xab, 0x7f, 
+	0x19, 0x9a, 0xfe, 0xdd, 0xea, 0x7f, 0x0b, 0x9a, 0xfe, 0x51, 0xf5, 0x5f, 
+	0xb2, 0xd5, 0x51, 0xfa, 0x47, 0xd5, 0x7f, 0x19, 0x9a, 0xfe, 0x51, 0xf5, 
+	0x5f, 0x81, 0xa6, 0x7f, 0x54, 0xfd, 0x57, 0xa1, 0xe9, 0xdf, 0xa3, 0xfe, 
+	0x15, 0x5b, 0xdd, 0x43, 0xff, 0x1e, 0xf5, 0x5f, 0x83, 0xa6, 0x7f, 0x8f, 
+	0xfa, 0xaf, 0x43, 0xd3, 0xbf, 0x47, 0xfd, 0x37, 0xa0, 0xe9, 0xdf, 0xab, 
+	0xfe, 0x0f, 0x6d, 0x75, 0x2f, 0xfd, 0x7b, 0xd5, 0x7f, 0x13, 0x9a, 0xfe, 
+	0xbd, 0xf0, 0x47, 0x78, 0x7f, 0x7b, 0xe9, 0xdf, 0x0b, 0x7f, 0x64, 0xa1, 
+	0xe9, 0x1f, 0x83, 0x3f, 0xc2, 0xfb, 0x1c, 0xa3, 0x7f, 0x0c, 0xfe, 0x28, 
+	0x81, 0xa6, 0x7f, 0x4c, 0xfd, 0x29, 0x34, 0xfd, 0x63, 0xea, 0xef, 0x86, 
+	0x5e, 0xf1, 0xef, 0x7f, 0x9f, 0xf6, 0x97, 0xcc, 0xdd, 0x6e, 0x7f, 0xa4, 
+	0xa0, 0xe6, 0x5d, 0x01, 0xd4, 0x86, 0x06, 0xb8, 0x08, 0x76, 0x9a, 0xbb, 
+	0x9f, 0x6b, 0x4b, 0x66, 0xbe, 0x02, 0x42, 0x07, 0x37, 0xcc, 0xdd, 0x3f, 
+	0x59, 0xe4, 0xfe, 0x74, 0xc7, 0x13, 0xda, 0x85, 0xfd, 0x4d, 0xed, 0x67, 
+	0xbb, 0x71, 0xed, 0xb2, 0xfe, 0x84, 0x6f, 0x97, 0x88, 0xed, 0xd6, 0xb7, 
+	0x07, 0x43, 0x6c, 0x97, 0xa8, 0x57, 0x64, 0xf0, 0x19, 0x65, 0x5b, 0xba, 
+	0x76, 0x24, 0x6f, 0xc7, 0xbd, 0xa7, 0x17, 0x9f, 0xf9, 0x63, 0xb4, 0x31, 
+	0x70, 0xdb, 0x1a, 0x23, 0x2b, 0x62, 0xc9, 0x2c, 0x99, 0x90, 0x29, 0xd9, 
+	0xed, 0xf2, 0xbb, 0x22, 0x15, 0x29, 0x47, 0x9f, 0x06, 0x5f, 0x13, 0x13, 
+	0x0d, 0x99, 0x8a, 0xe9, 0x75, 0xf9, 0x54, 0x31, 0x5b, 0xc8, 0x51, 0xf2, 
+	0xaa, 0xc8, 0xea, 0x6a, 0xb6, 0xa2, 0x3f, 0x90, 0xc5, 0xfa, 0x3a, 0xbb, 
+	0x01, 0x4f, 0xea, 0x73, 0xdb, 0xea, 0x56, 0xb7, 0x1e, 0xb6, 0xba, 0x2f, 
+	0xeb, 0xdb, 0xf7, 0xe9, 0xfa, 0xc5, 0xe8, 0xa7, 0xbe, 0x7d, 0x9c, 0xe3, 
+	0x9a, 0x1c, 0x97, 0x72, 0xdc, 0xa2, 0x1b, 0x97, 0xba, 0x9f, 0xbd, 0x12, 
+	0xa6, 0x38, 0x67, 0x4c, 0xb4, 0xcd, 0xa4, 0x15, 0xb7, 0x5e, 0xd0, 0x16, 
+	0x7a, 0xd8, 0x6c, 0x70, 0xcf, 0x61, 0xc0, 0x4d, 0x3a, 0xed, 0x70, 0x83, 
+	0x0c, 0xa1, 0xfd, 0x21, 0x70, 0x87, 0xc4, 0x51, 0x13, 0x9c, 0x94, 0x28, 
+	0x7a, 0x14, 0x3c, 0x82, 0xf6, 0xdd, 0x18, 0xa7, 0xcf, 0xdf, 0x65, 0xd3, 
+	0xf6, 0xb4, 0x5b, 0xbf, 0x54, 0x5f, 0x4f, 0xda, 0x86, 0x6e, 0xba, 0xdf, 
+	0x4d, 0xdb, 0x35, 0x17, 0x2f, 0x6d, 0x0f, 0x69, 0x47, 0xa8, 0xed, 0x26, 
+	0xda, 0x03, 0xed, 0xce, 0x29, 0x93, 0x1e, 0x13, 0x7f, 0x5e, 0x1e, 0xab, 
+	0x70, 0x1c, 0x7e, 0xdf, 0xbc, 0x09, 0xa6, 0xec, 0xcf, 0x4a, 0xb0, 0xba, 
+	0x6a, 0xd3, 0xe3, 0x2a, 0x77, 0x61, 0x5c, 0x93, 0xe3, 0x80, 0x32, 0x7e, 
+	0x47, 0x97, 0x45, 0x7a, 0x6d, 0xfa, 0xf3, 0x8a, 0xef, 0x7f, 0x69, 0xd6, 
+	0xf3, 0x17, 0xfa, 0x5c, 0x38, 0x5f, 0xdb, 0x96, 0xf3, 0x19, 0xe1, 0x7c, 
+	0x1a, 0xf4, 0x0f, 0x73, 0x3e, 0x23, 0x98, 0xcf, 0x18, 0xf4, 0x7e, 0xfe, 
+	0x9e, 0xe5, 0x7c, 0x3e, 0x9e, 0x77, 0xc2, 0xf9, 0x74, 0xb3, 0x3f, 0xf1, 
+	0xf3, 0x79, 0xfe, 0xe3, 0xf9, 0x8c, 0x70, 0x9c, 0xe5, 0x7c, 0x4e, 0xfa, 
+	0xf9, 0xbc, 0x38, 0xe2, 0xfb, 0x5f, 0x3e, 0xe5, 0xf9, 0xca, 0x8a, 0x9b, 
+	0x8f, 0xbc, 0x36, 0x2d, 0x1d, 0xab, 0x97, 0x8d, 0x9c, 0x69, 0xbb, 0x75, 
+	0x97, 0x33, 0x2f, 0x63, 0x9f, 0xef, 0x43, 0xfb, 0xcd, 0x55, 0x5d, 0xf0, 
+	0x40, 0xde, 0xc0, 0x7c, 0xbe, 0x62, 0x02, 0x7e, 0x67, 0x03, 0x1c, 0xa3, 
+	0x26, 0x7a, 0x0c, 0xfa, 0xa8, 0x60, 0xe6, 0xa0, 0xfe, 0x70, 0x0d, 0x7c, 
+	0xc1, 0xcd, 0x27, 0x08, 0xf4, 0x79, 0xac, 0x0d, 0x02, 0x5d, 0xdf, 0x75, 
+	0x26, 0x08, 0x6b, 0xbe, 0x3d, 0xda, 0xef, 0xf2, 0x24, 0x90, 0x0b, 0x2e, 
+	0x0f, 0x02, 0xf7, 0x5d, 0x55, 0x7e, 0x48, 0x5e, 0x27, 0xdb, 0x8c, 0x7b, 
+	0x82, 0x71, 0x4f, 0x32, 0xee, 0x16, 0xc6, 0x3d, 0xca, 0xb8, 0x9b, 0x18, 
+	0x77, 0x8a, 0x71, 0x97, 0xe8, 0x5f, 0x26, 0x6f, 0x92, 0x37, 0x1c, 0xbb, 
+	0x7d, 0x7a, 0x80, 0x89, 0x7b, 0x8e, 0x6e, 0xd1, 0xf7, 0x7e, 0x80, 0x5a, 
+	0xd8, 0xaf, 0x9c, 0x21, 0x2d, 0xc7, 0x37, 0x48, 0xcb, 0xf6, 0x83, 0x64, 
+	0x96, 0xed, 0x5b, 0xc8, 0x2c, 0xdb, 0xdd, 0xf7, 0x2c, 0xb4, 0x18, 0x5f, 
+	0x88, 0xbe, 0x0e, 0xee, 0x97, 0x30, 0xfa, 0x36, 0xaa, 0x81, 0x59, 0x57, 
+	0x2f, 0x58, 0xec, 0x53, 0x1b, 0xcd, 0x5a, 0xeb, 0x9e, 0x2f, 0x82, 0x3e, 
+	0x8d, 0xfe, 0xc3, 0xd0, 0x67, 0xd9, 0xbf, 0x80, 0xfd, 0xfc, 0x7d, 0xe8, 
+	0x8b, 0xd4, 0x97, 0x31, 0xfe, 0x28, 0xf4, 0x35, 0xd5, 0x81, 0x0d, 0x5c, 
+	0xc2, 0x80, 0x35, 0x72, 0x13, 0xd9, 0xf0, 0x89, 0xe9, 0xd6, 0xa9, 0x2b, 
+	0x2c, 0xd8, 0x93, 0x52, 0x8d, 0xda, 0xa6, 0x10, 0xf9, 0x7d, 0x5c, 0x08, 
+	0xf5, 0xf7, 0xa6, 0x40, 0x5d, 0xcf, 0x6c, 0x58, 0x08, 0xf5, 0x77, 0xcf, 
+	0x40, 0x9f, 0x77, 0x79, 0x52, 0x08, 0x2f, 0x90, 0xcb, 0x2e, 0x4e, 0x21, 
+	0xbc, 0x4c, 0xce, 0xb8, 0xe7, 0x2b, 0x84, 0x9a, 0x4f, 0x0f, 0x87, 0x85, 
+	0xe0, 0xbc, 0x0c, 0x47, 0xbf, 0x0a, 0x0b, 0xe6, 0x1c, 0xd6, 0xef, 0x1d, 
+	0xc4, 0xe9, 0x05, 0xdf, 0x35, 0x85, 0xe0, 0x9c, 0x8e, 0xcb, 0xa4, 0x78, 
+	0xed, 0x51, 0xf4, 0x5e, 0x26, 0x1d, 0x56, 0x7e, 0x00, 0x56, 0xc0, 0x7f, 
+	0x85, 0x45, 0xec, 0xf3, 0x6c, 0x74, 0xc3, 0x14, 0xdd, 0xbe, 0x36, 0xd0, 
+	0x9a, 0xb7, 0x37, 0x6d, 0xb1, 0xad, 0xdf, 0xf5, 0x0c, 0xf4, 0x49, 0x14, 
+	0x61, 0x01, 0x78, 0x5a, 0xa2, 0x38, 0x44, 0xfb, 0x39, 0xb6, 0x5f, 0x94, 
+	0x6c, 0x9c, 0x85, 0x4f, 0xf7, 0x47, 0x06, 0xed, 0x37, 0xdc, 0xf9, 0x5c, 
+	0x3c, 0xd6, 0x2b, 0x36, 0x4e, 0x6d, 0xf1, 0xd8, 0x16, 0xea, 0x29, 0xd9, 
+	0x1e, 0x77, 0xdb, 0xe2, 0xf1, 0x71, 0xb7, 0x6e, 0xc5, 0xe3, 0x93, 0x88, 
+	0x37, 0x06, 0x3d, 0xed, 0x9e, 0xb7, 0x78, 0xfc, 0x04, 0xe2, 0xec, 0x83, 
+	0xd6, 0x75, 0xee, 0x30, 0xc5, 0x13, 0xd6, 0x8f, 0x3b, 0x91, 0x48, 0x1a, 
+	0x1f, 0x40, 0x7c, 0x5d, 0xdf, 0xd5, 0xd0, 0xda, 0xac, 0x74, 0xc7, 0x87, 
+	0xc2, 0x08, 0xe7, 0x8b, 0x89, 0x7f, 0x00, 0x8e, 0xe3, 0x77, 0x7e, 0x88, 
+	0x4f, 0xcb, 0xa4, 0x1b, 0x1f, 0x61, 0x3f, 0xae, 0x8f, 0x9f, 0x33, 0x91, 
+	0xab, 0xcf, 0x82, 0x30, 0x0a, 0x70, 0x6e, 0xc5, 0xaf, 0x98, 0x88, 0xf5, 
+	0x5e, 0x84, 0x7a, 0xcf, 0xc4, 0xa7, 0xc0, 0x8d, 0x28, 0x42, 0x5f, 0xb5, 
+	0x91, 0x71, 0x85, 0x1d, 0x74, 0x5b, 0x2a, 0xf1, 0x2f, 0x6d, 0xa4, 0x32, 
+	0x8f, 0xa5, 0xc7, 0xfe, 0x48, 0xe3, 0xdf, 0x99, 0x48, 0xae, 0xb8, 0xef, 
+	0x46, 0x24, 0x38, 0x67, 0xe5, 0x3e, 0x5b, 0x6c, 0xf6, 0xfa, 0xf5, 0x69, 
+	0x36, 0xe0, 0xff, 0x83, 0x29, 0x6a, 0x9d, 0x26, 0x15, 0x50, 0xf7, 0xcf, 
+	0x46, 0x53, 0x6c, 0xf9, 0x7d, 0x57, 0x6c, 0xa5, 0x64, 0x85, 0xac, 0x91, 
+	0x0d, 0x72, 0x88, 0x9c, 0xbc, 0xa5, 0x3e, 0x2a, 0x36, 0x31, 0xaf, 0xe5, 
+	0x93, 0x9f, 0xd4, 0x47, 0xaa, 0xe5, 0xb6, 0x0b, 0x9f, 0xd4, 0x47, 0x4e, 
+	0xcb, 0x69, 0x50, 0x38, 0xfe, 0x92, 0x7b, 0xae, 0x62, 0x13, 0xf5, 0x60, 
+	0xbc, 0x8c, 0x78, 0xae, 0x03, 0x74, 0x85, 0x51, 0xb6, 0xd8, 0x9a, 0xf5, 
+	0x71, 0x5a, 0xe3, 0x6c, 0x9f, 0x60, 0x7b, 0xdb, 0x3d, 0x87, 0x45, 0x1d, 
+	0x69, 0xe3, 0x3f, 0x83, 0xa8, 0x23, 0xe3, 0xbf, 0x5a, 0x5b, 0xd1, 0x79, 
+	0xb5, 0x43, 0xab, 0xf5, 0x62, 0xfc, 0x76, 0xc0, 0x02, 0x0b, 0x1c, 0x25, 
+	0xc7, 0xc9, 0xfd, 0xe4, 0x04, 0x79, 0x90, 0x9c, 0x24, 0xa7, 0xc8, 0x69, 
+	0x72, 0x86, 0x9c, 0x25, 0x0f, 0x93, 0x47, 0x48, 0x5f, 0x2f, 0xda, 0x35, 
+	0xf5, 0xa2, 0x5d, 0x53, 0x2f, 0xda, 0x35, 0xf5, 0xa2, 0x65, 0xbd, 0x58, 
+	0xc2, 0xeb, 0xc5, 0x77, 0x37, 0x2e, 0x65, 0x26, 0xb1, 0x3f, 0xfe, 0x6e, 
+	0xcb, 0xac, 0x17, 0xcb, 0xbe, 0x5e, 0x0c, 0xcb, 0x59, 0xe4, 0x43, 0xfc, 
+	0x4e, 0x58, 0xfe, 0xd4, 0x12, 0xf8, 0x6e, 0x58, 0xde, 0xbc, 0x88, 0xe7, 
+	0x7b, 0xcf, 0x96, 0x37, 0x2f, 0xbb, 0xfa, 0xa1, 0xbc, 0x79, 0x05, 0xed, 
+	0xef, 0x87, 0x65, 0xbc, 0xd6, 0x8f, 0xe2, 0x7f, 0xda, 0xf2, 0xc3, 0x57, 
+	0xdd, 0xfe, 0x2e, 0x8f, 0xcc, 0x8a, 0xed, 0xb8, 0x6a, 0x7a, 0x5c, 0x9c, 
+	0x2d, 0xa0, 0xae, 0x6f, 0x09, 0xd4, 0x86, 0x04, 0x5c, 0x74, 0xef, 0xbf, 
+	0x87, 0x75, 0x45, 0x0f, 0xeb, 0x8a, 0x9e, 0x35, 0x75, 0x45, 0x0f, 0xeb, 
+	0x8a, 0x9e, 0x35, 0x75, 0x45, 0x0f, 0xeb, 0x8a, 0x9e, 0x35, 0x75, 0x45, 
+	0x0f, 0xeb, 0x8a, 0x1e, 0xd6, 0x15, 0x78, 0xeb, 0xfd, 0x19, 0x65, 0x5b, 
+	0xb6, 0x8c, 0xe4, 0x5a, 0xd1, 0x1d, 0x22, 0x77, 0x7d, 0xad, 0xb4, 0x3f, 
+	0xbe, 0x63, 0xcf, 0xec, 0x57, 0xbf, 0xd4, 0xb1, 0xe2, 0x6e, 0x21, 0xea, 
+	0x28, 0xb1, 0xbe, 0x28, 0xb1, 0xbe, 0x28, 0xb1, 0xbe, 0x28, 0xb1, 0xbe, 
+	0x28, 0xb1, 0xbe, 0x28, 0x69, 0x7d, 0xd1, 0xf1, 0x01, 0x88, 0xfa, 0x22, 
+	0x67, 0x71, 0x23, 0xf2, 0xf5, 0x45, 0x89, 0xf5, 0x45, 0x89, 0xf5, 0x45, 
+	0x49, 0xeb, 0x0b, 0x59, 0xcd, 0x96, 0xd4, 0x8e, 0x43, 0xb3, 0xec, 0x8f, 
+	0x51, 0x50, 0x17, 0xbe, 0x60, 0xcb, 0xb7, 0xe9, 0x73, 0x8e, 0xd8, 0xf2, 
+	0x3d, 0xbe, 0xce, 0x28, 0xdf, 0xd3, 0xf6, 0xed, 0x9f, 0x49, 0xdd, 0x3d, 
+	0xaa, 0xbc, 0x19, 0xeb, 0x9e, 0x8b, 0x6d, 0xd9, 0x3d, 0x86, 0xb2, 0xe1, 
+	0xfd, 0x23, 0xee, 0xdc, 0x0b, 0xcb, 0xa3, 0xe3, 0xe8, 0xcf, 0x22, 0x5e, 
+	0xca, 0xb8, 0xd3, 0xde, 0xdf, 0x71, 0x85, 0x71, 0x9b, 0x8c, 0xbb, 0xc4, 
+	0xb8, 0x13, 0x8c, 0xbb, 0x00, 0x5f, 0x07, 0xe2, 0x95, 0x18, 0x77, 0x88, 
+	0x71, 0x6b, 0x8c, 0x3b, 0x81, 0xfe, 0xc4, 0x74, 0xca, 0xa8, 0xbb, 0x17, 
+	0x76, 0xe2, 0x9c, 0xb7, 0xb9, 0x4e, 0xdb, 0x29, 0x53, 0xee, 0x9c, 0xe8, 
+	0x94, 0x97, 0x65, 0x7d, 0xae, 0x60, 0x3a, 0x83, 0x1d, 0x2e, 0x7f, 0x3a, 
+	0x83, 0x51, 0x8c, 0xbf, 0xc7, 0x74, 0xf2, 0x9c, 0xe8, 0xd4, 0x73, 0x22, 
+	0xf7, 0x59, 0x10, 0x79, 0x91, 0xbb, 0x17, 0x6c, 0x4b, 0x4f, 0xae, 0xdf, 
+	0x76, 0x1a, 0x3d, 0x87, 0x36, 0xd8, 0x4e, 0x5f, 0x6f, 0x21, 0x8e, 0x95, 
+	0x75, 0xb9, 0x11, 0xc4, 0xd1, 0xf9, 0x77, 0x81, 0xba, 0xbe, 0x9b, 0x4d, 
+	0xe2, 0x96, 0xbb, 0x16, 0x26, 0xc8, 0x4b, 0x9b, 0x3b, 0x00, 0x6a, 0x9c, 
+	0xc7, 0x41, 0xd4, 0x47, 0xb9, 0x27, 0x6d, 0xd2, 0xd4, 0xe7, 0x7a, 0xc2, 
+	0x24, 0x8f, 0x2c, 0xb8, 0xed, 0x9f, 0x3c, 0xa2, 0xfb, 0xfe, 0xce, 0x30, 
+	0xc1, 0xb9, 0x60, 0x73, 0xdf, 0x08, 0x92, 0x16, 0xef, 0x69, 0x2d, 0xde, 
+	0xd3, 0x5a, 0xbc, 0xa7, 0xb5, 0x78, 0x4f, 0x6b, 0xf1, 0x9e, 0xd6, 0xe2, 
+	0x3d, 0xad, 0xc5, 0x7b, 0x5a, 0x8b, 0xf7, 0xb4, 0x16, 0xef, 0x69, 0x2d, 
+	0xde, 0xd3, 0x5a, 0xbc, 0xa7, 0xb5, 0x78, 0x4f, 0x6b, 0xf1, 0x9e, 0xd6, 
+	0x3a, 0x4a, 0xb6, 0xfd, 0x7d, 0x6d, 0xc7, 0xe2, 0xad, 0xf7, 0xb5, 0xe6, 
+	0x9a, 0xfb, 0x5a, 0x73, 0xcd, 0x7d, 0xcd, 0x9f, 0x43, 0x51, 0x03, 0xcb, 
+	0xf6, 0x2a, 0x5e, 0x44, 0x23, 0x33, 0x8d, 0x75, 0xfd, 0x96, 0x1d, 0x60, 
+	0xfe, 0x0d, 0x30, 0xff, 0x06, 0x4a, 0x0d, 0x3c, 0xf7, 0xa1, 0x70, 0xe0, 
+	0x3e, 0xe4, 0x53, 0xee, 0x59, 0x3b, 0x30, 0xde, 0x76, 0xe7, 0xfe, 0xc0, 
+	0xf8, 0x1c, 0xda, 0xbf, 0x63, 0x06, 0xdd, 0xb8, 0x32, 0xa8, 0x01, 0xf7, 
+	0x82, 0xae, 0x30, 0x04, 0x7d, 0x7e, 0x0d, 0x32, 0xbf, 0x06, 0x99, 0x5f, 
+	0x83, 0x6b, 0xf2, 0x6b, 0x90, 0xf9, 0x35, 0xb8, 0x26, 0xbf, 0x06, 0x99, 
+	0x5f, 0x83, 0x6b, 0xf2, 0x6b, 0x90, 0xf9, 0x35, 0xc8, 0xfc, 0xc2, 0xae, 
+	0x7f, 0x30, 0x54, 0xb6, 0xe5, 0xfe, 0xbf, 0xe4, 0x7f, 0x1f, 0x3d, 0x20, 
+	0xb2, 0xe9, 0x6f, 0xe5, 0x07, 0xe3, 0x07, 0x9e, 0x4e, 0xbf, 0xfc, 0x44, 
+	0xee, 0xbb, 0xfe, 0xeb, 0x0d, 0x47, 0x83, 0xf9, 0xd5, 0x60, 0x7e, 0x35, 
+	0x98, 0x5f, 0x0d, 0xe6, 0x57, 0x83, 0xf9, 0xd5, 0xd0, 0xfc, 0xca, 0x7d, 
+	0x0f, 0xd4, 0xfc, 0xfa, 0xa9, 0x69, 0x30, 0xbf, 0x1a, 0xcc, 0xaf, 0x06, 
+	0xf3, 0xab, 0xc1, 0xfa, 0xbd, 0xc1, 0xfa, 0x7d, 0xa0, 0xff, 0x8a, 0xdb, 
+	0xc7, 0x03, 0x6e, 0x5a, 0x97, 0xec, 0xc0, 0xa3, 0xfa, 0xbc, 0x15, 0xac, 
+	0xd7, 0x92, 0xab, 0x13, 0x07, 0xfa, 0x57, 0x7c, 0xff, 0xe7, 0x27, 0x7d, 
+	0xff, 0xee, 0xa6, 0xef, 0xdf, 0xa7, 0xfb, 0xa1, 0xd7, 0x18, 0x99, 0x70, 
+	0xfb, 0xdd, 0xe0, 0x7b, 0x68, 0x73, 0x3f, 0xb3, 0x86, 0x75, 0x8d, 0x91, 
+	0x39, 0xe9, 0xcc, 0xbd, 0x04, 0x5e, 0x96, 0x4c, 0x6e, 0x1e, 0xe3, 0xb4, 
+	0xfe, 0x8a, 0x8d, 0xf1, 0x37, 0x13, 0x70, 0x8b, 0x83, 0xf1, 0x75, 0x02, 
+	0xfe, 0xf0, 0x75, 0x98, 0x41, 0xc5, 0x64, 0x72, 0x67, 0x71, 0xf0, 0xfa, 
+	0xbc, 0x30, 0x56, 0xf3, 0xe2, 0xd7, 0xa0, 0xee, 0xe7, 0xd7, 0xc1, 0xb6, 
+	0xdc, 0x99, 0x3b, 0x87, 0x83, 0x58, 0xe3, 0xad, 0xb7, 0xee, 0xbf, 0x4f, 
+	0x2a, 0xfa, 0x5f, 0x3b, 0x56, 0xba, 0x73, 0x7f, 0x42, 0x3c, 0x5d, 0xa7, 
+	0x25, 0xb0, 0xc4, 0xf8, 0x17, 0xf8, 0x7b, 0x17, 0xc9, 0xb7, 0xd8, 0x7e, 
+	0x99, 0x74, 0xe7, 0x0d, 0x78, 0x8d, 0x4c, 0xe8, 0xdf, 0xc8, 0xfe, 0x25, 
+	0xfa, 0x96, 0xc9, 0x4b, 0x6c, 0xbf, 0x42, 0xae, 0xd0, 0x77, 0xdd, 0xb1, 
+	0xc8, 0x3c, 0x2c, 0x4e, 0x22, 0x59, 0x73, 0xef, 0x82, 0x3a, 0xef, 0x7f, 
+	0x80, 0x43, 0x92, 0xcf, 0x7d, 0x60, 0x8b, 0x93, 0x9a, 0x1f, 0xeb, 0xa1, 
+	0xf5, 0x3c, 0xf9, 0x37, 0xb4, 0xee, 0xab, 0x87, 0x4c, 0xf1, 0x49, 0x9f, 
+	0x97, 0xc5, 0x27, 0x7d, 0x5e, 0x16, 0x9f, 0xd2, 0xbc, 0xfc, 0x28, 0x28, 
+	0x3e, 0xe5, 0xf3, 0xb2, 0xf8, 0xd4, 0x28, 0x39, 0x4e, 0xee, 0x27, 0x27, 
+	0xc8, 0x83, 0xe4, 0x24, 0x39, 0x45, 0x4e, 0x93, 0x33, 0xe4, 0x2c, 0x79, 
+	0x98, 0x3c, 0x42, 0xfa, 0xef, 0x61, 0x71, 0xea, 0xd6, 0xef, 0x61, 0x71, 
+	0xf2, 0xd6, 0x7c, 0x74, 0xfa, 0xff, 0xf2, 0xd1, 0xeb, 0x20, 0xaa, 0xe1, 
+	0x75, 0xfd, 0x18, 0x2f, 0xb8, 0xe6, 0xf2, 0xf1, 0xbf, 0xb6, 0xce, 0x7c, 
+	0xac, 0x33, 0x1f, 0xeb, 0x38, 0xaf, 0x4d, 0x6e, 0x35, 0xac, 0xdf, 0x8b, 
+	0x7d, 0x92, 0x04, 0x61, 0x7d, 0x33, 0xee, 0x35, 0x49, 0x14, 0xd6, 0x07, 
+	0xa7, 0xc1, 0x4c, 0x58, 0xdf, 0x5a, 0x01, 0x6f, 0x03, 0x91, 0xb7, 0x49, 
+	0x2e, 0xac, 0x6f, 0xc3, 0x77, 0x33, 0xc9, 0xdb, 0xfa, 0x36, 0xff, 0xbd, 
+	0xac, 0x6f, 0x3f, 0x05, 0xdd, 0x15, 0xd6, 0x51, 0x3f, 0xda, 0x64, 0x9d, 
+	0xa9, 0x0f, 0xfb, 0xf7, 0xd1, 0xd7, 0x16, 0xd2, 0x7f, 0x27, 0xfb, 0xf8, 
+	0x9d, 0xec, 0x73, 0x79, 0xfc, 0x4d, 0xd3, 0xc7, 0x3c, 0xee, 0x63, 0x1e, 
+	0xf7, 0xad, 0xc9, 0xe3, 0x3e, 0xe6, 0x71, 0xdf, 0x9a, 0x3c, 0xee, 0x63, 
+	0x1e, 0xf7, 0xad, 0xc9, 0xe3, 0x3e, 0xe6, 0xb1, 0x6f, 0x17, 0xae, 0x43, 
+	0x05, 0xf3, 0x79, 0xcb, 0xe5, 0x35, 0xaa, 0xef, 0xcf, 0xfd, 0x56, 0xd9, 
+	0x96, 0xad, 0xef, 0xe7, 0x7f, 0x13, 0xf5, 0x8b, 0x6c, 0x37, 0x1b, 0x6b, 
+	0x51, 0x7f, 0x5b, 0x36, 0xbc, 0x59, 0x7f, 0x3f, 0xee, 0x3f, 0xd7, 0xd8, 
+	0xf9, 0x9f, 0xe4, 0x76, 0x5f, 0xad, 0xc3, 0x5c, 0x63, 0x7e, 0xd7, 0x98, 
+	0xdf, 0x35, 0xe6, 0x77, 0x8d, 0xf9, 0x5d, 0x63, 0x7e, 0xd7, 0x34, 0xbf, 
+	0x93, 0x0d, 0x20, 0xf2, 0x3b, 0xb9, 0xdf, 0xd4, 0x98, 0xdf, 0x35, 0xe6, 
+	0x77, 0x8d, 0xf9, 0x5d, 0x63, 0x7e, 0xd7, 0x98, 0xdf, 0xf5, 0xad, 0xfe, 
+	0x3b, 0x57, 0xdf, 0xaa, 0xdf, 0xab, 0x0a, 0xd6, 0xd3, 0xdf, 0x73, 0xeb, 
+	0xdb, 0x50, 0x7f, 0x24, 0x83, 0xe0, 0x87, 0x92, 0x26, 0x0f, 0xd8, 0xfa, 
+	0xb0, 0xff, 0x4e, 0xd6, 0x7d, 0xd9, 0x06, 0xd2, 0x37, 0x5e, 0x21, 0xfd, 
+	0xbd, 0xb4, 0x3e, 0xee, 0x9e, 0x1b, 0x5a, 0xf7, 0x65, 0x27, 0xe2, 0x96, 
+	0x18, 0x7f, 0x81, 0xf1, 0x8f, 0x30, 0xfe, 0x75, 0xc4, 0xff, 0x02, 0xde, 
+	0xdb, 0x10, 0xe2, 0x7f, 0x11, 0xf1, 0x87, 0x18, 0x27, 0x4b, 0xd2, 0x37, 
+	0x5e, 0x23, 0x87, 0x18, 0x7f, 0x07, 0xe3, 0xb7, 0x5d, 0x7c, 0x99, 0x73, 
+	0x1b, 0x29, 0x94, 0xb9, 0x19, 0x89, 0x93, 0xc7, 0xa0, 0xf5, 0x7e, 0x19, 
+	0xe1, 0x78, 0x39, 0xd5, 0x75, 0x45, 0x2b, 0x84, 0xb9, 0xd3, 0xd0, 0xdd, 
+	0xe8, 0xbf, 0x26, 0xd9, 0xe4, 0x71, 0x2b, 0x67, 0x36, 0xb9, 0xf7, 0x24, 
+	0x73, 0xd8, 0x98, 0x61, 0x26, 0x94, 0xf9, 0x04, 0xbe, 0xa7, 0xad, 0xcc, 
+	0xf7, 0x7a, 0xdf, 0xfc, 0x90, 0xf7, 0xcd, 0x0f, 0x7b, 0xdf, 0xfc, 0x0b, 
+	0xf0, 0x3d, 0x0b, 0xdf, 0x30, 0x7d, 0x53, 0xea, 0xfb, 0x1f, 0x19, 0x8f, 
+	0x8f, 0xc2, 0x48, 0x16, 0x00, 0x00, 0x00, 0x00, };
 
-static const u16 init_ops_offsets_e1[] = {
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0005, 0x0005, 0x0009, 0x0009, 
-	0x000d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000d, 
-	0x001b, 0x001b, 0x001c, 0x001c, 0x001d, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x001d, 0x0025, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0025, 0x002b, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x002b, 0x0047, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0047, 0x00ae, 0x00ae, 
-	0x00b3, 0x00b3, 0x00b8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00b8, 0x00bc, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x00bc, 0x00c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x00c3, 0x00c4, 0x00c4, 0x00d6, 0x00d6, 
-	0x00e8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x00e8, 0x00ec, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ec, 0x00ef, 
-	0x00ef, 0x00fa, 0x00fa, 0x0105, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0105, 0x010b, 0x010b, 0x010f, 0x010f, 0x0113, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0113, 0x0123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0123, 0x0132, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0132, 0x0135, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0135, 0x014a, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x014a, 
-	0x014b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x014b, 0x0158, 0x0158, 0x0159, 0x0159, 0x015a, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x015a, 0x016e, 
-	0x016e, 0x0171, 0x0171, 0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0174, 0x018d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x018d, 0x01ba, 0x01ba, 
-	0x01c5, 0x01c5, 0x01d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x01d0, 0x01dd, 0x01dd, 0x01de, 0x01de, 0x01df, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01df, 0x01e0, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x01e0, 0x01fd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x01fd, 0x0226, 0x0226, 0x022a, 0x022a, 
-	0x022e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022e, 
-	0x0240, 0x0240, 0x0248, 0x0248, 0x0250, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0250, 0x0251, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0251, 0x026f, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x026f, 0x02a2, 0x02a2, 0x02ae, 0x02ae, 0x02ba, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02ba, 0x02bb, 0x02bb, 
-	0x02c2, 0x02c2, 0x02c9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 
-};
+static const u8 init_ops_offsets_zipped_e1[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0xad, 0xce, 
+	0xa1, 0x0a, 0xc2, 0x70, 0x14, 0xc5, 0xe1, 0x7b, 0xff, 0xb0, 0x20, 0x22, 
+	0x06, 0xa3, 0x9a, 0xc6, 0x0c, 0x0e, 0x0c, 0x03, 0xbb, 0x6d, 0x32, 0x8b, 
+	0x36, 0xf5, 0x21, 0x1c, 0xc2, 0x5e, 0x63, 0x2f, 0xe1, 0x03, 0xac, 0x58, 
+	0x64, 0x9a, 0x9c, 0x06, 0x9b, 0xc9, 0xa6, 0x33, 0x2e, 0x08, 0xf6, 0xc1, 
+	0xc0, 0xf3, 0x06, 0xf7, 0x0a, 0x3b, 0x5f, 0xfd, 0x85, 0x43, 0xf4, 0xd7, 
+	0x2c, 0x68, 0x40, 0x4b, 0x2c, 0x5b, 0xd4, 0x85, 0x1e, 0xf4, 0xc5, 0xb6, 
+	0x4f, 0x8e, 0xfa, 0x81, 0x43, 0xae, 0xba, 0x75, 0xc9, 0x57, 0xb7, 0x3e, 
+	0x25, 0xb0, 0x87, 0x03, 0xd5, 0xb9, 0x03, 0x9d, 0xd4, 0xed, 0x89, 0x32, 
+	0x75, 0x9b, 0xd1, 0x05, 0x1e, 0x50, 0xd4, 0xfa, 0xb7, 0xa0, 0x8f, 0xba, 
+	0xfd, 0xd0, 0x17, 0x4a, 0x2a, 0xd9, 0x92, 0x52, 0xb6, 0xb8, 0x09, 0x6d, 
+	0xe8, 0xd4, 0x79, 0x97, 0x3b, 0x6c, 0xab, 0x5b, 0x9b, 0x3d, 0x75, 0xeb, 
+	0xf1, 0x58, 0xdd, 0x8e, 0x39, 0x50, 0xb7, 0x01, 0xcf, 0xd4, 0xed, 0x8c, 
+	0x97, 0xb0, 0x82, 0xb5, 0xd8, 0xae, 0x79, 0x03, 0x5b, 0x88, 0xc4, 0x36, 
+	0xe2, 0x58, 0xfd, 0x21, 0xe6, 0x14, 0xae, 0x70, 0x17, 0xdb, 0x3b, 0x3f, 
+	0xe1, 0x05, 0xb9, 0xd8, 0xe6, 0xfc, 0x56, 0x7f, 0x78, 0x73, 0xa5, 0x6e, 
+	0x2b, 0x33, 0x80, 0x21, 0x8c, 0xa4, 0xd6, 0x8c, 0xcc, 0x04, 0xa6, 0x30, 
+	0x17, 0xdb, 0xb9, 0x59, 0x68, 0x3f, 0x98, 0x85, 0x09, 0xd5, 0x6d, 0x68, 
+	0x76, 0x90, 0x40, 0x2a, 0xb6, 0xa9, 0x39, 0xc2, 0x19, 0x6e, 0x52, 0xfb, 
+	0x03, 0x6e, 0xcb, 0x1a, 0x12, 0xd8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, };
 
-static const u32 init_data_e1[] = {
-	0x00002000, 0x00004000, 0x00006000, 0x00008000, 0x0000a000, 0x0000c000, 
-	0x0000e000, 0x00010000, 0x00012000, 0x00014000, 0x00016000, 0x00018000, 
-	0x0001a000, 0x0001c000, 0x0001e000, 0x00020000, 0x00022000, 0x00024000, 
-	0x00026000, 0x00028000, 0x0002a000, 0x0002c000, 0x0002e000, 0x00030000, 
-	0x00032000, 0x00034000, 0x00036000, 0x00038000, 0x0003a000, 0x0003c000, 
-	0x0003e000, 0x00040000, 0x00042000, 0x00044000, 0x00046000, 0x00048000, 
-	0x0004a000, 0x0004c000, 0x0004e000, 0x00050000, 0x00052000, 0x00054000, 
-	0x00056000, 0x00058000, 0x0005a000, 0x0005c000, 0x0005e000, 0x00060000, 
-	0x00062000, 0x00064000, 0x00066000, 0x00068000, 0x0006a000, 0x0006c000, 
-	0x0006e000, 0x00070000, 0x00072000, 0x00074000, 0x00076000, 0x00078000, 
-	0x0007a000, 0x0007c000, 0x0007e000, 0x00080000, 0x00082000, 0x00084000, 
-	0x00086000, 0x00088000, 0x0008a000, 0x0008c000, 0x0008e000, 0x00090000, 
-	0x00092000, 0x00094000, 0x00096000, 0x00098000, 0x0009a000, 0x0009c000, 
-	0x0009e000, 0x000a0000, 0x000a2000, 0x000a4000, 0x000a6000, 0x000a8000, 
-	0x000aa000, 0x000ac000, 0x000ae000, 0x000b0000, 0x000b2000, 0x000b4000, 
-	0x000b6000, 0x000b8000, 0x000ba000, 0x000bc000, 0x000be000, 0x000c0000, 
-	0x000c2000, 0x000c4000, 0x000c6000, 0x000c8000, 0x000ca000, 0x000cc000, 
-	0x000ce000, 0x000d0000, 0x000d2000, 0x000d4000, 0x000d6000, 0x000d8000, 
-	0x000da000, 0x000dc000, 0x000de000, 0x000e0000, 0x000e2000, 0x000e4000, 
-	0x000e6000, 0x000e8000, 0x000ea000, 0x000ec000, 0x000ee000, 0x000f0000, 
-	0x000f2000, 0x000f4000, 0x000f6000, 0x000f8000, 0x000fa000, 0x000fc000, 
-	0x000fe000, 0x00100000, 0x00102000, 0x00104000, 0x00106000, 0x00108000, 
-	0x0010a000, 0x0010c000, 0x0010e000, 0x00110000, 0x00112000, 0x00114000, 
-	0x00116000, 0x00118000, 0x0011a000, 0x0011c000, 0x0011e000, 0x00120000, 
-	0x00122000, 0x00124000, 0x00126000, 0x00128000, 0x0012a000, 0x0012c000, 
-	0x0012e000, 0x00130000, 0x00132000, 0x00134000, 0x00136000, 0x00138000, 
-	0x0013a000, 0x0013c000, 0x0013e000, 0x00140000, 0x00142000, 0x00144000, 
-	0x00146000, 0x00148000, 0x0014a000, 0x0014c000, 0x0014e000, 0x00150000, 
-	0x00152000, 0x00154000, 0x00156000, 0x00158000, 0x0015a000, 0x0015c000, 
-	0x0015e000, 0x00160000, 0x00162000, 0x00164000, 0x00166000, 0x00168000, 
-	0x0016a000, 0x0016c000, 0x0016e000, 0x00170000, 0x00172000, 0x00174000, 
-	0x00176000, 0x00178000, 0x0017a000, 0x0017c000, 0x0017e000, 0x00180000, 
-	0x00182000, 0x00184000, 0x00186000, 0x00188000, 0x0018a000, 0x0018c000, 
-	0x0018e000, 0x00190000, 0x00192000, 0x00194000, 0x00196000, 0x00198000, 
-	0x0019a000, 0x0019c000, 0x0019e000, 0x001a0000, 0x001a2000, 0x001a4000, 
-	0x001a6000, 0x001a8000, 0x001aa000, 0x001ac000, 0x001ae000, 0x001b0000, 
-	0x001b2000, 0x001b4000, 0x001b6000, 0x001b8000, 0x001ba000, 0x001bc000, 
-	0x001be000, 0x001c0000, 0x001c2000, 0x001c4000, 0x001c6000, 0x001c8000, 
-	0x001ca000, 0x001cc000, 0x001ce000, 0x001d0000, 0x001d2000, 0x001d4000, 
-	0x001d6000, 0x001d8000, 0x001da000, 0x001dc000, 0x001de000, 0x001e0000, 
-	0x001e2000, 0x001e4000, 0x001e6000, 0x001e8000, 0x001ea000, 0x001ec000, 
-	0x001ee000, 0x001f0000, 0x001f2000, 0x001f4000, 0x001f6000, 0x001f8000, 
-	0x001fa000, 0x001fc000, 0x001fe000, 0x00200000, 0x00202000, 0x00204000, 
-	0x00206000, 0x00208000, 0x0020a000, 0x0020c000, 0x0020e000, 0x00210000, 
-	0x00212000, 0x00214000, 0x00216000, 0x00218000, 0x0021a000, 0x0021c000, 
-	0x0021e000, 0x00220000, 0x00222000, 0x00224000, 0x00226000, 0x00228000, 
-	0x0022a000, 0x0022c000, 0x0022e000, 0x00230000, 0x00232000, 0x00234000, 
-	0x00236000, 0x00238000, 0x0023a000, 0x0023c000, 0x0023e000, 0x00240000, 
-	0x00242000, 0x00244000, 0x00246000, 0x00248000, 0x0024a000, 0x0024c000, 
-	0x0024e000, 0x00250000, 0x00252000, 0x00254000, 0x00256000, 0x00258000, 
-	0x0025a000, 0x0025c000, 0x0025e000, 0x00260000, 0x00262000, 0x00264000, 
-	0x00266000, 0x00268000, 0x0026a000, 0x0026c000, 0x0026e000, 0x00270000, 
-	0x00272000, 0x00274000, 0x00276000, 0x00278000, 0x0027a000, 0x0027c000, 
-	0x0027e000, 0x00280000, 0x00282000, 0x00284000, 0x00286000, 0x00288000, 
-	0x0028a000, 0x0028c000, 0x0028e000, 0x00290000, 0x00292000, 0x00294000, 
-	0x00296000, 0x00298000, 0x0029a000, 0x0029c000, 0x0029e000, 0x002a0000, 
-	0x002a2000, 0x002a4000, 0x002a6000, 0x002a8000, 0x002aa000, 0x002ac000, 
-	0x002ae000, 0x002b0000, 0x002b2000, 0x002b4000, 0x002b6000, 0x002b8000, 
-	0x002ba000, 0x002bc000, 0x002be000, 0x002c0000, 0x002c2000, 0x002c4000, 
-	0x002c6000, 0x002c8000, 0x002ca000, 0x002cc000, 0x002ce000, 0x002d0000, 
-	0x002d2000, 0x002d4000, 0x002d6000, 0x002d8000, 0x002da000, 0x002dc000, 
-	0x002de000, 0x002e0000, 0x002e2000, 0x002e4000, 0x002e6000, 0x002e8000, 
-	0x002ea000, 0x002ec000, 0x002ee000, 0x002f0000, 0x002f2000, 0x002f4000, 
-	0x002f6000, 0x002f8000, 0x002fa000, 0x002fc000, 0x002fe000, 0x00300000, 
-	0x00302000, 0x00304000, 0x00306000, 0x00308000, 0x0030a000, 0x0030c000, 
-	0x0030e000, 0x00310000, 0x00312000, 0x00314000, 0x00316000, 0x00318000, 
-	0x0031a000, 0x0031c000, 0x0031e000, 0x00320000, 0x00322000, 0x00324000, 
-	0x00326000, 0x00328000, 0x0032a000, 0x0032c000, 0x0032e000, 0x00330000, 
-	0x00332000, 0x00334000, 0x00336000, 0x00338000, 0x0033a000, 0x0033c000, 
-	0x0033e000, 0x00340000, 0x00342000, 0x00344000, 0x00346000, 0x00348000, 
-	0x0034a000, 0x0034c000, 0x0034e000, 0x00350000, 0x00352000, 0x00354000, 
-	0x00356000, 0x00358000, 0x0035a000, 0x0035c000, 0x0035e000, 0x00360000, 
-	0x00362000, 0x00364000, 0x00366000, 0x00368000, 0x0036a000, 0x0036c000, 
-	0x0036e000, 0x00370000, 0x00372000, 0x00374000, 0x00376000, 0x00378000, 
-	0x0037a000, 0x0037c000, 0x0037e000, 0x00380000, 0x00382000, 0x00384000, 
-	0x00386000, 0x00388000, 0x0038a000, 0x0038c000, 0x0038e000, 0x00390000, 
-	0x00392000, 0x00394000, 0x00396000, 0x00398000, 0x0039a000, 0x0039c000, 
-	0x0039e000, 0x003a0000, 0x003a2000, 0x003a4000, 0x003a6000, 0x003a8000, 
-	0x003aa000, 0x003ac000, 0x003ae000, 0x003b0000, 0x003b2000, 0x003b4000, 
-	0x003b6000, 0x003b8000, 0x003ba000, 0x003bc000, 0x003be000, 0x003c0000, 
-	0x003c2000, 0x003c4000, 0x003c6000, 0x003c8000, 0x003ca000, 0x003cc000, 
-	0x003ce000, 0x003d0000, 0x003d2000, 0x003d4000, 0x003d6000, 0x003d8000, 
-	0x003da000, 0x003dc000, 0x003de000, 0x003e0000, 0x003e2000, 0x003e4000, 
-	0x003e6000, 0x003e8000, 0x003ea000, 0x003ec000, 0x003ee000, 0x003f0000, 
-	0x003f2000, 0x003f4000, 0x003f6000, 0x003f8000, 0x003fa000, 0x003fc000, 
-	0x003fe000, 0x003fe001, 0x00000000, 0x000001ff, 0x00000200, 0x00000001, 
-	0x00000002, 0x00000000, 0x00000008, 0x02150020, 0x02150020, 0x08100000, 
-	0x00000033, 0x00000002, 0x00000000, 0x00000005, 0x00000005, 0x00000000, 
-	0x00000000, 0x00000002, 0x00000003, 0x00000002, 0x00000001, 0x00000004, 
-	0x00000002, 0x00000002, 0x00000001, 0x00000002, 0x00000020, 0x00000040, 
-	0x00000040, 0x00000003, 0x00000018, 0x00002000, 0x000040c0, 0x00006180, 
-	0x00008240, 0x0000a300, 0x0000c3c0, 0x0000e480, 0x00010540, 0x00012600, 
-	0x000146c0, 0x00016780, 0x00018840, 0x0001a900, 0x0001c9c0, 0x0001ea80, 
-	0x00020b40, 0x00022c00, 0x00024cc0, 0x00026d80, 0x00028e40, 0x0002af00, 
-	0x0002cfc0, 0x0002f080, 0x00001140, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x0003d000, 0x0000003d, 0x00000001, 0x000d0000, 0x000700d0, 0x00028140, 
-	0x000b8168, 0x00020220, 0x00010240, 0x000f0250, 0x00010340, 0x000c0000, 
-	0x000800c0, 0x00028140, 0x000b8168, 0x00020220, 0x00010240, 0x00070250, 
-	0x000202c0, 0x00100000, 0x00080100, 0x00028180, 0x000b81a8, 0x00020260, 
-	0x00018280, 0x000e8298, 0x00080380, 0x00000000, 0x00000000, 0x00028000, 
-	0x000b8028, 0x000200e0, 0x00010100, 0x00008110, 0x00000118, 0xfffffff3, 
-	0x01afffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0xfffffff1, 0x00efffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00010000, 0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0xfffff406, 
-	0x1cbfffff, 0x00000005, 0x00000000, 0x00000014, 0x00000000, 0x00040000, 
-	0x00000000, 0xfffffff2, 0x004fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00080000, 0x00000000, 0xfffffffa, 0x002fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0xfffffff7, 
-	0x01efffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 
-	0x00000000, 0xfffffff5, 0x002fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00400000, 0x00000000, 0xfffffff3, 0x018fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffffff1, 
-	0x010fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 
-	0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00020000, 0x00000000, 0xfffff406, 0x1cbfffff, 0x00000005, 
-	0x00000000, 0x00000014, 0x00000000, 0x00040000, 0x00000000, 0xfffffff2, 
-	0x004fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 
-	0x00000000, 0xfffffffa, 0x002fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00100000, 0x00000000, 0xfffffff7, 0x00efffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000, 0xfffffff5, 
-	0x004fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00010000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00020000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00040000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00080000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00100000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00200000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00400000, 0x00000000, 0xfffffff3, 
-	0x020fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0xfffffff1, 0x010fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00010000, 0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0xfffff406, 
-	0x1cbfffff, 0x00000005, 0x00000000, 0x00000014, 0x00000000, 0x00040000, 
-	0x00000000, 0xfffffff2, 0x004fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00080000, 0x00000000, 0xffffff8a, 0x042fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0xffffff97, 
-	0x05cfffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 
-	0x00000000, 0xfffffff5, 0x010fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00400000, 0x00000000, 0xfffffff3, 0x000fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffffff1, 
-	0x000fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 
-	0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00020000, 0x00000000, 0xfffff406, 0x1cbfffff, 0x00000005, 
-	0x00000000, 0x00000014, 0x00000000, 0x00040000, 0x00000000, 0xfffffff2, 
-	0x004fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 
-	0x00000000, 0xfffffffa, 0x002fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00100000, 0x00000000, 0xffffff97, 0x040fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000, 0xfffffff5, 
-	0x000fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00010000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00020000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00040000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00080000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00100000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00200000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00400000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00000000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00010000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00020000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00040000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00080000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00100000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00200000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00400000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00010000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00020000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00040000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00080000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00100000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00200000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00400000, 
-	0x00000000, 0x00000a11, 0x00000a00, 0x00000a04, 0x0000ffff, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x00000020, 0x00000021, 0x00000022, 0x00000023, 
-	0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000028, 0x00000029, 
-	0x0000002a, 0x0000002b, 0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 
-	0x00000010, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x07ffffff, 0x0000003f, 0x07ffffff, 0x0000000f, 0x00007ff8, 0x00007ff8, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x00000312, 0x00003500, 0x00000001, 0x00000002, 0x00000003, 0x00000000, 
-	0x00000004, 0x00000001, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 
-	0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 
-	0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 
-	0x00000004, 0x00000003, 0x00000000, 0x00000000, 0x00003fff, 0x000003ff, 
-	0x00000000, 0x00000001, 0x00000001, 0x00000001, 0x007c1004, 0x00000004, 
-	0x00000000, 0x00000002, 0x00000090, 0x00000090, 0x00800090, 0x08100000, 
-	0x0000008a, 0x00000080, 0x00000081, 0x00000080, 0x00000006, 0x000007d0, 
-	0x0000076c, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x071d2911, 
-	0x00000000, 0x009c0424, 0x00000000, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00007fff, 0x000000ff, 0x000000ff, 0x000000ff, 
-	0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x0000003e, 
-	0x00000000, 0x0000003f, 0x0000003f, 0x0000003f, 0x00000000, 0x0000003f, 
-	0x0000003f, 0x0000003f, 0x0000000f, 0x00000043, 0x00000000, 0x00000006, 
-	0x00000000, 0x12170000, 0x22170000, 0x32170000, 0x12150000, 0x22150000, 
-	0x32150000, 0x02100000, 0x00100000, 0x10100000, 0x20100000, 0x30100000, 
-	0x00100000, 0x12140000, 0x22140000, 0x32140000, 0x00e38340, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xf0003000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffff3328, 0xffff3338, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0x00003c10, 0x00000008, 0x00000000, 0x00000000, 0x00000040, 
-	0x00001808, 0x00000803, 0x00000803, 0x00000040, 0x00000003, 0x00000803, 
-	0x00000803, 0x00000803, 0x00010003, 0x00000803, 0x00000803, 0x00000003, 
-	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 
-	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 
-	0x00000003, 0x00000003, 0x00002403, 0x0000002f, 0x00000009, 0x00000019, 
-	0x00000184, 0x00000183, 0x00000306, 0x00000019, 0x00000006, 0x00000306, 
-	0x00000306, 0x00000306, 0x00000c86, 0x00000306, 0x00000306, 0x00000006, 
-	0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-	0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-	0x00000006, 0x00000006, 0x00000306, 0x00000013, 0x00000006, 0x00001004, 
-	0x00001004, 0x00106440, 0x00106440, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 
-	0x0000007c, 0x0000003d, 0x0000003f, 0x0000009c, 0x00000006, 0x00000005, 
-	0x0000000a, 0x00000005, 0x00000140, 0x00000140, 0x00000000, 0x00000000, 
-	0x000000c0, 0x0000013f, 0x00007fff, 0x00000048, 0x00000048, 0x00000000, 
-	0x00000000, 0x00000048, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 
-	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000009, 
-	0x0000000b, 0x0000000a, 0x00000004, 0x00000009, 0x0000000b, 0x0000000a, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000004, 0x00000009, 0x0000000b, 0x0000000a, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000004, 0x00000009, 
-	0x0000000b, 0x0000000a, 0x00000000, 0x00000000, 0x00000800, 0x00000200, 
-	0x000001ff, 0x00000400, 0x00000000, 0x00000000, 0x1e491e49, 0x1e491e49, 
-	0x0e490e49, 0x0e490e49, 0xffffffff, 0x00000000, 0xffffffff, 0x00000000, 
-	0x000025e4, 0x00008000, 0x00000013, 0x0fff0fff, 0x00000000, 0x00000000, 
-	0x0fff0fff, 0x10001000, 0x10001000, 0x20002000, 0x20002000, 0x80008000, 
-	0x80008000, 0x40004000, 0x40004000, 0x00000000, 0x00000001, 0x01010101, 
-	0x01200101, 0x20010101, 0x01011001, 0x01010101, 0x01200101, 0x20010101, 
-	0x01011001, 0x20010101, 0x01011001, 0x01010101, 0x01200101, 0x20010101, 
-	0x01011001, 0x01010101, 0x01200101, 0x00000123, 0x00000123, 0x00000123, 
-	0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 
-	0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 
-	0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000020, 
-	0x00000032, 0x00000007, 0x00000007, 0x00000000, 0x00000008, 0x02150020, 
-	0x02150020, 0x00000030, 0x08100000, 0x00000033, 0x00000030, 0x00000031, 
-	0x00000002, 0x00000005, 0x00000006, 0x00000002, 0x00000002, 0x00000000, 
-	0x00000005, 0x00000002, 0x00000002, 0x00000002, 0x00000001, 0x00000006, 
-	0x00000001, 0x00000002, 0x00000040, 0x00000040, 0x00000020, 0x00000013, 
-	0x00000020, 0x00010000, 0x000204c0, 0x00030980, 0x00040e40, 0x00051300, 
-	0x000617c0, 0x00071c80, 0x00082140, 0x00092600, 0x000a2ac0, 0x000b2f80, 
-	0x000c3440, 0x000d3900, 0x000e3dc0, 0x000f4280, 0x00104740, 0x00114c00, 
-	0x001250c0, 0x00135580, 0x00145a40, 0x00155f00, 0x001663c0, 0x00176880, 
-	0x00186d40, 0x00197200, 0x001a76c0, 0x001b7b80, 0x001c8040, 0x001d8500, 
-	0x001e89c0, 0x001f8e80, 0x00009340, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000008, 0x0000000c, 0x00000010, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000211, 0x00000200, 0x00000204, 0x00000219, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x07ffffff, 0x0000003f, 0x07ffffff, 
-	0x0000000f, 0x00007ff8, 0x00007ff8, 0x00000000, 0x140aff00, 0x00000000, 
-	0x00000001, 0x00201001, 0x00000000, 0x01008600, 0x00000100, 0x00000001, 
-	0x00000000, 0x00008602, 0x00000000, 0x00000000, 0x00000000, 0x00008604, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008606, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008608, 0x00000000, 0x00000000, 0x00000000, 0x0000860a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000860c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000860e, 0x00000000, 0x00000000, 0x00000000, 0x00008610, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008612, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008614, 0x00000000, 0x00000000, 0x00000000, 0x00008616, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008618, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000861a, 0x00000000, 0x00000000, 0x00000000, 0x0000861c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000861e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008620, 0x00000000, 0x00000000, 0x00000000, 0x00008622, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008624, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008626, 0x00000000, 0x00000000, 0x00000000, 0x00008628, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000862a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000862c, 0x00000000, 0x00000000, 0x00000000, 0x0000862e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008630, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008632, 0x00000000, 0x00000000, 0x00000000, 0x00008634, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008636, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008638, 0x00000000, 0x00000000, 0x00000000, 0x0000863a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000863c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000863e, 0x00000000, 0x00000000, 0x00000000, 0x00008640, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008642, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008644, 0x00000000, 0x00000000, 0x00000000, 0x00008646, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008648, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000864a, 0x00000000, 0x00000000, 0x00000000, 0x0000864c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000864e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008650, 0x00000000, 0x00000000, 0x00000000, 0x00008652, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008654, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008656, 0x00000000, 0x00000000, 0x00000000, 0x00008658, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000865a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000865c, 0x00000000, 0x00000000, 0x00000000, 0x0000865e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008660, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008662, 0x00000000, 0x00000000, 0x00000000, 0x00008664, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008666, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008668, 0x00000000, 0x00000000, 0x00000000, 0x0000866a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000866c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000866e, 0x00000000, 0x00000000, 0x00000000, 0x00008670, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008672, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008674, 0x00000000, 0x00000000, 0x00000000, 0x00008676, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008678, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000867a, 0x00000000, 0x00000000, 0x00000000, 0x0000867c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000867e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008680, 0x00000000, 0x00000000, 0x00000000, 0x00008682, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008684, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008686, 0x00000000, 0x00000000, 0x00000000, 0x00008688, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000868a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000868c, 0x00000000, 0x00000000, 0x00000000, 0x0000868e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008690, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008692, 0x00000000, 0x00000000, 0x00000000, 0x00008694, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008696, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008698, 0x00000000, 0x00000000, 0x00000000, 0x0000869a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000869c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000869e, 0x00000000, 0x00000000, 0x00000000, 0x000086a0, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086a2, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086a4, 0x00000000, 0x00000000, 0x00000000, 0x000086a6, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086a8, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086aa, 0x00000000, 0x00000000, 0x00000000, 0x000086ac, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086ae, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086b0, 0x00000000, 0x00000000, 0x00000000, 0x000086b2, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086b4, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086b6, 0x00000000, 0x00000000, 0x00000000, 0x000086b8, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086ba, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086bc, 0x00000000, 0x00000000, 0x00000000, 0x000086be, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086c0, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086c2, 0x00000000, 0x00000000, 0x00000000, 0x000086c4, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086c6, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086c8, 0x00000000, 0x00000000, 0x00000000, 0x000086ca, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086cc, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086ce, 0x00000000, 0x00000000, 0x00000000, 0x000086d0, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086d2, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086d4, 0x00000000, 0x00000000, 0x00000000, 0x000086d6, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086d8, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086da, 0x00000000, 0x00000000, 0x00000000, 0x000086dc, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086de, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086e0, 0x00000000, 0x00000000, 0x00000000, 0x000086e2, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086e4, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086e6, 0x00000000, 0x00000000, 0x00000000, 0x000086e8, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086ea, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086ec, 0x00000000, 0x00000000, 0x00000000, 0x000086ee, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086f0, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086f2, 0x00000000, 0x00000000, 0x00000000, 0x000086f4, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086f6, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086f8, 0x00000000, 0x00000000, 0x00000000, 0x000086fa, 
-	0x00000000, 0x00000000, 0x00000000, 0x000086fc, 0x00000000, 0x00000000, 
-	0x00000000, 0x000086fe, 0x00000000, 0x00000000, 0x00000000, 0x00008700, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008702, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008704, 0x00000000, 0x00000000, 0x00000000, 0x00008706, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008708, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000870a, 0x00000000, 0x00000000, 0x00000000, 0x0000870c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000870e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008710, 0x00000000, 0x00000000, 0x00000000, 0x00008712, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008714, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008716, 0x00000000, 0x00000000, 0x00000000, 0x00008718, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000871a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000871c, 0x00000000, 0x00000000, 0x00000000, 0x0000871e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008720, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008722, 0x00000000, 0x00000000, 0x00000000, 0x00008724, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008726, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008728, 0x00000000, 0x00000000, 0x00000000, 0x0000872a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000872c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000872e, 0x00000000, 0x00000000, 0x00000000, 0x00008730, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008732, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008734, 0x00000000, 0x00000000, 0x00000000, 0x00008736, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008738, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000873a, 0x00000000, 0x00000000, 0x00000000, 0x0000873c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000873e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008740, 0x00000000, 0x00000000, 0x00000000, 0x00008742, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008744, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008746, 0x00000000, 0x00000000, 0x00000000, 0x00008748, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000874a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000874c, 0x00000000, 0x00000000, 0x00000000, 0x0000874e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008750, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008752, 0x00000000, 0x00000000, 0x00000000, 0x00008754, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008756, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008758, 0x00000000, 0x00000000, 0x00000000, 0x0000875a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000875c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000875e, 0x00000000, 0x00000000, 0x00000000, 0x00008760, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008762, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008764, 0x00000000, 0x00000000, 0x00000000, 0x00008766, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008768, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000876a, 0x00000000, 0x00000000, 0x00000000, 0x0000876c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000876e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008770, 0x00000000, 0x00000000, 0x00000000, 0x00008772, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008774, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008776, 0x00000000, 0x00000000, 0x00000000, 0x00008778, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000877a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000877c, 0x00000000, 0x00000000, 0x00000000, 0x0000877e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008780, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008782, 0x00000000, 0x00000000, 0x00000000, 0x00008784, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008786, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008788, 0x00000000, 0x00000000, 0x00000000, 0x0000878a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000878c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000878e, 0x00000000, 0x00000000, 0x00000000, 0x00008790, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008792, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008794, 0x00000000, 0x00000000, 0x00000000, 0x00008796, 
-	0x00000000, 0x00000000, 0x00000000, 0x00008798, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000879a, 0x00000000, 0x00000000, 0x00000000, 0x0000879c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000879e, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087a0, 0x00000000, 0x00000000, 0x00000000, 0x000087a2, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087a4, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087a6, 0x00000000, 0x00000000, 0x00000000, 0x000087a8, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087aa, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087ac, 0x00000000, 0x00000000, 0x00000000, 0x000087ae, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087b0, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087b2, 0x00000000, 0x00000000, 0x00000000, 0x000087b4, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087b6, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087b8, 0x00000000, 0x00000000, 0x00000000, 0x000087ba, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087bc, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087be, 0x00000000, 0x00000000, 0x00000000, 0x000087c0, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087c2, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087c4, 0x00000000, 0x00000000, 0x00000000, 0x000087c6, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087c8, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087ca, 0x00000000, 0x00000000, 0x00000000, 0x000087cc, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087ce, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087d0, 0x00000000, 0x00000000, 0x00000000, 0x000087d2, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087d4, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087d6, 0x00000000, 0x00000000, 0x00000000, 0x000087d8, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087da, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087dc, 0x00000000, 0x00000000, 0x00000000, 0x000087de, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087e0, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087e2, 0x00000000, 0x00000000, 0x00000000, 0x000087e4, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087e6, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087e8, 0x00000000, 0x00000000, 0x00000000, 0x000087ea, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087ec, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087ee, 0x00000000, 0x00000000, 0x00000000, 0x000087f0, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087f2, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087f4, 0x00000000, 0x00000000, 0x00000000, 0x000087f6, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087f8, 0x00000000, 0x00000000, 
-	0x00000000, 0x000087fa, 0x00000000, 0x00000000, 0x00000000, 0x000087fc, 
-	0x00000000, 0x00000000, 0x00000000, 0x000087fe, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x000001d1, 0x00001500, 0x00000001, 0x00000002, 
-	0x00000003, 0x00000000, 0x00000004, 0x00000001, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000004, 0x00000003, 0x00000000, 0x00000000, 
-	0x00003fff, 0x000003ff, 0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 
-	0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 0x0000000d, 0x0000000c, 
-	0x00000000, 0x00000010, 0x02150020, 0x02150020, 0x00000030, 0x08100000, 
-	0x00000033, 0x00000030, 0x00000031, 0x00000002, 0x00000004, 0x00000000, 
-	0x00000002, 0x00000002, 0x00000000, 0x00000002, 0x00000007, 0x00000002, 
-	0x00000002, 0x00000001, 0x00000003, 0x00000001, 0x00000002, 0x00000040, 
-	0x00000040, 0x00000004, 0x00000020, 0x0000000f, 0x0000001b, 0x00008000, 
-	0x000103c0, 0x00018780, 0x00020b40, 0x00028f00, 0x000312c0, 0x00039680, 
-	0x00041a40, 0x00049e00, 0x000521c0, 0x0005a580, 0x00062940, 0x0006ad00, 
-	0x000730c0, 0x0007b480, 0x00083840, 0x0008bc00, 0x00093fc0, 0x0009c380, 
-	0x000a4740, 0x000acb00, 0x000b4ec0, 0x000bd280, 0x000c5640, 0x000cda00, 
-	0x000d5dc0, 0x00006180, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x000005aa, 0x00000599, 0x0000059d, 0x000003c0, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000046, 0x0000000c, 0x07ffffff, 
-	0x0000003f, 0x07ffffff, 0x0000000f, 0x00007ff8, 0x00007ff8, 0xffffffff, 
-	0xffffffff, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x00001900, 
-	0x00000000, 0x000001d3, 0x00003500, 0x00000001, 0x00000002, 0x00000003, 
-	0x00000000, 0x00000004, 0x00000001, 0x00000000, 0x00000001, 0x00000004, 
-	0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 
-	0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 
-	0x00000000, 0x00000004, 0x00000003, 0x00000000, 0x00000000, 0x00003fff, 
-	0x000003ff, 0x0000000f, 0x00000007, 0x00000000, 0x0000000e, 0x03150020, 
-	0x03150020, 0x01000030, 0x08100000, 0x00000033, 0x00000030, 0x00000031, 
-	0x00000003, 0x00000006, 0x00000003, 0x00000003, 0x00000002, 0x00000000, 
-	0x00000002, 0x00000000, 0x00000006, 0x00000004, 0x00000002, 0x00000002, 
-	0x00000001, 0x00000004, 0x00000001, 0x00000002, 0x00000040, 0x00000040, 
-	0x00000004, 0x00000020, 0x00000002, 0x0000001f, 0x00001000, 0x00002080, 
-	0x00003100, 0x00004180, 0x00005200, 0x00006280, 0x00007300, 0x00008380, 
-	0x00009400, 0x0000a480, 0x0000b500, 0x0000c580, 0x0000d600, 0x0000e680, 
-	0x0000f700, 0x00010780, 0x00011800, 0x00012880, 0x00013900, 0x00014980, 
-	0x00015a00, 0x00016a80, 0x00017b00, 0x00018b80, 0x00019c00, 0x0001ac80, 
-	0x0001bd00, 0x0001cd80, 0x0001de00, 0x0001ee80, 0x00000f00, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000614, 0x00000600, 0x00000604, 0x0000ffff, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x00000020, 0x00000020, 0x00000000, 0x00000000, 
-	0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000029, 
-	0x0000002a, 0x0000002b, 0x0000002c, 0x00000001, 0x00000001, 0x07ffffff, 
-	0x0000003f, 0x07ffffff, 0x0000000f, 0x00007ff8, 0x00007ff8, 0x00000000, 
-	0x00000001, 0xcccc0201, 0xcccccccc, 0xcccc0201, 0xcccccccc, 0xffffffff, 
-	0xffffffff, 0x00000000, 0x00010001, 0x00340807, 0xccccccc1, 0xffffffff, 
-	0xffffffff, 0x10000000, 0x000028ad, 0x7058103c, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x00000284, 0x00001500, 0x00000001, 
-	0x00000002, 0x00000003, 0x00000000, 0x00000004, 0x00000001, 0x00000000, 
-	0x00000001, 0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 
-	0x00000001, 0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 
-	0x00000001, 0x00000004, 0x00000000, 0x00000004, 0x00000003, 0x00000000, 
-	0x00000000, 0x00003fff, 0x000003ff, 0x000e0000, 0x011600d6, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x00720000, 0x012300f3, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000ffff, 0x00000000, 0xbf5c0000, 0xfff51fef, 0x0000ffff, 
-	0xf00003e0, 0x00000000, 0x0000a000, 0x55540000, 0x55555555, 0x00005555, 
-	0xf0000000, 0x55540000, 0x55555555, 0x00005555, 0xf0000000, 0xbf5c0000, 
-	0xfff51fef, 0x0000ffff, 0xf00003e0, 0x00000000, 0x0000a000, 0x55540000, 
-	0x55555555, 0x00005555, 0xf0000000, 0x55540000, 0x55555555, 0x00005555, 
-	0xf0000000, };
+static const u8 init_data_zipped_e1[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0xed, 0xdb, 
+	0x09, 0x8c, 0xa3, 0x75, 0x1d, 0xc6, 0xf1, 0xff, 0xfb, 0xb6, 0xd3, 0x76, 
+	0xce, 0x76, 0xee, 0x7b, 0xa6, 0x73, 0xee, 0xcc, 0xec, 0xec, 0xdc, 0x3b, 
+	0xf7, 0x51, 0xd1, 0x70, 0x18, 0x02, 0xc4, 0x08, 0x21, 0x44, 0x05, 0x91, 
+	0x28, 0x21, 0x60, 0x08, 0x1a, 0x62, 0x84, 0x48, 0x77, 0xc1, 0xfd, 0x21, 
+	0x1a, 0x20, 0x6a, 0x00, 0x0d, 0x1a, 0xa2, 0x68, 0xd0, 0x80, 0x18, 0x83, 
+	0xc6, 0x18, 0x84, 0x2a, 0x6a, 0x3c, 0x56, 0x41, 0x34, 0xc6, 0x18, 0x63, 
+	0x36, 0x4a, 0x88, 0x21, 0x06, 0x56, 0x90, 0x23, 0xc4, 0x50, 0xbf, 0x6f, 
+	0xfb, 0x76, 0xb6, 0xfb, 0xec, 0xec, 0x0c, 0xb0, 0x1b, 0x21, 0x81, 0x0e, 
+	0xff, 0x7d, 0xfb, 0xbc, 0x9f, 0xe9, 0xfd, 0xb6, 0xcf, 0xfb, 0xfe, 0x3b, 
+	0x38, 0x97, 0x76, 0xce, 0x65, 0x18, 0x17, 0x31, 0xb2, 0x8c, 0xbb, 0x18, 
+	0x39, 0xc6, 0x21, 0xe7, 0x3c, 0x16, 0x1e, 0xee, 0xe1, 0x1e, 0xee, 0xe1, 
+	0x1e, 0xee, 0xe1, 0x1e, 0xee, 0xe3, 0x3e, 0xee, 0xe3, 0x3e, 0xee, 0xe3, 
+	0x3e, 0xee, 0xe3, 0x3e, 0x1e, 0xc1, 0x23, 0x78, 0x04, 0x8f, 0xe0, 0x11, 
+	0x3c, 0x82, 0x47, 0xf0, 0x08, 0x1e, 0xc5, 0xa3, 0x78, 0x14, 0x8f, 0xe2, 
+	0x51, 0x3c, 0x8a, 0x47, 0xf1, 0x28, 0x5e, 0x81, 0x57, 0xe0, 0x15, 0x78, 
+	0x05, 0x5e, 0x81, 0x57, 0xe0, 0x15, 0x78, 0x05, 0x1e, 0xc3, 0x63, 0x78, 
+	0x0c, 0x8f, 0xe1, 0x31, 0x3c, 0x86, 0xc7, 0xf0, 0x18, 0x1e, 0xc7, 0xe3, 
+	0x78, 0x1c, 0x8f, 0xe3, 0x71, 0x3c, 0x8e, 0xc7, 0xf1, 0x38, 0x9e, 0xc0, 
+	0x13, 0x78, 0x02, 0x4f, 0xe0, 0x09, 0x3c, 0x81, 0x27, 0xf0, 0x04, 0x5e, 
+	0x89, 0x57, 0xe2, 0x95, 0x78, 0x25, 0x5e, 0x89, 0x57, 0xe2, 0x95, 0x78, 
+	0x25, 0x5e, 0x85, 0x57, 0xe1, 0x55, 0x78, 0x15, 0x5e, 0x85, 0x57, 0xe1, 
+	0x55, 0x78, 0x15, 0x5e, 0x8d, 0x57, 0xe3, 0xd5, 0x78, 0x35, 0x5e, 0x8d, 
+	0x57, 0xe3, 0xd5, 0x78, 0x35, 0x5e, 0x83, 0xd7, 0xe0, 0x35, 0x78, 0x0d, 
+	0x5e, 0x83, 0xd7, 0xe0, 0x35, 0x78, 0x0d, 0x5e, 0x8b, 0xd7, 0xe2, 0xb5, 
+	0x78, 0x2d, 0x5e, 0x8b, 0xd7, 0xe2, 0xb5, 0x78, 0x2d, 0x5e, 0x87, 0xd7, 
+	0xe1, 0x75, 0x78, 0x1d, 0x5e, 0x87, 0xd7, 0xe1, 0x75, 0x78, 0x1d, 0x9e, 
+	0xc4, 0x93, 0x78, 0x12, 0x4f, 0xe2, 0x49, 0x3c, 0x89, 0x27, 0xf1, 0x24, 
+	0x9e, 0xc2, 0x53, 0x78, 0x0a, 0x4f, 0xe1, 0x29, 0x3c, 0x85, 0xa7, 0xf0, 
+	0x14, 0x5e, 0x8f, 0xd7, 0xe3, 0xf5, 0x78, 0x3d, 0x5e, 0x8f, 0xd7, 0xe3, 
+	0xf5, 0x78, 0x3d, 0xde, 0x80, 0x37, 0xe0, 0x0d, 0x78, 0x03, 0xde, 0x80, 
+	0x37, 0xe0, 0x0d, 0x78, 0x03, 0xde, 0x88, 0x37, 0xe2, 0x8d, 0x78, 0x23, 
+	0xde, 0x88, 0x37, 0xe2, 0x8d, 0x78, 0x23, 0xde, 0x84, 0x37, 0xe1, 0x4d, 
+	0x78, 0x13, 0xde, 0x84, 0x37, 0xe1, 0x4d, 0x78, 0x13, 0xde, 0x8c, 0x37, 
+	0xe3, 0xcd, 0x78, 0x33, 0xde, 0x8c, 0x37, 0xe3, 0xcd, 0x78, 0x33, 0xde, 
+	0x82, 0xb7, 0xe0, 0x2d, 0x78, 0x0b, 0xde, 0x82, 0xb7, 0xe0, 0x2d, 0x78, 
+	0x0b, 0xde, 0x8a, 0xb7, 0xe2, 0xad, 0x78, 0x2b, 0xde, 0x8a, 0xb7, 0xe2, 
+	0xad, 0x78, 0x2b, 0xde, 0x86, 0xb7, 0xe1, 0x6d, 0x78, 0x1b, 0xde, 0x86, 
+	0xb7, 0xe1, 0x6d, 0x78, 0x1b, 0xde, 0x8e, 0xb7, 0xe3, 0xed, 0x78, 0x3b, 
+	0xde, 0x8e, 0xb7, 0xe3, 0xed, 0x78, 0x3b, 0xde, 0x81, 0x77, 0xe0, 0x1d, 
+	0x78, 0x07, 0xde, 0x81, 0x77, 0xe0, 0x1d, 0x78, 0x07, 0xde, 0x89, 0x77, 
+	0xe2, 0x9d, 0x78, 0x27, 0xde, 0x89, 0x77, 0xe2, 0x9d, 0x78, 0x27, 0xde, 
+	0x85, 0x77, 0xe1, 0x5d, 0x78, 0x17, 0xde, 0x85, 0x77, 0xe1, 0x5d, 0x78, 
+	0x17, 0xde, 0x8d, 0x77, 0xe3, 0xdd, 0x78, 0x37, 0xde, 0x8d, 0x77, 0xe3, 
+	0xdd, 0x78, 0x37, 0xde, 0x83, 0xf7, 0xe0, 0x3d, 0x78, 0x0f, 0xde, 0x83, 
+	0xf7, 0xe0, 0x3d, 0x78, 0x0f, 0xde, 0x8b, 0xf7, 0xe2, 0xbd, 0x78, 0x2f, 
+	0xde, 0x8b, 0xf7, 0xe2, 0xbd, 0x78, 0x2f, 0x1e, 0xbc, 0xf5, 0xd3, 0xfc, 
+	0x93, 0xc6, 0xd3, 0x78, 0x1a, 0x4f, 0xe3, 0x69, 0x3c, 0x8d, 0xf7, 0xe1, 
+	0x7d, 0x78, 0x1f, 0xde, 0x87, 0xf7, 0xe1, 0x7d, 0x78, 0x1f, 0xde, 0x87, 
+	0xf7, 0xe3, 0xfd, 0x78, 0x3f, 0xde, 0x8f, 0xf7, 0xe3, 0xfd, 0x78, 0x3f, 
+	0xde, 0x8f, 0x0f, 0xe0, 0x03, 0xf8, 0x00, 0x3e, 0x80, 0x0f, 0xe0, 0x03, 
+	0xf8, 0x00, 0x3e, 0x80, 0x0f, 0xe2, 0x83, 0xf8, 0x20, 0x3e, 0x88, 0x0f, 
+	0xe2, 0x83, 0xf8, 0x20, 0x3e, 0x88, 0x0f, 0xe1, 0x43, 0xf8, 0x10, 0x3e, 
+	0x84, 0x0f, 0xe1, 0x43, 0xf8, 0x10, 0x3e, 0x84, 0x0f, 0xe3, 0xc3, 0xf8, 
+	0x30, 0x3e, 0x8c, 0x0f, 0xe3, 0xc3, 0xf8, 0x30, 0x3e, 0x8c, 0xef, 0xc2, 
+	0x77, 0xe1, 0xbb, 0xf0, 0x5d, 0xf8, 0x2e, 0x7c, 0x17, 0xbe, 0x0b, 0xdf, 
+	0x85, 0x8f, 0xe0, 0x23, 0xf8, 0x08, 0x3e, 0x82, 0x8f, 0xe0, 0x23, 0xf8, 
+	0x08, 0x3e, 0x82, 0x8f, 0xe2, 0xa3, 0xf8, 0x28, 0x3e, 0x8a, 0x8f, 0xe2, 
+	0xa3, 0xf8, 0x28, 0x3e, 0x8a, 0x8f, 0xe1, 0x63, 0xf8, 0x18, 0x3e, 0x86, 
+	0x8f, 0xe1, 0x63, 0xf8, 0x18, 0x3e, 0x86, 0xef, 0xc6, 0x77, 0xe3, 0xbb, 
+	0xf1, 0xdd, 0xf8, 0x6e, 0x7c, 0x37, 0xbe, 0x1b, 0xdf, 0x8d, 0x8f, 0xe3, 
+	0xe3, 0xf8, 0x38, 0x3e, 0x8e, 0x8f, 0xe3, 0xe3, 0xf8, 0x38, 0x3e, 0x8e, 
+	0xef, 0xc1, 0xf7, 0xe0, 0x7b, 0xf0, 0x3d, 0xf8, 0x1e, 0x7c, 0x0f, 0xbe, 
+	0x07, 0xdf, 0x83, 0x4f, 0xe0, 0x13, 0xf8, 0x04, 0x3e, 0x81, 0x4f, 0xe0, 
+	0x13, 0xf8, 0x04, 0x3e, 0x81, 0x4f, 0xe2, 0x93, 0xf8, 0x24, 0x3e, 0x89, 
+	0x4f, 0xe2, 0x93, 0xf8, 0x24, 0x3e, 0x89, 0x4f, 0xe1, 0x53, 0xf8, 0x14, 
+	0x3e, 0x85, 0x4f, 0xe1, 0x53, 0xf8, 0x14, 0x3e, 0x85, 0x4f, 0xe3, 0xd3, 
+	0xf8, 0x34, 0x3e, 0x8d, 0x4f, 0xe3, 0xd3, 0xf8, 0x34, 0x3e, 0x8d, 0xcf, 
+	0xe0, 0x33, 0xf8, 0x0c, 0x3e, 0x83, 0xcf, 0xe0, 0x33, 0xf8, 0x0c, 0x3e, 
+	0x83, 0xcf, 0xe2, 0xb3, 0xf8, 0x2c, 0x3e, 0x8b, 0xcf, 0xe2, 0xb3, 0xf8, 
+	0x2c, 0x3e, 0x8b, 0xcf, 0xe1, 0x73, 0xf8, 0x1c, 0x3e, 0x87, 0xcf, 0xe1, 
+	0x73, 0xf8, 0x1c, 0x3e, 0x87, 0xef, 0xc5, 0xf7, 0xe2, 0x7b, 0xf1, 0xbd, 
+	0xf8, 0x5e, 0x7c, 0x2f, 0xbe, 0x17, 0xdf, 0x8b, 0xcf, 0xe3, 0xf3, 0xf8, 
+	0x3c, 0x3e, 0x8f, 0xcf, 0xe3, 0xf3, 0xf8, 0x3c, 0x3e, 0x8f, 0x2f, 0xe0, 
+	0x0b, 0xf8, 0x02, 0xbe, 0x80, 0x2f, 0xe0, 0x0b, 0xf8, 0x02, 0xbe, 0x80, 
+	0x2f, 0xe2, 0x8b, 0xf8, 0x22, 0xbe, 0x88, 0x2f, 0xe2, 0x8b, 0xf8, 0x22, 
+	0xbe, 0x88, 0x2f, 0xe1, 0x4b, 0xf8, 0x12, 0xbe, 0x84, 0x2f, 0xe1, 0x4b, 
+	0xf8, 0x12, 0xbe, 0x84, 0x2f, 0xe3, 0xcb, 0xf8, 0x32, 0xbe, 0x8c, 0x2f, 
+	0xe3, 0xcb, 0xf8, 0x32, 0xbe, 0x8c, 0xaf, 0xe0, 0x2b, 0xf8, 0x0a, 0xbe, 
+	0x82, 0xaf, 0xe0, 0x2b, 0xf8, 0x0a, 0xbe, 0x82, 0xaf, 0xe2, 0xab, 0xf8, 
+	0x2a, 0xbe, 0x8a, 0xaf, 0xe2, 0xab, 0xf8, 0x2a, 0xbe, 0x8a, 0xaf, 0xe1, 
+	0x6b, 0xf8, 0x1a, 0xbe, 0x86, 0xaf, 0xe1, 0x6b, 0xf8, 0x1a, 0xbe, 0x86, 
+	0xaf, 0xe3, 0xeb, 0xf8, 0x3a, 0xbe, 0x8e, 0xaf, 0xe3, 0xeb, 0xf8, 0x3a, 
+	0xbe, 0x8e, 0x6f, 0xe0, 0x1b, 0xf8, 0x06, 0xbe, 0x81, 0x6f, 0xe0, 0x1b, 
+	0xf8, 0x06, 0xbe, 0x11, 0xf8, 0xa1, 0xa0, 0xe1, 0x83, 0x92, 0xcf, 0x17, 
+	0xcb, 0xbc, 0xd0, 0xf8, 0x7e, 0x71, 0x9d, 0x4b, 0xf8, 0xcd, 0x2e, 0x1d, 
+	0x8c, 0x44, 0xaa, 0x90, 0x67, 0xcb, 0xac, 0x22, 0x1c, 0xa5, 0x53, 0xb0, 
+	0x3e, 0x12, 0x2e, 0x83, 0xeb, 0x88, 0x86, 0xe7, 0xfd, 0xb2, 0xeb, 0x2c, 
+	0xed, 0x68, 0x64, 0xc2, 0xdf, 0x6d, 0x0b, 0x57, 0x71, 0x67, 0x3e, 0xc8, 
+	0x1d, 0xdb, 0xcf, 0xfa, 0xaf, 0x93, 0x1f, 0x21, 0x3f, 0x91, 0x75, 0x1e, 
+	0xa5, 0xef, 0xf1, 0x06, 0xf7, 0x4e, 0xcd, 0x39, 0xef, 0x23, 0xe4, 0x1b, 
+	0xc9, 0xdf, 0x22, 0xff, 0x8a, 0xfc, 0x54, 0xd6, 0xf9, 0x94, 0xaa, 0xcf, 
+	0x1b, 0xc8, 0x3f, 0x33, 0xe7, 0xfc, 0x2b, 0xc8, 0x37, 0x93, 0xef, 0x27, 
+	0x3f, 0x4a, 0x3e, 0x9c, 0x2d, 0x96, 0x56, 0x71, 0x0f, 0xe6, 0x75, 0x8d, 
+	0xc8, 0x63, 0xc1, 0xe3, 0x5a, 0x2b, 0x9c, 0x0f, 0x7a, 0x38, 0xee, 0x1e, 
+	0x73, 0xfe, 0xbe, 0x8c, 0xab, 0xde, 0x77, 0xa9, 0xf3, 0xd9, 0xe9, 0xf1, 
+	0xd8, 0xe9, 0x49, 0xfa, 0xe7, 0x38, 0x8f, 0x9d, 0x9b, 0xa0, 0xc7, 0x13, 
+	0xec, 0x34, 0xa9, 0xc7, 0x71, 0x9f, 0x9d, 0xa1, 0xe0, 0xf9, 0x4b, 0x70, 
+	0xb5, 0xfe, 0xbe, 0x2c, 0x7e, 0x0f, 0xeb, 0x2e, 0x72, 0xde, 0xfe, 0xac, 
+	0xab, 0xdb, 0x7f, 0x87, 0x4b, 0x04, 0x3b, 0x45, 0xa5, 0x67, 0x31, 0xd8, 
+	0x3f, 0xc8, 0x8e, 0xf0, 0x6c, 0x1d, 0x72, 0x5e, 0x70, 0x37, 0xf6, 0x71, 
+	0x49, 0xaf, 0x2d, 0x9f, 0xcf, 0x3f, 0xe7, 0xdd, 0x9f, 0xcf, 0xbb, 0xe3, 
+	0x9c, 0xf0, 0x7f, 0xbb, 0x67, 0xb6, 0x70, 0x6f, 0xd3, 0x5f, 0x70, 0x17, 
+	0x6e, 0xe1, 0x7e, 0xc9, 0xff, 0x13, 0xeb, 0x7a, 0xb8, 0xe0, 0xa5, 0xd7, 
+	0xb4, 0xa9, 0xf0, 0x6f, 0x74, 0xf3, 0xf2, 0xcf, 0xba, 0xb3, 0xb7, 0xb8, 
+	0x7c, 0x62, 0xd3, 0x5f, 0x76, 0x93, 0x5b, 0x78, 0x6a, 0xd3, 0x5f, 0xf4, 
+	0xb6, 0xba, 0x7f, 0xe9, 0x4d, 0x7f, 0x7e, 0xcb, 0xcb, 0x67, 0x36, 0xfd, 
+	0x39, 0xef, 0x96, 0xed, 0x1f, 0xbf, 0x97, 0x7c, 0x73, 0x3f, 0x7e, 0xb7, 
+	0xd3, 0xe3, 0x3f, 0x7b, 0xdb, 0xc7, 0x9f, 0x77, 0x8f, 0x1e, 0xe5, 0x07, 
+	0xe5, 0xf1, 0x6f, 0xed, 0xde, 0x0e, 0xee, 0xef, 0xe0, 0xd1, 0x1d, 0x3c, 
+	0xb1, 0x83, 0xa7, 0x76, 0xf0, 0xf4, 0x0e, 0x5e, 0xf6, 0xfa, 0xfb, 0xc9, 
+	0x37, 0xf5, 0xeb, 0x7f, 0x53, 0x74, 0xfb, 0xd7, 0xff, 0xf6, 0x8a, 0x47, 
+	0xb7, 0x7f, 0xfd, 0xb7, 0xbc, 0xff, 0x65, 0x8f, 0xdf, 0xed, 0xf0, 0xf8, 
+	0xdd, 0x9b, 0x7b, 0xfb, 0xbf, 0x3d, 0x9a, 0xdc, 0x61, 0xfb, 0x4f, 0xbe, 
+	0xbd, 0xfd, 0x6f, 0xb3, 0xfd, 0xbf, 0xfd, 0xf8, 0xdf, 0xc2, 0x8f, 0xdf, 
+	0xb9, 0xaa, 0xfa, 0x70, 0xb2, 0x21, 0x1a, 0xfc, 0xf6, 0xd1, 0xa3, 0x70, 
+	0x2d, 0xc1, 0x91, 0x5a, 0x70, 0x34, 0x16, 0x1c, 0x71, 0x05, 0x47, 0x55, 
+	0xc1, 0x91, 0x53, 0x70, 0x74, 0x14, 0x1c, 0x01, 0x05, 0x47, 0x39, 0xc1, 
+	0x91, 0x4c, 0x70, 0xb4, 0x12, 0x1c, 0x91, 0x04, 0x47, 0x1d, 0xc1, 0x91, 
+	0x45, 0x70, 0xf4, 0x30, 0x19, 0xde, 0x4b, 0xef, 0x44, 0x47, 0x3c, 0x5f, 
+	0xb8, 0x2f, 0x1b, 0xe1, 0x32, 0xe9, 0xdc, 0x75, 0x2f, 0x15, 0x47, 0xbe, 
+	0x2b, 0x59, 0x58, 0xf7, 0xf6, 0xf2, 0x2d, 0xba, 0x2c, 0xbd, 0x4b, 0xc3, 
+	0x65, 0xa4, 0xa1, 0x78, 0x60, 0xb7, 0x79, 0x5c, 0x10, 0x09, 0x21, 0x7a, 
+	0xe4, 0x1d, 0xbb, 0x79, 0x0c, 0x51, 0x3a, 0x1f, 0x79, 0x0d, 0xeb, 0xa3, 
+	0x65, 0xeb, 0x83, 0x4d, 0x92, 0x1b, 0x8e, 0xe4, 0xcb, 0x7e, 0xaf, 0x38, 
+	0xae, 0x4d, 0x45, 0xcb, 0x2e, 0x13, 0xdc, 0x8f, 0x5b, 0x0b, 0x23, 0xeb, 
+	0x6e, 0x0d, 0x8f, 0x77, 0x6e, 0x0a, 0x27, 0x44, 0xf7, 0x85, 0xcb, 0x18, 
+	0x07, 0x01, 0x1c, 0x14, 0xc4, 0x2f, 0xd7, 0xf7, 0x60, 0xbc, 0x7b, 0xb4, 
+	0xbe, 0x70, 0x89, 0x3b, 0xa3, 0x83, 0xc7, 0xdc, 0xce, 0xe6, 0xb8, 0x2e, 
+	0x1f, 0x3e, 0x09, 0xdb, 0x8d, 0xf5, 0xd2, 0x9d, 0x2e, 0x1b, 0x9a, 0x83, 
+	0x59, 0xbd, 0x77, 0x86, 0xeb, 0x83, 0x19, 0x50, 0xd7, 0xd0, 0xca, 0x9b, 
+	0x9f, 0x31, 0xc3, 0x68, 0x68, 0xe6, 0x3c, 0x63, 0x86, 0xe1, 0xa7, 0x8a, 
+	0xef, 0xee, 0x14, 0x23, 0xcd, 0x98, 0x0a, 0x73, 0x03, 0xed, 0xde, 0xcf, 
+	0x98, 0x09, 0x5a, 0xfe, 0x1f, 0xd7, 0x67, 0xf2, 0x3b, 0x9c, 0x0e, 0xbb, 
+	0x29, 0xb7, 0xfd, 0x6f, 0xcc, 0x8e, 0x30, 0x16, 0xf3, 0xaf, 0xf3, 0xc4, 
+	0xc1, 0x6e, 0xea, 0xc8, 0xa7, 0x69, 0xe9, 0x93, 0xaf, 0x8d, 0x9c, 0x88, 
+	0x14, 0x47, 0xe9, 0x98, 0x31, 0x71, 0x64, 0x78, 0xe5, 0xd9, 0x9d, 0xc0, 
+	0x18, 0x8c, 0x84, 0x9f, 0x83, 0xc1, 0x6c, 0x6f, 0x3b, 0x2f, 0xd5, 0x0d, 
+	0x8c, 0xeb, 0xa1, 0x58, 0x31, 0x07, 0xcf, 0x71, 0xa4, 0x6c, 0xd4, 0x1c, 
+	0x38, 0x72, 0xde, 0x9d, 0xc0, 0x28, 0x5c, 0xbe, 0xb1, 0x78, 0x3e, 0xd8, 
+	0x16, 0x19, 0xa9, 0x4b, 0x32, 0x85, 0x71, 0xbc, 0x1d, 0xa5, 0x57, 0xb7, 
+	0xee, 0xda, 0xf0, 0xb8, 0x35, 0xd8, 0x56, 0xee, 0x0c, 0x6f, 0x2f, 0xd8, 
+	0xaf, 0xab, 0x2a, 0x2e, 0x0b, 0x93, 0xf9, 0xe5, 0xb7, 0x11, 0x4c, 0xe6, 
+	0x6f, 0x84, 0xdb, 0xe7, 0xe9, 0xe1, 0x28, 0x9d, 0x4e, 0x0f, 0xdf, 0x23, 
+	0x3b, 0x8d, 0xe0, 0xb9, 0xab, 0x0e, 0x6f, 0x43, 0xf3, 0x6b, 0xed, 0x92, 
+	0x93, 0x7d, 0xf9, 0xb2, 0x9d, 0x55, 0x3f, 0x9c, 0xeb, 0x88, 0x6e, 0xae, 
+	0xed, 0x39, 0xa3, 0xf8, 0x53, 0x17, 0xfe, 0x14, 0xb7, 0xc7, 0xb0, 0x93, 
+	0x0b, 0xa7, 0xa1, 0x27, 0x8a, 0x6f, 0x7f, 0xd7, 0x98, 0xcc, 0x27, 0x37, 
+	0x3b, 0x3a, 0x38, 0x9f, 0x72, 0xc5, 0x9f, 0x74, 0xf8, 0x93, 0x0d, 0x7f, 
+	0x32, 0xe1, 0x4f, 0xe9, 0xb3, 0xa0, 0x70, 0x4a, 0x17, 0xfe, 0xe3, 0x94, 
+	0x3a, 0x26, 0x1f, 0x6f, 0x7d, 0x29, 0x73, 0x15, 0x03, 0x27, 0x77, 0x14, 
+	0x36, 0x94, 0x19, 0x17, 0x7e, 0x43, 0xa2, 0xf3, 0x3d, 0xc1, 0xac, 0x60, 
+	0xd9, 0x9c, 0x4f, 0x30, 0x4b, 0x38, 0x1d, 0x3e, 0x79, 0x15, 0xe1, 0xf6, 
+	0xe4, 0xcb, 0x5c, 0x90, 0x2f, 0xf3, 0x3d, 0xb1, 0xb2, 0xcf, 0xf7, 0xd2, 
+	0x9c, 0x4f, 0x3a, 0xdc, 0xde, 0xd3, 0x45, 0x89, 0xe6, 0x5c, 0xa4, 0x32, 
+	0xeb, 0xa2, 0x75, 0x19, 0x57, 0xc1, 0xea, 0x58, 0x6b, 0xce, 0xc5, 0xbb, 
+	0xb2, 0x2e, 0xd1, 0x97, 0x71, 0x95, 0xec, 0xba, 0x54, 0x8d, 0xe5, 0x5c, 
+	0xf5, 0x64, 0xd6, 0xd5, 0xcc, 0x65, 0x5c, 0xed, 0x92, 0x73, 0x75, 0x6b, 
+	0x39, 0x97, 0x3c, 0x25, 0xeb, 0x52, 0xa7, 0x65, 0x5c, 0xfd, 0x99, 0x7c, 
+	0x88, 0x9d, 0x93, 0x73, 0x8d, 0xe7, 0x66, 0x5d, 0xd3, 0x05, 0x19, 0xd7, 
+	0x7c, 0xa1, 0x73, 0x2d, 0x1f, 0xca, 0xb9, 0xd6, 0x4b, 0xb3, 0xae, 0xed, 
+	0x8a, 0x8c, 0x6b, 0xbf, 0xca, 0xb9, 0x8e, 0xab, 0x73, 0xae, 0xf3, 0x9a, 
+	0xac, 0xeb, 0xca, 0x66, 0x5c, 0xf7, 0xa7, 0x79, 0xa1, 0x3f, 0x93, 0x73, 
+	0xbd, 0x37, 0xf3, 0x42, 0x7e, 0x21, 0x73, 0x12, 0xf6, 0x77, 0x82, 0x8d, 
+	0xa9, 0xe6, 0xd8, 0x7d, 0x27, 0xbf, 0x3e, 0x7c, 0x1a, 0xd8, 0xc0, 0xfc, 
+	0xf6, 0x63, 0x7a, 0xe2, 0xb8, 0xfb, 0x48, 0x1c, 0x70, 0x55, 0xe5, 0x8f, 
+	0x1c, 0xb5, 0xa5, 0x53, 0x5e, 0xf1, 0xcc, 0x81, 0x52, 0x25, 0x86, 0xbd, 
+	0x78, 0xc0, 0x3f, 0xfa, 0xfd, 0x7e, 0x20, 0x2a, 0x39, 0x26, 0x39, 0x21, 
+	0xb9, 0x4a, 0x72, 0x8d, 0xe4, 0x3a, 0xc9, 0x29, 0xc9, 0x0d, 0x92, 0x9b, 
+	0x24, 0xb7, 0x48, 0x6e, 0x93, 0xdc, 0x21, 0xb9, 0x4b, 0x72, 0x8f, 0x64, 
+	0xf9, 0x90, 0x3b, 0xd0, 0x2f, 0x79, 0x50, 0xf2, 0xb0, 0xe4, 0x11, 0xc9, 
+	0x63, 0x92, 0xc7, 0x25, 0x4f, 0x48, 0x9e, 0x92, 0x3c, 0x23, 0x79, 0x4e, 
+	0xf2, 0xbc, 0xe4, 0x45, 0xc9, 0xcb, 0x92, 0x57, 0x25, 0xaf, 0x4b, 0x96, 
+	0x2e, 0x38, 0x70, 0x8a, 0xe4, 0x77, 0x49, 0x3e, 0x55, 0xf2, 0xe9, 0x92, 
+	0xdf, 0x2d, 0xf9, 0x4c, 0xc9, 0x67, 0x49, 0x3e, 0x47, 0xf2, 0x7b, 0x24, 
+	0xbf, 0x57, 0xf2, 0x79, 0x92, 0xcf, 0x97, 0x7c, 0x81, 0xe4, 0xf7, 0x49, 
+	0xfe, 0x80, 0xe4, 0x8b, 0x24, 0x5f, 0x2c, 0xf9, 0x12, 0xc9, 0x1f, 0x96, 
+	0x7c, 0xa9, 0xe4, 0xcb, 0x24, 0x5f, 0x2e, 0xf9, 0xa3, 0x92, 0xaf, 0x94, 
+	0x7c, 0x95, 0xe4, 0x8f, 0x4b, 0xbe, 0x5a, 0xf2, 0x27, 0x24, 0x7f, 0x52, 
+	0xf2, 0xb5, 0x92, 0x3f, 0x25, 0x39, 0x2b, 0x79, 0xbf, 0xe4, 0x1b, 0x24, 
+	0x1f, 0x90, 0x7c, 0xa3, 0xe4, 0x9b, 0x24, 0x7f, 0x4e, 0xf2, 0xcd, 0x92, 
+	0x6f, 0x95, 0xfc, 0x79, 0xc9, 0x5f, 0x94, 0x7c, 0x9b, 0xe4, 0x3b, 0x24, 
+	0x7f, 0x59, 0xf2, 0x9d, 0x92, 0xbf, 0x2a, 0xf9, 0x2e, 0xc9, 0x5f, 0x93, 
+	0x7c, 0xb7, 0xe4, 0x6f, 0x4a, 0xbe, 0x47, 0xf2, 0xb7, 0x25, 0xdf, 0x2b, 
+	0xf9, 0x3b, 0x92, 0xbf, 0x2b, 0xf9, 0x7b, 0x92, 0x1f, 0x90, 0xfc, 0x03, 
+	0xc9, 0x3f, 0x94, 0xfc, 0x23, 0xc9, 0x0f, 0x4a, 0x7e, 0x48, 0x72, 0x4e, 
+	0xf2, 0x4f, 0x25, 0xff, 0x4c, 0xf2, 0x2f, 0x24, 0xff, 0x52, 0xf2, 0xaf, 
+	0x25, 0x1f, 0x94, 0xfc, 0x3b, 0xc9, 0x8f, 0x49, 0x7e, 0x5c, 0xf2, 0x1f, 
+	0x25, 0xff, 0x49, 0xf2, 0x9f, 0x25, 0xff, 0x45, 0xf2, 0x5f, 0x25, 0xff, 
+	0x4d, 0xf2, 0x21, 0xc9, 0x7f, 0x97, 0xfc, 0x84, 0xe4, 0x27, 0x25, 0xff, 
+	0x53, 0xf2, 0x53, 0x92, 0xff, 0x25, 0xf9, 0x69, 0xc9, 0x87, 0x25, 0x3f, 
+	0x2b, 0xf9, 0x3f, 0x92, 0x5f, 0x90, 0xfc, 0x92, 0xe4, 0x97, 0x25, 0xff, 
+	0x57, 0xf2, 0x2b, 0x47, 0x67, 0x93, 0xfd, 0x7b, 0x93, 0xfe, 0x37, 0xe9, 
+	0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 
+	0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 
+	0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 
+	0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 
+	0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 
+	0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 
+	0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 
+	0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 
+	0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 
+	0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 
+	0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 
+	0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 
+	0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 
+	0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 
+	0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 
+	0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 
+	0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 
+	0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 
+	0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 
+	0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 
+	0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 
+	0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 
+	0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 
+	0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 
+	0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 
+	0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x93, 0xfe, 0x37, 0xe9, 0x7f, 0x7b, 
+	0xe5, 0xd8, 0xf9, 0x72, 0xef, 0xf7, 0xc5, 0x3f, 0x84, 0xfc, 0xbf, 0xcf, 
+	0x97, 0x47, 0xdc, 0x43, 0x0f, 0xa6, 0xcb, 0xe6, 0x78, 0x34, 0xd7, 0x86, 
+	0x73, 0x20, 0x85, 0x6f, 0xba, 0x5e, 0xc5, 0xdc, 0x51, 0xf9, 0x5c, 0xbb, 
+	0x5f, 0x76, 0x3e, 0x2e, 0x73, 0x47, 0x91, 0x2d, 0xe6, 0x8e, 0xa2, 0xe1, 
+	0xfc, 0x51, 0x30, 0xf7, 0xdd, 0x59, 0x98, 0x8f, 0xf3, 0x22, 0x39, 0xe7, 
+	0x59, 0xf8, 0x77, 0x40, 0xb7, 0x04, 0x5f, 0x2b, 0xe4, 0x5c, 0xe4, 0xb6, 
+	0xac, 0x8b, 0x76, 0x64, 0x5c, 0x94, 0x8f, 0x91, 0x8a, 0xbe, 0x9c, 0xab, 
+	0xf8, 0x46, 0xd6, 0xc5, 0x46, 0x33, 0x2e, 0x76, 0x1f, 0xb7, 0x32, 0x95, 
+	0x73, 0xf1, 0x07, 0xb2, 0x2e, 0xb1, 0x98, 0x71, 0x09, 0xde, 0x76, 0x95, 
+	0x1b, 0x39, 0x57, 0xf9, 0x48, 0xd6, 0x55, 0x9d, 0x96, 0x71, 0x55, 0xbf, 
+	0x71, 0xae, 0xfa, 0xac, 0x9c, 0xab, 0x7e, 0x3c, 0xeb, 0x6a, 0xce, 0xcb, 
+	0xb8, 0x1a, 0x36, 0xd3, 0xda, 0xf7, 0xe7, 0x8a, 0x7f, 0x97, 0x74, 0xe2, 
+	0xdf, 0x8d, 0x71, 0x67, 0xf8, 0xdc, 0xa9, 0xf8, 0x12, 0xe3, 0x2b, 0xc5, 
+	0x3f, 0x7e, 0x3e, 0xe6, 0x3b, 0xbc, 0xa0, 0xb7, 0x6b, 0x8e, 0x37, 0x3f, 
+	0x74, 0x64, 0x9e, 0x5c, 0xb7, 0x8d, 0xf6, 0xd2, 0xcb, 0xf9, 0x87, 0x37, 
+	0xe8, 0x3b, 0x95, 0x64, 0xd9, 0xfc, 0x61, 0x5d, 0x84, 0xd7, 0x3f, 0x18, 
+	0xde, 0xd6, 0xdb, 0x40, 0x24, 0x9c, 0x17, 0x2c, 0xcd, 0xbd, 0x97, 0x6f, 
+	0x03, 0xa5, 0xef, 0x32, 0xf4, 0xef, 0xc6, 0xa2, 0xdb, 0x6c, 0x0b, 0xc1, 
+	0xba, 0xde, 0xe2, 0x14, 0x5c, 0xf0, 0x87, 0xab, 0xc1, 0x4d, 0xbc, 0x83, 
+	0x65, 0xb0, 0x8b, 0x72, 0x31, 0xcb, 0x8f, 0xb1, 0xbc, 0x9e, 0x65, 0x50, 
+	0x51, 0x77, 0xb3, 0xfc, 0x3e, 0xcb, 0x9f, 0xb3, 0x0c, 0x3e, 0xa2, 0x9e, 
+	0x64, 0xf9, 0x62, 0xf0, 0xad, 0x65, 0xd6, 0x79, 0xec, 0xa2, 0x7a, 0x23, 
+	0x2c, 0x97, 0x58, 0x9e, 0xc1, 0x92, 0x5d, 0x14, 0xef, 0x32, 0x96, 0xd7, 
+	0xb0, 0xfc, 0x2c, 0x4b, 0x2a, 0xca, 0xbb, 0x97, 0xe5, 0x8f, 0x59, 0xfe, 
+	0x96, 0x25, 0x1f, 0x51, 0xde, 0xd3, 0xd9, 0xe2, 0x43, 0x3f, 0x19, 0xdb, 
+	0x46, 0xf9, 0x88, 0x35, 0x85, 0x5f, 0x0f, 0x1c, 0xef, 0x7b, 0xde, 0xf2, 
+	0xfd, 0xe1, 0xad, 0xbe, 0xeb, 0xd5, 0xef, 0x79, 0x77, 0xf8, 0x6e, 0xb6, 
+	0xf8, 0x3a, 0x1f, 0x3c, 0xe8, 0x33, 0x82, 0x53, 0x71, 0x79, 0x64, 0x7b, 
+	0x2b, 0x5c, 0x83, 0xe7, 0xe6, 0x12, 0x71, 0x56, 0xff, 0xa4, 0xb4, 0xbe, 
+	0xf8, 0xd2, 0x8e, 0xdc, 0x77, 0xe5, 0xf9, 0xa9, 0xd5, 0xa3, 0xb7, 0xc7, 
+	0xd2, 0xd2, 0xbf, 0xe1, 0x0d, 0xf9, 0xcc, 0xe2, 0xe8, 0xc5, 0x6b, 0x09, 
+	0x5e, 0xe0, 0xd2, 0xdc, 0xfd, 0xab, 0x5d, 0x96, 0x4e, 0x61, 0xbe, 0xaa, 
+	0x30, 0x4b, 0xfe, 0xdc, 0x89, 0x5e, 0xcf, 0xc3, 0xec, 0xdd, 0xe6, 0x9f, 
+	0xef, 0x7d, 0x26, 0xc8, 0x87, 0x0b, 0xff, 0xc3, 0x43, 0x70, 0xba, 0xcb, 
+	0x9d, 0xcb, 0x5e, 0xf3, 0xb9, 0x9c, 0x82, 0x7f, 0x83, 0x82, 0xd1, 0xfc, 
+	0x7a, 0x2f, 0xf7, 0x3f, 0xef, 0x62, 0xc7, 0xcf, 0xcc, 0x31, 0x00, 0x00, };
 
 static const u8 csem_int_table_data_e1[] = {
 	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x8b, 0xe4, 
@@ -13120,20 +12190,25 @@ static const u8 xsem_pram_data_e1[] = {
 	0x68, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, };
 
 #ifdef __KERNEL__
-void bnx2x_init_e1_firmware(struct bnx2x *bp)
-{
-	INIT_OPS(bp)                  = (struct raw_op *)init_ops_e1;
-	INIT_DATA(bp)                 = (u32 *)init_data_e1;
-	INIT_OPS_OFFSETS(bp)          = (u16 *)init_ops_offsets_e1;
-	INIT_TSEM_INT_TABLE_DATA(bp)  = tsem_int_table_data_e1;
-	INIT_TSEM_PRAM_DATA(bp)       = tsem_pram_data_e1;
-	INIT_USEM_INT_TABLE_DATA(bp)  = usem_int_table_data_e1;
-	INIT_USEM_PRAM_DATA(bp)       = usem_pram_data_e1;
-	INIT_XSEM_INT_TABLE_DATA(bp)  = xsem_int_table_data_e1;
-	INIT_XSEM_PRAM_DATA(bp)       = xsem_pram_data_e1;
-	INIT_CSEM_INT_TABLE_DATA(bp)  = csem_int_table_data_e1;
-	INIT_CSEM_PRAM_DATA(bp)       = csem_pram_data_e1;
-}
+const struct bnx2x_init_values bnx2x_init_values_e1 = {
+	.ops                  = init_ops_zipped_e1,
+	.ops_zlen             = sizeof(init_ops_zipped_e1),
+	.ops_len              = 5704,
+	.ops_offsets          = init_ops_offsets_zipped_e1,
+	.ops_offsets_zlen     = sizeof(init_ops_offsets_zipped_e1),
+	.ops_offsets_len      = 1496,
+	.data                 = init_data_zipped_e1,
+	.data_zlen            = sizeof(init_data_zipped_e1),
+	.data_len             = 12748,
+	.tsem_int_table_data  = tsem_int_table_data_e1,
+	.tsem_pram_data       = tsem_pram_data_e1,
+	.usem_int_table_data  = usem_int_table_data_e1,
+	.usem_pram_data       = usem_pram_data_e1,
+	.xsem_int_table_data  = xsem_int_table_data_e1,
+	.xsem_pram_data       = xsem_pram_data_e1,
+	.csem_int_table_data  = csem_int_table_data_e1,
+	.csem_pram_data       = csem_pram_data_e1,
+};
 #endif
 
 // Total size: 39838 regs
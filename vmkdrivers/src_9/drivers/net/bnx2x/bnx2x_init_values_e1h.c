@@ -16,6 +16,10 @@
 * OP_WR_64       - write a 64-bit pattern to consecutive registers.
 * OP_IF_MODE_OR  - skip next ops if all modes do not match.
 * OP_IF_MODE_AND - skip next ops if at least one mode does not match.
+*
+* The operations, their block offsets and the data blob are stored zipped in
+* the big endian layout of the bnx2x firmware file and are inflated by
+* bnx2x_init_firmware() only for the chip being initialized.
 */
 #ifdef __KERNEL__
 #include <linux/version.h>
@@ -28,2050 +32,602 @@
 #include "bnx2x_init.h"
 #endif
 
-static const struct raw_op init_ops_e1h[] = {
-/* #define BRB1_COMMON_START        22 */
-	{OP_WR, 0x600dc, 0x1},
-	{OP_SW, 0x61000, 0x2000000},
-	{OP_RD, 0x600d8, 0x0},
-	{OP_SW, 0x60200, 0x30200},
-	{OP_WR, 0x600dc, 0x0},
-/* #define BRB1_COMMON_END          23 */
-/* #define BRB1_PORT0_START        24 */
-	{OP_RD, 0x600b8, 0x0},
-	{OP_RD, 0x600c8, 0x0},
-	{OP_WR, 0x6016c, 0x0},
-/* #define BRB1_PORT0_END          25 */
-/* #define BRB1_PORT1_START        26 */
-	{OP_RD, 0x600bc, 0x0},
-	{OP_RD, 0x600cc, 0x0},
-	{OP_WR, 0x60170, 0x0},
-/* #define BRB1_PORT1_END          27 */
-/* #define CCM_COMMON_START        44 */
-	{OP_WR, 0xd0044, 0x32},
-	{OP_SW, 0xd004c, 0x40203},
-	{OP_ZR, 0xd005c, 0x4},
-	{OP_SW, 0xd008c, 0x110207},
-	{OP_WR, 0xd015c, 0x1},
-	{OP_SW, 0xd0164, 0x20218},
-	{OP_WR, 0xd0204, 0x1},
-	{OP_SW, 0xd020c, 0x3021a},
-	{OP_SW, 0xd0220, 0x2021d},
-	{OP_ZR, 0xd0280, 0x12},
-	{OP_SW, 0xd0300, 0x18021f},
-	{OP_ZR, 0xd0360, 0xc},
-	{OP_ZR, 0xd4000, 0xa00},
-	{OP_SW, 0xd0004, 0xf0237},
-/* #define CCM_COMMON_END          45 */
-/* #define CCM_PF0_START        50 */
-	{OP_WR, 0xd0114, 0xd},
-/* #define CCM_PF0_END          51 */
-/* #define CCM_PF1_START        52 */
-	{OP_WR, 0xd0118, 0x2d},
-/* #define CCM_PF1_END          53 */
-/* #define CCM_PF2_START        54 */
-	{OP_WR, 0xd0114, 0x1d},
-/* #define CCM_PF2_END          55 */
-/* #define CCM_PF3_START        56 */
-	{OP_WR, 0xd0118, 0x3d},
-/* #define CCM_PF3_END          57 */
-/* #define CCM_PF4_START        58 */
-	{OP_WR, 0xd0114, 0x4d},
-/* #define CCM_PF4_END          59 */
-/* #define CCM_PF5_START        60 */
-	{OP_WR, 0xd0118, 0x6d},
-/* #define CCM_PF5_END          61 */
-/* #define CCM_PF6_START        62 */
-	{OP_WR, 0xd0114, 0x5d},
-/* #define CCM_PF6_END          63 */
-/* #define CCM_PF7_START        64 */
-	{OP_WR, 0xd0118, 0x7d},
-/* #define CCM_PF7_END          65 */
-/* #define CDU_COMMON_START        66 */
-	{OP_SW, 0x101000, 0x30246},
-	{OP_WR, 0x101050, 0x1},
-	{OP_WB, 0x101100, 0x100249},
-	{OP_WB_ZR, 0x101140, 0x8},
-	{OP_WB, 0x101160, 0x100259},
-	{OP_WB_ZR, 0x1011a0, 0x18},
-	{OP_WB, 0x101800, 0x2000269},
-/* #define CDU_COMMON_END          67 */
-/* #define CFC_COMMON_START        88 */
-	{OP_ZR, 0x104c00, 0x100},
-	{OP_WR, 0x104028, 0x10},
-	{OP_WR, 0x104044, 0x3fff},
-	{OP_WR, 0x104058, 0x280000},
-	{OP_WR, 0x104084, 0x84924a},
-	{OP_WR, 0x104058, 0x0},
-/* #define CFC_COMMON_END          89 */
-/* #define CSDM_COMMON_START        110 */
-	{OP_SW, 0xc2008, 0x30469},
-	{OP_SW, 0xc201c, 0x4046c},
-	{OP_SW, 0xc2038, 0x110470},
-	{OP_ZR, 0xc207c, 0x4f},
-	{OP_SW, 0xc21b8, 0x110481},
-	{OP_ZR, 0xc21fc, 0xf},
-	{OP_SW, 0xc2238, 0x40492},
-	{OP_RD, 0xc2248, 0x0},
-	{OP_RD, 0xc224c, 0x0},
-	{OP_RD, 0xc2250, 0x0},
-	{OP_RD, 0xc2254, 0x0},
-	{OP_RD, 0xc2258, 0x0},
-	{OP_RD, 0xc225c, 0x0},
-	{OP_RD, 0xc2260, 0x0},
-	{OP_RD, 0xc2264, 0x0},
-	{OP_RD, 0xc2268, 0x0},
-	{OP_RD, 0xc226c, 0x0},
-	{OP_RD, 0xc2270, 0x0},
-	{OP_RD, 0xc2274, 0x0},
-	{OP_RD, 0xc2278, 0x0},
-	{OP_RD, 0xc227c, 0x0},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0xc2000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0xc2000, 0xa},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0xc2000, 0x1},
-/* #define CSDM_COMMON_END          111 */
-/* #define CSEM_COMMON_START        132 */
-	{OP_ZP, 0x200400, 0x860000},
-	{OP_WR_64, 0x200780, 0x100496},
-	{OP_ZR, 0x220000, 0x4000},
-	{OP_ZR, 0x232400, 0x40},
-	{OP_SW, 0x221250, 0x100498},
-	{OP_ZR, 0x22b140, 0x20},
-	{OP_ZR, 0x22c800, 0x6},
-	{OP_SW, 0x22c818, 0x404a8},
-	{OP_ZR, 0x22c828, 0xc},
-	{OP_SW, 0x22c858, 0x404ac},
-	{OP_ZR, 0x22c868, 0xc},
-	{OP_SW, 0x22c898, 0x404b0},
-	{OP_ZR, 0x22c8a8, 0xc},
-	{OP_SW, 0x22c8d8, 0x404b4},
-	{OP_ZR, 0x22c8e8, 0xc},
-	{OP_SW, 0x22c918, 0x404b8},
-	{OP_ZR, 0x22c928, 0xc},
-	{OP_SW, 0x22c958, 0x404bc},
-	{OP_ZR, 0x22c968, 0xc},
-	{OP_SW, 0x22c998, 0x404c0},
-	{OP_ZR, 0x22c9a8, 0xc},
-	{OP_SW, 0x22c9d8, 0x404c4},
-	{OP_ZR, 0x22c9e8, 0xc},
-	{OP_SW, 0x22ca18, 0x404c8},
-	{OP_ZR, 0x22ca28, 0xc},
-	{OP_SW, 0x22ca58, 0x404cc},
-	{OP_ZR, 0x22ca68, 0xc},
-	{OP_SW, 0x22ca98, 0x404d0},
-	{OP_ZR, 0x22caa8, 0xc},
-	{OP_SW, 0x22cad8, 0x404d4},
-	{OP_ZR, 0x22cae8, 0xc},
-	{OP_SW, 0x22cb18, 0x404d8},
-	{OP_ZR, 0x22cb28, 0xc},
-	{OP_SW, 0x22cb58, 0x404dc},
-	{OP_ZR, 0x22cb68, 0xc},
-	{OP_SW, 0x22cb98, 0x404e0},
-	{OP_ZR, 0x22cba8, 0xc},
-	{OP_SW, 0x22cbd8, 0x404e4},
-	{OP_ZR, 0x22cbe8, 0xc},
-	{OP_SW, 0x22cc18, 0x404e8},
-	{OP_ZR, 0x22cc28, 0xc},
-	{OP_SW, 0x22cc58, 0x404ec},
-	{OP_ZR, 0x22cc68, 0xc},
-	{OP_SW, 0x22cc98, 0x404f0},
-	{OP_ZR, 0x22cca8, 0xc},
-	{OP_SW, 0x22ccd8, 0x404f4},
-	{OP_ZR, 0x22cce8, 0xc},
-	{OP_SW, 0x22cd18, 0x404f8},
-	{OP_ZR, 0x22cd28, 0xc},
-	{OP_SW, 0x22cd58, 0x404fc},
-	{OP_ZR, 0x22cd68, 0xc},
-	{OP_SW, 0x22cd98, 0x40500},
-	{OP_ZR, 0x22cda8, 0xc},
-	{OP_SW, 0x22cdd8, 0x40504},
-	{OP_ZR, 0x22cde8, 0xc},
-	{OP_SW, 0x22ce18, 0x40508},
-	{OP_ZR, 0x22ce28, 0xc},
-	{OP_SW, 0x22ce58, 0x4050c},
-	{OP_ZR, 0x22ce68, 0xc},
-	{OP_SW, 0x22ce98, 0x40510},
-	{OP_ZR, 0x22cea8, 0xc},
-	{OP_SW, 0x22ced8, 0x40514},
-	{OP_ZR, 0x22cee8, 0xc},
-	{OP_SW, 0x22cf18, 0x40518},
-	{OP_ZR, 0x22cf28, 0xc},
-	{OP_SW, 0x22cf58, 0x4051c},
-	{OP_ZR, 0x22cf68, 0xc},
-	{OP_SW, 0x22cf98, 0x40520},
-	{OP_ZR, 0x22cfa8, 0xc},
-	{OP_SW, 0x22cfd8, 0x40524},
-	{OP_ZR, 0x22cfe8, 0x6},
-	{OP_WR, 0x238000, 0x10},
-	{OP_WR, 0x238040, 0x12},
-	{OP_WR, 0x238080, 0x30},
-	{OP_WR, 0x2380c0, 0xe},
-	{OP_WR, 0x238380, 0x7a120},
-	{OP_WR, 0x2383c0, 0x1f4},
-	{OP_WR, 0x238bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x1}, /* asic */
-	{OP_WR, 0x238300, 0x7a120},
-	{OP_WR, 0x238340, 0x1f4},
-	{OP_IF_MODE_AND, 2, 0x2}, /* fpga */
-	{OP_WR, 0x238300, 0x1388},
-	{OP_WR, 0x238340, 0x5},
-	{OP_IF_MODE_AND, 2, 0x4}, /* emul */
-	{OP_WR, 0x238300, 0x138},
-	{OP_WR, 0x238340, 0x0},
-	{OP_ZP, 0x240000, 0x33380000},
-	{OP_ZP, 0x248000, 0x10320cce},
-	{OP_WR_64, 0x249e70, 0x6a980528},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x231480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x231480, 0x0},
-	{OP_RD, 0x200000, 0x0},
-	{OP_RD, 0x200004, 0x0},
-	{OP_RD, 0x200008, 0x0},
-	{OP_RD, 0x20000c, 0x0},
-	{OP_RD, 0x200010, 0x0},
-	{OP_RD, 0x200014, 0x0},
-	{OP_SW, 0x200020, 0x1a052a},
-	{OP_SW, 0x2000a4, 0x20544},
-	{OP_WR, 0x200224, 0x0},
-	{OP_WR, 0x200234, 0x0},
-	{OP_WR, 0x20024c, 0x0},
-	{OP_WR, 0x2002e4, 0xffff},
-	{OP_WB_ZR, 0x202000, 0x800},
-/* #define CSEM_COMMON_END          133 */
-/* #define CSEM_PF0_START        138 */
-	{OP_ZR, 0x221108, 0x2},
-	{OP_ZR, 0x221290, 0x6},
-	{OP_ZR, 0x223400, 0x2},
-	{OP_ZR, 0x226040, 0x30},
-	{OP_ZR, 0x228c00, 0x10},
-/* #define CSEM_PF0_END          139 */
-/* #define CSEM_PF1_START        140 */
-	{OP_ZR, 0x221110, 0x2},
-	{OP_ZR, 0x2212a8, 0x6},
-	{OP_ZR, 0x223408, 0x2},
-	{OP_ZR, 0x226100, 0x30},
-	{OP_ZR, 0x228c40, 0x10},
-/* #define CSEM_PF1_END          141 */
-/* #define CSEM_PF2_START        142 */
-	{OP_ZR, 0x221118, 0x2},
-	{OP_ZR, 0x2212c0, 0x6},
-	{OP_ZR, 0x223410, 0x2},
-	{OP_ZR, 0x2261c0, 0x30},
-	{OP_ZR, 0x228c80, 0x10},
-/* #define CSEM_PF2_END          143 */
-/* #define CSEM_PF3_START        144 */
-	{OP_ZR, 0x221120, 0x2},
-	{OP_ZR, 0x2212d8, 0x6},
-	{OP_ZR, 0x223418, 0x2},
-	{OP_ZR, 0x226280, 0x30},
-	{OP_ZR, 0x228cc0, 0x10},
-/* #define CSEM_PF3_END          145 */
-/* #define CSEM_PF4_START        146 */
-	{OP_ZR, 0x221128, 0x2},
-	{OP_ZR, 0x2212f0, 0x6},
-	{OP_ZR, 0x223420, 0x2},
-	{OP_ZR, 0x226340, 0x30},
-	{OP_ZR, 0x228d00, 0x10},
-/* #define CSEM_PF4_END          147 */
-/* #define CSEM_PF5_START        148 */
-	{OP_ZR, 0x221130, 0x2},
-	{OP_ZR, 0x221308, 0x6},
-	{OP_ZR, 0x223428, 0x2},
-	{OP_ZR, 0x226400, 0x30},
-	{OP_ZR, 0x228d40, 0x10},
-/* #define CSEM_PF5_END          149 */
-/* #define CSEM_PF6_START        150 */
-	{OP_ZR, 0x221138, 0x2},
-	{OP_ZR, 0x221320, 0x6},
-	{OP_ZR, 0x223430, 0x2},
-	{OP_ZR, 0x2264c0, 0x30},
-	{OP_ZR, 0x228d80, 0x10},
-/* #define CSEM_PF6_END          151 */
-/* #define CSEM_PF7_START        152 */
-	{OP_ZR, 0x221140, 0x2},
-	{OP_ZR, 0x221338, 0x6},
-	{OP_ZR, 0x223438, 0x2},
-	{OP_ZR, 0x226580, 0x30},
-	{OP_ZR, 0x228dc0, 0x10},
-/* #define CSEM_PF7_END          153 */
-/* #define DMAE_COMMON_START        176 */
-	{OP_ZR, 0x102400, 0xe0},
-	{OP_SW, 0x10201c, 0x20546},
-	{OP_WR, 0x1020c0, 0x2},
-	{OP_SW, 0x102004, 0x20548},
-/* #define DMAE_COMMON_END          177 */
-/* #define DORQ_COMMON_START        198 */
-	{OP_WR, 0x170008, 0x2},
-	{OP_WR, 0x17002c, 0x3},
-	{OP_SW, 0x170038, 0x2054a},
-	{OP_SW, 0x170048, 0x5054c},
-	{OP_SW, 0x170060, 0x50551},
-	{OP_SW, 0x170078, 0x20556},
-	{OP_WR, 0x170004, 0xf},
-/* #define DORQ_COMMON_END          199 */
-/* #define HC_PF0_START        226 */
-	{OP_WR, 0x108000, 0x1080},
-	{OP_ZR, 0x108040, 0x2},
-	{OP_WR, 0x1080ac, 0x0},
-	{OP_WR, 0x108038, 0x10},
-	{OP_WR, 0x108100, 0x0},
-	{OP_ZR, 0x108120, 0x2},
-	{OP_WR, 0x108008, 0x2b5},
-	{OP_WR, 0x108010, 0x0},
-	{OP_WR, 0x108108, 0x1ffff},
-	{OP_ZR, 0x108200, 0x4a},
-	{OP_ZR, 0x108140, 0x2},
-	{OP_WR, 0x108000, 0x1a80},
-	{OP_ZR, 0x109000, 0x24},
-	{OP_ZR, 0x109120, 0x4a},
-	{OP_ZR, 0x109370, 0x4a},
-	{OP_ZR, 0x1095c0, 0x4a},
-/* #define HC_PF0_END          227 */
-/* #define HC_PF1_START        228 */
-	{OP_WR, 0x108004, 0x1080},
-	{OP_ZR, 0x108048, 0x2},
-	{OP_WR, 0x1080b0, 0x1},
-	{OP_WR, 0x10803c, 0x10},
-	{OP_WR, 0x108104, 0x0},
-	{OP_ZR, 0x108128, 0x2},
-	{OP_WR, 0x10800c, 0x2b5},
-	{OP_WR, 0x108014, 0x0},
-	{OP_WR, 0x10810c, 0x1ffff},
-	{OP_ZR, 0x108400, 0x4a},
-	{OP_ZR, 0x108148, 0x2},
-	{OP_WR, 0x108004, 0x1a80},
-	{OP_ZR, 0x109090, 0x24},
-	{OP_ZR, 0x109248, 0x4a},
-	{OP_ZR, 0x109498, 0x4a},
-	{OP_ZR, 0x1096e8, 0x4a},
-/* #define HC_PF1_END          229 */
-/* #define HC_PF2_START        230 */
-	{OP_WR, 0x108000, 0x1080},
-	{OP_ZR, 0x108040, 0x2},
-	{OP_WR, 0x1080ac, 0x2},
-	{OP_WR, 0x108038, 0x10},
-	{OP_WR, 0x108100, 0x0},
-	{OP_ZR, 0x108120, 0x2},
-	{OP_WR, 0x108008, 0x2b5},
-	{OP_WR, 0x108010, 0x0},
-	{OP_WR, 0x108108, 0x1ffff},
-	{OP_ZR, 0x108200, 0x4a},
-	{OP_ZR, 0x108140, 0x2},
-	{OP_WR, 0x108000, 0x1a80},
-	{OP_ZR, 0x109000, 0x24},
-	{OP_ZR, 0x109120, 0x4a},
-	{OP_ZR, 0x109370, 0x4a},
-	{OP_ZR, 0x1095c0, 0x4a},
-/* #define HC_PF2_END          231 */
-/* #define HC_PF3_START        232 */
-	{OP_WR, 0x108004, 0x1080},
-	{OP_ZR, 0x108048, 0x2},
-	{OP_WR, 0x1080b0, 0x3},
-	{OP_WR, 0x10803c, 0x10},
-	{OP_WR, 0x108104, 0x0},
-	{OP_ZR, 0x108128, 0x2},
-	{OP_WR, 0x10800c, 0x2b5},
-	{OP_WR, 0x108014, 0x0},
-	{OP_WR, 0x10810c, 0x1ffff},
-	{OP_ZR, 0x108400, 0x4a},
-	{OP_ZR, 0x108148, 0x2},
-	{OP_WR, 0x108004, 0x1a80},
-	{OP_ZR, 0x109090, 0x24},
-	{OP_ZR, 0x109248, 0x4a},
-	{OP_ZR, 0x109498, 0x4a},
-	{OP_ZR, 0x1096e8, 0x4a},
-/* #define HC_PF3_END          233 */
-/* #define HC_PF4_START        234 */
-	{OP_WR, 0x108000, 0x1080},
-	{OP_ZR, 0x108040, 0x2},
-	{OP_WR, 0x1080ac, 0x4},
-	{OP_WR, 0x108038, 0x10},
-	{OP_WR, 0x108100, 0x0},
-	{OP_ZR, 0x108120, 0x2},
-	{OP_WR, 0x108008, 0x2b5},
-	{OP_WR, 0x108010, 0x0},
-	{OP_WR, 0x108108, 0x1ffff},
-	{OP_ZR, 0x108200, 0x4a},
-	{OP_ZR, 0x108140, 0x2},
-	{OP_WR, 0x108000, 0x1a80},
-	{OP_ZR, 0x109000, 0x24},
-	{OP_ZR, 0x109120, 0x4a},
-	{OP_ZR, 0x109370, 0x4a},
-	{OP_ZR, 0x1095c0, 0x4a},
-/* #define HC_PF4_END          235 */
-/* #define HC_PF5_START        236 */
-	{OP_WR, 0x108004, 0x1080},
-	{OP_ZR, 0x108048, 0x2},
-	{OP_WR, 0x1080b0, 0x5},
-	{OP_WR, 0x10803c, 0x10},
-	{OP_WR, 0x108104, 0x0},
-	{OP_ZR, 0x108128, 0x2},
-	{OP_WR, 0x10800c, 0x2b5},
-	{OP_WR, 0x108014, 0x0},
-	{OP_WR, 0x10810c, 0x1ffff},
-	{OP_ZR, 0x108400, 0x4a},
-	{OP_ZR, 0x108148, 0x2},
-	{OP_WR, 0x108004, 0x1a80},
-	{OP_ZR, 0x109090, 0x24},
-	{OP_ZR, 0x109248, 0x4a},
-	{OP_ZR, 0x109498, 0x4a},
-	{OP_ZR, 0x1096e8, 0x4a},
-/* #define HC_PF5_END          237 */
-/* #define HC_PF6_START        238 */
-	{OP_WR, 0x108000, 0x1080},
-	{OP_ZR, 0x108040, 0x2},
-	{OP_WR, 0x1080ac, 0x6},
-	{OP_WR, 0x108038, 0x10},
-	{OP_WR, 0x108100, 0x0},
-	{OP_ZR, 0x108120, 0x2},
-	{OP_WR, 0x108008, 0x2b5},
-	{OP_WR, 0x108010, 0x0},
-	{OP_WR, 0x108108, 0x1ffff},
-	{OP_ZR, 0x108200, 0x4a},
-	{OP_ZR, 0x108140, 0x2},
-	{OP_WR, 0x108000, 0x1a80},
-	{OP_ZR, 0x109000, 0x24},
-	{OP_ZR, 0x109120, 0x4a},
-	{OP_ZR, 0x109370, 0x4a},
-	{OP_ZR, 0x1095c0, 0x4a},
-/* #define HC_PF6_END          239 */
-/* #define HC_PF7_START        240 */
-	{OP_WR, 0x108004, 0x1080},
-	{OP_ZR, 0x108048, 0x2},
-	{OP_WR, 0x1080b0, 0x7},
-	{OP_WR, 0x10803c, 0x10},
-	{OP_WR, 0x108104, 0x0},
-	{OP_ZR, 0x108128, 0x2},
-	{OP_WR, 0x10800c, 0x2b5},
-	{OP_WR, 0x108014, 0x0},
-	{OP_WR, 0x10810c, 0x1ffff},
-	{OP_ZR, 0x108400, 0x4a},
-	{OP_ZR, 0x108148, 0x2},
-	{OP_WR, 0x108004, 0x1a80},
-	{OP_ZR, 0x109090, 0x24},
-	{OP_ZR, 0x109248, 0x4a},
-	{OP_ZR, 0x109498, 0x4a},
-	{OP_ZR, 0x1096e8, 0x4a},
-/* #define HC_PF7_END          241 */
-/* #define MISC_COMMON_START        264 */
-	{OP_WR, 0xa468, 0xb01c8},
-	{OP_SW, 0xa294, 0x40558},
-	{OP_IF_MODE_AND, 1, 0x80}, /* sf */
-	{OP_WR, 0xa5f8, 0x0},
-	{OP_IF_MODE_AND, 1, 0x100}, /* mf */
-	{OP_WR, 0xa5f8, 0x1},
-/* #define MISC_COMMON_END          265 */
-/* #define MISC_PF0_START        270 */
-	{OP_WR, 0xa270, 0x0},
-/* #define MISC_PF0_END          271 */
-/* #define MISC_PF1_START        272 */
-	{OP_WR, 0xa274, 0x0},
-/* #define MISC_PF1_END          273 */
-/* #define MISC_PF2_START        274 */
-	{OP_WR, 0xa270, 0x0},
-/* #define MISC_PF2_END          275 */
-/* #define MISC_PF3_START        276 */
-	{OP_WR, 0xa274, 0x0},
-/* #define MISC_PF3_END          277 */
-/* #define MISC_PF4_START        278 */
-	{OP_WR, 0xa270, 0x0},
-/* #define MISC_PF4_END          279 */
-/* #define MISC_PF5_START        280 */
-	{OP_WR, 0xa274, 0x0},
-/* #define MISC_PF5_END          281 */
-/* #define MISC_PF6_START        282 */
-	{OP_WR, 0xa270, 0x0},
-/* #define MISC_PF6_END          283 */
-/* #define MISC_PF7_START        284 */
-	{OP_WR, 0xa274, 0x0},
-/* #define MISC_PF7_END          285 */
-/* #define NIG_COMMON_START        286 */
-	{OP_SW, 0x100b4, 0x2055c},
-	{OP_WR, 0x100dc, 0x1},
-	{OP_SW, 0x10100, 0x2055e},
-/* #define NIG_COMMON_END          287 */
-/* #define NIG_PORT0_START        288 */
-	{OP_WR, 0x1007c, 0x300000},
-	{OP_WR, 0x10084, 0x28},
-	{OP_WR, 0x1008c, 0x0},
-	{OP_WR, 0x10130, 0x4},
-	{OP_WR, 0x10328, 0x0},
-	{OP_WR, 0x10554, 0x30},
-	{OP_WR, 0x16058, 0xffff},
-	{OP_WR, 0x16070, 0x7},
-	{OP_WR, 0x16080, 0x1},
-	{OP_WR, 0x100c4, 0x1},
-	{OP_WR, 0x100cc, 0x1},
-	{OP_WR, 0x100f8, 0x1},
-	{OP_WR, 0x100f0, 0x1},
-/* #define NIG_PORT0_END          289 */
-/* #define NIG_PORT1_START        290 */
-	{OP_WR, 0x10080, 0x300000},
-	{OP_WR, 0x10088, 0x28},
-	{OP_WR, 0x10090, 0x0},
-	{OP_WR, 0x10134, 0x4},
-	{OP_WR, 0x1032c, 0x0},
-	{OP_WR, 0x10564, 0x30},
-	{OP_WR, 0x1605c, 0xffff},
-	{OP_WR, 0x16074, 0x7},
-	{OP_WR, 0x16084, 0x1},
-	{OP_WR, 0x100c8, 0x1},
-	{OP_WR, 0x100d0, 0x1},
-	{OP_WR, 0x100fc, 0x1},
-	{OP_WR, 0x100f4, 0x1},
-/* #define NIG_PORT1_END          291 */
-/* #define NIG_PF0_START        292 */
-	{OP_ZR, 0x10138, 0x11},
-/* #define NIG_PF0_END          293 */
-/* #define NIG_PF1_START        294 */
-	{OP_ZR, 0x1017c, 0x11},
-/* #define NIG_PF1_END          295 */
-/* #define NIG_PF2_START        296 */
-	{OP_ZR, 0x10138, 0x11},
-/* #define NIG_PF2_END          297 */
-/* #define NIG_PF3_START        298 */
-	{OP_ZR, 0x1017c, 0x11},
-/* #define NIG_PF3_END          299 */
-/* #define NIG_PF4_START        300 */
-	{OP_ZR, 0x10138, 0x11},
-/* #define NIG_PF4_END          301 */
-/* #define NIG_PF5_START        302 */
-	{OP_ZR, 0x1017c, 0x11},
-/* #define NIG_PF5_END          303 */
-/* #define NIG_PF6_START        304 */
-	{OP_ZR, 0x10138, 0x11},
-/* #define NIG_PF6_END          305 */
-/* #define NIG_PF7_START        306 */
-	{OP_ZR, 0x1017c, 0x11},
-/* #define NIG_PF7_END          307 */
-/* #define PBF_COMMON_START        308 */
-	{OP_WR, 0x140000, 0x1},
-	{OP_WR, 0x14000c, 0x1},
-	{OP_SW, 0x140040, 0x20560},
-	{OP_WR, 0x14000c, 0x0},
-	{OP_WR, 0x140000, 0x0},
-	{OP_WR, 0x14006c, 0x0},
-/* #define PBF_COMMON_END          309 */
-/* #define PBF_PORT0_START        310 */
-	{OP_WR, 0x140004, 0x1},
-	{OP_WR, 0x140030, 0x1},
-	{OP_WR, 0x140004, 0x0},
-	{OP_WR, 0x14005c, 0x0},
-/* #define PBF_PORT0_END          311 */
-/* #define PBF_PORT1_START        312 */
-	{OP_WR, 0x140008, 0x1},
-	{OP_WR, 0x140034, 0x1},
-	{OP_WR, 0x140008, 0x0},
-	{OP_WR, 0x140060, 0x0},
-/* #define PBF_PORT1_END          313 */
-/* #define PRS_COMMON_START        352 */
-	{OP_SW, 0x40004, 0x120562},
-	{OP_WR, 0x40054, 0x43},
-	{OP_WR, 0x4005c, 0x6},
-	{OP_WR, 0x40070, 0x4},
-	{OP_SW, 0x40078, 0x40574},
-	{OP_ZR, 0x40088, 0x5},
-	{OP_SW, 0x4009c, 0x30578},
-	{OP_ZR, 0x400a8, 0x4},
-	{OP_SW, 0x400b8, 0x5057b},
-	{OP_ZR, 0x400cc, 0x4},
-	{OP_SW, 0x400dc, 0x40580},
-	{OP_ZR, 0x400ec, 0x4},
-	{OP_RD, 0x40124, 0x0},
-	{OP_RD, 0x40128, 0x0},
-	{OP_RD, 0x4012c, 0x0},
-	{OP_RD, 0x40130, 0x0},
-	{OP_WR, 0x40134, 0xf},
-	{OP_WR, 0x401d0, 0x8906},
-/* #define PRS_COMMON_END          353 */
-/* #define PXP2_COMMON_START        374 */
-	{OP_WR, 0x1205b0, 0x1},
-	{OP_SW, 0x120490, 0x220584},
-	{OP_SW, 0x12066c, 0x205a6},
-	{OP_WR, 0x120388, 0x64},
-	{OP_WR, 0x120390, 0x8},
-	{OP_SW, 0x12039c, 0x305a8},
-	{OP_SW, 0x1203bc, 0x305ab},
-	{OP_WR, 0x1203d0, 0x0},
-	{OP_WR, 0x12036c, 0x1},
-	{OP_WR, 0x120368, 0x3f},
-	{OP_SW, 0x1201bc, 0x3c05ae},
-	{OP_SW, 0x1202b0, 0x205ea},
-	{OP_SW, 0x120324, 0x205ec},
-	{OP_WR, 0x1205b4, 0x1},
-	{OP_WR, 0x1201b0, 0x1},
-/* #define PXP2_COMMON_END          375 */
-/* #define PXP_COMMON_START        396 */
-	{OP_WB, 0x103800, 0x505ee},
-	{OP_WB, 0x103820, 0x505f3},
-	{OP_WB, 0x103c00, 0x505f8},
-/* #define PXP_COMMON_END          397 */
-/* #define QM_COMMON_START        418 */
-	{OP_SW, 0x168030, 0x805fd},
-	{OP_WR, 0x168054, 0x2},
-	{OP_SW, 0x168060, 0x50605},
-	{OP_ZR, 0x168074, 0x7},
-	{OP_SW, 0x168090, 0x2060a},
-	{OP_SW, 0x16809c, 0x5060c},
-	{OP_ZR, 0x1680b0, 0x7},
-	{OP_SW, 0x1680cc, 0x80611},
-	{OP_WR, 0x1680f0, 0x7},
-	{OP_ZR, 0x1680f4, 0xc},
-	{OP_SW, 0x168124, 0x40619},
-	{OP_ZR, 0x168134, 0xc},
-	{OP_SW, 0x168164, 0x32061d},
-	{OP_SW, 0x168234, 0x7064f},
-	{OP_ZR, 0x168250, 0x4},
-	{OP_SW, 0x168260, 0x20656},
-	{OP_ZR, 0x168268, 0x8},
-	{OP_SW, 0x168288, 0x80658},
-	{OP_ZR, 0x1682a8, 0xa},
-	{OP_WR, 0x168804, 0x4},
-	{OP_SW, 0x16880c, 0x100660},
-	{OP_SW, 0x16e000, 0x100670},
-	{OP_ZR, 0x16e40c, 0xc},
-	{OP_SW, 0x16e43c, 0x40680},
-	{OP_ZR, 0x16e44c, 0xc},
-	{OP_SW, 0x16e47c, 0x2e0684},
-	{OP_ZR, 0x16e534, 0x4},
-	{OP_SW, 0x16e544, 0x206b2},
-	{OP_ZR, 0x16e54c, 0x8},
-	{OP_SW, 0x16e56c, 0x606b4},
-	{OP_SW, 0x16e6bc, 0x806ba},
-	{OP_WR, 0x1680ec, 0xff},
-/* #define QM_COMMON_END          419 */
-/* #define SRC_COMMON_START        440 */
-	{OP_SW, 0x40408, 0x1406c2},
-	{OP_WR, 0x404cc, 0x1},
-/* #define SRC_COMMON_END          441 */
-/* #define TCM_COMMON_START        462 */
-	{OP_SW, 0x50044, 0x206d6},
-	{OP_SW, 0x50050, 0x406d8},
-	{OP_ZR, 0x50060, 0x4},
-	{OP_SW, 0x50090, 0x1306dc},
-	{OP_WR, 0x50114, 0x1},
-	{OP_SW, 0x5011c, 0x206ef},
-	{OP_WR, 0x50204, 0x1},
-	{OP_SW, 0x5020c, 0x206f1},
-	{OP_SW, 0x5021c, 0x306f3},
-	{OP_ZR, 0x50240, 0xa},
-	{OP_SW, 0x50280, 0x2006f6},
-	{OP_ZR, 0x54000, 0xd00},
-	{OP_SW, 0x50004, 0x100716},
-/* #define TCM_COMMON_END          463 */
-/* #define TCM_PF0_START        468 */
-	{OP_WR, 0x500e0, 0xe},
-/* #define TCM_PF0_END          469 */
-/* #define TCM_PF1_START        470 */
-	{OP_WR, 0x500e4, 0x2e},
-/* #define TCM_PF1_END          471 */
-/* #define TCM_PF2_START        472 */
-	{OP_WR, 0x500e0, 0x1e},
-/* #define TCM_PF2_END          473 */
-/* #define TCM_PF3_START        474 */
-	{OP_WR, 0x500e4, 0x3e},
-/* #define TCM_PF3_END          475 */
-/* #define TCM_PF4_START        476 */
-	{OP_WR, 0x500e0, 0x4e},
-/* #define TCM_PF4_END          477 */
-/* #define TCM_PF5_START        478 */
-	{OP_WR, 0x500e4, 0x6e},
-/* #define TCM_PF5_END          479 */
-/* #define TCM_PF6_START        480 */
-	{OP_WR, 0x500e0, 0x5e},
-/* #define TCM_PF6_END          481 */
-/* #define TCM_PF7_START        482 */
-	{OP_WR, 0x500e4, 0x7e},
-/* #define TCM_PF7_END          483 */
-/* #define TM_COMMON_START        484 */
-	{OP_ZR, 0x164024, 0x2},
-	{OP_SW, 0x164030, 0x30726},
-	{OP_WR, 0x164044, 0x20},
-	{OP_WR, 0x164070, 0x1c},
-	{OP_WR, 0x164208, 0x1},
-	{OP_WR, 0x164210, 0x1},
-	{OP_WR, 0x164220, 0x1},
-	{OP_WR, 0x164228, 0x1},
-	{OP_WR, 0x164230, 0x1},
-	{OP_WR, 0x164238, 0x1},
-	{OP_WR, 0x164260, 0x2},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0x16401c, 0x3d090},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x16401c, 0x9c4},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x16401c, 0x9c},
-	{OP_WR, 0x164000, 0x1},
-	{OP_WR, 0x1640d8, 0x1},
-	{OP_SW, 0x164008, 0x30729},
-/* #define TM_COMMON_END          485 */
-/* #define TM_PORT0_START        486 */
-	{OP_WR, 0x164240, 0x0},
-	{OP_WR, 0x164248, 0x0},
-	{OP_WB_ZR, 0x164270, 0x2},
-/* #define TM_PORT0_END          487 */
-/* #define TM_PORT1_START        488 */
-	{OP_WR, 0x164250, 0x0},
-	{OP_WR, 0x164258, 0x0},
-	{OP_WB_ZR, 0x164280, 0x2},
-/* #define TM_PORT1_END          489 */
-/* #define TSDM_COMMON_START        506 */
-	{OP_SW, 0x42008, 0x4072c},
-	{OP_SW, 0x4201c, 0x40730},
-	{OP_WR, 0x42038, 0x20},
-	{OP_ZR, 0x4203c, 0x1f},
-	{OP_WR, 0x420b8, 0x1},
-	{OP_ZR, 0x420bc, 0x5f},
-	{OP_SW, 0x42238, 0x40734},
-	{OP_RD, 0x42248, 0x0},
-	{OP_RD, 0x4224c, 0x0},
-	{OP_RD, 0x42250, 0x0},
-	{OP_RD, 0x42254, 0x0},
-	{OP_RD, 0x42258, 0x0},
-	{OP_RD, 0x4225c, 0x0},
-	{OP_RD, 0x42260, 0x0},
-	{OP_RD, 0x42264, 0x0},
-	{OP_RD, 0x42268, 0x0},
-	{OP_RD, 0x4226c, 0x0},
-	{OP_RD, 0x42270, 0x0},
-	{OP_RD, 0x42274, 0x0},
-	{OP_RD, 0x42278, 0x0},
-	{OP_RD, 0x4227c, 0x0},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0x42000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x42000, 0xa},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x42000, 0x1},
-/* #define TSDM_COMMON_END          507 */
-/* #define TSEM_COMMON_START        528 */
-	{OP_ZP, 0x180400, 0x6e0000},
-	{OP_WR_64, 0x180760, 0x140738},
-	{OP_ZR, 0x1a0000, 0x4000},
-	{OP_ZR, 0x1b2400, 0x40},
-	{OP_SW, 0x1a1ec8, 0x2073a},
-	{OP_SW, 0x1a4040, 0x4073c},
-	{OP_ZR, 0x1a4050, 0x6},
-	{OP_SW, 0x1a4068, 0x20740},
-	{OP_SW, 0x1a52c0, 0x20742},
-	{OP_SW, 0x1a8000, 0x3f90744},
-	{OP_ZR, 0x1a8fe4, 0x7},
-	{OP_SW, 0x1aa080, 0x100b3d},
-	{OP_WR, 0x1b8000, 0x34},
-	{OP_WR, 0x1b8040, 0x18},
-	{OP_WR, 0x1b8080, 0xc},
-	{OP_WR, 0x1b80c0, 0x20},
-	{OP_WR, 0x1b8380, 0x7a120},
-	{OP_WR, 0x1b83c0, 0x1f4},
-	{OP_WR, 0x1b8bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x1}, /* asic */
-	{OP_WR, 0x1b8300, 0x7a120},
-	{OP_WR, 0x1b8340, 0x1f4},
-	{OP_IF_MODE_AND, 2, 0x2}, /* fpga */
-	{OP_WR, 0x1b8300, 0x1388},
-	{OP_WR, 0x1b8340, 0x5},
-	{OP_IF_MODE_AND, 2, 0x4}, /* emul */
-	{OP_WR, 0x1b8300, 0x138},
-	{OP_WR, 0x1b8340, 0x0},
-	{OP_ZP, 0x1c0000, 0x2fbf0000},
-	{OP_ZP, 0x1c8000, 0x33960bf0},
-	{OP_ZP, 0x1d0000, 0x22f518d6},
-	{OP_WR_64, 0x1d50e0, 0x55e40b4d},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x1b1480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x1b1480, 0x0},
-	{OP_RD, 0x180000, 0x0},
-	{OP_RD, 0x180004, 0x0},
-	{OP_RD, 0x180008, 0x0},
-	{OP_RD, 0x18000c, 0x0},
-	{OP_RD, 0x180010, 0x0},
-	{OP_RD, 0x180014, 0x0},
-	{OP_SW, 0x180020, 0x1a0b4f},
-	{OP_SW, 0x1800a4, 0x20b69},
-	{OP_WR, 0x180224, 0x0},
-	{OP_WR, 0x180234, 0x0},
-	{OP_WR, 0x18024c, 0x0},
-	{OP_WR, 0x1802e4, 0xff},
-	{OP_WB_ZR, 0x181000, 0x400},
-/* #define TSEM_COMMON_END          529 */
-/* #define TSEM_PORT0_START        530 */
-	{OP_ZR, 0x1a3000, 0x10},
-	{OP_ZR, 0x1a3080, 0x10},
-	{OP_ZR, 0x1a3100, 0x10},
-	{OP_ZR, 0x1a3180, 0x10},
-	{OP_ZR, 0x1a3300, 0x12},
-	{OP_ZR, 0x1a3390, 0x12},
-	{OP_ZR, 0x1a3420, 0x70},
-	{OP_ZR, 0x1a9000, 0x6},
-/* #define TSEM_PORT0_END          531 */
-/* #define TSEM_PORT1_START        532 */
-	{OP_ZR, 0x1a3040, 0x10},
-	{OP_ZR, 0x1a30c0, 0x10},
-	{OP_ZR, 0x1a3140, 0x10},
-	{OP_ZR, 0x1a31c0, 0x10},
-	{OP_ZR, 0x1a3348, 0x12},
-	{OP_ZR, 0x1a33d8, 0x12},
-	{OP_ZR, 0x1a35e0, 0x70},
-	{OP_ZR, 0x1a9018, 0x6},
-/* #define TSEM_PORT1_END          533 */
-/* #define TSEM_PF0_START        534 */
-	{OP_SW, 0x1a4000, 0x20b6b},
-	{OP_ZR, 0x1a5000, 0x2},
-	{OP_ZR, 0x1a5080, 0x12},
-	{OP_SW, 0x1a6140, 0x20b6d},
-	{OP_ZR, 0x1a9030, 0x2},
-	{OP_ZR, 0x1aa000, 0x2},
-/* #define TSEM_PF0_END          535 */
-/* #define TSEM_PF1_START        536 */
-	{OP_SW, 0x1a4008, 0x20b6f},
-	{OP_ZR, 0x1a5010, 0x2},
-	{OP_ZR, 0x1a50c8, 0x12},
-	{OP_SW, 0x1a6148, 0x20b71},
-	{OP_ZR, 0x1a9038, 0x2},
-	{OP_ZR, 0x1aa008, 0x2},
-/* #define TSEM_PF1_END          537 */
-/* #define TSEM_PF2_START        538 */
-	{OP_SW, 0x1a4010, 0x20b73},
-	{OP_ZR, 0x1a5020, 0x2},
-	{OP_ZR, 0x1a5110, 0x12},
-	{OP_SW, 0x1a6150, 0x20b75},
-	{OP_ZR, 0x1a9040, 0x2},
-	{OP_ZR, 0x1aa010, 0x2},
-/* #define TSEM_PF2_END          539 */
-/* #define TSEM_PF3_START        540 */
-	{OP_SW, 0x1a4018, 0x20b77},
-	{OP_ZR, 0x1a5030, 0x2},
-	{OP_ZR, 0x1a5158, 0x12},
-	{OP_SW, 0x1a6158, 0x20b79},
-	{OP_ZR, 0x1a9048, 0x2},
-	{OP_ZR, 0x1aa018, 0x2},
-/* #define TSEM_PF3_END          541 */
-/* #define TSEM_PF4_START        542 */
-	{OP_SW, 0x1a4020, 0x20b7b},
-	{OP_ZR, 0x1a5040, 0x2},
-	{OP_ZR, 0x1a51a0, 0x12},
-	{OP_SW, 0x1a6160, 0x20b7d},
-	{OP_ZR, 0x1a9050, 0x2},
-	{OP_ZR, 0x1aa020, 0x2},
-/* #define TSEM_PF4_END          543 */
-/* #define TSEM_PF5_START        544 */
-	{OP_SW, 0x1a4028, 0x20b7f},
-	{OP_ZR, 0x1a5050, 0x2},
-	{OP_ZR, 0x1a51e8, 0x12},
-	{OP_SW, 0x1a6168, 0x20b81},
-	{OP_ZR, 0x1a9058, 0x2},
-	{OP_ZR, 0x1aa028, 0x2},
-/* #define TSEM_PF5_END          545 */
-/* #define TSEM_PF6_START        546 */
-	{OP_SW, 0x1a4030, 0x20b83},
-	{OP_ZR, 0x1a5060, 0x2},
-	{OP_ZR, 0x1a5230, 0x12},
-	{OP_SW, 0x1a6170, 0x20b85},
-	{OP_ZR, 0x1a9060, 0x2},
-	{OP_ZR, 0x1aa030, 0x2},
-/* #define TSEM_PF6_END          547 */
-/* #define TSEM_PF7_START        548 */
-	{OP_SW, 0x1a4038, 0x20b87},
-	{OP_ZR, 0x1a5070, 0x2},
-	{OP_ZR, 0x1a5278, 0x12},
-	{OP_SW, 0x1a6178, 0x20b89},
-	{OP_ZR, 0x1a9068, 0x2},
-	{OP_ZR, 0x1aa038, 0x2},
-/* #define TSEM_PF7_END          549 */
-/* #define UCM_COMMON_START        550 */
-	{OP_WR, 0xe004c, 0x32},
-	{OP_SW, 0xe0054, 0x40b8b},
-	{OP_ZR, 0xe0064, 0x4},
-	{OP_SW, 0xe0094, 0x130b8f},
-	{OP_WR, 0xe0144, 0x1},
-	{OP_SW, 0xe014c, 0x20ba2},
-	{OP_WR, 0xe0204, 0x1},
-	{OP_SW, 0xe020c, 0x20ba4},
-	{OP_SW, 0xe021c, 0x40ba6},
-	{OP_SW, 0xe0280, 0x1b0baa},
-	{OP_ZR, 0xe02ec, 0x17},
-	{OP_ZR, 0xe2000, 0x800},
-	{OP_SW, 0xe0004, 0x110bc5},
-/* #define UCM_COMMON_END          551 */
-/* #define UCM_PF0_START        556 */
-	{OP_WR, 0xe0110, 0xf},
-/* #define UCM_PF0_END          557 */
-/* #define UCM_PF1_START        558 */
-	{OP_WR, 0xe0114, 0x2f},
-/* #define UCM_PF1_END          559 */
-/* #define UCM_PF2_START        560 */
-	{OP_WR, 0xe0110, 0x1f},
-/* #define UCM_PF2_END          561 */
-/* #define UCM_PF3_START        562 */
-	{OP_WR, 0xe0114, 0x3f},
-/* #define UCM_PF3_END          563 */
-/* #define UCM_PF4_START        564 */
-	{OP_WR, 0xe0110, 0x4f},
-/* #define UCM_PF4_END          565 */
-/* #define UCM_PF5_START        566 */
-	{OP_WR, 0xe0114, 0x6f},
-/* #define UCM_PF5_END          567 */
-/* #define UCM_PF6_START        568 */
-	{OP_WR, 0xe0110, 0x5f},
-/* #define UCM_PF6_END          569 */
-/* #define UCM_PF7_START        570 */
-	{OP_WR, 0xe0114, 0x7f},
-/* #define UCM_PF7_END          571 */
-/* #define UPB_COMMON_START        572 */
-	{OP_WR, 0xc1000, 0x28},
-/* #define UPB_COMMON_END          573 */
-/* #define USDM_COMMON_START        594 */
-	{OP_SW, 0xc4008, 0x40bd6},
-	{OP_SW, 0xc401c, 0x40bda},
-	{OP_SW, 0xc4038, 0x50bde},
-	{OP_ZR, 0xc404c, 0x5b},
-	{OP_SW, 0xc41b8, 0x50be3},
-	{OP_ZR, 0xc41cc, 0x1b},
-	{OP_SW, 0xc4238, 0x40be8},
-	{OP_RD, 0xc4248, 0x0},
-	{OP_RD, 0xc424c, 0x0},
-	{OP_RD, 0xc4250, 0x0},
-	{OP_RD, 0xc4254, 0x0},
-	{OP_RD, 0xc4258, 0x0},
-	{OP_RD, 0xc425c, 0x0},
-	{OP_RD, 0xc4260, 0x0},
-	{OP_RD, 0xc4264, 0x0},
-	{OP_RD, 0xc4268, 0x0},
-	{OP_RD, 0xc426c, 0x0},
-	{OP_RD, 0xc4270, 0x0},
-	{OP_RD, 0xc4274, 0x0},
-	{OP_RD, 0xc4278, 0x0},
-	{OP_RD, 0xc427c, 0x0},
-	{OP_RD, 0xc4280, 0x0},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0xc4000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0xc4000, 0xa},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0xc4000, 0x1},
-/* #define USDM_COMMON_END          595 */
-/* #define USEM_COMMON_START        616 */
-	{OP_ZP, 0x300400, 0x9d0000},
-	{OP_WR_64, 0x300768, 0x130bec},
-	{OP_ZR, 0x320000, 0x4000},
-	{OP_ZR, 0x332400, 0x40},
-	{OP_ZR, 0x323e80, 0x10},
-	{OP_SW, 0x323ec0, 0x20bee},
-	{OP_SW, 0x3274c0, 0x80bf0},
-	{OP_SW, 0x328500, 0x100bf8},
-	{OP_WR, 0x338000, 0x1a},
-	{OP_WR, 0x338040, 0x4e},
-	{OP_WR, 0x338080, 0x10},
-	{OP_WR, 0x3380c0, 0x20},
-	{OP_WR, 0x338380, 0x7a120},
-	{OP_WR, 0x3383c0, 0x1f4},
-	{OP_WR, 0x338bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x1}, /* asic */
-	{OP_WR, 0x338300, 0x7a120},
-	{OP_WR, 0x338340, 0x1f4},
-	{OP_IF_MODE_AND, 2, 0x2}, /* fpga */
-	{OP_WR, 0x338300, 0x1388},
-	{OP_WR, 0x338340, 0x5},
-	{OP_IF_MODE_AND, 2, 0x4}, /* emul */
-	{OP_WR, 0x338300, 0x138},
-	{OP_WR, 0x338340, 0x0},
-	{OP_ZP, 0x340000, 0x366b0000},
-	{OP_ZP, 0x348000, 0x31070d9b},
-	{OP_ZP, 0x350000, 0x35bc19dd},
-	{OP_WR_64, 0x357b30, 0x509a0c08},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x331480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x331480, 0x0},
-	{OP_RD, 0x300000, 0x0},
-	{OP_RD, 0x300004, 0x0},
-	{OP_RD, 0x300008, 0x0},
-	{OP_RD, 0x30000c, 0x0},
-	{OP_RD, 0x300010, 0x0},
-	{OP_RD, 0x300014, 0x0},
-	{OP_SW, 0x300020, 0x1a0c0a},
-	{OP_SW, 0x3000a4, 0x20c24},
-	{OP_WR, 0x300224, 0x0},
-	{OP_WR, 0x300234, 0x0},
-	{OP_WR, 0x30024c, 0x0},
-	{OP_WR, 0x3002e4, 0xffff},
-	{OP_WB_ZR, 0x302000, 0x800},
-/* #define USEM_COMMON_END          617 */
-/* #define USEM_PORT0_START        618 */
-	{OP_ZR, 0x321000, 0x1c0},
-	{OP_ZR, 0x321e00, 0x38},
-	{OP_ZR, 0x323000, 0x1c0},
-	{OP_ZR, 0x325000, 0x20},
-	{OP_ZR, 0x325100, 0x20},
-	{OP_ZR, 0x325200, 0x20},
-	{OP_ZR, 0x325300, 0x20},
-	{OP_ZR, 0x325400, 0x20},
-	{OP_ZR, 0x325500, 0x20},
-	{OP_ZR, 0x325600, 0x20},
-	{OP_ZR, 0x325700, 0x20},
-	{OP_ZR, 0x325800, 0x20},
-	{OP_ZR, 0x325900, 0x20},
-	{OP_ZR, 0x325a00, 0x20},
-	{OP_ZR, 0x325b00, 0x20},
-	{OP_ZR, 0x325c00, 0x20},
-	{OP_ZR, 0x325d00, 0x20},
-	{OP_ZR, 0x325e00, 0x20},
-	{OP_ZR, 0x325f00, 0x20},
-	{OP_ZR, 0x328450, 0x2},
-	{OP_SW, 0x328460, 0x40c26},
-/* #define USEM_PORT0_END          619 */
-/* #define USEM_PORT1_START        620 */
-	{OP_ZR, 0x321700, 0x1c0},
-	{OP_ZR, 0x321ee0, 0x38},
-	{OP_ZR, 0x323700, 0x1c0},
-	{OP_ZR, 0x325080, 0x20},
-	{OP_ZR, 0x325180, 0x20},
-	{OP_ZR, 0x325280, 0x20},
-	{OP_ZR, 0x325380, 0x20},
-	{OP_ZR, 0x325480, 0x20},
-	{OP_ZR, 0x325580, 0x20},
-	{OP_ZR, 0x325680, 0x20},
-	{OP_ZR, 0x325780, 0x20},
-	{OP_ZR, 0x325880, 0x20},
-	{OP_ZR, 0x325980, 0x20},
-	{OP_ZR, 0x325a80, 0x20},
-	{OP_ZR, 0x325b80, 0x20},
-	{OP_ZR, 0x325c80, 0x20},
-	{OP_ZR, 0x325d80, 0x20},
-	{OP_ZR, 0x325e80, 0x20},
-	{OP_ZR, 0x325f80, 0x20},
-	{OP_ZR, 0x328458, 0x2},
-	{OP_SW, 0x328470, 0x40c2a},
-/* #define USEM_PORT1_END          621 */
-/* #define USEM_PF0_START        622 */
-	{OP_ZR, 0x324010, 0x2},
-	{OP_ZR, 0x328410, 0x2},
-/* #define USEM_PF0_END          623 */
-/* #define USEM_PF1_START        624 */
-	{OP_ZR, 0x324020, 0x2},
-	{OP_ZR, 0x328418, 0x2},
-/* #define USEM_PF1_END          625 */
-/* #define USEM_PF2_START        626 */
-	{OP_ZR, 0x324030, 0x2},
-	{OP_ZR, 0x328420, 0x2},
-/* #define USEM_PF2_END          627 */
-/* #define USEM_PF3_START        628 */
-	{OP_ZR, 0x324040, 0x2},
-	{OP_ZR, 0x328428, 0x2},
-/* #define USEM_PF3_END          629 */
-/* #define USEM_PF4_START        630 */
-	{OP_ZR, 0x324050, 0x2},
-	{OP_ZR, 0x328430, 0x2},
-/* #define USEM_PF4_END          631 */
-/* #define USEM_PF5_START        632 */
-	{OP_ZR, 0x324060, 0x2},
-	{OP_ZR, 0x328438, 0x2},
-/* #define USEM_PF5_END          633 */
-/* #define USEM_PF6_START        634 */
-	{OP_ZR, 0x324070, 0x2},
-	{OP_ZR, 0x328440, 0x2},
-/* #define USEM_PF6_END          635 */
-/* #define USEM_PF7_START        636 */
-	{OP_ZR, 0x324080, 0x2},
-	{OP_ZR, 0x328448, 0x2},
-/* #define USEM_PF7_END          637 */
-/* #define XCM_COMMON_START        638 */
-	{OP_WR, 0x20058, 0x32},
-	{OP_SW, 0x20060, 0x40c2e},
-	{OP_ZR, 0x20070, 0x4},
-	{OP_SW, 0x200a0, 0xe0c32},
-	{OP_SW, 0x200dc, 0x70c40},
-	{OP_WR, 0x200fc, 0x6},
-	{OP_WR, 0x20120, 0x0},
-	{OP_WR, 0x20134, 0x2},
-	{OP_WR, 0x201b0, 0x1},
-	{OP_WR, 0x2020c, 0x1},
-	{OP_SW, 0x20214, 0x20c47},
-	{OP_WR, 0x20404, 0x1},
-	{OP_SW, 0x2040c, 0x20c49},
-	{OP_SW, 0x2041c, 0x40c4b},
-	{OP_SW, 0x20480, 0x200c4f},
-	{OP_ZR, 0x20500, 0x12},
-	{OP_ZR, 0x28000, 0x2000},
-	{OP_SW, 0x20004, 0x140c6f},
-/* #define XCM_COMMON_END          639 */
-/* #define XCM_PF0_START        644 */
-	{OP_WR, 0x20108, 0xc8},
-	{OP_WR, 0x20118, 0x2},
-	{OP_WR, 0x201c4, 0x0},
-	{OP_WR, 0x201cc, 0x0},
-	{OP_WR, 0x201d4, 0x2},
-	{OP_WR, 0x201dc, 0x2},
-	{OP_WR, 0x201e4, 0xff},
-	{OP_WR, 0x201ec, 0xff},
-/* #define XCM_PF0_END          645 */
-/* #define XCM_PF1_START        646 */
-	{OP_WR, 0x2010c, 0xc8},
-	{OP_WR, 0x2011c, 0x2},
-	{OP_WR, 0x201c8, 0x0},
-	{OP_WR, 0x201d0, 0x0},
-	{OP_WR, 0x201d8, 0x2},
-	{OP_WR, 0x201e0, 0x2},
-	{OP_WR, 0x201e8, 0xff},
-	{OP_WR, 0x201f0, 0xff},
-/* #define XCM_PF1_END          647 */
-/* #define XCM_PF2_START        648 */
-	{OP_WR, 0x20108, 0xc8},
-	{OP_WR, 0x20118, 0x2},
-	{OP_WR, 0x201c4, 0x0},
-	{OP_WR, 0x201cc, 0x0},
-	{OP_WR, 0x201d4, 0x2},
-	{OP_WR, 0x201dc, 0x2},
-	{OP_WR, 0x201e4, 0xff},
-	{OP_WR, 0x201ec, 0xff},
-/* #define XCM_PF2_END          649 */
-/* #define XCM_PF3_START        650 */
-	{OP_WR, 0x2010c, 0xc8},
-	{OP_WR, 0x2011c, 0x2},
-	{OP_WR, 0x201c8, 0x0},
-	{OP_WR, 0x201d0, 0x0},
-	{OP_WR, 0x201d8, 0x2},
-	{OP_WR, 0x201e0, 0x2},
-	{OP_WR, 0x201e8, 0xff},
-	{OP_WR, 0x201f0, 0xff},
-/* #define XCM_PF3_END          651 */
-/* #define XCM_PF4_START        652 */
-	{OP_WR, 0x20108, 0xc8},
-	{OP_WR, 0x20118, 0x2},
-	{OP_WR, 0x201c4, 0x0},
-	{OP_WR, 0x201cc, 0x0},
-	{OP_WR, 0x201d4, 0x2},
-	{OP_WR, 0x201dc, 0x2},
-	{OP_WR, 0x201e4, 0xff},
-	{OP_WR, 0x201ec, 0xff},
-/* #define XCM_PF4_END          653 */
-/* #define XCM_PF5_START        654 */
-	{OP_WR, 0x2010c, 0xc8},
-	{OP_WR, 0x2011c, 0x2},
-	{OP_WR, 0x201c8, 0x0},
-	{OP_WR, 0x201d0, 0x0},
-	{OP_WR, 0x201d8, 0x2},
-	{OP_WR, 0x201e0, 0x2},
-	{OP_WR, 0x201e8, 0xff},
-	{OP_WR, 0x201f0, 0xff},
-/* #define XCM_PF5_END          655 */
-/* #define XCM_PF6_START        656 */
-	{OP_WR, 0x20108, 0xc8},
-	{OP_WR, 0x20118, 0x2},
-	{OP_WR, 0x201c4, 0x0},
-	{OP_WR, 0x201cc, 0x0},
-	{OP_WR, 0x201d4, 0x2},
-	{OP_WR, 0x201dc, 0x2},
-	{OP_WR, 0x201e4, 0xff},
-	{OP_WR, 0x201ec, 0xff},
-/* #define XCM_PF6_END          657 */
-/* #define XCM_PF7_START        658 */
-	{OP_WR, 0x2010c, 0xc8},
-	{OP_WR, 0x2011c, 0x2},
-	{OP_WR, 0x201c8, 0x0},
-	{OP_WR, 0x201d0, 0x0},
-	{OP_WR, 0x201d8, 0x2},
-	{OP_WR, 0x201e0, 0x2},
-	{OP_WR, 0x201e8, 0xff},
-	{OP_WR, 0x201f0, 0xff},
-/* #define XCM_PF7_END          659 */
-/* #define XPB_COMMON_START        660 */
-	{OP_WR, 0x161000, 0x28},
-/* #define XPB_COMMON_END          661 */
-/* #define XSDM_COMMON_START        682 */
-	{OP_SW, 0x166008, 0x30c83},
-	{OP_SW, 0x16601c, 0x40c86},
-	{OP_SW, 0x166038, 0xd0c8a},
-	{OP_ZR, 0x16606c, 0x13},
-	{OP_SW, 0x1660b8, 0x20c97},
-	{OP_ZR, 0x1660c0, 0x3e},
-	{OP_WR, 0x1661b8, 0x1},
-	{OP_ZR, 0x1661bc, 0x1f},
-	{OP_SW, 0x166238, 0x40c99},
-	{OP_RD, 0x166248, 0x0},
-	{OP_RD, 0x16624c, 0x0},
-	{OP_RD, 0x166250, 0x0},
-	{OP_RD, 0x166254, 0x0},
-	{OP_RD, 0x166258, 0x0},
-	{OP_RD, 0x16625c, 0x0},
-	{OP_RD, 0x166260, 0x0},
-	{OP_RD, 0x166264, 0x0},
-	{OP_RD, 0x166268, 0x0},
-	{OP_RD, 0x16626c, 0x0},
-	{OP_RD, 0x166270, 0x0},
-	{OP_RD, 0x166274, 0x0},
-	{OP_RD, 0x166278, 0x0},
-	{OP_RD, 0x16627c, 0x0},
-	{OP_IF_MODE_AND, 1, 0x1}, /* asic */
-	{OP_WR, 0x166000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x166000, 0xa},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x166000, 0x1},
-/* #define XSDM_COMMON_END          683 */
-/* #define XSEM_COMMON_START        704 */
-	{OP_ZP, 0x280400, 0x890000},
-	{OP_WR_64, 0x280768, 0x130c9d},
-	{OP_ZR, 0x2a0000, 0x4000},
-	{OP_ZR, 0x2b2400, 0x40},
-	{OP_SW, 0x2a3000, 0x20c9f},
-	{OP_SW, 0x2a4000, 0x100ca1},
-	{OP_SW, 0x2a8408, 0x80cb1},
-	{OP_SW, 0x2a93c8, 0x40cb9},
-	{OP_SW, 0x2a96f0, 0x20cbd},
-	{OP_ZR, 0x2a96f8, 0x6},
-	{OP_SW, 0x2a9940, 0x20cbf},
-	{OP_WR, 0x2a9a28, 0x1},
-	{OP_SW, 0x2ac0c0, 0x100cc1},
-	{OP_WR, 0x2b8000, 0x0},
-	{OP_WR, 0x2b8040, 0x18},
-	{OP_WR, 0x2b8080, 0xc},
-	{OP_WR, 0x2b80c0, 0x66},
-	{OP_WR, 0x2b8380, 0x7a120},
-	{OP_WR, 0x2b83c0, 0x1f4},
-	{OP_WR, 0x2b8bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x1}, /* asic */
-	{OP_WR, 0x2b8300, 0x7a120},
-	{OP_WR, 0x2b8340, 0x1f4},
-	{OP_IF_MODE_AND, 2, 0x2}, /* fpga */
-	{OP_WR, 0x2b8300, 0x1388},
-	{OP_WR, 0x2b8340, 0x5},
-	{OP_IF_MODE_AND, 2, 0x4}, /* emul */
-	{OP_WR, 0x2b8300, 0x138},
-	{OP_WR, 0x2b8340, 0x0},
-	{OP_IF_MODE_AND, 1, 0x20}, /* port2 */
-	{OP_WR, 0x2a9a2c, 0x0},
-	{OP_ZP, 0x2c0000, 0x37700000},
-	{OP_ZP, 0x2c8000, 0x39a40ddc},
-	{OP_ZP, 0x2d0000, 0x3b351c45},
-	{OP_ZP, 0x2d8000, 0x1ad82b13},
-	{OP_WR_64, 0x2db790, 0x490e0cd1},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x2b1480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x2b1480, 0x0},
-	{OP_RD, 0x280000, 0x0},
-	{OP_RD, 0x280004, 0x0},
-	{OP_RD, 0x280008, 0x0},
-	{OP_RD, 0x28000c, 0x0},
-	{OP_RD, 0x280010, 0x0},
-	{OP_RD, 0x280014, 0x0},
-	{OP_SW, 0x280020, 0x1a0cd3},
-	{OP_SW, 0x2800a4, 0x20ced},
-	{OP_WR, 0x280224, 0x0},
-	{OP_WR, 0x280234, 0x0},
-	{OP_WR, 0x28024c, 0x0},
-	{OP_WR, 0x2802e4, 0xffff},
-	{OP_WB_ZR, 0x282000, 0x800},
-/* #define XSEM_COMMON_END          705 */
-/* #define XSEM_PORT0_START        706 */
-	{OP_ZR, 0x2a5000, 0x2},
-	{OP_ZR, 0x2a5010, 0x2},
-	{OP_ZR, 0x2a5020, 0x2},
-	{OP_ZR, 0x2a5030, 0x2},
-	{OP_ZR, 0x2a93e0, 0x20},
-	{OP_ZR, 0x2a94e0, 0xe},
-	{OP_SW, 0x2a9518, 0x20cef},
-	{OP_ZR, 0x2a9560, 0xe},
-	{OP_SW, 0x2a9598, 0x20cf1},
-	{OP_ZR, 0x2a95e0, 0xe},
-	{OP_SW, 0x2a9618, 0x20cf3},
-	{OP_ZR, 0x2a9660, 0xe},
-	{OP_SW, 0x2a9698, 0x20cf5},
-	{OP_SW, 0x2a9710, 0x20cf7},
-/* #define XSEM_PORT0_END          707 */
-/* #define XSEM_PORT1_START        708 */
-	{OP_ZR, 0x2a5008, 0x2},
-	{OP_ZR, 0x2a5018, 0x2},
-	{OP_ZR, 0x2a5028, 0x2},
-	{OP_ZR, 0x2a5038, 0x2},
-	{OP_ZR, 0x2a9460, 0x20},
-	{OP_ZR, 0x2a9520, 0xe},
-	{OP_SW, 0x2a9558, 0x20cf9},
-	{OP_ZR, 0x2a95a0, 0xe},
-	{OP_SW, 0x2a95d8, 0x20cfb},
-	{OP_ZR, 0x2a9620, 0xe},
-	{OP_SW, 0x2a9658, 0x20cfd},
-	{OP_ZR, 0x2a96a0, 0xe},
-	{OP_SW, 0x2a96d8, 0x20cff},
-	{OP_SW, 0x2a9718, 0x20d01},
-/* #define XSEM_PORT1_END          709 */
-/* #define XSEM_PF0_START        710 */
-	{OP_ZR, 0x2a5048, 0xe},
-	{OP_SW, 0x2a9720, 0x100d03},
-	{OP_ZR, 0x2a9950, 0x2},
-	{OP_ZR, 0x2ac000, 0x2},
-/* #define XSEM_PF0_END          711 */
-/* #define XSEM_PF1_START        712 */
-	{OP_ZR, 0x2a5080, 0xe},
-	{OP_SW, 0x2a9760, 0x100d13},
-	{OP_ZR, 0x2a9958, 0x2},
-	{OP_ZR, 0x2ac008, 0x2},
-/* #define XSEM_PF1_END          713 */
-/* #define XSEM_PF2_START        714 */
-	{OP_ZR, 0x2a50b8, 0xe},
-	{OP_SW, 0x2a97a0, 0x100d23},
-	{OP_ZR, 0x2a9960, 0x2},
-	{OP_ZR, 0x2ac010, 0x2},
-/* #define XSEM_PF2_END          715 */
-/* #define XSEM_PF3_START        716 */
-	{OP_ZR, 0x2a50f0, 0xe},
-	{OP_SW, 0x2a97e0, 0x100d33},
-	{OP_ZR, 0x2a9968, 0x2},
-	{OP_ZR, 0x2ac018, 0x2},
-/* #define XSEM_PF3_END          717 */
-/* #define XSEM_PF4_START        718 */
-	{OP_ZR, 0x2a5128, 0xe},
-	{OP_SW, 0x2a9820, 0x100d43},
-	{OP_ZR, 0x2a9970, 0x2},
-	{OP_ZR, 0x2ac020, 0x2},
-/* #define XSEM_PF4_END          719 */
-/* #define XSEM_PF5_START        720 */
-	{OP_ZR, 0x2a5160, 0xe},
-	{OP_SW, 0x2a9860, 0x100d53},
-	{OP_ZR, 0x2a9978, 0x2},
-	{OP_ZR, 0x2ac028, 0x2},
-/* #define XSEM_PF5_END          721 */
-/* #define XSEM_PF6_START        722 */
-	{OP_ZR, 0x2a5198, 0xe},
-	{OP_SW, 0x2a98a0, 0x100d63},
-	{OP_ZR, 0x2a9980, 0x2},
-	{OP_ZR, 0x2ac030, 0x2},
-/* #define XSEM_PF6_END          723 */
-/* #define XSEM_PF7_START        724 */
-	{OP_ZR, 0x2a51d0, 0xe},
-	{OP_SW, 0x2a98e0, 0x100d73},
-	{OP_ZR, 0x2a9988, 0x2},
-	{OP_ZR, 0x2ac038, 0x2},
-/* #define XSEM_PF7_END          725 */
-/* #define MISC_AEU_COMMON_START        726 */
-	{OP_ZR, 0xa000, 0xc},
-	{OP_ZR, 0xa050, 0x2},
-	{OP_SW, 0xa0ec, 0x80d83},
-	{OP_SW, 0xa18c, 0x80d8b},
-	{OP_WR, 0xa45c, 0xc00},
-	{OP_WR, 0xa61c, 0x3},
-/* #define MISC_AEU_COMMON_END          727 */
-/* #define MISC_AEU_PORT0_START        728 */
-	{OP_SW, 0xa06c, 0x60d93},
-	{OP_ZR, 0xa084, 0x5},
-	{OP_WR, 0xa098, 0xfe00000},
-	{OP_ZR, 0xa09c, 0x7},
-	{OP_SW, 0xa0b8, 0xd0d99},
-	{OP_ZR, 0xa22c, 0x4},
-/* #define MISC_AEU_PORT0_END          729 */
-/* #define MISC_AEU_PORT1_START        730 */
-	{OP_SW, 0xa10c, 0x60da6},
-	{OP_ZR, 0xa124, 0x5},
-	{OP_WR, 0xa138, 0xfe00000},
-	{OP_ZR, 0xa13c, 0x7},
-	{OP_SW, 0xa158, 0xd0dac},
-	{OP_ZR, 0xa23c, 0x4},
-/* #define MISC_AEU_PORT1_END          731 */
-/* #define MISC_AEU_PF0_START        732 */
-	{OP_WR, 0xa030, 0x0},
-/* #define MISC_AEU_PF0_END          733 */
-/* #define MISC_AEU_PF1_START        734 */
-	{OP_WR, 0xa034, 0x0},
-/* #define MISC_AEU_PF1_END          735 */
-/* #define MISC_AEU_PF2_START        736 */
-	{OP_WR, 0xa038, 0x0},
-/* #define MISC_AEU_PF2_END          737 */
-/* #define MISC_AEU_PF3_START        738 */
-	{OP_WR, 0xa03c, 0x0},
-/* #define MISC_AEU_PF3_END          739 */
-/* #define MISC_AEU_PF4_START        740 */
-	{OP_WR, 0xa040, 0x0},
-/* #define MISC_AEU_PF4_END          741 */
-/* #define MISC_AEU_PF5_START        742 */
-	{OP_WR, 0xa044, 0x0},
-/* #define MISC_AEU_PF5_END          743 */
-/* #define MISC_AEU_PF6_START        744 */
-	{OP_WR, 0xa048, 0x0},
-/* #define MISC_AEU_PF6_END          745 */
-/* #define MISC_AEU_PF7_START        746 */
-	{OP_WR, 0xa04c, 0x0},
-/* #define MISC_AEU_PF7_END          747 */
-};
+static const u8 init_ops_zipped_e1h[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0xed, 0x99, 
+	0x5f, 0x6c, 0x5c, 0x47, 0x15, 0xc6, 0xcf, 0x9d, 0x3b, 0x77, 0x77, 0xc9, 
+	0xde, 0x75, 0x6e, 0x1c, 0x6b, 0xbb, 0xac, 0x93, 0x76, 0xd9, 0x58, 0x68, 
+	0x59, 0xa7, 0x65, 0xeb, 0x75, 0xe8, 0x02, 0xa1, 0x5d, 0x96, 0x00, 0x6e, 
+	0x31, 0xc4, 0x6e, 0xd3, 0xb2, 0xa5, 0x6e, 0xbb, 0x09, 0x06, 0xb9, 0x60, 
+	0xe8, 0x22, 0x82, 0x08, 0x6a, 0x80, 0x9b, 0xd4, 0x40, 0x4a, 0x5b, 0x11, 
+	0xda, 0xd4, 0x75, 0xa1, 0x80, 0x13, 0x85, 0x2a, 0x82, 0x0a, 0x05, 0x54, 
+	0x44, 0x40, 0x41, 0x18, 0x54, 0x24, 0x27, 0x71, 0xfe, 0x20, 0x50, 0x65, 
+	0xa1, 0x80, 0x2c, 0x91, 0xa2, 0x08, 0x05, 0x08, 0x6a, 0x81, 0x20, 0x8a, 
+	0xc2, 0x37, 0x33, 0x9f, 0x03, 0xb5, 0x78, 0xe1, 0x85, 0xbc, 0xf0, 0xd0, 
+	0xfe, 0xfc, 0x9d, 0x39, 0x67, 0xe6, 0xde, 0xb9, 0xb3, 0x73, 0xe6, 0x4c, 
+	0x54, 0x42, 0x4e, 0x8b, 0x88, 0xe7, 0x27, 0x22, 0x51, 0xe6, 0x8f, 0x84, 
+	0xcc, 0x03, 0xe2, 0x27, 0xa0, 0x7c, 0x25, 0xca, 0xb5, 0x1b, 0xfb, 0x21, 
+	0x72, 0xd6, 0x50, 0x25, 0xbc, 0x71, 0xea, 0xc3, 0xe4, 0x1c, 0xed, 0x6d, 
+	0xcb, 0x8c, 0x6c, 0x00, 0xfa, 0xfc, 0x8c, 0x0c, 0x8a, 0x56, 0xbe, 0xce, 
+	0xc8, 0x08, 0xb4, 0x86, 0x7e, 0x48, 0x56, 0xa8, 0xa4, 0xca, 0x78, 0x23, 
+	0x76, 0xdc, 0x8c, 0x37, 0x2a, 0x4a, 0xe5, 0x54, 0x46, 0x69, 0xa7, 0x55, 
+	0x88, 0x71, 0xf3, 0x60, 0x01, 0xf6, 0xd5, 0x3a, 0xa3, 0x62, 0xd8, 0x3b, 
+	0xfd, 0x8c, 0x2f, 0x92, 0x53, 0x57, 0xe9, 0x8c, 0xdf, 0x82, 0x0e, 0x75, 
+	0xa6, 0x0e, 0x2c, 0x13, 0xf4, 0xa7, 0x65, 0xb9, 0xba, 0x0e, 0xfd, 0x75, 
+	0xc1, 0x90, 0x01, 0x73, 0xe0, 0xd5, 0xd4, 0xab, 0xa9, 0xdf, 0x44, 0xfd, 
+	0x4e, 0xea, 0x0f, 0x51, 0xdf, 0x49, 0xfd, 0x49, 0x3f, 0x8a, 0xcc, 0xfb, 
+	0xbe, 0x4d, 0x45, 0xd1, 0x90, 0x79, 0x8e, 0x64, 0xb4, 0x42, 0x24, 0x52, 
+	0x37, 0xa6, 0xa2, 0x15, 0x66, 0xa0, 0x14, 0x74, 0x0b, 0xfa, 0x76, 0xe8, 
+	0x69, 0xe8, 0x5c, 0x32, 0xca, 0x61, 0xbe, 0xd4, 0x3d, 0x3a, 0x1a, 0x34, 
+	0xee, 0xa2, 0xa2, 0x7a, 0x49, 0x4c, 0x44, 0x54, 0xc7, 0x7b, 0xdf, 0x70, 
+	0x11, 0x6c, 0x0a, 0x2c, 0xe0, 0x84, 0x4c, 0x3c, 0x72, 0x93, 0xd5, 0x66, 
+	0x5e, 0xc3, 0x42, 0x4a, 0x7c, 0x7d, 0x0f, 0xb8, 0x4a, 0xb4, 0x1e, 0x07, 
+	0x6b, 0xb2, 0x42, 0xb7, 0x75, 0x58, 0xd8, 0x8e, 0xe6, 0x8d, 0x7e, 0xf8, 
+	0xaa, 0x43, 0xd0, 0x3b, 0x74, 0xf8, 0xaa, 0x97, 0xa0, 0x97, 0xfb, 0x61, 
+	0xb1, 0x06, 0xbf, 0x47, 0xbc, 0xb0, 0x38, 0x60, 0xe7, 0x39, 0x2c, 0x0e, 
+	0x92, 0x43, 0xe4, 0x26, 0xb2, 0x49, 0x8e, 0x90, 0x2d, 0x72, 0x94, 0x1c, 
+	0x23, 0xc7, 0xc9, 0x36, 0xb9, 0x95, 0xdc, 0x46, 0x9a, 0xe7, 0xc0, 0xcc, 
+	0xe2, 0xa5, 0xf0, 0x9f, 0x0a, 0x0b, 0xe6, 0xa9, 0xcf, 0x52, 0x2b, 0xa7, 
+	0x65, 0x19, 0xb5, 0xa6, 0xf6, 0x82, 0x02, 0x3e, 0xdf, 0x67, 0x45, 0x12, 
+	0x85, 0x64, 0x2c, 0x91, 0x9e, 0xd4, 0x45, 0x63, 0xae, 0x8b, 0x5e, 0xd3, 
+	0x63, 0xff, 0xf0, 0x8b, 0x9d, 0x43, 0xb0, 0x4f, 0xe9, 0xe2, 0xb7, 0xcd, 
+	0x7c, 0x16, 0x74, 0xd1, 0x2e, 0xa3, 0x84, 0x5f, 0x9c, 0xcd, 0xe1, 0xfd, 
+	0x0e, 0x40, 0x9b, 0xf9, 0x0b, 0xa1, 0x9b, 0xd0, 0x4f, 0x43, 0x8f, 0x51, 
+	0x4f, 0x41, 0x1f, 0x84, 0x3e, 0x40, 0x3d, 0x0f, 0xfd, 0x0c, 0xf4, 0x59, 
+	0xa7, 0x8f, 0x98, 0xf8, 0x43, 0xba, 0x78, 0x84, 0xf1, 0x47, 0x4c, 0xfc, 
+	0x61, 0x68, 0xc6, 0x1f, 0x31, 0xf1, 0x33, 0xd0, 0x8c, 0x3f, 0x62, 0xe2, 
+	0x9f, 0x85, 0x66, 0xfc, 0x51, 0x13, 0x3f, 0xab, 0x8b, 0x47, 0x19, 0x7f, 
+	0xd4, 0xc4, 0xcf, 0x41, 0x33, 0xfe, 0xa8, 0x89, 0x3f, 0x05, 0xcd, 0xf8, 
+	0xa3, 0x26, 0xfe, 0x17, 0xd0, 0x8c, 0x3f, 0x66, 0xe2, 0xe7, 0x75, 0xf1, 
+	0x18, 0xe3, 0x8f, 0x99, 0xf8, 0xd3, 0xd0, 0x8c, 0x3f, 0x66, 0xe2, 0x17, 
+	0xa0, 0x19, 0x7f, 0xcc, 0xc4, 0x9f, 0x81, 0x66, 0xfc, 0x9c, 0x89, 0x3f, 
+	0xab, 0x8b, 0x73, 0x8c, 0x9f, 0x33, 0xf1, 0xe7, 0xa0, 0x19, 0x3f, 0x67, 
+	0xe2, 0xcf, 0x43, 0x33, 0x7e, 0xce, 0xc4, 0xbf, 0x08, 0xcd, 0xf8, 0xe3, 
+	0x26, 0xfe, 0x82, 0x2e, 0x1e, 0x67, 0xfc, 0x71, 0x13, 0xff, 0x12, 0x34, 
+	0xe3, 0x8f, 0x23, 0x3e, 0x10, 0x68, 0xc6, 0x1f, 0x47, 0x7c, 0xa0, 0xa1, 
+	0x19, 0x7f, 0x02, 0xf1, 0x41, 0x4a, 0x17, 0x4f, 0x30, 0xfe, 0x04, 0xe2, 
+	0x83, 0x10, 0x9a, 0xf1, 0x27, 0x4c, 0x7c, 0x04, 0xcd, 0xf8, 0x13, 0x26, 
+	0xbe, 0x0b, 0x9a, 0xf1, 0x27, 0x4d, 0x7c, 0x4e, 0x17, 0x4f, 0x32, 0xfe, 
+	0xa4, 0x89, 0x5f, 0x05, 0xcd, 0xf8, 0x93, 0x26, 0x1e, 0xdf, 0xfb, 0x24, 
+	0xe3, 0x4f, 0x9a, 0xf8, 0x1e, 0x68, 0x13, 0x9f, 0x50, 0x6b, 0xcc, 0xcf, 
+	0x1b, 0xbf, 0x9b, 0x35, 0xb1, 0x59, 0x17, 0x9d, 0xa0, 0x31, 0x54, 0xc0, 
+	0x19, 0xb0, 0x43, 0xad, 0xb9, 0x3f, 0x96, 0xe4, 0xde, 0x02, 0x08, 0xed, 
+	0xbd, 0xa8, 0xd6, 0x3c, 0x68, 0xec, 0x1e, 0xd6, 0x9f, 0xdd, 0xae, 0x60, 
+	0x17, 0xb6, 0xd7, 0x4d, 0x3b, 0xed, 0xca, 0xda, 0x65, 0xe5, 0x2e, 0x67, 
+	0x97, 0x80, 0x76, 0xed, 0xec, 0x5e, 0x8d, 0x76, 0x09, 0xb0, 0x3c, 0xab, 
+	0x35, 0x43, 0x2c, 0xdb, 0xbe, 0xf0, 0x44, 0xa2, 0xe7, 0xab, 0xed, 0x0f, 
+	0x4c, 0x05, 0xa5, 0x4b, 0xeb, 0x7d, 0x4d, 0x57, 0xfc, 0x6f, 0xbf, 0x07, 
+	0xbd, 0xa8, 0x3d, 0xbb, 0xec, 0x2d, 0x35, 0x99, 0x22, 0x43, 0x32, 0x22, 
+	0xbb, 0xec, 0xef, 0xbe, 0x20, 0x05, 0xc9, 0x07, 0x65, 0x70, 0xbf, 0xa8, 
+	0x60, 0x83, 0x2a, 0x28, 0xfb, 0xc3, 0x00, 0xfb, 0xc9, 0x41, 0xf2, 0x8c, 
+	0xc8, 0xc5, 0x8b, 0xa9, 0x82, 0x19, 0x20, 0x85, 0xef, 0xb6, 0xc2, 0xf4, 
+	0xab, 0x74, 0xb1, 0x73, 0xb7, 0x99, 0x2f, 0x5d, 0x74, 0xee, 0xba, 0xd8, 
+	0x32, 0xcf, 0x5f, 0xd1, 0xc5, 0x87, 0xec, 0xfc, 0xc1, 0x2f, 0xa2, 0xdf, 
+	0x01, 0xfa, 0x31, 0x6e, 0xb3, 0xd0, 0xaf, 0x4e, 0xbf, 0x1c, 0xfd, 0x66, 
+	0xe8, 0xc7, 0xb8, 0xcd, 0x33, 0xf4, 0x8b, 0xe9, 0x57, 0xa0, 0xdf, 0x3c, 
+	0xfd, 0x18, 0xb7, 0x25, 0xa6, 0xdf, 0x0c, 0xfd, 0x4a, 0xf4, 0x3b, 0x4f, 
+	0x3f, 0xc6, 0xbd, 0x97, 0xcf, 0xf7, 0xf0, 0xe2, 0xf3, 0x55, 0x9c, 0x7d, 
+	0x65, 0x8a, 0x7e, 0x8c, 0x1b, 0xe5, 0xf3, 0x3d, 0xbc, 0xf8, 0x7c, 0x35, 
+	0xfa, 0x15, 0xe8, 0xc7, 0xb8, 0x51, 0x3e, 0xdf, 0xc3, 0x8b, 0xcf, 0x57, 
+	0xa7, 0x5f, 0x8d, 0x7e, 0x8c, 0x7b, 0x1f, 0x9f, 0xef, 0x61, 0xf7, 0x7c, 
+	0x91, 0x9d, 0xe6, 0x05, 0x3f, 0xc2, 0x7e, 0xab, 0x02, 0xec, 0xef, 0x05, 
+	0x63, 0x57, 0xd0, 0x1a, 0x7a, 0x40, 0x5d, 0x61, 0xbf, 0x9b, 0x02, 0xd7, 
+	0x9a, 0xcf, 0xe4, 0x5f, 0x21, 0x35, 0xd8, 0x6f, 0x02, 0x07, 0x24, 0x08, 
+	0x06, 0xc1, 0x16, 0x38, 0x0c, 0x6e, 0x83, 0xfd, 0x36, 0xf8, 0x99, 0xef, 
+	0xbd, 0x5c, 0x45, 0xf6, 0x31, 0x62, 0x1d, 0xd9, 0x75, 0xab, 0xa0, 0x9f, 
+	0xb6, 0x1f, 0x26, 0x8a, 0x6b, 0x2e, 0x0f, 0xec, 0xb0, 0xeb, 0x43, 0x47, 
+	0x3b, 0x0a, 0x6c, 0xc7, 0x38, 0xea, 0xbb, 0x60, 0xe4, 0xfc, 0x76, 0xa4, 
+	0xc4, 0xbb, 0x78, 0x51, 0x47, 0x3b, 0x8d, 0xbc, 0x09, 0x7e, 0x8b, 0xfd, 
+	0x00, 0x79, 0xf4, 0x6b, 0x3e, 0xb7, 0xf4, 0xe8, 0xe8, 0x8b, 0x05, 0xd7, 
+	0xfe, 0x68, 0xdb, 0xf1, 0x31, 0xf3, 0xfc, 0xc8, 0x27, 0xb1, 0xe6, 0xf8, 
+	0x03, 0x8c, 0x3b, 0x68, 0x7f, 0x0f, 0x51, 0xbc, 0x9e, 0xe3, 0x6b, 0x8e, 
+	0x5f, 0x62, 0x7b, 0xc8, 0xf1, 0xbb, 0x38, 0x7e, 0xe8, 0xc6, 0x9f, 0x58, 
+	0x1c, 0x7f, 0xb1, 0x1f, 0xcd, 0xf1, 0x77, 0xbb, 0xf1, 0x1f, 0x19, 0x70, 
+	0xed, 0x7b, 0xa6, 0x1c, 0x27, 0xcf, 0x72, 0xfc, 0xff, 0xf4, 0xfe, 0xea, 
+	0x32, 0xbf, 0xbf, 0x7f, 0x99, 0xdf, 0x5f, 0x5f, 0xe6, 0xf7, 0x0f, 0x2e, 
+	0xf3, 0xfb, 0x27, 0x2e, 0xf3, 0xfb, 0x27, 0xff, 0x67, 0xef, 0x2f, 0xfb, 
+	0xc7, 0x24, 0xed, 0xcd, 0xfa, 0xb2, 0x6f, 0x0f, 0xf2, 0x59, 0x93, 0xf9, 
+	0x21, 0x56, 0xf2, 0xf5, 0x0b, 0xff, 0xca, 0x17, 0x38, 0x17, 0x3a, 0xed, 
+	0x29, 0xd9, 0xe7, 0xce, 0xc5, 0xb2, 0x6f, 0x2b, 0xf9, 0x5f, 0x69, 0xdf, 
+	0x93, 0x67, 0xb0, 0xff, 0x8c, 0x28, 0x8f, 0xe7, 0x75, 0x0f, 0xdd, 0xab, 
+	0xe0, 0x2e, 0xe8, 0xed, 0x82, 0x1d, 0x12, 0x34, 0x2f, 0x52, 0x02, 0x6d, 
+	0x42, 0x50, 0x9e, 0x57, 0xb1, 0xeb, 0xd1, 0xf3, 0x4b, 0x4e, 0x07, 0x9b, 
+	0x6c, 0x5e, 0xf5, 0x5a, 0x4d, 0x93, 0x5f, 0xc0, 0xb6, 0x9d, 0x2f, 0xaf, 
+	0x15, 0xdb, 0xe7, 0xf3, 0xe4, 0x59, 0x72, 0x8e, 0xbc, 0x40, 0x9e, 0x27, 
+	0x63, 0x8e, 0xb3, 0x8b, 0xe3, 0xec, 0xe6, 0x38, 0xfd, 0x1c, 0x67, 0x2d, 
+	0xc7, 0x19, 0xe5, 0x38, 0x23, 0x1c, 0x67, 0x2b, 0xc7, 0x99, 0x60, 0x3f, 
+	0xb3, 0xe4, 0x29, 0xf2, 0x25, 0xf2, 0x45, 0x43, 0xed, 0x79, 0x66, 0xfd, 
+	0xac, 0x00, 0xb7, 0x93, 0xff, 0x95, 0x56, 0x5d, 0x2e, 0x2d, 0x83, 0xa1, 
+	0x9d, 0xa7, 0x2e, 0x1c, 0x42, 0x55, 0xd0, 0xa2, 0x16, 0xb6, 0x1b, 0x8e, 
+	0x93, 0x9a, 0xfe, 0x15, 0x52, 0xd3, 0x3e, 0x42, 0xa6, 0x68, 0xef, 0x27, 
+	0x53, 0xb4, 0xdb, 0xf3, 0xb5, 0xaf, 0xe1, 0xdf, 0x19, 0x6c, 0x41, 0xf5, 
+	0x62, 0xe6, 0xf7, 0x2d, 0xe0, 0x88, 0xfd, 0x1d, 0x68, 0x69, 0xdb, 0x7a, 
+	0x47, 0x23, 0x6f, 0xe8, 0x60, 0xab, 0xd6, 0x76, 0xde, 0x02, 0xe8, 0x27, 
+	0xc5, 0x0f, 0xb6, 0x41, 0x1f, 0x60, 0xfb, 0x21, 0xe4, 0x97, 0xfb, 0xa0, 
+	0xe7, 0xa8, 0x4f, 0xc3, 0x3f, 0x86, 0x3e, 0x67, 0x34, 0x26, 0xc4, 0x26, 
+	0x30, 0xb0, 0x44, 0xae, 0x25, 0x2b, 0xee, 0x20, 0x60, 0xe7, 0x7f, 0x39, 
+	0x88, 0xf9, 0x7c, 0x20, 0xa1, 0x3a, 0x03, 0x9b, 0x07, 0xfc, 0x4e, 0xbd, 
+	0x5b, 0x8a, 0xc1, 0x84, 0xdf, 0x99, 0x18, 0xc7, 0xfb, 0x3f, 0xa5, 0x3a, 
+	0x7d, 0x33, 0xfe, 0x28, 0x68, 0xbe, 0x5b, 0xca, 0xef, 0xf4, 0xcd, 0x73, 
+	0x1c, 0x00, 0x0f, 0x83, 0xdf, 0x84, 0xfd, 0x94, 0xed, 0xaf, 0xd3, 0x1f, 
+	0xb7, 0xef, 0xd9, 0xe9, 0x9b, 0xf3, 0xdb, 0x0d, 0x7e, 0xa7, 0x77, 0x58, 
+	0xd6, 0x07, 0xdf, 0xf2, 0x3b, 0xd5, 0x41, 0xf4, 0xf3, 0x3b, 0xf8, 0xf7, 
+	0x80, 0xe7, 0x30, 0xce, 0x33, 0xce, 0xcf, 0x3b, 0xe8, 0xea, 0x25, 0x73, 
+	0x88, 0x0a, 0xfe, 0x00, 0x16, 0xc0, 0x17, 0x92, 0xd1, 0x7a, 0xa3, 0x2f, 
+	0xf8, 0xd9, 0xb8, 0x22, 0xa9, 0xe0, 0x1f, 0x2a, 0x1b, 0x6f, 0xb2, 0x79, 
+	0x37, 0x1b, 0x23, 0x9f, 0x26, 0x02, 0x9d, 0x8d, 0xed, 0xba, 0x80, 0xde, 
+	0x8d, 0xa2, 0x71, 0x19, 0xf8, 0x24, 0xec, 0x21, 0xec, 0x07, 0x69, 0x9f, 
+	0x93, 0x54, 0x62, 0x05, 0xe2, 0xcc, 0xfa, 0x4b, 0xc2, 0xfe, 0xa2, 0x3d, 
+	0x3f, 0x66, 0x77, 0xf4, 0x88, 0x4e, 0xbc, 0x52, 0x67, 0x77, 0xf4, 0x53, 
+	0x8f, 0x4a, 0x5f, 0x62, 0xb5, 0x9f, 0xdd, 0xd9, 0x2f, 0xc9, 0xc4, 0x46, 
+	0x9d, 0xdd, 0x39, 0x64, 0xe7, 0x31, 0xbb, 0xb3, 0x85, 0x7e, 0x6f, 0x83, 
+	0x1e, 0xb3, 0xef, 0x9b, 0xdd, 0xb9, 0x0b, 0xfd, 0x35, 0xa1, 0xcd, 0xbc, 
+	0x2f, 0x53, 0xd9, 0x5d, 0xda, 0xf9, 0xed, 0x0a, 0x25, 0x4a, 0xb4, 0xfc, 
+	0xec, 0x02, 0x76, 0x8d, 0x44, 0x5b, 0x67, 0xcf, 0x84, 0xae, 0xdf, 0x33, 
+	0xeb, 0x31, 0x4e, 0x0c, 0x3d, 0x48, 0xbd, 0x5d, 0xae, 0x49, 0x4c, 0xe8, 
+	0xec, 0xf3, 0xfd, 0x2e, 0xee, 0xf9, 0x0d, 0xe8, 0xff, 0x3b, 0xd0, 0x83, 
+	0xae, 0xff, 0xe7, 0xc7, 0x25, 0x91, 0x78, 0xc6, 0xcf, 0xfe, 0xf6, 0x30, 
+	0xc6, 0xf9, 0x01, 0x9e, 0xdb, 0x7c, 0xbf, 0x8b, 0xbe, 0xd6, 0x29, 0xe9, 
+	0x4a, 0xfc, 0x44, 0xa1, 0xa6, 0xb0, 0xdf, 0x25, 0x10, 0x13, 0xf7, 0x1c, 
+	0x38, 0x84, 0xfe, 0xe7, 0x71, 0x34, 0x6f, 0xd9, 0xfe, 0x02, 0xfc, 0x9e, 
+	0x56, 0x26, 0x4e, 0xab, 0xc0, 0xd6, 0xa5, 0xf0, 0xf3, 0x70, 0x5e, 0x49, 
+	0xfc, 0x51, 0x05, 0xac, 0x8b, 0x03, 0xd4, 0xc5, 0x2a, 0xf1, 0x27, 0x70, 
+	0x15, 0x8a, 0xf3, 0x17, 0x74, 0xa0, 0x6c, 0x01, 0x0c, 0x1d, 0x4b, 0x21, 
+	0xf1, 0x17, 0x1d, 0x18, 0x99, 0xc1, 0xa7, 0xc4, 0x7a, 0x8c, 0x92, 0x59, 
+	0x15, 0xc8, 0x82, 0x3d, 0x3f, 0x07, 0x82, 0xf3, 0xa4, 0x5c, 0x43, 0x7d, 
+	0x25, 0xf5, 0xf5, 0xd4, 0xef, 0xa2, 0xfe, 0x30, 0xf5, 0x5d, 0xd4, 0x9f, 
+	0xd2, 0xd9, 0x7a, 0x8f, 0xfb, 0x5e, 0xf5, 0x8a, 0xf8, 0xc9, 0x57, 0xab, 
+	0xac, 0xa9, 0x6b, 0xa5, 0x00, 0x9a, 0x75, 0xbd, 0x4a, 0x65, 0x1b, 0xee, 
+	0x77, 0x91, 0x6d, 0x44, 0x64, 0x81, 0x2c, 0x91, 0x15, 0xb2, 0x46, 0x9a, 
+	0xf7, 0x54, 0x97, 0xea, 0xca, 0x6c, 0x1d, 0xef, 0x71, 0x6a, 0xf7, 0xa5, 
+	0x73, 0xb6, 0xd1, 0xf2, 0x8a, 0x67, 0x2f, 0x9d, 0xb3, 0xad, 0x96, 0x27, 
+	0x41, 0xa1, 0xff, 0xbc, 0x9d, 0x87, 0x6c, 0x1d, 0xf5, 0x73, 0xf2, 0x35, 
+	0xe8, 0xcf, 0x36, 0x80, 0xb6, 0x2e, 0x4e, 0x65, 0x1b, 0x6d, 0xd7, 0x4f, 
+	0x63, 0x88, 0xf6, 0x26, 0xed, 0xb1, 0x7d, 0x0f, 0x8d, 0xba, 0x5b, 0x27, 
+	0xd7, 0x82, 0xa8, 0xbb, 0x93, 0x15, 0xa5, 0x0b, 0x35, 0x5b, 0x87, 0xea, 
+	0x82, 0xc9, 0x17, 0x57, 0x41, 0x1f, 0xb2, 0x3f, 0x2b, 0x5d, 0x30, 0xf7, 
+	0x19, 0x77, 0xfb, 0xda, 0xd4, 0xdd, 0xc9, 0x7e, 0x4f, 0xb3, 0xee, 0xd6, 
+	0xac, 0xbb, 0x35, 0xeb, 0x6e, 0xcd, 0xba, 0x5b, 0xb3, 0xee, 0xd6, 0xac, 
+	0xbb, 0x35, 0xeb, 0x6e, 0x1e, 0x6c, 0xc1, 0x31, 0x72, 0x9c, 0x6c, 0x93, 
+	0x5b, 0xc9, 0x6d, 0xe4, 0xcb, 0xeb, 0x6e, 0xbd, 0xa4, 0xee, 0xd6, 0x4b, 
+	0xea, 0x6e, 0xcd, 0xba, 0x3b, 0x87, 0xe5, 0xf1, 0x61, 0x6c, 0x38, 0xb9, 
+	0x64, 0x4b, 0xba, 0x92, 0x35, 0x9d, 0x67, 0xdd, 0xdd, 0xcd, 0xba, 0x3b, 
+	0x7f, 0xe5, 0xac, 0xa8, 0xe4, 0x1b, 0xfc, 0x7c, 0x1d, 0xc6, 0xe4, 0x7a, 
+	0x9d, 0xaf, 0x0f, 0xd9, 0xba, 0x3b, 0x5f, 0x1f, 0x83, 0x1d, 0xed, 0x37, 
+	0xcf, 0x80, 0x0d, 0x3f, 0x1f, 0x8b, 0xff, 0xb7, 0xe4, 0x06, 0x9d, 0xff, 
+	0xc2, 0x19, 0xfb, 0xfb, 0xcb, 0x4f, 0xa3, 0x20, 0x4a, 0xbf, 0x49, 0x75, 
+	0xdb, 0x72, 0xa7, 0x1f, 0x34, 0xf3, 0x9d, 0x03, 0x8d, 0x21, 0x04, 0x67, 
+	0xec, 0x7a, 0xe8, 0x66, 0x7d, 0xd6, 0xcd, 0xfa, 0xac, 0x7b, 0x49, 0x7d, 
+	0xd6, 0xcd, 0xfa, 0xac, 0x7b, 0x49, 0x7d, 0xd6, 0xcd, 0xfa, 0xac, 0x7b, 
+	0x49, 0x7d, 0xd6, 0xcd, 0xfa, 0xac, 0x9b, 0xf5, 0x19, 0x56, 0xc1, 0x6b, 
+	0x7f, 0x64, 0x18, 0x4b, 0x75, 0x32, 0x7d, 0x3e, 0x58, 0x2d, 0x52, 0xfc, 
+	0x73, 0xee, 0xb9, 0xc4, 0xea, 0xa1, 0x85, 0x5b, 0xcf, 0xa4, 0xdf, 0x79, 
+	0x69, 0x7e, 0xba, 0x97, 0xd4, 0x69, 0xd4, 0xf6, 0x76, 0xc7, 0x51, 0x93, 
+	0x29, 0x32, 0x24, 0x23, 0xd2, 0xd5, 0x69, 0x39, 0x53, 0xa7, 0xa5, 0x37, 
+	0x82, 0xa8, 0xd3, 0xd2, 0xf7, 0xa8, 0x1c, 0xeb, 0xb4, 0x1c, 0xeb, 0xb4, 
+	0x1c, 0xeb, 0xb4, 0x9c, 0xa9, 0xd3, 0xe4, 0x62, 0x2a, 0x67, 0xc2, 0x91, 
+	0x04, 0xf2, 0x15, 0x57, 0xe7, 0xe4, 0x2b, 0xae, 0x3e, 0xc9, 0x5f, 0x4b, 
+	0x7d, 0x2d, 0x75, 0xd5, 0xe8, 0x4e, 0x70, 0xb7, 0xa3, 0xad, 0x93, 0xda, 
+	0x3a, 0x6f, 0xd3, 0x68, 0x02, 0x71, 0x75, 0xc6, 0xcf, 0x30, 0x8e, 0xfa, 
+	0x5a, 0xea, 0xea, 0x00, 0xe3, 0xe7, 0x1d, 0xd7, 0x2d, 0x30, 0x3e, 0xc7, 
+	0xef, 0x89, 0x87, 0x4a, 0x7f, 0x50, 0xe7, 0xdd, 0xf2, 0x07, 0xdd, 0xbd, 
+	0x59, 0x7e, 0x33, 0xf2, 0x5f, 0xfa, 0x43, 0xf0, 0x73, 0x75, 0x54, 0x7e, 
+	0xda, 0xb6, 0xc3, 0x3f, 0x05, 0xfb, 0xbd, 0xf0, 0x8b, 0xe8, 0x3f, 0x4b, 
+	0xff, 0x01, 0xd8, 0x3f, 0x02, 0xff, 0x1a, 0xfd, 0x53, 0xf4, 0x8f, 0x60, 
+	0xff, 0x28, 0xfc, 0x5c, 0x7d, 0x97, 0x1f, 0x8e, 0xe8, 0x3f, 0x04, 0xfb, 
+	0xc7, 0xe0, 0x5f, 0xa7, 0x7f, 0x44, 0xff, 0x1c, 0xec, 0x1f, 0x87, 0x3f, 
+	0xc7, 0x1d, 0x6e, 0xd2, 0xbf, 0x09, 0xfb, 0x27, 0xe0, 0x3f, 0x40, 0xff, 
+	0x1c, 0xfd, 0x0b, 0xb0, 0xdf, 0x07, 0x7f, 0xf6, 0x33, 0x3c, 0x4d, 0x7f, 
+	0xec, 0xe3, 0xe9, 0x4f, 0xc2, 0x7f, 0x88, 0xfe, 0x05, 0xfa, 0x97, 0x60, 
+	0xff, 0x34, 0xfc, 0x69, 0x1f, 0x3e, 0x4b, 0x7f, 0xac, 0xeb, 0xf4, 0x0e, 
+	0xf8, 0x37, 0xe9, 0x5f, 0xa2, 0x7f, 0x05, 0xf6, 0xfb, 0xe1, 0xdf, 0x72, 
+	0xf6, 0x9b, 0x2b, 0xf4, 0x6f, 0xc3, 0xfe, 0x19, 0xf8, 0xd3, 0x3e, 0x5d, 
+	0xa1, 0x3f, 0xea, 0xc0, 0xf4, 0xe7, 0xe0, 0xdf, 0xa6, 0xff, 0x36, 0xfa, 
+	0xa3, 0x0e, 0x4c, 0x3f, 0x00, 0xff, 0x31, 0xfa, 0xdb, 0x79, 0x52, 0x1d, 
+	0x32, 0x68, 0xef, 0x3b, 0x3b, 0x70, 0x0e, 0xd0, 0xe9, 0x07, 0x75, 0x87, 
+	0x8c, 0xda, 0x7d, 0xbd, 0x43, 0xf6, 0xc8, 0xca, 0xf4, 0x17, 0x54, 0x87, 
+	0xb7, 0xc1, 0xee, 0x5f, 0x1d, 0xde, 0x20, 0xe2, 0xf7, 0xa9, 0x0e, 0xee, 
+	0xeb, 0x1d, 0x66, 0x5f, 0x4f, 0xef, 0x07, 0xb1, 0x2f, 0xa5, 0x9f, 0x02, 
+	0x63, 0xe9, 0x4e, 0x7f, 0x43, 0x77, 0x28, 0x93, 0x3f, 0xae, 0xd0, 0x1d, 
+	0xee, 0x1e, 0x00, 0xfd, 0x68, 0x59, 0x91, 0xfe, 0x29, 0xfa, 0x89, 0x6c, 
+	0xbe, 0xef, 0xb0, 0x79, 0xe2, 0xb5, 0xd4, 0x57, 0x51, 0xdf, 0x40, 0xbd, 
+	0x91, 0xfa, 0x5e, 0xea, 0xbb, 0xa9, 0x3f, 0xad, 0x42, 0xbb, 0xdc, 0x4b, 
+	0x7e, 0x88, 0xef, 0xaf, 0xd3, 0xcf, 0x81, 0x66, 0xdc, 0x5f, 0x82, 0x35, 
+	0x09, 0xd2, 0xbf, 0xd6, 0x61, 0xdd, 0xbc, 0xc7, 0x1d, 0x7e, 0xf8, 0x66, 
+	0x9c, 0x4b, 0xd2, 0xbf, 0xd1, 0xe1, 0x9b, 0x4d, 0xde, 0xea, 0xf6, 0x43, 
+	0xec, 0xe3, 0x3a, 0x7d, 0xd6, 0x0b, 0x1b, 0xbc, 0x87, 0x6c, 0xf0, 0x1e, 
+	0xb2, 0xc1, 0x7b, 0xc8, 0x06, 0xef, 0x21, 0x1b, 0xbc, 0x87, 0x6c, 0xf0, 
+	0x1e, 0xb2, 0xc1, 0x7b, 0xc8, 0x06, 0xef, 0x21, 0x1b, 0xbc, 0x87, 0x6c, 
+	0xf0, 0x1e, 0xb2, 0xc1, 0x7b, 0xc8, 0x06, 0xef, 0x21, 0x1b, 0xbc, 0x87, 
+	0x6c, 0x6c, 0x27, 0xe3, 0x97, 0xdf, 0x47, 0xd6, 0x97, 0xdc, 0x47, 0xd6, 
+	0x97, 0xdc, 0x47, 0xba, 0x7c, 0x11, 0x54, 0x30, 0xbd, 0x5f, 0xc1, 0x0f, 
+	0xa3, 0x92, 0x1c, 0xc3, 0xfc, 0x9f, 0xd3, 0x7d, 0xdc, 0x17, 0xab, 0x6e, 
+	0x5f, 0xd4, 0x7d, 0xd7, 0xdb, 0xdf, 0xa5, 0xdf, 0x77, 0x3d, 0xf6, 0xbf, 
+	0xf4, 0x1f, 0xfc, 0xbe, 0xad, 0x33, 0x92, 0x4a, 0x9f, 0xf7, 0xfb, 0x3e, 
+	0x03, 0x6b, 0xfa, 0x82, 0xaa, 0xda, 0x61, 0xf3, 0x60, 0xdd, 0xe6, 0xc9, 
+	0xaa, 0xdd, 0xf7, 0x22, 0xd0, 0xed, 0x7b, 0x55, 0xee, 0x7b, 0x55, 0xee, 
+	0x7b, 0xd5, 0x25, 0xfb, 0x5e, 0x95, 0xfb, 0x5e, 0x75, 0xc9, 0xbe, 0x57, 
+	0xe5, 0xbe, 0x57, 0x5d, 0xb2, 0xef, 0x55, 0xb9, 0xef, 0x55, 0xb9, 0xef, 
+	0x61, 0xb7, 0x79, 0xdd, 0x07, 0x0d, 0x63, 0xb9, 0x36, 0x99, 0xf9, 0x72, 
+	0xb0, 0x4e, 0x64, 0xdd, 0xe1, 0x57, 0xfe, 0x2a, 0xb1, 0xee, 0xbe, 0xca, 
+	0xd0, 0x97, 0xc2, 0xd4, 0xa5, 0xf7, 0xaf, 0x2e, 0xd9, 0xf7, 0xa8, 0xdd, 
+	0xe9, 0xd0, 0x52, 0x93, 0x29, 0x32, 0x24, 0x23, 0xd2, 0xed, 0x7b, 0x15, 
+	0xb3, 0xef, 0x85, 0xcb, 0x40, 0xec, 0x7b, 0x61, 0x8f, 0xaa, 0x70, 0xdf, 
+	0xab, 0x70, 0xdf, 0xab, 0x70, 0xdf, 0xab, 0xf0, 0x7e, 0xaa, 0xc2, 0xfb, 
+	0xa9, 0x3e, 0x9b, 0xfe, 0x67, 0x74, 0xdf, 0x95, 0xa6, 0xb9, 0xa6, 0xfb, 
+	0x2a, 0xd4, 0x76, 0x59, 0x14, 0x74, 0xdf, 0x30, 0x79, 0x33, 0x79, 0x0b, 
+	0xb9, 0x89, 0xbc, 0x95, 0xbc, 0x8d, 0x7c, 0x37, 0xd9, 0x24, 0x6f, 0x27, 
+	0xdf, 0x43, 0xde, 0x41, 0x8e, 0x90, 0x77, 0x92, 0x77, 0x91, 0x77, 0x93, 
+	0x13, 0x76, 0x5f, 0xf0, 0xfb, 0x26, 0x5a, 0xa2, 0xc3, 0x57, 0xeb, 0xbe, 
+	0x2b, 0x16, 0x9f, 0x73, 0xc1, 0x3d, 0xe7, 0x75, 0x8b, 0xcf, 0x19, 0xf3, 
+	0x39, 0xc9, 0x9b, 0xc9, 0x5b, 0xc8, 0x4d, 0xe4, 0xad, 0xe4, 0x6d, 0xe4, 
+	0xbb, 0xc9, 0x26, 0x79, 0x3b, 0xf9, 0x1e, 0xf2, 0x0e, 0x72, 0x84, 0xbc, 
+	0x93, 0xbc, 0x8b, 0xbc, 0x9b, 0x9c, 0x68, 0xf2, 0x39, 0xdb, 0x78, 0xce, 
+	0xb2, 0xee, 0xab, 0xbb, 0xfd, 0xb8, 0x6f, 0x82, 0xac, 0x17, 0xa8, 0x73, 
+	0xd4, 0x15, 0x6a, 0xda, 0xeb, 0x75, 0xea, 0x12, 0xf5, 0x10, 0x35, 0xfd, 
+	0xea, 0x2d, 0xea, 0x1a, 0x75, 0x9b, 0x9a, 0x71, 0xf5, 0x98, 0xda, 0xd5, 
+	0xbf, 0x4a, 0x9a, 0x76, 0x1f, 0x53, 0x62, 0xe6, 0xed, 0x1a, 0xad, 0x58, 
+	0xc7, 0x28, 0x99, 0x96, 0x8e, 0xd0, 0xd8, 0x4f, 0x4b, 0x32, 0xac, 0xc3, 
+	0xef, 0x25, 0x5b, 0xe7, 0x28, 0x77, 0x13, 0x0a, 0xf6, 0xbb, 0x78, 0x57, 
+	0x0f, 0xe0, 0x0f, 0x57, 0x7f, 0x29, 0x54, 0x4a, 0x2a, 0x7c, 0x3b, 0x0e, 
+	0x30, 0x6e, 0xbf, 0x53, 0x1a, 0xfb, 0x5d, 0x78, 0x23, 0x88, 0x7d, 0x27, 
+	0x7c, 0x07, 0x88, 0xf3, 0x6b, 0xb8, 0x51, 0xe3, 0xe0, 0x69, 0xf3, 0x9a, 
+	0xfd, 0xe7, 0x9e, 0x82, 0xf9, 0xa7, 0x27, 0x2d, 0x5d, 0xe1, 0xbd, 0xe8, 
+	0xcf, 0xac, 0xdb, 0x59, 0x30, 0xc7, 0xfe, 0x9f, 0xe5, 0x78, 0x73, 0xe4, 
+	0x2f, 0x68, 0x3f, 0x4d, 0xda, 0xbc, 0x0c, 0x9e, 0x23, 0x43, 0xc6, 0xaf, 
+	0x62, 0xfb, 0x2c, 0xe3, 0x4e, 0x91, 0xf3, 0xb4, 0x2f, 0x90, 0x67, 0x19, 
+	0x77, 0x9e, 0xfc, 0xff, 0xf8, 0x97, 0x73, 0xfc, 0x2c, 0xf3, 0x55, 0xb6, 
+	0x85, 0x24, 0x18, 0xde, 0x0f, 0x9a, 0x75, 0xf3, 0x59, 0xb0, 0x26, 0x99, 
+	0xf0, 0xf3, 0x3a, 0xdb, 0x32, 0x79, 0x64, 0x25, 0xf4, 0x21, 0xac, 0xab, 
+	0xc7, 0xa1, 0x67, 0x6c, 0x7d, 0x93, 0xdd, 0xec, 0xce, 0xf3, 0xd9, 0xcd, 
+	0xe6, 0x3c, 0x7f, 0x95, 0x9f, 0xdd, 0x82, 0xfc, 0x15, 0x3e, 0xe1, 0x65, 
+	0xb7, 0xb8, 0xfc, 0x95, 0xdd, 0x32, 0x48, 0x0e, 0x91, 0x9b, 0xc8, 0x26, 
+	0x39, 0x42, 0xb6, 0xc8, 0x51, 0x72, 0x8c, 0x1c, 0x27, 0xdb, 0xe4, 0x56, 
+	0x72, 0x1b, 0xf9, 0xf2, 0xf3, 0x7c, 0xb6, 0xf5, 0xf2, 0xbc, 0x65, 0xf5, 
+	0xbf, 0xe5, 0x2d, 0xa7, 0xbd, 0xa0, 0x84, 0x9f, 0xc9, 0x03, 0xf8, 0x61, 
+	0x95, 0x4c, 0xde, 0x0a, 0xbf, 0xa2, 0xcb, 0xcc, 0x5b, 0xbd, 0x3c, 0xcf, 
+	0x97, 0xcd, 0x25, 0x4c, 0xf8, 0x35, 0xbf, 0x8c, 0x9f, 0x6f, 0x14, 0xee, 
+	0xf5, 0xcb, 0x13, 0x29, 0x49, 0x85, 0xdf, 0xf6, 0xcb, 0x8f, 0xce, 0xe2, 
+	0xfd, 0xbe, 0xef, 0x97, 0x27, 0xcf, 0xa3, 0xfd, 0x87, 0xba, 0x3c, 0x79, 
+	0xc1, 0x9e, 0x0b, 0xcb, 0x4f, 0xe0, 0xfc, 0x17, 0xfe, 0x48, 0x95, 0xbf, 
+	0x64, 0xeb, 0x32, 0xbf, 0x3c, 0x33, 0x83, 0xb8, 0x1f, 0xab, 0xde, 0xd8, 
+	0xdd, 0x83, 0xf4, 0xf2, 0x5c, 0xdf, 0xcb, 0x73, 0x7d, 0xaf, 0xcd, 0x6f, 
+	0xef, 0x57, 0xbd, 0xcc, 0x6f, 0xbd, 0xcc, 0x6f, 0xbd, 0x4b, 0xf2, 0x5b, 
+	0x2f, 0xf3, 0x5b, 0xef, 0x92, 0xfc, 0xd6, 0xcb, 0xfc, 0xd6, 0xbb, 0x24, 
+	0xbf, 0xf5, 0x32, 0xbf, 0x39, 0xfb, 0xe2, 0xbc, 0x14, 0xf0, 0x5c, 0xf6, 
+	0x3e, 0x23, 0xc0, 0xff, 0xaf, 0x6b, 0x1b, 0xc6, 0xf2, 0xfa, 0xfd, 0x99, 
+	0xd3, 0xc1, 0xd5, 0x22, 0x6f, 0x5c, 0xb7, 0xea, 0xad, 0xc1, 0xd5, 0xb1, 
+	0xe4, 0xe7, 0x7b, 0x57, 0x26, 0xae, 0xfe, 0xde, 0xee, 0x1b, 0x3b, 0xc2, 
+	0x9f, 0x5d, 0x9a, 0xbf, 0xde, 0x25, 0x79, 0x8f, 0xda, 0xdd, 0x92, 0x58, 
+	0x6a, 0x32, 0x45, 0x86, 0x64, 0x44, 0xba, 0xbc, 0x57, 0xb2, 0x79, 0xef, 
+	0xe7, 0xa0, 0xc9, 0x7b, 0xbf, 0x57, 0x25, 0xe6, 0xbd, 0x12, 0xf3, 0x5e, 
+	0x89, 0x79, 0xaf, 0xc4, 0xbc, 0x57, 0x62, 0xde, 0x2b, 0xf3, 0x9c, 0x5d, 
+	0xe6, 0xf9, 0xb9, 0xcc, 0x73, 0x71, 0x99, 0xe7, 0xdd, 0xf2, 0xa3, 0x0b, 
+	0x76, 0x7f, 0x2f, 0xef, 0xb1, 0x75, 0xb8, 0x5f, 0x7e, 0x0c, 0xe7, 0xe1, 
+	0xf0, 0x8f, 0xba, 0xfc, 0x58, 0x8b, 0x7a, 0x0a, 0xfa, 0x4f, 0xd0, 0x6c, 
+	0x9f, 0x34, 0xed, 0x2f, 0xe0, 0xbb, 0xb1, 0x7d, 0xd2, 0xb4, 0xff, 0xd9, 
+	0x2f, 0x3f, 0x8e, 0x73, 0x77, 0xf8, 0x57, 0xf4, 0x9b, 0x62, 0xff, 0x39, 
+	0xb2, 0x44, 0xba, 0x7d, 0xbd, 0xbc, 0xa7, 0xe5, 0xc6, 0x7b, 0xac, 0xc0, 
+	0xfe, 0x71, 0xce, 0x0e, 0xff, 0x06, 0x3d, 0x4d, 0x3d, 0x0f, 0xfd, 0x77, 
+	0xf4, 0xcf, 0xf6, 0x49, 0xd3, 0xfe, 0x0f, 0x68, 0xb6, 0x4f, 0x9a, 0xf6, 
+	0x8b, 0x18, 0x0f, 0xcf, 0x91, 0xf1, 0xd0, 0xef, 0x80, 0xb3, 0x3f, 0x5e, 
+	0x90, 0x28, 0xe3, 0xeb, 0xf2, 0x13, 0x2e, 0xaf, 0x94, 0x67, 0x16, 0xdf, 
+	0x3b, 0x66, 0x7b, 0x0b, 0xed, 0x2b, 0xd1, 0xde, 0x64, 0xfb, 0xe2, 0x73, 
+	0x1e, 0x62, 0xfb, 0x34, 0xda, 0xd7, 0xa0, 0xbd, 0xc5, 0xf6, 0xc5, 0xf9, 
+	0x3a, 0xcf, 0xf6, 0x05, 0xb4, 0x57, 0xd1, 0x3e, 0xc6, 0x76, 0xbe, 0xdf, 
+	0x70, 0xc9, 0xb5, 0x4f, 0x99, 0xf1, 0xdf, 0x82, 0xf6, 0x36, 0xdb, 0x39, 
+	0xcf, 0xc3, 0x9c, 0xa7, 0x29, 0x33, 0xfe, 0x2d, 0x68, 0xdf, 0xc6, 0x76, 
+	0xce, 0xcb, 0xf0, 0x14, 0xdb, 0xcd, 0xf8, 0xef, 0x45, 0x7b, 0xcc, 0x76, 
+	0x7e, 0x9f, 0xe1, 0x53, 0x6c, 0x37, 0xe3, 0x7f, 0x14, 0xed, 0xbb, 0xd8, 
+	0xee, 0xe6, 0x53, 0x6c, 0x9d, 0x14, 0x82, 0xee, 0x1c, 0x21, 0xd3, 0xe7, 
+	0x24, 0x95, 0xb9, 0xdf, 0x97, 0xbd, 0x0f, 0x81, 0x0f, 0x2a, 0xd9, 0x8f, 
+	0xfd, 0x01, 0xa9, 0x4c, 0x9e, 0x5a, 0x65, 0xff, 0xdd, 0x48, 0xa6, 0xc7, 
+	0x25, 0x91, 0x79, 0x14, 0xfe, 0x13, 0xf6, 0x1e, 0x5e, 0xa6, 0xa7, 0x96, 
+	0x2f, 0x98, 0xca, 0x70, 0xfa, 0x49, 0x5b, 0x4f, 0xcb, 0xf4, 0x21, 0xc9, 
+	0x64, 0x9e, 0xd0, 0xb2, 0x6f, 0xad, 0xcd, 0xa7, 0xb2, 0x37, 0x84, 0xff, 
+	0x53, 0x5a, 0xf6, 0xf6, 0x38, 0xff, 0xbd, 0x35, 0xe7, 0xbf, 0x77, 0xbd, 
+	0xf3, 0xdf, 0xdb, 0x84, 0xff, 0xd3, 0xf0, 0x5f, 0x6f, 0xd7, 0xb7, 0x4c, 
+	0xbb, 0xfb, 0x3e, 0x99, 0xee, 0x27, 0x6b, 0xe4, 0x7a, 0xb2, 0x4e, 0x6e, 
+	0x20, 0x07, 0x48, 0xbb, 0x7e, 0xff, 0x09, 0xe4, 0x57, 0xd3, 0x6e, 0xe8, 
+	0x21, 0x00, 0x00, 0x00, };
 
-static const u16 init_ops_offsets_e1h[] = {
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0005, 0x0005, 0x0008, 0x0008, 
-	0x000b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 
-	0x0019, 0x0000, 0x0000, 0x0000, 0x0000, 0x0019, 0x001a, 0x001a, 0x001b, 
-	0x001b, 0x001c, 0x001c, 0x001d, 0x001d, 0x001e, 0x001e, 0x001f, 0x001f, 
-	0x0020, 0x0020, 0x0021, 0x0021, 0x0028, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0028, 0x002e, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x002e, 0x0049, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0049, 0x00b4, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x00b4, 0x00b9, 0x00b9, 0x00be, 0x00be, 0x00c3, 
-	0x00c3, 0x00c8, 0x00c8, 0x00cd, 0x00cd, 0x00d2, 0x00d2, 0x00d7, 0x00d7, 
-	0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x00e0, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x00e0, 0x00e7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x00e7, 0x00f7, 0x00f7, 0x0107, 0x0107, 0x0117, 0x0117, 0x0127, 
-	0x0127, 0x0137, 0x0137, 0x0147, 0x0147, 0x0157, 0x0157, 0x0167, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0167, 0x016d, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x016d, 0x016e, 0x016e, 0x016f, 0x016f, 0x0170, 0x0170, 0x0171, 0x0171, 
-	0x0172, 0x0172, 0x0173, 0x0173, 0x0174, 0x0174, 0x0175, 0x0175, 0x0178, 
-	0x0178, 0x0185, 0x0185, 0x0192, 0x0192, 0x0193, 0x0193, 0x0194, 0x0194, 
-	0x0195, 0x0195, 0x0196, 0x0196, 0x0197, 0x0197, 0x0198, 0x0198, 0x0199, 
-	0x0199, 0x019a, 0x019a, 0x01a0, 0x01a0, 0x01a4, 0x01a4, 0x01a8, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x01a8, 0x01ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ba, 0x01c9, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x01c9, 0x01cc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x01cc, 0x01ec, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ec, 
-	0x01ee, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x01ee, 0x01fb, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x01fb, 0x01fc, 0x01fc, 0x01fd, 0x01fd, 0x01fe, 0x01fe, 0x01ff, 0x01ff, 
-	0x0200, 0x0200, 0x0201, 0x0201, 0x0202, 0x0202, 0x0203, 0x0203, 0x0217, 
-	0x0217, 0x021a, 0x021a, 0x021d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x021d, 0x0238, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0238, 0x0269, 0x0269, 
-	0x0271, 0x0271, 0x0279, 0x0279, 0x027f, 0x027f, 0x0285, 0x0285, 0x028b, 
-	0x028b, 0x0291, 0x0291, 0x0297, 0x0297, 0x029d, 0x029d, 0x02a3, 0x02a3, 
-	0x02a9, 0x02a9, 0x02b6, 0x0000, 0x0000, 0x0000, 0x0000, 0x02b6, 0x02b7, 
-	0x02b7, 0x02b8, 0x02b8, 0x02b9, 0x02b9, 0x02ba, 0x02ba, 0x02bb, 0x02bb, 
-	0x02bc, 0x02bc, 0x02bd, 0x02bd, 0x02be, 0x02be, 0x02bf, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x02bf, 0x02db, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x02db, 0x0308, 0x0308, 0x031d, 0x031d, 
-	0x0332, 0x0332, 0x0334, 0x0334, 0x0336, 0x0336, 0x0338, 0x0338, 0x033a, 
-	0x033a, 0x033c, 0x033c, 0x033e, 0x033e, 0x0340, 0x0340, 0x0342, 0x0342, 
-	0x0354, 0x0000, 0x0000, 0x0000, 0x0000, 0x0354, 0x035c, 0x035c, 0x0364, 
-	0x0364, 0x036c, 0x036c, 0x0374, 0x0374, 0x037c, 0x037c, 0x0384, 0x0384, 
-	0x038c, 0x038c, 0x0394, 0x0394, 0x0395, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0395, 0x03b2, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x03b2, 0x03e7, 0x03e7, 0x03f5, 0x03f5, 0x0403, 0x0403, 
-	0x0407, 0x0407, 0x040b, 0x040b, 0x040f, 0x040f, 0x0413, 0x0413, 0x0417, 
-	0x0417, 0x041b, 0x041b, 0x041f, 0x041f, 0x0423, 0x0423, 0x0429, 0x0429, 
-	0x042f, 0x042f, 0x0435, 0x0435, 0x0436, 0x0436, 0x0437, 0x0437, 0x0438, 
-	0x0438, 0x0439, 0x0439, 0x043a, 0x043a, 0x043b, 0x043b, 0x043c, 0x043c, 
-	0x043d, 
-};
+static const u8 init_ops_offsets_zipped_e1h[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0xad, 0xd0, 
+	0x3b, 0x48, 0x42, 0x51, 0x18, 0xc0, 0xf1, 0x73, 0xee, 0x29, 0x12, 0x1c, 
+	0x1a, 0x1a, 0xc4, 0xca, 0x2c, 0x1a, 0xb2, 0xc5, 0x20, 0x2a, 0xcd, 0x1e, 
+	0x44, 0x4b, 0xb8, 0x07, 0x2d, 0x8d, 0x81, 0x04, 0xbd, 0xec, 0x01, 0x05, 
+	0x41, 0x4b, 0x4e, 0xb5, 0x54, 0x9a, 0x15, 0x04, 0x41, 0x0d, 0xb6, 0x4a, 
+	0x58, 0x5a, 0xe9, 0xd0, 0x52, 0x60, 0x4b, 0x4b, 0x43, 0x0d, 0x6e, 0x2e, 
+	0xe2, 0x26, 0x0e, 0xf6, 0xfa, 0x37, 0x74, 0xd7, 0x8e, 0xd1, 0xf7, 0x5b, 
+	0xbe, 0xe1, 0x7f, 0x2e, 0x1f, 0x57, 0x88, 0xaa, 0xa6, 0x16, 0x16, 0x58, 
+	0x7f, 0x2d, 0xad, 0xc2, 0x6e, 0xee, 0x76, 0xd1, 0x88, 0x26, 0x34, 0xc3, 
+	0x81, 0x16, 0x38, 0xd1, 0x8a, 0x36, 0xb8, 0xb4, 0x2f, 0x70, 0x09, 0xb7, 
+	0x76, 0xeb, 0x16, 0x7e, 0xed, 0xd6, 0x2f, 0x2e, 0xcc, 0xfd, 0x42, 0x24, 
+	0x91, 0xc6, 0x1d, 0xee, 0xf1, 0x88, 0x27, 0x3c, 0xe3, 0xb5, 0xaa, 0x3f, 
+	0xf6, 0x2a, 0x72, 0xda, 0x6d, 0x4e, 0xe4, 0xc5, 0x5f, 0x26, 0x2f, 0xca, 
+	0xa2, 0x2c, 0xeb, 0x60, 0x43, 0x07, 0x3c, 0x18, 0xc3, 0x04, 0x02, 0xd5, 
+	0x7c, 0x4a, 0x06, 0xe4, 0xac, 0xb9, 0xcf, 0xca, 0x39, 0xcc, 0x63, 0x01, 
+	0x41, 0x2c, 0x62, 0x09, 0xcb, 0x58, 0xc1, 0x2a, 0x42, 0xd8, 0xc5, 0x1e, 
+	0xc2, 0x88, 0x60, 0x1f, 0x51, 0x1c, 0xe0, 0x10, 0x47, 0x38, 0xc1, 0x19, 
+	0x62, 0xe2, 0x1f, 0x47, 0xc6, 0x64, 0x4a, 0xbb, 0x4d, 0xc9, 0x07, 0xed, 
+	0xf6, 0x41, 0x66, 0xb5, 0xdb, 0xac, 0x2c, 0x68, 0xb7, 0x05, 0x59, 0xd4, 
+	0x6e, 0x8b, 0xb2, 0x62, 0xee, 0x15, 0xf9, 0x86, 0x77, 0x7c, 0xe0, 0x53, 
+	0x7e, 0x1a, 0x02, 0x12, 0xdf, 0xa3, 0x60, 0x43, 0x23, 0x1c, 0xbf, 0x7d, 
+	0xd7, 0x70, 0x18, 0x5e, 0xdd, 0x1b, 0x0c, 0xaf, 0x31, 0x8d, 0x20, 0xd6, 
+	0xb0, 0x81, 0x10, 0xb6, 0xb0, 0x83, 0x28, 0x8e, 0x71, 0x8a, 0x73, 0x24, 
+	0xcc, 0x77, 0x09, 0xe3, 0x12, 0x57, 0x48, 0x22, 0x85, 0x6b, 0xdc, 0xe0, 
+	0x16, 0x69, 0x64, 0xb4, 0x6f, 0xc8, 0x18, 0x2f, 0xda, 0xed, 0x8b, 0xb2, 
+	0xc0, 0x81, 0x6e, 0xf4, 0xa0, 0x0f, 0x5e, 0xf8, 0x30, 0x88, 0x61, 0x8c, 
+	0x60, 0x14, 0xe3, 0x3f, 0xef, 0xd4, 0xb8, 0x9a, 0xc4, 0x14, 0x66, 0xb0, 
+	0x8c, 0x75, 0x6c, 0x62, 0x1b, 0x61, 0x44, 0x74, 0x6f, 0x50, 0x11, 0x15, 
+	0xd7, 0x6e, 0xe3, 0x2a, 0x8f, 0x92, 0x2a, 0xd5, 0x28, 0xd4, 0xc1, 0x8a, 
+	0x7a, 0x34, 0xc0, 0x86, 0x26, 0x38, 0xd1, 0x8e, 0x4e, 0x74, 0xa1, 0x17, 
+	0x7d, 0xf0, 0xc0, 0x8b, 0x7e, 0xf8, 0x30, 0x80, 0x41, 0x0c, 0x7d, 0x01, 
+	0x91, 0x7b, 0x76, 0x1f, 0xd8, 0x05, 0x00, 0x00, };
 
-static const u32 init_data_e1h[] = {
-	0x00002000, 0x00004000, 0x00006000, 0x00008000, 0x0000a000, 0x0000c000, 
-	0x0000e000, 0x00010000, 0x00012000, 0x00014000, 0x00016000, 0x00018000, 
-	0x0001a000, 0x0001c000, 0x0001e000, 0x00020000, 0x00022000, 0x00024000, 
-	0x00026000, 0x00028000, 0x0002a000, 0x0002c000, 0x0002e000, 0x00030000, 
-	0x00032000, 0x00034000, 0x00036000, 0x00038000, 0x0003a000, 0x0003c000, 
-	0x0003e000, 0x00040000, 0x00042000, 0x00044000, 0x00046000, 0x00048000, 
-	0x0004a000, 0x0004c000, 0x0004e000, 0x00050000, 0x00052000, 0x00054000, 
-	0x00056000, 0x00058000, 0x0005a000, 0x0005c000, 0x0005e000, 0x00060000, 
-	0x00062000, 0x00064000, 0x00066000, 0x00068000, 0x0006a000, 0x0006c000, 
-	0x0006e000, 0x00070000, 0x00072000, 0x00074000, 0x00076000, 0x00078000, 
-	0x0007a000, 0x0007c000, 0x0007e000, 0x00080000, 0x00082000, 0x00084000, 
-	0x00086000, 0x00088000, 0x0008a000, 0x0008c000, 0x0008e000, 0x00090000, 
-	0x00092000, 0x00094000, 0x00096000, 0x00098000, 0x0009a000, 0x0009c000, 
-	0x0009e000, 0x000a0000, 0x000a2000, 0x000a4000, 0x000a6000, 0x000a8000, 
-	0x000aa000, 0x000ac000, 0x000ae000, 0x000b0000, 0x000b2000, 0x000b4000, 
-	0x000b6000, 0x000b8000, 0x000ba000, 0x000bc000, 0x000be000, 0x000c0000, 
-	0x000c2000, 0x000c4000, 0x000c6000, 0x000c8000, 0x000ca000, 0x000cc000, 
-	0x000ce000, 0x000d0000, 0x000d2000, 0x000d4000, 0x000d6000, 0x000d8000, 
-	0x000da000, 0x000dc000, 0x000de000, 0x000e0000, 0x000e2000, 0x000e4000, 
-	0x000e6000, 0x000e8000, 0x000ea000, 0x000ec000, 0x000ee000, 0x000f0000, 
-	0x000f2000, 0x000f4000, 0x000f6000, 0x000f8000, 0x000fa000, 0x000fc000, 
-	0x000fe000, 0x00100000, 0x00102000, 0x00104000, 0x00106000, 0x00108000, 
-	0x0010a000, 0x0010c000, 0x0010e000, 0x00110000, 0x00112000, 0x00114000, 
-	0x00116000, 0x00118000, 0x0011a000, 0x0011c000, 0x0011e000, 0x00120000, 
-	0x00122000, 0x00124000, 0x00126000, 0x00128000, 0x0012a000, 0x0012c000, 
-	0x0012e000, 0x00130000, 0x00132000, 0x00134000, 0x00136000, 0x00138000, 
-	0x0013a000, 0x0013c000, 0x0013e000, 0x00140000, 0x00142000, 0x00144000, 
-	0x00146000, 0x00148000, 0x0014a000, 0x0014c000, 0x0014e000, 0x00150000, 
-	0x00152000, 0x00154000, 0x00156000, 0x00158000, 0x0015a000, 0x0015c000, 
-	0x0015e000, 0x00160000, 0x00162000, 0x00164000, 0x00166000, 0x00168000, 
-	0x0016a000, 0x0016c000, 0x0016e000, 0x00170000, 0x00172000, 0x00174000, 
-	0x00176000, 0x00178000, 0x0017a000, 0x0017c000, 0x0017e000, 0x00180000, 
-	0x00182000, 0x00184000, 0x00186000, 0x00188000, 0x0018a000, 0x0018c000, 
-	0x0018e000, 0x00190000, 0x00192000, 0x00194000, 0x00196000, 0x00198000, 
-	0x0019a000, 0x0019c000, 0x0019e000, 0x001a0000, 0x001a2000, 0x001a4000, 
-	0x001a6000, 0x001a8000, 0x001aa000, 0x001ac000, 0x001ae000, 0x001b0000, 
-	0x001b2000, 0x001b4000, 0x001b6000, 0x001b8000, 0x001ba000, 0x001bc000, 
-	0x001be000, 0x001c0000, 0x001c2000, 0x001c4000, 0x001c6000, 0x001c8000, 
-	0x001ca000, 0x001cc000, 0x001ce000, 0x001d0000, 0x001d2000, 0x001d4000, 
-	0x001d6000, 0x001d8000, 0x001da000, 0x001dc000, 0x001de000, 0x001e0000, 
-	0x001e2000, 0x001e4000, 0x001e6000, 0x001e8000, 0x001ea000, 0x001ec000, 
-	0x001ee000, 0x001f0000, 0x001f2000, 0x001f4000, 0x001f6000, 0x001f8000, 
-	0x001fa000, 0x001fc000, 0x001fe000, 0x00200000, 0x00202000, 0x00204000, 
-	0x00206000, 0x00208000, 0x0020a000, 0x0020c000, 0x0020e000, 0x00210000, 
-	0x00212000, 0x00214000, 0x00216000, 0x00218000, 0x0021a000, 0x0021c000, 
-	0x0021e000, 0x00220000, 0x00222000, 0x00224000, 0x00226000, 0x00228000, 
-	0x0022a000, 0x0022c000, 0x0022e000, 0x00230000, 0x00232000, 0x00234000, 
-	0x00236000, 0x00238000, 0x0023a000, 0x0023c000, 0x0023e000, 0x00240000, 
-	0x00242000, 0x00244000, 0x00246000, 0x00248000, 0x0024a000, 0x0024c000, 
-	0x0024e000, 0x00250000, 0x00252000, 0x00254000, 0x00256000, 0x00258000, 
-	0x0025a000, 0x0025c000, 0x0025e000, 0x00260000, 0x00262000, 0x00264000, 
-	0x00266000, 0x00268000, 0x0026a000, 0x0026c000, 0x0026e000, 0x00270000, 
-	0x00272000, 0x00274000, 0x00276000, 0x00278000, 0x0027a000, 0x0027c000, 
-	0x0027e000, 0x00280000, 0x00282000, 0x00284000, 0x00286000, 0x00288000, 
-	0x0028a000, 0x0028c000, 0x0028e000, 0x00290000, 0x00292000, 0x00294000, 
-	0x00296000, 0x00298000, 0x0029a000, 0x0029c000, 0x0029e000, 0x002a0000, 
-	0x002a2000, 0x002a4000, 0x002a6000, 0x002a8000, 0x002aa000, 0x002ac000, 
-	0x002ae000, 0x002b0000, 0x002b2000, 0x002b4000, 0x002b6000, 0x002b8000, 
-	0x002ba000, 0x002bc000, 0x002be000, 0x002c0000, 0x002c2000, 0x002c4000, 
-	0x002c6000, 0x002c8000, 0x002ca000, 0x002cc000, 0x002ce000, 0x002d0000, 
-	0x002d2000, 0x002d4000, 0x002d6000, 0x002d8000, 0x002da000, 0x002dc000, 
-	0x002de000, 0x002e0000, 0x002e2000, 0x002e4000, 0x002e6000, 0x002e8000, 
-	0x002ea000, 0x002ec000, 0x002ee000, 0x002f0000, 0x002f2000, 0x002f4000, 
-	0x002f6000, 0x002f8000, 0x002fa000, 0x002fc000, 0x002fe000, 0x00300000, 
-	0x00302000, 0x00304000, 0x00306000, 0x00308000, 0x0030a000, 0x0030c000, 
-	0x0030e000, 0x00310000, 0x00312000, 0x00314000, 0x00316000, 0x00318000, 
-	0x0031a000, 0x0031c000, 0x0031e000, 0x00320000, 0x00322000, 0x00324000, 
-	0x00326000, 0x00328000, 0x0032a000, 0x0032c000, 0x0032e000, 0x00330000, 
-	0x00332000, 0x00334000, 0x00336000, 0x00338000, 0x0033a000, 0x0033c000, 
-	0x0033e000, 0x00340000, 0x00342000, 0x00344000, 0x00346000, 0x00348000, 
-	0x0034a000, 0x0034c000, 0x0034e000, 0x00350000, 0x00352000, 0x00354000, 
-	0x00356000, 0x00358000, 0x0035a000, 0x0035c000, 0x0035e000, 0x00360000, 
-	0x00362000, 0x00364000, 0x00366000, 0x00368000, 0x0036a000, 0x0036c000, 
-	0x0036e000, 0x00370000, 0x00372000, 0x00374000, 0x00376000, 0x00378000, 
-	0x0037a000, 0x0037c000, 0x0037e000, 0x00380000, 0x00382000, 0x00384000, 
-	0x00386000, 0x00388000, 0x0038a000, 0x0038c000, 0x0038e000, 0x00390000, 
-	0x00392000, 0x00394000, 0x00396000, 0x00398000, 0x0039a000, 0x0039c000, 
-	0x0039e000, 0x003a0000, 0x003a2000, 0x003a4000, 0x003a6000, 0x003a8000, 
-	0x003aa000, 0x003ac000, 0x003ae000, 0x003b0000, 0x003b2000, 0x003b4000, 
-	0x003b6000, 0x003b8000, 0x003ba000, 0x003bc000, 0x003be000, 0x003c0000, 
-	0x003c2000, 0x003c4000, 0x003c6000, 0x003c8000, 0x003ca000, 0x003cc000, 
-	0x003ce000, 0x003d0000, 0x003d2000, 0x003d4000, 0x003d6000, 0x003d8000, 
-	0x003da000, 0x003dc000, 0x003de000, 0x003e0000, 0x003e2000, 0x003e4000, 
-	0x003e6000, 0x003e8000, 0x003ea000, 0x003ec000, 0x003ee000, 0x003f0000, 
-	0x003f2000, 0x003f4000, 0x003f6000, 0x003f8000, 0x003fa000, 0x003fc000, 
-	0x003fe000, 0x003fe001, 0x00000000, 0x000001ff, 0x00000200, 0x00000001, 
-	0x00000002, 0x00000000, 0x00000008, 0x02150020, 0x02150020, 0x08100000, 
-	0x00000033, 0x00000002, 0x00000000, 0x00000005, 0x00000005, 0x00000000, 
-	0x00000000, 0x00000002, 0x00000003, 0x00000002, 0x00000001, 0x00000004, 
-	0x00000002, 0x00000002, 0x00000001, 0x00000002, 0x00000020, 0x00000040, 
-	0x00000040, 0x00000003, 0x00000018, 0x00002000, 0x000040c0, 0x00006180, 
-	0x00008240, 0x0000a300, 0x0000c3c0, 0x0000e480, 0x00010540, 0x00012600, 
-	0x000146c0, 0x00016780, 0x00018840, 0x0001a900, 0x0001c9c0, 0x0001ea80, 
-	0x00020b40, 0x00022c00, 0x00024cc0, 0x00026d80, 0x00028e40, 0x0002af00, 
-	0x0002cfc0, 0x0002f080, 0x00001140, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x0003d000, 0x0000003d, 0x00000001, 0x000d0000, 0x000700d0, 0x00028140, 
-	0x000b8168, 0x00020220, 0x00010240, 0x000f0250, 0x00010340, 0x000c0000, 
-	0x000800c0, 0x00028140, 0x000b8168, 0x00020220, 0x00010240, 0x00070250, 
-	0x000202c0, 0x00100000, 0x00080100, 0x00028180, 0x000b81a8, 0x00020260, 
-	0x00018280, 0x000e8298, 0x00080380, 0x00000000, 0x00000000, 0x00028000, 
-	0x00090028, 0x000200b8, 0x000100d8, 0x000000e8, 0x000000e8, 0xfffffff3, 
-	0x01afffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0xfffffff1, 0x00efffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00010000, 0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0xfffff406, 
-	0x1cbfffff, 0x00000005, 0x00000000, 0x00000014, 0x00000000, 0x00040000, 
-	0x00000000, 0xfffffff2, 0x004fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00080000, 0x00000000, 0xfffffffa, 0x002fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0xfffffff7, 
-	0x01efffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 
-	0x00000000, 0xfffffff5, 0x002fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00400000, 0x00000000, 0xfffffff3, 0x018fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffffff1, 
-	0x010fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 
-	0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00020000, 0x00000000, 0xfffff406, 0x1cbfffff, 0x00000005, 
-	0x00000000, 0x00000014, 0x00000000, 0x00040000, 0x00000000, 0xfffffff2, 
-	0x004fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 
-	0x00000000, 0xfffffffa, 0x002fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00100000, 0x00000000, 0xfffffff7, 0x00efffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000, 0xfffffff5, 
-	0x004fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00010000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00020000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00040000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00080000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00100000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00200000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00400000, 0x00000000, 0xfffffff3, 
-	0x020fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0xfffffff1, 0x010fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00010000, 0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0xfffff406, 
-	0x1cbfffff, 0x00000005, 0x00000000, 0x00000014, 0x00000000, 0x00040000, 
-	0x00000000, 0xfffffff2, 0x004fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00080000, 0x00000000, 0xffffff8a, 0x042fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0xffffff97, 
-	0x05cfffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 
-	0x00000000, 0xfffffff5, 0x010fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00400000, 0x00000000, 0xfffffff3, 0x000fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffffff1, 
-	0x000fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 
-	0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00020000, 0x00000000, 0xffffff06, 0x1cbfffff, 0x00000000, 
-	0x00000000, 0x00000014, 0x00000000, 0x00040000, 0x00000000, 0xfffffff2, 
-	0x004fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 
-	0x00000000, 0xfffffffa, 0x002fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00100000, 0x00000000, 0xfffffff7, 0x000fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00400000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00010000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00020000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00040000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00080000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00100000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00200000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00400000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00000000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00010000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00020000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00040000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00080000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00100000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00200000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00400000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00010000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00020000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00040000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00080000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00100000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00200000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00400000, 
-	0x00000000, 0x00000211, 0x00000200, 0x00000204, 0x0000ffff, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x00000020, 0x00000021, 0x00000022, 0x00000023, 
-	0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000028, 0x00000029, 
-	0x0000002a, 0x0000002b, 0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 
-	0x00000010, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x07ffffff, 0x0000003f, 0x07ffffff, 0x0000000f, 0x00007ff8, 0x00007ff8, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 
-	0x00000313, 0x00001500, 0x00000001, 0x00000002, 0x00000003, 0x00000000, 
-	0x00000004, 0x00000001, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 
-	0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 
-	0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 
-	0x00000004, 0x00000003, 0x00000000, 0x00000000, 0x00003fff, 0x000003ff, 
-	0x00000000, 0x00000001, 0x00000001, 0x00000001, 0x007c1004, 0x00000004, 
-	0x00000002, 0x00000090, 0x00000090, 0x00800090, 0x08100000, 0x0000008a, 
-	0x00000080, 0x00000081, 0x00000080, 0x00000006, 0x000007d0, 0x0000076c, 
-	0x071d2911, 0x00000000, 0x009c0424, 0x00000000, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00007fff, 0x000000ff, 0x000000ff, 
-	0x000000ff, 0x000000ff, 0x0000007f, 0x000000ff, 0x000000ff, 0x000000ff, 
-	0x0000003e, 0x00000000, 0x0000003f, 0x0000003f, 0x0000003f, 0x0000003f, 
-	0x0000003f, 0x0000003f, 0x0000003f, 0x0000000f, 0x00000000, 0x12170000, 
-	0x22170000, 0x32170000, 0x12150000, 0x22150000, 0x32150000, 0x02100000, 
-	0x00100000, 0x10100000, 0x20100000, 0x30100000, 0x00100000, 0x12140000, 
-	0x22140000, 0x32140000, 0x00e38340, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xf0005000, 
-	0xf0001000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xff809000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00003c10, 
-	0x00000001, 0x00000000, 0x00000008, 0x00000008, 0x00000002, 0x00000004, 
-	0x00000005, 0x00000004, 0x00000040, 0x00001808, 0x00000803, 0x00000803, 
-	0x00000040, 0x00000003, 0x00000803, 0x00000803, 0x00000803, 0x00010003, 
-	0x00000803, 0x00000803, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 
-	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 
-	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00002403, 
-	0x0000002f, 0x00000009, 0x00000019, 0x00000184, 0x00000183, 0x00000306, 
-	0x00000019, 0x00000006, 0x00000306, 0x00000306, 0x00000306, 0x00000c86, 
-	0x00000306, 0x00000306, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-	0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-	0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000306, 
-	0x00000013, 0x00000006, 0x00001004, 0x00001004, 0x00106440, 0x00106440, 
-	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x04002000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00000000, 0x00002000, 0x0000007c, 0x0000003d, 0x0000003f, 
-	0x0000009c, 0x00000006, 0x00000005, 0x0000000a, 0x00000005, 0x00000140, 
-	0x00000140, 0x00000000, 0x00000000, 0x000000c0, 0x0000013f, 0x00007fff, 
-	0x00000048, 0x00000048, 0x00000000, 0x00000000, 0x00000048, 0x00000004, 
-	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 
-	0x00000004, 0x00000004, 0x00000009, 0x0000000b, 0x0000000a, 0x00000004, 
-	0x00000009, 0x0000000b, 0x0000000a, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000004, 0x00000009, 0x0000000b, 
-	0x0000000a, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000004, 0x00000009, 0x0000000b, 0x0000000a, 0x00000000, 
-	0x00000000, 0x00000800, 0x00000200, 0x000001ff, 0x00000400, 0x00000000, 
-	0x00000000, 0x1e491e49, 0x1e491e49, 0x0e490e49, 0x0e490e49, 0xffffffff, 
-	0x00000000, 0x000025e4, 0x00008000, 0x00000013, 0x0fff0fff, 0x00000000, 
-	0x00000000, 0x0fff0fff, 0x10001000, 0x10001000, 0x20002000, 0x20002000, 
-	0x80008000, 0x80008000, 0x40004000, 0x40004000, 0x00000000, 0x00000001, 
-	0x01010101, 0x01200101, 0x20010101, 0x01011001, 0x01010101, 0x01200101, 
-	0x20010101, 0x01011001, 0x20010101, 0x01011001, 0x01010101, 0x01200101, 
-	0x20010101, 0x01011001, 0x01010101, 0x01200101, 0x01010101, 0x01200101, 
-	0x20010101, 0x01011001, 0x01010101, 0x01200101, 0x20010101, 0x01011001, 
-	0x01010101, 0x01200101, 0x20010101, 0x01011001, 0x01010101, 0x01200101, 
-	0x20010101, 0x01011001, 0x00000004, 0x00000009, 0x0000000b, 0x0000000a, 
-	0x00000004, 0x00000009, 0x0000000b, 0x0000000a, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000004, 0x00000009, 
-	0x0000000b, 0x0000000a, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000004, 0x00000009, 0x0000000b, 0x0000000a, 
-	0x1e491e49, 0x1e491e49, 0x0e490e49, 0x0e490e49, 0xffffffff, 0x00000000, 
-	0x0fff0fff, 0x00000000, 0x00000000, 0x0fff0fff, 0x10001000, 0x10001000, 
-	0x20002000, 0x20002000, 0x80008000, 0x80008000, 0x40004000, 0x40004000, 
-	0x00000000, 0x00000002, 0x00000001, 0x00000003, 0x00000004, 0x00000006, 
-	0x00000005, 0x00000007, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 
-	0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 
-	0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 
-	0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000020, 0x00000032, 
-	0x00000007, 0x00000007, 0x00000000, 0x00000008, 0x02150020, 0x02150020, 
-	0x00000030, 0x08100000, 0x00000033, 0x00000030, 0x00000031, 0x00000002, 
-	0x00000005, 0x00000006, 0x00000002, 0x00000002, 0x00000000, 0x00000005, 
-	0x00000002, 0x00000002, 0x00000002, 0x00000001, 0x00000006, 0x00000001, 
-	0x00000002, 0x00000040, 0x00000040, 0x00000020, 0x00000013, 0x00000020, 
-	0x00010000, 0x000204c0, 0x00030980, 0x00040e40, 0x00051300, 0x000617c0, 
-	0x00071c80, 0x00082140, 0x00092600, 0x000a2ac0, 0x000b2f80, 0x000c3440, 
-	0x000d3900, 0x000e3dc0, 0x000f4280, 0x00104740, 0x00114c00, 0x001250c0, 
-	0x00135580, 0x00145a40, 0x00155f00, 0x001663c0, 0x00176880, 0x00186d40, 
-	0x00197200, 0x001a76c0, 0x001b7b80, 0x001c8040, 0x001d8500, 0x001e89c0, 
-	0x001f8e80, 0x00009340, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000008, 0x0000000c, 0x00000010, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000211, 0x00000200, 0x00000204, 0x00000219, 0x0000ffff, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x07ffffff, 0x0000003f, 0x07ffffff, 0x0000000f, 
-	0x00007ff8, 0x00007ff8, 0x00000000, 0x00000001, 0x00201001, 0x00000000, 
-	0x01009000, 0x00000100, 0x00000001, 0x00000000, 0x00000000, 0x140aff00, 
-	0x00009002, 0x00000000, 0x00000000, 0x00000000, 0x00009004, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009006, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009008, 0x00000000, 0x00000000, 0x00000000, 0x0000900a, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000900c, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000900e, 0x00000000, 0x00000000, 0x00000000, 0x00009010, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009012, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009014, 0x00000000, 0x00000000, 0x00000000, 0x00009016, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009018, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000901a, 0x00000000, 0x00000000, 0x00000000, 0x0000901c, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000901e, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009020, 0x00000000, 0x00000000, 0x00000000, 0x00009022, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009024, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009026, 0x00000000, 0x00000000, 0x00000000, 0x00009028, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000902a, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000902c, 0x00000000, 0x00000000, 0x00000000, 0x0000902e, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009030, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009032, 0x00000000, 0x00000000, 0x00000000, 0x00009034, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009036, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009038, 0x00000000, 0x00000000, 0x00000000, 0x0000903a, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000903c, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000903e, 0x00000000, 0x00000000, 0x00000000, 0x00009040, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009042, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009044, 0x00000000, 0x00000000, 0x00000000, 0x00009046, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009048, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000904a, 0x00000000, 0x00000000, 0x00000000, 0x0000904c, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000904e, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009050, 0x00000000, 0x00000000, 0x00000000, 0x00009052, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009054, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009056, 0x00000000, 0x00000000, 0x00000000, 0x00009058, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000905a, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000905c, 0x00000000, 0x00000000, 0x00000000, 0x0000905e, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009060, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009062, 0x00000000, 0x00000000, 0x00000000, 0x00009064, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009066, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009068, 0x00000000, 0x00000000, 0x00000000, 0x0000906a, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000906c, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000906e, 0x00000000, 0x00000000, 0x00000000, 0x00009070, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009072, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009074, 0x00000000, 0x00000000, 0x00000000, 0x00009076, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009078, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000907a, 0x00000000, 0x00000000, 0x00000000, 0x0000907c, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000907e, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009080, 0x00000000, 0x00000000, 0x00000000, 0x00009082, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009084, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009086, 0x00000000, 0x00000000, 0x00000000, 0x00009088, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000908a, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000908c, 0x00000000, 0x00000000, 0x00000000, 0x0000908e, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009090, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009092, 0x00000000, 0x00000000, 0x00000000, 0x00009094, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009096, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009098, 0x00000000, 0x00000000, 0x00000000, 0x0000909a, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000909c, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000909e, 0x00000000, 0x00000000, 0x00000000, 0x000090a0, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090a2, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090a4, 0x00000000, 0x00000000, 0x00000000, 0x000090a6, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090a8, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090aa, 0x00000000, 0x00000000, 0x00000000, 0x000090ac, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090ae, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090b0, 0x00000000, 0x00000000, 0x00000000, 0x000090b2, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090b4, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090b6, 0x00000000, 0x00000000, 0x00000000, 0x000090b8, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090ba, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090bc, 0x00000000, 0x00000000, 0x00000000, 0x000090be, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090c0, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090c2, 0x00000000, 0x00000000, 0x00000000, 0x000090c4, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090c6, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090c8, 0x00000000, 0x00000000, 0x00000000, 0x000090ca, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090cc, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090ce, 0x00000000, 0x00000000, 0x00000000, 0x000090d0, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090d2, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090d4, 0x00000000, 0x00000000, 0x00000000, 0x000090d6, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090d8, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090da, 0x00000000, 0x00000000, 0x00000000, 0x000090dc, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090de, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090e0, 0x00000000, 0x00000000, 0x00000000, 0x000090e2, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090e4, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090e6, 0x00000000, 0x00000000, 0x00000000, 0x000090e8, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090ea, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090ec, 0x00000000, 0x00000000, 0x00000000, 0x000090ee, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090f0, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090f2, 0x00000000, 0x00000000, 0x00000000, 0x000090f4, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090f6, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090f8, 0x00000000, 0x00000000, 0x00000000, 0x000090fa, 0x00000000, 
-	0x00000000, 0x00000000, 0x000090fc, 0x00000000, 0x00000000, 0x00000000, 
-	0x000090fe, 0x00000000, 0x00000000, 0x00000000, 0x00009100, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009102, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009104, 0x00000000, 0x00000000, 0x00000000, 0x00009106, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009108, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000910a, 0x00000000, 0x00000000, 0x00000000, 0x0000910c, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000910e, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009110, 0x00000000, 0x00000000, 0x00000000, 0x00009112, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009114, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009116, 0x00000000, 0x00000000, 0x00000000, 0x00009118, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000911a, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000911c, 0x00000000, 0x00000000, 0x00000000, 0x0000911e, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009120, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009122, 0x00000000, 0x00000000, 0x00000000, 0x00009124, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009126, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009128, 0x00000000, 0x00000000, 0x00000000, 0x0000912a, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000912c, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000912e, 0x00000000, 0x00000000, 0x00000000, 0x00009130, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009132, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009134, 0x00000000, 0x00000000, 0x00000000, 0x00009136, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009138, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000913a, 0x00000000, 0x00000000, 0x00000000, 0x0000913c, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000913e, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009140, 0x00000000, 0x00000000, 0x00000000, 0x00009142, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009144, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009146, 0x00000000, 0x00000000, 0x00000000, 0x00009148, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000914a, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000914c, 0x00000000, 0x00000000, 0x00000000, 0x0000914e, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009150, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009152, 0x00000000, 0x00000000, 0x00000000, 0x00009154, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009156, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009158, 0x00000000, 0x00000000, 0x00000000, 0x0000915a, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000915c, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000915e, 0x00000000, 0x00000000, 0x00000000, 0x00009160, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009162, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009164, 0x00000000, 0x00000000, 0x00000000, 0x00009166, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009168, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000916a, 0x00000000, 0x00000000, 0x00000000, 0x0000916c, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000916e, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009170, 0x00000000, 0x00000000, 0x00000000, 0x00009172, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009174, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009176, 0x00000000, 0x00000000, 0x00000000, 0x00009178, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000917a, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000917c, 0x00000000, 0x00000000, 0x00000000, 0x0000917e, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009180, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009182, 0x00000000, 0x00000000, 0x00000000, 0x00009184, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009186, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009188, 0x00000000, 0x00000000, 0x00000000, 0x0000918a, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000918c, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000918e, 0x00000000, 0x00000000, 0x00000000, 0x00009190, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009192, 0x00000000, 0x00000000, 0x00000000, 
-	0x00009194, 0x00000000, 0x00000000, 0x00000000, 0x00009196, 0x00000000, 
-	0x00000000, 0x00000000, 0x00009198, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000919a, 0x00000000, 0x00000000, 0x00000000, 0x0000919c, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000919e, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091a0, 0x00000000, 0x00000000, 0x00000000, 0x000091a2, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091a4, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091a6, 0x00000000, 0x00000000, 0x00000000, 0x000091a8, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091aa, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091ac, 0x00000000, 0x00000000, 0x00000000, 0x000091ae, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091b0, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091b2, 0x00000000, 0x00000000, 0x00000000, 0x000091b4, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091b6, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091b8, 0x00000000, 0x00000000, 0x00000000, 0x000091ba, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091bc, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091be, 0x00000000, 0x00000000, 0x00000000, 0x000091c0, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091c2, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091c4, 0x00000000, 0x00000000, 0x00000000, 0x000091c6, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091c8, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091ca, 0x00000000, 0x00000000, 0x00000000, 0x000091cc, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091ce, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091d0, 0x00000000, 0x00000000, 0x00000000, 0x000091d2, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091d4, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091d6, 0x00000000, 0x00000000, 0x00000000, 0x000091d8, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091da, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091dc, 0x00000000, 0x00000000, 0x00000000, 0x000091de, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091e0, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091e2, 0x00000000, 0x00000000, 0x00000000, 0x000091e4, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091e6, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091e8, 0x00000000, 0x00000000, 0x00000000, 0x000091ea, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091ec, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091ee, 0x00000000, 0x00000000, 0x00000000, 0x000091f0, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091f2, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091f4, 0x00000000, 0x00000000, 0x00000000, 0x000091f6, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091f8, 0x00000000, 0x00000000, 0x00000000, 
-	0x000091fa, 0x00000000, 0x00000000, 0x00000000, 0x000091fc, 0x00000000, 
-	0x00000000, 0x00000000, 0x000091fe, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x000001a7, 0x00003500, 0x00000001, 0x00000002, 0x00000003, 
-	0x00000000, 0x00000004, 0x00000001, 0x00000000, 0x00000001, 0x00000004, 
-	0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 
-	0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 
-	0x00000000, 0x00000004, 0x00000003, 0x00000000, 0x00000000, 0x00003fff, 
-	0x000003ff, 0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 0x00000003, 
-	0x00bebc20, 0x00000000, 0x00000005, 0x00000003, 0x00bebc20, 0x00000000, 
-	0x00000005, 0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 0x00000003, 
-	0x00bebc20, 0x00000000, 0x00000005, 0x00000003, 0x00bebc20, 0x00000000, 
-	0x00000005, 0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 0x00000003, 
-	0x00bebc20, 0x00000000, 0x00000005, 0x0000000d, 0x0000000c, 0x00000000, 
-	0x00000010, 0x02150020, 0x02150020, 0x00000030, 0x08100000, 0x00000033, 
-	0x00000030, 0x00000031, 0x00000002, 0x00000004, 0x00000000, 0x00000002, 
-	0x00000002, 0x00000000, 0x00000002, 0x00000007, 0x00000002, 0x00000002, 
-	0x00000001, 0x00000003, 0x00000001, 0x00000002, 0x00000040, 0x00000040, 
-	0x00000004, 0x00000020, 0x0000000f, 0x0000001b, 0x00008000, 0x000103c0, 
-	0x00018780, 0x00020b40, 0x00028f00, 0x000312c0, 0x00039680, 0x00041a40, 
-	0x00049e00, 0x000521c0, 0x0005a580, 0x00062940, 0x0006ad00, 0x000730c0, 
-	0x0007b480, 0x00083840, 0x0008bc00, 0x00093fc0, 0x0009c380, 0x000a4740, 
-	0x000acb00, 0x000b4ec0, 0x000bd280, 0x000c5640, 0x000cda00, 0x000d5dc0, 
-	0x00006180, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00001011, 0x00001000, 0x00001004, 0x00001021, 0x0000ffff, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x00000046, 0x00000010, 0x00000000, 0x00000000, 
-	0x00000018, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
-	0x07ffffff, 0x0000003f, 0x07ffffff, 0x0000000f, 0x00007ff8, 0x00007ff8, 
-	0x00001900, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000014c, 0x00003500, 0x00000001, 0x00000002, 
-	0x00000003, 0x00000000, 0x00000004, 0x00000001, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000004, 0x00000003, 0x00000000, 0x00000000, 
-	0x00003fff, 0x000003ff, 0x00000000, 0x03938700, 0x00000000, 0x00000000, 
-	0x00000000, 0x03938700, 0x00000000, 0x00000000, 0x0000000f, 0x00000007, 
-	0x00000000, 0x0000000e, 0x03150020, 0x03150020, 0x01000030, 0x08100000, 
-	0x00000033, 0x00000030, 0x00000031, 0x00000003, 0x00000006, 0x00000003, 
-	0x00000003, 0x00000002, 0x00000000, 0x00000002, 0x00000000, 0x00000006, 
-	0x00000004, 0x00000002, 0x00000002, 0x00000001, 0x00000004, 0x00000001, 
-	0x00000002, 0x00000040, 0x00000040, 0x00000004, 0x00000020, 0x00000002, 
-	0x00000020, 0x00001000, 0x00002080, 0x00003100, 0x00004180, 0x00005200, 
-	0x00006280, 0x00007300, 0x00008380, 0x00009400, 0x0000a480, 0x0000b500, 
-	0x0000c580, 0x0000d600, 0x0000e680, 0x0000f700, 0x00010780, 0x00011800, 
-	0x00012880, 0x00013900, 0x00014980, 0x00015a00, 0x00016a80, 0x00017b00, 
-	0x00018b80, 0x00019c00, 0x0001ac80, 0x0001bd00, 0x0001cd80, 0x0001de00, 
-	0x0001ee80, 0x0001ff00, 0x00000f80, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00001224, 
-	0x00001210, 0x00001214, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-	0x00000020, 0x00000020, 0x00000000, 0x00000000, 0x00000023, 0x00000024, 
-	0x00000025, 0x00000026, 0x00000027, 0x00000029, 0x0000002a, 0x0000002b, 
-	0x0000002c, 0x00000001, 0x00000001, 0x07ffffff, 0x0000003f, 0x07ffffff, 
-	0x0000000f, 0x00007ff8, 0x00007ff8, 0x00000000, 0x00000001, 0xcccc0201, 
-	0xcccccccc, 0xcccc0201, 0xcccccccc, 0xcccc0201, 0xcccccccc, 0xcccc0201, 
-	0xcccccccc, 0xcccc0201, 0xcccccccc, 0xcccc0201, 0xcccccccc, 0xcccc0201, 
-	0xcccccccc, 0xcccc0201, 0xcccccccc, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 
-	0x00010001, 0x00340807, 0xccccccc5, 0x10000000, 0x000028ad, 0x7058103c, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x00000267, 
-	0x00003500, 0x00000001, 0x00000002, 0x00000003, 0x00000000, 0x00000004, 
-	0x00000001, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 0x00000001, 
-	0x00000003, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 0x00000001, 
-	0x00000003, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 0x00000004, 
-	0x00000003, 0x00000000, 0x00000000, 0x00003fff, 0x000003ff, 0x002625a0, 
-	0x00000000, 0x002625a0, 0x00000000, 0x002625a0, 0x00000000, 0x002625a0, 
-	0x00000000, 0x000e0000, 0x011600d6, 0x002625a0, 0x00000000, 0x002625a0, 
-	0x00000000, 0x002625a0, 0x00000000, 0x002625a0, 0x00000000, 0x00720000, 
-	0x012300f3, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000ffff, 0x00000000, 0x55540000, 0x55555555, 0x00005555, 
-	0xf0000000, 0x55540000, 0x55555555, 0x00005555, 0xf0000000, 0x55540000, 
-	0x55555555, 0x00005555, 0xf0000000, 0x00000000, 0x00010000, 0x00005014, 
-	0x00000000, 0xff5c0000, 0xfff55fff, 0x0000ffff, 0xf00003e0, 0x00000000, 
-	0x0000a000, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00001000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00010000, 0xff5c0000, 0xfff55fff, 0x0000ffff, 0xf00003e0, 
-	0x00000000, 0x0000a000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 
-	0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000, 
-	0x00000000, 0x00000000, 0x00020000, };
+static const u8 init_data_zipped_e1h[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0xed, 0xdb, 
+	0x09, 0x6c, 0xa4, 0x75, 0x1d, 0xc6, 0xf1, 0xff, 0xfb, 0xce, 0xb4, 0x33, 
+	0x3d, 0x67, 0x7a, 0xdf, 0xed, 0xf4, 0x3e, 0xb7, 0xf7, 0x76, 0xdb, 0x6e, 
+	0x8f, 0x91, 0x18, 0x0e, 0xb3, 0x81, 0x8d, 0x11, 0x42, 0x88, 0x0a, 0x22, 
+	0x11, 0x42, 0xc0, 0x10, 0x34, 0xc4, 0x08, 0x91, 0xd9, 0x05, 0x01, 0xd1, 
+	0x60, 0x7f, 0x62, 0x90, 0x18, 0x62, 0x88, 0xa2, 0xa2, 0x01, 0x31, 0x06, 
+	0x0d, 0x31, 0x88, 0x13, 0x11, 0xe3, 0xb1, 0x0a, 0x21, 0xc6, 0x10, 0x63, 
+	0x0c, 0x51, 0x42, 0x08, 0x31, 0xb8, 0x72, 0x87, 0x18, 0xea, 0xf7, 0x9d, 
+	0x79, 0xa7, 0x3b, 0xfb, 0x6c, 0xb7, 0x85, 0xed, 0x0a, 0x9b, 0xc0, 0x94, 
+	0xff, 0xbe, 0x7d, 0xe6, 0x33, 0xd3, 0xb9, 0xde, 0x99, 0xe7, 0xfd, 0xbf, 
+	0xef, 0xe0, 0x5c, 0xca, 0x39, 0x97, 0x66, 0x5c, 0xc4, 0xc8, 0x30, 0xee, 
+	0x66, 0x64, 0x19, 0x4f, 0x3b, 0xe7, 0xb1, 0xf0, 0x70, 0x0f, 0xf7, 0x70, 
+	0x0f, 0xf7, 0x70, 0x0f, 0xf7, 0x70, 0x1f, 0xf7, 0x71, 0x1f, 0xf7, 0x71, 
+	0x1f, 0xf7, 0x71, 0x1f, 0xf7, 0xf1, 0x08, 0x1e, 0xc1, 0x23, 0x78, 0x04, 
+	0x8f, 0xe0, 0x11, 0x3c, 0x82, 0x47, 0xf0, 0x28, 0x1e, 0xc5, 0xa3, 0x78, 
+	0x14, 0x8f, 0xe2, 0x51, 0x3c, 0x8a, 0x47, 0xf1, 0x12, 0xbc, 0x04, 0x2f, 
+	0xc1, 0x4b, 0xf0, 0x12, 0xbc, 0x04, 0x2f, 0xc1, 0x4b, 0xf0, 0x52, 0xbc, 
+	0x14, 0x2f, 0xc5, 0x4b, 0xf1, 0x52, 0xbc, 0x14, 0x2f, 0xc5, 0x4b, 0xf1, 
+	0x18, 0x1e, 0xc3, 0x63, 0x78, 0x0c, 0x8f, 0xe1, 0x31, 0x3c, 0x86, 0xc7, 
+	0xf0, 0x38, 0x1e, 0xc7, 0xe3, 0x78, 0x1c, 0x8f, 0xe3, 0x71, 0x3c, 0x8e, 
+	0xc7, 0xf1, 0x32, 0xbc, 0x0c, 0x2f, 0xc3, 0xcb, 0xf0, 0x32, 0xbc, 0x0c, 
+	0x2f, 0xc3, 0xcb, 0xf0, 0x72, 0xbc, 0x1c, 0x2f, 0xc7, 0xcb, 0xf1, 0x72, 
+	0xbc, 0x1c, 0x2f, 0xc7, 0xcb, 0xf1, 0x0a, 0xbc, 0x02, 0xaf, 0xc0, 0x2b, 
+	0xf0, 0x0a, 0xbc, 0x02, 0xaf, 0xc0, 0x2b, 0xf0, 0x4a, 0xbc, 0x12, 0xaf, 
+	0xc4, 0x2b, 0xf1, 0x4a, 0xbc, 0x12, 0xaf, 0xc4, 0x2b, 0xf1, 0x2a, 0xbc, 
+	0x0a, 0xaf, 0xc2, 0xab, 0xf0, 0x2a, 0xbc, 0x0a, 0xaf, 0xc2, 0xab, 0xf0, 
+	0x6a, 0xbc, 0x1a, 0xaf, 0xc6, 0xab, 0xf1, 0x6a, 0xbc, 0x1a, 0xaf, 0xc6, 
+	0xab, 0xf1, 0x04, 0x9e, 0xc0, 0x13, 0x78, 0x02, 0x4f, 0xe0, 0x09, 0x3c, 
+	0x81, 0x27, 0xf0, 0x24, 0x9e, 0xc4, 0x93, 0x78, 0x12, 0x4f, 0xe2, 0x49, 
+	0x3c, 0x89, 0x27, 0xf1, 0x1a, 0xbc, 0x06, 0xaf, 0xc1, 0x6b, 0xf0, 0x1a, 
+	0xbc, 0x06, 0xaf, 0xc1, 0x6b, 0xf0, 0x5a, 0xbc, 0x16, 0xaf, 0xc5, 0x6b, 
+	0xf1, 0x5a, 0xbc, 0x16, 0xaf, 0xc5, 0x6b, 0xf1, 0x3a, 0xbc, 0x0e, 0xaf, 
+	0xc3, 0xeb, 0xf0, 0x3a, 0xbc, 0x0e, 0xaf, 0xc3, 0xeb, 0xf0, 0x7a, 0xbc, 
+	0x1e, 0xaf, 0xc7, 0xeb, 0xf1, 0x7a, 0xbc, 0x1e, 0xaf, 0xc7, 0xeb, 0xf1, 
+	0x06, 0xbc, 0x01, 0x6f, 0xc0, 0x1b, 0xf0, 0x06, 0xbc, 0x01, 0x6f, 0xc0, 
+	0x1b, 0xf0, 0x46, 0xbc, 0x11, 0x6f, 0xc4, 0x1b, 0xf1, 0x46, 0xbc, 0x11, 
+	0x6f, 0xc4, 0x1b, 0xf1, 0x26, 0xbc, 0x09, 0x6f, 0xc2, 0x9b, 0xf0, 0x26, 
+	0xbc, 0x09, 0x6f, 0xc2, 0x9b, 0xf0, 0x66, 0xbc, 0x19, 0x6f, 0xc6, 0x9b, 
+	0xf1, 0x66, 0xbc, 0x19, 0x6f, 0xc6, 0x9b, 0xf1, 0x16, 0xbc, 0x05, 0x6f, 
+	0xc1, 0x5b, 0xf0, 0x16, 0xbc, 0x05, 0x6f, 0xc1, 0x5b, 0xf0, 0x56, 0xbc, 
+	0x15, 0x6f, 0xc5, 0x5b, 0xf1, 0x56, 0xbc, 0x15, 0x6f, 0xc5, 0x5b, 0xf1, 
+	0x36, 0xbc, 0x0d, 0x6f, 0xc3, 0xdb, 0xf0, 0x36, 0xbc, 0x0d, 0x6f, 0xc3, 
+	0xdb, 0xf0, 0x76, 0xbc, 0x1d, 0x6f, 0xc7, 0xdb, 0xf1, 0x76, 0xbc, 0x1d, 
+	0x6f, 0xc7, 0xdb, 0xf1, 0x0e, 0xbc, 0x03, 0xef, 0xc0, 0x3b, 0xf0, 0x0e, 
+	0xbc, 0x03, 0xef, 0xc0, 0x3b, 0xf0, 0x4e, 0xbc, 0x13, 0xef, 0xc4, 0x3b, 
+	0xf1, 0x4e, 0xbc, 0x13, 0xef, 0xc4, 0x3b, 0xf1, 0x2e, 0xbc, 0x0b, 0xef, 
+	0xc2, 0xbb, 0xf0, 0x2e, 0xbc, 0x0b, 0xef, 0xc2, 0xbb, 0xf0, 0xe0, 0xad, 
+	0x9f, 0xe2, 0x9f, 0x14, 0x9e, 0xc2, 0x53, 0x78, 0x0a, 0x4f, 0xe1, 0x29, 
+	0xbc, 0x1b, 0xef, 0xc6, 0xbb, 0xf1, 0x6e, 0xbc, 0x1b, 0xef, 0xc6, 0xbb, 
+	0xf1, 0x6e, 0xbc, 0x07, 0xef, 0xc1, 0x7b, 0xf0, 0x1e, 0xbc, 0x07, 0xef, 
+	0xc1, 0x7b, 0xf0, 0x1e, 0xbc, 0x17, 0xef, 0xc5, 0x7b, 0xf1, 0x5e, 0xbc, 
+	0x17, 0xef, 0xc5, 0x7b, 0xf1, 0x5e, 0xbc, 0x0f, 0xef, 0xc3, 0xfb, 0xf0, 
+	0x3e, 0xbc, 0x0f, 0xef, 0xc3, 0xfb, 0xf0, 0x3e, 0xbc, 0x1f, 0xef, 0xc7, 
+	0xfb, 0xf1, 0x7e, 0xbc, 0x1f, 0xef, 0xc7, 0xfb, 0xf1, 0x7e, 0x7c, 0x00, 
+	0x1f, 0xc0, 0x07, 0xf0, 0x01, 0x7c, 0x00, 0x1f, 0xc0, 0x07, 0xf0, 0x01, 
+	0x7c, 0x10, 0x1f, 0xc4, 0x07, 0xf1, 0x41, 0x7c, 0x10, 0x1f, 0xc4, 0x07, 
+	0xf1, 0x41, 0x7c, 0x08, 0x1f, 0xc2, 0x87, 0xf0, 0x21, 0x7c, 0x08, 0x1f, 
+	0xc2, 0x87, 0xf0, 0x21, 0x7c, 0x18, 0x1f, 0xc6, 0x87, 0xf1, 0x61, 0x7c, 
+	0x18, 0x1f, 0xc6, 0x87, 0xf1, 0x61, 0x7c, 0x04, 0x1f, 0xc1, 0x47, 0xf0, 
+	0x11, 0x7c, 0x04, 0x1f, 0xc1, 0x47, 0xf0, 0x11, 0x7c, 0x14, 0x1f, 0xc5, 
+	0x47, 0xf1, 0x51, 0x7c, 0x14, 0x1f, 0xc5, 0x47, 0xf1, 0x51, 0x7c, 0x0c, 
+	0x1f, 0xc3, 0xc7, 0xf0, 0x31, 0x7c, 0x0c, 0x1f, 0xc3, 0xc7, 0xf0, 0x31, 
+	0x7c, 0x17, 0xbe, 0x0b, 0xdf, 0x85, 0xef, 0xc2, 0x77, 0xe1, 0xbb, 0xf0, 
+	0x5d, 0xf8, 0x2e, 0x7c, 0x1c, 0x1f, 0xc7, 0xc7, 0xf1, 0x71, 0x7c, 0x1c, 
+	0x1f, 0xc7, 0xc7, 0xf1, 0x71, 0x7c, 0x02, 0x9f, 0xc0, 0x27, 0xf0, 0x09, 
+	0x7c, 0x02, 0x9f, 0xc0, 0x27, 0xf0, 0x09, 0x7c, 0x12, 0x9f, 0xc4, 0x27, 
+	0xf1, 0x49, 0x7c, 0x12, 0x9f, 0xc4, 0x27, 0xf1, 0x49, 0x7c, 0x0a, 0x9f, 
+	0xc2, 0xa7, 0xf0, 0x29, 0x7c, 0x0a, 0x9f, 0xc2, 0xa7, 0xf0, 0x29, 0x7c, 
+	0x1a, 0x9f, 0xc6, 0xa7, 0xf1, 0x69, 0x7c, 0x1a, 0x9f, 0xc6, 0xa7, 0xf1, 
+	0x69, 0x7c, 0x06, 0x9f, 0xc1, 0x67, 0xf0, 0x19, 0x7c, 0x06, 0x9f, 0xc1, 
+	0x67, 0xf0, 0x19, 0x7c, 0x16, 0x9f, 0xc5, 0x67, 0xf1, 0x59, 0x7c, 0x16, 
+	0x9f, 0xc5, 0x67, 0xf1, 0x59, 0x7c, 0x37, 0xbe, 0x1b, 0xdf, 0x8d, 0xef, 
+	0xc6, 0x77, 0xe3, 0xbb, 0xf1, 0xdd, 0xf8, 0x6e, 0x7c, 0x0e, 0x9f, 0xc3, 
+	0xe7, 0xf0, 0x39, 0x7c, 0x0e, 0x9f, 0xc3, 0xe7, 0xf0, 0x39, 0x7c, 0x0f, 
+	0xbe, 0x07, 0xdf, 0x83, 0xef, 0xc1, 0xf7, 0xe0, 0x7b, 0xf0, 0x3d, 0xf8, 
+	0x1e, 0x7c, 0x1e, 0x9f, 0xc7, 0xe7, 0xf1, 0x79, 0x7c, 0x1e, 0x9f, 0xc7, 
+	0xe7, 0xf1, 0x79, 0x7c, 0x01, 0x5f, 0xc0, 0x17, 0xf0, 0x05, 0x7c, 0x01, 
+	0x5f, 0xc0, 0x17, 0xf0, 0x05, 0x7c, 0x11, 0x5f, 0xc4, 0x17, 0xf1, 0x45, 
+	0x7c, 0x11, 0x5f, 0xc4, 0x17, 0xf1, 0x45, 0x7c, 0x2f, 0xbe, 0x17, 0xdf, 
+	0x8b, 0xef, 0xc5, 0xf7, 0xe2, 0x7b, 0xf1, 0xbd, 0xf8, 0x5e, 0x7c, 0x09, 
+	0x5f, 0xc2, 0x97, 0xf0, 0x25, 0x7c, 0x09, 0x5f, 0xc2, 0x97, 0xf0, 0x25, 
+	0x7c, 0x19, 0x5f, 0xc6, 0x97, 0xf1, 0x65, 0x7c, 0x19, 0x5f, 0xc6, 0x97, 
+	0xf1, 0x65, 0x7c, 0x05, 0x5f, 0xc1, 0x57, 0xf0, 0x15, 0x7c, 0x05, 0x5f, 
+	0xc1, 0x57, 0xf0, 0x15, 0x7c, 0x15, 0x5f, 0xc5, 0x57, 0xf1, 0x55, 0x7c, 
+	0x15, 0x5f, 0xc5, 0x57, 0xf1, 0xd5, 0xc0, 0x9f, 0x0e, 0x1a, 0x3e, 0x28, 
+	0xf9, 0xf5, 0x7c, 0x99, 0xe7, 0x1a, 0xdf, 0xcf, 0x9f, 0xe7, 0xe2, 0x7e, 
+	0x83, 0x4b, 0x05, 0x23, 0x9e, 0xcc, 0xe5, 0x99, 0x22, 0x2b, 0x09, 0x47, 
+	0xe1, 0x14, 0x9c, 0x1f, 0x09, 0x97, 0xc1, 0xdf, 0x88, 0x86, 0xbf, 0xfb, 
+	0x45, 0x7f, 0xb3, 0xb0, 0xa1, 0x91, 0x0e, 0x2f, 0xdb, 0x1c, 0x9e, 0xc5, 
+	0x9d, 0xf9, 0x04, 0x77, 0xec, 0x20, 0xe7, 0x7f, 0x87, 0xfc, 0x28, 0xf9, 
+	0x99, 0x8c, 0xf3, 0x28, 0x7d, 0x8f, 0x37, 0xb8, 0x77, 0x7a, 0xd6, 0x79, 
+	0x97, 0x92, 0x6f, 0x21, 0xff, 0x80, 0xfc, 0x3b, 0xf2, 0xf3, 0x19, 0xe7, 
+	0x53, 0xaa, 0x3e, 0x6f, 0x20, 0x7f, 0x5f, 0xd6, 0xf9, 0x57, 0x92, 0x6f, 
+	0x23, 0x3f, 0x40, 0x7e, 0x9c, 0x7c, 0x38, 0x93, 0x2f, 0xad, 0xfc, 0x16, 
+	0xcc, 0x09, 0x8d, 0xc8, 0x13, 0xc1, 0xe3, 0x5a, 0xce, 0xfd, 0x1e, 0xf4, 
+	0x70, 0xcc, 0x3d, 0xe1, 0xfc, 0x03, 0x69, 0x57, 0x71, 0xe0, 0x32, 0xe7, 
+	0xb3, 0xd1, 0xe3, 0xb1, 0xd1, 0x93, 0xf0, 0xf7, 0x3b, 0x8f, 0x8d, 0x9b, 
+	0xa0, 0xc7, 0xe3, 0x6c, 0x34, 0xa9, 0xc7, 0x70, 0x9f, 0x8d, 0xa1, 0xe0, 
+	0xf9, 0x8b, 0xf3, 0x67, 0xfd, 0x03, 0x19, 0xfc, 0x5e, 0xce, 0xbb, 0xc8, 
+	0x79, 0x07, 0x33, 0xae, 0xfa, 0xe0, 0x9d, 0x2e, 0x1e, 0x6c, 0x14, 0x15, 
+	0x9e, 0xc5, 0x60, 0xfb, 0x82, 0x4f, 0x25, 0xdf, 0x3d, 0xc4, 0xad, 0x3e, 
+	0xc5, 0x39, 0xcf, 0x05, 0x63, 0x7d, 0x7d, 0xfd, 0x25, 0xef, 0x81, 0xf5, 
+	0x75, 0x77, 0x9c, 0x13, 0xfe, 0x1f, 0xf7, 0xef, 0x4d, 0xdc, 0xdb, 0xf0, 
+	0x57, 0xdd, 0x85, 0x9b, 0xb8, 0x5f, 0xf0, 0x97, 0x4b, 0xdb, 0x7f, 0x99, 
+	0xf3, 0xc2, 0x6b, 0x5a, 0x9f, 0xfb, 0x37, 0xba, 0x71, 0xfd, 0x17, 0xdd, 
+	0x39, 0x9b, 0x5c, 0x3f, 0xbe, 0xe1, 0x6f, 0xb8, 0x89, 0x4d, 0x3c, 0xb9, 
+	0xe1, 0xaf, 0x79, 0x9b, 0xdd, 0xbf, 0xd4, 0x86, 0xbf, 0xb2, 0xe9, 0xf5, 
+	0xd3, 0x1b, 0xfe, 0x92, 0xf7, 0xd5, 0xad, 0x1f, 0xbf, 0x97, 0x38, 0xb5, 
+	0x1f, 0xbf, 0xdb, 0xee, 0xf1, 0x9f, 0xb3, 0xe5, 0xe3, 0x5f, 0x77, 0x8f, 
+	0x1f, 0xe5, 0x87, 0xe4, 0xf1, 0x6f, 0xee, 0xde, 0x36, 0xee, 0x6f, 0xe3, 
+	0xd1, 0x6d, 0x3c, 0xbe, 0x8d, 0x27, 0xb7, 0xf1, 0xd4, 0x36, 0x5e, 0xf4, 
+	0xfa, 0xfb, 0x89, 0x53, 0xfa, 0xf5, 0xbf, 0x35, 0xba, 0xf5, 0xeb, 0xff, 
+	0x8d, 0x92, 0xc7, 0xb7, 0x7e, 0xfd, 0x37, 0xbd, 0xff, 0x45, 0x8f, 0xdf, 
+	0x6d, 0xf3, 0xf8, 0xdd, 0x8e, 0x1e, 0xff, 0x7a, 0xe1, 0xf1, 0xbb, 0xff, 
+	0xdb, 0xfa, 0x9f, 0xd8, 0xf2, 0xf1, 0x6f, 0xf7, 0xfa, 0xbf, 0xd7, 0xd7, 
+	0xff, 0xf7, 0x1f, 0xff, 0x7b, 0xf8, 0xf1, 0x73, 0x47, 0x6b, 0xc2, 0xcd, 
+	0xa9, 0x68, 0x70, 0xe9, 0xa3, 0x47, 0xee, 0xaf, 0x04, 0x33, 0xb5, 0x60, 
+	0x36, 0x16, 0xcc, 0xb8, 0x82, 0x59, 0x55, 0x30, 0x73, 0x0a, 0x66, 0x47, 
+	0xc1, 0x0c, 0x28, 0x98, 0xe5, 0x04, 0x33, 0x99, 0x60, 0xb6, 0x12, 0xcc, 
+	0x48, 0x82, 0x59, 0x47, 0x30, 0xb3, 0x08, 0x66, 0x0f, 0x13, 0xe1, 0xbd, 
+	0xf4, 0x76, 0x3a, 0x62, 0xeb, 0xb9, 0xfb, 0xb2, 0x1a, 0x2e, 0x13, 0xce, 
+	0x5d, 0xff, 0x7a, 0x7e, 0x14, 0x1e, 0xd6, 0x09, 0x2f, 0xdb, 0x13, 0xb9, 
+	0xbf, 0xf9, 0xfe, 0xf2, 0xbd, 0xb9, 0x8c, 0xd4, 0xe5, 0x77, 0x04, 0x6d, 
+	0xcc, 0x23, 0x22, 0xe1, 0x8a, 0x11, 0x3d, 0xf2, 0x0e, 0xdf, 0x98, 0x73, 
+	0x14, 0x7e, 0x8f, 0xbc, 0x8d, 0xf3, 0xa3, 0x45, 0xe7, 0x07, 0xab, 0x70, 
+	0x70, 0x9b, 0xeb, 0x45, 0x97, 0xcb, 0x8f, 0xeb, 0x92, 0xd1, 0xa2, 0x79, 
+	0xcd, 0x5a, 0x6e, 0x64, 0xdc, 0x5a, 0x38, 0x37, 0xba, 0x35, 0xdc, 0x79, 
+	0x7a, 0x20, 0x5c, 0x96, 0x32, 0x61, 0x60, 0x02, 0x11, 0xbb, 0x22, 0xd6, 
+	0x31, 0x5c, 0x93, 0xbb, 0xc4, 0x5d, 0xd1, 0xbe, 0x63, 0xfe, 0xe6, 0xc6, 
+	0xb8, 0x7e, 0x3d, 0x5c, 0xe1, 0x8b, 0xc7, 0xf5, 0x92, 0x57, 0x0a, 0x77, 
+	0x70, 0x8b, 0x11, 0xec, 0xf1, 0x73, 0xb5, 0x4d, 0x7c, 0x18, 0x30, 0xa6, 
+	0x19, 0xb5, 0x3c, 0x75, 0x3d, 0x8c, 0x69, 0x86, 0x9f, 0xcc, 0xbf, 0xdb, 
+	0x93, 0x8c, 0x14, 0x63, 0x32, 0xcc, 0xb5, 0xb4, 0x7d, 0x0f, 0x63, 0x3a, 
+	0x68, 0xfd, 0x7f, 0xde, 0x90, 0x5e, 0xdf, 0xe6, 0x74, 0xd8, 0xed, 0x77, 
+	0x87, 0xb9, 0xe2, 0x71, 0x2f, 0x90, 0x59, 0x73, 0xeb, 0x3b, 0x38, 0x31, 
+	0xf9, 0x4d, 0x16, 0xbd, 0xb6, 0xf1, 0x70, 0xf8, 0xe1, 0xf3, 0x5f, 0x12, 
+	0x2e, 0x83, 0x9d, 0x76, 0x9c, 0x1f, 0x8f, 0xe4, 0x47, 0x61, 0x5e, 0x19, 
+	0x3f, 0x32, 0xbc, 0xe2, 0xec, 0x76, 0x30, 0xfa, 0x22, 0xe1, 0x67, 0x65, 
+	0xb0, 0x47, 0xb8, 0x85, 0xbb, 0x76, 0x23, 0xe3, 0x06, 0xa8, 0x34, 0x9f, 
+	0x83, 0xd7, 0x3b, 0x52, 0x34, 0x2a, 0x6f, 0x3a, 0xf2, 0xbb, 0xdb, 0xc1, 
+	0xc8, 0x5d, 0xbf, 0x2e, 0xff, 0x7b, 0xb0, 0xfe, 0x31, 0x92, 0x97, 0xa4, 
+	0x73, 0xe3, 0x78, 0x1b, 0x53, 0x45, 0xa7, 0xe8, 0x26, 0xe7, 0x85, 0x97, 
+	0xbb, 0x2e, 0x9c, 0xdb, 0x06, 0xeb, 0xcc, 0x5d, 0xe1, 0xed, 0x05, 0xcf, 
+	0x6b, 0x79, 0x7e, 0x99, 0xdb, 0xe1, 0x5f, 0x7c, 0x1b, 0xc1, 0x0e, 0xff, 
+	0xd5, 0x70, 0x3d, 0x3d, 0x33, 0x1c, 0x85, 0xd3, 0x99, 0xe1, 0xeb, 0xb1, 
+	0xdd, 0x08, 0x9e, 0xbb, 0x8a, 0xf0, 0x36, 0x34, 0xbf, 0xdd, 0xbe, 0x39, 
+	0xd9, 0xd7, 0x2f, 0x5a, 0xd5, 0xfc, 0x70, 0x7f, 0x48, 0x74, 0xe3, 0xdc, 
+	0xce, 0xb3, 0xf2, 0x3f, 0xd5, 0xe1, 0x4f, 0x7e, 0x1d, 0x0d, 0x4e, 0xfd, 
+	0xcf, 0xe4, 0xdf, 0xee, 0xae, 0x2e, 0xb1, 0x9e, 0xd8, 0xe8, 0xef, 0xe0, 
+	0xf7, 0xa4, 0xcb, 0xff, 0xa4, 0xc2, 0x9f, 0x4c, 0xf8, 0x93, 0x0e, 0x7f, 
+	0x0a, 0x9f, 0x05, 0xb9, 0x53, 0x2a, 0xf7, 0x1f, 0xa7, 0xe4, 0x31, 0xf9, 
+	0x78, 0xe7, 0x17, 0xf2, 0x76, 0xd7, 0xdf, 0x2e, 0x9f, 0xea, 0xaf, 0xcd, 
+	0xf1, 0x9e, 0xfb, 0x13, 0x7c, 0xbe, 0xfd, 0xa2, 0x1e, 0x88, 0x16, 0xad, 
+	0xf7, 0x31, 0xce, 0xee, 0x3d, 0xb9, 0x23, 0xf7, 0x46, 0x9b, 0x76, 0xe1, 
+	0x51, 0x28, 0xdd, 0xa7, 0x16, 0xec, 0x79, 0x2d, 0xda, 0xaf, 0x16, 0xec, 
+	0x89, 0x9d, 0x0a, 0xef, 0x5f, 0x49, 0x78, 0xbf, 0x7c, 0xd9, 0xdf, 0xe6, 
+	0xcb, 0x3e, 0xb5, 0xd2, 0xa2, 0x4e, 0x2c, 0xec, 0x57, 0x4b, 0x85, 0x9f, 
+	0x17, 0xa9, 0xbc, 0x44, 0xb3, 0x2e, 0x52, 0x96, 0x71, 0xd1, 0xea, 0xb4, 
+	0x2b, 0xe1, 0xec, 0xd2, 0xa6, 0xac, 0x8b, 0xb5, 0x67, 0x5c, 0xbc, 0x3b, 
+	0xed, 0xca, 0xd8, 0x3c, 0x2c, 0x1f, 0xc9, 0xba, 0x8a, 0x89, 0x8c, 0xab, 
+	0x9c, 0x4d, 0xbb, 0xaa, 0x05, 0xe7, 0xaa, 0x97, 0xb3, 0x2e, 0x71, 0x5a, 
+	0xc6, 0x25, 0xcf, 0x48, 0xbb, 0x9a, 0x7d, 0x14, 0xc3, 0xfe, 0xac, 0xab, 
+	0x3b, 0x37, 0xe3, 0xea, 0x2f, 0x48, 0xbb, 0x86, 0x0b, 0x9d, 0x6b, 0xfc, 
+	0x64, 0xd6, 0x35, 0x5d, 0x96, 0x71, 0xcd, 0x57, 0xa6, 0x5d, 0xcb, 0xd5, 
+	0xce, 0xb5, 0x5e, 0x93, 0x75, 0x6d, 0xd7, 0x66, 0x5c, 0x7b, 0x26, 0xed, 
+	0x3a, 0xbe, 0xc8, 0x1b, 0xe5, 0x4b, 0x59, 0xd7, 0x75, 0x1b, 0x6f, 0x88, 
+	0xdb, 0xd3, 0x27, 0x61, 0x9b, 0x32, 0x78, 0x33, 0x56, 0x1e, 0xbb, 0x7d, 
+	0x5a, 0xbc, 0x2d, 0xec, 0xb7, 0xe8, 0xf6, 0xf0, 0xf1, 0xb7, 0x43, 0xc3, 
+	0xee, 0x4d, 0xe5, 0xd6, 0x79, 0x7e, 0x59, 0x2b, 0x54, 0x8c, 0xb7, 0x31, 
+	0xe9, 0x2d, 0x0f, 0xae, 0xb2, 0xe6, 0x1f, 0xfd, 0x79, 0xb9, 0x16, 0x95, 
+	0x5c, 0x2a, 0x39, 0x2e, 0xb9, 0x5c, 0x72, 0xa5, 0xe4, 0x6a, 0xc9, 0x49, 
+	0xc9, 0xb5, 0x92, 0xeb, 0x25, 0x37, 0x4a, 0x6e, 0x96, 0xdc, 0x2a, 0xb9, 
+	0x5d, 0x72, 0xa7, 0x64, 0x29, 0x89, 0xb5, 0x1e, 0xc9, 0x7d, 0x92, 0x07, 
+	0x24, 0x0f, 0x49, 0x1e, 0x91, 0x3c, 0x26, 0x79, 0x5c, 0xf2, 0xa4, 0xe4, 
+	0x69, 0xc9, 0xb3, 0x92, 0xe7, 0x24, 0xcf, 0x4b, 0x5e, 0x94, 0xbc, 0x24, 
+	0x79, 0x45, 0xb2, 0x74, 0xe9, 0xda, 0x69, 0x92, 0x3f, 0x28, 0xf9, 0x74, 
+	0xc9, 0x67, 0x4a, 0xfe, 0x90, 0xe4, 0x7d, 0x92, 0xcf, 0x96, 0xbc, 0x5f, 
+	0xf2, 0x87, 0x25, 0x7f, 0x44, 0xf2, 0x79, 0x92, 0xcf, 0x97, 0x7c, 0x81, 
+	0xe4, 0x8f, 0x4a, 0xfe, 0xb8, 0xe4, 0x8b, 0x24, 0x5f, 0x2c, 0xf9, 0x12, 
+	0xc9, 0x9f, 0x92, 0x7c, 0x99, 0xe4, 0xcb, 0x25, 0x5f, 0x21, 0xf9, 0xd3, 
+	0x92, 0xaf, 0x92, 0x7c, 0xb5, 0xe4, 0xcf, 0x4a, 0xbe, 0x46, 0xf2, 0xe7, 
+	0x24, 0x7f, 0x5e, 0xf2, 0x75, 0x92, 0xbf, 0x20, 0x39, 0x23, 0xf9, 0xa0, 
+	0xe4, 0x1b, 0x25, 0xdf, 0x24, 0xf9, 0x16, 0xc9, 0xb7, 0x4a, 0xfe, 0x8a, 
+	0xe4, 0xdb, 0x24, 0xaf, 0x49, 0xfe, 0x9a, 0xe4, 0xaf, 0x4b, 0xbe, 0x43, 
+	0xf2, 0x9d, 0x92, 0xbf, 0x29, 0xf9, 0x2e, 0xc9, 0xdf, 0x92, 0x7c, 0xb7, 
+	0xe4, 0x6f, 0x4b, 0xbe, 0x47, 0xf2, 0xf7, 0x24, 0xdf, 0x2b, 0xf9, 0x87, 
+	0x92, 0xef, 0x93, 0xfc, 0x23, 0xc9, 0x3f, 0x96, 0xfc, 0x13, 0xc9, 0x0f, 
+	0x4a, 0xfe, 0x99, 0xe4, 0x87, 0x24, 0xff, 0x5c, 0xf2, 0xc3, 0x92, 0x1f, 
+	0x91, 0x9c, 0x95, 0xfc, 0x2b, 0xc9, 0xbf, 0x96, 0xfc, 0x1b, 0xc9, 0xbf, 
+	0x95, 0xfc, 0x7b, 0xc9, 0x87, 0x24, 0xff, 0x49, 0xf2, 0x13, 0x92, 0x9f, 
+	0x94, 0xfc, 0x67, 0xc9, 0x7f, 0x91, 0xfc, 0x94, 0xe4, 0xbf, 0x4a, 0xfe, 
+	0x9b, 0xe4, 0xbf, 0x4b, 0x7e, 0x5a, 0xf2, 0x3f, 0x24, 0x3f, 0x23, 0xf9, 
+	0x59, 0xc9, 0xcf, 0x49, 0x7e, 0x5e, 0xf2, 0xbf, 0x24, 0xbf, 0x20, 0xf9, 
+	0xb0, 0xe4, 0x17, 0x25, 0xbf, 0x2c, 0xf9, 0x55, 0xc9, 0xaf, 0x4b, 0x7e, 
+	0x43, 0xf2, 0x7f, 0x25, 0xbf, 0x79, 0x74, 0x36, 0x99, 0x1f, 0x99, 0xf4, 
+	0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 
+	0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 
+	0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 
+	0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 
+	0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 
+	0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 
+	0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 
+	0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 
+	0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 
+	0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 
+	0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 
+	0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 
+	0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 
+	0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 
+	0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 
+	0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 
+	0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 
+	0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 
+	0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 
+	0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 
+	0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 
+	0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 
+	0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 
+	0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 
+	0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 
+	0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 0xff, 0x9b, 0xf4, 0xbf, 0x49, 
+	0xff, 0xdb, 0x9b, 0x3b, 0x3f, 0x26, 0xe5, 0x7d, 0x3f, 0xff, 0xe5, 0xb4, 
+	0x77, 0xfc, 0x98, 0x44, 0xc4, 0x3d, 0xf2, 0x70, 0xaa, 0x68, 0x9f, 0xd0, 
+	0x3b, 0x9d, 0xab, 0xc2, 0x7d, 0x32, 0xb9, 0xa3, 0x9b, 0x6f, 0x61, 0x5f, 
+	0x56, 0xb4, 0x68, 0xbf, 0x9b, 0x5f, 0xf4, 0x7b, 0x4c, 0xf6, 0x65, 0x45, 
+	0x36, 0xd9, 0x97, 0x15, 0x0d, 0xf7, 0x67, 0x05, 0xc7, 0x34, 0xda, 0x72, 
+	0xfb, 0x59, 0xbd, 0x48, 0xd6, 0x79, 0x37, 0x87, 0xdf, 0xfd, 0xfa, 0x2a, 
+	0xd7, 0xaa, 0xcd, 0xba, 0xc8, 0x1d, 0x19, 0x17, 0x6d, 0x4d, 0xbb, 0x28, 
+	0x1f, 0x6b, 0x25, 0xdd, 0x59, 0x57, 0xf2, 0xdd, 0x8c, 0x2b, 0x1d, 0x4e, 
+	0xbb, 0xd2, 0xfb, 0xb9, 0x95, 0xc9, 0xac, 0x8b, 0x3d, 0x98, 0x71, 0xf1, 
+	0xf9, 0xb4, 0x8b, 0xf3, 0x31, 0x50, 0xb6, 0x9a, 0x75, 0x65, 0x8f, 0x66, 
+	0x5c, 0xf9, 0x19, 0x69, 0x57, 0xfe, 0x07, 0xe7, 0x2a, 0xce, 0xce, 0xba, 
+	0x8a, 0x27, 0x33, 0xae, 0xf2, 0xbc, 0xb4, 0xab, 0xe4, 0x6d, 0x53, 0xf5, 
+	0xb1, 0x6c, 0xfe, 0xbb, 0x68, 0x3b, 0x3f, 0x1e, 0xca, 0xd3, 0x53, 0x13, 
+	0x7e, 0xc1, 0x3a, 0xd8, 0x6f, 0xdf, 0xbd, 0xc9, 0x71, 0xdb, 0xd3, 0x8f, 
+	0x1c, 0x21, 0xce, 0x9d, 0x9a, 0x8b, 0xf7, 0x45, 0x15, 0xd6, 0x89, 0xe3, 
+	0xef, 0xcf, 0x6a, 0xd9, 0x38, 0x76, 0xbc, 0xf5, 0xb1, 0x94, 0x1d, 0xaf, 
+	0xeb, 0xfb, 0xde, 0xa5, 0x75, 0xdd, 0x45, 0x6e, 0xbf, 0xf9, 0xa8, 0x27, 
+	0x43, 0x72, 0xa2, 0x68, 0xbf, 0x6a, 0x75, 0x84, 0xf5, 0x30, 0x18, 0xde, 
+	0xe6, 0xeb, 0x62, 0x24, 0xdc, 0x5f, 0x5a, 0x38, 0xa6, 0x53, 0xbc, 0x2e, 
+	0xba, 0xd0, 0xf4, 0x3b, 0x8b, 0xd1, 0x2d, 0xd6, 0xc9, 0xf0, 0xfb, 0x8c, 
+	0xc1, 0x0d, 0x05, 0x5f, 0x9a, 0x0e, 0x6e, 0xe2, 0x03, 0x2c, 0x83, 0x4d, 
+	0xb7, 0x8b, 0x59, 0x7e, 0x86, 0xe5, 0x0d, 0x2c, 0x83, 0xea, 0xbe, 0x87, 
+	0xe5, 0x4f, 0x59, 0x3e, 0xc6, 0x32, 0xf8, 0xe8, 0x7e, 0x96, 0xe5, 0x6b, 
+	0xc1, 0x2b, 0x9b, 0x71, 0x1e, 0x2f, 0xb9, 0x37, 0xc4, 0x72, 0x81, 0xe5, 
+	0x59, 0x2c, 0xd9, 0x74, 0xf3, 0x2e, 0x67, 0x79, 0x2d, 0xcb, 0x2f, 0xb3, 
+	0xa4, 0xba, 0xbd, 0xfb, 0x58, 0xfe, 0x82, 0xe5, 0x1f, 0x59, 0xf2, 0xd1, 
+	0xed, 0xbd, 0x90, 0xc9, 0x1d, 0x9e, 0xc8, 0x7d, 0x99, 0xff, 0x64, 0xac, 
+	0xa7, 0xc5, 0xa3, 0x96, 0x6d, 0xfd, 0xda, 0xf0, 0x88, 0xe0, 0xa6, 0xdf, 
+	0x33, 0x28, 0x9e, 0x2b, 0x6c, 0xf6, 0x5d, 0x03, 0xfd, 0x9e, 0xc1, 0x36, 
+	0xdf, 0x0d, 0xc8, 0xaf, 0x0b, 0x87, 0x0e, 0xf9, 0x8c, 0xe0, 0x74, 0x62, 
+	0xcb, 0xed, 0xdf, 0x03, 0xb9, 0x7b, 0xe2, 0xb9, 0xd9, 0x78, 0x8c, 0x8b, 
+	0x3f, 0x96, 0x5f, 0x3d, 0x86, 0xee, 0xbf, 0xea, 0xfc, 0xe4, 0xd2, 0x0e, 
+	0xbf, 0x9b, 0x50, 0x58, 0x8d, 0x2e, 0x7d, 0x57, 0xde, 0x23, 0x03, 0xfd, 
+	0xf9, 0x6d, 0xb7, 0xe3, 0x2d, 0x99, 0x69, 0x7a, 0x8d, 0xac, 0x74, 0xdb, 
+	0x5d, 0xee, 0xea, 0xdc, 0x11, 0x8b, 0x97, 0xc2, 0xd7, 0xd9, 0xbd, 0xf5, 
+	0x65, 0xe1, 0xf4, 0x76, 0xaf, 0xf7, 0xfe, 0xf5, 0x4f, 0xc5, 0xeb, 0x9f, 
+	0xcb, 0x4c, 0xf3, 0x5c, 0x4e, 0xc1, 0xbf, 0x87, 0xdf, 0x42, 0xde, 0x58, 
+	0x4b, 0xdd, 0xfe, 0xdc, 0x3e, 0x8a, 0x75, 0x66, 0x9a, 0xeb, 0xaf, 0x5c, 
+	0x98, 0xfb, 0xbc, 0x38, 0x9c, 0xfb, 0x1f, 0xbc, 0x82, 0xd3, 0xdd, 0xae, 
+	0xf8, 0x58, 0x6a, 0xb8, 0xe9, 0x20, 0x59, 0xa6, 0xe0, 0xde, 0x56, 0x7f, 
+	0x4b, 0x76, 0xb7, 0x1c, 0x73, 0x8c, 0x5b, 0xa6, 0x73, 0xbc, 0x1b, 0xff, 
+	0x07, 0x5c, 0x33, 0x89, 0xd4, 0xe4, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, };
 
 static const u8 csem_int_table_data_e1h[] = {
 	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xcb, 0xe0, 
@@ -14046,20 +12602,25 @@ static const u8 xsem_pram_data_e1h[] = {
 	0x90, 0x37, 0x00, 0x00, };
 
 #ifdef __KERNEL__
-void bnx2x_init_e1h_firmware(struct bnx2x *bp)
-{
-	INIT_OPS(bp)                  = (struct raw_op *)init_ops_e1h;
-	INIT_DATA(bp)                 = (u32 *)init_data_e1h;
-	INIT_OPS_OFFSETS(bp)          = (u16 *)init_ops_offsets_e1h;
-	INIT_TSEM_INT_TABLE_DATA(bp)  = tsem_int_table_data_e1h;
-	INIT_TSEM_PRAM_DATA(bp)       = tsem_pram_data_e1h;
-	INIT_USEM_INT_TABLE_DATA(bp)  = usem_int_table_data_e1h;
-	INIT_USEM_PRAM_DATA(bp)       = usem_pram_data_e1h;
-	INIT_XSEM_INT_TABLE_DATA(bp)  = xsem_int_table_data_e1h;
-	INIT_XSEM_PRAM_DATA(bp)       = xsem_pram_data_e1h;
-	INIT_CSEM_INT_TABLE_DATA(bp)  = csem_int_table_data_e1h;
-	INIT_CSEM_PRAM_DATA(bp)       = csem_pram_data_e1h;
-}
+const struct bnx2x_init_values bnx2x_init_values_e1h = {
+	.ops                  = init_ops_zipped_e1h,
+	.ops_zlen             = sizeof(init_ops_zipped_e1h),
+	.ops_len              = 8680,
+	.ops_offsets          = init_ops_offsets_zipped_e1h,
+	.ops_offsets_zlen     = sizeof(init_ops_offsets_zipped_e1h),
+	.ops_offsets_len      = 1496,
+	.data                 = init_data_zipped_e1h,
+	.data_zlen            = sizeof(init_data_zipped_e1h),
+	.data_len             = 14052,
+	.tsem_int_table_data  = tsem_int_table_data_e1h,
+	.tsem_pram_data       = tsem_pram_data_e1h,
+	.usem_int_table_data  = usem_int_table_data_e1h,
+	.usem_pram_data       = usem_pram_data_e1h,
+	.xsem_int_table_data  = xsem_int_table_data_e1h,
+	.xsem_pram_data       = xsem_pram_data_e1h,
+	.csem_int_table_data  = csem_int_table_data_e1h,
+	.csem_pram_data       = csem_pram_data_e1h,
+};
 #endif
 
 // Total size: 41910 regs
@@ -16,6 +16,10 @@
 * OP_WR_64       - write a 64-bit pattern to consecutive registers.
 * OP_IF_MODE_OR  - skip next ops if all modes do not match.
 * OP_IF_MODE_AND - skip next ops if at least one mode does not match.
+*
+* The operations, their block offsets and the data blob are stored zipped in
+* the big endian layout of the bnx2x firmware file and are inflated by
+* bnx2x_init_firmware() only for the chip being initialized.
 */
 #ifdef __KERNEL__
 #include <linux/version.h>
@@ -28,3137 +32,946 @@
 #include "bnx2x_init.h"
 #endif
 
-static const struct raw_op init_ops_e2[] = {
-/* #define ATC_COMMON_START        0 */
-	{OP_WR, 0x1100b8, 0x1},
-/* #define ATC_COMMON_END          1 */
-/* #define BRB1_COMMON_START        22 */
-	{OP_WR, 0x600dc, 0x1},
-	{OP_SW, 0x61000, 0x1ff0000},
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_WR, 0x617fc, 0x3fe001},
-	{OP_IF_MODE_AND, 1, 0x10}, /* e3 */
-	{OP_SW, 0x617fc, 0x20101ff},
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_SW, 0x60200, 0x30400},
-	{OP_IF_MODE_AND, 1, 0x10}, /* e3 */
-	{OP_SW, 0x60200, 0x30403},
-	{OP_IF_MODE_AND, 1, 0x2000}, /* e3_b0 */
-	{OP_ZR, 0x6024c, 0x2},
-	{OP_IF_MODE_AND, 4, 0x2020}, /* e3_b0+port2 */
-	{OP_SW, 0x601e0, 0x40406},
-	{OP_SW, 0x60244, 0x2040a},
-	{OP_SW, 0x60254, 0x2040c},
-	{OP_SW, 0x60264, 0x2040e},
-	{OP_IF_MODE_AND, 3, 0x2040}, /* e3_b0+port4 */
-	{OP_SW, 0x601e0, 0x40410},
-	{OP_SW, 0x60240, 0x30414},
-	{OP_WR, 0x60264, 0x28},
-	{OP_WR, 0x600dc, 0x0},
-/* #define BRB1_COMMON_END          23 */
-/* #define BRB1_PORT0_START        24 */
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_SW, 0x601d8, 0x20417},
-	{OP_IF_MODE_AND, 2, 0x2020}, /* e3_b0+port2 */
-	{OP_SW, 0x601c0, 0x20419},
-	{OP_SW, 0x601d0, 0x4041b},
-	{OP_IF_MODE_AND, 2, 0x2040}, /* e3_b0+port4 */
-	{OP_SW, 0x601c0, 0x2041f},
-	{OP_SW, 0x601d0, 0x40421},
-/* #define BRB1_PORT0_END          25 */
-/* #define BRB1_PORT1_START        26 */
-	{OP_IF_MODE_AND, 2, 0x2040}, /* e3_b0+port4 */
-	{OP_SW, 0x60220, 0x20425},
-	{OP_SW, 0x60230, 0x40427},
-/* #define BRB1_PORT1_END          27 */
-/* #define CCM_COMMON_START        44 */
-	{OP_WR, 0xd0044, 0x32},
-	{OP_SW, 0xd004c, 0x4042b},
-	{OP_ZR, 0xd005c, 0x4},
-	{OP_SW, 0xd008c, 0x4042f},
-	{OP_SW, 0xd00a0, 0x50433},
-	{OP_WR, 0xd00b8, 0x2},
-	{OP_SW, 0xd00c0, 0x40438},
-	{OP_WR, 0xd015c, 0x1},
-	{OP_SW, 0xd0164, 0x2043c},
-	{OP_WR, 0xd0204, 0x1},
-	{OP_SW, 0xd020c, 0x3043e},
-	{OP_SW, 0xd0220, 0x20441},
-	{OP_ZR, 0xd0280, 0x12},
-	{OP_SW, 0xd0300, 0x180443},
-	{OP_ZR, 0xd4000, 0xa00},
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_ZR, 0xd0360, 0xc},
-	{OP_SW, 0xd0004, 0xf045b},
-/* #define CCM_COMMON_END          45 */
-/* #define CCM_PF0_START        50 */
-	{OP_WR, 0xd0114, 0xd},
-/* #define CCM_PF0_END          51 */
-/* #define CCM_PF1_START        52 */
-	{OP_WR, 0xd0118, 0x2d},
-/* #define CCM_PF1_END          53 */
-/* #define CCM_PF2_START        54 */
-	{OP_WR, 0xd0114, 0x1d},
-/* #define CCM_PF2_END          55 */
-/* #define CCM_PF3_START        56 */
-	{OP_WR, 0xd0118, 0x3d},
-/* #define CCM_PF3_END          57 */
-/* #define CCM_PF4_START        58 */
-	{OP_WR, 0xd0114, 0x4d},
-/* #define CCM_PF4_END          59 */
-/* #define CCM_PF5_START        60 */
-	{OP_WR, 0xd0118, 0x6d},
-/* #define CCM_PF5_END          61 */
-/* #define CCM_PF6_START        62 */
-	{OP_WR, 0xd0114, 0x5d},
-/* #define CCM_PF6_END          63 */
-/* #define CCM_PF7_START        64 */
-	{OP_WR, 0xd0118, 0x7d},
-/* #define CCM_PF7_END          65 */
-/* #define CDU_COMMON_START        66 */
-	{OP_SW, 0x101000, 0x3046a},
-	{OP_WR, 0x101050, 0x1},
-	{OP_WB, 0x101100, 0x10046d},
-	{OP_WB_ZR, 0x101140, 0x8},
-	{OP_WB, 0x101160, 0x10047d},
-	{OP_WB_ZR, 0x1011a0, 0x18},
-	{OP_WB, 0x101800, 0x200048d},
-/* #define CDU_COMMON_END          67 */
-/* #define CFC_COMMON_START        88 */
-	{OP_ZR, 0x104c00, 0x100},
-	{OP_WR, 0x107004, 0x1},
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_SW, 0x1040d4, 0x2068d},
-	{OP_WR, 0x104028, 0x10},
-	{OP_WR, 0x104044, 0x3fff},
-	{OP_WR, 0x104058, 0x280000},
-	{OP_WR, 0x104084, 0x84924a},
-	{OP_WR, 0x104058, 0x0},
-/* #define CFC_COMMON_END          89 */
-/* #define CFC_PF0_START        94 */
-	{OP_WR, 0x104138, 0x1},
-/* #define CFC_PF0_END          95 */
-/* #define CFC_PF1_START        96 */
-	{OP_WR, 0x104138, 0x1},
-/* #define CFC_PF1_END          97 */
-/* #define CFC_PF2_START        98 */
-	{OP_WR, 0x104138, 0x1},
-/* #define CFC_PF2_END          99 */
-/* #define CFC_PF3_START        100 */
-	{OP_WR, 0x104138, 0x1},
-/* #define CFC_PF3_END          101 */
-/* #define CFC_PF4_START        102 */
-	{OP_WR, 0x104138, 0x1},
-/* #define CFC_PF4_END          103 */
-/* #define CFC_PF5_START        104 */
-	{OP_WR, 0x104138, 0x1},
-/* #define CFC_PF5_END          105 */
-/* #define CFC_PF6_START        106 */
-	{OP_WR, 0x104138, 0x1},
-/* #define CFC_PF6_END          107 */
-/* #define CFC_PF7_START        108 */
-	{OP_WR, 0x104138, 0x1},
-/* #define CFC_PF7_END          109 */
-/* #define CSDM_COMMON_START        110 */
-	{OP_SW, 0xc2008, 0x3068f},
-	{OP_SW, 0xc201c, 0x40692},
-	{OP_SW, 0xc2038, 0x40696},
-	{OP_ZR, 0xc2048, 0x1d},
-	{OP_WR, 0xc20bc, 0x1},
-	{OP_ZR, 0xc20c0, 0x3f},
-	{OP_SW, 0xc21bc, 0x3069a},
-	{OP_ZR, 0xc21c8, 0x1c},
-	{OP_SW, 0xc2238, 0x4069d},
-	{OP_RD, 0xc2248, 0x0},
-	{OP_RD, 0xc224c, 0x0},
-	{OP_RD, 0xc2250, 0x0},
-	{OP_RD, 0xc2254, 0x0},
-	{OP_RD, 0xc2258, 0x0},
-	{OP_RD, 0xc225c, 0x0},
-	{OP_RD, 0xc2260, 0x0},
-	{OP_RD, 0xc2264, 0x0},
-	{OP_RD, 0xc2268, 0x0},
-	{OP_RD, 0xc226c, 0x0},
-	{OP_RD, 0xc2270, 0x0},
-	{OP_RD, 0xc2274, 0x0},
-	{OP_RD, 0xc2278, 0x0},
-	{OP_RD, 0xc227c, 0x0},
-	{OP_SW, 0xc22d8, 0x406a1},
-	{OP_IF_MODE_AND, 1, 0x9}, /* asic+e2 */
-	{OP_WR, 0xc2000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0xa}, /* fpga+e2 */
-	{OP_WR, 0xc2000, 0x3},
-	{OP_IF_MODE_AND, 1, 0xc}, /* emul+e2 */
-	{OP_WR, 0xc2000, 0x1},
-	{OP_IF_MODE_AND, 1, 0x1001}, /* asic+e3_a0 */
-	{OP_WR, 0xc2000, 0x5dc},
-	{OP_IF_MODE_AND, 1, 0x1002}, /* fpga+e3_a0 */
-	{OP_WR, 0xc2000, 0x4},
-	{OP_IF_MODE_AND, 1, 0x1004}, /* emul+e3_a0 */
-	{OP_WR, 0xc2000, 0x1},
-	{OP_IF_MODE_AND, 1, 0x2001}, /* asic+e3_b0 */
-	{OP_WR, 0xc2000, 0x5dc},
-	{OP_IF_MODE_AND, 1, 0x2002}, /* fpga+e3_b0 */
-	{OP_WR, 0xc2000, 0x4},
-	{OP_IF_MODE_AND, 1, 0x2004}, /* emul+e3_b0 */
-	{OP_WR, 0xc2000, 0x1},
-/* #define CSDM_COMMON_END          111 */
-/* #define CSEM_COMMON_START        132 */
-	{OP_ZP, 0x200400, 0x710000},
-	{OP_WR_64, 0x200780, 0x1006a5},
-	{OP_ZR, 0x220000, 0x4000},
-	{OP_ZR, 0x232400, 0x1600},
-	{OP_SW, 0x221170, 0x806a7},
-	{OP_SW, 0x2211a8, 0x9006af},
-	{OP_ZR, 0x22c000, 0x6},
-	{OP_SW, 0x22c018, 0x4073f},
-	{OP_ZR, 0x22c028, 0xc},
-	{OP_SW, 0x22c058, 0x40743},
-	{OP_ZR, 0x22c068, 0xc},
-	{OP_SW, 0x22c098, 0x40747},
-	{OP_ZR, 0x22c0a8, 0xc},
-	{OP_SW, 0x22c0d8, 0x4074b},
-	{OP_ZR, 0x22c0e8, 0xc},
-	{OP_SW, 0x22c118, 0x4074f},
-	{OP_ZR, 0x22c128, 0xc},
-	{OP_SW, 0x22c158, 0x40753},
-	{OP_ZR, 0x22c168, 0xc},
-	{OP_SW, 0x22c198, 0x40757},
-	{OP_ZR, 0x22c1a8, 0xc},
-	{OP_SW, 0x22c1d8, 0x4075b},
-	{OP_ZR, 0x22c1e8, 0xc},
-	{OP_SW, 0x22c218, 0x4075f},
-	{OP_ZR, 0x22c228, 0xc},
-	{OP_SW, 0x22c258, 0x40763},
-	{OP_ZR, 0x22c268, 0xc},
-	{OP_SW, 0x22c298, 0x40767},
-	{OP_ZR, 0x22c2a8, 0xc},
-	{OP_SW, 0x22c2d8, 0x4076b},
-	{OP_ZR, 0x22c2e8, 0xc},
-	{OP_SW, 0x22c318, 0x4076f},
-	{OP_ZR, 0x22c328, 0xc},
-	{OP_SW, 0x22c358, 0x40773},
-	{OP_ZR, 0x22c368, 0xc},
-	{OP_SW, 0x22c398, 0x40777},
-	{OP_ZR, 0x22c3a8, 0xc},
-	{OP_SW, 0x22c3d8, 0x4077b},
-	{OP_ZR, 0x22c3e8, 0xc},
-	{OP_SW, 0x22c418, 0x4077f},
-	{OP_ZR, 0x22c428, 0xc},
-	{OP_SW, 0x22c458, 0x40783},
-	{OP_ZR, 0x22c468, 0xc},
-	{OP_SW, 0x22c498, 0x40787},
-	{OP_ZR, 0x22c4a8, 0xc},
-	{OP_SW, 0x22c4d8, 0x4078b},
-	{OP_ZR, 0x22c4e8, 0xc},
-	{OP_SW, 0x22c518, 0x4078f},
-	{OP_ZR, 0x22c528, 0xc},
-	{OP_SW, 0x22c558, 0x40793},
-	{OP_ZR, 0x22c568, 0xc},
-	{OP_SW, 0x22c598, 0x40797},
-	{OP_ZR, 0x22c5a8, 0xc},
-	{OP_SW, 0x22c5d8, 0x4079b},
-	{OP_ZR, 0x22c5e8, 0xc},
-	{OP_SW, 0x22c618, 0x4079f},
-	{OP_ZR, 0x22c628, 0xc},
-	{OP_SW, 0x22c658, 0x407a3},
-	{OP_ZR, 0x22c668, 0xc},
-	{OP_SW, 0x22c698, 0x407a7},
-	{OP_ZR, 0x22c6a8, 0xc},
-	{OP_SW, 0x22c6d8, 0x407ab},
-	{OP_ZR, 0x22c6e8, 0xc},
-	{OP_SW, 0x22c718, 0x407af},
-	{OP_ZR, 0x22c728, 0xc},
-	{OP_SW, 0x22c758, 0x407b3},
-	{OP_ZR, 0x22c768, 0xc},
-	{OP_SW, 0x22c798, 0x407b7},
-	{OP_ZR, 0x22c7a8, 0xc},
-	{OP_SW, 0x22c7d8, 0x407bb},
-	{OP_ZR, 0x22c7e8, 0xc},
-	{OP_SW, 0x22c818, 0x407bf},
-	{OP_ZR, 0x22c828, 0xc},
-	{OP_SW, 0x22c858, 0x407c3},
-	{OP_ZR, 0x22c868, 0xc},
-	{OP_SW, 0x22c898, 0x407c7},
-	{OP_ZR, 0x22c8a8, 0xc},
-	{OP_SW, 0x22c8d8, 0x407cb},
-	{OP_ZR, 0x22c8e8, 0xc},
-	{OP_SW, 0x22c918, 0x407cf},
-	{OP_ZR, 0x22c928, 0xc},
-	{OP_SW, 0x22c958, 0x407d3},
-	{OP_ZR, 0x22c968, 0xc},
-	{OP_SW, 0x22c998, 0x407d7},
-	{OP_ZR, 0x22c9a8, 0xc},
-	{OP_SW, 0x22c9d8, 0x407db},
-	{OP_ZR, 0x22c9e8, 0xc},
-	{OP_SW, 0x22ca18, 0x407df},
-	{OP_ZR, 0x22ca28, 0xc},
-	{OP_SW, 0x22ca58, 0x407e3},
-	{OP_ZR, 0x22ca68, 0xc},
-	{OP_SW, 0x22ca98, 0x407e7},
-	{OP_ZR, 0x22caa8, 0xc},
-	{OP_SW, 0x22cad8, 0x407eb},
-	{OP_ZR, 0x22cae8, 0xc},
-	{OP_SW, 0x22cb18, 0x407ef},
-	{OP_ZR, 0x22cb28, 0xc},
-	{OP_SW, 0x22cb58, 0x407f3},
-	{OP_ZR, 0x22cb68, 0xc},
-	{OP_SW, 0x22cb98, 0x407f7},
-	{OP_ZR, 0x22cba8, 0xc},
-	{OP_SW, 0x22cbd8, 0x407fb},
-	{OP_ZR, 0x22cbe8, 0xc},
-	{OP_SW, 0x22cc18, 0x407ff},
-	{OP_ZR, 0x22cc28, 0xc},
-	{OP_SW, 0x22cc58, 0x40803},
-	{OP_ZR, 0x22cc68, 0xc},
-	{OP_SW, 0x22cc98, 0x40807},
-	{OP_ZR, 0x22cca8, 0xc},
-	{OP_SW, 0x22ccd8, 0x4080b},
-	{OP_ZR, 0x22cce8, 0xc},
-	{OP_SW, 0x22cd18, 0x4080f},
-	{OP_ZR, 0x22cd28, 0xc},
-	{OP_SW, 0x22cd58, 0x40813},
-	{OP_ZR, 0x22cd68, 0xc},
-	{OP_SW, 0x22cd98, 0x40817},
-	{OP_ZR, 0x22cda8, 0xc},
-	{OP_SW, 0x22cdd8, 0x4081b},
-	{OP_ZR, 0x22cde8, 0xc},
-	{OP_SW, 0x22ce18, 0x4081f},
-	{OP_ZR, 0x22ce28, 0xc},
-	{OP_SW, 0x22ce58, 0x40823},
-	{OP_ZR, 0x22ce68, 0xc},
-	{OP_SW, 0x22ce98, 0x40827},
-	{OP_ZR, 0x22cea8, 0xc},
-	{OP_SW, 0x22ced8, 0x4082b},
-	{OP_ZR, 0x22cee8, 0xc},
-	{OP_SW, 0x22cf18, 0x4082f},
-	{OP_ZR, 0x22cf28, 0xc},
-	{OP_SW, 0x22cf58, 0x40833},
-	{OP_ZR, 0x22cf68, 0xc},
-	{OP_SW, 0x22cf98, 0x40837},
-	{OP_ZR, 0x22cfa8, 0xc},
-	{OP_SW, 0x22cfd8, 0x4083b},
-	{OP_ZR, 0x22cfe8, 0xc},
-	{OP_SW, 0x22d018, 0x4083f},
-	{OP_ZR, 0x22d028, 0xc},
-	{OP_SW, 0x22d058, 0x40843},
-	{OP_ZR, 0x22d068, 0xc},
-	{OP_SW, 0x22d098, 0x40847},
-	{OP_ZR, 0x22d0a8, 0xc},
-	{OP_SW, 0x22d0d8, 0x4084b},
-	{OP_ZR, 0x22d0e8, 0xc},
-	{OP_SW, 0x22d118, 0x4084f},
-	{OP_ZR, 0x22d128, 0xc},
-	{OP_SW, 0x22d158, 0x40853},
-	{OP_ZR, 0x22d168, 0xc},
-	{OP_SW, 0x22d198, 0x40857},
-	{OP_ZR, 0x22d1a8, 0xc},
-	{OP_SW, 0x22d1d8, 0x4085b},
-	{OP_ZR, 0x22d1e8, 0xc},
-	{OP_SW, 0x22d218, 0x4085f},
-	{OP_ZR, 0x22d228, 0xc},
-	{OP_SW, 0x22d258, 0x40863},
-	{OP_ZR, 0x22d268, 0xc},
-	{OP_SW, 0x22d298, 0x40867},
-	{OP_ZR, 0x22d2a8, 0xc},
-	{OP_SW, 0x22d2d8, 0x4086b},
-	{OP_ZR, 0x22d2e8, 0xc},
-	{OP_SW, 0x22d318, 0x4086f},
-	{OP_ZR, 0x22d328, 0xc},
-	{OP_SW, 0x22d358, 0x40873},
-	{OP_ZR, 0x22d368, 0xc},
-	{OP_SW, 0x22d398, 0x40877},
-	{OP_ZR, 0x22d3a8, 0xc},
-	{OP_SW, 0x22d3d8, 0x4087b},
-	{OP_ZR, 0x22d3e8, 0xc},
-	{OP_SW, 0x22d418, 0x4087f},
-	{OP_ZR, 0x22d428, 0xc},
-	{OP_SW, 0x22d458, 0x40883},
-	{OP_ZR, 0x22d468, 0xc},
-	{OP_SW, 0x22d498, 0x40887},
-	{OP_ZR, 0x22d4a8, 0xc},
-	{OP_SW, 0x22d4d8, 0x4088b},
-	{OP_ZR, 0x22d4e8, 0xc},
-	{OP_SW, 0x22d518, 0x4088f},
-	{OP_ZR, 0x22d528, 0xc},
-	{OP_SW, 0x22d558, 0x40893},
-	{OP_ZR, 0x22d568, 0xc},
-	{OP_SW, 0x22d598, 0x40897},
-	{OP_ZR, 0x22d5a8, 0xc},
-	{OP_SW, 0x22d5d8, 0x4089b},
-	{OP_ZR, 0x22d5e8, 0xc},
-	{OP_SW, 0x22d618, 0x4089f},
-	{OP_ZR, 0x22d628, 0xc},
-	{OP_SW, 0x22d658, 0x408a3},
-	{OP_ZR, 0x22d668, 0xc},
-	{OP_SW, 0x22d698, 0x408a7},
-	{OP_ZR, 0x22d6a8, 0xc},
-	{OP_SW, 0x22d6d8, 0x408ab},
-	{OP_ZR, 0x22d6e8, 0xc},
-	{OP_SW, 0x22d718, 0x408af},
-	{OP_ZR, 0x22d728, 0xc},
-	{OP_SW, 0x22d758, 0x408b3},
-	{OP_ZR, 0x22d768, 0xc},
-	{OP_SW, 0x22d798, 0x408b7},
-	{OP_ZR, 0x22d7a8, 0xc},
-	{OP_SW, 0x22d7d8, 0x408bb},
-	{OP_ZR, 0x22d7e8, 0xc},
-	{OP_SW, 0x22d818, 0x408bf},
-	{OP_ZR, 0x22d828, 0xc},
-	{OP_SW, 0x22d858, 0x408c3},
-	{OP_ZR, 0x22d868, 0xc},
-	{OP_SW, 0x22d898, 0x408c7},
-	{OP_ZR, 0x22d8a8, 0xc},
-	{OP_SW, 0x22d8d8, 0x408cb},
-	{OP_ZR, 0x22d8e8, 0xc},
-	{OP_SW, 0x22d918, 0x408cf},
-	{OP_ZR, 0x22d928, 0xc},
-	{OP_SW, 0x22d958, 0x408d3},
-	{OP_ZR, 0x22d968, 0xc},
-	{OP_SW, 0x22d998, 0x408d7},
-	{OP_ZR, 0x22d9a8, 0xc},
-	{OP_SW, 0x22d9d8, 0x408db},
-	{OP_ZR, 0x22d9e8, 0xc},
-	{OP_SW, 0x22da18, 0x408df},
-	{OP_ZR, 0x22da28, 0xc},
-	{OP_SW, 0x22da58, 0x408e3},
-	{OP_ZR, 0x22da68, 0xc},
-	{OP_SW, 0x22da98, 0x408e7},
-	{OP_ZR, 0x22daa8, 0xc},
-	{OP_SW, 0x22dad8, 0x408eb},
-	{OP_ZR, 0x22dae8, 0xc},
-	{OP_SW, 0x22db18, 0x408ef},
-	{OP_ZR, 0x22db28, 0xc},
-	{OP_SW, 0x22db58, 0x408f3},
-	{OP_ZR, 0x22db68, 0xc},
-	{OP_SW, 0x22db98, 0x408f7},
-	{OP_ZR, 0x22dba8, 0xc},
-	{OP_SW, 0x22dbd8, 0x408fb},
-	{OP_ZR, 0x22dbe8, 0xc},
-	{OP_SW, 0x22dc18, 0x408ff},
-	{OP_ZR, 0x22dc28, 0xc},
-	{OP_SW, 0x22dc58, 0x40903},
-	{OP_ZR, 0x22dc68, 0xc},
-	{OP_SW, 0x22dc98, 0x40907},
-	{OP_ZR, 0x22dca8, 0xc},
-	{OP_SW, 0x22dcd8, 0x4090b},
-	{OP_ZR, 0x22dce8, 0xc},
-	{OP_SW, 0x22dd18, 0x4090f},
-	{OP_ZR, 0x22dd28, 0xc},
-	{OP_SW, 0x22dd58, 0x40913},
-	{OP_ZR, 0x22dd68, 0xc},
-	{OP_SW, 0x22dd98, 0x40917},
-	{OP_ZR, 0x22dda8, 0xc},
-	{OP_SW, 0x22ddd8, 0x4091b},
-	{OP_ZR, 0x22dde8, 0xc},
-	{OP_SW, 0x22de18, 0x4091f},
-	{OP_ZR, 0x22de28, 0xc},
-	{OP_SW, 0x22de58, 0x40923},
-	{OP_ZR, 0x22de68, 0xc},
-	{OP_SW, 0x22de98, 0x40927},
-	{OP_ZR, 0x22dea8, 0xc},
-	{OP_SW, 0x22ded8, 0x4092b},
-	{OP_ZR, 0x22dee8, 0xc},
-	{OP_SW, 0x22df18, 0x4092f},
-	{OP_ZR, 0x22df28, 0xc},
-	{OP_SW, 0x22df58, 0x40933},
-	{OP_ZR, 0x22df68, 0xc},
-	{OP_SW, 0x22df98, 0x40937},
-	{OP_ZR, 0x22dfa8, 0xc},
-	{OP_SW, 0x22dfd8, 0x4093b},
-	{OP_ZR, 0x22dfe8, 0xc},
-	{OP_SW, 0x22e018, 0x4093f},
-	{OP_ZR, 0x22e028, 0xc},
-	{OP_SW, 0x22e058, 0x40943},
-	{OP_ZR, 0x22e068, 0xc},
-	{OP_SW, 0x22e098, 0x40947},
-	{OP_ZR, 0x22e0a8, 0xc},
-	{OP_SW, 0x22e0d8, 0x4094b},
-	{OP_ZR, 0x22e0e8, 0xc},
-	{OP_SW, 0x22e118, 0x4094f},
-	{OP_ZR, 0x22e128, 0xc},
-	{OP_SW, 0x22e158, 0x40953},
-	{OP_ZR, 0x22e168, 0xc},
-	{OP_SW, 0x22e198, 0x40957},
-	{OP_ZR, 0x22e1a8, 0xc},
-	{OP_SW, 0x22e1d8, 0x4095b},
-	{OP_ZR, 0x22e1e8, 0x6},
-	{OP_ZR, 0x22f640, 0x20},
-	{OP_WR, 0x238000, 0x10},
-	{OP_WR, 0x238040, 0x12},
-	{OP_WR, 0x238080, 0x30},
-	{OP_WR, 0x2380c0, 0xe},
-	{OP_WR, 0x238bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x8}, /* e2 */
-	{OP_WR, 0x238380, 0x86470},
-	{OP_WR, 0x2383c0, 0x226},
-	{OP_IF_MODE_AND, 2, 0x9}, /* asic+e2 */
-	{OP_WR, 0x238300, 0x86470},
-	{OP_WR, 0x238340, 0x226},
-	{OP_IF_MODE_AND, 2, 0xa}, /* fpga+e2 */
-	{OP_WR, 0x238300, 0x55f},
-	{OP_WR, 0x238340, 0x1},
-	{OP_IF_MODE_AND, 2, 0xc}, /* emul+e2 */
-	{OP_WR, 0x238300, 0x157},
-	{OP_WR, 0x238340, 0x0},
-	{OP_IF_MODE_AND, 2, 0x1000}, /* e3_a0 */
-	{OP_WR, 0x238380, 0xc96a8},
-	{OP_WR, 0x2383c0, 0x339},
-	{OP_IF_MODE_AND, 2, 0x1001}, /* asic+e3_a0 */
-	{OP_WR, 0x238300, 0xc96a8},
-	{OP_WR, 0x238340, 0x339},
-	{OP_IF_MODE_AND, 2, 0x1002}, /* fpga+e3_a0 */
-	{OP_WR, 0x238300, 0x80e},
-	{OP_WR, 0x238340, 0x2},
-	{OP_IF_MODE_AND, 2, 0x1004}, /* emul+e3_a0 */
-	{OP_WR, 0x238300, 0x203},
-	{OP_WR, 0x238340, 0x0},
-	{OP_IF_MODE_AND, 2, 0x2000}, /* e3_b0 */
-	{OP_WR, 0x238380, 0xcf850},
-	{OP_WR, 0x2383c0, 0x352},
-	{OP_IF_MODE_AND, 2, 0x2001}, /* asic+e3_b0 */
-	{OP_WR, 0x238300, 0xcf850},
-	{OP_WR, 0x238340, 0x352},
-	{OP_IF_MODE_AND, 2, 0x2002}, /* fpga+e3_b0 */
-	{OP_WR, 0x238300, 0x84d},
-	{OP_WR, 0x238340, 0x2},
-	{OP_IF_MODE_AND, 2, 0x2004}, /* emul+e3_b0 */
-	{OP_WR, 0x238300, 0x213},
-	{OP_WR, 0x238340, 0x0},
-	{OP_ZP, 0x240000, 0x31d40000},
-	{OP_ZP, 0x248000, 0x2b010c75},
-	{OP_WR_64, 0x24db20, 0x6302095f},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x231480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x231480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x11}, /* e3+asic */
-	{OP_WR, 0x231480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_WR, 0x2000bc, 0x32},
-	{OP_IF_MODE_AND, 4, 0x10}, /* e3 */
-	{OP_WR, 0x2000bc, 0x2},
-	{OP_WR, 0x238840, 0x1},
-	{OP_RD, 0x200138, 0x0},
-	{OP_WR, 0x238840, 0x0},
-	{OP_IF_MODE_AND, 1, 0x11}, /* e3+asic */
-	{OP_WR, 0x231480, 0x1},
-	{OP_RD, 0x200000, 0x0},
-	{OP_RD, 0x200004, 0x0},
-	{OP_RD, 0x200008, 0x0},
-	{OP_RD, 0x20000c, 0x0},
-	{OP_RD, 0x200010, 0x0},
-	{OP_RD, 0x200014, 0x0},
-	{OP_SW, 0x200020, 0x1a0961},
-	{OP_SW, 0x2000a4, 0x2097b},
-	{OP_WR, 0x200224, 0x0},
-	{OP_WR, 0x200234, 0x0},
-	{OP_WR, 0x20024c, 0x0},
-	{OP_WR, 0x2002e4, 0xffff},
-	{OP_WB_ZR, 0x202000, 0x800},
-	{OP_IF_MODE_AND, 1, 0x10}, /* e3 */
-	{OP_WB_ZR, 0x204000, 0x200},
-/* #define CSEM_COMMON_END          133 */
-/* #define CSEM_PF0_START        138 */
-	{OP_ZR, 0x221108, 0x2},
-	{OP_ZR, 0x223400, 0x2},
-	{OP_ZR, 0x225900, 0x6},
-	{OP_ZR, 0x226040, 0x30},
-	{OP_ZR, 0x22f300, 0x10},
-/* #define CSEM_PF0_END          139 */
-/* #define CSEM_PF1_START        140 */
-	{OP_ZR, 0x221110, 0x2},
-	{OP_ZR, 0x223408, 0x2},
-	{OP_ZR, 0x225918, 0x6},
-	{OP_ZR, 0x226100, 0x30},
-	{OP_ZR, 0x22f340, 0x10},
-/* #define CSEM_PF1_END          141 */
-/* #define CSEM_PF2_START        142 */
-	{OP_ZR, 0x221118, 0x2},
-	{OP_ZR, 0x223410, 0x2},
-	{OP_ZR, 0x225930, 0x6},
-	{OP_ZR, 0x2261c0, 0x30},
-	{OP_ZR, 0x22f380, 0x10},
-/* #define CSEM_PF2_END          143 */
-/* #define CSEM_PF3_START        144 */
-	{OP_ZR, 0x221120, 0x2},
-	{OP_ZR, 0x223418, 0x2},
-	{OP_ZR, 0x225948, 0x6},
-	{OP_ZR, 0x226280, 0x30},
-	{OP_ZR, 0x22f3c0, 0x10},
-/* #define CSEM_PF3_END          145 */
-/* #define CSEM_PF4_START        146 */
-	{OP_ZR, 0x221128, 0x2},
-	{OP_ZR, 0x223420, 0x2},
-	{OP_ZR, 0x225960, 0x6},
-	{OP_ZR, 0x226340, 0x30},
-	{OP_ZR, 0x22f400, 0x10},
-/* #define CSEM_PF4_END          147 */
-/* #define CSEM_PF5_START        148 */
-	{OP_ZR, 0x221130, 0x2},
-	{OP_ZR, 0x223428, 0x2},
-	{OP_ZR, 0x225978, 0x6},
-	{OP_ZR, 0x226400, 0x30},
-	{OP_ZR, 0x22f440, 0x10},
-/* #define CSEM_PF5_END          149 */
-/* #define CSEM_PF6_START        150 */
-	{OP_ZR, 0x221138, 0x2},
-	{OP_ZR, 0x223430, 0x2},
-	{OP_ZR, 0x225990, 0x6},
-	{OP_ZR, 0x2264c0, 0x30},
-	{OP_ZR, 0x22f480, 0x10},
-/* #define CSEM_PF6_END          151 */
-/* #define CSEM_PF7_START        152 */
-	{OP_ZR, 0x221140, 0x2},
-	{OP_ZR, 0x223438, 0x2},
-	{OP_ZR, 0x2259a8, 0x6},
-	{OP_ZR, 0x226580, 0x30},
-	{OP_ZR, 0x22f4c0, 0x10},
-/* #define CSEM_PF7_END          153 */
-/* #define DMAE_COMMON_START        176 */
-	{OP_ZR, 0x102400, 0xe0},
-	{OP_SW, 0x10201c, 0x2097d},
-	{OP_WR, 0x1020c0, 0x2},
-	{OP_SW, 0x102004, 0x2097f},
-/* #define DMAE_COMMON_END          177 */
-/* #define DORQ_COMMON_START        198 */
-	{OP_WR, 0x170008, 0x2},
-	{OP_WR, 0x17002c, 0x3},
-	{OP_WR, 0x170038, 0x7c1004},
-	{OP_SW, 0x170044, 0x60981},
-	{OP_WR, 0x170070, 0xc},
-	{OP_SW, 0x170078, 0x20987},
-	{OP_WR, 0x1701c4, 0x8100000},
-	{OP_WR, 0x170344, 0x1},
-	{OP_SW, 0x170400, 0x80989},
-	{OP_SW, 0x170430, 0x80991},
-	{OP_SW, 0x170480, 0x40999},
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_WR, 0x17003c, 0x4},
-	{OP_IF_MODE_AND, 1, 0x10}, /* e3 */
-	{OP_WR, 0x17003c, 0x8},
-	{OP_WR, 0x170004, 0xf},
-/* #define DORQ_COMMON_END          199 */
-/* #define DORQ_PF0_START        204 */
-	{OP_WR, 0x1701ec, 0x2},
-	{OP_WR, 0x1701f4, 0x2},
-/* #define DORQ_PF0_END          205 */
-/* #define DORQ_PF1_START        206 */
-	{OP_WR, 0x1701ec, 0x2},
-	{OP_WR, 0x1701f4, 0x2},
-/* #define DORQ_PF1_END          207 */
-/* #define DORQ_PF2_START        208 */
-	{OP_WR, 0x1701ec, 0x2},
-	{OP_WR, 0x1701f4, 0x2},
-/* #define DORQ_PF2_END          209 */
-/* #define DORQ_PF3_START        210 */
-	{OP_WR, 0x1701ec, 0x2},
-	{OP_WR, 0x1701f4, 0x2},
-/* #define DORQ_PF3_END          211 */
-/* #define DORQ_PF4_START        212 */
-	{OP_WR, 0x1701ec, 0x2},
-	{OP_WR, 0x1701f4, 0x2},
-/* #define DORQ_PF4_END          213 */
-/* #define DORQ_PF5_START        214 */
-	{OP_WR, 0x1701ec, 0x2},
-	{OP_WR, 0x1701f4, 0x2},
-/* #define DORQ_PF5_END          215 */
-/* #define DORQ_PF6_START        216 */
-	{OP_WR, 0x1701ec, 0x2},
-	{OP_WR, 0x1701f4, 0x2},
-/* #define DORQ_PF6_END          217 */
-/* #define DORQ_PF7_START        218 */
-	{OP_WR, 0x1701ec, 0x2},
-	{OP_WR, 0x1701f4, 0x2},
-/* #define DORQ_PF7_END          219 */
-/* #define IGU_COMMON_START        242 */
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_WR, 0x130078, 0x32},
-	{OP_WR, 0x13003c, 0x61a8},
-/* #define IGU_COMMON_END          243 */
-/* #define IGU_PF0_START        248 */
-	{OP_ZR, 0x130108, 0x3},
-	{OP_WR, 0x130104, 0x0},
-	{OP_WR, 0x130134, 0x0},
-/* #define IGU_PF0_END          249 */
-/* #define IGU_PF1_START        250 */
-	{OP_ZR, 0x130108, 0x3},
-	{OP_WR, 0x130104, 0x0},
-	{OP_WR, 0x130134, 0x0},
-/* #define IGU_PF1_END          251 */
-/* #define IGU_PF2_START        252 */
-	{OP_ZR, 0x130108, 0x3},
-	{OP_WR, 0x130104, 0x0},
-	{OP_WR, 0x130134, 0x0},
-/* #define IGU_PF2_END          253 */
-/* #define IGU_PF3_START        254 */
-	{OP_ZR, 0x130108, 0x3},
-	{OP_WR, 0x130104, 0x0},
-	{OP_WR, 0x130134, 0x0},
-/* #define IGU_PF3_END          255 */
-/* #define IGU_PF4_START        256 */
-	{OP_ZR, 0x130108, 0x3},
-	{OP_WR, 0x130104, 0x0},
-	{OP_WR, 0x130134, 0x0},
-/* #define IGU_PF4_END          257 */
-/* #define IGU_PF5_START        258 */
-	{OP_ZR, 0x130108, 0x3},
-	{OP_WR, 0x130104, 0x0},
-	{OP_WR, 0x130134, 0x0},
-/* #define IGU_PF5_END          259 */
-/* #define IGU_PF6_START        260 */
-	{OP_ZR, 0x130108, 0x3},
-	{OP_WR, 0x130104, 0x0},
-	{OP_WR, 0x130134, 0x0},
-/* #define IGU_PF6_END          261 */
-/* #define IGU_PF7_START        262 */
-	{OP_ZR, 0x130108, 0x3},
-	{OP_WR, 0x130104, 0x0},
-	{OP_WR, 0x130134, 0x0},
-/* #define IGU_PF7_END          263 */
-/* #define MISC_COMMON_START        264 */
-	{OP_IF_MODE_AND, 1, 0x88}, /* e2+sf */
-	{OP_WR, 0xa5f8, 0x0},
-	{OP_IF_MODE_AND, 1, 0x108}, /* e2+mf */
-	{OP_WR, 0xa5f8, 0x1},
-/* #define MISC_COMMON_END          265 */
-/* #define MISC_PORT0_START        266 */
-	{OP_IF_MODE_AND, 1, 0x90}, /* e3+sf */
-	{OP_WR, 0xaa84, 0x0},
-	{OP_IF_MODE_AND, 1, 0x110}, /* e3+mf */
-	{OP_WR, 0xaa84, 0x1},
-/* #define MISC_PORT0_END          267 */
-/* #define MISC_PORT1_START        268 */
-	{OP_IF_MODE_AND, 1, 0x90}, /* e3+sf */
-	{OP_WR, 0xaa88, 0x0},
-	{OP_IF_MODE_AND, 1, 0x110}, /* e3+mf */
-	{OP_WR, 0xaa88, 0x1},
-/* #define MISC_PORT1_END          269 */
-/* #define MISC_PF0_START        270 */
-	{OP_WR, 0xa270, 0x0},
-/* #define MISC_PF0_END          271 */
-/* #define MISC_PF1_START        272 */
-	{OP_WR, 0xa274, 0x0},
-/* #define MISC_PF1_END          273 */
-/* #define MISC_PF2_START        274 */
-	{OP_WR, 0xa270, 0x0},
-/* #define MISC_PF2_END          275 */
-/* #define MISC_PF3_START        276 */
-	{OP_WR, 0xa274, 0x0},
-/* #define MISC_PF3_END          277 */
-/* #define MISC_PF4_START        278 */
-	{OP_WR, 0xa270, 0x0},
-/* #define MISC_PF4_END          279 */
-/* #define MISC_PF5_START        280 */
-	{OP_WR, 0xa274, 0x0},
-/* #define MISC_PF5_END          281 */
-/* #define MISC_PF6_START        282 */
-	{OP_WR, 0xa270, 0x0},
-/* #define MISC_PF6_END          283 */
-/* #define MISC_PF7_START        284 */
-	{OP_WR, 0xa274, 0x0},
-/* #define MISC_PF7_END          285 */
-/* #define NIG_COMMON_START        286 */
-	{OP_WR, 0x16204, 0x0},
-	{OP_SW, 0x100b4, 0x2099d},
-	{OP_SW, 0x100cc, 0x2099f},
-	{OP_WR, 0x100dc, 0x1},
-	{OP_SW, 0x10100, 0x209a1},
-/* #define NIG_COMMON_END          287 */
-/* #define NIG_PORT0_START        288 */
-	{OP_WR, 0x1007c, 0x300000},
-	{OP_WR, 0x10084, 0x28},
-	{OP_WR, 0x1008c, 0x0},
-	{OP_WR, 0x10130, 0x4},
-	{OP_WR, 0x10328, 0x0},
-	{OP_WR, 0x10554, 0x30},
-	{OP_WR, 0x16058, 0xffff},
-	{OP_WR, 0x16060, 0x0},
-	{OP_WR, 0x16070, 0x7},
-	{OP_WR, 0x160b0, 0x0},
-	{OP_WR, 0x160c0, 0x1},
-	{OP_WR, 0x160c8, 0x0},
-	{OP_WR, 0x16208, 0x0},
-	{OP_ZR, 0x18054, 0x3},
-	{OP_WR, 0x18078, 0x0},
-	{OP_WR, 0x180e8, 0x7},
-	{OP_SW, 0x180f8, 0x209a3},
-	{OP_SW, 0x1810c, 0x209a5},
-	{OP_WR, 0x18124, 0x0},
-	{OP_IF_MODE_AND, 2, 0x8}, /* e2 */
-	{OP_WR, 0x180e4, 0x4688},
-	{OP_SW, 0x180ec, 0x209a7},
-	{OP_IF_MODE_AND, 1, 0x80}, /* sf */
-	{OP_WR, 0x18038, 0x6},
-	{OP_IF_MODE_AND, 1, 0x200}, /* mf_sd */
-	{OP_WR, 0x18038, 0x7},
-	{OP_IF_MODE_AND, 1, 0x400}, /* mf_si */
-	{OP_WR, 0x18038, 0x6},
-	{OP_IF_MODE_AND, 1, 0x800}, /* mf_afex */
-	{OP_WR, 0x18038, 0xe},
-	{OP_IF_MODE_AND, 4, 0x2000}, /* e3_b0 */
-	{OP_WR, 0x180ec, 0x38},
-	{OP_WR, 0x18100, 0x25e4},
-	{OP_WR, 0x18114, 0x4bc8},
-	{OP_SW, 0x18680, 0x409a9},
-	{OP_WR, 0x100c4, 0x1},
-	{OP_WR, 0x100f8, 0x1},
-	{OP_WR, 0x100f0, 0x1},
-/* #define NIG_PORT0_END          289 */
-/* #define NIG_PORT1_START        290 */
-	{OP_WR, 0x10080, 0x300000},
-	{OP_WR, 0x10088, 0x28},
-	{OP_WR, 0x10090, 0x0},
-	{OP_WR, 0x10134, 0x4},
-	{OP_WR, 0x1032c, 0x0},
-	{OP_WR, 0x10564, 0x30},
-	{OP_WR, 0x1605c, 0xffff},
-	{OP_WR, 0x16064, 0x0},
-	{OP_WR, 0x16074, 0x7},
-	{OP_WR, 0x160b4, 0x0},
-	{OP_WR, 0x160c4, 0x1},
-	{OP_WR, 0x160cc, 0x0},
-	{OP_WR, 0x1620c, 0x0},
-	{OP_ZR, 0x181a8, 0x4},
-	{OP_WR, 0x181d0, 0x0},
-	{OP_WR, 0x18234, 0x7},
-	{OP_SW, 0x18244, 0x209ad},
-	{OP_SW, 0x18258, 0x209af},
-	{OP_IF_MODE_AND, 2, 0x8}, /* e2 */
-	{OP_WR, 0x18230, 0x4688},
-	{OP_SW, 0x18238, 0x209b1},
-	{OP_IF_MODE_AND, 1, 0x80}, /* sf */
-	{OP_WR, 0x1818c, 0x6},
-	{OP_IF_MODE_AND, 1, 0x200}, /* mf_sd */
-	{OP_WR, 0x1818c, 0x7},
-	{OP_IF_MODE_AND, 1, 0x400}, /* mf_si */
-	{OP_WR, 0x1818c, 0x6},
-	{OP_IF_MODE_AND, 1, 0x800}, /* mf_afex */
-	{OP_WR, 0x1818c, 0xe},
-	{OP_IF_MODE_AND, 4, 0x2000}, /* e3_b0 */
-	{OP_WR, 0x18238, 0x38},
-	{OP_WR, 0x1824c, 0x25e4},
-	{OP_WR, 0x18260, 0x4bc8},
-	{OP_SW, 0x186e0, 0x409b3},
-	{OP_WR, 0x100c8, 0x1},
-	{OP_WR, 0x100fc, 0x1},
-	{OP_WR, 0x100f4, 0x1},
-/* #define NIG_PORT1_END          291 */
-/* #define NIG_PF0_START        292 */
-	{OP_ZR, 0x10138, 0x11},
-/* #define NIG_PF0_END          293 */
-/* #define NIG_PF1_START        294 */
-	{OP_ZR, 0x1017c, 0x11},
-/* #define NIG_PF1_END          295 */
-/* #define NIG_PF2_START        296 */
-	{OP_ZR, 0x10138, 0x11},
-/* #define NIG_PF2_END          297 */
-/* #define NIG_PF3_START        298 */
-	{OP_ZR, 0x1017c, 0x11},
-/* #define NIG_PF3_END          299 */
-/* #define NIG_PF4_START        300 */
-	{OP_ZR, 0x10138, 0x11},
-/* #define NIG_PF4_END          301 */
-/* #define NIG_PF5_START        302 */
-	{OP_ZR, 0x1017c, 0x11},
-/* #define NIG_PF5_END          303 */
-/* #define NIG_PF6_START        304 */
-	{OP_ZR, 0x10138, 0x11},
-/* #define NIG_PF6_END          305 */
-/* #define NIG_PF7_START        306 */
-	{OP_ZR, 0x1017c, 0x11},
-/* #define NIG_PF7_END          307 */
-/* #define PBF_COMMON_START        308 */
-	{OP_WR, 0x15c090, 0x8926},
-	{OP_WR, 0x15c09c, 0x4},
-	{OP_WR, 0x140000, 0x1},
-	{OP_WR, 0x15c024, 0x0},
-	{OP_SW, 0x15c0ec, 0x209b7},
-	{OP_SW, 0x15c100, 0x209b9},
-	{OP_IF_MODE_AND, 1, 0x2000}, /* e3_b0 */
-	{OP_SW, 0x15c1f4, 0x809bb},
-	{OP_SW, 0x140030, 0x209c3},
-	{OP_WR, 0x140040, 0x1},
-	{OP_IF_MODE_OR, 2, 0x1008}, /* e2|e3_a0 */
-	{OP_SW, 0x140004, 0x309c5},
-	{OP_WR, 0x140044, 0xffff},
-	{OP_IF_MODE_AND, 4, 0x2000}, /* e3_b0 */
-	{OP_SW, 0x140038, 0x209c8},
-	{OP_WR, 0x140044, 0xfffff},
-	{OP_SW, 0x15c160, 0x709ca},
-	{OP_SW, 0x15c198, 0x209d1},
-	{OP_IF_MODE_OR, 1, 0x1008}, /* e2|e3_a0 */
-	{OP_ZR, 0x140004, 0x3},
-	{OP_IF_MODE_AND, 1, 0x2000}, /* e3_b0 */
-	{OP_ZR, 0x15c160, 0x7},
-	{OP_WR, 0x140000, 0x0},
-/* #define PBF_COMMON_END          309 */
-/* #define PGLUE_B_COMMON_START        330 */
-	{OP_WR, 0x90c4, 0xe000},
-	{OP_WR, 0x90cc, 0xf300},
-	{OP_SW, 0x90d4, 0x209d3},
-	{OP_WR, 0x90e0, 0x7300},
-	{OP_SW, 0x90e8, 0x209d5},
-	{OP_WR, 0x90f4, 0x7300},
-	{OP_SW, 0x90fc, 0x209d7},
-	{OP_WR, 0x9108, 0x5300},
-	{OP_WR, 0x9110, 0x4},
-	{OP_SW, 0x9128, 0x709d9},
-	{OP_SW, 0x916c, 0x609e0},
-	{OP_ZR, 0x9184, 0x6},
-	{OP_SW, 0x919c, 0x509e6},
-/* #define PGLUE_B_COMMON_END          331 */
-/* #define PGLUE_B_PF0_START        336 */
-	{OP_SW, 0x942c, 0x309eb},
-/* #define PGLUE_B_PF0_END          337 */
-/* #define PGLUE_B_PF1_START        338 */
-	{OP_SW, 0x942c, 0x309ee},
-/* #define PGLUE_B_PF1_END          339 */
-/* #define PGLUE_B_PF2_START        340 */
-	{OP_SW, 0x942c, 0x309f1},
-/* #define PGLUE_B_PF2_END          341 */
-/* #define PGLUE_B_PF3_START        342 */
-	{OP_SW, 0x942c, 0x309f4},
-/* #define PGLUE_B_PF3_END          343 */
-/* #define PGLUE_B_PF4_START        344 */
-	{OP_SW, 0x942c, 0x309f7},
-/* #define PGLUE_B_PF4_END          345 */
-/* #define PGLUE_B_PF5_START        346 */
-	{OP_SW, 0x942c, 0x309fa},
-/* #define PGLUE_B_PF5_END          347 */
-/* #define PGLUE_B_PF6_START        348 */
-	{OP_SW, 0x942c, 0x309fd},
-/* #define PGLUE_B_PF6_END          349 */
-/* #define PGLUE_B_PF7_START        350 */
-	{OP_SW, 0x942c, 0x30a00},
-/* #define PGLUE_B_PF7_END          351 */
-/* #define PRS_COMMON_START        352 */
-	{OP_SW, 0x40004, 0x120a03},
-	{OP_WR, 0x40054, 0x43},
-	{OP_WR, 0x4005c, 0x6},
-	{OP_WR, 0x40070, 0x4},
-	{OP_SW, 0x40078, 0x40a15},
-	{OP_ZR, 0x40088, 0x5},
-	{OP_SW, 0x4009c, 0x30a19},
-	{OP_ZR, 0x400a8, 0x4},
-	{OP_SW, 0x400b8, 0x110a1c},
-	{OP_RD, 0x40124, 0x0},
-	{OP_RD, 0x40128, 0x0},
-	{OP_RD, 0x4012c, 0x0},
-	{OP_RD, 0x40130, 0x0},
-	{OP_WR, 0x40134, 0xf},
-	{OP_SW, 0x401d0, 0x20a2d},
-	{OP_WR, 0x4022c, 0x4},
-	{OP_SW, 0x40258, 0x40a2f},
-/* #define PRS_COMMON_END          353 */
-/* #define PXP2_COMMON_START        374 */
-	{OP_SW, 0x120494, 0x210a33},
-	{OP_WR, 0x120388, 0x64},
-	{OP_WR, 0x120390, 0x8},
-	{OP_SW, 0x12039c, 0x30a54},
-	{OP_SW, 0x1203bc, 0x30a57},
-	{OP_WR, 0x1203d0, 0x0},
-	{OP_WR, 0x12036c, 0x1},
-	{OP_SW, 0x1201bc, 0x3c0a5a},
-	{OP_SW, 0x1202b0, 0x20a96},
-	{OP_SW, 0x120324, 0x20a98},
-	{OP_WR, 0x1205b4, 0x1},
-	{OP_SW, 0x1205f8, 0x30a9a},
-	{OP_WR, 0x12066c, 0x1},
-	{OP_WR, 0x1201b0, 0x1},
-/* #define PXP2_COMMON_END          375 */
-/* #define PXP2_PF0_START        380 */
-	{OP_WR, 0x1207d8, 0x0},
-/* #define PXP2_PF0_END          381 */
-/* #define PXP2_PF1_START        382 */
-	{OP_WR, 0x1207d8, 0x0},
-/* #define PXP2_PF1_END          383 */
-/* #define PXP2_PF2_START        384 */
-	{OP_WR, 0x1207d8, 0x0},
-/* #define PXP2_PF2_END          385 */
-/* #define PXP2_PF3_START        386 */
-	{OP_WR, 0x1207d8, 0x0},
-/* #define PXP2_PF3_END          387 */
-/* #define PXP2_PF4_START        388 */
-	{OP_WR, 0x1207d8, 0x0},
-/* #define PXP2_PF4_END          389 */
-/* #define PXP2_PF5_START        390 */
-	{OP_WR, 0x1207d8, 0x0},
-/* #define PXP2_PF5_END          391 */
-/* #define PXP2_PF6_START        392 */
-	{OP_WR, 0x1207d8, 0x0},
-/* #define PXP2_PF6_END          393 */
-/* #define PXP2_PF7_START        394 */
-	{OP_WR, 0x1207d8, 0x0},
-/* #define PXP2_PF7_END          395 */
-/* #define PXP_COMMON_START        396 */
-	{OP_WR, 0x1030d8, 0x1},
-	{OP_WB, 0x103800, 0x50a9d},
-	{OP_WB, 0x103920, 0x50aa2},
-	{OP_WB, 0x103b00, 0x50aa7},
-	{OP_WB, 0x103c00, 0x50aac},
-/* #define PXP_COMMON_END          397 */
-/* #define QM_COMMON_START        418 */
-	{OP_SW, 0x168030, 0x80ab1},
-	{OP_WR, 0x168054, 0x2},
-	{OP_ZR, 0x16807c, 0x5},
-	{OP_SW, 0x168090, 0x20ab9},
-	{OP_SW, 0x16809c, 0x20abb},
-	{OP_WR, 0x1680ac, 0x54},
-	{OP_ZR, 0x1680b8, 0x5},
-	{OP_SW, 0x1680cc, 0x80abd},
-	{OP_WR, 0x1680f0, 0x7},
-	{OP_SW, 0x168100, 0x60ac5},
-	{OP_SW, 0x168128, 0x30acb},
-	{OP_SW, 0x168140, 0x60ace},
-	{OP_SW, 0x168168, 0x30ad4},
-	{OP_SW, 0x1681a8, 0x30ad7},
-	{OP_SW, 0x1681e8, 0x30ada},
-	{OP_SW, 0x1681f8, 0x30add},
-	{OP_SW, 0x168208, 0x70ae0},
-	{OP_SW, 0x168234, 0x20ae7},
-	{OP_ZR, 0x168278, 0x4},
-	{OP_SW, 0x168288, 0x60ae9},
-	{OP_WR, 0x168810, 0x20200101},
-	{OP_WR, 0x168820, 0x20200101},
-	{OP_WR, 0x168838, 0x20200101},
-	{OP_WR, 0x168848, 0x20200101},
-	{OP_SW, 0x16e6bc, 0x20aef},
-	{OP_IF_MODE_AND, 20, 0x8}, /* e2 */
-	{OP_SW, 0x168060, 0x70af1},
-	{OP_ZR, 0x1680a4, 0x2},
-	{OP_ZR, 0x1680b0, 0x2},
-	{OP_SW, 0x1680f4, 0x30af8},
-	{OP_SW, 0x168118, 0x40afb},
-	{OP_SW, 0x168134, 0x30aff},
-	{OP_SW, 0x168158, 0x40b02},
-	{OP_SW, 0x168174, 0xd0b06},
-	{OP_SW, 0x1681b4, 0xd0b13},
-	{OP_WR, 0x1681f4, 0x1fc},
-	{OP_WR, 0x168204, 0x3},
-	{OP_SW, 0x16823c, 0xb0b20},
-	{OP_ZR, 0x168268, 0x4},
-	{OP_WR, 0x16880c, 0x1010101},
-	{OP_SW, 0x168814, 0x30b2b},
-	{OP_SW, 0x168824, 0x50b2e},
-	{OP_SW, 0x16883c, 0x30b33},
-	{OP_SW, 0x16e6c4, 0x20b36},
-	{OP_SW, 0x16e6e8, 0x50b38},
-	{OP_WR, 0x16e794, 0x1},
-	{OP_IF_MODE_AND, 28, 0x1000}, /* e3_a0 */
-	{OP_SW, 0x168060, 0x70b3d},
-	{OP_ZR, 0x1680a4, 0x2},
-	{OP_ZR, 0x1680b0, 0x2},
-	{OP_SW, 0x1680f4, 0x30b44},
-	{OP_SW, 0x168118, 0x40b47},
-	{OP_SW, 0x168134, 0x30b4b},
-	{OP_SW, 0x168158, 0x40b4e},
-	{OP_WR, 0x168178, 0x1},
-	{OP_WR, 0x168184, 0x1},
-	{OP_WR, 0x168190, 0x1},
-	{OP_WR, 0x1681a4, 0x4},
-	{OP_WR, 0x1681b8, 0x1},
-	{OP_WR, 0x1681c4, 0x1},
-	{OP_WR, 0x1681d0, 0x1},
-	{OP_WR, 0x1681e4, 0x4},
-	{OP_WR, 0x1681f4, 0x1fc},
-	{OP_WR, 0x168204, 0x3},
-	{OP_SW, 0x16823c, 0x20b52},
-	{OP_WR, 0x168248, 0x920092},
-	{OP_WR, 0x168250, 0x1240124},
-	{OP_SW, 0x168258, 0x40b54},
-	{OP_ZR, 0x168268, 0x4},
-	{OP_WR, 0x16880c, 0x1010101},
-	{OP_SW, 0x168814, 0x30b58},
-	{OP_SW, 0x168824, 0x50b5b},
-	{OP_SW, 0x16883c, 0x30b60},
-	{OP_SW, 0x16e6e8, 0x20b63},
-	{OP_WR, 0x16e6f8, 0x204},
-	{OP_IF_MODE_AND, 14, 0x1020}, /* e3_a0+port2 */
-	{OP_WR, 0x168174, 0x0},
-	{OP_SW, 0x16817c, 0x20b65},
-	{OP_SW, 0x168188, 0x20b67},
-	{OP_SW, 0x168194, 0x40b69},
-	{OP_WR, 0x1681b4, 0x0},
-	{OP_SW, 0x1681bc, 0x20b6d},
-	{OP_SW, 0x1681c8, 0x20b6f},
-	{OP_SW, 0x1681d4, 0x40b71},
-	{OP_WR, 0x168244, 0xe490e49},
-	{OP_WR, 0x16824c, 0x920092},
-	{OP_WR, 0x168254, 0x1240124},
-	{OP_SW, 0x16e6c4, 0x20b75},
-	{OP_SW, 0x16e6f0, 0x20b77},
-	{OP_WR, 0x16e794, 0x1},
-	{OP_IF_MODE_AND, 14, 0x1040}, /* e3_a0+port4 */
-	{OP_WR, 0x168174, 0x1},
-	{OP_SW, 0x16817c, 0x20b79},
-	{OP_SW, 0x168188, 0x20b7b},
-	{OP_SW, 0x168194, 0x40b7d},
-	{OP_WR, 0x1681b4, 0x1},
-	{OP_SW, 0x1681bc, 0x20b81},
-	{OP_SW, 0x1681c8, 0x20b83},
-	{OP_SW, 0x1681d4, 0x40b85},
-	{OP_WR, 0x168244, 0x0},
-	{OP_WR, 0x16824c, 0xfff0fff},
-	{OP_WR, 0x168254, 0x0},
-	{OP_SW, 0x16e6c4, 0x20b89},
-	{OP_SW, 0x16e6f0, 0x20b8b},
-	{OP_WR, 0x16e794, 0x0},
-	{OP_IF_MODE_AND, 7, 0x2000}, /* e3_b0 */
-	{OP_SW, 0x168060, 0x70b8d},
-	{OP_SW, 0x1680a4, 0x20b94},
-	{OP_SW, 0x1680b0, 0x20b96},
-	{OP_WR, 0x1681f4, 0x1c0},
-	{OP_WR, 0x168204, 0x3f},
-	{OP_WR, 0x16823c, 0x7f},
-	{OP_SW, 0x16e7bc, 0x80b98},
-	{OP_IF_MODE_AND, 15, 0x4020}, /* cos3+port2 */
-	{OP_SW, 0x1680f4, 0x30ba0},
-	{OP_SW, 0x168118, 0x40ba3},
-	{OP_SW, 0x168134, 0x30ba7},
-	{OP_SW, 0x168158, 0x40baa},
-	{OP_SW, 0x168174, 0xd0bae},
-	{OP_SW, 0x1681b4, 0xd0bbb},
-	{OP_SW, 0x168240, 0x60bc8},
-	{OP_ZR, 0x168258, 0x6},
-	{OP_SW, 0x168270, 0x20bce},
-	{OP_WR, 0x16880c, 0x1010101},
-	{OP_SW, 0x168814, 0x30bd0},
-	{OP_SW, 0x168824, 0x50bd3},
-	{OP_SW, 0x16883c, 0x30bd8},
-	{OP_SW, 0x16e6c4, 0x20bdb},
-	{OP_WR, 0x16e794, 0x1},
-	{OP_IF_MODE_AND, 13, 0x4040}, /* cos3+port4 */
-	{OP_SW, 0x1680f4, 0x30bdd},
-	{OP_SW, 0x168118, 0x40be0},
-	{OP_SW, 0x168134, 0x30be4},
-	{OP_SW, 0x168158, 0x40be7},
-	{OP_SW, 0x168174, 0xd0beb},
-	{OP_SW, 0x1681b4, 0xd0bf8},
-	{OP_SW, 0x168240, 0xe0c05},
-	{OP_WR, 0x16880c, 0x1010101},
-	{OP_SW, 0x168814, 0x30c13},
-	{OP_SW, 0x168824, 0x50c16},
-	{OP_SW, 0x16883c, 0x30c1b},
-	{OP_SW, 0x16e6c4, 0x20c1e},
-	{OP_WR, 0x16e794, 0x0},
-	{OP_IF_MODE_AND, 13, 0x8000}, /* cos6 */
-	{OP_SW, 0x1680f4, 0x30c20},
-	{OP_SW, 0x168118, 0x40c23},
-	{OP_SW, 0x168134, 0x30c27},
-	{OP_SW, 0x168158, 0x40c2a},
-	{OP_SW, 0x168174, 0xd0c2e},
-	{OP_SW, 0x1681b4, 0xd0c3b},
-	{OP_SW, 0x168240, 0xe0c48},
-	{OP_WR, 0x16880c, 0x1010120},
-	{OP_SW, 0x168814, 0x30c56},
-	{OP_SW, 0x168824, 0x50c59},
-	{OP_SW, 0x16883c, 0x30c5e},
-	{OP_SW, 0x16e6c4, 0x20c61},
-	{OP_WR, 0x16e794, 0x1},
-	{OP_WR, 0x1680ec, 0xff},
-/* #define QM_COMMON_END          419 */
-/* #define SRC_COMMON_START        440 */
-	{OP_SW, 0x40408, 0x140c63},
-	{OP_WR, 0x404cc, 0x1},
-/* #define SRC_COMMON_END          441 */
-/* #define TCM_COMMON_START        462 */
-	{OP_SW, 0x50044, 0x20c77},
-	{OP_SW, 0x50050, 0x80c79},
-	{OP_SW, 0x50090, 0x70c81},
-	{OP_SW, 0x500b0, 0x20c88},
-	{OP_SW, 0x500c0, 0x20c8a},
-	{OP_SW, 0x500d4, 0x20c8c},
-	{OP_WR, 0x50114, 0x1},
-	{OP_SW, 0x5011c, 0x20c8e},
-	{OP_WR, 0x50204, 0x1},
-	{OP_SW, 0x5020c, 0x20c90},
-	{OP_WR, 0x5021c, 0x20},
-	{OP_ZR, 0x50240, 0xa},
-	{OP_ZR, 0x54000, 0xd00},
-	{OP_IF_MODE_AND, 2, 0x8}, /* e2 */
-	{OP_SW, 0x50220, 0x20c92},
-	{OP_SW, 0x50280, 0x200c94},
-	{OP_IF_MODE_AND, 2, 0x10}, /* e3 */
-	{OP_SW, 0x50220, 0x20cb4},
-	{OP_SW, 0x50280, 0x1d0cb6},
-	{OP_SW, 0x50004, 0x100cd3},
-/* #define TCM_COMMON_END          463 */
-/* #define TCM_PF0_START        468 */
-	{OP_WR, 0x500e0, 0xe},
-/* #define TCM_PF0_END          469 */
-/* #define TCM_PF1_START        470 */
-	{OP_WR, 0x500e4, 0x2e},
-/* #define TCM_PF1_END          471 */
-/* #define TCM_PF2_START        472 */
-	{OP_WR, 0x500e0, 0x1e},
-/* #define TCM_PF2_END          473 */
-/* #define TCM_PF3_START        474 */
-	{OP_WR, 0x500e4, 0x3e},
-/* #define TCM_PF3_END          475 */
-/* #define TCM_PF4_START        476 */
-	{OP_WR, 0x500e0, 0x4e},
-/* #define TCM_PF4_END          477 */
-/* #define TCM_PF5_START        478 */
-	{OP_WR, 0x500e4, 0x6e},
-/* #define TCM_PF5_END          479 */
-/* #define TCM_PF6_START        480 */
-	{OP_WR, 0x500e0, 0x5e},
-/* #define TCM_PF6_END          481 */
-/* #define TCM_PF7_START        482 */
-	{OP_WR, 0x500e4, 0x7e},
-/* #define TCM_PF7_END          483 */
-/* #define TM_COMMON_START        484 */
-	{OP_ZR, 0x164024, 0x2},
-	{OP_SW, 0x164030, 0x30ce3},
-	{OP_WR, 0x164044, 0x20},
-	{OP_WR, 0x164070, 0x1c},
-	{OP_WR, 0x164208, 0x1},
-	{OP_WR, 0x164210, 0x1},
-	{OP_WR, 0x164220, 0x1},
-	{OP_WR, 0x164228, 0x1},
-	{OP_WR, 0x164230, 0x1},
-	{OP_WR, 0x164238, 0x1},
-	{OP_WR, 0x164260, 0x2},
-	{OP_IF_MODE_AND, 1, 0x9}, /* asic+e2 */
-	{OP_WR, 0x16401c, 0x3d090},
-	{OP_IF_MODE_AND, 1, 0xa}, /* fpga+e2 */
-	{OP_WR, 0x16401c, 0x271},
-	{OP_IF_MODE_AND, 1, 0xc}, /* emul+e2 */
-	{OP_WR, 0x16401c, 0x9c},
-	{OP_IF_MODE_AND, 1, 0x1001}, /* asic+e3_a0 */
-	{OP_WR, 0x16401c, 0x5b8d8},
-	{OP_IF_MODE_AND, 1, 0x1002}, /* fpga+e3_a0 */
-	{OP_WR, 0x16401c, 0x3a9},
-	{OP_IF_MODE_AND, 1, 0x1004}, /* emul+e3_a0 */
-	{OP_WR, 0x16401c, 0xea},
-	{OP_IF_MODE_AND, 1, 0x2001}, /* asic+e3_b0 */
-	{OP_WR, 0x16401c, 0x5b8d8},
-	{OP_IF_MODE_AND, 1, 0x2002}, /* fpga+e3_b0 */
-	{OP_WR, 0x16401c, 0x3a9},
-	{OP_IF_MODE_AND, 1, 0x2004}, /* emul+e3_b0 */
-	{OP_WR, 0x16401c, 0xea},
-	{OP_WR, 0x164000, 0x1},
-	{OP_WR, 0x1640d8, 0x1},
-	{OP_SW, 0x164008, 0x30ce6},
-/* #define TM_COMMON_END          485 */
-/* #define TM_PORT0_START        486 */
-	{OP_WR, 0x164240, 0x0},
-	{OP_WR, 0x164248, 0x0},
-	{OP_WB_ZR, 0x164270, 0x2},
-/* #define TM_PORT0_END          487 */
-/* #define TM_PORT1_START        488 */
-	{OP_WR, 0x164250, 0x0},
-	{OP_WR, 0x164258, 0x0},
-	{OP_WB_ZR, 0x164280, 0x2},
-/* #define TM_PORT1_END          489 */
-/* #define TSDM_COMMON_START        506 */
-	{OP_SW, 0x42008, 0x40ce9},
-	{OP_SW, 0x4201c, 0x40ced},
-	{OP_WR, 0x42038, 0x20},
-	{OP_ZR, 0x4203c, 0x1f},
-	{OP_WR, 0x420b8, 0x1},
-	{OP_ZR, 0x420bc, 0x5f},
-	{OP_SW, 0x42238, 0x40cf1},
-	{OP_RD, 0x42248, 0x0},
-	{OP_RD, 0x4224c, 0x0},
-	{OP_RD, 0x42250, 0x0},
-	{OP_RD, 0x42254, 0x0},
-	{OP_RD, 0x42258, 0x0},
-	{OP_RD, 0x4225c, 0x0},
-	{OP_RD, 0x42260, 0x0},
-	{OP_RD, 0x42264, 0x0},
-	{OP_RD, 0x42268, 0x0},
-	{OP_RD, 0x4226c, 0x0},
-	{OP_RD, 0x42270, 0x0},
-	{OP_RD, 0x42274, 0x0},
-	{OP_RD, 0x42278, 0x0},
-	{OP_RD, 0x4227c, 0x0},
-	{OP_SW, 0x422c0, 0x40cf5},
-	{OP_IF_MODE_AND, 1, 0x9}, /* asic+e2 */
-	{OP_WR, 0x42000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0xa}, /* fpga+e2 */
-	{OP_WR, 0x42000, 0x3},
-	{OP_IF_MODE_AND, 1, 0xc}, /* emul+e2 */
-	{OP_WR, 0x42000, 0x1},
-	{OP_IF_MODE_AND, 1, 0x1001}, /* asic+e3_a0 */
-	{OP_WR, 0x42000, 0x5dc},
-	{OP_IF_MODE_AND, 1, 0x1002}, /* fpga+e3_a0 */
-	{OP_WR, 0x42000, 0x4},
-	{OP_IF_MODE_AND, 1, 0x1004}, /* emul+e3_a0 */
-	{OP_WR, 0x42000, 0x1},
-	{OP_IF_MODE_AND, 1, 0x2001}, /* asic+e3_b0 */
-	{OP_WR, 0x42000, 0x5dc},
-	{OP_IF_MODE_AND, 1, 0x2002}, /* fpga+e3_b0 */
-	{OP_WR, 0x42000, 0x4},
-	{OP_IF_MODE_AND, 1, 0x2004}, /* emul+e3_b0 */
-	{OP_WR, 0x42000, 0x1},
-/* #define TSDM_COMMON_END          507 */
-/* #define TSEM_COMMON_START        528 */
-	{OP_ZP, 0x180400, 0x8b0000},
-	{OP_WR_64, 0x1807b8, 0x90cf9},
-	{OP_ZR, 0x1a0000, 0x4000},
-	{OP_ZR, 0x1b2400, 0x1600},
-	{OP_SW, 0x1a16c8, 0x20cfb},
-	{OP_SW, 0x1a17e0, 0x900cfd},
-	{OP_SW, 0x1a4040, 0x40d8d},
-	{OP_ZR, 0x1a4050, 0x6},
-	{OP_SW, 0x1a4068, 0x20d91},
-	{OP_SW, 0x1a52c0, 0x20d93},
-	{OP_SW, 0x1a8000, 0x3f90d95},
-	{OP_ZR, 0x1a8fe4, 0x7},
-	{OP_SW, 0x1b3d90, 0x14118e},
-	{OP_WR, 0x1b8000, 0x34},
-	{OP_WR, 0x1b8040, 0x18},
-	{OP_WR, 0x1b8080, 0xc},
-	{OP_WR, 0x1b80c0, 0x20},
-	{OP_WR, 0x1b8bc0, 0x1},
-	{OP_IF_MODE_AND, 3, 0x8}, /* e2 */
-	{OP_WR, 0x1a16d0, 0x2},
-	{OP_WR, 0x1b8380, 0x86470},
-	{OP_WR, 0x1b83c0, 0x226},
-	{OP_IF_MODE_AND, 2, 0x9}, /* asic+e2 */
-	{OP_WR, 0x1b8300, 0x86470},
-	{OP_WR, 0x1b8340, 0x226},
-	{OP_IF_MODE_AND, 2, 0xa}, /* fpga+e2 */
-	{OP_WR, 0x1b8300, 0x55f},
-	{OP_WR, 0x1b8340, 0x1},
-	{OP_IF_MODE_AND, 2, 0xc}, /* emul+e2 */
-	{OP_WR, 0x1b8300, 0x157},
-	{OP_WR, 0x1b8340, 0x0},
-	{OP_IF_MODE_AND, 1, 0x20}, /* port2 */
-	{OP_WR, 0x1a16d4, 0x0},
-	{OP_IF_MODE_AND, 1, 0x40}, /* port4 */
-	{OP_WR, 0x1a16d4, 0x1},
-	{OP_IF_MODE_AND, 3, 0x1000}, /* e3_a0 */
-	{OP_WR, 0x1a16d0, 0x3},
-	{OP_WR, 0x1b8380, 0xc96a8},
-	{OP_WR, 0x1b83c0, 0x339},
-	{OP_IF_MODE_AND, 2, 0x1001}, /* asic+e3_a0 */
-	{OP_WR, 0x1b8300, 0xc96a8},
-	{OP_WR, 0x1b8340, 0x339},
-	{OP_IF_MODE_AND, 2, 0x1002}, /* fpga+e3_a0 */
-	{OP_WR, 0x1b8300, 0x80e},
-	{OP_WR, 0x1b8340, 0x2},
-	{OP_IF_MODE_AND, 2, 0x1004}, /* emul+e3_a0 */
-	{OP_WR, 0x1b8300, 0x203},
-	{OP_WR, 0x1b8340, 0x0},
-	{OP_IF_MODE_AND, 3, 0x2000}, /* e3_b0 */
-	{OP_WR, 0x1a16d0, 0x4},
-	{OP_WR, 0x1b8380, 0xcf850},
-	{OP_WR, 0x1b83c0, 0x352},
-	{OP_IF_MODE_AND, 2, 0x2001}, /* asic+e3_b0 */
-	{OP_WR, 0x1b8300, 0xcf850},
-	{OP_WR, 0x1b8340, 0x352},
-	{OP_IF_MODE_AND, 2, 0x2002}, /* fpga+e3_b0 */
-	{OP_WR, 0x1b8300, 0x84d},
-	{OP_WR, 0x1b8340, 0x2},
-	{OP_IF_MODE_AND, 2, 0x2004}, /* emul+e3_b0 */
-	{OP_WR, 0x1b8300, 0x213},
-	{OP_WR, 0x1b8340, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4000}, /* cos3 */
-	{OP_WR, 0x1a16d8, 0x0},
-	{OP_IF_MODE_AND, 1, 0x8000}, /* cos6 */
-	{OP_WR, 0x1a16d8, 0x1},
-	{OP_ZR, 0x1b9448, 0x2},
-	{OP_ZP, 0x1c0000, 0x323c0000},
-	{OP_ZP, 0x1c8000, 0x35280c8f},
-	{OP_ZP, 0x1d0000, 0x33c119d9},
-	{OP_ZP, 0x1d8000, 0x376626ca},
-	{OP_ZP, 0x1e0000, 0x225134a4},
-	{OP_WR_64, 0x1e55b0, 0x354a11a2},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x1b1480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x1b1480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x11}, /* e3+asic */
-	{OP_WR, 0x1b1480, 0x0},
-	{OP_IF_MODE_AND, 2, 0x8}, /* e2 */
-	{OP_WR, 0x1800bc, 0x32},
-	{OP_WR, 0x1b945c, 0x32},
-	{OP_IF_MODE_AND, 7, 0x10}, /* e3 */
-	{OP_WR, 0x1800bc, 0x2},
-	{OP_WR, 0x1b945c, 0x2},
-	{OP_WR, 0x1b8840, 0x1},
-	{OP_WR, 0x1b942c, 0x2},
-	{OP_RD, 0x180128, 0x0},
-	{OP_WR, 0x1b8840, 0x0},
-	{OP_WR, 0x1b942c, 0x0},
-	{OP_WR, 0x1b9440, 0x1},
-	{OP_IF_MODE_AND, 1, 0x11}, /* e3+asic */
-	{OP_WR, 0x1b1480, 0x1},
-	{OP_RD, 0x180000, 0x0},
-	{OP_RD, 0x180004, 0x0},
-	{OP_RD, 0x180008, 0x0},
-	{OP_RD, 0x18000c, 0x0},
-	{OP_RD, 0x180010, 0x0},
-	{OP_RD, 0x180014, 0x0},
-	{OP_SW, 0x180020, 0x1a11a4},
-	{OP_SW, 0x1800a4, 0x211be},
-	{OP_WR, 0x180224, 0x0},
-	{OP_WR, 0x180234, 0x0},
-	{OP_WR, 0x18024c, 0x0},
-	{OP_WR, 0x1802e4, 0xff},
-	{OP_WB_ZR, 0x181000, 0x400},
-	{OP_IF_MODE_AND, 1, 0x10}, /* e3 */
-	{OP_WB_ZR, 0x182000, 0x600},
-/* #define TSEM_COMMON_END          529 */
-/* #define TSEM_PORT0_START        530 */
-	{OP_SW, 0x1a1a30, 0x411c0},
-	{OP_ZR, 0x1a3000, 0x12},
-	{OP_ZR, 0x1a3090, 0x12},
-	{OP_ZR, 0x1ad4c8, 0x2},
-	{OP_ZR, 0x1ad4d8, 0x20},
-	{OP_ZR, 0x1ad5d8, 0x2},
-	{OP_ZR, 0x1b4400, 0x6},
-/* #define TSEM_PORT0_END          531 */
-/* #define TSEM_PORT1_START        532 */
-	{OP_SW, 0x1a1a40, 0x411c4},
-	{OP_ZR, 0x1a3048, 0x12},
-	{OP_ZR, 0x1a30d8, 0x12},
-	{OP_ZR, 0x1ad4d0, 0x2},
-	{OP_ZR, 0x1ad558, 0x20},
-	{OP_ZR, 0x1ad5e0, 0x2},
-	{OP_ZR, 0x1b4418, 0x6},
-/* #define TSEM_PORT1_END          533 */
-/* #define TSEM_PF0_START        534 */
-	{OP_SW, 0x1a4000, 0x211c8},
-	{OP_ZR, 0x1a5000, 0x2},
-	{OP_ZR, 0x1a5080, 0x12},
-	{OP_SW, 0x1a6140, 0x211ca},
-	{OP_ZR, 0x1aa000, 0x2},
-	{OP_ZR, 0x1b4430, 0x2},
-/* #define TSEM_PF0_END          535 */
-/* #define TSEM_PF1_START        536 */
-	{OP_SW, 0x1a4008, 0x211cc},
-	{OP_ZR, 0x1a5010, 0x2},
-	{OP_ZR, 0x1a50c8, 0x12},
-	{OP_SW, 0x1a6148, 0x211ce},
-	{OP_ZR, 0x1aa008, 0x2},
-	{OP_ZR, 0x1b4438, 0x2},
-/* #define TSEM_PF1_END          537 */
-/* #define TSEM_PF2_START        538 */
-	{OP_SW, 0x1a4010, 0x211d0},
-	{OP_ZR, 0x1a5020, 0x2},
-	{OP_ZR, 0x1a5110, 0x12},
-	{OP_SW, 0x1a6150, 0x211d2},
-	{OP_ZR, 0x1aa010, 0x2},
-	{OP_ZR, 0x1b4440, 0x2},
-/* #define TSEM_PF2_END          539 */
-/* #define TSEM_PF3_START        540 */
-	{OP_SW, 0x1a4018, 0x211d4},
-	{OP_ZR, 0x1a5030, 0x2},
-	{OP_ZR, 0x1a5158, 0x12},
-	{OP_SW, 0x1a6158, 0x211d6},
-	{OP_ZR, 0x1aa018, 0x2},
-	{OP_ZR, 0x1b4448, 0x2},
-/* #define TSEM_PF3_END          541 */
-/* #define TSEM_PF4_START        542 */
-	{OP_SW, 0x1a4020, 0x211d8},
-	{OP_ZR, 0x1a5040, 0x2},
-	{OP_ZR, 0x1a51a0, 0x12},
-	{OP_SW, 0x1a6160, 0x211da},
-	{OP_ZR, 0x1aa020, 0x2},
-	{OP_ZR, 0x1b4450, 0x2},
-/* #define TSEM_PF4_END          543 */
-/* #define TSEM_PF5_START        544 */
-	{OP_SW, 0x1a4028, 0x211dc},
-	{OP_ZR, 0x1a5050, 0x2},
-	{OP_ZR, 0x1a51e8, 0x12},
-	{OP_SW, 0x1a6168, 0x211de},
-	{OP_ZR, 0x1aa028, 0x2},
-	{OP_ZR, 0x1b4458, 0x2},
-/* #define TSEM_PF5_END          545 */
-/* #define TSEM_PF6_START        546 */
-	{OP_SW, 0x1a4030, 0x211e0},
-	{OP_ZR, 0x1a5060, 0x2},
-	{OP_ZR, 0x1a5230, 0x12},
-	{OP_SW, 0x1a6170, 0x211e2},
-	{OP_ZR, 0x1aa030, 0x2},
-	{OP_ZR, 0x1b4460, 0x2},
-/* #define TSEM_PF6_END          547 */
-/* #define TSEM_PF7_START        548 */
-	{OP_SW, 0x1a4038, 0x211e4},
-	{OP_ZR, 0x1a5070, 0x2},
-	{OP_ZR, 0x1a5278, 0x12},
-	{OP_SW, 0x1a6178, 0x211e6},
-	{OP_ZR, 0x1aa038, 0x2},
-	{OP_ZR, 0x1b4468, 0x2},
-/* #define TSEM_PF7_END          549 */
-/* #define UCM_COMMON_START        550 */
-	{OP_WR, 0xe004c, 0x32},
-	{OP_SW, 0xe0054, 0x811e8},
-	{OP_SW, 0xe0094, 0x711f0},
-	{OP_SW, 0xe00b4, 0x211f7},
-	{OP_WR, 0xe00c4, 0x0},
-	{OP_WR, 0xe00cc, 0x6},
-	{OP_SW, 0xe00d8, 0x211f9},
-	{OP_WR, 0xe0144, 0x1},
-	{OP_SW, 0xe014c, 0x211fb},
-	{OP_WR, 0xe0204, 0x1},
-	{OP_SW, 0xe020c, 0x211fd},
-	{OP_SW, 0xe021c, 0x411ff},
-	{OP_SW, 0xe0280, 0x1b1203},
-	{OP_ZR, 0xe0300, 0x12},
-	{OP_ZR, 0xe2000, 0x800},
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_ZR, 0xe02ec, 0x5},
-	{OP_SW, 0xe0004, 0x11121e},
-/* #define UCM_COMMON_END          551 */
-/* #define UCM_PF0_START        556 */
-	{OP_WR, 0xe0110, 0xf},
-/* #define UCM_PF0_END          557 */
-/* #define UCM_PF1_START        558 */
-	{OP_WR, 0xe0114, 0x2f},
-/* #define UCM_PF1_END          559 */
-/* #define UCM_PF2_START        560 */
-	{OP_WR, 0xe0110, 0x1f},
-/* #define UCM_PF2_END          561 */
-/* #define UCM_PF3_START        562 */
-	{OP_WR, 0xe0114, 0x3f},
-/* #define UCM_PF3_END          563 */
-/* #define UCM_PF4_START        564 */
-	{OP_WR, 0xe0110, 0x4f},
-/* #define UCM_PF4_END          565 */
-/* #define UCM_PF5_START        566 */
-	{OP_WR, 0xe0114, 0x6f},
-/* #define UCM_PF5_END          567 */
-/* #define UCM_PF6_START        568 */
-	{OP_WR, 0xe0110, 0x5f},
-/* #define UCM_PF6_END          569 */
-/* #define UCM_PF7_START        570 */
-	{OP_WR, 0xe0114, 0x7f},
-/* #define UCM_PF7_END          571 */
-/* #define UPB_COMMON_START        572 */
-	{OP_WR, 0xc1000, 0x28},
-/* #define UPB_COMMON_END          573 */
-/* #define USDM_COMMON_START        594 */
-	{OP_SW, 0xc4008, 0x4122f},
-	{OP_SW, 0xc401c, 0x41233},
-	{OP_SW, 0xc4038, 0x61237},
-	{OP_ZR, 0xc4050, 0x1f},
-	{OP_WR, 0xc40cc, 0x1},
-	{OP_ZR, 0xc40d0, 0x3a},
-	{OP_SW, 0xc41b8, 0x6123d},
-	{OP_ZR, 0xc41d0, 0x1a},
-	{OP_SW, 0xc4238, 0x41243},
-	{OP_RD, 0xc4248, 0x0},
-	{OP_RD, 0xc424c, 0x0},
-	{OP_RD, 0xc4250, 0x0},
-	{OP_RD, 0xc4254, 0x0},
-	{OP_RD, 0xc4258, 0x0},
-	{OP_RD, 0xc425c, 0x0},
-	{OP_RD, 0xc4260, 0x0},
-	{OP_RD, 0xc4264, 0x0},
-	{OP_RD, 0xc4268, 0x0},
-	{OP_RD, 0xc426c, 0x0},
-	{OP_RD, 0xc4270, 0x0},
-	{OP_RD, 0xc4274, 0x0},
-	{OP_RD, 0xc4278, 0x0},
-	{OP_RD, 0xc427c, 0x0},
-	{OP_RD, 0xc4280, 0x0},
-	{OP_SW, 0xc42d8, 0x41247},
-	{OP_IF_MODE_AND, 1, 0x9}, /* asic+e2 */
-	{OP_WR, 0xc4000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0xa}, /* fpga+e2 */
-	{OP_WR, 0xc4000, 0x3},
-	{OP_IF_MODE_AND, 1, 0xc}, /* emul+e2 */
-	{OP_WR, 0xc4000, 0x1},
-	{OP_IF_MODE_AND, 1, 0x1001}, /* asic+e3_a0 */
-	{OP_WR, 0xc4000, 0x5dc},
-	{OP_IF_MODE_AND, 1, 0x1002}, /* fpga+e3_a0 */
-	{OP_WR, 0xc4000, 0x4},
-	{OP_IF_MODE_AND, 1, 0x1004}, /* emul+e3_a0 */
-	{OP_WR, 0xc4000, 0x1},
-	{OP_IF_MODE_AND, 1, 0x2001}, /* asic+e3_b0 */
-	{OP_WR, 0xc4000, 0x5dc},
-	{OP_IF_MODE_AND, 1, 0x2002}, /* fpga+e3_b0 */
-	{OP_WR, 0xc4000, 0x4},
-	{OP_IF_MODE_AND, 1, 0x2004}, /* emul+e3_b0 */
-	{OP_WR, 0xc4000, 0x1},
-/* #define USDM_COMMON_END          595 */
-/* #define USEM_COMMON_START        616 */
-	{OP_ZP, 0x300400, 0xc10000},
-	{OP_WR_64, 0x3007e8, 0x3124b},
-	{OP_ZR, 0x320000, 0x4000},
-	{OP_ZR, 0x332400, 0x1600},
-	{OP_SW, 0x322c70, 0x90124d},
-	{OP_SW, 0x3234c0, 0x812dd},
-	{OP_ZR, 0x324080, 0x10},
-	{OP_SW, 0x3240c0, 0x212e5},
-	{OP_SW, 0x337400, 0x412e7},
-	{OP_WR, 0x338000, 0x1a},
-	{OP_WR, 0x338040, 0x4e},
-	{OP_WR, 0x338080, 0x10},
-	{OP_WR, 0x3380c0, 0x20},
-	{OP_WR, 0x338bc0, 0x1},
-	{OP_IF_MODE_AND, 2, 0x8}, /* e2 */
-	{OP_WR, 0x338380, 0x86470},
-	{OP_WR, 0x3383c0, 0x226},
-	{OP_IF_MODE_AND, 2, 0x9}, /* asic+e2 */
-	{OP_WR, 0x338300, 0x86470},
-	{OP_WR, 0x338340, 0x226},
-	{OP_IF_MODE_AND, 2, 0xa}, /* fpga+e2 */
-	{OP_WR, 0x338300, 0x55f},
-	{OP_WR, 0x338340, 0x1},
-	{OP_IF_MODE_AND, 2, 0xc}, /* emul+e2 */
-	{OP_WR, 0x338300, 0x157},
-	{OP_WR, 0x338340, 0x0},
-	{OP_IF_MODE_AND, 2, 0x1000}, /* e3_a0 */
-	{OP_WR, 0x338380, 0xc96a8},
-	{OP_WR, 0x3383c0, 0x339},
-	{OP_IF_MODE_AND, 2, 0x1001}, /* asic+e3_a0 */
-	{OP_WR, 0x338300, 0xc96a8},
-	{OP_WR, 0x338340, 0x339},
-	{OP_IF_MODE_AND, 2, 0x1002}, /* fpga+e3_a0 */
-	{OP_WR, 0x338300, 0x80e},
-	{OP_WR, 0x338340, 0x2},
-	{OP_IF_MODE_AND, 2, 0x1004}, /* emul+e3_a0 */
-	{OP_WR, 0x338300, 0x203},
-	{OP_WR, 0x338340, 0x0},
-	{OP_IF_MODE_AND, 2, 0x2000}, /* e3_b0 */
-	{OP_WR, 0x338380, 0xcf850},
-	{OP_WR, 0x3383c0, 0x352},
-	{OP_IF_MODE_AND, 2, 0x2001}, /* asic+e3_b0 */
-	{OP_WR, 0x338300, 0xcf850},
-	{OP_WR, 0x338340, 0x352},
-	{OP_IF_MODE_AND, 2, 0x2002}, /* fpga+e3_b0 */
-	{OP_WR, 0x338300, 0x84d},
-	{OP_WR, 0x338340, 0x2},
-	{OP_IF_MODE_AND, 2, 0x2004}, /* emul+e3_b0 */
-	{OP_WR, 0x338300, 0x213},
-	{OP_WR, 0x338340, 0x0},
-	{OP_ZP, 0x340000, 0x35020000},
-	{OP_ZP, 0x348000, 0x35d80d41},
-	{OP_ZP, 0x350000, 0x38641ab7},
-	{OP_ZP, 0x358000, 0x384928d0},
-	{OP_ZP, 0x360000, 0x353936e3},
-	{OP_ZP, 0x368000, 0x22f54432},
-	{OP_WR_64, 0x36d2c0, 0x25a812eb},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x331480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x331480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x11}, /* e3+asic */
-	{OP_WR, 0x331480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x8}, /* e2 */
-	{OP_WR, 0x3000bc, 0x32},
-	{OP_IF_MODE_AND, 4, 0x10}, /* e3 */
-	{OP_WR, 0x3000bc, 0x2},
-	{OP_WR, 0x338840, 0x1},
-	{OP_RD, 0x300138, 0x0},
-	{OP_WR, 0x338840, 0x0},
-	{OP_IF_MODE_AND, 1, 0x11}, /* e3+asic */
-	{OP_WR, 0x331480, 0x1},
-	{OP_RD, 0x300000, 0x0},
-	{OP_RD, 0x300004, 0x0},
-	{OP_RD, 0x300008, 0x0},
-	{OP_RD, 0x30000c, 0x0},
-	{OP_RD, 0x300010, 0x0},
-	{OP_RD, 0x300014, 0x0},
-	{OP_SW, 0x300020, 0x1a12ed},
-	{OP_SW, 0x3000a4, 0x21307},
-	{OP_WR, 0x300224, 0x0},
-	{OP_WR, 0x300234, 0x0},
-	{OP_WR, 0x30024c, 0x0},
-	{OP_WR, 0x3002e4, 0xffff},
-	{OP_WB_ZR, 0x302000, 0x800},
-	{OP_IF_MODE_AND, 1, 0x10}, /* e3 */
-	{OP_WB_ZR, 0x304000, 0x200},
-/* #define USEM_COMMON_END          617 */
-/* #define USEM_PORT0_START        618 */
-	{OP_ZR, 0x322c40, 0x2},
-	{OP_SW, 0x322c50, 0x41309},
-	{OP_ZR, 0x3293c0, 0x2},
-	{OP_ZR, 0x329400, 0x10},
-	{OP_ZR, 0x32c000, 0x20},
-	{OP_ZR, 0x32c100, 0x20},
-	{OP_ZR, 0x32c200, 0x20},
-	{OP_ZR, 0x32c300, 0x20},
-	{OP_ZR, 0x32c400, 0x20},
-	{OP_ZR, 0x32c500, 0x20},
-	{OP_ZR, 0x32c600, 0x20},
-	{OP_ZR, 0x32c700, 0x20},
-	{OP_ZR, 0x32c800, 0x20},
-	{OP_ZR, 0x32c900, 0x20},
-	{OP_ZR, 0x32ca00, 0x20},
-	{OP_ZR, 0x32cb00, 0x20},
-	{OP_ZR, 0x32cc00, 0x20},
-	{OP_ZR, 0x32cd00, 0x20},
-	{OP_ZR, 0x32ce00, 0x20},
-	{OP_ZR, 0x32cf00, 0x20},
-	{OP_ZR, 0x32db80, 0x2},
-/* #define USEM_PORT0_END          619 */
-/* #define USEM_PORT1_START        620 */
-	{OP_ZR, 0x322c48, 0x2},
-	{OP_SW, 0x322c60, 0x4130d},
-	{OP_ZR, 0x3293c8, 0x2},
-	{OP_ZR, 0x329440, 0x10},
-	{OP_ZR, 0x32c080, 0x20},
-	{OP_ZR, 0x32c180, 0x20},
-	{OP_ZR, 0x32c280, 0x20},
-	{OP_ZR, 0x32c380, 0x20},
-	{OP_ZR, 0x32c480, 0x20},
-	{OP_ZR, 0x32c580, 0x20},
-	{OP_ZR, 0x32c680, 0x20},
-	{OP_ZR, 0x32c780, 0x20},
-	{OP_ZR, 0x32c880, 0x20},
-	{OP_ZR, 0x32c980, 0x20},
-	{OP_ZR, 0x32ca80, 0x20},
-	{OP_ZR, 0x32cb80, 0x20},
-	{OP_ZR, 0x32cc80, 0x20},
-	{OP_ZR, 0x32cd80, 0x20},
-	{OP_ZR, 0x32ce80, 0x20},
-	{OP_ZR, 0x32cf80, 0x20},
-	{OP_ZR, 0x32db88, 0x2},
-/* #define USEM_PORT1_END          621 */
-/* #define USEM_PF0_START        622 */
-	{OP_ZR, 0x321010, 0x2},
-	{OP_ZR, 0x322c00, 0x2},
-/* #define USEM_PF0_END          623 */
-/* #define USEM_PF1_START        624 */
-	{OP_ZR, 0x321020, 0x2},
-	{OP_ZR, 0x322c08, 0x2},
-/* #define USEM_PF1_END          625 */
-/* #define USEM_PF2_START        626 */
-	{OP_ZR, 0x321030, 0x2},
-	{OP_ZR, 0x322c10, 0x2},
-/* #define USEM_PF2_END          627 */
-/* #define USEM_PF3_START        628 */
-	{OP_ZR, 0x321040, 0x2},
-	{OP_ZR, 0x322c18, 0x2},
-/* #define USEM_PF3_END          629 */
-/* #define USEM_PF4_START        630 */
-	{OP_ZR, 0x321050, 0x2},
-	{OP_ZR, 0x322c20, 0x2},
-/* #define USEM_PF4_END          631 */
-/* #define USEM_PF5_START        632 */
-	{OP_ZR, 0x321060, 0x2},
-	{OP_ZR, 0x322c28, 0x2},
-/* #define USEM_PF5_END          633 */
-/* #define USEM_PF6_START        634 */
-	{OP_ZR, 0x321070, 0x2},
-	{OP_ZR, 0x322c30, 0x2},
-/* #define USEM_PF6_END          635 */
-/* #define USEM_PF7_START        636 */
-	{OP_ZR, 0x321080, 0x2},
-	{OP_ZR, 0x322c38, 0x2},
-/* #define USEM_PF7_END          637 */
-/* #define XCM_COMMON_START        638 */
-	{OP_WR, 0x20058, 0x32},
-	{OP_SW, 0x20060, 0x81311},
-	{OP_SW, 0x200a0, 0xb1319},
-	{OP_WR, 0x200d0, 0x7},
-	{OP_SW, 0x200dc, 0x31324},
-	{OP_SW, 0x200f0, 0x21327},
-	{OP_WR, 0x200fc, 0xc},
-	{OP_WR, 0x20120, 0x0},
-	{OP_WR, 0x20134, 0x2},
-	{OP_WR, 0x201b0, 0x1},
-	{OP_WR, 0x2020c, 0x1},
-	{OP_SW, 0x20214, 0x21329},
-	{OP_WR, 0x20404, 0x1},
-	{OP_SW, 0x2040c, 0x2132b},
-	{OP_SW, 0x2041c, 0x4132d},
-	{OP_SW, 0x20480, 0x201331},
-	{OP_ZR, 0x20500, 0x12},
-	{OP_ZR, 0x28000, 0x2000},
-	{OP_SW, 0x20004, 0x141351},
-/* #define XCM_COMMON_END          639 */
-/* #define XCM_PF0_START        644 */
-	{OP_WR, 0x20108, 0xc8},
-	{OP_WR, 0x20118, 0x2},
-	{OP_WR, 0x201c4, 0x0},
-	{OP_WR, 0x201cc, 0x0},
-	{OP_WR, 0x201d4, 0x2},
-	{OP_WR, 0x201dc, 0x2},
-	{OP_WR, 0x201e4, 0xff},
-	{OP_WR, 0x201ec, 0xff},
-/* #define XCM_PF0_END          645 */
-/* #define XCM_PF1_START        646 */
-	{OP_WR, 0x2010c, 0xc8},
-	{OP_WR, 0x2011c, 0x2},
-	{OP_WR, 0x201c8, 0x0},
-	{OP_WR, 0x201d0, 0x0},
-	{OP_WR, 0x201d8, 0x2},
-	{OP_WR, 0x201e0, 0x2},
-	{OP_WR, 0x201e8, 0xff},
-	{OP_WR, 0x201f0, 0xff},
-/* #define XCM_PF1_END          647 */
-/* #define XCM_PF2_START        648 */
-	{OP_WR, 0x20108, 0xc8},
-	{OP_WR, 0x20118, 0x2},
-	{OP_WR, 0x201c4, 0x0},
-	{OP_WR, 0x201cc, 0x0},
-	{OP_WR, 0x201d4, 0x2},
-	{OP_WR, 0x201dc, 0x2},
-	{OP_WR, 0x201e4, 0xff},
-	{OP_WR, 0x201ec, 0xff},
-/* #define XCM_PF2_END          649 */
-/* #define XCM_PF3_START        650 */
-	{OP_WR, 0x2010c, 0xc8},
-	{OP_WR, 0x2011c, 0x2},
-	{OP_WR, 0x201c8, 0x0},
-	{OP_WR, 0x201d0, 0x0},
-	{OP_WR, 0x201d8, 0x2},
-	{OP_WR, 0x201e0, 0x2},
-	{OP_WR, 0x201e8, 0xff},
-	{OP_WR, 0x201f0, 0xff},
-/* #define XCM_PF3_END          651 */
-/* #define XCM_PF4_START        652 */
-	{OP_WR, 0x20108, 0xc8},
-	{OP_WR, 0x20118, 0x2},
-	{OP_WR, 0x201c4, 0x0},
-	{OP_WR, 0x201cc, 0x0},
-	{OP_WR, 0x201d4, 0x2},
-	{OP_WR, 0x201dc, 0x2},
-	{OP_WR, 0x201e4, 0xff},
-	{OP_WR, 0x201ec, 0xff},
-/* #define XCM_PF4_END          653 */
-/* #define XCM_PF5_START        654 */
-	{OP_WR, 0x2010c, 0xc8},
-	{OP_WR, 0x2011c, 0x2},
-	{OP_WR, 0x201c8, 0x0},
-	{OP_WR, 0x201d0, 0x0},
-	{OP_WR, 0x201d8, 0x2},
-	{OP_WR, 0x201e0, 0x2},
-	{OP_WR, 0x201e8, 0xff},
-	{OP_WR, 0x201f0, 0xff},
-/* #define XCM_PF5_END          655 */
-/* #define XCM_PF6_START        656 */
-	{OP_WR, 0x20108, 0xc8},
-	{OP_WR, 0x20118, 0x2},
-	{OP_WR, 0x201c4, 0x0},
-	{OP_WR, 0x201cc, 0x0},
-	{OP_WR, 0x201d4, 0x2},
-	{OP_WR, 0x201dc, 0x2},
-	{OP_WR, 0x201e4, 0xff},
-	{OP_WR, 0x201ec, 0xff},
-/* #define XCM_PF6_END          657 */
-/* #define XCM_PF7_START        658 */
-	{OP_WR, 0x2010c, 0xc8},
-	{OP_WR, 0x2011c, 0x2},
-	{OP_WR, 0x201c8, 0x0},
-	{OP_WR, 0x201d0, 0x0},
-	{OP_WR, 0x201d8, 0x2},
-	{OP_WR, 0x201e0, 0x2},
-	{OP_WR, 0x201e8, 0xff},
-	{OP_WR, 0x201f0, 0xff},
-/* #define XCM_PF7_END          659 */
-/* #define XPB_COMMON_START        660 */
-	{OP_WR, 0x161000, 0x28},
-/* #define XPB_COMMON_END          661 */
-/* #define XSDM_COMMON_START        682 */
-	{OP_SW, 0x166008, 0x31365},
-	{OP_SW, 0x16601c, 0x41368},
-	{OP_SW, 0x166038, 0x12136c},
-	{OP_ZR, 0x166080, 0xe},
-	{OP_WR, 0x1660b8, 0x1},
-	{OP_ZR, 0x1660bc, 0x8},
-	{OP_WR, 0x1660dc, 0x1},
-	{OP_ZR, 0x1660e0, 0x4},
-	{OP_WR, 0x1660f0, 0x1},
-	{OP_ZR, 0x1660f4, 0x31},
-	{OP_SW, 0x1661b8, 0x2137e},
-	{OP_ZR, 0x1661c0, 0x7},
-	{OP_SW, 0x1661dc, 0x61380},
-	{OP_ZR, 0x1661f4, 0x11},
-	{OP_SW, 0x166238, 0x41386},
-	{OP_RD, 0x166248, 0x0},
-	{OP_RD, 0x16624c, 0x0},
-	{OP_RD, 0x166250, 0x0},
-	{OP_RD, 0x166254, 0x0},
-	{OP_RD, 0x166258, 0x0},
-	{OP_RD, 0x16625c, 0x0},
-	{OP_RD, 0x166260, 0x0},
-	{OP_RD, 0x166264, 0x0},
-	{OP_RD, 0x166268, 0x0},
-	{OP_RD, 0x16626c, 0x0},
-	{OP_RD, 0x166270, 0x0},
-	{OP_RD, 0x166274, 0x0},
-	{OP_RD, 0x166278, 0x0},
-	{OP_RD, 0x16627c, 0x0},
-	{OP_RD, 0x1662d4, 0x0},
-	{OP_SW, 0x1662d8, 0x4138a},
-	{OP_IF_MODE_AND, 1, 0x9}, /* asic+e2 */
-	{OP_WR, 0x166000, 0x3e8},
-	{OP_IF_MODE_AND, 1, 0xa}, /* fpga+e2 */
-	{OP_WR, 0x166000, 0x3},
-	{OP_IF_MODE_AND, 1, 0xc}, /* emul+e2 */
-	{OP_WR, 0x166000, 0x1},
-	{OP_IF_MODE_AND, 1, 0x1001}, /* asic+e3_a0 */
-	{OP_WR, 0x166000, 0x5dc},
-	{OP_IF_MODE_AND, 1, 0x1002}, /* fpga+e3_a0 */
-	{OP_WR, 0x166000, 0x4},
-	{OP_IF_MODE_AND, 1, 0x1004}, /* emul+e3_a0 */
-	{OP_WR, 0x166000, 0x1},
-	{OP_IF_MODE_AND, 1, 0x2001}, /* asic+e3_b0 */
-	{OP_WR, 0x166000, 0x5dc},
-	{OP_IF_MODE_AND, 1, 0x2002}, /* fpga+e3_b0 */
-	{OP_WR, 0x166000, 0x4},
-	{OP_IF_MODE_AND, 1, 0x2004}, /* emul+e3_b0 */
-	{OP_WR, 0x166000, 0x1},
-/* #define XSDM_COMMON_END          683 */
-/* #define XSEM_COMMON_START        704 */
-	{OP_ZP, 0x280400, 0xa90000},
-	{OP_WR_64, 0x2807c8, 0x7138e},
-	{OP_ZR, 0x2a0000, 0x4000},
-	{OP_ZR, 0x2b2400, 0x1600},
-	{OP_SW, 0x2a3000, 0x21390},
-	{OP_SW, 0x2a4000, 0x101392},
-	{OP_SW, 0x2a8408, 0x813a2},
-	{OP_SW, 0x2a9348, 0x413aa},
-	{OP_SW, 0x2a9668, 0x813ae},
-	{OP_SW, 0x2a98b8, 0x213b6},
-	{OP_SW, 0x2a9950, 0x9013b8},
-	{OP_SW, 0x2b4d90, 0x141448},
-	{OP_WR, 0x2b8000, 0x0},
-	{OP_WR, 0x2b8040, 0x18},
-	{OP_WR, 0x2b8080, 0xc},
-	{OP_WR, 0x2b80c0, 0x66},
-	{OP_WR, 0x2b8bc0, 0x1},
-	{OP_IF_MODE_AND, 3, 0x8}, /* e2 */
-	{OP_WR, 0x2a9ca8, 0x2},
-	{OP_WR, 0x2b8380, 0x86470},
-	{OP_WR, 0x2b83c0, 0x226},
-	{OP_IF_MODE_AND, 2, 0x9}, /* asic+e2 */
-	{OP_WR, 0x2b8300, 0x86470},
-	{OP_WR, 0x2b8340, 0x226},
-	{OP_IF_MODE_AND, 2, 0xa}, /* fpga+e2 */
-	{OP_WR, 0x2b8300, 0x55f},
-	{OP_WR, 0x2b8340, 0x1},
-	{OP_IF_MODE_AND, 2, 0xc}, /* emul+e2 */
-	{OP_WR, 0x2b8300, 0x157},
-	{OP_WR, 0x2b8340, 0x0},
-	{OP_IF_MODE_AND, 3, 0x20}, /* port2 */
-	{OP_WR, 0x2a9cac, 0x0},
-	{OP_SW, 0x2ac4e0, 0x4145c},
-	{OP_SW, 0x2ac500, 0x21460},
-	{OP_IF_MODE_AND, 2, 0x40}, /* port4 */
-	{OP_WR, 0x2a9cac, 0x1},
-	{OP_SW, 0x2ac4e0, 0xa1462},
-	{OP_IF_MODE_AND, 3, 0x1000}, /* e3_a0 */
-	{OP_WR, 0x2a9ca8, 0x3},
-	{OP_WR, 0x2b8380, 0xc96a8},
-	{OP_WR, 0x2b83c0, 0x339},
-	{OP_IF_MODE_AND, 2, 0x1001}, /* asic+e3_a0 */
-	{OP_WR, 0x2b8300, 0xc96a8},
-	{OP_WR, 0x2b8340, 0x339},
-	{OP_IF_MODE_AND, 2, 0x1002}, /* fpga+e3_a0 */
-	{OP_WR, 0x2b8300, 0x80e},
-	{OP_WR, 0x2b8340, 0x2},
-	{OP_IF_MODE_AND, 2, 0x1004}, /* emul+e3_a0 */
-	{OP_WR, 0x2b8300, 0x203},
-	{OP_WR, 0x2b8340, 0x0},
-	{OP_IF_MODE_AND, 3, 0x2000}, /* e3_b0 */
-	{OP_WR, 0x2a9ca8, 0x4},
-	{OP_WR, 0x2b8380, 0xcf850},
-	{OP_WR, 0x2b83c0, 0x352},
-	{OP_IF_MODE_AND, 2, 0x2001}, /* asic+e3_b0 */
-	{OP_WR, 0x2b8300, 0xcf850},
-	{OP_WR, 0x2b8340, 0x352},
-	{OP_IF_MODE_AND, 2, 0x2002}, /* fpga+e3_b0 */
-	{OP_WR, 0x2b8300, 0x84d},
-	{OP_WR, 0x2b8340, 0x2},
-	{OP_IF_MODE_AND, 2, 0x2004}, /* emul+e3_b0 */
-	{OP_WR, 0x2b8300, 0x213},
-	{OP_WR, 0x2b8340, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4000}, /* cos3 */
-	{OP_WR, 0x2a9cb0, 0x0},
-	{OP_IF_MODE_AND, 1, 0x8000}, /* cos6 */
-	{OP_WR, 0x2a9cb0, 0x1},
-	{OP_ZR, 0x2b9448, 0x2},
-	{OP_ZP, 0x2c0000, 0x344e0000},
-	{OP_ZP, 0x2c8000, 0x3a7a0d14},
-	{OP_ZP, 0x2d0000, 0x2f2b1bb3},
-	{OP_ZP, 0x2d8000, 0x3b81277e},
-	{OP_ZP, 0x2e0000, 0x3c7e365f},
-	{OP_ZP, 0x2e8000, 0x3c57457f},
-	{OP_ZP, 0x2f0000, 0x322f5495},
-	{OP_ZP, 0x2f8000, 0xf106121},
-	{OP_WR_64, 0x2fa180, 0xbd0146c},
-	{OP_IF_MODE_AND, 1, 0x2}, /* fpga */
-	{OP_WR, 0x2b1480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x4}, /* emul */
-	{OP_WR, 0x2b1480, 0x0},
-	{OP_IF_MODE_AND, 1, 0x11}, /* e3+asic */
-	{OP_WR, 0x2b1480, 0x0},
-	{OP_IF_MODE_AND, 2, 0x8}, /* e2 */
-	{OP_WR, 0x2800bc, 0x32},
-	{OP_WR, 0x2b945c, 0x32},
-	{OP_IF_MODE_AND, 7, 0x10}, /* e3 */
-	{OP_WR, 0x2800bc, 0x2},
-	{OP_WR, 0x2b945c, 0x2},
-	{OP_WR, 0x2b8840, 0x1},
-	{OP_WR, 0x2b942c, 0x2},
-	{OP_RD, 0x280138, 0x0},
-	{OP_WR, 0x2b8840, 0x0},
-	{OP_WR, 0x2b942c, 0x0},
-	{OP_WR, 0x2b9440, 0x1},
-	{OP_IF_MODE_AND, 1, 0x11}, /* e3+asic */
-	{OP_WR, 0x2b1480, 0x1},
-	{OP_RD, 0x280000, 0x0},
-	{OP_RD, 0x280004, 0x0},
-	{OP_RD, 0x280008, 0x0},
-	{OP_RD, 0x28000c, 0x0},
-	{OP_RD, 0x280010, 0x0},
-	{OP_RD, 0x280014, 0x0},
-	{OP_SW, 0x280020, 0x1a146e},
-	{OP_SW, 0x2800a4, 0x21488},
-	{OP_WR, 0x280224, 0x0},
-	{OP_WR, 0x280234, 0x0},
-	{OP_WR, 0x28024c, 0x0},
-	{OP_WR, 0x2802e4, 0xffff},
-	{OP_WB_ZR, 0x282000, 0x800},
-	{OP_IF_MODE_AND, 1, 0x10}, /* e3 */
-	{OP_WB_ZR, 0x284000, 0x200},
-/* #define XSEM_COMMON_END          705 */
-/* #define XSEM_PORT0_START        706 */
-	{OP_ZR, 0x2a5000, 0x2},
-	{OP_ZR, 0x2a5010, 0x2},
-	{OP_ZR, 0x2a5020, 0x2},
-	{OP_ZR, 0x2a5030, 0x2},
-	{OP_ZR, 0x2a9358, 0x20},
-	{OP_ZR, 0x2a9458, 0xe},
-	{OP_SW, 0x2a9490, 0x2148a},
-	{OP_ZR, 0x2a94d8, 0xe},
-	{OP_SW, 0x2a9510, 0x2148c},
-	{OP_ZR, 0x2a9558, 0xe},
-	{OP_SW, 0x2a9590, 0x2148e},
-	{OP_ZR, 0x2a95d8, 0xe},
-	{OP_SW, 0x2a9610, 0x21490},
-	{OP_SW, 0x2a9688, 0x21492},
-	{OP_ZR, 0x2abc98, 0x2},
-/* #define XSEM_PORT0_END          707 */
-/* #define XSEM_PORT1_START        708 */
-	{OP_ZR, 0x2a5008, 0x2},
-	{OP_ZR, 0x2a5018, 0x2},
-	{OP_ZR, 0x2a5028, 0x2},
-	{OP_ZR, 0x2a5038, 0x2},
-	{OP_ZR, 0x2a93d8, 0x20},
-	{OP_ZR, 0x2a9498, 0xe},
-	{OP_SW, 0x2a94d0, 0x21494},
-	{OP_ZR, 0x2a9518, 0xe},
-	{OP_SW, 0x2a9550, 0x21496},
-	{OP_ZR, 0x2a9598, 0xe},
-	{OP_SW, 0x2a95d0, 0x21498},
-	{OP_ZR, 0x2a9618, 0xe},
-	{OP_SW, 0x2a9650, 0x2149a},
-	{OP_SW, 0x2a9690, 0x2149c},
-	{OP_ZR, 0x2abca0, 0x2},
-/* #define XSEM_PORT1_END          709 */
-/* #define XSEM_PF0_START        710 */
-	{OP_ZR, 0x2a5048, 0xe},
-	{OP_SW, 0x2a9698, 0x10149e},
-	{OP_ZR, 0x2a98d0, 0x2},
-	{OP_ZR, 0x2a9910, 0x2},
-	{OP_ZR, 0x2ac480, 0x2},
-/* #define XSEM_PF0_END          711 */
-/* #define XSEM_PF1_START        712 */
-	{OP_ZR, 0x2a5080, 0xe},
-	{OP_SW, 0x2a96d8, 0x1014ae},
-	{OP_ZR, 0x2a98d8, 0x2},
-	{OP_ZR, 0x2a9918, 0x2},
-	{OP_ZR, 0x2ac488, 0x2},
-/* #define XSEM_PF1_END          713 */
-/* #define XSEM_PF2_START        714 */
-	{OP_ZR, 0x2a50b8, 0xe},
-	{OP_SW, 0x2a9718, 0x1014be},
-	{OP_ZR, 0x2a98e0, 0x2},
-	{OP_ZR, 0x2a9920, 0x2},
-	{OP_ZR, 0x2ac490, 0x2},
-/* #define XSEM_PF2_END          715 */
-/* #define XSEM_PF3_START        716 */
-	{OP_ZR, 0x2a50f0, 0xe},
-	{OP_SW, 0x2a9758, 0x1014ce},
-	{OP_ZR, 0x2a98e8, 0x2},
-	{OP_ZR, 0x2a9928, 0x2},
-	{OP_ZR, 0x2ac498, 0x2},
-/* #define XSEM_PF3_END          717 */
-/* #define XSEM_PF4_START        718 */
-	{OP_ZR, 0x2a5128, 0xe},
-	{OP_SW, 0x2a9798, 0x1014de},
-	{OP_ZR, 0x2a98f0, 0x2},
-	{OP_ZR, 0x2a9930, 0x2},
-	{OP_ZR, 0x2ac4a0, 0x2},
-/* #define XSEM_PF4_END          719 */
-/* #define XSEM_PF5_START        720 */
-	{OP_ZR, 0x2a5160, 0xe},
-	{OP_SW, 0x2a97d8, 0x1014ee},
-	{OP_ZR, 0x2a98f8, 0x2},
-	{OP_ZR, 0x2a9938, 0x2},
-	{OP_ZR, 0x2ac4a8, 0x2},
-/* #define XSEM_PF5_END          721 */
-/* #define XSEM_PF6_START        722 */
-	{OP_ZR, 0x2a5198, 0xe},
-	{OP_SW, 0x2a9818, 0x1014fe},
-	{OP_ZR, 0x2a9900, 0x2},
-	{OP_ZR, 0x2a9940, 0x2},
-	{OP_ZR, 0x2ac4b0, 0x2},
-/* #define XSEM_PF6_END          723 */
-/* #define XSEM_PF7_START        724 */
-	{OP_ZR, 0x2a51d0, 0xe},
-	{OP_SW, 0x2a9858, 0x10150e},
-	{OP_ZR, 0x2a9908, 0x2},
-	{OP_ZR, 0x2a9948, 0x2},
-	{OP_ZR, 0x2ac4b8, 0x2},
-/* #define XSEM_PF7_END          725 */
-/* #define MISC_AEU_COMMON_START        726 */
-	{OP_ZR, 0xa000, 0xc},
-	{OP_ZR, 0xa050, 0x2},
-	{OP_SW, 0xa0ec, 0x8151e},
-	{OP_SW, 0xa19c, 0x41526},
-	{OP_WR, 0xa45c, 0xc00},
-	{OP_ZR, 0xa6a8, 0x2},
-	{OP_WR, 0xa6d0, 0x0},
-	{OP_WR, 0xa61c, 0x3},
-/* #define MISC_AEU_COMMON_END          727 */
-/* #define MISC_AEU_PORT0_START        728 */
-	{OP_SW, 0xa070, 0x5152a},
-	{OP_ZR, 0xa084, 0x5},
-	{OP_WR, 0xa098, 0xfe00000},
-	{OP_ZR, 0xa09c, 0x7},
-	{OP_SW, 0xa0b8, 0xd152f},
-	{OP_ZR, 0xa22c, 0x4},
-	{OP_WR, 0xa688, 0xfc},
-	{OP_ZR, 0xa68c, 0x7},
-	{OP_WR, 0xa6f4, 0x0},
-/* #define MISC_AEU_PORT0_END          729 */
-/* #define MISC_AEU_PORT1_START        730 */
-	{OP_SW, 0xa10c, 0x6153c},
-	{OP_ZR, 0xa124, 0x5},
-	{OP_WR, 0xa138, 0xfe00000},
-	{OP_ZR, 0xa13c, 0x7},
-	{OP_SW, 0xa158, 0xd1542},
-	{OP_ZR, 0xa23c, 0x4},
-	{OP_WR, 0xa6b0, 0xfc},
-	{OP_ZR, 0xa6b4, 0x7},
-	{OP_WR, 0xa6f8, 0x0},
-/* #define MISC_AEU_PORT1_END          731 */
-/* #define MISC_AEU_PF0_START        732 */
-	{OP_WR, 0xa030, 0x0},
-/* #define MISC_AEU_PF0_END          733 */
-/* #define MISC_AEU_PF1_START        734 */
-	{OP_WR, 0xa034, 0x0},
-/* #define MISC_AEU_PF1_END          735 */
-/* #define MISC_AEU_PF2_START        736 */
-	{OP_WR, 0xa038, 0x0},
-/* #define MISC_AEU_PF2_END          737 */
-/* #define MISC_AEU_PF3_START        738 */
-	{OP_WR, 0xa03c, 0x0},
-/* #define MISC_AEU_PF3_END          739 */
-/* #define MISC_AEU_PF4_START        740 */
-	{OP_WR, 0xa040, 0x0},
-/* #define MISC_AEU_PF4_END          741 */
-/* #define MISC_AEU_PF5_START        742 */
-	{OP_WR, 0xa044, 0x0},
-/* #define MISC_AEU_PF5_END          743 */
-/* #define MISC_AEU_PF6_START        744 */
-	{OP_WR, 0xa048, 0x0},
-/* #define MISC_AEU_PF6_END          745 */
-/* #define MISC_AEU_PF7_START        746 */
-	{OP_WR, 0xa04c, 0x0},
-/* #define MISC_AEU_PF7_END          747 */
-};
+static const u8 init_ops_zipped_e2[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0xed, 0x5b, 
+	0x7f, 0x74, 0x94, 0x57, 0x99, 0xbe, 0xdf, 0xfd, 0xee, 0x24, 0x93, 0xe4, 
+	0x4b, 0x98, 0x49, 0xc2, 0x30, 0xcd, 0xd0, 0x76, 0x1a, 0xb0, 0x9d, 0xcd, 
+	0xd0, 0x32, 0x66, 0x68, 0x8d, 0x96, 0xda, 0x69, 0xca, 0xae, 0xd1, 0x52, 
+	0x4d, 0x2b, 0xbb, 0x0d, 0x6b, 0xd7, 0x0e, 0x14, 0x95, 0xdd, 0xad, 0x1a, 
+	0x8f, 0xf5, 0x88, 0x2b, 0x6d, 0x27, 0xb4, 0xab, 0xd1, 0xb6, 0x36, 0xa5, 
+	0x80, 0xd4, 0xc5, 0x15, 0x6a, 0xb5, 0xe8, 0xba, 0x8a, 0xc7, 0x1e, 0xc5, 
+	0x53, 0xd6, 0x0d, 0x10, 0x20, 0x40, 0x0a, 0x01, 0x02, 0x04, 0x08, 0x10, 
+	0xd6, 0x6e, 0x8b, 0xdb, 0xaa, 0x78, 0xc4, 0x15, 0xb7, 0x75, 0xd9, 0xe7, 
+	0xbd, 0xf7, 0xc9, 0x0f, 0xbe, 0xdd, 0xfd, 0x43, 0xff, 0xd8, 0x3d, 0x7b, 
+	0xce, 0xf2, 0xcf, 0xc3, 0x73, 0xef, 0xfb, 0xdc, 0x7b, 0xbf, 0x7b, 0xbf, 
+	0x77, 0xee, 0x7b, 0xdf, 0xfb, 0x45, 0xc7, 0xd5, 0x66, 0xa5, 0x94, 0xa7, 
+	0xcb, 0xd4, 0x88, 0xa0, 0x5f, 0x16, 0x53, 0xde, 0x45, 0xa5, 0x2a, 0xf1, 
+	0x7f, 0xf0, 0xa8, 0x2e, 0x9b, 0xf6, 0x86, 0xba, 0x79, 0xd4, 0x23, 0x8f, 
+	0xf9, 0xe0, 0xda, 0xf3, 0x2e, 0x8e, 0xd5, 0xfb, 0x65, 0x5a, 0x29, 0xdf, 
+	0xa8, 0x89, 0x7a, 0xcb, 0x7d, 0xc7, 0xd3, 0xca, 0x94, 0xe9, 0xf9, 0x28, 
+	0xd7, 0xe0, 0x06, 0x3c, 0xed, 0x97, 0x79, 0xa3, 0xca, 0x98, 0x32, 0xd8, 
+	0xcd, 0x53, 0xda, 0x54, 0x02, 0x17, 0x00, 0x03, 0xe0, 0x12, 0x60, 0x0d, 
+	0xec, 0x7c, 0xd8, 0x15, 0x68, 0x27, 0xed, 0x15, 0xd0, 0x5e, 0xbd, 0x96, 
+	0x7a, 0xa5, 0x32, 0x1c, 0xa7, 0x9a, 0xe8, 0xdf, 0x1b, 0x86, 0x6e, 0x1a, 
+	0xb8, 0x66, 0xfb, 0xbd, 0xe0, 0x97, 0x01, 0x07, 0xa1, 0x4f, 0xb1, 0xbc, 
+	0xc0, 0xf2, 0x2b, 0x59, 0x7e, 0xd5, 0x44, 0xb9, 0x4e, 0xa3, 0xfc, 0x4d, 
+	0xc0, 0x1c, 0xca, 0xaf, 0xd1, 0xd5, 0x6a, 0x1e, 0xda, 0x6d, 0xf6, 0xab, 
+	0xd5, 0x7c, 0xf0, 0xac, 0xa9, 0x56, 0x77, 0x83, 0x1b, 0xf0, 0xc7, 0xc0, 
+	0x67, 0x03, 0xd7, 0xab, 0x88, 0xc9, 0xc3, 0x4e, 0xe6, 0x4d, 0x83, 0xf7, 
+	0xa2, 0xbc, 0x45, 0x57, 0x7b, 0x77, 0xdb, 0xf9, 0xab, 0xf6, 0xe4, 0x39, 
+	0xe6, 0xea, 0x6a, 0x6d, 0x1c, 0xd7, 0x01, 0xc6, 0xff, 0x76, 0xa0, 0xf4, 
+	0x73, 0x8b, 0xa9, 0xd6, 0x25, 0x94, 0xd7, 0xfa, 0xd5, 0x78, 0xcc, 0xa4, 
+	0xb9, 0xd5, 0x54, 0x17, 0xec, 0xd3, 0x8c, 0x3d, 0x8f, 0xa9, 0xf6, 0x8b, 
+	0xc0, 0x00, 0xed, 0x1a, 0x35, 0xc5, 0xbc, 0x0f, 0xed, 0xd6, 0x83, 0x57, 
+	0x03, 0x93, 0xc0, 0x6b, 0xc9, 0x2f, 0x27, 0xbf, 0x89, 0xfc, 0x76, 0xf2, 
+	0x0f, 0x93, 0xff, 0x19, 0xf9, 0x03, 0x7e, 0x2c, 0x26, 0xeb, 0xf1, 0x17, 
+	0x3a, 0x16, 0x6b, 0x97, 0xf1, 0x94, 0xc7, 0xe2, 0x58, 0x25, 0xf3, 0xe1, 
+	0x68, 0x2c, 0x2e, 0x1d, 0x47, 0xc1, 0x8b, 0xe0, 0x0f, 0x80, 0xaf, 0x07, 
+	0x4f, 0x96, 0xc7, 0x92, 0x98, 0x18, 0xf3, 0xb8, 0x89, 0xc9, 0xb2, 0x79, 
+	0x4a, 0xc7, 0x3a, 0xed, 0x73, 0x8c, 0xcf, 0x77, 0xac, 0x30, 0xa4, 0x74, 
+	0xd9, 0xe3, 0x3a, 0x56, 0xc8, 0xc8, 0x7a, 0x03, 0x31, 0x5f, 0x37, 0x5f, 
+	0x04, 0x76, 0x28, 0x94, 0x00, 0x1f, 0x51, 0x8f, 0xac, 0x7c, 0x97, 0xe5, 
+	0x32, 0x41, 0xb1, 0x5b, 0x5a, 0xec, 0xfb, 0xf5, 0x7b, 0xa2, 0x1f, 0xa4, 
+	0xa3, 0xca, 0x2f, 0x7b, 0x02, 0x38, 0x1d, 0x2f, 0xd3, 0x4a, 0x60, 0x0b, 
+	0x70, 0x8d, 0x09, 0xd2, 0x6d, 0x76, 0x1e, 0x82, 0xf4, 0x16, 0xb1, 0x03, 
+	0xef, 0x05, 0xde, 0xec, 0x07, 0x57, 0x6d, 0x81, 0xfd, 0x97, 0x4c, 0x70, 
+	0x55, 0x3f, 0xf8, 0x74, 0x3f, 0x68, 0x14, 0xfb, 0x2f, 0x7b, 0x41, 0xa3, 
+	0xd8, 0x2b, 0xe0, 0x7c, 0x62, 0x3b, 0x71, 0x01, 0xb1, 0x83, 0x78, 0x37, 
+	0xb1, 0x48, 0x5c, 0x42, 0x5c, 0x4a, 0xbc, 0x8f, 0xd8, 0x49, 0xbc, 0x9f, 
+	0xb8, 0x8c, 0xb8, 0x5c, 0x10, 0xfd, 0x0e, 0xa3, 0xdf, 0x0d, 0x9c, 0xb7, 
+	0x0a, 0x8c, 0x53, 0x4a, 0xcf, 0x92, 0x57, 0x3a, 0xae, 0xe8, 0x27, 0x2a, 
+	0x20, 0xe7, 0x3c, 0xc7, 0x3c, 0xc7, 0x23, 0x23, 0xe4, 0x9a, 0xf5, 0x86, 
+	0xdc, 0x5c, 0x6a, 0x9f, 0x0e, 0xd9, 0xa7, 0x43, 0xf6, 0xe9, 0x71, 0xfb, 
+	0x48, 0x1a, 0xcb, 0xf9, 0x31, 0xa5, 0xca, 0xd2, 0xe5, 0x25, 0x15, 0x2b, 
+	0xfb, 0x9a, 0x69, 0x94, 0xe2, 0x82, 0x32, 0x33, 0x66, 0x02, 0x13, 0xca, 
+	0x6f, 0x8c, 0x77, 0xaa, 0x68, 0xd9, 0x73, 0xc0, 0x8d, 0xaa, 0xa7, 0xec, 
+	0x3b, 0xa6, 0x51, 0xa6, 0x55, 0x95, 0xf9, 0x8d, 0xbd, 0x49, 0x65, 0xca, 
+	0x6f, 0x06, 0xcf, 0xd8, 0xf7, 0xb3, 0xb1, 0xb7, 0x03, 0xfc, 0x56, 0xf0, 
+	0xa5, 0xe4, 0x6b, 0xc1, 0xdf, 0x01, 0xbe, 0x91, 0x1c, 0xcf, 0x5f, 0x7e, 
+	0x1b, 0xf8, 0x59, 0xc7, 0xb7, 0x8a, 0xfe, 0x3d, 0xa6, 0x71, 0x2b, 0xf5, 
+	0x5b, 0x45, 0xff, 0x5e, 0x70, 0xea, 0xb7, 0x8a, 0xfe, 0x2e, 0x70, 0xea, 
+	0xb7, 0x8a, 0xfe, 0x7d, 0xe0, 0xd4, 0x6f, 0x13, 0xfd, 0x3d, 0xa6, 0x71, 
+	0x1b, 0xf5, 0xdb, 0x44, 0x7f, 0x2f, 0x38, 0xf5, 0xdb, 0x44, 0xff, 0x21, 
+	0x70, 0xea, 0xb7, 0x89, 0xfe, 0x2f, 0xc1, 0xa9, 0xdf, 0x2e, 0xfa, 0x8f, 
+	0x9a, 0xc6, 0xed, 0xd4, 0x6f, 0x17, 0xfd, 0xc7, 0xc1, 0xa9, 0xdf, 0x2e, 
+	0xfa, 0x4f, 0x82, 0x53, 0xbf, 0x5d, 0xf4, 0x9f, 0x06, 0xa7, 0xbe, 0x4f, 
+	0xf4, 0x0f, 0x99, 0xc6, 0x3e, 0xea, 0xfb, 0x44, 0xff, 0x30, 0x38, 0xf5, 
+	0x7d, 0xa2, 0xff, 0x2c, 0x38, 0xf5, 0x7d, 0xa2, 0x7f, 0x14, 0x9c, 0xfa, 
+	0x1d, 0xa2, 0x7f, 0xc2, 0x34, 0xee, 0xa0, 0x7e, 0x87, 0xe8, 0x9f, 0x02, 
+	0xa7, 0x7e, 0x87, 0xe8, 0xbf, 0x08, 0x4e, 0xfd, 0x0e, 0xd1, 0xff, 0x0d, 
+	0x38, 0xf5, 0x3b, 0x45, 0xff, 0x15, 0xd3, 0xb8, 0x93, 0xfa, 0x9d, 0xa2, 
+	0xff, 0x2a, 0x38, 0xf5, 0x3b, 0x45, 0xff, 0x1c, 0x38, 0xf5, 0x3b, 0x45, 
+	0xff, 0x77, 0xe0, 0xd4, 0xef, 0x12, 0x3d, 0xd6, 0x73, 0x17, 0xf5, 0xbb, 
+	0x44, 0xff, 0x3d, 0x70, 0xea, 0x77, 0x89, 0xfe, 0x07, 0xe0, 0xd4, 0xef, 
+	0x12, 0xfd, 0x0b, 0xe0, 0xd4, 0xf7, 0x8b, 0xfe, 0x1f, 0x4d, 0x63, 0x3f, 
+	0xf5, 0xfd, 0xa2, 0xdf, 0x0e, 0x4e, 0x7d, 0xbf, 0xe8, 0x77, 0x81, 0x53, 
+	0xdf, 0x2f, 0xfa, 0xbd, 0xe0, 0xd4, 0xef, 0x16, 0xfd, 0x7e, 0xd3, 0xb8, 
+	0x9b, 0xfa, 0xdd, 0xa2, 0x3f, 0x04, 0x4e, 0xfd, 0x6e, 0xd1, 0x1f, 0x05, 
+	0xa7, 0x7e, 0xb7, 0xe8, 0x4f, 0x80, 0x53, 0xbf, 0x47, 0xf4, 0xa7, 0x4d, 
+	0xe3, 0x1e, 0xea, 0xf7, 0x88, 0xfe, 0xc7, 0xe0, 0xd4, 0xef, 0x11, 0xfd, 
+	0x2b, 0xe0, 0xd4, 0xef, 0x11, 0xfd, 0xab, 0xe0, 0xd4, 0xef, 0x15, 0xfd, 
+	0xcf, 0x4d, 0xe3, 0x5e, 0xea, 0xf7, 0x8a, 0xfe, 0x97, 0xe0, 0xd4, 0xef, 
+	0x15, 0xfd, 0xaf, 0xc1, 0xa9, 0xdf, 0x2b, 0xfa, 0xd7, 0xc1, 0xa9, 0x1f, 
+	0x10, 0xfd, 0x45, 0xd3, 0x38, 0x40, 0xfd, 0x00, 0xf4, 0x51, 0x1f, 0x9c, 
+	0xfa, 0x01, 0xe8, 0xa3, 0xe5, 0xe0, 0xd4, 0x0f, 0x40, 0x1f, 0xad, 0x02, 
+	0xa7, 0xfe, 0x45, 0xe8, 0xa3, 0x53, 0x4c, 0xe3, 0x8b, 0xd4, 0xbf, 0x28, 
+	0xfa, 0x3a, 0x70, 0xea, 0x5f, 0x14, 0xfd, 0x34, 0x70, 0xea, 0x5f, 0x14, 
+	0x7d, 0x0a, 0x9c, 0xfa, 0x7d, 0xa2, 0xbf, 0xd2, 0x34, 0xee, 0xa3, 0x7e, 
+	0x9f, 0xe8, 0x67, 0x80, 0x53, 0xbf, 0x4f, 0xf4, 0xd7, 0x80, 0x53, 0xbf, 
+	0x4f, 0xf4, 0x59, 0x70, 0xea, 0xf7, 0x8b, 0x7e, 0xb6, 0x69, 0xdc, 0x4f, 
+	0xfd, 0x7e, 0xd1, 0xe7, 0xc1, 0xa9, 0xdf, 0x2f, 0xfa, 0xb7, 0x80, 0x53, 
+	0xbf, 0x5f, 0xf4, 0x37, 0x82, 0x53, 0x3f, 0x28, 0x7a, 0xf8, 0xff, 0x20, 
+	0xf5, 0x83, 0xa2, 0x87, 0xff, 0x0f, 0x52, 0x3f, 0x28, 0x7a, 0xf8, 0xff, 
+	0x20, 0xf5, 0x83, 0xa2, 0x87, 0xff, 0x0f, 0x52, 0x7f, 0x40, 0xf4, 0xf0, 
+	0xff, 0x03, 0xd4, 0x1f, 0x10, 0x3d, 0xfc, 0xff, 0x00, 0xf5, 0x07, 0x44, 
+	0x0f, 0xff, 0x3f, 0x40, 0xfd, 0x01, 0xd1, 0xc3, 0xff, 0x0f, 0x50, 0x7f, 
+	0x50, 0xf4, 0xf0, 0xff, 0x83, 0xd4, 0x1f, 0x14, 0x3d, 0xfc, 0xff, 0x20, 
+	0xf5, 0x07, 0x45, 0x0f, 0xff, 0x3f, 0x48, 0xfd, 0x41, 0xd1, 0xc3, 0xff, 
+	0x0f, 0x52, 0x7f, 0x48, 0xf4, 0xf0, 0xff, 0x43, 0xd4, 0x1f, 0x12, 0x3d, 
+	0xfc, 0xff, 0x10, 0xf5, 0x87, 0x44, 0x0f, 0xff, 0x3f, 0x44, 0xfd, 0x21, 
+	0xd1, 0xc3, 0xff, 0x0f, 0x51, 0x3f, 0x24, 0x7a, 0xf8, 0xff, 0x10, 0xf5, 
+	0x43, 0xa2, 0x87, 0xff, 0x0f, 0x51, 0x3f, 0x24, 0x7a, 0xf8, 0xff, 0x10, 
+	0xf5, 0x43, 0xa2, 0x87, 0xff, 0x0f, 0x51, 0x7f, 0x58, 0xf4, 0xf0, 0xff, 
+	0xc3, 0xd4, 0x1f, 0x16, 0x3d, 0xfc, 0xff, 0x30, 0xf5, 0x87, 0x45, 0x0f, 
+	0xff, 0x3f, 0x4c, 0xfd, 0x61, 0xd1, 0xc3, 0xff, 0x0f, 0x53, 0x7f, 0x44, 
+	0xf4, 0xf0, 0xff, 0x23, 0xd4, 0x1f, 0x11, 0x3d, 0xfc, 0xff, 0x08, 0xf5, 
+	0x47, 0x44, 0x0f, 0xff, 0x3f, 0x42, 0xfd, 0x11, 0xd1, 0xc3, 0xff, 0x8f, 
+	0x50, 0x7f, 0x54, 0xf4, 0xf0, 0xff, 0xa3, 0xd4, 0x1f, 0x15, 0x3d, 0xfc, 
+	0xff, 0x28, 0xf5, 0x47, 0x45, 0x0f, 0xff, 0x3f, 0x4a, 0xfd, 0x51, 0xd1, 
+	0xc3, 0xff, 0x8f, 0x52, 0x3f, 0x2c, 0x7a, 0xf8, 0xff, 0x30, 0xf5, 0xc3, 
+	0xa2, 0x87, 0xff, 0x0f, 0x53, 0x3f, 0x2c, 0x7a, 0xf8, 0xff, 0x30, 0xf5, 
+	0xc3, 0xa2, 0x87, 0xff, 0x0f, 0x53, 0x7f, 0x4c, 0xf4, 0xf0, 0xff, 0x63, 
+	0xd4, 0x1f, 0x13, 0x3d, 0xfc, 0xff, 0x18, 0xf5, 0xc7, 0x44, 0x0f, 0xff, 
+	0x3f, 0x46, 0xfd, 0x31, 0xd1, 0xc3, 0xff, 0x8f, 0x51, 0x7f, 0x5c, 0xf4, 
+	0xf0, 0xff, 0xe3, 0xd4, 0x1f, 0x17, 0x3d, 0xfc, 0xff, 0x38, 0xf5, 0xc7, 
+	0x45, 0x0f, 0xff, 0x3f, 0x4e, 0xfd, 0x71, 0xd1, 0xc3, 0xff, 0x8f, 0x53, 
+	0x7f, 0x42, 0xf4, 0xf0, 0xff, 0x13, 0xd4, 0x9f, 0x10, 0x3d, 0xfc, 0xff, 
+	0x04, 0xf5, 0x27, 0x44, 0x0f, 0xff, 0x3f, 0x41, 0xfd, 0x09, 0xd1, 0xc3, 
+	0xff, 0x4f, 0x50, 0x3f, 0x22, 0x7a, 0xf8, 0xff, 0x08, 0xf5, 0x23, 0xd0, 
+	0x57, 0xc0, 0xff, 0x47, 0xa8, 0x1f, 0x81, 0xbe, 0x02, 0xfe, 0x3f, 0x42, 
+	0xfd, 0x08, 0xf4, 0x15, 0xf0, 0xff, 0x11, 0xea, 0x4f, 0x42, 0x5f, 0x01, 
+	0xff, 0x3f, 0x49, 0xfd, 0x49, 0xd1, 0xc3, 0xff, 0x4f, 0x52, 0x7f, 0x52, 
+	0xf4, 0xf0, 0xff, 0x93, 0xd4, 0x9f, 0x14, 0x3d, 0xfc, 0xff, 0x24, 0xf5, 
+	0xa7, 0x44, 0x0f, 0xff, 0x3f, 0x45, 0xfd, 0x29, 0xd1, 0xc3, 0xff, 0x4f, 
+	0x51, 0x7f, 0x4a, 0xf4, 0xf0, 0xff, 0x53, 0xd4, 0x9f, 0x12, 0x3d, 0xfc, 
+	0xff, 0x14, 0xf5, 0xa7, 0x45, 0x0f, 0xff, 0x3f, 0x4d, 0xfd, 0x69, 0xd1, 
+	0xc3, 0xff, 0x4f, 0x53, 0x7f, 0x5a, 0xf4, 0xf0, 0xff, 0xd3, 0xd4, 0x9f, 
+	0x16, 0x3d, 0xfc, 0xff, 0x34, 0xf5, 0xa3, 0xa2, 0x87, 0xff, 0x8f, 0x52, 
+	0x3f, 0x2a, 0x7a, 0xf8, 0xff, 0x28, 0xf5, 0xa3, 0xa2, 0x87, 0xff, 0x8f, 
+	0x52, 0x3f, 0x2a, 0x7a, 0xf8, 0xff, 0x28, 0xf5, 0x67, 0x44, 0x0f, 0xff, 
+	0x3f, 0x43, 0xfd, 0x19, 0xd1, 0xc3, 0xff, 0xcf, 0x50, 0x7f, 0x46, 0xf4, 
+	0xf0, 0xff, 0x33, 0xd4, 0x9f, 0x11, 0x3d, 0xfc, 0xff, 0x8c, 0xe8, 0xcb, 
+	0x4c, 0xe3, 0xbf, 0x4a, 0xbc, 0x9a, 0xd6, 0x33, 0x24, 0x7c, 0x46, 0x40, 
+	0x34, 0xa3, 0x24, 0xbc, 0x16, 0x28, 0x05, 0x39, 0xa0, 0x04, 0x2a, 0x35, 
+	0x7a, 0xc6, 0xa3, 0xbd, 0x8c, 0x8b, 0xb4, 0x3d, 0xbf, 0xcc, 0x78, 0xb8, 
+	0xa4, 0xa2, 0x4b, 0x3a, 0x81, 0x28, 0xd7, 0x57, 0xb3, 0xbc, 0x02, 0x5c, 
+	0xb1, 0xbc, 0x30, 0xa9, 0xbc, 0xd2, 0x96, 0xab, 0xc8, 0x3d, 0xae, 0x7c, 
+	0xbc, 0x9d, 0xc0, 0x95, 0x7b, 0x77, 0xb1, 0x5c, 0xb9, 0xf2, 0x98, 0xb2, 
+	0xed, 0x07, 0x6b, 0x36, 0xba, 0xf6, 0xfd, 0xb7, 0xb2, 0xdc, 0xb3, 0xf6, 
+	0xae, 0xbc, 0x30, 0xa9, 0x5c, 0xbb, 0x76, 0xa2, 0x35, 0x6c, 0x47, 0xb3, 
+	0xdc, 0xb8, 0x72, 0xed, 0x5f, 0xda, 0x7e, 0x9a, 0xed, 0x5f, 0x68, 0x67, 
+	0xfb, 0x77, 0xb2, 0x9c, 0xed, 0xdb, 0xf2, 0xc2, 0xa4, 0xf2, 0xb1, 0xf6, 
+	0x6f, 0xbf, 0xb4, 0xfd, 0xf4, 0x58, 0xfb, 0x75, 0x63, 0xed, 0x47, 0x10, 
+	0xee, 0xbd, 0x79, 0x48, 0xb0, 0xa4, 0xb2, 0x5e, 0xf0, 0x89, 0xb2, 0x99, 
+	0x27, 0xd2, 0xf7, 0xea, 0x8a, 0x7b, 0x18, 0x8f, 0xa2, 0x9d, 0xfa, 0xd2, 
+	0xa4, 0x73, 0x96, 0x09, 0xf1, 0x78, 0x88, 0x47, 0x71, 0xba, 0x91, 0x38, 
+	0xbc, 0xd9, 0x9d, 0xf3, 0xf0, 0xa0, 0x8e, 0xa3, 0x9d, 0x6e, 0x3b, 0x8f, 
+	0x5e, 0xda, 0x6b, 0xb1, 0xe7, 0x01, 0xc7, 0xc3, 0xed, 0xa0, 0x5e, 0xd9, 
+	0x7f, 0x40, 0x43, 0x8c, 0x12, 0x03, 0x62, 0x8c, 0x58, 0x6f, 0x03, 0xe7, 
+	0x34, 0x26, 0xa7, 0xa1, 0x62, 0x11, 0xf0, 0x59, 0xa5, 0x2b, 0x3e, 0xad, 
+	0xd3, 0x7a, 0xa6, 0x6d, 0x3f, 0xad, 0xe7, 0x10, 0xe7, 0x13, 0x5f, 0x52, 
+	0xea, 0xe2, 0xc5, 0x68, 0x5a, 0x3a, 0x88, 0x8e, 0x9f, 0x53, 0xa3, 0x69, 
+	0x3b, 0x3d, 0xca, 0x34, 0xc6, 0xa5, 0x1f, 0x6d, 0x1a, 0x9d, 0xcc, 0x34, 
+	0x2e, 0x54, 0xee, 0x7d, 0x2b, 0x8a, 0x41, 0xce, 0x34, 0xfe, 0xd2, 0xbe, 
+	0x6f, 0xb0, 0x8b, 0xd1, 0x8e, 0xf6, 0x0b, 0x93, 0xce, 0x6e, 0x91, 0xa2, 
+	0x5d, 0x81, 0x76, 0x49, 0xda, 0xd1, 0x7e, 0x61, 0x8e, 0x76, 0xbd, 0xb4, 
+	0x2b, 0xd1, 0x2e, 0x4d, 0x3b, 0xda, 0x2f, 0x6c, 0x73, 0x76, 0x8b, 0x4b, 
+	0xb4, 0xeb, 0xa5, 0x5d, 0x86, 0x76, 0xb4, 0x5f, 0x58, 0x74, 0x76, 0xf7, 
+	0x72, 0x7c, 0xe7, 0xc7, 0xc6, 0x97, 0xa3, 0x1d, 0xed, 0x17, 0x2e, 0x73, 
+	0x76, 0x4b, 0x38, 0xbe, 0xf3, 0x63, 0xe3, 0x6b, 0xa1, 0x1d, 0xed, 0x17, 
+	0xf6, 0xd0, 0x8e, 0xe3, 0x3b, 0x3f, 0x36, 0xbe, 0x02, 0xed, 0x68, 0xbf, 
+	0x70, 0xa3, 0xb3, 0xfb, 0x00, 0xc7, 0x77, 0xde, 0x8d, 0x2f, 0x66, 0xa7, 
+	0x7d, 0xd4, 0x8f, 0xe1, 0x7c, 0xa6, 0x2b, 0x1e, 0xd0, 0x31, 0x7b, 0x0e, 
+	0xd3, 0xe0, 0x06, 0xfc, 0x21, 0x3d, 0xcd, 0xae, 0xa3, 0x06, 0xce, 0x92, 
+	0x65, 0x03, 0xb6, 0xa8, 0xe5, 0x31, 0xe3, 0x4f, 0xc3, 0x39, 0xbb, 0xac, 
+	0xa2, 0x0b, 0xbc, 0xd3, 0xfa, 0xfb, 0x34, 0xb5, 0x0c, 0xf6, 0x9f, 0xd5, 
+	0xd3, 0xbc, 0xbe, 0x28, 0x66, 0x4e, 0x4f, 0xf3, 0xe7, 0xd9, 0xf3, 0xdf, 
+	0x34, 0xbc, 0x0e, 0xd1, 0x8a, 0xcf, 0x01, 0x73, 0xc0, 0x27, 0x81, 0x25, 
+	0xfc, 0x2e, 0x3c, 0x3d, 0xfe, 0xde, 0x4d, 0x53, 0x73, 0x27, 0xce, 0x39, 
+	0x78, 0xef, 0x1c, 0x97, 0x72, 0x79, 0x8f, 0xa6, 0xa0, 0xbd, 0xd7, 0x5c, 
+	0xff, 0xde, 0x79, 0xe2, 0xff, 0x28, 0x1f, 0x1f, 0x67, 0x9d, 0x92, 0xf5, 
+	0x68, 0x06, 0x62, 0x7c, 0x8b, 0x36, 0x9a, 0x3a, 0x2f, 0x6a, 0xe7, 0xa3, 
+	0xce, 0xb3, 0xef, 0x3b, 0xd0, 0xbe, 0x80, 0xff, 0x57, 0xca, 0xf9, 0x5c, 
+	0xdd, 0x5a, 0x7d, 0xed, 0xc2, 0x04, 0xf7, 0xa2, 0xe4, 0x63, 0xf9, 0x82, 
+	0x1e, 0xad, 0xbe, 0xf9, 0xc8, 0xa4, 0xfa, 0x18, 0xf9, 0xe4, 0xfa, 0xee, 
+	0x50, 0x7d, 0xb7, 0x3d, 0xff, 0xab, 0x67, 0xec, 0xf9, 0x1a, 0x78, 0x3f, 
+	0xf1, 0x77, 0xe3, 0xde, 0x62, 0x3b, 0x5e, 0xdf, 0x53, 0xcf, 0xe3, 0xbd, 
+	0xfa, 0x32, 0x70, 0x00, 0xf8, 0x15, 0xed, 0x31, 0xcf, 0xe5, 0xa1, 0x3b, 
+	0x5d, 0xb1, 0x01, 0x7c, 0xb9, 0xca, 0x89, 0xbd, 0x7a, 0xc4, 0xe6, 0x97, 
+	0x3c, 0xf5, 0x98, 0xd3, 0x7b, 0x39, 0xfb, 0xbb, 0xe7, 0xf9, 0x19, 0xc7, 
+	0x23, 0x0b, 0xec, 0x3e, 0xe3, 0x15, 0x3b, 0xe4, 0xf7, 0x04, 0x58, 0x74, 
+	0xe5, 0x45, 0xe9, 0xb7, 0x1c, 0xb8, 0x89, 0xdc, 0xee, 0x3f, 0xc0, 0x7e, 
+	0x8e, 0xc3, 0xfe, 0x8e, 0x19, 0xaf, 0xb4, 0xc0, 0xce, 0xa3, 0x57, 0x5a, 
+	0xe6, 0xca, 0x4b, 0xb2, 0xaf, 0x95, 0xfb, 0x5e, 0xe9, 0x02, 0xc6, 0xf1, 
+	0x55, 0xdf, 0xeb, 0x0a, 0x80, 0x5f, 0xd3, 0x5e, 0xd7, 0xcc, 0x89, 0xdf, 
+	0x7f, 0xbc, 0x37, 0x5e, 0x09, 0xbf, 0x5f, 0x7f, 0xd4, 0x0d, 0xbb, 0xd7, 
+	0x50, 0xff, 0x1c, 0xe7, 0xad, 0x84, 0x72, 0xf1, 0xcb, 0x32, 0xc7, 0xb5, 
+	0x22, 0x2f, 0x77, 0xdc, 0xa8, 0x4b, 0xeb, 0xa3, 0x63, 0xbc, 0x86, 0x79, 
+	0x38, 0xe1, 0xf2, 0x9e, 0xb6, 0xa0, 0x3f, 0xc0, 0x9b, 0x5e, 0x02, 0xe2, 
+	0x77, 0xf5, 0xb6, 0x7e, 0xdf, 0xfb, 0x8c, 0xf8, 0xd7, 0x37, 0x30, 0x0f, 
+	0x7d, 0xee, 0x39, 0xd4, 0x05, 0xe2, 0x39, 0x62, 0x89, 0xf3, 0xd5, 0xcd, 
+	0xf9, 0xea, 0xe1, 0x7c, 0xcd, 0xe1, 0x7c, 0xcd, 0xe2, 0x7c, 0x2d, 0xe1, 
+	0x7c, 0xdd, 0xcd, 0xf9, 0x5a, 0xc2, 0xf9, 0xb9, 0x9f, 0xf3, 0xf5, 0x3c, 
+	0x39, 0xfb, 0x29, 0x0e, 0x70, 0xbe, 0x02, 0x37, 0x5f, 0x5d, 0x1b, 0x5d, 
+	0x7b, 0x5d, 0x83, 0xae, 0x7c, 0xc5, 0x1c, 0x37, 0x5f, 0x2b, 0xe6, 0x61, 
+	0x1e, 0xfe, 0x1e, 0xd8, 0x01, 0xfc, 0xce, 0xc4, 0x3c, 0xad, 0xc8, 0xb9, 
+	0x79, 0x5a, 0xd1, 0x82, 0xf2, 0xef, 0x4e, 0xcc, 0x53, 0xd7, 0x63, 0x97, 
+	0xce, 0x93, 0xe5, 0x93, 0xe6, 0x69, 0x72, 0x7d, 0x74, 0x8c, 0x4f, 0x9a, 
+	0xa7, 0x15, 0x2d, 0x6e, 0x9e, 0x56, 0xcc, 0x77, 0xf3, 0xb4, 0xa2, 0xc8, 
+	0x79, 0x1a, 0xc5, 0x3c, 0x7d, 0x0f, 0xcf, 0xdf, 0xcf, 0x79, 0x79, 0x83, 
+	0x78, 0xde, 0xe6, 0xa3, 0x3c, 0xbb, 0xdf, 0xc5, 0x81, 0xcb, 0x89, 0xbf, 
+	0x13, 0xd7, 0x53, 0x7b, 0x31, 0xaf, 0x9f, 0xbb, 0x1a, 0xb8, 0xce, 0xce, 
+	0x43, 0xbd, 0xdb, 0x1e, 0xc1, 0xed, 0xfb, 0xe1, 0x4f, 0xed, 0x95, 0xf7, 
+	0xe1, 0x07, 0xfe, 0xd4, 0xad, 0xf2, 0x1e, 0xff, 0x70, 0x2c, 0xdf, 0x0a, 
+	0x7e, 0x1e, 0xbf, 0x93, 0x2f, 0xf8, 0xf5, 0x58, 0x25, 0x5d, 0xb1, 0x1d, 
+	0x3a, 0xbb, 0xff, 0x56, 0xb8, 0x38, 0x23, 0x8a, 0x72, 0xa3, 0xfc, 0x8a, 
+	0x1d, 0x28, 0x9f, 0x27, 0xeb, 0x32, 0xf6, 0x9c, 0x28, 0x97, 0x79, 0xeb, 
+	0xb7, 0xe5, 0x53, 0x2e, 0x5e, 0x44, 0x3b, 0x45, 0x55, 0x5e, 0xb1, 0x07, 
+	0xb8, 0x16, 0xe5, 0x07, 0x2a, 0x5c, 0xde, 0x29, 0x6a, 0xea, 0xed, 0xef, 
+	0xea, 0x44, 0x7e, 0x57, 0xec, 0x64, 0x3d, 0xdd, 0xf8, 0xd0, 0x49, 0x0f, 
+	0xd6, 0x73, 0x54, 0x10, 0xeb, 0xf9, 0x4b, 0xe5, 0xab, 0x9e, 0x21, 0xe8, 
+	0x0f, 0x81, 0x8f, 0x2a, 0xf5, 0x71, 0xe1, 0x67, 0xc1, 0x0f, 0x83, 0x9f, 
+	0x27, 0x7f, 0x03, 0xfc, 0xa8, 0x56, 0x4f, 0xc2, 0x4f, 0xde, 0x0b, 0xdd, 
+	0x93, 0x31, 0x9b, 0x6f, 0x55, 0x4f, 0x66, 0xd0, 0xff, 0x31, 0xe0, 0x7d, 
+	0xd8, 0x27, 0x46, 0x8d, 0x7a, 0xf2, 0x11, 0x9b, 0x87, 0x52, 0x4f, 0xae, 
+	0x53, 0x91, 0x8a, 0x97, 0x7d, 0xb5, 0x6a, 0x16, 0x9e, 0xe3, 0x55, 0xe2, 
+	0xcf, 0x88, 0xbf, 0x20, 0x9e, 0x27, 0xfe, 0x9a, 0xf8, 0x6f, 0xc4, 0xdf, 
+	0x3a, 0xac, 0x94, 0x94, 0xb5, 0x51, 0xb5, 0x95, 0xbe, 0x36, 0x4a, 0xfc, 
+	0xf2, 0x56, 0xa0, 0xe4, 0xfd, 0xca, 0x80, 0x9d, 0xb6, 0x7f, 0x83, 0xdf, 
+	0x6b, 0x53, 0x39, 0xd5, 0x18, 0xfb, 0x9e, 0x47, 0xc0, 0xd7, 0x41, 0x77, 
+	0x19, 0xf8, 0x46, 0xd6, 0x6f, 0x56, 0xf1, 0xca, 0xe9, 0x58, 0x68, 0xbb, 
+	0x1e, 0xc0, 0x0c, 0x71, 0x16, 0x31, 0xe7, 0x02, 0x0a, 0xeb, 0x17, 0x53, 
+	0x7c, 0xe3, 0x0d, 0x62, 0x37, 0xb8, 0x56, 0x1b, 0x3d, 0xcb, 0xe9, 0x35, 
+	0xe2, 0xdf, 0xca, 0xd9, 0x7e, 0xad, 0x59, 0xa5, 0xae, 0xaa, 0xcc, 0xeb, 
+	0x5a, 0x5f, 0xfa, 0x59, 0x02, 0xec, 0xb1, 0x79, 0xd6, 0x5a, 0x5f, 0xfa, 
+	0x5b, 0x00, 0xdc, 0x02, 0xbc, 0x0b, 0xe5, 0xce, 0x0f, 0x6a, 0xfd, 0xfb, 
+	0xec, 0xef, 0x57, 0xad, 0xb7, 0x45, 0xcd, 0xad, 0xfc, 0x53, 0xbf, 0x56, 
+	0x6f, 0x42, 0xbb, 0x6b, 0x60, 0x37, 0x13, 0xb8, 0x56, 0xd7, 0x46, 0x9e, 
+	0x77, 0xf5, 0x91, 0x0b, 0xd0, 0x7d, 0x49, 0xd7, 0x96, 0x59, 0x7b, 0x5d, 
+	0xeb, 0x6d, 0x72, 0x58, 0x3e, 0xec, 0xda, 0xf9, 0x3d, 0x31, 0x96, 0x1b, 
+	0x76, 0x79, 0x64, 0xbc, 0xae, 0x91, 0xca, 0x2f, 0x97, 0xc7, 0xde, 0x9a, 
+	0x06, 0x3e, 0x53, 0x1e, 0xbb, 0x51, 0xf8, 0x73, 0xe5, 0xb1, 0xb9, 0x82, 
+	0xdf, 0xf2, 0x13, 0x25, 0xec, 0xd7, 0x95, 0xdf, 0xd5, 0x09, 0xfb, 0xbb, 
+	0xa7, 0x4d, 0xa2, 0xb4, 0xdc, 0xce, 0x63, 0xa2, 0xd4, 0x83, 0x71, 0xfe, 
+	0x10, 0xb8, 0x0e, 0xf8, 0x02, 0xea, 0xbf, 0x85, 0xf2, 0x05, 0xa8, 0xdf, 
+	0xcc, 0xfa, 0x01, 0xe8, 0xfe, 0x01, 0xe5, 0xe7, 0xac, 0xbf, 0x27, 0xba, 
+	0xc4, 0x3b, 0x77, 0x00, 0x33, 0x78, 0x9e, 0xbd, 0xc0, 0x02, 0xf8, 0x3e, 
+	0xe0, 0x52, 0xf0, 0x21, 0xe0, 0x46, 0xe0, 0x51, 0xe0, 0x59, 0xe0, 0x71, 
+	0xa0, 0x3c, 0xf7, 0x49, 0x3f, 0xb1, 0x22, 0x0a, 0x2f, 0x1f, 0x05, 0xce, 
+	0x41, 0x3f, 0xaf, 0x98, 0xc4, 0x8a, 0x65, 0x76, 0xde, 0x13, 0x2b, 0xba, 
+	0xa1, 0xff, 0x89, 0x4e, 0x74, 0xc7, 0xd2, 0x69, 0xcf, 0x03, 0xa6, 0x89, 
+	0x2d, 0xc4, 0x36, 0x41, 0x3f, 0xf1, 0xf2, 0x16, 0xe8, 0x7e, 0x8e, 0xf7, 
+	0xbc, 0xde, 0xae, 0x47, 0xa2, 0x04, 0x7f, 0xa8, 0xfc, 0x05, 0xc6, 0xf9, 
+	0x2c, 0x9f, 0x67, 0x93, 0x8d, 0x73, 0x12, 0xa5, 0xf3, 0xe8, 0xef, 0x02, 
+	0xfa, 0xc5, 0xf9, 0xa6, 0xf2, 0x75, 0xe0, 0x1c, 0xf0, 0x8b, 0x40, 0xac, 
+	0x6f, 0x15, 0xea, 0xbb, 0xee, 0x57, 0xd5, 0x55, 0x65, 0xc0, 0xe7, 0x81, 
+	0x75, 0x3a, 0xd1, 0x85, 0xf7, 0xde, 0x7b, 0x43, 0x27, 0x56, 0x58, 0x3f, 
+	0xc2, 0x78, 0xe6, 0xaa, 0xaa, 0xaa, 0x34, 0xc6, 0xb7, 0xd4, 0xfa, 0x79, 
+	0xa2, 0x3b, 0xf0, 0x3c, 0xe9, 0xbf, 0xbb, 0x5e, 0xf9, 0x55, 0x59, 0xe0, 
+	0x4c, 0x15, 0xa9, 0xba, 0x0e, 0x38, 0x17, 0x3c, 0x8f, 0x71, 0xf5, 0x29, 
+	0x5d, 0x75, 0x03, 0xf0, 0x2c, 0xca, 0x5b, 0x74, 0xe2, 0x95, 0x55, 0xdc, 
+	0x4f, 0xa7, 0xcb, 0x79, 0xc4, 0x8d, 0xb3, 0xea, 0xa6, 0xff, 0x7a, 0x9c, 
+	0x55, 0xf3, 0xdc, 0x38, 0xab, 0xde, 0xe1, 0xc6, 0x59, 0x75, 0x1b, 0xc7, 
+	0xf9, 0x6e, 0x8c, 0x6b, 0x99, 0x7d, 0x3f, 0x12, 0x5d, 0x8f, 0x10, 0x7b, 
+	0x88, 0xcf, 0xba, 0x71, 0x75, 0x6d, 0x26, 0xef, 0x23, 0x0e, 0x12, 0x5f, 
+	0x62, 0xfd, 0x7f, 0x7e, 0x2e, 0x5d, 0x75, 0x27, 0x78, 0x9b, 0x5a, 0xa9, 
+	0x56, 0x02, 0xdb, 0xbd, 0x99, 0xde, 0x4c, 0x94, 0x4b, 0x7f, 0x0b, 0xfe, 
+	0x9b, 0xe7, 0xed, 0xe0, 0xf3, 0xbe, 0x8f, 0xcf, 0x5b, 0xb4, 0xcf, 0xa9, 
+	0xab, 0xee, 0xd5, 0x89, 0x97, 0x2f, 0xc8, 0xe3, 0xe0, 0x39, 0x6b, 0xf0, 
+	0x9c, 0x69, 0x2d, 0xf3, 0x2a, 0x1d, 0x25, 0xba, 0x96, 0xa3, 0xfe, 0x03, 
+	0xc0, 0x6e, 0xe0, 0x87, 0x80, 0xab, 0xd0, 0xfe, 0x9f, 0x6b, 0x99, 0x6f, 
+	0x57, 0x8f, 0x75, 0xac, 0xfa, 0x30, 0xb0, 0x1f, 0xf8, 0x51, 0xe0, 0x10, 
+	0xea, 0x3f, 0x86, 0xf1, 0xcc, 0xab, 0x79, 0x67, 0xcd, 0x3b, 0x81, 0xf3, 
+	0x39, 0xbe, 0x05, 0x6e, 0x7c, 0x76, 0x7e, 0x3f, 0x01, 0x3c, 0x07, 0xfc, 
+	0xe4, 0xa4, 0xf9, 0x95, 0x7e, 0x0b, 0xec, 0xd7, 0x63, 0xbf, 0x9f, 0x62, 
+	0xbf, 0x9f, 0x66, 0xbf, 0x0f, 0xb0, 0x5f, 0x8f, 0xfd, 0x76, 0xb1, 0xdf, 
+	0x87, 0xd9, 0xef, 0x5f, 0x4b, 0xbf, 0xd6, 0x8f, 0xd0, 0xef, 0x94, 0x8b, 
+	0x53, 0x2e, 0x4a, 0xbf, 0x6e, 0x9c, 0xb6, 0xdf, 0xcf, 0xb1, 0xdf, 0x47, 
+	0xd9, 0xaf, 0xc4, 0x01, 0xe5, 0xf6, 0xf7, 0xd9, 0xad, 0xeb, 0xe3, 0xbe, 
+	0xac, 0xab, 0xae, 0x5a, 0xe5, 0xcb, 0xba, 0xea, 0xaa, 0x35, 0x9c, 0xf7, 
+	0x5e, 0xce, 0xfb, 0xcd, 0x5a, 0xe6, 0x5d, 0xa9, 0x87, 0xfc, 0xc4, 0x2b, 
+	0x5b, 0x54, 0xb4, 0x6a, 0x2d, 0xf4, 0x53, 0x94, 0x2a, 0xa4, 0xb9, 0xfe, 
+	0xeb, 0xb9, 0xfe, 0x5f, 0xe5, 0xfa, 0x3f, 0xc7, 0xf5, 0xff, 0x26, 0xdf, 
+	0xd3, 0x6f, 0xf3, 0x3d, 0x7d, 0x01, 0xeb, 0x04, 0x3f, 0xab, 0xea, 0x37, 
+	0xb2, 0x5e, 0xf2, 0xbb, 0x9b, 0x58, 0xd1, 0x89, 0xfe, 0xf6, 0x85, 0xd6, 
+	0x6b, 0x90, 0xeb, 0x75, 0x88, 0xeb, 0x35, 0xcc, 0xe7, 0x38, 0x31, 0x69, 
+	0xde, 0xaa, 0xd1, 0x7f, 0x81, 0xfd, 0x9f, 0x64, 0xff, 0xa3, 0xec, 0xff, 
+	0x25, 0xf6, 0xff, 0x0a, 0xfb, 0x7f, 0x95, 0xfd, 0x5f, 0xb0, 0xfd, 0xd7, 
+	0x04, 0x91, 0x4b, 0xfb, 0x0b, 0xea, 0x5c, 0x7f, 0x41, 0xc2, 0xf5, 0x17, 
+	0xa4, 0x5c, 0x7f, 0xc1, 0x15, 0x93, 0xe6, 0x0b, 0xfd, 0x95, 0x94, 0xeb, 
+	0x2f, 0x48, 0xbb, 0xfe, 0x82, 0x19, 0xae, 0xbf, 0xe0, 0x1a, 0xd7, 0x5f, 
+	0xd0, 0xe4, 0xfa, 0x0b, 0xae, 0x73, 0xfd, 0x05, 0x37, 0xb2, 0xbf, 0x36, 
+	0xf6, 0x97, 0x66, 0x7f, 0x7f, 0xc2, 0xfe, 0x16, 0xb2, 0xbf, 0xf7, 0xb3, 
+	0xbf, 0x45, 0x63, 0xcf, 0x87, 0xdf, 0x29, 0x89, 0xa3, 0x2e, 0xfa, 0xc6, 
+	0x44, 0x55, 0x7d, 0x70, 0xaf, 0x36, 0x66, 0xc0, 0xae, 0x7f, 0x04, 0xfb, 
+	0xa8, 0x0e, 0x3e, 0x09, 0x6c, 0x57, 0xd1, 0xe0, 0x53, 0xc0, 0x1e, 0x55, 
+	0x1e, 0x74, 0x01, 0xb1, 0x6e, 0x41, 0x37, 0xb0, 0x17, 0xf8, 0x79, 0x20, 
+	0xf6, 0xc7, 0xe0, 0x31, 0x1d, 0xb1, 0xf7, 0x76, 0xd0, 0x79, 0x38, 0x47, 
+	0x05, 0x5f, 0xd0, 0x11, 0xde, 0x1f, 0x46, 0x34, 0xe2, 0xc2, 0xa0, 0x07, 
+	0x7c, 0xba, 0xe4, 0x3f, 0x4c, 0x44, 0xdb, 0x0b, 0x43, 0x13, 0x11, 0xa8, 
+	0x1e, 0x8f, 0x13, 0x61, 0x87, 0x60, 0x25, 0x58, 0x09, 0x2c, 0xa9, 0x74, 
+	0xb0, 0x8a, 0xe5, 0x31, 0x96, 0x3f, 0x6f, 0xcb, 0x2f, 0x0f, 0xbe, 0x8f, 
+	0xfe, 0x8c, 0x8a, 0x05, 0x87, 0x74, 0x04, 0x9b, 0xb4, 0xe4, 0x4b, 0x22, 
+	0x4a, 0xfc, 0xf7, 0x3a, 0xf2, 0x2b, 0xc8, 0xdf, 0x4e, 0xfe, 0x6e, 0xf2, 
+	0x8f, 0x90, 0xbf, 0x9f, 0xfc, 0x41, 0x93, 0x28, 0xcc, 0x74, 0xbf, 0x2b, 
+	0x85, 0x1c, 0xe6, 0xe5, 0xc7, 0x3a, 0x21, 0xf7, 0x80, 0x0a, 0x7e, 0x59, 
+	0x90, 0xfd, 0x73, 0xba, 0x4e, 0xb4, 0x46, 0xdd, 0xfc, 0xb4, 0xc6, 0x88, 
+	0x69, 0x62, 0x86, 0x98, 0x23, 0xb6, 0x10, 0x8b, 0x93, 0xce, 0x4b, 0x15, 
+	0x68, 0x67, 0xba, 0xf2, 0x07, 0x7b, 0xc6, 0xef, 0xcb, 0x84, 0x2b, 0xfd, 
+	0xb1, 0xf1, 0xfb, 0x32, 0xcb, 0xd5, 0xba, 0xf1, 0xfb, 0x32, 0xe1, 0x91, 
+	0xcd, 0xc3, 0xe3, 0xf7, 0x65, 0xb6, 0xde, 0xff, 0xc6, 0xf8, 0x7d, 0x99, 
+	0xb3, 0xff, 0x97, 0xf1, 0xfb, 0xb2, 0x4b, 0xec, 0xd3, 0x21, 0xfb, 0xf4, 
+	0xb8, 0x3d, 0xd0, 0xc5, 0x5d, 0x89, 0xc2, 0xb0, 0xf3, 0xeb, 0x42, 0x14, 
+	0xcf, 0xfb, 0x32, 0xc6, 0x5b, 0x70, 0x7e, 0xdc, 0x6a, 0xef, 0x15, 0xa3, 
+	0x89, 0xd6, 0x4e, 0x7b, 0xee, 0x4b, 0xb4, 0xb6, 0xb3, 0xbc, 0x83, 0xe5, 
+	0x25, 0x3b, 0x4f, 0x26, 0x1d, 0xc5, 0x7b, 0xf7, 0x13, 0xe0, 0x74, 0xe0, 
+	0x4f, 0xb5, 0x49, 0xb7, 0xd8, 0xf5, 0x34, 0x69, 0xf1, 0xd7, 0x2b, 0xc1, 
+	0xed, 0xef, 0x2b, 0xb8, 0xe4, 0x4d, 0xee, 0xf1, 0x8d, 0xdc, 0x5b, 0x06, 
+	0xbf, 0xf0, 0x0c, 0xef, 0x2d, 0x0d, 0xef, 0x2d, 0x0d, 0xef, 0x2d, 0x0d, 
+	0xef, 0x2d, 0x0d, 0xef, 0x2d, 0x0d, 0xef, 0x2d, 0x0d, 0xef, 0x2d, 0x79, 
+	0xf0, 0x07, 0x2e, 0x25, 0xde, 0x47, 0xec, 0x24, 0xde, 0x4f, 0x5c, 0x46, 
+	0x74, 0xf7, 0x96, 0x72, 0xe1, 0x67, 0x82, 0x5f, 0x8d, 0xaf, 0x83, 0x09, 
+	0xdd, 0x5b, 0x9a, 0xd0, 0xbd, 0xa5, 0x09, 0xdd, 0x5b, 0x9a, 0xd0, 0xbd, 
+	0xa5, 0x09, 0xdd, 0x5b, 0x9a, 0xd0, 0xbd, 0xa5, 0x09, 0xdd, 0x5b, 0x9a, 
+	0xd0, 0xbd, 0x25, 0xed, 0x23, 0x49, 0xb8, 0xc3, 0xa3, 0xf8, 0x21, 0x4a, 
+	0x96, 0x6f, 0x56, 0x15, 0xc1, 0x6f, 0x4c, 0x03, 0xef, 0x2d, 0x53, 0xbc, 
+	0xb7, 0x6c, 0x48, 0xe0, 0x77, 0x36, 0x78, 0xdd, 0x6f, 0x98, 0x36, 0xaa, 
+	0x7a, 0x82, 0xdf, 0xfa, 0x0d, 0x05, 0x54, 0x56, 0x3f, 0x6e, 0x1a, 0x0a, 
+	0xed, 0xf6, 0xf7, 0xab, 0xa1, 0xb0, 0x54, 0xe9, 0xea, 0x27, 0xfd, 0x86, 
+	0x3b, 0xe1, 0x77, 0xd5, 0x4f, 0xf9, 0x0d, 0xf8, 0x8d, 0xf8, 0x4d, 0xf5, 
+	0x6a, 0xd3, 0xf0, 0xc4, 0x4b, 0x36, 0xce, 0x48, 0xdd, 0xd4, 0xa3, 0xea, 
+	0xe3, 0x5f, 0xd0, 0x29, 0x9b, 0xd6, 0x9a, 0x03, 0x94, 0xf5, 0x4d, 0x02, 
+	0x4b, 0xf6, 0x39, 0x53, 0x36, 0xbf, 0x98, 0xd6, 0xa9, 0xf1, 0xfc, 0xa2, 
+	0x6f, 0xcf, 0x1d, 0x0d, 0x89, 0x41, 0xbb, 0xee, 0x29, 0xe6, 0x19, 0x53, 
+	0xa1, 0x3c, 0x63, 0x8a, 0x79, 0xc6, 0x54, 0x28, 0xcf, 0x98, 0x62, 0x9e, 
+	0x31, 0x15, 0xca, 0x33, 0xa6, 0x98, 0x67, 0x4c, 0x3d, 0x3c, 0x39, 0x4f, 
+	0x96, 0x46, 0x3f, 0x43, 0x93, 0x78, 0x81, 0x9c, 0xe3, 0x88, 0x29, 0x8e, 
+	0xc3, 0xb7, 0xe3, 0x90, 0xbc, 0x63, 0x2a, 0x94, 0x8f, 0x4c, 0x31, 0x1f, 
+	0x99, 0x0a, 0xe5, 0x23, 0x53, 0xcc, 0x47, 0xa6, 0x42, 0xf9, 0xc8, 0x14, 
+	0xf3, 0x91, 0x13, 0xe3, 0xf0, 0xed, 0x79, 0xc8, 0xf5, 0x63, 0x5c, 0x3f, 
+	0x17, 0xda, 0xd9, 0xcf, 0x44, 0x5e, 0x32, 0xc5, 0xbc, 0x64, 0x2a, 0x94, 
+	0x97, 0x4c, 0x31, 0x2f, 0x99, 0x0a, 0xe5, 0x25, 0x53, 0xcc, 0x4b, 0x5e, 
+	0xf2, 0xbc, 0x05, 0xe9, 0x67, 0x78, 0x82, 0x97, 0xc6, 0xb8, 0x67, 0x52, 
+	0xab, 0xc4, 0x1f, 0x74, 0x04, 0xde, 0xd9, 0x2c, 0xa1, 0xe6, 0xf4, 0x92, 
+	0xba, 0x3e, 0x13, 0x3c, 0x11, 0xb9, 0x5c, 0xa9, 0xfc, 0xd6, 0xcb, 0x8e, 
+	0x45, 0x2e, 0x2f, 0xa9, 0xb7, 0x7c, 0xf0, 0xea, 0x3d, 0x91, 0x2b, 0x94, 
+	0x6a, 0xbc, 0x63, 0xce, 0xb3, 0x65, 0x57, 0xfc, 0xf1, 0xa6, 0xeb, 0xdf, 
+	0x15, 0x7f, 0x66, 0x3c, 0xaf, 0x99, 0x0a, 0xe5, 0x35, 0x53, 0xa1, 0xbc, 
+	0xe6, 0x04, 0x77, 0xe7, 0xca, 0xa4, 0xcb, 0x6b, 0xea, 0xd4, 0xaa, 0xbb, 
+	0x99, 0xdf, 0x2c, 0xb7, 0x79, 0xa6, 0x24, 0xf3, 0x9b, 0xae, 0x1c, 0xe8, 
+	0xf2, 0x9c, 0xe0, 0xb3, 0xec, 0x71, 0x35, 0xe9, 0xce, 0x03, 0x2c, 0x57, 
+	0x2c, 0x17, 0x2c, 0x4c, 0xca, 0x7f, 0x8c, 0xf5, 0xe7, 0xd9, 0xaf, 0x35, 
+	0xe4, 0x3f, 0x49, 0xe6, 0x3f, 0x93, 0xcc, 0x7f, 0x26, 0x99, 0xff, 0x4c, 
+	0x32, 0xff, 0x99, 0x64, 0xfe, 0x33, 0x29, 0xf9, 0xcf, 0xf8, 0xb3, 0x40, 
+	0xc4, 0x03, 0xf1, 0x1f, 0xe9, 0x24, 0xf3, 0x9f, 0x49, 0xe6, 0x3f, 0x93, 
+	0xcc, 0x7f, 0x26, 0x25, 0xff, 0xa9, 0x2e, 0x46, 0x93, 0xf6, 0x58, 0x35, 
+	0x91, 0xff, 0x4c, 0x8a, 0x5f, 0x95, 0xc1, 0x6f, 0x1a, 0x72, 0xca, 0xc4, 
+	0x7b, 0x4d, 0x83, 0x3d, 0xae, 0xd4, 0x02, 0x7b, 0x1c, 0x0e, 0xf5, 0xdb, 
+	0xf8, 0xb1, 0x61, 0x68, 0xd8, 0xfe, 0x4e, 0x35, 0x1c, 0x1e, 0xb6, 0x3c, 
+	0x35, 0xcf, 0x7d, 0x0f, 0xd0, 0xd0, 0x00, 0xff, 0x8a, 0xf7, 0xc1, 0xbe, 
+	0x8d, 0xba, 0x61, 0xea, 0x06, 0x9d, 0xee, 0x70, 0x07, 0x75, 0xa3, 0xd4, 
+	0x25, 0xe9, 0x87, 0x60, 0xf1, 0x7e, 0xd3, 0xe0, 0x7e, 0x26, 0x81, 0xee, 
+	0x7b, 0x98, 0x86, 0x45, 0x58, 0xf4, 0xf8, 0x1e, 0xd3, 0xb0, 0x5e, 0xd1, 
+	0xde, 0xe6, 0x27, 0x61, 0x8f, 0x43, 0x79, 0x7c, 0x00, 0x76, 0x31, 0xda, 
+	0xf7, 0xd3, 0xbe, 0x0d, 0xe5, 0xfb, 0x60, 0x1f, 0xa5, 0x7d, 0x0b, 0xed, 
+	0xe1, 0x0c, 0xf1, 0x41, 0xd8, 0xb9, 0x7c, 0x69, 0xc3, 0x1d, 0x31, 0xda, 
+	0xb7, 0xa3, 0xfc, 0x20, 0xec, 0x63, 0xb4, 0x2f, 0xd0, 0x3e, 0x89, 0xf2, 
+	0x21, 0xd8, 0xe7, 0x68, 0xdf, 0x41, 0xfb, 0x0e, 0x94, 0x1f, 0x81, 0x7d, 
+	0x92, 0xf6, 0x6d, 0xb4, 0x87, 0x13, 0xc4, 0x87, 0x61, 0x5f, 0xa0, 0xfd, 
+	0x7a, 0xda, 0x17, 0x51, 0x7e, 0x1c, 0xf6, 0x69, 0xda, 0xb7, 0xd3, 0x3e, 
+	0x83, 0xf2, 0x11, 0xd8, 0xb7, 0xd3, 0xfe, 0x2c, 0xed, 0xf1, 0x7b, 0x14, 
+	0x3f, 0x05, 0xfb, 0x0c, 0xed, 0x3b, 0x68, 0x8f, 0x73, 0x7b, 0x7c, 0x14, 
+	0xf6, 0x45, 0x67, 0x7f, 0x67, 0x8e, 0xf6, 0x88, 0xbf, 0xe2, 0xff, 0x04, 
+	0xfb, 0x1c, 0xed, 0x8b, 0xb4, 0xc7, 0xb9, 0x3d, 0xfe, 0x12, 0xec, 0x3b, 
+	0x69, 0xbf, 0x8c, 0xf6, 0xcb, 0x50, 0xfe, 0x32, 0xec, 0x5b, 0x68, 0xbf, 
+	0xd4, 0xbe, 0xa7, 0x35, 0x6a, 0xbe, 0xfd, 0xbe, 0xa9, 0x06, 0xe7, 0xde, 
+	0x68, 0xfc, 0x2c, 0x70, 0x95, 0x2a, 0x8f, 0x9f, 0x03, 0x3e, 0x0f, 0xfb, 
+	0x5f, 0xa3, 0xbe, 0xcf, 0x2e, 0x40, 0x8d, 0x1a, 0xb0, 0xeb, 0x55, 0xa3, 
+	0x86, 0x51, 0xfe, 0x1b, 0x5d, 0xe3, 0xb9, 0x7c, 0x6c, 0x8d, 0x37, 0x1f, 
+	0xfc, 0x75, 0x5d, 0xc3, 0xf8, 0xa4, 0x46, 0xe2, 0x93, 0xf8, 0x6f, 0x81, 
+	0xd8, 0xd7, 0xe2, 0x17, 0x81, 0x25, 0x95, 0xaa, 0xf5, 0x4d, 0x8d, 0xef, 
+	0xde, 0xa7, 0x9a, 0x4b, 0xf2, 0xee, 0x51, 0x53, 0xa3, 0x5f, 0xb3, 0xe7, 
+	0xbc, 0x1a, 0xbc, 0x8c, 0xf1, 0xda, 0x2b, 0xd0, 0x6e, 0xcc, 0xe6, 0x69, 
+	0x6b, 0x6c, 0xfc, 0x33, 0x9b, 0xfc, 0x4a, 0xf2, 0x9b, 0xc9, 0xdf, 0x43, 
+	0xfe, 0x51, 0xf2, 0x7b, 0xc8, 0x1f, 0xd2, 0x81, 0x75, 0x8b, 0x8c, 0x1f, 
+	0xe0, 0x3d, 0x31, 0xb5, 0xb3, 0x81, 0x18, 0x47, 0x6d, 0x1e, 0xd8, 0xa2, 
+	0xca, 0x6a, 0xdf, 0x62, 0x02, 0xfb, 0xfb, 0x7f, 0xa5, 0x0e, 0x0a, 0x03, 
+	0xee, 0x3b, 0xa1, 0x82, 0xbc, 0x9f, 0x6f, 0xf3, 0x83, 0x5b, 0x36, 0xa3, 
+	0xfe, 0x26, 0x13, 0xdc, 0x22, 0xbc, 0xc1, 0x0f, 0x10, 0x87, 0x98, 0xda, 
+	0x5b, 0xbd, 0xa0, 0x95, 0xdf, 0x09, 0xb5, 0xf2, 0x3b, 0xa1, 0x56, 0x7e, 
+	0x27, 0xd4, 0xca, 0xef, 0x84, 0x5a, 0xf9, 0x9d, 0x50, 0x2b, 0xbf, 0x13, 
+	0x6a, 0xe5, 0x77, 0x42, 0xad, 0xfc, 0x4e, 0xa8, 0x95, 0xdf, 0x09, 0xb5, 
+	0xf2, 0x3b, 0xa1, 0x56, 0x7e, 0x27, 0xd4, 0xca, 0xef, 0x84, 0x5a, 0xf9, 
+	0x9d, 0x50, 0xeb, 0x72, 0x62, 0xc9, 0x7d, 0x2f, 0xd4, 0x3a, 0x8c, 0xfe, 
+	0xdf, 0x31, 0xf1, 0xbd, 0x50, 0x21, 0xf4, 0xbd, 0x50, 0x21, 0xf4, 0xbd, 
+	0x50, 0x21, 0xf4, 0xbd, 0x50, 0x21, 0xf4, 0xbd, 0x50, 0x21, 0xf4, 0xbd, 
+	0x50, 0x21, 0xf4, 0xbd, 0x50, 0x21, 0xf4, 0xbd, 0x50, 0x21, 0xf4, 0xbd, 
+	0x90, 0xb3, 0x8f, 0xe4, 0xb0, 0xcc, 0x5b, 0xf1, 0x22, 0xe4, 0xca, 0x71, 
+	0xbe, 0xae, 0xbd, 0xcd, 0x34, 0x73, 0xdf, 0xcd, 0x73, 0xdf, 0x6d, 0x9e, 
+	0xd5, 0xa9, 0x7a, 0x6a, 0x6f, 0xf7, 0x9b, 0xe7, 0xf4, 0xaa, 0x68, 0xed, 
+	0x49, 0xd3, 0x5c, 0xb0, 0xf7, 0x07, 0x7e, 0x73, 0x01, 0xfb, 0x6c, 0xed, 
+	0x3f, 0xfb, 0x79, 0x3c, 0xb6, 0xa9, 0x7d, 0x45, 0xe7, 0xed, 0x63, 0x36, 
+	0x00, 0x0b, 0x36, 0xae, 0xcc, 0xdb, 0x7d, 0x35, 0x06, 0x74, 0xfb, 0x6a, 
+	0x3e, 0x74, 0x6f, 0x97, 0xe7, 0x7e, 0x9a, 0x0f, 0xed, 0xa7, 0x79, 0xee, 
+	0xa7, 0xf9, 0xd0, 0x7e, 0x9a, 0xe7, 0x7e, 0x9a, 0x0f, 0xed, 0xa7, 0x79, 
+	0xee, 0xa7, 0xf9, 0xd0, 0xbd, 0x5d, 0x9e, 0xfb, 0x64, 0x3e, 0xb4, 0x4f, 
+	0xe6, 0xb9, 0x4f, 0xe6, 0x43, 0xfb, 0x64, 0x9e, 0xfb, 0x64, 0x3e, 0xb4, 
+	0x4f, 0xe6, 0xb9, 0x4f, 0xe6, 0x43, 0xf7, 0x76, 0x79, 0xee, 0x8f, 0xf9, 
+	0xd0, 0xfe, 0x98, 0xe7, 0xfe, 0x98, 0x0f, 0xed, 0x8f, 0x79, 0xee, 0x8f, 
+	0xf9, 0xd0, 0xfe, 0x98, 0xe7, 0xfe, 0xc8, 0xf6, 0x23, 0xf8, 0x75, 0xbf, 
+	0x5e, 0x0b, 0x62, 0xdf, 0x1b, 0xae, 0xbe, 0x25, 0x72, 0xbd, 0x52, 0x2d, 
+	0x4b, 0x1a, 0x7e, 0x10, 0xb9, 0xbe, 0xa4, 0x5a, 0xde, 0x99, 0x19, 0x8c, 
+	0xdc, 0x80, 0xfa, 0xb7, 0xde, 0xf0, 0xe3, 0xc8, 0x0d, 0x25, 0xd5, 0xf8, 
+	0xab, 0x79, 0xcd, 0x65, 0x37, 0x1c, 0xec, 0x7d, 0xd3, 0xc6, 0xda, 0x57, 
+	0xc7, 0xf7, 0xbf, 0x7c, 0x68, 0xff, 0xcb, 0x87, 0xf6, 0xbf, 0x7c, 0xe8, 
+	0x5e, 0x2f, 0x17, 0xba, 0xd7, 0xcb, 0x71, 0xdf, 0xcb, 0xf3, 0x5e, 0x2f, 
+	0xc7, 0x7b, 0xbd, 0x7c, 0xe8, 0x5e, 0x2f, 0xcf, 0x7d, 0x2d, 0xc7, 0x7d, 
+	0x2d, 0xc7, 0x7d, 0x2d, 0xc7, 0x7d, 0x2d, 0xc7, 0x7d, 0x2d, 0xc7, 0x7d, 
+	0x2d, 0xc7, 0x7d, 0x2d, 0x27, 0xfb, 0x5a, 0xed, 0x4f, 0x81, 0xd8, 0xd7, 
+	0xea, 0xca, 0x75, 0x8e, 0xfb, 0x5a, 0x8e, 0xfb, 0x5a, 0x8e, 0xfb, 0x5a, 
+	0x8e, 0xf7, 0x7a, 0xb9, 0xd0, 0xbd, 0x5e, 0x8e, 0xf7, 0x7a, 0xcd, 0xb3, 
+	0xdc, 0xef, 0x7b, 0xf3, 0xac, 0x76, 0x65, 0xea, 0x2a, 0x4c, 0xf3, 0x53, 
+	0xf6, 0x5e, 0xca, 0x34, 0xaf, 0x72, 0xf7, 0x65, 0xcd, 0xf6, 0xbb, 0xb6, 
+	0xb4, 0x69, 0xde, 0x4a, 0xdc, 0x46, 0xdc, 0x4e, 0xec, 0x23, 0xee, 0x20, 
+	0xee, 0x24, 0xee, 0x22, 0xf6, 0x13, 0x77, 0x13, 0xf7, 0x10, 0xf7, 0x12, 
+	0x07, 0x88, 0x2f, 0x12, 0xf7, 0x11, 0xf7, 0x13, 0x4f, 0x94, 0xdc, 0x78, 
+	0x66, 0xb5, 0x71, 0x9c, 0x45, 0x8c, 0xb3, 0x1a, 0xe3, 0xec, 0xe7, 0x38, 
+	0x0b, 0x1c, 0x67, 0x89, 0xe3, 0x24, 0x6e, 0x23, 0x6e, 0x27, 0xf6, 0x11, 
+	0x77, 0x10, 0x77, 0x12, 0x77, 0x11, 0xfb, 0x89, 0xbb, 0x89, 0x7b, 0x88, 
+	0x7b, 0x89, 0x03, 0xc4, 0x17, 0x89, 0xfb, 0x88, 0xfb, 0x89, 0x27, 0xba, 
+	0xdd, 0x78, 0x62, 0x31, 0x8e, 0x57, 0x91, 0xa7, 0xc9, 0xa3, 0xe4, 0x39, 
+	0x72, 0xda, 0xc5, 0x0a, 0xe4, 0x49, 0xf2, 0x76, 0x72, 0xea, 0x62, 0x45, 
+	0xf2, 0x0c, 0x79, 0x27, 0x39, 0xdb, 0x89, 0x8d, 0xcd, 0x8f, 0xdd, 0xbf, 
+	0xb4, 0x56, 0x1d, 0x76, 0xdf, 0xd2, 0xaa, 0xa8, 0xa2, 0x75, 0x71, 0xe0, 
+	0x7a, 0x55, 0x55, 0x77, 0x19, 0xca, 0x07, 0x6d, 0xfc, 0xae, 0xd5, 0x88, 
+	0xf2, 0xeb, 0x66, 0x02, 0xcf, 0xe1, 0xbd, 0xb9, 0x06, 0xe5, 0x6f, 0x58, 
+	0xff, 0xd7, 0xee, 0x66, 0x19, 0x38, 0xc7, 0xb5, 0xc3, 0x3c, 0x28, 0x7e, 
+	0xf1, 0xec, 0xfe, 0xa5, 0x75, 0x3d, 0xec, 0xff, 0x00, 0x07, 0x0f, 0xb7, 
+	0x9f, 0x69, 0x83, 0xfd, 0xac, 0x2e, 0x0b, 0xc4, 0x3e, 0x52, 0x77, 0x2d, 
+	0x10, 0xe7, 0xe9, 0xba, 0x37, 0x1b, 0x1c, 0x7c, 0xed, 0x7e, 0x66, 0x3f, 
+	0xdf, 0x4d, 0x23, 0xd0, 0xc6, 0xfb, 0x5c, 0x5f, 0x77, 0x07, 0xda, 0x93, 
+	0xe7, 0xef, 0x07, 0x26, 0xd9, 0x7e, 0x1f, 0xfb, 0x1b, 0x20, 0x0e, 0xb1, 
+	0x7c, 0x84, 0x68, 0xe3, 0x31, 0xe0, 0x6b, 0xc4, 0x80, 0xfa, 0xe9, 0xac, 
+	0xef, 0xa7, 0x6e, 0x90, 0x38, 0xcc, 0xf2, 0x51, 0xe2, 0x59, 0xea, 0xce, 
+	0x11, 0xff, 0xbf, 0xff, 0xff, 0xcd, 0xfe, 0x13, 0x8c, 0x3f, 0x12, 0xc5, 
+	0x28, 0xde, 0xbf, 0x0f, 0x00, 0xe5, 0xbd, 0x59, 0x0a, 0x6c, 0x51, 0xb5, 
+	0x75, 0xf7, 0x99, 0x44, 0xb1, 0x64, 0xf3, 0x2c, 0x89, 0xa2, 0x3b, 0xdf, 
+	0x27, 0x8a, 0x5b, 0xec, 0xef, 0x6a, 0xa2, 0x38, 0x42, 0x3e, 0xea, 0xf2, 
+	0xa0, 0xc5, 0x73, 0xe4, 0x72, 0x7f, 0xf4, 0x66, 0x3f, 0xb1, 0x68, 0x33, 
+	0xde, 0xc3, 0x07, 0x4d, 0xc2, 0x7e, 0x37, 0x50, 0x0e, 0x3e, 0xa2, 0xca, 
+	0xea, 0x4a, 0xe0, 0x52, 0x1f, 0xf7, 0x13, 0x8b, 0x11, 0xaf, 0xd4, 0x7d, 
+	0xc6, 0x4b, 0x2c, 0x76, 0xf1, 0x4a, 0x62, 0xf1, 0x7c, 0x62, 0x3b, 0x71, 
+	0x01, 0xb1, 0x83, 0x78, 0x37, 0xb1, 0x48, 0x5c, 0x42, 0x5c, 0x4a, 0xbc, 
+	0x8f, 0xd8, 0x49, 0xbc, 0x9f, 0xb8, 0x8c, 0xb8, 0x9c, 0x38, 0xe4, 0xf2, 
+	0x95, 0x8b, 0x11, 0xaf, 0xd4, 0x7d, 0x7e, 0x22, 0x5f, 0x53, 0xbc, 0x34, 
+	0x5e, 0xb1, 0x7c, 0x52, 0xbc, 0xe2, 0xf8, 0x44, 0xbc, 0x62, 0xf9, 0xa4, 
+	0x78, 0xc5, 0xd5, 0x4f, 0xc4, 0x2b, 0x97, 0xd8, 0xa7, 0x43, 0xf6, 0xe9, 
+	0x90, 0x7d, 0x7a, 0xdc, 0x3e, 0x92, 0x81, 0x1b, 0x7f, 0x03, 0xf1, 0x4a, 
+	0xa6, 0xbc, 0x5f, 0x95, 0xd7, 0x7d, 0xc1, 0x34, 0x31, 0x5e, 0xc9, 0x32, 
+	0x5e, 0x69, 0x92, 0xcb, 0xcb, 0xba, 0x1e, 0xbf, 0x09, 0x3f, 0x4f, 0xb1, 
+	0xba, 0x95, 0x7e, 0xd3, 0x23, 0x51, 0xfc, 0x9e, 0x3c, 0xe3, 0x37, 0x3d, 
+	0xd5, 0x86, 0xe7, 0xf9, 0xa6, 0xdf, 0xb4, 0x66, 0x29, 0xf8, 0xb7, 0xfd, 
+	0xa6, 0xb5, 0x32, 0xff, 0xdf, 0xf7, 0x9b, 0x9e, 0x6e, 0x57, 0x3d, 0x75, 
+	0x9b, 0xfd, 0xec, 0xed, 0x3d, 0xaa, 0xbe, 0xbe, 0x4d, 0x67, 0x4b, 0xee, 
+	0x9e, 0x2b, 0xcb, 0xfc, 0x40, 0x96, 0xf9, 0x81, 0xac, 0x8d, 0x63, 0x3e, 
+	0xa8, 0xb3, 0xa1, 0xfc, 0x40, 0xd3, 0xba, 0x8d, 0xf6, 0xbd, 0xc9, 0x32, 
+	0x9e, 0xc9, 0x86, 0xe2, 0x99, 0x2c, 0xe3, 0x99, 0x6c, 0x28, 0x9e, 0xc9, 
+	0x32, 0x9e, 0xc9, 0x86, 0xe2, 0x99, 0x2c, 0xe3, 0x99, 0xec, 0xe4, 0x73, 
+	0x39, 0x26, 0xa4, 0x69, 0xdd, 0xb7, 0xec, 0x84, 0x37, 0xf5, 0x8d, 0x2a, 
+	0x53, 0x7f, 0xb7, 0xdf, 0x84, 0x7d, 0x4b, 0xd7, 0x17, 0xa9, 0x2b, 0xb0, 
+	0xde, 0xb3, 0xf5, 0x95, 0xf5, 0x8b, 0xc7, 0xf3, 0x06, 0x6e, 0x7c, 0xbe, 
+	0x1d, 0x9f, 0xc4, 0x3d, 0xd9, 0x50, 0x3c, 0x94, 0x65, 0x3c, 0x94, 0x0d, 
+	0xc5, 0x43, 0x59, 0xc6, 0x43, 0xd9, 0x50, 0x3c, 0x94, 0x65, 0x3c, 0x94, 
+	0x0d, 0xe5, 0x0d, 0x5c, 0x3f, 0xc6, 0xf5, 0x83, 0xf8, 0x27, 0x1b, 0x8a, 
+	0x8b, 0xb2, 0x8c, 0x8b, 0xb2, 0xa1, 0xb8, 0x28, 0xcb, 0xb8, 0x28, 0x1b, 
+	0x8a, 0x8b, 0xb2, 0x8c, 0x8b, 0xb2, 0xa1, 0xbc, 0x41, 0xd3, 0xba, 0x4d, 
+	0x97, 0xe4, 0x0d, 0x1c, 0xf7, 0x4c, 0x96, 0x79, 0x03, 0x6c, 0x5f, 0x73, 
+	0xde, 0x8d, 0x99, 0x9d, 0x55, 0x52, 0x6f, 0xfb, 0xab, 0xea, 0xfa, 0xc8, 
+	0xb5, 0x38, 0x74, 0x64, 0x53, 0xdf, 0x8b, 0x5c, 0x5b, 0x52, 0x37, 0x76, 
+	0x5d, 0xf3, 0x60, 0xe4, 0x3a, 0xa5, 0xe6, 0x3e, 0x78, 0xc3, 0x3d, 0x91, 
+	0xeb, 0x4a, 0x6a, 0xee, 0x5d, 0x7f, 0xf8, 0x50, 0x64, 0x36, 0x36, 0x9d, 
+	0xd9, 0x0b, 0x56, 0x47, 0x66, 0x97, 0xd4, 0x94, 0xd8, 0xa2, 0xab, 0xca, 
+	0x66, 0x6f, 0x28, 0x55, 0x0d, 0xd6, 0xdf, 0x37, 0x1e, 0x4f, 0x65, 0x43, 
+	0xf1, 0x54, 0x36, 0x14, 0x4f, 0x65, 0x43, 0xf9, 0x84, 0x0c, 0xf3, 0x09, 
+	0xd9, 0x50, 0x3e, 0x21, 0xc3, 0xb8, 0x2a, 0xcb, 0x7c, 0x42, 0x96, 0xf9, 
+	0x84, 0x2c, 0xf3, 0x09, 0x19, 0xc6, 0x59, 0x59, 0xe6, 0x13, 0xb2, 0xcc, 
+	0x27, 0x64, 0x43, 0xf9, 0x84, 0x2c, 0xe3, 0xae, 0x0c, 0xe3, 0xae, 0x0c, 
+	0xe3, 0xae, 0x0c, 0xe3, 0xae, 0x0c, 0xe3, 0xae, 0x0c, 0xe3, 0xae, 0x0c, 
+	0xe3, 0xae, 0x8c, 0xc4, 0x5d, 0xf5, 0x1f, 0x01, 0x22, 0xee, 0xaa, 0xef, 
+	0xd6, 0x19, 0xc6, 0x5d, 0x19, 0xc6, 0x5d, 0x19, 0xc6, 0x5d, 0x19, 0xc6, 
+	0x5d, 0x99, 0x50, 0xdc, 0x95, 0x61, 0xdc, 0xd5, 0xc4, 0x73, 0x7d, 0x13, 
+	0xcf, 0xeb, 0x4d, 0x3c, 0x87, 0x37, 0xf1, 0x7c, 0xdd, 0xf4, 0x94, 0xcb, 
+	0x0b, 0x34, 0xad, 0x12, 0xac, 0xf1, 0x9b, 0x56, 0xf5, 0xa0, 0xbf, 0xcf, 
+	0x83, 0x0f, 0x3b, 0xbe, 0x1a, 0x2f, 0x65, 0xfd, 0x63, 0xa6, 0x69, 0x35, 
+	0xeb, 0x57, 0x4b, 0x3d, 0xfc, 0x78, 0x35, 0xeb, 0xd7, 0x48, 0x3d, 0xfc, 
+	0x77, 0x4d, 0x37, 0x70, 0xa5, 0x69, 0xda, 0xb2, 0x96, 0xed, 0x47, 0x89, 
+	0x49, 0x62, 0x86, 0xd8, 0xc2, 0x7e, 0x87, 0xd9, 0xef, 0x5a, 0xf6, 0x3b, 
+	0x08, 0xfd, 0x2a, 0xb4, 0x9b, 0x64, 0x3f, 0xed, 0xe0, 0x6b, 0xc0, 0x59, 
+	0xbf, 0x5a, 0xea, 0xd7, 0x9a, 0xa6, 0x35, 0xac, 0x5f, 0x23, 0xf5, 0x5f, 
+	0x02, 0xca, 0x78, 0xd6, 0xa1, 0xdf, 0xf5, 0x6c, 0xbf, 0x8d, 0xf5, 0x6b, 
+	0x55, 0xac, 0xfe, 0x6f, 0x4d, 0xd3, 0x5a, 0x97, 0xff, 0x68, 0x7a, 0x9a, 
+	0xcf, 0xdf, 0x57, 0xa2, 0x5d, 0x89, 0x76, 0xc3, 0xb0, 0xfb, 0x36, 0xec, 
+	0x86, 0x69, 0xc7, 0xf1, 0xf6, 0x75, 0xd3, 0x6e, 0xb3, 0xb3, 0xfb, 0x62, 
+	0x12, 0x76, 0x3f, 0x82, 0xdd, 0x28, 0xed, 0x38, 0x8f, 0x7d, 0x3d, 0xb4, 
+	0x3b, 0x47, 0xbb, 0x0e, 0xd8, 0xed, 0x83, 0xdd, 0x59, 0xda, 0xf1, 0xb9, 
+	0xfb, 0x38, 0x2f, 0x77, 0x64, 0x68, 0x27, 0xe3, 0x3b, 0x05, 0xbb, 0x73, 
+	0xb4, 0xe3, 0x7a, 0xf4, 0xf1, 0x39, 0xee, 0x28, 0xd2, 0x4e, 0xc6, 0xf7, 
+	0x33, 0xd8, 0x5d, 0xa0, 0x1d, 0xe7, 0xcf, 0xfe, 0x5d, 0x83, 0xd8, 0x71, 
+	0x7e, 0xd6, 0xca, 0xf8, 0xfe, 0x1d, 0xf5, 0x5c, 0xef, 0xa7, 0x0b, 0xb4, 
+	0xdb, 0x44, 0xbb, 0x41, 0xda, 0x61, 0x7c, 0x53, 0x6b, 0x50, 0xcf, 0xf5, 
+	0x79, 0xba, 0x8d, 0x76, 0xf6, 0xef, 0xa7, 0x8c, 0xb2, 0xf9, 0x9e, 0x00, 
+	0xe8, 0xf2, 0x25, 0x6a, 0xfd, 0x6b, 0x2a, 0x3a, 0xf5, 0x0a, 0x5f, 0x6d, 
+	0x58, 0xa7, 0xcc, 0xd4, 0xab, 0xb5, 0x7a, 0x16, 0xfe, 0x10, 0xe0, 0x25, 
+	0xfe, 0xba, 0xfb, 0x1d, 0x55, 0x5f, 0x77, 0xfb, 0xb2, 0xfa, 0xfa, 0x74, 
+	0x7b, 0xcf, 0xa8, 0xd6, 0x77, 0xaa, 0xc8, 0xd4, 0x26, 0xe8, 0xe5, 0xde, 
+	0x32, 0x82, 0xb0, 0x70, 0xed, 0x94, 0x51, 0x39, 0xac, 0xac, 0x5f, 0x67, 
+	0xf7, 0x4d, 0xb5, 0x7e, 0xb3, 0xaa, 0x9e, 0x3a, 0xdb, 0xa8, 0x67, 0xec, 
+	0xbd, 0x3b, 0x74, 0x32, 0xcf, 0x6f, 0xa0, 0x3d, 0xfb, 0x1d, 0x08, 0xb8, 
+	0xfd, 0x80, 0x0e, 0xfd, 0x05, 0xaa, 0x6c, 0xea, 0x5c, 0xa3, 0x36, 0xcc, 
+	0x74, 0xed, 0x6c, 0x68, 0x71, 0xed, 0x6c, 0x98, 0xeb, 0xda, 0xd9, 0xd0, 
+	0x81, 0x76, 0x5a, 0xd1, 0xce, 0x5c, 0xb6, 0xb3, 0x89, 0xed, 0x3c, 0xcf, 
+	0x76, 0x2e, 0xb8, 0x71, 0xad, 0xcf, 0x11, 0xe7, 0x10, 0x5b, 0x88, 0x73, 
+	0x89, 0x05, 0xe2, 0x3c, 0x62, 0x1b, 0xd1, 0xfa, 0xd7, 0x7f, 0x00, 0x6f, 
+	0xe2, 0x8a, 0xff, 0x90, 0x37, 0x00, 0x00, 0x00, };
 
-static const u16 init_ops_offsets_e2[] = {
-	0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0017, 0x0017, 0x001f, 0x001f, 
-	0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 
-	0x0034, 0x0000, 0x0000, 0x0000, 0x0000, 0x0034, 0x0035, 0x0035, 0x0036, 
-	0x0036, 0x0037, 0x0037, 0x0038, 0x0038, 0x0039, 0x0039, 0x003a, 0x003a, 
-	0x003b, 0x003b, 0x003c, 0x003c, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0043, 0x004c, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x004c, 0x004d, 0x004d, 0x004e, 0x004e, 
-	0x004f, 0x004f, 0x0050, 0x0050, 0x0051, 0x0051, 0x0052, 0x0052, 0x0053, 
-	0x0053, 0x0054, 0x0054, 0x007e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007e, 0x01e0, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x01e0, 0x01e5, 0x01e5, 0x01ea, 0x01ea, 0x01ef, 
-	0x01ef, 0x01f4, 0x01f4, 0x01f9, 0x01f9, 0x01fe, 0x01fe, 0x0203, 0x0203, 
-	0x0208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0208, 0x020c, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x020c, 0x021c, 0x0000, 0x0000, 0x0000, 0x0000, 0x021c, 0x021e, 0x021e, 
-	0x0220, 0x0220, 0x0222, 0x0222, 0x0224, 0x0224, 0x0226, 0x0226, 0x0228, 
-	0x0228, 0x022a, 0x022a, 0x022c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x022c, 
-	0x022f, 0x0000, 0x0000, 0x0000, 0x0000, 0x022f, 0x0232, 0x0232, 0x0235, 
-	0x0235, 0x0238, 0x0238, 0x023b, 0x023b, 0x023e, 0x023e, 0x0241, 0x0241, 
-	0x0244, 0x0244, 0x0247, 0x0247, 0x024b, 0x024b, 0x024f, 0x024f, 0x0253, 
-	0x0253, 0x0254, 0x0254, 0x0255, 0x0255, 0x0256, 0x0256, 0x0257, 0x0257, 
-	0x0258, 0x0258, 0x0259, 0x0259, 0x025a, 0x025a, 0x025b, 0x025b, 0x0260, 
-	0x0260, 0x0286, 0x0286, 0x02ab, 0x02ab, 0x02ac, 0x02ac, 0x02ad, 0x02ad, 
-	0x02ae, 0x02ae, 0x02af, 0x02af, 0x02b0, 0x02b0, 0x02b1, 0x02b1, 0x02b2, 
-	0x02b2, 0x02b3, 0x02b3, 0x02ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02ca, 0x02d7, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x02d7, 0x02d8, 0x02d8, 0x02d9, 0x02d9, 0x02da, 
-	0x02da, 0x02db, 0x02db, 0x02dc, 0x02dc, 0x02dd, 0x02dd, 0x02de, 0x02de, 
-	0x02df, 0x02df, 0x02f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f0, 0x02fe, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x02fe, 0x02ff, 0x02ff, 0x0300, 0x0300, 0x0301, 0x0301, 
-	0x0302, 0x0302, 0x0303, 0x0303, 0x0304, 0x0304, 0x0305, 0x0305, 0x0306, 
-	0x0306, 0x030b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x030b, 0x03a9, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03a9, 
-	0x03ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x03ab, 0x03bf, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x03bf, 0x03c0, 0x03c0, 0x03c1, 0x03c1, 0x03c2, 0x03c2, 0x03c3, 0x03c3, 
-	0x03c4, 0x03c4, 0x03c5, 0x03c5, 0x03c6, 0x03c6, 0x03c7, 0x03c7, 0x03e7, 
-	0x03e7, 0x03ea, 0x03ea, 0x03ed, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x03ed, 0x0415, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0415, 0x0480, 0x0480, 
-	0x0487, 0x0487, 0x048e, 0x048e, 0x0494, 0x0494, 0x049a, 0x049a, 0x04a0, 
-	0x04a0, 0x04a6, 0x04a6, 0x04ac, 0x04ac, 0x04b2, 0x04b2, 0x04b8, 0x04b8, 
-	0x04be, 0x04be, 0x04d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x04d0, 0x04d1, 
-	0x04d1, 0x04d2, 0x04d2, 0x04d3, 0x04d3, 0x04d4, 0x04d4, 0x04d5, 0x04d5, 
-	0x04d6, 0x04d6, 0x04d7, 0x04d7, 0x04d8, 0x04d8, 0x04d9, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x04d9, 0x0504, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0504, 0x055b, 0x055b, 0x0570, 0x0570, 
-	0x0585, 0x0585, 0x0587, 0x0587, 0x0589, 0x0589, 0x058b, 0x058b, 0x058d, 
-	0x058d, 0x058f, 0x058f, 0x0591, 0x0591, 0x0593, 0x0593, 0x0595, 0x0595, 
-	0x05a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x05a8, 0x05b0, 0x05b0, 0x05b8, 
-	0x05b8, 0x05c0, 0x05c0, 0x05c8, 0x05c8, 0x05d0, 0x05d0, 0x05d8, 0x05d8, 
-	0x05e0, 0x05e0, 0x05e8, 0x05e8, 0x05e9, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05e9, 0x061a, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-	0x0000, 0x0000, 0x061a, 0x068a, 0x068a, 0x0699, 0x0699, 0x06a8, 0x06a8, 
-	0x06ad, 0x06ad, 0x06b2, 0x06b2, 0x06b7, 0x06b7, 0x06bc, 0x06bc, 0x06c1, 
-	0x06c1, 0x06c6, 0x06c6, 0x06cb, 0x06cb, 0x06d0, 0x06d0, 0x06d8, 0x06d8, 
-	0x06e1, 0x06e1, 0x06ea, 0x06ea, 0x06eb, 0x06eb, 0x06ec, 0x06ec, 0x06ed, 
-	0x06ed, 0x06ee, 0x06ee, 0x06ef, 0x06ef, 0x06f0, 0x06f0, 0x06f1, 0x06f1, 
-	0x06f2, 
-};
+static const u8 init_ops_offsets_zipped_e2[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x95, 0xd1, 
+	0xbd, 0x4f, 0x53, 0x51, 0x18, 0xc7, 0xf1, 0x73, 0xcf, 0xbd, 0xb7, 0x21, 
+	0x81, 0xb5, 0x31, 0x69, 0x1a, 0x35, 0x0d, 0x21, 0xc4, 0x34, 0x21, 0x31, 
+	0x20, 0xd5, 0x1a, 0x13, 0x83, 0x89, 0x03, 0x85, 0x8a, 0xc5, 0x57, 0x16, 
+	0xff, 0x04, 0xff, 0x82, 0x86, 0x45, 0x1a, 0x34, 0x6a, 0x8c, 0x3a, 0xe8, 
+	0xe4, 0x64, 0x4a, 0x4a, 0x79, 0x29, 0x03, 0x1d, 0x08, 0x05, 0xc1, 0x6a, 
+	0xea, 0x52, 0x5f, 0x7b, 0xab, 0x02, 0x75, 0x30, 0xd2, 0x6a, 0xa5, 0x1a, 
+	0x17, 0x97, 0x5b, 0xbe, 0x5d, 0xce, 0xda, 0xc3, 0xf3, 0x59, 0x7e, 0xc3, 
+	0xef, 0x3c, 0x79, 0x6e, 0xae, 0x10, 0xc2, 0x10, 0xba, 0x63, 0x88, 0x43, 
+	0x38, 0x82, 0x40, 0xdb, 0x6e, 0x40, 0xf4, 0xab, 0xdc, 0x2f, 0x06, 0x70, 
+	0x02, 0x83, 0x08, 0xe1, 0x24, 0x4e, 0x21, 0x8c, 0xd3, 0x18, 0xd2, 0xbe, 
+	0x61, 0x48, 0x44, 0x54, 0x8e, 0x88, 0x11, 0x8c, 0x22, 0x8a, 0x0b, 0x18, 
+	0xc3, 0x45, 0xc4, 0x30, 0x8e, 0xb8, 0xf6, 0xde, 0xb8, 0x51, 0x51, 0x9f, 
+	0x59, 0x31, 0xbe, 0xa3, 0x86, 0x3d, 0xfc, 0xc3, 0x7f, 0xb8, 0x86, 0x2b, 
+	0x4d, 0x74, 0x88, 0x03, 0x8c, 0xec, 0x90, 0x5d, 0xda, 0xdd, 0x2e, 0xe9, 
+	0x57, 0xd9, 0x2f, 0x0f, 0xe3, 0x28, 0x02, 0xe8, 0x46, 0x0f, 0x7a, 0x71, 
+	0x0c, 0xc1, 0x03, 0xdd, 0x10, 0x94, 0x7d, 0x2a, 0xf7, 0xc9, 0xe3, 0x18, 
+	0x40, 0x08, 0x61, 0x9c, 0xc1, 0x59, 0x9c, 0xc3, 0x79, 0x0c, 0x23, 0x8a, 
+	0x18, 0xc6, 0x71, 0x09, 0x97, 0x71, 0x05, 0x57, 0x71, 0x0d, 0xd7, 0x31, 
+	0x81, 0x1b, 0x98, 0x42, 0x0a, 0xb3, 0x48, 0x63, 0x0e, 0xf3, 0x58, 0xc0, 
+	0x22, 0x32, 0x58, 0x42, 0x41, 0xfb, 0xde, 0x82, 0x2c, 0xa9, 0x5c, 0x92, 
+	0x0e, 0xca, 0xf8, 0x8c, 0x2f, 0xf8, 0x8a, 0x2d, 0x6c, 0x63, 0x07, 0x0d, 
+	0xed, 0xbd, 0x0d, 0xe9, 0xaa, 0xec, 0xca, 0xa6, 0x6c, 0x9a, 0x02, 0x06, 
+	0x5a, 0x3f, 0xb6, 0x35, 0x16, 0x6c, 0x78, 0xd0, 0xa9, 0xbb, 0xd7, 0xec, 
+	0x34, 0x67, 0xb4, 0xbb, 0x33, 0x66, 0x4a, 0xbb, 0x9b, 0x32, 0x73, 0x2a, 
+	0xe7, 0xcc, 0x35, 0xac, 0xe3, 0x05, 0x36, 0xb0, 0x89, 0x97, 0xc8, 0xe3, 
+	0x15, 0x7e, 0xa0, 0x86, 0x7a, 0xdb, 0xbd, 0x75, 0xcb, 0xab, 0x7b, 0x83, 
+	0xe5, 0xb5, 0x26, 0x91, 0xc0, 0x3d, 0x3c, 0xc2, 0x53, 0x3c, 0xc3, 0x73, 
+	0xcc, 0x22, 0x83, 0x2c, 0x56, 0x51, 0x54, 0xef, 0x8a, 0xd6, 0x5b, 0xbc, 
+	0xc3, 0x7b, 0x7c, 0xc0, 0x47, 0x7c, 0x42, 0x09, 0x0e, 0xca, 0xda, 0x37, 
+	0x94, 0x6d, 0x4b, 0xb7, 0x6b, 0x5b, 0xf6, 0x04, 0x6e, 0xe2, 0x16, 0x12, 
+	0x98, 0xc6, 0x1d, 0xdc, 0xc5, 0x7d, 0x3c, 0xc0, 0x43, 0x3c, 0x46, 0x52, 
+	0xbd, 0x4b, 0xda, 0x0b, 0xc8, 0x62, 0x0d, 0xaf, 0x51, 0x84, 0x83, 0x0a, 
+	0x76, 0x51, 0xd5, 0xbe, 0xa1, 0xea, 0xf1, 0xe9, 0x76, 0x3d, 0x3e, 0xcf, 
+	0x6d, 0x3c, 0x41, 0x12, 0x69, 0x64, 0xb0, 0x8c, 0x15, 0xac, 0x23, 0x8f, 
+	0x37, 0x28, 0xc2, 0xc1, 0x37, 0xd4, 0xf0, 0x13, 0xbf, 0x50, 0xc7, 0x6f, 
+	0xec, 0xa1, 0x81, 0x3f, 0xf8, 0xbb, 0x0f, 0xb3, 0xf5, 0xef, 0xa6, 0xd8, 
+	0x05, 0x00, 0x00, 0x00, };
 
-static const u32 init_data_e2[] = {
-	0x00002000, 0x00004000, 0x00006000, 0x00008000, 0x0000a000, 0x0000c000, 
-	0x0000e000, 0x00010000, 0x00012000, 0x00014000, 0x00016000, 0x00018000, 
-	0x0001a000, 0x0001c000, 0x0001e000, 0x00020000, 0x00022000, 0x00024000, 
-	0x00026000, 0x00028000, 0x0002a000, 0x0002c000, 0x0002e000, 0x00030000, 
-	0x00032000, 0x00034000, 0x00036000, 0x00038000, 0x0003a000, 0x0003c000, 
-	0x0003e000, 0x00040000, 0x00042000, 0x00044000, 0x00046000, 0x00048000, 
-	0x0004a000, 0x0004c000, 0x0004e000, 0x00050000, 0x00052000, 0x00054000, 
-	0x00056000, 0x00058000, 0x0005a000, 0x0005c000, 0x0005e000, 0x00060000, 
-	0x00062000, 0x00064000, 0x00066000, 0x00068000, 0x0006a000, 0x0006c000, 
-	0x0006e000, 0x00070000, 0x00072000, 0x00074000, 0x00076000, 0x00078000, 
-	0x0007a000, 0x0007c000, 0x0007e000, 0x00080000, 0x00082000, 0x00084000, 
-	0x00086000, 0x00088000, 0x0008a000, 0x0008c000, 0x0008e000, 0x00090000, 
-	0x00092000, 0x00094000, 0x00096000, 0x00098000, 0x0009a000, 0x0009c000, 
-	0x0009e000, 0x000a0000, 0x000a2000, 0x000a4000, 0x000a6000, 0x000a8000, 
-	0x000aa000, 0x000ac000, 0x000ae000, 0x000b0000, 0x000b2000, 0x000b4000, 
-	0x000b6000, 0x000b8000, 0x000ba000, 0x000bc000, 0x000be000, 0x000c0000, 
-	0x000c2000, 0x000c4000, 0x000c6000, 0x000c8000, 0x000ca000, 0x000cc000, 
-	0x000ce000, 0x000d0000, 0x000d2000, 0x000d4000, 0x000d6000, 0x000d8000, 
-	0x000da000, 0x000dc000, 0x000de000, 0x000e0000, 0x000e2000, 0x000e4000, 
-	0x000e6000, 0x000e8000, 0x000ea000, 0x000ec000, 0x000ee000, 0x000f0000, 
-	0x000f2000, 0x000f4000, 0x000f6000, 0x000f8000, 0x000fa000, 0x000fc000, 
-	0x000fe000, 0x00100000, 0x00102000, 0x00104000, 0x00106000, 0x00108000, 
-	0x0010a000, 0x0010c000, 0x0010e000, 0x00110000, 0x00112000, 0x00114000, 
-	0x00116000, 0x00118000, 0x0011a000, 0x0011c000, 0x0011e000, 0x00120000, 
-	0x00122000, 0x00124000, 0x00126000, 0x00128000, 0x0012a000, 0x0012c000, 
-	0x0012e000, 0x00130000, 0x00132000, 0x00134000, 0x00136000, 0x00138000, 
-	0x0013a000, 0x0013c000, 0x0013e000, 0x00140000, 0x00142000, 0x00144000, 
-	0x00146000, 0x00148000, 0x0014a000, 0x0014c000, 0x0014e000, 0x00150000, 
-	0x00152000, 0x00154000, 0x00156000, 0x00158000, 0x0015a000, 0x0015c000, 
-	0x0015e000, 0x00160000, 0x00162000, 0x00164000, 0x00166000, 0x00168000, 
-	0x0016a000, 0x0016c000, 0x0016e000, 0x00170000, 0x00172000, 0x00174000, 
-	0x00176000, 0x00178000, 0x0017a000, 0x0017c000, 0x0017e000, 0x00180000, 
-	0x00182000, 0x00184000, 0x00186000, 0x00188000, 0x0018a000, 0x0018c000, 
-	0x0018e000, 0x00190000, 0x00192000, 0x00194000, 0x00196000, 0x00198000, 
-	0x0019a000, 0x0019c000, 0x0019e000, 0x001a0000, 0x001a2000, 0x001a4000, 
-	0x001a6000, 0x001a8000, 0x001aa000, 0x001ac000, 0x001ae000, 0x001b0000, 
-	0x001b2000, 0x001b4000, 0x001b6000, 0x001b8000, 0x001ba000, 0x001bc000, 
-	0x001be000, 0x001c0000, 0x001c2000, 0x001c4000, 0x001c6000, 0x001c8000, 
-	0x001ca000, 0x001cc000, 0x001ce000, 0x001d0000, 0x001d2000, 0x001d4000, 
-	0x001d6000, 0x001d8000, 0x001da000, 0x001dc000, 0x001de000, 0x001e0000, 
-	0x001e2000, 0x001e4000, 0x001e6000, 0x001e8000, 0x001ea000, 0x001ec000, 
-	0x001ee000, 0x001f0000, 0x001f2000, 0x001f4000, 0x001f6000, 0x001f8000, 
-	0x001fa000, 0x001fc000, 0x001fe000, 0x00200000, 0x00202000, 0x00204000, 
-	0x00206000, 0x00208000, 0x0020a000, 0x0020c000, 0x0020e000, 0x00210000, 
-	0x00212000, 0x00214000, 0x00216000, 0x00218000, 0x0021a000, 0x0021c000, 
-	0x0021e000, 0x00220000, 0x00222000, 0x00224000, 0x00226000, 0x00228000, 
-	0x0022a000, 0x0022c000, 0x0022e000, 0x00230000, 0x00232000, 0x00234000, 
-	0x00236000, 0x00238000, 0x0023a000, 0x0023c000, 0x0023e000, 0x00240000, 
-	0x00242000, 0x00244000, 0x00246000, 0x00248000, 0x0024a000, 0x0024c000, 
-	0x0024e000, 0x00250000, 0x00252000, 0x00254000, 0x00256000, 0x00258000, 
-	0x0025a000, 0x0025c000, 0x0025e000, 0x00260000, 0x00262000, 0x00264000, 
-	0x00266000, 0x00268000, 0x0026a000, 0x0026c000, 0x0026e000, 0x00270000, 
-	0x00272000, 0x00274000, 0x00276000, 0x00278000, 0x0027a000, 0x0027c000, 
-	0x0027e000, 0x00280000, 0x00282000, 0x00284000, 0x00286000, 0x00288000, 
-	0x0028a000, 0x0028c000, 0x0028e000, 0x00290000, 0x00292000, 0x00294000, 
-	0x00296000, 0x00298000, 0x0029a000, 0x0029c000, 0x0029e000, 0x002a0000, 
-	0x002a2000, 0x002a4000, 0x002a6000, 0x002a8000, 0x002aa000, 0x002ac000, 
-	0x002ae000, 0x002b0000, 0x002b2000, 0x002b4000, 0x002b6000, 0x002b8000, 
-	0x002ba000, 0x002bc000, 0x002be000, 0x002c0000, 0x002c2000, 0x002c4000, 
-	0x002c6000, 0x002c8000, 0x002ca000, 0x002cc000, 0x002ce000, 0x002d0000, 
-	0x002d2000, 0x002d4000, 0x002d6000, 0x002d8000, 0x002da000, 0x002dc000, 
-	0x002de000, 0x002e0000, 0x002e2000, 0x002e4000, 0x002e6000, 0x002e8000, 
-	0x002ea000, 0x002ec000, 0x002ee000, 0x002f0000, 0x002f2000, 0x002f4000, 
-	0x002f6000, 0x002f8000, 0x002fa000, 0x002fc000, 0x002fe000, 0x00300000, 
-	0x00302000, 0x00304000, 0x00306000, 0x00308000, 0x0030a000, 0x0030c000, 
-	0x0030e000, 0x00310000, 0x00312000, 0x00314000, 0x00316000, 0x00318000, 
-	0x0031a000, 0x0031c000, 0x0031e000, 0x00320000, 0x00322000, 0x00324000, 
-	0x00326000, 0x00328000, 0x0032a000, 0x0032c000, 0x0032e000, 0x00330000, 
-	0x00332000, 0x00334000, 0x00336000, 0x00338000, 0x0033a000, 0x0033c000, 
-	0x0033e000, 0x00340000, 0x00342000, 0x00344000, 0x00346000, 0x00348000, 
-	0x0034a000, 0x0034c000, 0x0034e000, 0x00350000, 0x00352000, 0x00354000, 
-	0x00356000, 0x00358000, 0x0035a000, 0x0035c000, 0x0035e000, 0x00360000, 
-	0x00362000, 0x00364000, 0x00366000, 0x00368000, 0x0036a000, 0x0036c000, 
-	0x0036e000, 0x00370000, 0x00372000, 0x00374000, 0x00376000, 0x00378000, 
-	0x0037a000, 0x0037c000, 0x0037e000, 0x00380000, 0x00382000, 0x00384000, 
-	0x00386000, 0x00388000, 0x0038a000, 0x0038c000, 0x0038e000, 0x00390000, 
-	0x00392000, 0x00394000, 0x00396000, 0x00398000, 0x0039a000, 0x0039c000, 
-	0x0039e000, 0x003a0000, 0x003a2000, 0x003a4000, 0x003a6000, 0x003a8000, 
-	0x003aa000, 0x003ac000, 0x003ae000, 0x003b0000, 0x003b2000, 0x003b4000, 
-	0x003b6000, 0x003b8000, 0x003ba000, 0x003bc000, 0x003be000, 0x003c0000, 
-	0x003c2000, 0x003c4000, 0x003c6000, 0x003c8000, 0x003ca000, 0x003cc000, 
-	0x003ce000, 0x003d0000, 0x003d2000, 0x003d4000, 0x003d6000, 0x003d8000, 
-	0x003da000, 0x003dc000, 0x003de000, 0x003e0000, 0x003e2000, 0x003e4000, 
-	0x003e6000, 0x003e8000, 0x003ea000, 0x003ec000, 0x003ee000, 0x003f0000, 
-	0x003f2000, 0x003f4000, 0x003f6000, 0x003f8000, 0x003fa000, 0x003fc000, 
-	0x003fe000, 0x00400000, 0x00402000, 0x00404000, 0x00406000, 0x00408000, 
-	0x0040a000, 0x0040c000, 0x0040e000, 0x00410000, 0x00412000, 0x00414000, 
-	0x00416000, 0x00418000, 0x0041a000, 0x0041c000, 0x0041e000, 0x00420000, 
-	0x00422000, 0x00424000, 0x00426000, 0x00428000, 0x0042a000, 0x0042c000, 
-	0x0042e000, 0x00430000, 0x00432000, 0x00434000, 0x00436000, 0x00438000, 
-	0x0043a000, 0x0043c000, 0x0043e000, 0x00440000, 0x00442000, 0x00444000, 
-	0x00446000, 0x00448000, 0x0044a000, 0x0044c000, 0x0044e000, 0x00450000, 
-	0x00452000, 0x00454000, 0x00456000, 0x00458000, 0x0045a000, 0x0045c000, 
-	0x0045e000, 0x00460000, 0x00462000, 0x00464000, 0x00466000, 0x00468000, 
-	0x0046a000, 0x0046c000, 0x0046e000, 0x00470000, 0x00472000, 0x00474000, 
-	0x00476000, 0x00478000, 0x0047a000, 0x0047c000, 0x0047e000, 0x00480000, 
-	0x00482000, 0x00484000, 0x00486000, 0x00488000, 0x0048a000, 0x0048c000, 
-	0x0048e000, 0x00490000, 0x00492000, 0x00494000, 0x00496000, 0x00498000, 
-	0x0049a000, 0x0049c000, 0x0049e000, 0x004a0000, 0x004a2000, 0x004a4000, 
-	0x004a6000, 0x004a8000, 0x004aa000, 0x004ac000, 0x004ae000, 0x004b0000, 
-	0x004b2000, 0x004b4000, 0x004b6000, 0x004b8000, 0x004ba000, 0x004bc000, 
-	0x004be000, 0x004c0000, 0x004c2000, 0x004c4000, 0x004c6000, 0x004c8000, 
-	0x004ca000, 0x004cc000, 0x004ce000, 0x004d0000, 0x004d2000, 0x004d4000, 
-	0x004d6000, 0x004d8000, 0x004da000, 0x004dc000, 0x004de000, 0x004e0000, 
-	0x004e2000, 0x004e4000, 0x004e6000, 0x004e8000, 0x004ea000, 0x004ec000, 
-	0x004ee000, 0x004f0000, 0x004f2000, 0x004f4000, 0x004f6000, 0x004f8000, 
-	0x004fa000, 0x004fc000, 0x004fe000, 0x00500000, 0x00502000, 0x00504000, 
-	0x00506000, 0x00508000, 0x0050a000, 0x0050c000, 0x0050e000, 0x00510000, 
-	0x00512000, 0x00514000, 0x00516000, 0x00518000, 0x0051a000, 0x0051c000, 
-	0x0051e000, 0x00520000, 0x00522000, 0x00524000, 0x00526000, 0x00528000, 
-	0x0052a000, 0x0052c000, 0x0052e000, 0x00530000, 0x00532000, 0x00534000, 
-	0x00536000, 0x00538000, 0x0053a000, 0x0053c000, 0x0053e000, 0x00540000, 
-	0x00542000, 0x00544000, 0x00546000, 0x00548000, 0x0054a000, 0x0054c000, 
-	0x0054e000, 0x00550000, 0x00552000, 0x00554000, 0x00556000, 0x00558000, 
-	0x0055a000, 0x0055c000, 0x0055e000, 0x00560000, 0x00562000, 0x00564000, 
-	0x00566000, 0x00568000, 0x0056a000, 0x0056c000, 0x0056e000, 0x00570000, 
-	0x00572000, 0x00574000, 0x00576000, 0x00578000, 0x0057a000, 0x0057c000, 
-	0x0057e000, 0x00580000, 0x00582000, 0x00584000, 0x00586000, 0x00588000, 
-	0x0058a000, 0x0058c000, 0x0058e000, 0x00590000, 0x00592000, 0x00594000, 
-	0x00596000, 0x00598000, 0x0059a000, 0x0059c000, 0x0059e000, 0x005a0000, 
-	0x005a2000, 0x005a4000, 0x005a6000, 0x005a8000, 0x005aa000, 0x005ac000, 
-	0x005ae000, 0x005b0000, 0x005b2000, 0x005b4000, 0x005b6000, 0x005b8000, 
-	0x005ba000, 0x005bc000, 0x005be000, 0x005c0000, 0x005c2000, 0x005c4000, 
-	0x005c6000, 0x005c8000, 0x005ca000, 0x005cc000, 0x005ce000, 0x005d0000, 
-	0x005d2000, 0x005d4000, 0x005d6000, 0x005d8000, 0x005da000, 0x005dc000, 
-	0x005de000, 0x005e0000, 0x005e2000, 0x005e4000, 0x005e6000, 0x005e8000, 
-	0x005ea000, 0x005ec000, 0x005ee000, 0x005f0000, 0x005f2000, 0x005f4000, 
-	0x005f6000, 0x005f8000, 0x005fa000, 0x005fc000, 0x005fe000, 0x00600000, 
-	0x00602000, 0x00604000, 0x00606000, 0x00608000, 0x0060a000, 0x0060c000, 
-	0x0060e000, 0x00610000, 0x00612000, 0x00614000, 0x00616000, 0x00618000, 
-	0x0061a000, 0x0061c000, 0x0061e000, 0x00620000, 0x00622000, 0x00624000, 
-	0x00626000, 0x00628000, 0x0062a000, 0x0062c000, 0x0062e000, 0x00630000, 
-	0x00632000, 0x00634000, 0x00636000, 0x00638000, 0x0063a000, 0x0063c000, 
-	0x0063e000, 0x00640000, 0x00642000, 0x00644000, 0x00646000, 0x00648000, 
-	0x0064a000, 0x0064c000, 0x0064e000, 0x00650000, 0x00652000, 0x00654000, 
-	0x00656000, 0x00658000, 0x0065a000, 0x0065c000, 0x0065e000, 0x00660000, 
-	0x00662000, 0x00664000, 0x00666000, 0x00668000, 0x0066a000, 0x0066c000, 
-	0x0066e000, 0x00670000, 0x00672000, 0x00674000, 0x00676000, 0x00678000, 
-	0x0067a000, 0x0067c000, 0x0067e000, 0x00680000, 0x00682000, 0x00684000, 
-	0x00686000, 0x00688000, 0x0068a000, 0x0068c000, 0x0068e000, 0x00690000, 
-	0x00692000, 0x00694000, 0x00696000, 0x00698000, 0x0069a000, 0x0069c000, 
-	0x0069e000, 0x006a0000, 0x006a2000, 0x006a4000, 0x006a6000, 0x006a8000, 
-	0x006aa000, 0x006ac000, 0x006ae000, 0x006b0000, 0x006b2000, 0x006b4000, 
-	0x006b6000, 0x006b8000, 0x006ba000, 0x006bc000, 0x006be000, 0x006c0000, 
-	0x006c2000, 0x006c4000, 0x006c6000, 0x006c8000, 0x006ca000, 0x006cc000, 
-	0x006ce000, 0x006d0000, 0x006d2000, 0x006d4000, 0x006d6000, 0x006d8000, 
-	0x006da000, 0x006dc000, 0x006de000, 0x006e0000, 0x006e2000, 0x006e4000, 
-	0x006e6000, 0x006e8000, 0x006ea000, 0x006ec000, 0x006ee000, 0x006f0000, 
-	0x006f2000, 0x006f4000, 0x006f6000, 0x006f8000, 0x006fa000, 0x006fc000, 
-	0x006fe000, 0x00700000, 0x00702000, 0x00704000, 0x00706000, 0x00708000, 
-	0x0070a000, 0x0070c000, 0x0070e000, 0x00710000, 0x00712000, 0x00714000, 
-	0x00716000, 0x00718000, 0x0071a000, 0x0071c000, 0x0071e000, 0x00720000, 
-	0x00722000, 0x00724000, 0x00726000, 0x00728000, 0x0072a000, 0x0072c000, 
-	0x0072e000, 0x00730000, 0x00732000, 0x00734000, 0x00736000, 0x00738000, 
-	0x0073a000, 0x0073c000, 0x0073e000, 0x00740000, 0x00742000, 0x00744000, 
-	0x00746000, 0x00748000, 0x0074a000, 0x0074c000, 0x0074e000, 0x00750000, 
-	0x00752000, 0x00754000, 0x00756000, 0x00758000, 0x0075a000, 0x0075c000, 
-	0x0075e000, 0x00760000, 0x00762000, 0x00764000, 0x00766000, 0x00768000, 
-	0x0076a000, 0x0076c000, 0x0076e000, 0x00770000, 0x00772000, 0x00774000, 
-	0x00776000, 0x00778000, 0x0077a000, 0x0077c000, 0x0077e000, 0x00780000, 
-	0x00782000, 0x00784000, 0x00786000, 0x00788000, 0x0078a000, 0x0078c000, 
-	0x0078e000, 0x00790000, 0x00792000, 0x00794000, 0x00796000, 0x00798000, 
-	0x0079a000, 0x0079c000, 0x0079e000, 0x007a0000, 0x007a2000, 0x007a4000, 
-	0x007a6000, 0x007a8000, 0x007aa000, 0x007ac000, 0x007ae000, 0x007b0000, 
-	0x007b2000, 0x007b4000, 0x007b6000, 0x007b8000, 0x007ba000, 0x007bc000, 
-	0x007be000, 0x007c0000, 0x007c2000, 0x007c4000, 0x007c6000, 0x007c8000, 
-	0x007ca000, 0x007cc000, 0x007ce000, 0x007d0000, 0x007d2000, 0x007d4000, 
-	0x007d6000, 0x007d8000, 0x007da000, 0x007dc000, 0x007de000, 0x007e0000, 
-	0x007e2000, 0x007e4000, 0x007e6000, 0x007e8000, 0x007ea000, 0x007ec000, 
-	0x007ee000, 0x007f0000, 0x007f2000, 0x007f4000, 0x007f6000, 0x007f8000, 
-	0x007fa000, 0x007fc000, 0x007fe000, 0x007fe001, 0x00000000, 0x000001ff, 
-	0x00000200, 0x00000000, 0x000003ff, 0x00000400, 0x00000401, 0x00000401, 
-	0x00000238, 0x0000011c, 0x0000011c, 0x0000011c, 0x00000050, 0x00000050, 
-	0x00000050, 0x00000001, 0x00000158, 0x000001a8, 0x000000c8, 0x000000a0, 
-	0x000000c8, 0x00000000, 0x00000000, 0x0000005a, 0x000000fa, 0x00000401, 
-	0x00000401, 0x0000000a, 0x00000032, 0x00000401, 0x00000401, 0x00000158, 
-	0x000001a8, 0x00000018, 0x00000068, 0x000000b8, 0x00000108, 0x00000158, 
-	0x000001a8, 0x00000018, 0x00000068, 0x000000b8, 0x00000108, 0x00000001, 
-	0x00000002, 0x00000000, 0x00000008, 0x02150020, 0x02150020, 0x08100000, 
-	0x00000036, 0x00000000, 0x00000004, 0x00000004, 0x00000000, 0x00000000, 
-	0x00000001, 0x00000004, 0x00000002, 0x00000002, 0x00000001, 0x00000002, 
-	0x00000020, 0x00000040, 0x00000040, 0x00000003, 0x00000018, 0x00002000, 
-	0x000040c0, 0x00006180, 0x00008240, 0x0000a300, 0x0000c3c0, 0x0000e480, 
-	0x00010540, 0x00012600, 0x000146c0, 0x00016780, 0x00018840, 0x0001a900, 
-	0x0001c9c0, 0x0001ea80, 0x00020b40, 0x00022c00, 0x00024cc0, 0x00026d80, 
-	0x00028e40, 0x0002af00, 0x0002cfc0, 0x0002f080, 0x00001140, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x0003d000, 0x0000003d, 0x00000001, 0x000d0000, 
-	0x000700d0, 0x00028140, 0x000b8168, 0x00020220, 0x00010240, 0x000f0250, 
-	0x00010340, 0x000c0000, 0x000800c0, 0x00028140, 0x000b8168, 0x00020220, 
-	0x00010240, 0x00070250, 0x000202c0, 0x00100000, 0x00080100, 0x00028180, 
-	0x000b81a8, 0x00020260, 0x00018280, 0x000e8298, 0x00080380, 0x000f0000, 
-	0x000100f0, 0x00028100, 0x00090128, 0x000201b8, 0x000101d8, 0x000e01e8, 
-	0x000002c8, 0xfffffff3, 0x01afffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0xfffffff1, 0x00efffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0xfffffff6, 
-	0x005fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 
-	0x00000000, 0xfffff406, 0x1cbfffff, 0x00000005, 0x00000000, 0x00000014, 
-	0x00000000, 0x00040000, 0x00000000, 0xfffffff2, 0x004fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0xfffffffa, 
-	0x002fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 
-	0x00000000, 0xfffffff7, 0x01efffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00200000, 0x00000000, 0xfffffff5, 0x002fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000, 0xfffffff3, 
-	0x018fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0xfffffff1, 0x010fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00010000, 0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0xfffff406, 
-	0x1cbfffff, 0x00000005, 0x00000000, 0x00000014, 0x00000000, 0x00040000, 
-	0x00000000, 0xfffffff2, 0x004fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00080000, 0x00000000, 0xfffffffa, 0x002fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0xfffffff7, 
-	0x00efffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 
-	0x00000000, 0xfffffff5, 0x004fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00400000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00010000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00020000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00040000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00080000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00100000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00200000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00400000, 
-	0x00000000, 0xfffffff3, 0x020fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0xfffffff1, 0x010fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0xfffffff6, 
-	0x005fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 
-	0x00000000, 0xfffff406, 0x1cbfffff, 0x00000005, 0x00000000, 0x00000014, 
-	0x00000000, 0x00040000, 0x00000000, 0xfffffff2, 0x004fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0xffffff8a, 
-	0x042fffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 
-	0x00000000, 0xffffff97, 0x05cfffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00200000, 0x00000000, 0xfffffff5, 0x010fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000, 0xfffffff3, 
-	0x01efffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0xfffffff1, 0x002fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00010000, 0x00000000, 0xfffffff6, 0x005fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0xffffff06, 
-	0x1cbfffff, 0x00000000, 0x00000000, 0x00000014, 0x00000000, 0x00040000, 
-	0x00000000, 0xfffffff2, 0x004fffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00080000, 0x00000000, 0xfffffffa, 0x002fffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0xfffffff7, 
-	0x01cfffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00400000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00010000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00020000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00040000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00080000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00100000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00200000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00400000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00010000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00020000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00040000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00080000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00100000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00200000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00400000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00000000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00010000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00020000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00040000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00080000, 0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 
-	0x00000000, 0x000000cc, 0x00000000, 0x00100000, 0x00000000, 0xffffffff, 
-	0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 0x00000000, 0x00200000, 
-	0x00000000, 0xffffffff, 0x00cfffff, 0x00000000, 0x00000000, 0x000000cc, 
-	0x00000000, 0x00400000, 0x00000000, 0x00000032, 0x00000032, 0x00000211, 
-	0x00000200, 0x00000204, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-	0x00000000, 0x00000037, 0x00000021, 0x00000020, 0x00000001, 0x00000001, 
-	0x00000001, 0x07ffffff, 0x0000007f, 0x07ffffff, 0x0000003f, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00007ff8, 0x00007ff8, 0x00000000, 
-	0x000028ad, 0x00002918, 0x00002919, 0x00000005, 0x00000007, 0x00000000, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 
-	0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x0000ff1c, 0x0fffffff, 0x00000a2d, 
-	0x00003500, 0x00000001, 0x00000002, 0x00000003, 0x00000000, 0x00000004, 
-	0x00000001, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 0x00000001, 
-	0x00000003, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 0x00000001, 
-	0x00000003, 0x00000000, 0x00000001, 0x00000004, 0x00000000, 0x00000004, 
-	0x00000003, 0x00000000, 0x00000000, 0x00007fff, 0x000003ff, 0x00000000, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000000, 0x00000002, 0x00000090, 
-	0x00000090, 0x00800090, 0x08100000, 0x000009ff, 0x0000076c, 0x0000008a, 
-	0x00000080, 0x00000081, 0x00000080, 0x0000008a, 0x00000080, 0x00000081, 
-	0x00000080, 0x0000008a, 0x00000080, 0x00000081, 0x00000080, 0x0000008a, 
-	0x00000080, 0x00000081, 0x00000080, 0x0000008a, 0x00000080, 0x00000081, 
-	0x00000080, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x000025e4, 0x000025e4, 0x00004bc8, 0x00004bc8, 0x00000018, 
-	0x0000111a, 0x00543210, 0x00000000, 0x00210543, 0x00000000, 0x000025e4, 
-	0x000025e4, 0x00004bc8, 0x00004bc8, 0x00000018, 0x0000111a, 0x00543210, 
-	0x00000000, 0x00210543, 0x00000000, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000000, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000006, 
-	0x00000003, 0x00000004, 0x00000005, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000003, 0x00006000, 0x00000003, 0x00006000, 0x00000003, 
-	0x00004000, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 0x00000300, 
-	0x00000300, 0x00000300, 0x0003f008, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x0000007f, 
-	0x000000ff, 0x000000ff, 0x000000ff, 0x0000003e, 0x00000000, 0x0000003f, 
-	0x0000003f, 0x0000003f, 0x0000003f, 0x0000003f, 0x0000003f, 0x0000003f, 
-	0x0000000f, 0x00000000, 0x12170000, 0x22170000, 0x32170000, 0x12150000, 
-	0x22150000, 0x32150000, 0x02100000, 0x00100000, 0x10100000, 0x20100000, 
-	0x30100000, 0x40100000, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 
-	0x12140000, 0x22140000, 0x32140000, 0x42140000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00008906, 0x00008926, 0x00000036, 0x00000036, 0x08100000, 
-	0x08100000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xf000c000, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xf800c000, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0x00003c10, 0x00000008, 0x00000008, 
-	0x00000002, 0x00000004, 0x00000005, 0x00000004, 0x00000040, 0x00001808, 
-	0x00000803, 0x00000803, 0x00000040, 0x00000003, 0x00000803, 0x00000803, 
-	0x00000803, 0x00010003, 0x00000803, 0x00000803, 0x00000003, 0x00000003, 
-	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 
-	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 
-	0x00000003, 0x00002403, 0x0000002f, 0x00000009, 0x00000019, 0x00000184, 
-	0x00000183, 0x00000306, 0x00000019, 0x00000006, 0x00000306, 0x00000306, 
-	0x00000306, 0x00000c86, 0x00000306, 0x00000306, 0x00000006, 0x00000006, 
-	0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-	0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-	0x00000006, 0x00000306, 0x00000013, 0x00000006, 0x00001004, 0x00001004, 
-	0x00106440, 0x00106440, 0x00000040, 0x00000019, 0x00000001, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00000000, 0x04002000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000000, 0x41002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00002000, 0x0000007c, 0x0000003d, 0x0000003f, 0x0000009c, 0x0000000c, 
-	0x00000005, 0x0000000a, 0x00000005, 0x00000053, 0x000025e3, 0x00000054, 
-	0x00000054, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 
-	0x00000004, 0x00000004, 0x00000004, 0x00000000, 0x00000001, 0x00000002, 
-	0x00000000, 0x00000001, 0x00000002, 0x00000009, 0x0000000b, 0x0000000a, 
-	0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000001, 0x00000002, 
-	0x00000009, 0x0000000b, 0x0000000a, 0x00000009, 0x0000000b, 0x0000000a, 
-	0x00000009, 0x0000000b, 0x0000000a, 0x00000000, 0x00000800, 0x00000200, 
-	0x00000400, 0x00000000, 0x00000000, 0x1fff1fff, 0x1fff1fff, 0x1fff1fff, 
-	0x1fff1fff, 0x000025e4, 0x00008000, 0x20002000, 0x20002000, 0x80008000, 
-	0x80008000, 0x40004000, 0x40004000, 0x00000000, 0x00000002, 0x00000178, 
-	0x00000178, 0x00000000, 0x00000000, 0x00000178, 0x00000000, 0x00000000, 
-	0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000000, 
-	0x00000000, 0x00000004, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 
-	0x00000001, 0x00000002, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000004, 0x00000000, 0x00000001, 0x00000002, 
-	0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000001, 0x00000002, 
-	0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000013, 0x0e490e49, 
-	0x0e490e49, 0x00920092, 0x00920092, 0x01240124, 0x01240124, 0x00000000, 
-	0x00000000, 0x10001000, 0x10001000, 0x20010120, 0x01011001, 0x01010101, 
-	0x20010120, 0x01011001, 0x20010120, 0x01011001, 0x01010101, 0x20010120, 
-	0x01011001, 0x01010101, 0x00000004, 0x00000006, 0x02004104, 0x02004104, 
-	0x02004104, 0x02004104, 0x00000204, 0x000002ce, 0x000002ce, 0x00000000, 
-	0x00000000, 0x000002cc, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
-	0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000, 
-	0x00000001, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 
-	0x00000013, 0x0e490e49, 0x00000000, 0x00000000, 0x10001000, 0x10001000, 
-	0x20010120, 0x01011001, 0x01010101, 0x20010120, 0x01011001, 0x20010120, 
-	0x01011001, 0x01010101, 0x20010120, 0x01011001, 0x01010101, 0x02004104, 
-	0x02004104, 0x00000002, 0x00000000, 0x00000002, 0x00000000, 0x00000002, 
-	0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000002, 
-	0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 
-	0x00000006, 0x02004104, 0x02004104, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000003, 0x02555555, 0x02555555, 0x000002ce, 
-	0x000002ce, 0x000002ce, 0x000002ce, 0x000002ce, 0x000002ce, 0x000002cc, 
-	0x00000054, 0x00000054, 0x00000054, 0x00000054, 0x00000000, 0x00000001, 
-	0x00000002, 0x00000000, 0x00000006, 0x00000003, 0x00000004, 0x00000005, 
-	0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 
-	0x00000006, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000000, 
-	0x00000000, 0x00000006, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 
-	0x00000001, 0x00000002, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000001, 0x00000002, 
-	0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000001, 0x00000002, 
-	0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x0e490e49, 0x0e490e49, 
-	0x00920092, 0x00920092, 0x01240124, 0x01240124, 0x10001000, 0x10001000, 
-	0x20010120, 0x01011001, 0x01010101, 0x20010120, 0x01011001, 0x20010120, 
-	0x01011001, 0x01010101, 0x20010120, 0x01011001, 0x01010101, 0x00000004, 
-	0x00000006, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000000, 
-	0x00000000, 0x00000006, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 
-	0x00000000, 0x00000000, 0x00000006, 0x00000003, 0x00000004, 0x00000005, 
-	0x00000003, 0x00000004, 0x00000005, 0x00000003, 0x00000004, 0x00000005, 
-	0x00000003, 0x00000003, 0x00000003, 0x00000006, 0x00000003, 0x00000004, 
-	0x00000005, 0x00000003, 0x00000004, 0x00000005, 0x00000003, 0x00000004, 
-	0x00000005, 0x00000003, 0x00000003, 0x00000003, 0x00000006, 0x0e490e49, 
-	0x00000000, 0x00920092, 0x00000000, 0x01240124, 0x00000000, 0x00000000, 
-	0x0e490e49, 0x00000000, 0x00920092, 0x00000000, 0x01240124, 0x10001000, 
-	0x10001000, 0x20010120, 0x01011001, 0x01010101, 0x20010120, 0x01011001, 
-	0x20010120, 0x01011001, 0x01010101, 0x20010120, 0x01011001, 0x01010101, 
-	0x00000001, 0x00000003, 0x00000004, 0x00000003, 0x00000004, 0x00000005, 
-	0x00000003, 0x00000006, 0x00000005, 0x00000004, 0x00000003, 0x00000004, 
-	0x00000005, 0x00000003, 0x00000006, 0x00000005, 0x00000004, 0x00000003, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 0x00000001, 
-	0x00000002, 0x00000005, 0x00000003, 0x00000006, 0x00000005, 0x00000004, 
-	0x00000003, 0x00000004, 0x00000000, 0x00000001, 0x00000002, 0x00000000, 
-	0x00000001, 0x00000002, 0x00000005, 0x00000003, 0x00000006, 0x00000005, 
-	0x00480048, 0x00480048, 0x00900090, 0x00900090, 0x01200120, 0x01200120, 
-	0x04020402, 0x04020402, 0x00050005, 0x00050005, 0x12001200, 0x12001200, 
-	0x08000800, 0x08000800, 0x01200120, 0x01011020, 0x01010120, 0x01200120, 
-	0x01011020, 0x01200120, 0x01011020, 0x01010120, 0x01200120, 0x01011020, 
-	0x01010120, 0x00000004, 0x00000006, 0x00000123, 0x00000123, 0x00000123, 
-	0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 
-	0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 
-	0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000123, 0x00000020, 
-	0x00000032, 0x00000007, 0x00000007, 0x00000000, 0x00000008, 0x00000001, 
-	0x00000000, 0x00000000, 0x00000000, 0x02150020, 0x02150020, 0x00000030, 
-	0x08100000, 0x00000036, 0x00000030, 0x00000031, 0x00000004, 0x00000005, 
-	0x00000000, 0x00000004, 0x00000001, 0x00000006, 0x00000001, 0x00000002, 
-	0x00000040, 0x00000040, 0x0000001c, 0x00000020, 0x00010000, 0x00020700, 
-	0x00030e00, 0x00041500, 0x00051c00, 0x00062300, 0x00072a00, 0x00083100, 
-	0x00093800, 0x000a3f00, 0x000b4600, 0x000c4d00, 0x000d5400, 0x000e5b00, 
-	0x000f6200, 0x00106900, 0x00117000, 0x00127700, 0x00137e00, 0x00148500, 
-	0x00158c00, 0x00169300, 0x00179a00, 0x0018a100, 0x0019a800, 0x001aaf00, 
-	0x001bb600, 0x001cbd00, 0x001dc400, 0x001ecb00, 0x001fd200, 0x0000d900, 
-	0x0000001e, 0x0000001d, 0x00010000, 0x00020780, 0x00030f00, 0x00041680, 
-	0x00051e00, 0x00062580, 0x00072d00, 0x00083480, 0x00093c00, 0x000a4380, 
-	0x000b4b00, 0x000c5280, 0x000d5a00, 0x000e6180, 0x000f6900, 0x00107080, 
-	0x00117800, 0x00127f80, 0x00138700, 0x00148e80, 0x00159600, 0x00169d80, 
-	0x0017a500, 0x0018ac80, 0x0019b400, 0x001abb80, 0x001bc300, 0x001cca80, 
-	0x0000d200, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000028, 
-	0x0000002c, 0x00000030, 0x00000001, 0x00000001, 0x00000001, 0x00000211, 
-	0x00000200, 0x00000204, 0x00000219, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-	0x0000ffff, 0x07ffffff, 0x0000007f, 0x07ffffff, 0x0000003f, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00007ff8, 0x00007ff8, 0x00000000, 
-	0x00000001, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x00201001, 0x00000000, 0x01009000, 0x00000100, 0x00000001, 
-	0x00000000, 0x00000000, 0x140aff00, 0x00009002, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009004, 0x00000000, 0x00000000, 0x00000000, 0x00009006, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009008, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000900a, 0x00000000, 0x00000000, 0x00000000, 0x0000900c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000900e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009010, 0x00000000, 0x00000000, 0x00000000, 0x00009012, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009014, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009016, 0x00000000, 0x00000000, 0x00000000, 0x00009018, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000901a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000901c, 0x00000000, 0x00000000, 0x00000000, 0x0000901e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009020, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009022, 0x00000000, 0x00000000, 0x00000000, 0x00009024, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009026, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009028, 0x00000000, 0x00000000, 0x00000000, 0x0000902a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000902c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000902e, 0x00000000, 0x00000000, 0x00000000, 0x00009030, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009032, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009034, 0x00000000, 0x00000000, 0x00000000, 0x00009036, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009038, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000903a, 0x00000000, 0x00000000, 0x00000000, 0x0000903c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000903e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009040, 0x00000000, 0x00000000, 0x00000000, 0x00009042, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009044, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009046, 0x00000000, 0x00000000, 0x00000000, 0x00009048, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000904a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000904c, 0x00000000, 0x00000000, 0x00000000, 0x0000904e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009050, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009052, 0x00000000, 0x00000000, 0x00000000, 0x00009054, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009056, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009058, 0x00000000, 0x00000000, 0x00000000, 0x0000905a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000905c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000905e, 0x00000000, 0x00000000, 0x00000000, 0x00009060, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009062, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009064, 0x00000000, 0x00000000, 0x00000000, 0x00009066, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009068, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000906a, 0x00000000, 0x00000000, 0x00000000, 0x0000906c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000906e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009070, 0x00000000, 0x00000000, 0x00000000, 0x00009072, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009074, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009076, 0x00000000, 0x00000000, 0x00000000, 0x00009078, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000907a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000907c, 0x00000000, 0x00000000, 0x00000000, 0x0000907e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009080, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009082, 0x00000000, 0x00000000, 0x00000000, 0x00009084, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009086, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009088, 0x00000000, 0x00000000, 0x00000000, 0x0000908a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000908c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000908e, 0x00000000, 0x00000000, 0x00000000, 0x00009090, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009092, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009094, 0x00000000, 0x00000000, 0x00000000, 0x00009096, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009098, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000909a, 0x00000000, 0x00000000, 0x00000000, 0x0000909c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000909e, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090a0, 0x00000000, 0x00000000, 0x00000000, 0x000090a2, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090a4, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090a6, 0x00000000, 0x00000000, 0x00000000, 0x000090a8, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090aa, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090ac, 0x00000000, 0x00000000, 0x00000000, 0x000090ae, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090b0, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090b2, 0x00000000, 0x00000000, 0x00000000, 0x000090b4, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090b6, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090b8, 0x00000000, 0x00000000, 0x00000000, 0x000090ba, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090bc, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090be, 0x00000000, 0x00000000, 0x00000000, 0x000090c0, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090c2, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090c4, 0x00000000, 0x00000000, 0x00000000, 0x000090c6, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090c8, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090ca, 0x00000000, 0x00000000, 0x00000000, 0x000090cc, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090ce, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090d0, 0x00000000, 0x00000000, 0x00000000, 0x000090d2, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090d4, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090d6, 0x00000000, 0x00000000, 0x00000000, 0x000090d8, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090da, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090dc, 0x00000000, 0x00000000, 0x00000000, 0x000090de, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090e0, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090e2, 0x00000000, 0x00000000, 0x00000000, 0x000090e4, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090e6, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090e8, 0x00000000, 0x00000000, 0x00000000, 0x000090ea, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090ec, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090ee, 0x00000000, 0x00000000, 0x00000000, 0x000090f0, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090f2, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090f4, 0x00000000, 0x00000000, 0x00000000, 0x000090f6, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090f8, 0x00000000, 0x00000000, 
-	0x00000000, 0x000090fa, 0x00000000, 0x00000000, 0x00000000, 0x000090fc, 
-	0x00000000, 0x00000000, 0x00000000, 0x000090fe, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009100, 0x00000000, 0x00000000, 0x00000000, 0x00009102, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009104, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009106, 0x00000000, 0x00000000, 0x00000000, 0x00009108, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000910a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000910c, 0x00000000, 0x00000000, 0x00000000, 0x0000910e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009110, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009112, 0x00000000, 0x00000000, 0x00000000, 0x00009114, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009116, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009118, 0x00000000, 0x00000000, 0x00000000, 0x0000911a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000911c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000911e, 0x00000000, 0x00000000, 0x00000000, 0x00009120, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009122, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009124, 0x00000000, 0x00000000, 0x00000000, 0x00009126, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009128, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000912a, 0x00000000, 0x00000000, 0x00000000, 0x0000912c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000912e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009130, 0x00000000, 0x00000000, 0x00000000, 0x00009132, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009134, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009136, 0x00000000, 0x00000000, 0x00000000, 0x00009138, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000913a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000913c, 0x00000000, 0x00000000, 0x00000000, 0x0000913e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009140, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009142, 0x00000000, 0x00000000, 0x00000000, 0x00009144, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009146, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009148, 0x00000000, 0x00000000, 0x00000000, 0x0000914a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000914c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000914e, 0x00000000, 0x00000000, 0x00000000, 0x00009150, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009152, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009154, 0x00000000, 0x00000000, 0x00000000, 0x00009156, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009158, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000915a, 0x00000000, 0x00000000, 0x00000000, 0x0000915c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000915e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009160, 0x00000000, 0x00000000, 0x00000000, 0x00009162, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009164, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009166, 0x00000000, 0x00000000, 0x00000000, 0x00009168, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000916a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000916c, 0x00000000, 0x00000000, 0x00000000, 0x0000916e, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009170, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009172, 0x00000000, 0x00000000, 0x00000000, 0x00009174, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009176, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009178, 0x00000000, 0x00000000, 0x00000000, 0x0000917a, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000917c, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000917e, 0x00000000, 0x00000000, 0x00000000, 0x00009180, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009182, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009184, 0x00000000, 0x00000000, 0x00000000, 0x00009186, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009188, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000918a, 0x00000000, 0x00000000, 0x00000000, 0x0000918c, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000918e, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009190, 0x00000000, 0x00000000, 0x00000000, 0x00009192, 
-	0x00000000, 0x00000000, 0x00000000, 0x00009194, 0x00000000, 0x00000000, 
-	0x00000000, 0x00009196, 0x00000000, 0x00000000, 0x00000000, 0x00009198, 
-	0x00000000, 0x00000000, 0x00000000, 0x0000919a, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000919c, 0x00000000, 0x00000000, 0x00000000, 0x0000919e, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091a0, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091a2, 0x00000000, 0x00000000, 0x00000000, 0x000091a4, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091a6, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091a8, 0x00000000, 0x00000000, 0x00000000, 0x000091aa, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091ac, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091ae, 0x00000000, 0x00000000, 0x00000000, 0x000091b0, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091b2, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091b4, 0x00000000, 0x00000000, 0x00000000, 0x000091b6, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091b8, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091ba, 0x00000000, 0x00000000, 0x00000000, 0x000091bc, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091be, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091c0, 0x00000000, 0x00000000, 0x00000000, 0x000091c2, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091c4, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091c6, 0x00000000, 0x00000000, 0x00000000, 0x000091c8, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091ca, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091cc, 0x00000000, 0x00000000, 0x00000000, 0x000091ce, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091d0, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091d2, 0x00000000, 0x00000000, 0x00000000, 0x000091d4, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091d6, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091d8, 0x00000000, 0x00000000, 0x00000000, 0x000091da, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091dc, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091de, 0x00000000, 0x00000000, 0x00000000, 0x000091e0, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091e2, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091e4, 0x00000000, 0x00000000, 0x00000000, 0x000091e6, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091e8, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091ea, 0x00000000, 0x00000000, 0x00000000, 0x000091ec, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091ee, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091f0, 0x00000000, 0x00000000, 0x00000000, 0x000091f2, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091f4, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091f6, 0x00000000, 0x00000000, 0x00000000, 0x000091f8, 
-	0x00000000, 0x00000000, 0x00000000, 0x000091fa, 0x00000000, 0x00000000, 
-	0x00000000, 0x000091fc, 0x00000000, 0x00000000, 0x00000000, 0x000091fe, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0x0000ffff, 0x00000000, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0x0000ffff, 0x00000000, 0x0000039b, 0x00001500, 0x00000001, 0x00000002, 
-	0x00000003, 0x00000000, 0x00000004, 0x00000001, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000004, 0x00000003, 0x00000000, 0x00000000, 
-	0x00007fff, 0x000003ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000003, 0x00bebc20, 
-	0x00000000, 0x00000005, 0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 
-	0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 0x00000003, 0x00bebc20, 
-	0x00000000, 0x00000005, 0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 
-	0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 0x00000003, 0x00bebc20, 
-	0x00000000, 0x00000005, 0x00000003, 0x00bebc20, 0x00000000, 0x00000005, 
-	0x0000000d, 0x0000000c, 0x00000000, 0x00000010, 0x0000000f, 0x00000000, 
-	0x00000000, 0x00000000, 0x02150020, 0x02150020, 0x00000030, 0x08100000, 
-	0x00000036, 0x00000030, 0x00000031, 0x00000003, 0x00000000, 0x00000001, 
-	0x00000003, 0x00000001, 0x00000002, 0x00000040, 0x00000040, 0x00000004, 
-	0x00000020, 0x0000000f, 0x0000001b, 0x00008000, 0x000103c0, 0x00018780, 
-	0x00020b40, 0x00028f00, 0x000312c0, 0x00039680, 0x00041a40, 0x00049e00, 
-	0x000521c0, 0x0005a580, 0x00062940, 0x0006ad00, 0x000730c0, 0x0007b480, 
-	0x00083840, 0x0008bc00, 0x00093fc0, 0x0009c380, 0x000a4740, 0x000acb00, 
-	0x000b4ec0, 0x000bd280, 0x000c5640, 0x000cda00, 0x000d5dc0, 0x00006180, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x0000050e, 
-	0x000004fd, 0x00000501, 0x0000051e, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-	0x0000ffff, 0x00000046, 0x0000000c, 0x00000000, 0x00000000, 0x0000001c, 
-	0x000000f4, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
-	0x00000001, 0x07ffffff, 0x0000007f, 0x07ffffff, 0x0000003f, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00007ff8, 0x00007ff8, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 
-	0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0x00001900, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 
-	0x00000000, 0x0000021c, 0x00003500, 0x00000001, 0x00000002, 0x00000003, 
-	0x00000000, 0x00000004, 0x00000001, 0x00000000, 0x00000001, 0x00000004, 
-	0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 
-	0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 0x00000004, 
-	0x00000000, 0x00000004, 0x00000003, 0x00000000, 0x00000000, 0x00007fff, 
-	0x000003ff, 0x00000000, 0x03938700, 0x00000000, 0x00000000, 0x00000000, 
-	0x03938700, 0x00000000, 0x00000000, 0x0000000f, 0x00000007, 0x00000000, 
-	0x0000000e, 0x0000000e, 0x00000000, 0x00000000, 0x00000000, 0x03150020, 
-	0x03150020, 0x01000030, 0x08100000, 0x00000036, 0x00000030, 0x00000031, 
-	0x00000002, 0x00000005, 0x00000002, 0x00000002, 0x00000000, 0x00000005, 
-	0x00000003, 0x00000001, 0x00000004, 0x00000001, 0x00000002, 0x00000040, 
-	0x00000040, 0x00000004, 0x00000020, 0x00000002, 0x00000020, 0x00001000, 
-	0x00002080, 0x00003100, 0x00004180, 0x00005200, 0x00006280, 0x00007300, 
-	0x00008380, 0x00009400, 0x0000a480, 0x0000b500, 0x0000c580, 0x0000d600, 
-	0x0000e680, 0x0000f700, 0x00010780, 0x00011800, 0x00012880, 0x00013900, 
-	0x00014980, 0x00015a00, 0x00016a80, 0x00017b00, 0x00018b80, 0x00019c00, 
-	0x0001ac80, 0x0001bd00, 0x0001cd80, 0x0001de00, 0x0001ee80, 0x0001ff00, 
-	0x00000f80, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000001, 0x00001214, 0x00001200, 0x00001204, 
-	0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000020, 0x00000038, 
-	0x00000000, 0x00000000, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 
-	0x00000027, 0x00000039, 0x0000003a, 0x0000002b, 0x0000002c, 0x00000000, 
-	0x000000ec, 0x00000000, 0x00000029, 0x0000002a, 0x00000001, 0x00000001, 
-	0x00000001, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 
-	0x07ffffff, 0x0000007f, 0x07ffffff, 0x0000003f, 0x0000ffff, 0x0000ffff, 
-	0x0000ffff, 0x0000ffff, 0x00007ff8, 0x00007ff8, 0x00000000, 0x00000001, 
-	0xcccc0201, 0xcccccccc, 0xcccc0201, 0xcccccccc, 0xcccc0201, 0xcccccccc, 
-	0xcccc0201, 0xcccccccc, 0xcccc0201, 0xcccccccc, 0xcccc0201, 0xcccccccc, 
-	0xcccc0201, 0xcccccccc, 0xcccc0201, 0xcccccccc, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0x00000000, 0x00010001, 0x00340807, 0xccccccc9, 0x10000000, 0x000028ad, 
-	0x00002918, 0x00002919, 0x00000000, 0x00000000, 0x00000005, 0x00000006, 
-	0x7058103c, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 0x0000ff00, 0x00000000, 
-	0x0000ff00, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0000ffff, 0x00000000, 
-	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
-	0xffffffff, 0xffffffff, 0x0000ffff, 0x00000000, 0x03231303, 0x13032313, 
-	0x03030323, 0xa0b09043, 0x02000200, 0x06040604, 0x03231303, 0x13032313, 
-	0x03030323, 0xa0b09043, 0x13131313, 0x13131313, 0x13131313, 0xa0b09043, 
-	0x03010200, 0x00000000, 0x00000632, 0x00001500, 0x00000001, 0x00000002, 
-	0x00000003, 0x00000000, 0x00000004, 0x00000001, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000001, 0x00000003, 0x00000000, 0x00000001, 
-	0x00000004, 0x00000000, 0x00000004, 0x00000003, 0x00000000, 0x00000000, 
-	0x00007fff, 0x000003ff, 0x002625a0, 0x00000000, 0x002625a0, 0x00000000, 
-	0x002625a0, 0x00000000, 0x002625a0, 0x00000000, 0x000e0000, 0x011600d6, 
-	0x002625a0, 0x00000000, 0x002625a0, 0x00000000, 0x002625a0, 0x00000000, 
-	0x002625a0, 0x00000000, 0x00720000, 0x012300f3, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 
-	0x55540000, 0x55555555, 0x00005555, 0xf0000000, 0x55540000, 0x55555555, 
-	0x00005555, 0xf0000000, 0x00000000, 0x00010000, 0x00005014, 0x00000000, 
-	0xfff55fff, 0x0000ffff, 0xf00003e0, 0x00000000, 0x0000a000, 0x00000400, 
-	0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000, 
-	0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 
-	0xff5c0000, 0xfff55fff, 0x0000ffff, 0xf00003e0, 0x00000000, 0x0000a000, 
-	0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 
-	0x00000000, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 
-	0x00020000, };
+static const u8 init_data_zipped_e2[] = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0xed, 0xdc, 
+	0x0b, 0x4c, 0x5c, 0xd9, 0x7d, 0xc7, 0xf1, 0x73, 0x67, 0x86, 0x61, 0x78, 
+	0x0f, 0xef, 0xa7, 0x31, 0x6f, 0x03, 0xc6, 0x06, 0x63, 0x8c, 0xb1, 0x8d, 
+	0x61, 0x00, 0x1b, 0x83, 0xb1, 0x01, 0x63, 0xc0, 0x18, 0x63, 0x83, 0x31, 
+	0xb6, 0xf1, 0x1b, 0xbf, 0xb1, 0x8d, 0x61, 0x76, 0x93, 0x66, 0x93, 0x6d, 
+	0xb4, 0xe1, 0x24, 0xd5, 0x36, 0xca, 0xa3, 0xda, 0xb6, 0x49, 0xb5, 0xad, 
+	0x36, 0xdd, 0xa8, 0xda, 0x46, 0xab, 0x36, 0x49, 0x51, 0x37, 0xad, 0x9c, 
+	0xc4, 0xcd, 0xae, 0x56, 0x55, 0x95, 0x56, 0x55, 0x65, 0xb5, 0xab, 0x28, 
+	0x8a, 0xaa, 0xc4, 0xcd, 0x6e, 0x92, 0xd5, 0xaa, 0x0d, 0xfd, 0xde, 0xb9, 
+	0x33, 0x30, 0xfc, 0x3d, 0x18, 0xdb, 0x38, 0xd9, 0x95, 0xc2, 0x8c, 0x8f, 
+	0xcf, 0xfc, 0xe7, 0x33, 0x77, 0xb8, 0x77, 0xe6, 0xce, 0xfd, 0xdd, 0xd7, 
+	0x8c, 0x52, 0x39, 0x4a, 0x29, 0x0f, 0x6d, 0x88, 0xe6, 0xa5, 0xbd, 0x44, 
+	0x9b, 0xa1, 0xdd, 0x53, 0xca, 0xa0, 0x33, 0x70, 0x03, 0x37, 0x70, 0x03, 
+	0x37, 0x70, 0x03, 0x37, 0x70, 0x1b, 0x6e, 0xc3, 0x6d, 0xb8, 0x0d, 0xb7, 
+	0xe1, 0x36, 0xdc, 0x86, 0xdb, 0x70, 0x3b, 0x6e, 0xc7, 0xed, 0xb8, 0x1d, 
+	0xb7, 0xe3, 0x76, 0xdc, 0x8e, 0xdb, 0x71, 0x07, 0xee, 0xc0, 0x1d, 0xb8, 
+	0x03, 0x77, 0xe0, 0x0e, 0xdc, 0x81, 0x3b, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 
+	0xc3, 0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3, 0xc3, 0x70, 0x27, 0xee, 
+	0xc4, 0x9d, 0xb8, 0x13, 0x77, 0xe2, 0x4e, 0xdc, 0x89, 0x3b, 0xf1, 0x70, 
+	0x3c, 0x1c, 0x0f, 0xc7, 0xc3, 0xf1, 0x70, 0x3c, 0x1c, 0x0f, 0xc7, 0xc3, 
+	0x71, 0x17, 0xee, 0xc2, 0x5d, 0xb8, 0x0b, 0x77, 0xe1, 0x2e, 0xdc, 0x85, 
+	0xbb, 0xf0, 0x08, 0x3c, 0x02, 0x8f, 0xc0, 0x23, 0xf0, 0x08, 0x3c, 0x02, 
+	0x8f, 0xc0, 0x23, 0xf0, 0x48, 0x3c, 0x12, 0x8f, 0xc4, 0x23, 0xf1, 0x48, 
+	0x3c, 0x12, 0x8f, 0xc4, 0x23, 0xf1, 0x28, 0x3c, 0x0a, 0x8f, 0xc2, 0xa3, 
+	0xf0, 0x28, 0x3c, 0x0a, 0x8f, 0xc2, 0xa3, 0xf0, 0x68, 0x3c, 0x1a, 0x8f, 
+	0xc6, 0xa3, 0xf1, 0x68, 0x3c, 0x1a, 0x8f, 0xc6, 0xa3, 0xf1, 0x18, 0x3c, 
+	0x06, 0x8f, 0xc1, 0x63, 0xf0, 0x18, 0x3c, 0x06, 0x8f, 0xc1, 0x63, 0xf0, 
+	0x58, 0x3c, 0x16, 0x8f, 0xc5, 0x63, 0xf1, 0x58, 0x3c, 0x16, 0x8f, 0xc5, 
+	0x63, 0xf1, 0x38, 0x3c, 0x0e, 0x8f, 0xc3, 0xe3, 0xf0, 0x38, 0x3c, 0x0e, 
+	0x8f, 0xc3, 0xe3, 0x70, 0x37, 0xee, 0xc6, 0xdd, 0xb8, 0x1b, 0x77, 0xe3, 
+	0x6e, 0xdc, 0x8d, 0xbb, 0xf1, 0x78, 0x3c, 0x1e, 0x8f, 0xc7, 0xe3, 0xf1, 
+	0x78, 0x3c, 0x1e, 0x8f, 0xc7, 0xe3, 0xf1, 0x04, 0x3c, 0x01, 0x4f, 0xc0, 
+	0x13, 0xf0, 0x04, 0x3c, 0x01, 0x4f, 0xc0, 0x13, 0xf0, 0x44, 0x3c, 0x11, 
+	0x4f, 0xc4, 0x13, 0xf1, 0x44, 0x3c, 0x11, 0x4f, 0xc4, 0x13, 0xf1, 0x24, 
+	0x3c, 0x09, 0x4f, 0xc2, 0x93, 0xf0, 0x24, 0x3c, 0x09, 0x4f, 0xc2, 0x93, 
+	0xf0, 0x64, 0x3c, 0x19, 0x4f, 0xc6, 0x93, 0xf1, 0x64, 0x3c, 0x19, 0x4f, 
+	0xc6, 0x93, 0xf1, 0x14, 0x3c, 0x05, 0x4f, 0xc1, 0x53, 0xf0, 0x14, 0x3c, 
+	0x05, 0x4f, 0xc1, 0x53, 0xf0, 0x54, 0x3c, 0x15, 0x4f, 0xc5, 0x53, 0xf1, 
+	0x54, 0x3c, 0x15, 0x4f, 0xc5, 0x53, 0xf1, 0x34, 0x3c, 0x0d, 0x4f, 0xc3, 
+	0xd3, 0xf0, 0x34, 0x3c, 0x0d, 0x4f, 0xc3, 0xd3, 0xf0, 0x74, 0x3c, 0x1d, 
+	0x4f, 0xc7, 0xd3, 0xf1, 0x74, 0x3c, 0x1d, 0x4f, 0xc7, 0xd3, 0xf1, 0x0c, 
+	0x3c, 0x03, 0xcf, 0xc0, 0x33, 0xf0, 0x0c, 0x3c, 0x03, 0xcf, 0xc0, 0x33, 
+	0xf0, 0x4c, 0x3c, 0x13, 0xcf, 0xc4, 0x33, 0xf1, 0x4c, 0x3c, 0x13, 0xcf, 
+	0xc4, 0x33, 0xf1, 0x2c, 0x3c, 0x0b, 0xcf, 0xc2, 0xb3, 0xf0, 0x2c, 0x3c, 
+	0x0b, 0xcf, 0xc2, 0xb3, 0xf0, 0x55, 0xf8, 0x2a, 0x7c, 0x15, 0xbe, 0x0a, 
+	0x5f, 0x85, 0xaf, 0xc2, 0x57, 0xe1, 0xab, 0xf0, 0x6c, 0x3c, 0x1b, 0xcf, 
+	0xc6, 0xb3, 0xf1, 0x6c, 0x3c, 0x1b, 0xcf, 0xc6, 0xb3, 0xf1, 0xd5, 0xf8, 
+	0x6a, 0x7c, 0x35, 0xbe, 0x1a, 0x5f, 0x8d, 0xaf, 0xc6, 0x57, 0xe3, 0xab, 
+	0x71, 0xf3, 0xa3, 0x9f, 0xc3, 0x7f, 0x39, 0x78, 0x0e, 0x9e, 0x83, 0xe7, 
+	0xe0, 0x39, 0x78, 0x0e, 0x9e, 0x8b, 0xe7, 0xe2, 0xb9, 0x78, 0x2e, 0x9e, 
+	0x8b, 0xe7, 0xe2, 0xb9, 0x78, 0x2e, 0x9e, 0x87, 0xe7, 0xe1, 0x79, 0x78, 
+	0x1e, 0x9e, 0x87, 0xe7, 0xe1, 0x79, 0x78, 0x1e, 0x9e, 0x8f, 0xe7, 0xe3, 
+	0xf9, 0x78, 0x3e, 0x9e, 0x8f, 0xe7, 0xe3, 0xf9, 0x78, 0x3e, 0x5e, 0x80, 
+	0x17, 0xe0, 0x05, 0x78, 0x01, 0x5e, 0x80, 0x17, 0xe0, 0x05, 0x78, 0x01, 
+	0x5e, 0x88, 0x17, 0xe2, 0x85, 0x78, 0x21, 0x5e, 0x88, 0x17, 0xe2, 0x85, 
+	0x78, 0x21, 0x5e, 0x84, 0x17, 0xe1, 0x45, 0x78, 0x11, 0x5e, 0x84, 0x17, 
+	0xe1, 0x45, 0x78, 0x11, 0xbe, 0x06, 0x5f, 0x83, 0xaf, 0xc1, 0xd7, 0xe0, 
+	0x6b, 0xf0, 0x35, 0xf8, 0x1a, 0x7c, 0x0d, 0x5e, 0x8c, 0x17, 0xe3, 0xc5, 
+	0x78, 0x31, 0x5e, 0x8c, 0x17, 0xe3, 0xc5, 0x78, 0x31, 0x5e, 0x82, 0x97, 
+	0xe0, 0x25, 0x78, 0x09, 0x5e, 0x82, 0x97, 0xe0, 0x25, 0x78, 0x09, 0x5e, 
+	0x8a, 0x97, 0xe2, 0xa5, 0x78, 0x29, 0x5e, 0x8a, 0x97, 0xe2, 0xa5, 0x78, 
+	0x29, 0xbe, 0x16, 0x5f, 0x8b, 0xaf, 0xc5, 0xd7, 0xe2, 0x6b, 0xf1, 0xb5, 
+	0xf8, 0x5a, 0x7c, 0x2d, 0x5e, 0x86, 0x97, 0xe1, 0x65, 0x78, 0x19, 0x5e, 
+	0x86, 0x97, 0xe1, 0x65, 0x78, 0x19, 0xbe, 0x0e, 0x5f, 0x87, 0xaf, 0xc3, 
+	0xd7, 0xe1, 0xeb, 0xf0, 0x75, 0xf8, 0x3a, 0x7c, 0x1d, 0xbe, 0x1e, 0x5f, 
+	0x8f, 0xaf, 0xc7, 0xd7, 0xe3, 0xeb, 0xf1, 0xf5, 0xf8, 0x7a, 0x7c, 0x3d, 
+	0x5e, 0x8e, 0x97, 0xe3, 0xe5, 0x78, 0x39, 0x5e, 0x8e, 0x97, 0xe3, 0xe5, 
+	0x78, 0x39, 0x5e, 0x81, 0x57, 0xe0, 0x15, 0x78, 0x05, 0x5e, 0x81, 0x57, 
+	0xe0, 0x15, 0x78, 0x05, 0xbe, 0x01, 0xdf, 0x80, 0x6f, 0xc0, 0x37, 0xe0, 
+	0x1b, 0xf0, 0x0d, 0xf8, 0x06, 0x7c, 0x03, 0x5e, 0x89, 0x57, 0xe2, 0x95, 
+	0x78, 0x25, 0x5e, 0x89, 0x57, 0xe2, 0x95, 0x78, 0x25, 0xbe, 0x11, 0xdf, 
+	0x88, 0x6f, 0xc4, 0x37, 0xe2, 0x1b, 0xf1, 0x8d, 0xf8, 0x46, 0x7c, 0x23, 
+	0x5e, 0x85, 0x57, 0xe1, 0x55, 0x78, 0x15, 0x5e, 0x85, 0x57, 0xe1, 0x55, 
+	0x78, 0x15, 0xbe, 0x09, 0xdf, 0x84, 0x6f, 0xc2, 0x37, 0xe1, 0x9b, 0xf0, 
+	0x4d, 0xf8, 0x26, 0x7c, 0x13, 0x5e, 0x8d, 0x57, 0xe3, 0xd5, 0x78, 0x35, 
+	0x5e, 0x8d, 0x57, 0xe3, 0xd5, 0x78, 0x35, 0xbe, 0x19, 0xdf, 0x8c, 0x6f, 
+	0xc6, 0x37, 0xe3, 0x9b, 0xf1, 0xcd, 0xf8, 0x66, 0x7c, 0x33, 0x5e, 0x83, 
+	0xd7, 0xe0, 0x35, 0x78, 0x0d, 0x5e, 0x83, 0xd7, 0xe0, 0x35, 0x78, 0x0d, 
+	0xbe, 0x05, 0xdf, 0x82, 0x6f, 0xc1, 0xb7, 0xe0, 0x5b, 0xf0, 0x2d, 0xf8, 
+	0x16, 0x7c, 0x0b, 0xbe, 0x15, 0xdf, 0x8a, 0x6f, 0xc5, 0xb7, 0xe2, 0x5b, 
+	0xf1, 0xad, 0xf8, 0x56, 0x7c, 0x2b, 0xbe, 0x0d, 0xdf, 0x86, 0x6f, 0xc3, 
+	0xb7, 0xe1, 0xdb, 0xf0, 0x6d, 0xf8, 0x36, 0x7c, 0x1b, 0x5e, 0x8b, 0xd7, 
+	0xe2, 0xb5, 0x78, 0x2d, 0x5e, 0x8b, 0xd7, 0xe2, 0xb5, 0x78, 0x2d, 0xbe, 
+	0x1d, 0xdf, 0x8e, 0x6f, 0xc7, 0xb7, 0xe3, 0xdb, 0xf1, 0xed, 0xf8, 0x76, 
+	0x7c, 0x3b, 0x5e, 0x87, 0xd7, 0xe1, 0x75, 0x78, 0x1d, 0x5e, 0x87, 0xd7, 
+	0xe1, 0x75, 0x78, 0x1d, 0x5e, 0x8f, 0xd7, 0xe3, 0xf5, 0x78, 0x3d, 0x5e, 
+	0x8f, 0xd7, 0xe3, 0xf5, 0x78, 0xfd, 0x3d, 0x2b, 0xf6, 0x3d, 0xb8, 0x87, 
+	0x1b, 0x1e, 0xdc, 0x83, 0x7b, 0x70, 0x0f, 0xee, 0xc1, 0x1b, 0xf0, 0x06, 
+	0xbc, 0x01, 0x6f, 0xc0, 0x1b, 0xf0, 0x06, 0xbc, 0x01, 0x6f, 0xc0, 0x1b, 
+	0xf1, 0x46, 0xbc, 0x11, 0x6f, 0xc4, 0x1b, 0xf1, 0x46, 0xbc, 0x11, 0x6f, 
+	0xc4, 0x9b, 0xf0, 0x26, 0xbc, 0x09, 0x6f, 0xc2, 0x9b, 0xf0, 0x26, 0xbc, 
+	0x09, 0x6f, 0xc2, 0x77, 0xe0, 0x3b, 0xf0, 0x1d, 0xf8, 0x0e, 0x7c, 0x07, 
+	0xbe, 0x03, 0xdf, 0x81, 0xef, 0xc0, 0x77, 0xe2, 0x3b, 0xf1, 0x9d, 0xf8, 
+	0x4e, 0x7c, 0x27, 0xbe, 0x13, 0xdf, 0x89, 0xef, 0xc4, 0x9b, 0xf1, 0x66, 
+	0xbc, 0x19, 0x6f, 0xc6, 0x9b, 0xf1, 0x66, 0xbc, 0x19, 0x6f, 0xc6, 0x77, 
+	0xe1, 0xbb, 0xf0, 0x5d, 0xf8, 0x2e, 0x7c, 0x17, 0xbe, 0x0b, 0xdf, 0x85, 
+	0xef, 0xc2, 0x5b, 0xf0, 0x16, 0xbc, 0x05, 0x6f, 0xc1, 0x5b, 0xf0, 0x16, 
+	0xbc, 0x05, 0x6f, 0xc1, 0x5b, 0xf1, 0x56, 0xbc, 0x15, 0x6f, 0xc5, 0x5b, 
+	0xf1, 0x56, 0xbc, 0x15, 0x6f, 0xc5, 0x77, 0xe3, 0xbb, 0xf1, 0xdd, 0xf8, 
+	0x6e, 0x7c, 0x37, 0xbe, 0x1b, 0xdf, 0x8d, 0xef, 0xc6, 0xdb, 0xf0, 0x36, 
+	0xbc, 0x0d, 0x6f, 0xc3, 0xdb, 0xf0, 0x36, 0xbc, 0x0d, 0x6f, 0xc3, 0xf7, 
+	0xe0, 0x7b, 0xf0, 0x3d, 0xf8, 0x1e, 0x7c, 0x0f, 0xbe, 0x07, 0xdf, 0x83, 
+	0xef, 0xc1, 0xf7, 0xe2, 0x7b, 0xf1, 0xbd, 0xf8, 0x5e, 0x7c, 0x2f, 0xbe, 
+	0x17, 0xdf, 0x8b, 0xef, 0xc5, 0xdb, 0xf1, 0x76, 0xbc, 0x1d, 0x6f, 0xc7, 
+	0xdb, 0xf1, 0x76, 0xbc, 0x1d, 0x6f, 0xc7, 0x3b, 0xf0, 0x0e, 0xbc, 0x03, 
+	0xef, 0xc0, 0x3b, 0xf0, 0x0e, 0xbc, 0x03, 0xef, 0xc0, 0x3b, 0xf1, 0x4e, 
+	0xbc, 0x13, 0xef, 0xc4, 0x3b, 0xf1, 0x4e, 0xbc, 0x13, 0xef, 0xc4, 0xf7, 
+	0xe1, 0xfb, 0xf0, 0x7d, 0xf8, 0x3e, 0x7c, 0x1f, 0xbe, 0x0f, 0xdf, 0x87, 
+	0xef, 0xc3, 0xbb, 0xf0, 0x2e, 0xbc, 0x0b, 0xef, 0xc2, 0xbb, 0xf0, 0x2e, 
+	0xbc, 0x0b, 0xef, 0xc2, 0xf7, 0xe3, 0xfb, 0xf1, 0xfd, 0xf8, 0x7e, 0x7c, 
+	0x3f, 0xbe, 0x1f, 0xdf, 0x8f, 0xef, 0xc7, 0xbb, 0xf1, 0x6e, 0xbc, 0x1b, 
+	0xef, 0xc6, 0xbb, 0xf1, 0x6e, 0xbc, 0x1b, 0xef, 0xc6, 0x7b, 0xf0, 0x1e, 
+	0xbc, 0x07, 0xef, 0xc1, 0x7b, 0xf0, 0x1e, 0xbc, 0x07, 0xef, 0xc1, 0x7b, 
+	0xf1, 0x5e, 0xbc, 0x17, 0xef, 0xc5, 0x7b, 0xf1, 0x5e, 0xbc, 0x17, 0xef, 
+	0xc5, 0x0f, 0xe0, 0x07, 0xf0, 0x03, 0xf8, 0x01, 0xfc, 0x00, 0x7e, 0x00, 
+	0x3f, 0x80, 0x1f, 0xc0, 0xfb, 0xf0, 0x3e, 0xbc, 0x0f, 0xef, 0xc3, 0xfb, 
+	0xf0, 0x3e, 0xbc, 0x0f, 0xef, 0xc3, 0x0f, 0xe2, 0x07, 0xf1, 0x83, 0xf8, 
+	0x41, 0xfc, 0x20, 0x7e, 0x10, 0x3f, 0x88, 0x1f, 0xc4, 0xfb, 0xf1, 0x7e, 
+	0xbc, 0x1f, 0xef, 0xc7, 0xfb, 0xf1, 0x7e, 0xbc, 0x1f, 0xef, 0xc7, 0x0f, 
+	0xe1, 0x87, 0xf0, 0x43, 0xf8, 0x21, 0xfc, 0x10, 0x7e, 0x08, 0x3f, 0x84, 
+	0x1f, 0xc2, 0x07, 0xf0, 0x01, 0x7c, 0x00, 0x1f, 0xc0, 0x07, 0xf0, 0x01, 
+	0x7c, 0x00, 0x1f, 0xc0, 0x0f, 0xe3, 0x87, 0xf1, 0xc3, 0xf8, 0x61, 0xfc, 
+	0x30, 0x7e, 0x18, 0x3f, 0x8c, 0x1f, 0xc6, 0x8f, 0xe0, 0x47, 0xf0, 0x23, 
+	0xf8, 0x11, 0xfc, 0x08, 0x7e, 0x04, 0x3f, 0x82, 0x1f, 0xc1, 0x07, 0xf1, 
+	0x41, 0x7c, 0x10, 0x1f, 0xc4, 0x07, 0xf1, 0x41, 0x7c, 0x10, 0x1f, 0xbc, 
+	0x67, 0xad, 0xf2, 0x0f, 0xe1, 0x43, 0xf8, 0x10, 0xc5, 0x10, 0x3e, 0x84, 
+	0x0f, 0xe1, 0x43, 0xf8, 0x51, 0xfc, 0x28, 0x7e, 0x14, 0x3f, 0x8a, 0x1f, 
+	0xc5, 0x8f, 0xe2, 0x47, 0xf1, 0xa3, 0xf8, 0x30, 0x3e, 0x8c, 0x0f, 0xe3, 
+	0xc3, 0xf8, 0x30, 0x3e, 0x8c, 0x0f, 0xe3, 0xc3, 0xf8, 0x31, 0xfc, 0x18, 
+	0x7e, 0x0c, 0x3f, 0x86, 0x1f, 0xc3, 0x8f, 0xe1, 0xc7, 0xf0, 0x63, 0xf8, 
+	0x08, 0x3e, 0x82, 0x8f, 0xe0, 0x23, 0xf8, 0x08, 0x3e, 0x82, 0x8f, 0xe0, 
+	0x23, 0xf8, 0x71, 0xfc, 0x38, 0x7e, 0x1c, 0x3f, 0x8e, 0x1f, 0xc7, 0x8f, 
+	0xe3, 0xc7, 0xf1, 0xe3, 0xf8, 0x09, 0xfc, 0x04, 0x7e, 0x02, 0x3f, 0x81, 
+	0x9f, 0xc0, 0x4f, 0xe0, 0x27, 0xf0, 0x13, 0xf8, 0x49, 0xfc, 0x24, 0x7e, 
+	0x12, 0x3f, 0x89, 0x9f, 0xc4, 0x4f, 0xe2, 0x27, 0xf1, 0x93, 0xf8, 0x28, 
+	0x3e, 0x8a, 0x8f, 0xe2, 0xa3, 0xf8, 0x28, 0x3e, 0x8a, 0x8f, 0xe2, 0xa3, 
+	0xf8, 0x29, 0xfc, 0x14, 0x7e, 0x0a, 0x3f, 0x85, 0x9f, 0xc2, 0x4f, 0xe1, 
+	0xa7, 0xf0, 0x53, 0xf8, 0x69, 0xfc, 0x34, 0x7e, 0x1a, 0x3f, 0x8d, 0x9f, 
+	0xc6, 0x4f, 0xe3, 0xa7, 0xf1, 0xd3, 0xf8, 0x19, 0xfc, 0x0c, 0x7e, 0x06, 
+	0x3f, 0x83, 0x9f, 0xc1, 0xcf, 0xe0, 0x67, 0xf0, 0x33, 0xf8, 0x59, 0xfc, 
+	0x2c, 0x7e, 0x16, 0x3f, 0x8b, 0x9f, 0xc5, 0xcf, 0xe2, 0x67, 0xf1, 0xb3, 
+	0xf8, 0x39, 0xfc, 0x1c, 0x7e, 0x0e, 0x3f, 0x87, 0x9f, 0xc3, 0xcf, 0xe1, 
+	0xe7, 0xf0, 0x73, 0xf8, 0x79, 0xfc, 0x3c, 0x7e, 0x1e, 0x3f, 0x8f, 0x9f, 
+	0xc7, 0xcf, 0xe3, 0xe7, 0xf1, 0xf3, 0xf8, 0x05, 0xfc, 0x02, 0x7e, 0x01, 
+	0xbf, 0x80, 0x5f, 0xc0, 0x2f, 0xe0, 0x17, 0xf0, 0x0b, 0xf8, 0x18, 0x3e, 
+	0x86, 0x8f, 0xe1, 0x63, 0xf8, 0x18, 0x3e, 0x86, 0x8f, 0xe1, 0x63, 0xf8, 
+	0x45, 0xfc, 0x22, 0x7e, 0x11, 0xbf, 0x88, 0x5f, 0xc4, 0x2f, 0xe2, 0x17, 
+	0xf1, 0x8b, 0xf8, 0x25, 0xfc, 0x12, 0x7e, 0x09, 0xbf, 0x84, 0x5f, 0xc2, 
+	0x2f, 0xe1, 0x97, 0xf0, 0x4b, 0xf8, 0x65, 0xfc, 0x32, 0x7e, 0x19, 0xbf, 
+	0x8c, 0x5f, 0xc6, 0x2f, 0xe3, 0x97, 0xf1, 0xcb, 0xf8, 0x15, 0xfc, 0x0a, 
+	0x7e, 0x05, 0xbf, 0x82, 0x5f, 0xc1, 0xaf, 0xe0, 0x57, 0xf0, 0x2b, 0xf8, 
+	0x55, 0xfc, 0x2a, 0x7e, 0x15, 0xbf, 0x8a, 0x5f, 0xc5, 0xaf, 0xe2, 0x57, 
+	0xf1, 0xab, 0xf8, 0x35, 0xfc, 0x1a, 0x7e, 0x0d, 0xbf, 0x86, 0x5f, 0xc3, 
+	0xaf, 0xe1, 0xd7, 0xf0, 0x6b, 0xf8, 0x75, 0xfc, 0x3a, 0x7e, 0x1d, 0xbf, 
+	0x8e, 0x5f, 0xc7, 0xaf, 0xe3, 0xd7, 0xf1, 0xeb, 0xf8, 0x38, 0x3e, 0x8e, 
+	0x8f, 0xe3, 0xe3, 0xf8, 0x38, 0x3e, 0x8e, 0x8f, 0xe3, 0xe3, 0xf8, 0x0d, 
+	0xfc, 0x06, 0x7e, 0x03, 0xbf, 0x81, 0xdf, 0xc0, 0x6f, 0xe0, 0x37, 0xf0, 
+	0x1b, 0xf8, 0x4d, 0xfc, 0x26, 0x7e, 0x13, 0xbf, 0x89, 0xdf, 0xc4, 0x6f, 
+	0xe2, 0x37, 0xf1, 0x9b, 0xf8, 0x2d, 0xfc, 0x16, 0x7e, 0x0b, 0xbf, 0x85, 
+	0xdf, 0xc2, 0x6f, 0xe1, 0xb7, 0xf0, 0x5b, 0xf8, 0x04, 0x3e, 0x81, 0x4f, 
+	0xe0, 0x13, 0xf8, 0x04, 0x3e, 0x81, 0x4f, 0xe0, 0x13, 0xf8, 0x6d, 0xfc, 
+	0x36, 0x7e, 0x1b, 0xbf, 0x8d, 0xdf, 0xc6, 0x6f, 0xe3, 0xb7, 0xf1, 0xdb, 
+	0xf8, 0x24, 0x3e, 0x89, 0x4f, 0xe2, 0x93, 0xf8, 0x24, 0x3e, 0x89, 0x4f, 
+	0xe2, 0x93, 0xf8, 0x14, 0x3e, 0x85, 0x4f, 0xe1, 0x53, 0xf8, 0x14, 0x3e, 
+	0x85, 0x4f, 0xe1, 0x53, 0xa6, 0xdf, 0x33, 0xb7, 0xf0, 0xcd, 0x8d, 0xfc, 
+	0x59, 0x6b, 0x63, 0xde, 0xbc, 0xd8, 0x67, 0xfd, 0x1b, 0xe6, 0x86, 0xd5, 
+	0x6c, 0xac, 0x25, 0x19, 0x59, 0xf3, 0xcd, 0x4a, 0x0d, 0x7f, 0xc3, 0x0d, 
+	0x96, 0xa2, 0xc6, 0xcb, 0xdc, 0xbe, 0xe3, 0xdf, 0x79, 0x70, 0x47, 0xcd, 
+	0x5f, 0xcc, 0x25, 0xe4, 0x07, 0xf3, 0xcf, 0xe5, 0xdb, 0x62, 0xae, 0x9c, 
+	0xaf, 0xe7, 0x86, 0x35, 0xb7, 0xc4, 0xcc, 0x4f, 0xe3, 0xeb, 0xd4, 0xae, 
+	0xc5, 0xef, 0xf7, 0xed, 0x91, 0x08, 0x8c, 0xa8, 0xcb, 0x96, 0xac, 0x72, 
+	0xcc, 0xe6, 0x72, 0xfb, 0xea, 0x6a, 0xff, 0xfd, 0x0e, 0x7f, 0x0b, 0x5c, 
+	0x0c, 0x7f, 0x6d, 0xf3, 0xb7, 0xc0, 0x73, 0x04, 0x76, 0x7c, 0x98, 0xcd, 
+	0x6e, 0xfd, 0x2d, 0xdf, 0x5d, 0x33, 0xd6, 0x82, 0xee, 0x59, 0xee, 0xff, 
+	0x53, 0xea, 0x37, 0xa8, 0xdf, 0xf1, 0x2a, 0x23, 0xcc, 0xa3, 0x0c, 0x36, 
+	0x38, 0x0c, 0x56, 0x2e, 0x0c, 0x16, 0x24, 0xc6, 0x27, 0xa9, 0xff, 0x9c, 
+	0xfa, 0xbb, 0xd4, 0x3f, 0xf1, 0x2a, 0x1b, 0x1b, 0xf9, 0x36, 0x56, 0xe8, 
+	0x6d, 0x84, 0xb7, 0x8d, 0x0f, 0xaa, 0xed, 0x05, 0xea, 0x57, 0xa9, 0xdf, 
+	0xa4, 0xbe, 0xef, 0xb5, 0x36, 0xa2, 0xad, 0x3d, 0x2a, 0x4f, 0xd4, 0xec, 
+	0x6f, 0x99, 0xd3, 0xb2, 0xdd, 0x77, 0xdb, 0xdc, 0x2f, 0x10, 0xae, 0xde, 
+	0x52, 0xb6, 0x67, 0x3c, 0x2a, 0xea, 0x99, 0x51, 0x65, 0xb3, 0xe5, 0x28, 
+	0xc3, 0xe6, 0x51, 0x71, 0xb6, 0x4e, 0x65, 0xd8, 0x3d, 0xbe, 0xfd, 0x0a, 
+	0x2e, 0x35, 0xf3, 0x80, 0x87, 0xe3, 0x36, 0xdb, 0x8c, 0x6f, 0xbb, 0xdf, 
+	0x65, 0xbe, 0xb5, 0xcf, 0x78, 0xf1, 0x97, 0xb9, 0x6f, 0x48, 0x19, 0xcf, 
+	0x7a, 0x55, 0xec, 0xb3, 0x9f, 0x57, 0x2e, 0xbb, 0xd7, 0xb7, 0xdf, 0xc0, 
+	0x50, 0xf7, 0x71, 0xa5, 0x22, 0x8c, 0x62, 0x65, 0x33, 0x5e, 0x57, 0x86, 
+	0xf1, 0x43, 0x15, 0x6b, 0xfc, 0x98, 0x81, 0xee, 0xcc, 0xce, 0xce, 0xbe, 
+	0x6b, 0xbc, 0x3a, 0x3b, 0xab, 0x16, 0xb9, 0xe0, 0xff, 0xa3, 0x7e, 0x16, 
+	0xc2, 0x8d, 0x39, 0xff, 0xa5, 0x1a, 0x0c, 0xe1, 0xb6, 0x80, 0xbf, 0xe7, 
+	0xcc, 0xfa, 0x3b, 0x9f, 0x87, 0xf9, 0x25, 0x69, 0xee, 0x9d, 0xb5, 0x86, 
+	0xff, 0xb9, 0xea, 0x08, 0x31, 0xbc, 0x6b, 0xce, 0x3f, 0x50, 0xe5, 0x21, 
+	0xdc, 0x3d, 0xe7, 0xbf, 0x32, 0x42, 0x8d, 0x5f, 0xce, 0x9c, 0xff, 0x22, 
+	0xe4, 0xf0, 0x9e, 0x39, 0x7f, 0xd7, 0xf8, 0xcc, 0xc3, 0xa7, 0xdf, 0x88, 
+	0xfb, 0x68, 0x4f, 0xbf, 0x5a, 0x6a, 0xfa, 0x3b, 0x1e, 0x3a, 0xfd, 0xb3, 
+	0xea, 0xcd, 0x05, 0x7e, 0x57, 0x4c, 0x7f, 0x68, 0x37, 0x96, 0x70, 0xdb, 
+	0x12, 0xee, 0x58, 0xc2, 0x5d, 0x4b, 0xb8, 0x7b, 0x09, 0xcf, 0x59, 0xc2, 
+	0x83, 0xde, 0x7f, 0x5b, 0xdc, 0x47, 0xfa, 0xfd, 0x7f, 0xde, 0xf1, 0xf0, 
+	0xf7, 0xff, 0x0f, 0xc3, 0xde, 0x7c, 0xf8, 0xfb, 0x1f, 0x72, 0xfc, 0x83, 
+	0xe7, 0xff, 0x9f, 0x2d, 0xf1, 0xf9, 0x2f, 0x5f, 0xce, 0xf4, 0xcf, 0x06, 
+	0xa6, 0x5f, 0xfd, 0xc6, 0x3e, 0xff, 0x0f, 0x9f, 0xfe, 0xa5, 0xde, 0xff, 
+	0xdf, 0xf5, 0xf9, 0x7f, 0x65, 0xfa, 0x7f, 0x87, 0xa7, 0x5f, 0xf9, 0xf7, 
+	0xfc, 0x31, 0xc2, 0xf1, 0xfe, 0xd5, 0x2a, 0x87, 0x39, 0xd4, 0xc2, 0xe6, 
+	0xbb, 0x98, 0x7b, 0xe0, 0x72, 0xfd, 0xcf, 0x3c, 0xb7, 0x2e, 0x13, 0x3e, 
+	0xeb, 0xf3, 0x29, 0x7f, 0x5f, 0xff, 0xe0, 0xb0, 0x53, 0xef, 0x5b, 0xcd, 
+	0xbc, 0x14, 0x7f, 0x4d, 0xa9, 0x12, 0xd6, 0xcd, 0x4a, 0xd2, 0xfd, 0xcb, 
+	0xc3, 0xf0, 0xa0, 0x57, 0x7a, 0xa5, 0x5f, 0xe9, 0x97, 0xd3, 0x67, 0xc5, 
+	0xf9, 0xe6, 0xc1, 0x95, 0x7e, 0xa5, 0x5f, 0xe9, 0x57, 0xfa, 0x95, 0x7e, 
+	0xa5, 0x5f, 0xe9, 0x57, 0xfa, 0xdf, 0x56, 0x1f, 0xb9, 0xce, 0x3a, 0xc8, 
+	0x3d, 0xb7, 0x4f, 0xd2, 0x1e, 0xb4, 0x0f, 0xd3, 0x10, 0xfb, 0x2f, 0x03, 
+	0xb7, 0xed, 0x8f, 0x71, 0xbf, 0x23, 0xe8, 0x7e, 0x73, 0x95, 0x7b, 0xd6, 
+	0xda, 0xbf, 0x3b, 0xf7, 0x38, 0x23, 0xe8, 0xef, 0x98, 0x7f, 0x7f, 0xda, 
+	0xd7, 0xbc, 0x6a, 0xda, 0xda, 0xa7, 0x1a, 0xc1, 0x63, 0xc3, 0xcd, 0xa3, 
+	0x14, 0xcf, 0xfb, 0x4f, 0x0e, 0x7b, 0xc6, 0xdf, 0x2f, 0xb7, 0x5e, 0x64, 
+	0x3f, 0x67, 0xe1, 0x3b, 0x56, 0x6b, 0xbb, 0x63, 0x35, 0x73, 0x9f, 0x6c, 
+	0x7c, 0x86, 0xea, 0xae, 0xb4, 0xb6, 0x5c, 0x72, 0xc3, 0x9a, 0xac, 0x51, 
+	0x7d, 0xd4, 0xc7, 0x3d, 0x30, 0x8d, 0x4a, 0xec, 0x43, 0x76, 0xfa, 0x5f, 
+	0x1f, 0x87, 0x7f, 0xdb, 0xc2, 0x58, 0x66, 0xb3, 0x5b, 0x07, 0xd5, 0x82, 
+	0xfb, 0xc0, 0xee, 0xe5, 0x45, 0x9a, 0xfd, 0xbe, 0x2b, 0xc4, 0x5e, 0x92, 
+	0x0f, 0xab, 0xcd, 0x8a, 0x36, 0x25, 0xea, 0x3a, 0xff, 0x38, 0xd6, 0x3f, 
+	0xa4, 0x99, 0x7b, 0x8f, 0x55, 0x42, 0xaa, 0x52, 0x79, 0xb4, 0x4a, 0x5a, 
+	0x42, 0x32, 0xb7, 0x69, 0x95, 0x34, 0x9b, 0xdb, 0xda, 0x0e, 0x75, 0xd3, 
+	0x72, 0x68, 0x15, 0x34, 0x8f, 0xfb, 0xc1, 0xfd, 0x34, 0x09, 0x49, 0x0c, 
+	0x43, 0xab, 0xa4, 0x35, 0x26, 0xc9, 0x1d, 0x35, 0x9f, 0xe2, 0x7d, 0xfb, 
+	0x54, 0x91, 0x7f, 0x9f, 0x7f, 0xb5, 0x39, 0xaf, 0x9a, 0x6d, 0x76, 0x89, 
+	0xcb, 0x7d, 0x35, 0xf3, 0xd0, 0xc7, 0xbc, 0xbf, 0x84, 0x2f, 0x75, 0x51, 
+	0xaa, 0xd6, 0xed, 0xdf, 0x0a, 0x77, 0xf9, 0xe7, 0xb1, 0xc0, 0x7c, 0xe5, 
+	0xb0, 0xb6, 0x9e, 0xd3, 0xb8, 0xdf, 0x65, 0xb7, 0x5a, 0x60, 0xc6, 0x70, 
+	0xcd, 0x37, 0x23, 0xb8, 0x56, 0xcb, 0x68, 0x05, 0x66, 0x6f, 0x9e, 0xfd, 
+	0x63, 0x9e, 0xc1, 0xc8, 0x76, 0xb3, 0xf1, 0x71, 0xda, 0xc7, 0x20, 0xa7, 
+	0x55, 0x9b, 0xf3, 0xbd, 0x3d, 0xa8, 0x45, 0x7f, 0x62, 0xfe, 0xb6, 0x5a, 
+	0x46, 0xf3, 0x0d, 0x9f, 0x68, 0xdd, 0x76, 0x3b, 0x7c, 0xcd, 0x3d, 0xe2, 
+	0xf1, 0x35, 0x6b, 0x7a, 0xd3, 0xc5, 0x67, 0x71, 0xe1, 0x8e, 0xb7, 0xa0, 
+	0x8b, 0x23, 0xc4, 0x7d, 0x0d, 0x21, 0xee, 0xf3, 0x0f, 0x3b, 0xe1, 0x3f, 
+	0x36, 0x62, 0xce, 0x7f, 0x5f, 0x52, 0xd6, 0x99, 0x95, 0x61, 0xfe, 0xe3, 
+	0x4d, 0x66, 0xbf, 0x9f, 0xe5, 0xc5, 0x7f, 0x29, 0xff, 0x19, 0x07, 0x41, 
+	0xc7, 0x88, 0x16, 0x6b, 0x72, 0x39, 0x11, 0xb8, 0x6d, 0xbe, 0x9e, 0x51, 
+	0xfe, 0xe7, 0x7d, 0x94, 0xc7, 0x2c, 0x76, 0x5b, 0xcc, 0x22, 0xd6, 0x65, 
+	0xf5, 0xec, 0xc2, 0xab, 0xb5, 0x8c, 0xf3, 0x32, 0x85, 0xd6, 0xd5, 0xeb, 
+	0xbf, 0x7a, 0xfc, 0xd7, 0xf9, 0xe5, 0xb6, 0x31, 0x6e, 0xb5, 0xb9, 0x45, 
+	0xc8, 0x78, 0x88, 0x65, 0x8a, 0xed, 0x81, 0x97, 0xf8, 0xf1, 0x6c, 0xb1, 
+	0xdb, 0xcb, 0x1d, 0x26, 0x31, 0xb6, 0xd5, 0xba, 0xaa, 0xcf, 0x5a, 0x57, 
+	0xa3, 0xc0, 0xba, 0xce, 0x2f, 0x0e, 0xac, 0x6b, 0x8e, 0x61, 0xf0, 0xcf, 
+	0x6d, 0x98, 0x97, 0xc0, 0xed, 0x50, 0xf7, 0x99, 0x17, 0xff, 0x73, 0x3b, 
+	0x6d, 0xaa, 0xc1, 0x11, 0xdc, 0xac, 0x7d, 0x55, 0xb6, 0x1f, 0x58, 0x6d, 
+	0xee, 0x25, 0xbc, 0xfb, 0x14, 0x5e, 0x2f, 0xdf, 0x74, 0x2c, 0x67, 0x9c, 
+	0xe7, 0xc7, 0x71, 0xee, 0xf9, 0x65, 0xaf, 0x16, 0xb9, 0x3f, 0xd4, 0xf8, 
+	0x38, 0x83, 0x9e, 0xef, 0x69, 0x64, 0x83, 0xdd, 0xd6, 0xd3, 0xd3, 0x63, 
+	0xb6, 0xf9, 0xd7, 0xef, 0x81, 0x76, 0x37, 0xe8, 0x33, 0x16, 0x68, 0x4b, 
+	0x65, 0xee, 0x62, 0xaf, 0xa9, 0xf3, 0x31, 0x6d, 0xa9, 0x79, 0xed, 0x89, 
+	0x86, 0x59, 0x6c, 0xde, 0x5c, 0xce, 0x3c, 0xb9, 0x8c, 0x69, 0x0e, 0x7e, 
+	0xdd, 0x1e, 0x76, 0x3b, 0xd0, 0x9e, 0x68, 0x98, 0xb9, 0xf9, 0xd8, 0x9c, 
+	0x62, 0x73, 0x64, 0x82, 0x3e, 0x8b, 0xa1, 0xec, 0x09, 0x5f, 0x0b, 0x23, 
+	0x68, 0x1c, 0xe4, 0xb8, 0x38, 0x83, 0x72, 0xf3, 0x51, 0x6c, 0xb1, 0xf7, 
+	0x72, 0xf9, 0xc3, 0xb4, 0xf8, 0xaf, 0xd3, 0xd6, 0x95, 0x29, 0xf0, 0x5d, 
+	0x1d, 0x36, 0xeb, 0xca, 0x23, 0x7c, 0xd7, 0x04, 0x65, 0x5d, 0x5d, 0xfe, 
+	0xab, 0xef, 0x51, 0x86, 0x3b, 0xc7, 0x37, 0xd9, 0x81, 0xdb, 0xa1, 0xee, 
+	0x33, 0xcc, 0x2f, 0x58, 0x04, 0xe6, 0x0b, 0x23, 0xff, 0xe9, 0x36, 0x5f, 
+	0x38, 0x56, 0xfa, 0xf7, 0x99, 0x87, 0x07, 0x1d, 0x25, 0x5b, 0x90, 0xc1, 
+	0x81, 0xf3, 0x28, 0xcc, 0xb3, 0x81, 0x83, 0xce, 0xa5, 0x30, 0xcf, 0x0e, 
+	0xde, 0x20, 0x3e, 0xa7, 0x81, 0x65, 0x89, 0x33, 0xe8, 0xf5, 0x0a, 0x64, 
+	0x7b, 0x96, 0xef, 0xef, 0xf9, 0xee, 0xe5, 0x4f, 0xd9, 0x63, 0x79, 0x34, 
+	0x2b, 0x7c, 0x61, 0xdc, 0xed, 0x64, 0x54, 0xc2, 0x4b, 0xf9, 0xcb, 0x3c, 
+	0x5d, 0x44, 0x0d, 0x09, 0x48, 0x4c, 0x47, 0x35, 0x93, 0xd2, 0x7b, 0x95, 
+	0x8a, 0x61, 0x11, 0x11, 0x7b, 0x88, 0xb5, 0xc6, 0x61, 0x16, 0x9a, 0xa7, 
+	0x58, 0x8d, 0x1f, 0x63, 0xe5, 0xef, 0x3a, 0x4b, 0xd3, 0x49, 0xa5, 0x92, 
+	0x7e, 0x4f, 0xa9, 0xe4, 0x4f, 0x2b, 0x95, 0xf2, 0x39, 0xa5, 0x52, 0xbf, 
+	0xc0, 0xea, 0xd3, 0x1f, 0xb3, 0x06, 0xf1, 0xb2, 0x52, 0x19, 0xaf, 0x2a, 
+	0x95, 0xf9, 0x0d, 0xfe, 0xe2, 0xb7, 0x94, 0x5a, 0xf5, 0x1d, 0xa5, 0xb2, 
+	0xbf, 0x4f, 0x78, 0xbe, 0xcd, 0x1f, 0xfe, 0x57, 0x73, 0x1c, 0xcd, 0xb3, 
+	0xe2, 0x57, 0xf9, 0xc7, 0xc3, 0xab, 0xec, 0xac, 0x8e, 0x3a, 0x52, 0xbc, 
+	0x2a, 0x8c, 0xbb, 0x9d, 0x85, 0x5e, 0x15, 0xce, 0x26, 0x97, 0xab, 0xca, 
+	0xab, 0x22, 0x6a, 0x19, 0x8f, 0x26, 0xaf, 0x8a, 0x6a, 0x63, 0x3c, 0xba, 
+	0xbc, 0x2a, 0xa6, 0x9f, 0xf1, 0x38, 0xea, 0x55, 0x71, 0x8c, 0x83, 0x7b, 
+	0xcc, 0xab, 0xe2, 0x89, 0xd0, 0x84, 0x29, 0xaf, 0x4a, 0x7c, 0x8e, 0xf1, 
+	0x78, 0xc1, 0xab, 0x92, 0x5f, 0x64, 0x3c, 0xbe, 0xec, 0x55, 0xa9, 0x5f, 
+	0x65, 0x3c, 0x5e, 0xf1, 0xaa, 0xf4, 0xd7, 0x18, 0x8f, 0xbf, 0xf5, 0xaa, 
+	0xcc, 0x37, 0x18, 0x8f, 0xef, 0xb1, 0x4d, 0xf3, 0xf6, 0xd3, 0x58, 0x77, 
+	0x37, 0xcf, 0x48, 0x2f, 0xf3, 0xbf, 0xf6, 0x41, 0xf7, 0x07, 0x1f, 0x67, 
+	0xb1, 0xa5, 0xcb, 0xe3, 0x25, 0x8f, 0x77, 0x3c, 0xc5, 0x7c, 0xbe, 0x95, 
+	0xfd, 0xff, 0x2b, 0xfd, 0x32, 0xfa, 0x1c, 0xb7, 0x61, 0xcd, 0x48, 0xd3, 
+	0x81, 0x45, 0xc9, 0xdc, 0xf2, 0x24, 0x29, 0xd2, 0x7c, 0xcc, 0xb4, 0xc8, 
+	0xae, 0x69, 0x87, 0xa8, 0x9d, 0xa2, 0x16, 0xdb, 0xc0, 0xd3, 0x91, 0xa2, 
+	0x8e, 0x16, 0x75, 0xac, 0xa8, 0xc5, 0x16, 0xe4, 0x74, 0x82, 0xa8, 0xc5, 
+	0x16, 0xe4, 0x74, 0x8a, 0xa8, 0xd3, 0x44, 0x9d, 0x21, 0xea, 0x2c, 0x51, 
+	0x67, 0x8b, 0x5a, 0x6c, 0x98, 0x4c, 0xe7, 0x89, 0xba, 0x40, 0xd4, 0x45, 
+	0xa2, 0x2e, 0x16, 0x75, 0xa9, 0xa8, 0xcb, 0x44, 0xbd, 0x5e, 0xd4, 0x15, 
+	0xa2, 0xae, 0x14, 0x75, 0x95, 0xa8, 0xab, 0x45, 0x5d, 0x23, 0xea, 0xad, 
+	0xa2, 0xae, 0x15, 0x75, 0x9d, 0xa8, 0x3d, 0xa2, 0x6e, 0x14, 0xf5, 0x0e, 
+	0x51, 0x37, 0x8b, 0xba, 0x45, 0xd4, 0xbb, 0x45, 0xbd, 0x47, 0xd4, 0xed, 
+	0xa2, 0xee, 0x14, 0x75, 0x97, 0xa8, 0xbb, 0x45, 0xdd, 0x2b, 0xea, 0x3e, 
+	0x51, 0xf7, 0x8b, 0x7a, 0x40, 0xd4, 0x47, 0x44, 0x3d, 0x24, 0xea, 0x61, 
+	0x51, 0x8f, 0x88, 0xfa, 0x84, 0xa8, 0x47, 0x45, 0x7d, 0x5a, 0xd4, 0x67, 
+	0x45, 0x7d, 0x5e, 0xd4, 0x63, 0xa2, 0xbe, 0x24, 0xea, 0x2b, 0xa2, 0xbe, 
+	0x26, 0x6a, 0xb1, 0xbd, 0x38, 0x7d, 0x53, 0xd4, 0x13, 0xa2, 0x9e, 0x14, 
+	0xb5, 0x57, 0xd4, 0xcf, 0x8a, 0xfa, 0xe3, 0xa2, 0xfe, 0x84, 0xa8, 0x3f, 
+	0x29, 0xea, 0xe7, 0x45, 0xfd, 0x69, 0x51, 0xbf, 0x20, 0xea, 0x69, 0x51, 
+	0x7f, 0x56, 0xd4, 0x7f, 0x20, 0xea, 0x17, 0x45, 0xfd, 0x79, 0x51, 0x7f, 
+	0x41, 0xd4, 0x5f, 0x12, 0xf5, 0x1f, 0x89, 0xfa, 0x25, 0x51, 0xff, 0x89, 
+	0xa8, 0xbf, 0x22, 0xea, 0x3f, 0x13, 0xf5, 0xcb, 0xa2, 0xfe, 0x0b, 0x51, 
+	0xbf, 0x22, 0xea, 0xbf, 0x14, 0xf5, 0xd7, 0x45, 0xfd, 0x57, 0xa2, 0x7e, 
+	0x4d, 0xd4, 0xdf, 0x10, 0xf5, 0xeb, 0xa2, 0xfe, 0x1b, 0x51, 0x7f, 0x53, 
+	0xd4, 0xdf, 0x16, 0xf5, 0x8c, 0xa8, 0xff, 0x5e, 0xd4, 0xdf, 0x11, 0xf5, 
+	0x3f, 0x8a, 0xfa, 0x8e, 0xa8, 0xbf, 0x27, 0x6a, 0xb1, 0x7d, 0x3e, 0xfd, 
+	0x03, 0x51, 0xbf, 0x25, 0xea, 0xb7, 0x45, 0xfd, 0xcf, 0xa2, 0xfe, 0x17, 
+	0x51, 0xff, 0x50, 0xd4, 0xff, 0x26, 0xea, 0x7f, 0x17, 0xf5, 0x7f, 0x88, 
+	0xfa, 0x9e, 0xa8, 0xff, 0x53, 0xd4, 0xef, 0x88, 0xfa, 0x47, 0xa2, 0xfe, 
+	0xb1, 0xa8, 0x7f, 0x22, 0xea, 0xff, 0x16, 0xf5, 0x4f, 0x45, 0x7d, 0x5f, 
+	0xd4, 0x3f, 0x17, 0xf5, 0x7b, 0xa2, 0xfe, 0xa5, 0xa8, 0xdf, 0x17, 0xf5, 
+	0x07, 0xa2, 0xfe, 0x5f, 0x51, 0xff, 0x7a, 0x61, 0xad, 0xc5, 0xa6, 0xaa, 
+	0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 
+	0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 
+	0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 
+	0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 
+	0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 
+	0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 
+	0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 
+	0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 
+	0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 
+	0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 
+	0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 
+	0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 
+	0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 
+	0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 
+	0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 
+	0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 
+	0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 
+	0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 
+	0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 
+	0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 
+	0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 
+	0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 
+	0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 
+	0xf9, 0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 
+	0xaf, 0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 
+	0x45, 0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 
+	0xfe, 0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 
+	0x6b, 0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0x6b, 
+	0x91, 0xff, 0x5a, 0xe4, 0xbf, 0x16, 0xf9, 0xaf, 0x45, 0xfe, 0xeb, 0x5f, 
+	0x2f, 0x7d, 0x2c, 0xd4, 0x3a, 0x07, 0xf8, 0x51, 0x1f, 0xa7, 0x94, 0xfd, 
+	0x8b, 0xd6, 0x0f, 0x7e, 0xfc, 0x76, 0xcf, 0x85, 0x58, 0x7a, 0xfc, 0x18, 
+	0xe6, 0xdb, 0xdf, 0x0c, 0xe4, 0x7b, 0xd8, 0x87, 0x50, 0x9b, 0xdf, 0xf6, 
+	0x8a, 0x9e, 0x3b, 0xac, 0xe4, 0x3f, 0xbe, 0xfe, 0x88, 0xfb, 0x6e, 0xed, 
+	0xe2, 0x35, 0x91, 0xfb, 0x6c, 0x1d, 0xfe, 0x7d, 0xc4, 0xe6, 0x73, 0x66, 
+	0xfa, 0x4e, 0xcd, 0x30, 0xec, 0x33, 0xca, 0x78, 0xce, 0xff, 0x7d, 0xb6, 
+	0xcf, 0x30, 0x54, 0xc2, 0x8c, 0xb2, 0xbf, 0xe8, 0x55, 0x8e, 0x0c, 0x8f, 
+	0x72, 0xb0, 0xd8, 0x0b, 0xcb, 0x9d, 0x51, 0x61, 0x5f, 0xf5, 0x2a, 0x67, 
+	0x89, 0x47, 0x39, 0xbf, 0xa6, 0x54, 0x78, 0xc5, 0x8c, 0x0a, 0x7f, 0xcd, 
+	0xab, 0x5c, 0x35, 0x1e, 0xe5, 0x62, 0x31, 0x11, 0x51, 0x3f, 0xa3, 0x22, 
+	0xde, 0xf0, 0xaa, 0xc8, 0x5d, 0x1e, 0x15, 0xf9, 0x7d, 0xa5, 0xa2, 0xda, 
+	0x67, 0x54, 0xd4, 0xdb, 0x5e, 0x15, 0xdd, 0xeb, 0x51, 0xd1, 0x7c, 0xac, 
+	0x62, 0xcc, 0x2f, 0x2f, 0x9b, 0xdf, 0xaf, 0x7b, 0x1a, 0xc7, 0xa4, 0xc2, 
+	0xcc, 0x9d, 0xcc, 0xff, 0x47, 0x6f, 0xde, 0xce, 0x0e, 0x71, 0x0e, 0x7a, 
+	0x73, 0xd0, 0x6b, 0xa7, 0xfc, 0xfb, 0xa8, 0xdf, 0x53, 0x0f, 0x1e, 0x83, 
+	0x7e, 0xcc, 0xf3, 0xd2, 0x57, 0xf6, 0x03, 0xae, 0xf4, 0x4f, 0xde, 0x2f, 
+	0xbd, 0xcc, 0x49, 0x0f, 0x9e, 0x2f, 0x83, 0x3f, 0xed, 0x59, 0x1f, 0xd6, 
+	0xf9, 0x62, 0xf6, 0xcf, 0x3d, 0xb7, 0x60, 0x4c, 0x44, 0x6d, 0x2e, 0x3f, 
+	0x02, 0xc7, 0x97, 0x62, 0xfd, 0x6d, 0xfe, 0xb1, 0x2c, 0x9f, 0xcc, 0x66, 
+	0x84, 0x5e, 0x46, 0x05, 0x8e, 0xb9, 0x05, 0xbe, 0x9f, 0x3b, 0xbf, 0x1c, 
+	0x9c, 0x1f, 0xb7, 0xc5, 0x96, 0x5b, 0xfe, 0xef, 0xf1, 0x9a, 0x4f, 0x6a, 
+	0xfe, 0x78, 0x91, 0xf9, 0x74, 0xe6, 0x8f, 0x94, 0x98, 0xab, 0xff, 0xe6, 
+	0x8f, 0x11, 0x98, 0x5f, 0x40, 0xff, 0x18, 0xbd, 0xb9, 0xfa, 0xf7, 0x15, 
+	0xfa, 0xbf, 0xa6, 0xff, 0x07, 0x7a, 0x33, 0xfe, 0x7f, 0x44, 0xff, 0x2b, 
+	0xf3, 0x53, 0xef, 0x55, 0x06, 0x9b, 0x7f, 0x46, 0x31, 0xfd, 0x16, 0xfa, 
+	0x56, 0x7a, 0x56, 0xff, 0x8d, 0xd3, 0xf4, 0xb7, 0xe8, 0x7f, 0x9f, 0x9e, 
+	0xd5, 0x3f, 0xe3, 0x15, 0xfa, 0x6f, 0xd1, 0xff, 0x13, 0x3d, 0xf1, 0x6f, 
+	0xfc, 0xd4, 0xeb, 0xfb, 0xda, 0xb4, 0xef, 0x47, 0xb5, 0x9e, 0xf6, 0x79, 
+	0x58, 0xe6, 0xd9, 0x4f, 0xbe, 0x1f, 0xd7, 0x0a, 0xf5, 0xbd, 0x1a, 0x73, 
+	0xba, 0x83, 0xb7, 0xd7, 0xcc, 0xe3, 0x7c, 0xe6, 0xf6, 0xa5, 0xf9, 0x6b, 
+	0x49, 0xe6, 0x76, 0xa5, 0xf9, 0xab, 0x47, 0xe6, 0x2f, 0xd7, 0x98, 0xdb, 
+	0x70, 0xe6, 0x2f, 0x10, 0x05, 0xb6, 0x1d, 0x03, 0xeb, 0x10, 0xe6, 0xaf, 
+	0x1a, 0x95, 0x86, 0xf8, 0xbb, 0x0b, 0x96, 0x87, 0x8f, 0x7b, 0x4c, 0xe9, 
+	0xee, 0x5d, 0x1b, 0xcd, 0xbc, 0x3c, 0x59, 0xff, 0x08, 0x39, 0x6c, 0x8e, 
+	0xa5, 0xa1, 0xaa, 0x5c, 0xe1, 0x3c, 0xfc, 0xbb, 0xd6, 0x6c, 0xb4, 0xe0, 
+	0xbb, 0x41, 0x2a, 0x68, 0xde, 0x71, 0x8e, 0xf5, 0xb9, 0x6b, 0x57, 0x96, 
+	0x35, 0x2b, 0xfd, 0x6f, 0x7e, 0x59, 0xfd, 0x78, 0xeb, 0xb9, 0xf6, 0xfc, 
+	0x44, 0x7b, 0xa2, 0xf9, 0x9f, 0xdd, 0x9e, 0xff, 0xd2, 0xd7, 0xa7, 0x9b, 
+	0x6c, 0x2c, 0xc2, 0x9c, 0x0e, 0xa7, 0x43, 0xde, 0x9f, 0x18, 0x74, 0x31, 
+	0x6b, 0xbb, 0x31, 0x77, 0xfa, 0x4c, 0xe5, 0x87, 0xb1, 0x9e, 0xac, 0x8a, 
+	0x0a, 0xad, 0x6d, 0xdc, 0xc5, 0x7a, 0x96, 0xf8, 0x46, 0x0a, 0x0b, 0xd6, 
+	0xa5, 0x1e, 0x77, 0xc9, 0x77, 0x66, 0xc2, 0xbb, 0xf3, 0xeb, 0xfd, 0x8f, 
+	0xda, 0x07, 0x2e, 0x8f, 0x3b, 0xdc, 0xca, 0xf0, 0x1f, 0xc5, 0xe1, 0x7b, 
+	0xba, 0x69, 0xbe, 0x73, 0xc9, 0x7a, 0x7a, 0xee, 0x87, 0xa8, 0xe7, 0xd7, 
+	0x7e, 0x3a, 0x7d, 0xfb, 0x6e, 0x67, 0x7f, 0x31, 0xe8, 0xfb, 0x0c, 0xdd, 
+	0xf7, 0xfd, 0x70, 0xa8, 0x79, 0x79, 0x49, 0x2d, 0xfc, 0x99, 0x8f, 0xc0, 
+	0xe6, 0x51, 0xf0, 0xc5, 0xf3, 0xc0, 0x5a, 0xfe, 0xec, 0xc0, 0x62, 0xcf, 
+	0x25, 0x4f, 0xc3, 0x16, 0xbb, 0x74, 0x95, 0xd8, 0xc5, 0xc5, 0x27, 0xef, 
+	0xff, 0x01, 0x9b, 0x1c, 0xa6, 0xe5, 0x3c, 0x55, 0x00, 0x00, 0x00, 0x00, };
 
 static const u8 csem_int_table_data_e2[] = {
 	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xfb, 0xc8, 
@@ -25613,20 +23426,25 @@ static const u8 xsem_pram_data_e2[] = {
 	0x4d, 0x86, 0xcd, 0xed, 0x80, 0x21, 0x00, 0x00, };
 
 #ifdef __KERNEL__
-void bnx2x_init_e2_firmware(struct bnx2x *bp)
-{
-	INIT_OPS(bp)                  = (struct raw_op *)init_ops_e2;
-	INIT_DATA(bp)                 = (u32 *)init_data_e2;
-	INIT_OPS_OFFSETS(bp)          = (u16 *)init_ops_offsets_e2;
-	INIT_TSEM_INT_TABLE_DATA(bp)  = tsem_int_table_data_e2;
-	INIT_TSEM_PRAM_DATA(bp)       = tsem_pram_data_e2;
-	INIT_USEM_INT_TABLE_DATA(bp)  = usem_int_table_data_e2;
-	INIT_USEM_PRAM_DATA(bp)       = usem_pram_data_e2;
-	INIT_XSEM_INT_TABLE_DATA(bp)  = xsem_int_table_data_e2;
-	INIT_XSEM_PRAM_DATA(bp)       = xsem_pram_data_e2;
-	INIT_CSEM_INT_TABLE_DATA(bp)  = csem_int_table_data_e2;
-	INIT_CSEM_PRAM_DATA(bp)       = csem_pram_data_e2;
-}
+const struct bnx2x_init_values bnx2x_init_values_e2 = {
+	.ops                  = init_ops_zipped_e2,
+	.ops_zlen             = sizeof(init_ops_zipped_e2),
+	.ops_len              = 14224,
+	.ops_offsets          = init_ops_offsets_zipped_e2,
+	.ops_offsets_zlen     = sizeof(init_ops_offsets_zipped_e2),
+	.ops_offsets_len      = 1496,
+	.data                 = init_data_zipped_e2,
+	.data_zlen            = sizeof(init_data_zipped_e2),
+	.data_len             = 21820,
+	.tsem_int_table_data  = tsem_int_table_data_e2,
+	.tsem_pram_data       = tsem_pram_data_e2,
+	.usem_int_table_data  = usem_int_table_data_e2,
+	.usem_pram_data       = usem_pram_data_e2,
+	.xsem_int_table_data  = xsem_int_table_data_e2,
+	.xsem_pram_data       = xsem_pram_data_e2,
+	.csem_int_table_data  = csem_int_table_data_e2,
+	.csem_pram_data       = csem_pram_data_e2,
+};
 #endif
 
 // Total size: 76681 regs
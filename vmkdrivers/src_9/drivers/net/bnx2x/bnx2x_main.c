@@ -13786,6 +13786,7 @@ static int bnx2x_check_firmware(struct bnx2x *bp)
 
 	return 0;
 }
+#endif
 
 static void be32_to_cpu_n(const u8 *_source, u8 *_target, u32 n)
 {
@@ -13815,6 +13816,7 @@ static void bnx2x_prep_ops(const u8 *_source, u8 *_target, u32 n)
 	}
 }
 
+#if defined(BNX2X_UPSTREAM) && !defined(BNX2X_USE_INIT_VALUES) /* BNX2X_UPSTREAM */
 /* IRO array is stored in the following format:
  * {base(24bit), m1(16bit), m2(16bit), m3(16bit), size(16bit) }
  */
@@ -13837,6 +13839,7 @@ static void bnx2x_prep_iro(const u8 *_source, u8 *_target, u32 n)
 		j++;
 	}
 }
+#endif
 
 static void be16_to_cpu_n(const u8 *_source, u8 *_target, u32 n)
 {
@@ -13848,6 +13851,7 @@ static void be16_to_cpu_n(const u8 *_source, u8 *_target, u32 n)
 		target[i] = be16_to_cpu(source[i]);
 }
 
+#if defined(BNX2X_UPSTREAM) && !defined(BNX2X_USE_INIT_VALUES) /* BNX2X_UPSTREAM */
 #define BNX2X_ALLOC_AND_SET(arr, lbl, func)				\
 do {									\
 	u32 len = be32_to_cpu(fw_hdr->arr.len);				\
@@ -13951,29 +13955,104 @@ static void bnx2x_release_firmware(struct bnx2x *bp)
 
 #else
 
+/* Inflate one of the zipped init arrays into a kmalloc'ed buffer, using the
+ * gunzip buffer set up by bnx2x_gunzip_init() as scratch space.
+ */
+static void *bnx2x_inflate_init_array(struct bnx2x *bp, const u8 *zbuf,
+				      u32 zlen, u32 len,
+				      void (*func)(const u8 *, u8 *, u32))
+{
+	void *arr;
+
+	if (bnx2x_gunzip(bp, zbuf, zlen) ||
+	    GUNZIP_OUTLEN(bp) * 4 != len) {
+		BNX2X_ERR("Corrupt init array\n");
+		return NULL;
+	}
+
+	arr = kmalloc(len, GFP_KERNEL);
+	if (!arr)
+		return NULL;
+
+	func(GUNZIP_BUF(bp), arr, len);
+	return arr;
+}
+
+/* Only the arrays of the chip being initialized are inflated, and only for
+ * the duration of the HW init: bnx2x_func_hw_init() releases them again
+ * once the init blocks have been written.
+ */
 static int bnx2x_init_firmware(struct bnx2x *bp)
 {
+	const struct bnx2x_init_values *iv;
+
+	if (INIT_OPS(bp))
+		return 0;
+
 	if (CHIP_IS_E1(bp)) {
-		bnx2x_init_e1_firmware(bp);
+		iv = &bnx2x_init_values_e1;
 		bp->iro_arr = e1_iro_arr;
 	} else if (CHIP_IS_E1H(bp)) {
-		bnx2x_init_e1h_firmware(bp);
+		iv = &bnx2x_init_values_e1h;
 		bp->iro_arr = e1h_iro_arr;
 	} else if (!CHIP_IS_E1x(bp)) {
-		bnx2x_init_e2_firmware(bp);
+		iv = &bnx2x_init_values_e2;
 		bp->iro_arr = e2_iro_arr;
 	} else {
 		BNX2X_ERR("Unsupported chip revision\n");
 		return -EINVAL;
 	}
 
+	/* Blob */
+	INIT_DATA(bp) = bnx2x_inflate_init_array(bp, iv->data, iv->data_zlen,
+						 iv->data_len, be32_to_cpu_n);
+	if (!INIT_DATA(bp))
+		goto init_data_err;
+
+	/* Opcodes */
+	INIT_OPS(bp) = bnx2x_inflate_init_array(bp, iv->ops, iv->ops_zlen,
+						iv->ops_len, bnx2x_prep_ops);
+	if (!INIT_OPS(bp))
+		goto init_ops_err;
+
+	/* Offsets */
+	INIT_OPS_OFFSETS(bp) = bnx2x_inflate_init_array(bp, iv->ops_offsets,
+							iv->ops_offsets_zlen,
+							iv->ops_offsets_len,
+							be16_to_cpu_n);
+	if (!INIT_OPS_OFFSETS(bp))
+		goto init_offsets_err;
+
+	/* STORMs firmware */
+	INIT_TSEM_INT_TABLE_DATA(bp) = iv->tsem_int_table_data;
+	INIT_TSEM_PRAM_DATA(bp)      = iv->tsem_pram_data;
+	INIT_USEM_INT_TABLE_DATA(bp) = iv->usem_int_table_data;
+	INIT_USEM_PRAM_DATA(bp)      = iv->usem_pram_data;
+	INIT_XSEM_INT_TABLE_DATA(bp) = iv->xsem_int_table_data;
+	INIT_XSEM_PRAM_DATA(bp)      = iv->xsem_pram_data;
+	INIT_CSEM_INT_TABLE_DATA(bp) = iv->csem_int_table_data;
+	INIT_CSEM_PRAM_DATA(bp)      = iv->csem_pram_data;
+
 	return 0;
+
+init_offsets_err:
+	kfree(INIT_OPS(bp));
+	INIT_OPS(bp) = NULL;
+init_ops_err:
+	kfree(INIT_DATA(bp));
+	INIT_DATA(bp) = NULL;
+init_data_err:
+	return -ENOMEM;
 }
 
 static void bnx2x_release_firmware(struct bnx2x *bp)
 {
-	/* Do nothing */
-	return;
+	kfree(INIT_OPS_OFFSETS(bp));
+	INIT_OPS_OFFSETS(bp) = NULL;
+	kfree(INIT_OPS(bp));
+	INIT_OPS(bp) = NULL;
+	kfree(INIT_DATA(bp));
+	INIT_DATA(bp) = NULL;
 }
 #endif
 
@@ -5890,6 +5890,10 @@ static int bnx2x_func_hw_init(struct bnx2x *bp,
 
 init_err:
 	drv->gunzip_end(bp);
+#if !defined(BNX2X_UPSTREAM) || defined(BNX2X_USE_INIT_VALUES) /* ! BNX2X_UPSTREAM */
+	/* The inflated init arrays are only needed again on the next HW init */
+	drv->release_fw(bp);
+#endif
 
 	/* In case of success, complete the command immediately: no ramrods
 	 * have been sent.
@@ -733,6 +733,27 @@ struct nv_ethtool_stats {
 #define NV_DEV_STATISTICS_V2_COUNT (NV_DEV_STATISTICS_V3_COUNT - 3)
 #define NV_DEV_STATISTICS_V1_COUNT (NV_DEV_STATISTICS_V2_COUNT - 6)
 
+/* software statistics, reported after the hardware ones */
+static const struct nv_ethtool_str nv_sw_stats_str[] = {
+	{ "tx_lock_acquired" },
+	{ "tx_lock_contended" },
+	{ "tx_reclaim_batches" },
+	{ "tx_reclaimed" },
+	{ "rx_lock_acquired" },
+	{ "rx_lock_contended" }
+};
+
+struct nv_sw_stats {
+	u64 tx_lock_acquired;
+	u64 tx_lock_contended;
+	u64 tx_reclaim_batches;
+	u64 tx_reclaimed;
+	u64 rx_lock_acquired;
+	u64 rx_lock_contended;
+};
+
+#define NV_SW_STATISTICS_COUNT (sizeof(struct nv_sw_stats)/sizeof(u64))
+
 /* diagnostics */
 #define NV_TEST_COUNT_BASE 3
 #define NV_TEST_COUNT_EXTENDED 4
@@ -795,6 +816,7 @@ struct fe_priv {
 	/* General data:
 	 * Locking: spin_lock(&np->lock); */
 	struct nv_ethtool_stats estats;
+	struct nv_sw_stats swstats;
 	int in_shutdown;
 	u32 linkspeed;
 	int duplex;
@@ -871,6 +893,7 @@ struct fe_priv {
 	struct nv_skb_map *tx_change_owner;
 	struct nv_skb_map *tx_end_flip;
 	int tx_stop;
+	int tx_lockless;
 
 	/* vlan fields */
 	struct vlan_group *vlangrp;
@@ -953,6 +976,19 @@ enum {
 };
 static int phy_cross = NV_CROSSOVER_DETECTION_DISABLED;
 
+/*
+ * Lockless transmit
+ * The xmit routines are already serialized by netif_tx_lock, so the
+ * ring has a single producer.  When enabled, descriptors are posted
+ * without np->lock and tx completions are reclaimed in batches from
+ * the NAPI poll instead of from every interrupt.
+ */
+enum {
+	NV_LOCKLESS_TX_DISABLED,
+	NV_LOCKLESS_TX_ENABLED
+};
+static int lockless_tx = NV_LOCKLESS_TX_DISABLED;
+
 static inline struct fe_priv *get_nvpriv(struct net_device *dev)
 {
 	return netdev_priv(dev);
@@ -987,6 +1023,28 @@ static bool nv_optimized(struct fe_priv *np)
 	return true;
 }
 
+/*
+ * nv_lock_tx/nv_lock_rx: take np->lock on behalf of the tx or rx ring,
+ * counting how often it was already held by someone else.
+ */
+static inline void nv_lock_tx(struct fe_priv *np, unsigned long *flags)
+{
+	if (unlikely(!spin_trylock_irqsave(&np->lock, *flags))) {
+		spin_lock_irqsave(&np->lock, *flags);
+		np->swstats.tx_lock_contended++;
+	}
+	np->swstats.tx_lock_acquired++;
+}
+
+static inline void nv_lock_rx(struct fe_priv *np, unsigned long *flags)
+{
+	if (unlikely(!spin_trylock_irqsave(&np->lock, *flags))) {
+		spin_lock_irqsave(&np->lock, *flags);
+		np->swstats.rx_lock_contended++;
+	}
+	np->swstats.rx_lock_acquired++;
+}
+
 static int reg_delay(struct net_device *dev, int offset, u32 mask, u32 target,
 				int delay, int delaymax, const char *msg)
 {
@@ -2188,6 +2246,26 @@ static void nv_gear_backoff_reseed(struct net_device *dev)
 	}
 }
 
+#if defined (__VMKLNX__)
+/*
+ * nv_tx_recheck_slots: lockless xmit found the ring full.  Take np->lock
+ * and look again, so that a reclaim which ran after the lockless check
+ * cannot leave the queue stopped with nothing left to wake it.
+ * Returns with np->lock held if the ring is still full.
+ */
+static u32 nv_tx_recheck_slots(struct fe_priv *np, u32 entries,
+			       unsigned long *flags)
+{
+	u32 empty_slots;
+
+	nv_lock_tx(np, flags);
+	empty_slots = nv_get_empty_tx_slots(np);
+	if (empty_slots > entries)
+		spin_unlock_irqrestore(&np->lock, *flags);
+	return empty_slots;
+}
+#endif /* defined (__VMKLNX__) */
+
 /*
  * nv_start_xmit: dev->hard_start_xmit function
  * Called with netif_tx_lock held.
@@ -2222,10 +2300,15 @@ static int nv_start_xmit(struct sk_buff *skb, struct net_device *dev)
 	}
 
 #if defined (__VMKLNX__)
-	spin_lock_irqsave(&np->lock, flags);
+	if (!np->tx_lockless)
+		nv_lock_tx(np, &flags);
 #endif
 
 	empty_slots = nv_get_empty_tx_slots(np);
+#if defined (__VMKLNX__)
+	if (unlikely(empty_slots <= entries) && np->tx_lockless)
+		empty_slots = nv_tx_recheck_slots(np, entries, &flags);
+#endif
 	if (unlikely(empty_slots <= entries)) {
 #if !defined (__VMKLNX__)
 		spin_lock_irqsave(&np->lock, flags);
@@ -2301,9 +2384,20 @@ static int nv_start_xmit(struct sk_buff *skb, struct net_device *dev)
 
 	/* set tx flags */
 	start_tx->flaglen |= cpu_to_le32(tx_flags | tx_flags_extra);
+#if defined (__VMKLNX__)
+	if (np->tx_lockless) {
+		/* descriptors must be visible before the new put_tx */
+		smp_wmb();
+		np->put_tx.orig = put_tx;
+	} else {
+		np->put_tx.orig = put_tx;
+		spin_unlock_irqrestore(&np->lock, flags);
+	}
+#else
 	np->put_tx.orig = put_tx;
 
 	spin_unlock_irqrestore(&np->lock, flags);
+#endif
 
 	dprintk(KERN_DEBUG "%s: nv_start_xmit: entries %d queued for transmission. tx_flags_extra: %x\n",
 		dev->name, entries, tx_flags_extra);
@@ -2353,14 +2447,22 @@ static int nv_start_xmit_optimized(struct sk_buff *skb, struct net_device *dev)
 	}
 
 #if defined (__VMKLNX__)
-	spin_lock_irqsave(&np->lock, flags);
-	if (unlikely(test_bit(NV_DO_SPECIAL_DEV_HANDLING, &np->special_dev_handling))) {
-		spin_unlock_irqrestore(&np->lock, flags);
+	if (!np->tx_lockless) {
+		nv_lock_tx(np, &flags);
+		if (unlikely(test_bit(NV_DO_SPECIAL_DEV_HANDLING, &np->special_dev_handling))) {
+			spin_unlock_irqrestore(&np->lock, flags);
+			return NETDEV_TX_BUSY;
+		}
+	} else if (unlikely(test_bit(NV_DO_SPECIAL_DEV_HANDLING, &np->special_dev_handling))) {
 		return NETDEV_TX_BUSY;
 	}
 #endif
 
 	empty_slots = nv_get_empty_tx_slots(np);
+#if defined (__VMKLNX__)
+	if (unlikely(empty_slots <= entries) && np->tx_lockless)
+		empty_slots = nv_tx_recheck_slots(np, entries, &flags);
+#endif
 	if (unlikely(empty_slots <= entries)) {
 #if !defined (__VMKLNX__)
 		spin_lock_irqsave(&np->lock, flags);
@@ -2445,6 +2547,10 @@ static int nv_start_xmit_optimized(struct sk_buff *skb, struct net_device *dev)
 
 #if !defined (__VMKLNX__)
 	spin_lock_irqsave(&np->lock, flags);
+#else
+	/* tx_pkts_in_progress is shared with nv_tx_flip_ownership */
+	if (np->tx_lockless && np->tx_limit)
+		nv_lock_tx(np, &flags);
 #endif
 	if (np->tx_limit) {
 		/* Limit the number of outstanding tx. Setup all fragments, but
@@ -2468,9 +2574,20 @@ static int nv_start_xmit_optimized(struct sk_buff *skb, struct net_device *dev)
 
 	/* set tx flags */
 	start_tx->flaglen |= cpu_to_le32(tx_flags | tx_flags_extra);
+#if defined (__VMKLNX__)
+	if (np->tx_lockless && !np->tx_limit) {
+		/* descriptors must be visible before the new put_tx */
+		smp_wmb();
+		np->put_tx.ex = put_tx;
+	} else {
+		np->put_tx.ex = put_tx;
+		spin_unlock_irqrestore(&np->lock, flags);
+	}
+#else
 	np->put_tx.ex = put_tx;
 
 	spin_unlock_irqrestore(&np->lock, flags);
+#endif
 
 	dprintk(KERN_DEBUG "%s: nv_start_xmit_optimized: entries %d queued for transmission. tx_flags_extra: %x\n",
 		dev->name, entries, tx_flags_extra);
@@ -2545,6 +2662,7 @@ static void nv_tx_done(struct net_device *dev)
 				}
 				dev_kfree_skb_any(np->get_tx_ctx->skb);
 				np->get_tx_ctx->skb = NULL;
+				np->swstats.tx_reclaimed++;
 			}
 		} else {
 			if (flags & NV_TX2_LASTPACKET) {
@@ -2562,6 +2680,7 @@ static void nv_tx_done(struct net_device *dev)
 				}
 				dev_kfree_skb_any(np->get_tx_ctx->skb);
 				np->get_tx_ctx->skb = NULL;
+				np->swstats.tx_reclaimed++;
 			}
 		}
 		if (unlikely(np->get_tx.orig++ == np->last_tx.orig))
@@ -2607,6 +2726,7 @@ static void nv_tx_done_optimized(struct net_device *dev, int limit)
 
 			dev_kfree_skb_any(np->get_tx_ctx->skb);
 			np->get_tx_ctx->skb = NULL;
+			np->swstats.tx_reclaimed++;
 
 			if (np->tx_limit) {
 				nv_tx_flip_ownership(dev);
@@ -2623,6 +2743,42 @@ static void nv_tx_done_optimized(struct net_device *dev, int limit)
 	}
 }
 
+/*
+ * nv_tx_reclaim: reclaim completed tx descriptors from an interrupt
+ * handler.  With lockless_tx and NAPI the work is handed to nv_napi_poll,
+ * which reclaims the whole ring in one batch.
+ */
+static void nv_tx_reclaim(struct net_device *dev, int limit)
+{
+	struct fe_priv *np = netdev_priv(dev);
+	unsigned long flags;
+
+#if defined (__VMKLNX__) && defined (CONFIG_FORCEDETH_NAPI)
+	if (np->tx_lockless) {
+		netif_rx_schedule(dev, &np->napi);
+		return;
+	}
+#endif
+
+	nv_lock_tx(np, &flags);
+	if (!nv_optimized(np))
+		nv_tx_done(dev);
+	else
+		nv_tx_done_optimized(dev, limit);
+	spin_unlock_irqrestore(&np->lock, flags);
+}
+
+#if defined (__VMKLNX__) && defined (CONFIG_FORCEDETH_NAPI)
+static inline int nv_tx_completions_pending(struct fe_priv *np)
+{
+	if (!nv_optimized(np))
+		return (np->get_tx.orig != np->put_tx.orig) &&
+		       !(le32_to_cpu(np->get_tx.orig->flaglen) & NV_TX_VALID);
+	return (np->get_tx.ex != np->put_tx.ex) &&
+	       !(le32_to_cpu(np->get_tx.ex->flaglen) & NV_TX_VALID);
+}
+#endif
+
 /*
  * nv_tx_timeout: dev->tx_timeout function
  * Called with netif_tx_lock held.
@@ -3119,7 +3275,8 @@ static int nv_change_mtu(struct net_device *dev, int new_mtu)
 #endif /* defined(__VMKLNX__) */
 			nv_disable_irq(dev);
 #if defined (__VMKLNX__)
-			netif_stop_queue(dev);
+			/* waits for a lockless_tx xmit in progress */
+			netif_tx_disable(dev);
 			nv_stop_rx(dev);
 			napi_disable(&np->napi);
 #else
@@ -3724,9 +3881,7 @@ static irqreturn_t nv_nic_irq(int foo, void *data)
 		nv_tx_done(dev);
 		spin_unlock(&np->lock);
 #else  /* defined (__VMKLNX__) */
-		spin_lock_irqsave(&np->lock, flags);
-		nv_tx_done(dev);
-		spin_unlock_irqrestore(&np->lock, flags);
+		nv_tx_reclaim(dev, np->tx_ring_size);
 #endif /* !defined (__VMKLNX__) */
 
 #ifdef CONFIG_FORCEDETH_NAPI
@@ -3738,7 +3893,7 @@ static irqreturn_t nv_nic_irq(int foo, void *data)
 			spin_lock(&np->lock);
 #else
 			/* Disable furthur receive irq's */
-			spin_lock_irqsave(&np->lock, flags);
+			nv_lock_rx(np, &flags);
 			netif_rx_schedule(dev, &np->napi);
 #endif
 			np->irqmask &= ~NVREG_IRQ_RX_ALL;
@@ -3889,9 +4044,7 @@ static irqreturn_t nv_nic_irq_optimized(int foo, void *data)
 		nv_tx_done_optimized(dev, TX_WORK_PER_LOOP);
 		spin_unlock(&np->lock);
 #else  /* defined (__VMKLNX__) */
-		spin_lock_irqsave(&np->lock, flags);
-		nv_tx_done_optimized(dev, TX_WORK_PER_LOOP);
-		spin_unlock_irqrestore(&np->lock, flags);
+		nv_tx_reclaim(dev, TX_WORK_PER_LOOP);
 #endif /* !defined (__VMKLNX__) */
 
 #ifdef CONFIG_FORCEDETH_NAPI
@@ -3903,7 +4056,7 @@ static irqreturn_t nv_nic_irq_optimized(int foo, void *data)
 			spin_lock(&np->lock);
 #else
 			/* Disable furthur receive irq's */
-			spin_lock_irqsave(&np->lock, flags);
+			nv_lock_rx(np, &flags);
 			netif_rx_schedule(dev, &np->napi);
 #endif
 			np->irqmask &= ~NVREG_IRQ_RX_ALL;
@@ -4028,9 +4181,7 @@ static irqreturn_t nv_nic_irq_tx(int foo, void *data)
 		if (!(events & np->irqmask))
 			break;
 
-		spin_lock_irqsave(&np->lock, flags);
-		nv_tx_done_optimized(dev, TX_WORK_PER_LOOP);
-		spin_unlock_irqrestore(&np->lock, flags);
+		nv_tx_reclaim(dev, TX_WORK_PER_LOOP);
 
 		if (unlikely(events & (NVREG_IRQ_TX_ERR))) {
 			dprintk(KERN_DEBUG "%s: received irq with events 0x%x. Probably TX fail.\n",
@@ -4073,16 +4224,29 @@ static int nv_napi_poll(struct napi_struct *napi, int budget)
 		return 0;
 	}
 
+#if defined (__VMKLNX__)
+	if (np->tx_lockless) {
+		/* batched reclaim, see nv_tx_reclaim */
+		nv_lock_tx(np, &flags);
+		np->swstats.tx_reclaim_batches++;
+		if (!nv_optimized(np))
+			nv_tx_done(dev);
+		else
+			nv_tx_done_optimized(dev, np->tx_ring_size);
+		spin_unlock_irqrestore(&np->lock, flags);
+	}
+#endif
+
 	if (!nv_optimized(np)) {
 #if defined (__VMKLNX__)
-		if (vmk_SystemCheckState(VMK_SYSTEM_STATE_PANIC))
+		if (!np->tx_lockless && vmk_SystemCheckState(VMK_SYSTEM_STATE_PANIC))
 			nv_tx_done(dev);
 #endif
 		pkts = nv_rx_process(dev, budget);
 		retcode = nv_alloc_rx(dev);
 	} else {
 #if defined (__VMKLNX__)
-		if (vmk_SystemCheckState(VMK_SYSTEM_STATE_PANIC))
+		if (!np->tx_lockless && vmk_SystemCheckState(VMK_SYSTEM_STATE_PANIC))
 			nv_tx_done_optimized(dev, TX_WORK_PER_LOOP);
 #endif
 		pkts = nv_rx_process_optimized(dev, budget);
@@ -4098,7 +4262,7 @@ static int nv_napi_poll(struct napi_struct *napi, int budget)
 
 	if (pkts < budget) {
 		/* re-enable receive interrupts */
-		spin_lock_irqsave(&np->lock, flags);
+		nv_lock_rx(np, &flags);
 
 		__netif_rx_complete(dev, napi);
 
@@ -4109,6 +4273,12 @@ static int nv_napi_poll(struct napi_struct *napi, int budget)
 			writel(np->irqmask, base + NvRegIrqMask);
 
 		spin_unlock_irqrestore(&np->lock, flags);
+
+#if defined (__VMKLNX__)
+		/* a tx interrupt that found us still scheduled was dropped */
+		if (np->tx_lockless && nv_tx_completions_pending(np))
+			netif_rx_schedule(dev, napi);
+#endif
 	}
 	return pkts;
 }
@@ -4209,9 +4379,7 @@ static irqreturn_t nv_nic_irq_other(int foo, void *data)
 			break;
 #endif /* defined (__VMKLNX__) */
 		/* check tx in case we reached max loop limit in tx isr */
-		spin_lock_irqsave(&np->lock, flags);
-		nv_tx_done_optimized(dev, TX_WORK_PER_LOOP);
-		spin_unlock_irqrestore(&np->lock, flags);
+		nv_tx_reclaim(dev, TX_WORK_PER_LOOP);
 
 		if (events & NVREG_IRQ_LINK) {
 			spin_lock_irqsave(&np->lock, flags);
@@ -4495,7 +4663,12 @@ static void nv_do_special_dev_handling(struct fe_priv *np)
 
 	/* disable_irq() contains synchronize_irq, thus no irq handler can run now */
 
-	netif_stop_queue(dev);
+	/*
+	 * Stop the queue under netif_tx_lock: with lockless_tx the xmit
+	 * routines don't take np->lock, so this is what guarantees none of
+	 * them is still posting descriptors when the rings are reset below.
+	 */
+	netif_tx_disable(dev);
 #ifdef CONFIG_FORCEDETH_NAPI
 	nv_stop_rx(dev);
 	napi_disable(&np->napi);
@@ -5311,7 +5484,8 @@ static int nv_set_ringparam(struct net_device *dev, struct ethtool_ringparam* ri
 	if (netif_running(dev)) {
 		nv_disable_irq(dev);
 #if defined (__VMKLNX__)
-		netif_stop_queue(dev);
+		/* waits for a lockless_tx xmit in progress */
+		netif_tx_disable(dev);
 		nv_stop_rx(dev);
 		napi_disable(&np->napi);
 #else
@@ -5538,6 +5712,18 @@ static int nv_set_sg(struct net_device *dev, u32 data)
 		return -EOPNOTSUPP;
 }
 
+static int nv_get_hw_stats_count(struct fe_priv *np)
+{
+	if (np->driver_data & DEV_HAS_STATISTICS_V1)
+		return NV_DEV_STATISTICS_V1_COUNT;
+	else if (np->driver_data & DEV_HAS_STATISTICS_V2)
+		return NV_DEV_STATISTICS_V2_COUNT;
+	else if (np->driver_data & DEV_HAS_STATISTICS_V3)
+		return NV_DEV_STATISTICS_V3_COUNT;
+	else
+		return 0;
+}
+
 static int nv_get_sset_count(struct net_device *dev, int sset)
 {
 	struct fe_priv *np = netdev_priv(dev);
@@ -5549,14 +5735,7 @@ static int nv_get_sset_count(struct net_device *dev, int sset)
 		else
 			return NV_TEST_COUNT_BASE;
 	case ETH_SS_STATS:
-		if (np->driver_data & DEV_HAS_STATISTICS_V1)
-			return NV_DEV_STATISTICS_V1_COUNT;
-		else if (np->driver_data & DEV_HAS_STATISTICS_V2)
-			return NV_DEV_STATISTICS_V2_COUNT;
-		else if (np->driver_data & DEV_HAS_STATISTICS_V3)
-			return NV_DEV_STATISTICS_V3_COUNT;
-		else
-			return 0;
+		return nv_get_hw_stats_count(np) + NV_SW_STATISTICS_COUNT;
 	default:
 		return -EOPNOTSUPP;
 	}
@@ -5565,11 +5744,14 @@ static int nv_get_sset_count(struct net_device *dev, int sset)
 static void nv_get_ethtool_stats(struct net_device *dev, struct ethtool_stats *estats, u64 *buffer)
 {
 	struct fe_priv *np = netdev_priv(dev);
+	int hw_count = nv_get_hw_stats_count(np);
 
 	/* update stats */
-	nv_do_stats_poll((unsigned long)dev);
+	if (hw_count)
+		nv_do_stats_poll((unsigned long)dev);
 
-	memcpy(buffer, &np->estats, nv_get_sset_count(dev, ETH_SS_STATS)*sizeof(u64));
+	memcpy(buffer, &np->estats, hw_count*sizeof(u64));
+	memcpy(buffer + hw_count, &np->swstats, NV_SW_STATISTICS_COUNT*sizeof(u64));
 }
 
 static int nv_link_test(struct net_device *dev)
@@ -5897,9 +6079,14 @@ static void nv_self_test(struct net_device *dev, struct ethtool_test *test, u64
 
 static void nv_get_strings(struct net_device *dev, u32 stringset, u8 *buffer)
 {
+	int hw_count;
+
 	switch (stringset) {
 	case ETH_SS_STATS:
-		memcpy(buffer, &nv_estats_str, nv_get_sset_count(dev, ETH_SS_STATS)*sizeof(struct nv_ethtool_str));
+		hw_count = nv_get_hw_stats_count(netdev_priv(dev));
+		memcpy(buffer, &nv_estats_str, hw_count*sizeof(struct nv_ethtool_str));
+		memcpy(buffer + hw_count*sizeof(struct nv_ethtool_str), &nv_sw_stats_str,
+		       NV_SW_STATISTICS_COUNT*sizeof(struct nv_ethtool_str));
 		break;
 	case ETH_SS_TEST:
 		memcpy(buffer, &nv_etests_str, nv_get_sset_count(dev, ETH_SS_TEST)*sizeof(struct nv_ethtool_str));
@@ -6561,6 +6748,10 @@ static int __devinit nv_probe(struct pci_dev *pci_dev, const struct pci_device_i
 			np->tx_limit = 0;
 	}
 
+#if defined (__VMKLNX__)
+	np->tx_lockless = (lockless_tx == NV_LOCKLESS_TX_ENABLED);
+#endif
+
 	/* clear phy state and temporarily halt phy interrupts */
 	writel(0, base + NvRegMIIMask);
 	phystate = readl(base + NvRegAdapterControl);
@@ -7018,6 +7209,8 @@ module_param(dma_64bit, int, 0);
 MODULE_PARM_DESC(dma_64bit, "High DMA is enabled by setting to 1 and disabled by setting to 0.");
 module_param(phy_cross, int, 0);
 MODULE_PARM_DESC(phy_cross, "Phy crossover detection for Realtek 8201 phy is enabled by setting to 1 and disabled by setting to 0.");
+module_param(lockless_tx, int, 0);
+MODULE_PARM_DESC(lockless_tx, "Lockless transmit with batched tx reclaim is enabled by setting to 1 and disabled by setting to 0.");
 
 MODULE_AUTHOR("Manfred Spraul <manfred@colorfullife.com>");
 MODULE_DESCRIPTION("Reverse Engineered nForce ethernet driver");
@@ -236,12 +236,30 @@ static inline void _tg3_flag_clear(enum TG3_FLAGS flag, unsigned long *bits)
 #define TG3_RX_STD_MAP_SZ		TG3_RX_DMA_TO_MAP_SZ(TG3_RX_STD_DMA_SZ)
 #define TG3_RX_JMB_MAP_SZ		TG3_RX_DMA_TO_MAP_SZ(TG3_RX_JMB_DMA_SZ)
 
+/* In jumbo header split mode each extended jumbo BD carries a small
+ * header buffer in its standard part and TG3_RX_JMB_FRAGS pages in its
+ * address list.  Every fragment leaves room for the DMA byte enables so
+ * that the chip never writes past the end of a page.
+ */
+#define TG3_RX_JMB_HDR_SZ		256
+#define TG3_RX_JMB_HDR_MAP_SZ		TG3_RX_DMA_TO_MAP_SZ(TG3_RX_JMB_HDR_SZ)
+#define TG3_RX_JMB_FRAG_SZ		(PAGE_SIZE - TG3_DMA_BYTE_ENAB)
+#define TG3_RX_JMB_FRAGS		3
+
+#define TG3_RX_JMB_BUF_MAP_SZ(tp) \
+	(tg3_flag(tp, JUMBO_HDR_SPLIT) ? TG3_RX_JMB_HDR_MAP_SZ : \
+					 TG3_RX_JMB_MAP_SZ)
+
 #define TG3_RX_STD_BUFF_RING_SIZE(tp) \
 	(sizeof(struct ring_info) * TG3_RX_STD_RING_SIZE(tp))
 
 #define TG3_RX_JMB_BUFF_RING_SIZE(tp) \
 	(sizeof(struct ring_info) * TG3_RX_JMB_RING_SIZE(tp))
 
+#define TG3_RX_JMB_FRAG_RING_SIZE(tp) \
+	(sizeof(struct tg3_rx_frag_info) * TG3_RX_JMB_FRAGS * \
+	 TG3_RX_JMB_RING_SIZE(tp))
+
 /* Due to a hardware bug, the 5701 can only DMA to memory addresses
  * that are at least dword aligned when used in PCIX mode.  The driver
  * works around this bug by double copying the packet.  This workaround
@@ -318,6 +336,14 @@ module_param(tg3_disable_eee, int, 0);
 MODULE_PARM_DESC(tg3_disable_eee, "Disable Energy Efficient Ethernet (EEE) support");
 #endif
 
+static int tg3_jumbo_hdr_split;
+#if (LINUX_VERSION_CODE >= 0x20600)
+module_param(tg3_jumbo_hdr_split, int, 0);
+MODULE_PARM_DESC(tg3_jumbo_hdr_split, "Receive jumbo frames into a header "
+				      "buffer plus page fragments instead of "
+				      "a single 9K buffer");
+#endif
+
 #define TG3_DRV_DATA_FLAG_10_100_ONLY	0x0001
 #define TG3_DRV_DATA_FLAG_5705_10_100	0x0002
 
@@ -6844,7 +6870,7 @@ static int tg3_alloc_rx_data(struct tg3 *tp, struct tg3_rx_prodring_set *tpr,
 		dest_idx = dest_idx_unmasked & tp->rx_jmb_ring_mask;
 		desc = &tpr->rx_jmb[dest_idx].std;
 		map = &tpr->rx_jmb_buffers[dest_idx];
-		skb_size = TG3_RX_JMB_MAP_SZ;
+		skb_size = TG3_RX_JMB_BUF_MAP_SZ(tp);
 		break;
 
 	default:
@@ -6918,6 +6944,83 @@ alloc_done:
 	return err;
 }
 
+static void tg3_rx_frag_free(struct tg3 *tp, struct tg3_rx_frag_info *frag)
+{
+	if (!frag->page)
+		return;
+
+	pci_unmap_page(tp->pdev, dma_unmap_addr(frag, mapping),
+		       PAGE_SIZE, PCI_DMA_FROMDEVICE);
+	__free_page(frag->page);
+	frag->page = NULL;
+}
+
+/* Returns the number of bytes allocated or < 0 on error.  Like
+ * tg3_alloc_rx_data, nothing is posted to the ring here; the caller
+ * decides which address list slot the page ends up in.
+ */
+static int tg3_alloc_rx_frag(struct tg3 *tp, struct tg3_rx_frag_info *frag,
+			     dma_addr_t *mappingp)
+{
+	struct page *page;
+	dma_addr_t mapping;
+
+	page = alloc_page(GFP_ATOMIC);
+	if (!page)
+		return -ENOMEM;
+
+	mapping = pci_map_page(tp->pdev, page, 0, PAGE_SIZE,
+			       PCI_DMA_FROMDEVICE);
+	if (tg3_pci_dma_mapping_error(tp->pdev, mapping)) {
+		__free_page(page);
+		return -EIO;
+	}
+
+	frag->page = page;
+	dma_unmap_addr_set(frag, mapping, mapping);
+	*mappingp = mapping;
+
+	return PAGE_SIZE;
+}
+
+static void tg3_post_rx_frag(struct tg3_ext_rx_buffer_desc *desc, int i,
+			     struct tg3_rx_frag_info *dest,
+			     struct tg3_rx_frag_info *src, dma_addr_t mapping)
+{
+	dest->page = src->page;
+	dma_unmap_addr_set(dest, mapping, dma_unmap_addr(src, mapping));
+	desc->addrlist[i].addr_hi = ((u64)mapping >> 32);
+	desc->addrlist[i].addr_lo = ((u64)mapping & 0xffffffff);
+}
+
+/* Populate the page fragments of a jumbo BD in header split mode.
+ * Returns the number of bytes allocated or < 0 on error, in which
+ * case any pages already posted are left for tg3_rx_prodring_free.
+ */
+static int tg3_alloc_rx_frags(struct tg3 *tp, struct tg3_rx_prodring_set *tpr,
+			      u32 dest_idx_unmasked)
+{
+	struct tg3_ext_rx_buffer_desc *desc;
+	struct tg3_rx_frag_info *frags, frag;
+	dma_addr_t mapping;
+	int dest_idx, i, err, size = 0;
+
+	dest_idx = dest_idx_unmasked & tp->rx_jmb_ring_mask;
+	desc = &tpr->rx_jmb[dest_idx];
+	frags = &tpr->rx_jmb_frags[dest_idx * TG3_RX_JMB_FRAGS];
+
+	for (i = 0; i < TG3_RX_JMB_FRAGS; i++) {
+		err = tg3_alloc_rx_frag(tp, &frag, &mapping);
+		if (err < 0)
+			return err;
+
+		tg3_post_rx_frag(desc, i, &frags[i], &frag, mapping);
+		size += err;
+	}
+
+	return size;
+}
+
 /* We only need to move over in the address because the other
  * members of the RX descriptor are invariant.  See notes above
  * tg3_alloc_rx_data for full details.
@@ -6960,6 +7063,24 @@ static void tg3_recycle_rx(struct tg3_napi *tnapi,
 	dest_desc->addr_hi = src_desc->addr_hi;
 	dest_desc->addr_lo = src_desc->addr_lo;
 
+	if (opaque_key == RXD_OPAQUE_RING_JUMBO &&
+	    tg3_flag(tp, JUMBO_HDR_SPLIT)) {
+		struct tg3_ext_rx_buffer_desc *src_ext, *dest_ext;
+		struct tg3_rx_frag_info *src_frag, *dest_frag;
+		int i;
+
+		src_ext = &spr->rx_jmb[src_idx];
+		dest_ext = &dpr->rx_jmb[dest_idx];
+		src_frag = &spr->rx_jmb_frags[src_idx * TG3_RX_JMB_FRAGS];
+		dest_frag = &dpr->rx_jmb_frags[dest_idx * TG3_RX_JMB_FRAGS];
+
+		for (i = 0; i < TG3_RX_JMB_FRAGS; i++) {
+			dest_frag[i] = src_frag[i];
+			dest_ext->addrlist[i] = src_ext->addrlist[i];
+			src_frag[i].page = NULL;
+		}
+	}
+
 	/* Ensure that the update to the skb happens after the physical
 	 * addresses have been transferred to the new BD location.
 	 */
@@ -6968,6 +7089,99 @@ static void tg3_recycle_rx(struct tg3_napi *tnapi,
 	src_map->data = NULL;
 }
 
+/* Complete a jumbo frame received in header split mode.  The first
+ * TG3_RX_JMB_HDR_SZ bytes land in the skb posted in the standard part
+ * of the extended BD and the remainder in its page fragments, which
+ * are attached to that skb.  Replacements for every buffer the frame
+ * consumed are allocated before anything is taken off the ring, so on
+ * failure the caller can still recycle the whole BD.
+ *
+ * Returns the number of bytes allocated or < 0 on error.
+ */
+static int tg3_rx_hdr_split(struct tg3_napi *tnapi,
+			    struct tg3_rx_prodring_set *tpr,
+			    struct sk_buff *skb, dma_addr_t dma_addr,
+			    struct ring_info *ri, int src_idx,
+			    u32 dest_idx_unmasked, unsigned int len)
+{
+	struct tg3 *tp = tnapi->tp;
+	struct tg3_rx_prodring_set *spr = tnapi->srcprodring;
+	struct tg3_ext_rx_buffer_desc *src_desc, *dest_desc;
+	struct tg3_rx_frag_info *src_frag, *dest_frag;
+	struct tg3_rx_frag_info new_frag[TG3_RX_JMB_FRAGS];
+	dma_addr_t new_mapping[TG3_RX_JMB_FRAGS];
+	unsigned int hdr_len, frag_len;
+	int dest_idx, skb_size, nfrags, i, err = 0;
+
+	hdr_len = min_t(unsigned int, len, TG3_RX_JMB_HDR_SZ);
+	nfrags = DIV_ROUND_UP(len - hdr_len, TG3_RX_JMB_FRAG_SZ);
+	if (nfrags > TG3_RX_JMB_FRAGS)
+		return -EINVAL;
+
+	for (i = 0; i < nfrags; i++) {
+		err = tg3_alloc_rx_frag(tp, &new_frag[i], &new_mapping[i]);
+		if (err < 0)
+			goto err_frags;
+	}
+
+	skb_size = tg3_alloc_rx_data(tp, tpr, RXD_OPAQUE_RING_JUMBO,
+				     dest_idx_unmasked);
+	if (skb_size < 0) {
+		err = skb_size;
+		goto err_frags;
+	}
+
+	pci_unmap_single(tp->pdev, dma_addr, skb_size, PCI_DMA_FROMDEVICE);
+
+	/* Ensure that the update to the skb happens
+	 * after the usage of the old DMA mapping.
+	 */
+	smp_wmb();
+
+	ri->data = NULL;
+
+	skb_put(skb, hdr_len);
+	len -= hdr_len;
+
+	dest_idx = dest_idx_unmasked & tp->rx_jmb_ring_mask;
+	src_desc = &spr->rx_jmb[src_idx];
+	dest_desc = &tpr->rx_jmb[dest_idx];
+	src_frag = &spr->rx_jmb_frags[src_idx * TG3_RX_JMB_FRAGS];
+	dest_frag = &tpr->rx_jmb_frags[dest_idx * TG3_RX_JMB_FRAGS];
+
+	for (i = 0; i < TG3_RX_JMB_FRAGS; i++) {
+		if (i < nfrags) {
+			frag_len = min_t(unsigned int, len,
+					 TG3_RX_JMB_FRAG_SZ);
+			pci_unmap_page(tp->pdev,
+				       dma_unmap_addr(&src_frag[i], mapping),
+				       PAGE_SIZE, PCI_DMA_FROMDEVICE);
+			skb_fill_page_desc(skb, i, src_frag[i].page, 0,
+					   frag_len);
+			skb->len += frag_len;
+			skb->data_len += frag_len;
+			skb->truesize += PAGE_SIZE;
+			len -= frag_len;
+
+			tg3_post_rx_frag(dest_desc, i, &dest_frag[i],
+					 &new_frag[i], new_mapping[i]);
+		} else {
+			/* Unused fragments simply move to the new BD. */
+			dest_frag[i] = src_frag[i];
+			dest_desc->addrlist[i] = src_desc->addrlist[i];
+		}
+		src_frag[i].page = NULL;
+	}
+
+	return skb_size + nfrags * PAGE_SIZE;
+
+err_frags:
+	while (--i >= 0)
+		tg3_rx_frag_free(tp, &new_frag[i]);
+
+	return err;
+}
+
 /* The RX ring scheme is composed of multiple rings which post fresh
  * buffers to the chip, and one special ring the chip uses to report
  * status back to the host.
@@ -7075,13 +7289,28 @@ static int tg3_rx(struct tg3_napi *tnapi, int budget)
 		}
 #endif /* BCM_HAS_IEEE1588_SUPPORT */
 
-		if (len > TG3_RX_COPY_THRESH(tp)) {
+		if (opaque_key == RXD_OPAQUE_RING_JUMBO &&
+		    tg3_flag(tp, JUMBO_HDR_SPLIT)) {
+			int alloc_size;
+
+			alloc_size = tg3_rx_hdr_split(tnapi, tpr, skb,
+						      dma_addr, ri, desc_idx,
+						      *post_ptr, len);
+			if (alloc_size < 0)
+				goto drop_it;
+#ifdef TG3_VMWARE_NETQ_ENABLE
+			tnapi->netq.stats.rx_alloc_bytes += alloc_size;
+#endif
+		} else if (len > TG3_RX_COPY_THRESH(tp)) {
 			int skb_size;
 
 			skb_size = tg3_alloc_rx_data(tp, tpr, opaque_key,
 						    *post_ptr);
 			if (skb_size < 0)
 				goto drop_it;
+#ifdef TG3_VMWARE_NETQ_ENABLE
+			tnapi->netq.stats.rx_alloc_bytes += skb_size;
+#endif
 
 			pci_unmap_single(tp->pdev, dma_addr, skb_size,
 					 PCI_DMA_FROMDEVICE);
@@ -7444,12 +7673,27 @@ static int tg3_rx_prodring_xfer(struct tg3 *tp,
 		       &spr->rx_jmb_buffers[si],
 		       cpycnt * sizeof(struct ring_info));
 
+		if (tg3_flag(tp, JUMBO_HDR_SPLIT)) {
+			memcpy(&dpr->rx_jmb_frags[di * TG3_RX_JMB_FRAGS],
+			       &spr->rx_jmb_frags[si * TG3_RX_JMB_FRAGS],
+			       cpycnt * TG3_RX_JMB_FRAGS *
+			       sizeof(struct tg3_rx_frag_info));
+			memset(&spr->rx_jmb_frags[si * TG3_RX_JMB_FRAGS], 0,
+			       cpycnt * TG3_RX_JMB_FRAGS *
+			       sizeof(struct tg3_rx_frag_info));
+		}
+
 		for (i = 0; i < cpycnt; i++, di++, si++) {
 			struct tg3_rx_buffer_desc *sbd, *dbd;
 			sbd = &spr->rx_jmb[si].std;
 			dbd = &dpr->rx_jmb[di].std;
 			dbd->addr_hi = sbd->addr_hi;
 			dbd->addr_lo = sbd->addr_lo;
+
+			if (tg3_flag(tp, JUMBO_HDR_SPLIT))
+				memcpy(dpr->rx_jmb[di].addrlist,
+				       spr->rx_jmb[si].addrlist,
+				       sizeof(dpr->rx_jmb[di].addrlist));
 		}
 
 		spr->rx_jmb_cons_idx = (spr->rx_jmb_cons_idx + cpycnt) &
@@ -8690,6 +8934,22 @@ static int tg3_set_features(struct net_device *dev, netdev_features_t features)
 }
 #endif /* BCM_HAS_FIX_FEATURES */
 
+static void tg3_rx_jmb_data_free(struct tg3 *tp,
+				 struct tg3_rx_prodring_set *tpr, int i)
+{
+	int j;
+
+	tg3_rx_data_free(tp, &tpr->rx_jmb_buffers[i],
+			 TG3_RX_JMB_BUF_MAP_SZ(tp));
+
+	if (!tg3_flag(tp, JUMBO_HDR_SPLIT))
+		return;
+
+	for (j = 0; j < TG3_RX_JMB_FRAGS; j++)
+		tg3_rx_frag_free(tp,
+				 &tpr->rx_jmb_frags[i * TG3_RX_JMB_FRAGS + j]);
+}
+
 static void tg3_rx_prodring_free(struct tg3 *tp,
 				 struct tg3_rx_prodring_set *tpr)
 {
@@ -8711,8 +8971,7 @@ static void tg3_rx_prodring_free(struct tg3 *tp,
 			for (i = tpr->rx_jmb_cons_idx;
 			     i != tpr->rx_jmb_prod_idx;
 			     i = (i + 1) & tp->rx_jmb_ring_mask) {
-				tg3_rx_data_free(tp, &tpr->rx_jmb_buffers[i],
-						TG3_RX_JMB_MAP_SZ);
+				tg3_rx_jmb_data_free(tp, tpr, i);
 			}
 		}
 
@@ -8725,8 +8984,7 @@ static void tg3_rx_prodring_free(struct tg3 *tp,
 
 	if (tg3_flag(tp, JUMBO_CAPABLE) && !tg3_flag(tp, 5780_CLASS)) {
 		for (i = 0; i <= tp->rx_jmb_ring_mask; i++)
-			tg3_rx_data_free(tp, &tpr->rx_jmb_buffers[i],
-					TG3_RX_JMB_MAP_SZ);
+			tg3_rx_jmb_data_free(tp, tpr, i);
 	}
 }
 
@@ -8759,6 +9017,9 @@ static int tg3_rx_prodring_alloc(struct tg3 *tp,
 		if (tpr->rx_jmb_buffers)
 			memset(&tpr->rx_jmb_buffers[0], 0,
 			       TG3_RX_JMB_BUFF_RING_SIZE(tp));
+		if (tpr->rx_jmb_frags)
+			memset(&tpr->rx_jmb_frags[0], 0,
+			       TG3_RX_JMB_FRAG_RING_SIZE(tp));
 		goto done;
 	}
 
@@ -8816,16 +9077,29 @@ static int tg3_rx_prodring_alloc(struct tg3 *tp,
 				  RXD_FLAG_JUMBO;
 		rxd->opaque = (RXD_OPAQUE_RING_JUMBO |
 		       (i << RXD_OPAQUE_INDEX_SHIFT));
+
+		if (tg3_flag(tp, JUMBO_HDR_SPLIT)) {
+			struct tg3_ext_rx_buffer_desc *erxd = &tpr->rx_jmb[i];
+
+			rxd->idx_len = TG3_RX_JMB_HDR_SZ << RXD_LEN_SHIFT;
+			erxd->len2_len1 =
+				(TG3_RX_JMB_FRAG_SZ << RXD_LEN1_SHIFT) |
+				(TG3_RX_JMB_FRAG_SZ << RXD_LEN2_SHIFT);
+			erxd->resv_len3 = TG3_RX_JMB_FRAG_SZ << RXD_LEN3_SHIFT;
+		}
 	}
 
 	for (i = 0; i < tp->rx_jumbo_pending; i++) {
-		if (tg3_alloc_rx_data(tp, tpr, RXD_OPAQUE_RING_JUMBO, i) < 0) {
+		if (tg3_alloc_rx_data(tp, tpr, RXD_OPAQUE_RING_JUMBO, i) < 0 ||
+		    (tg3_flag(tp, JUMBO_HDR_SPLIT) &&
+		     tg3_alloc_rx_frags(tp, tpr, i) < 0)) {
 			netdev_warn(tp->dev,
 				    "Using a smaller RX jumbo ring. Only %d "
 				    "out of %d buffers were allocated "
 				    "successfully\n", i, tp->rx_jumbo_pending);
 			if (i == 0)
 				goto initfail;
+			tg3_rx_jmb_data_free(tp, tpr, i);
 			tp->rx_jumbo_pending = i;
 			break;
 		}
@@ -8846,6 +9120,8 @@ static void tg3_rx_prodring_fini(struct tg3 *tp,
 	tpr->rx_std_buffers = NULL;
 	kfree(tpr->rx_jmb_buffers);
 	tpr->rx_jmb_buffers = NULL;
+	kfree(tpr->rx_jmb_frags);
+	tpr->rx_jmb_frags = NULL;
 	if (tpr->rx_std) {
 		dma_free_coherent(&tp->pdev->dev, TG3_RX_STD_RING_BYTES(tp),
 				  tpr->rx_std, tpr->rx_std_mapping);
@@ -8879,6 +9155,14 @@ static int tg3_rx_prodring_init(struct tg3 *tp,
 		if (!tpr->rx_jmb_buffers)
 			goto err_out;
 
+		if (tg3_flag(tp, JUMBO_HDR_SPLIT)) {
+			tpr->rx_jmb_frags =
+				kzalloc(TG3_RX_JMB_FRAG_RING_SIZE(tp),
+					GFP_KERNEL);
+			if (!tpr->rx_jmb_frags)
+				goto err_out;
+		}
+
 		tpr->rx_jmb = dma_alloc_coherent(&tp->pdev->dev,
 						 TG3_RX_JMB_RING_BYTES(tp),
 						 &tpr->rx_jmb_mapping,
@@ -17021,6 +17305,15 @@ static int __devinit tg3_get_invariants(struct tg3 *tp,
 	    tg3_flag(tp, USE_JUMBO_BDFLAG))
 		tg3_flag_set(tp, JUMBO_CAPABLE);
 
+	/* Header split reuses the extended jumbo BDs, which the 5780
+	 * class does not have.
+	 */
+	BUILD_BUG_ON(TG3_RX_JMB_HDR_SZ + TG3_RX_JMB_FRAGS * TG3_RX_JMB_FRAG_SZ <
+		     TG3_RX_JMB_DMA_SZ);
+	if (tg3_jumbo_hdr_split &&
+	    tg3_flag(tp, JUMBO_CAPABLE) && !tg3_flag(tp, 5780_CLASS))
+		tg3_flag_set(tp, JUMBO_HDR_SPLIT);
+
 	pci_read_config_dword(tp->pdev, TG3PCI_PCISTATE,
 			      &pci_state_reg);
 
@@ -2665,7 +2665,10 @@ struct tg3_ext_rx_buffer_desc {
 		u32			addr_lo;
 	}				addrlist[3];
 	u32				len2_len1;
+#define RXD_LEN1_SHIFT		16
+#define RXD_LEN2_SHIFT		0
 	u32				resv_len3;
+#define RXD_LEN3_SHIFT		16
 	struct tg3_rx_buffer_desc	std;
 };
 
@@ -2885,6 +2888,11 @@ struct ring_info {
 	DEFINE_DMA_UNMAP_ADDR(mapping);
 };
 
+struct tg3_rx_frag_info {
+	struct page			*page;
+	DEFINE_DMA_UNMAP_ADDR(mapping);
+};
+
 struct tg3_tx_ring_info {
 	struct sk_buff			*skb;
 	DEFINE_DMA_UNMAP_ADDR(mapping);
@@ -3023,6 +3031,7 @@ struct tg3_rx_prodring_set {
 	struct tg3_ext_rx_buffer_desc	*rx_jmb;
 	struct ring_info		*rx_std_buffers;
 	struct ring_info		*rx_jmb_buffers;
+	struct tg3_rx_frag_info		*rx_jmb_frags;
 	dma_addr_t			rx_std_mapping;
 	dma_addr_t			rx_jmb_mapping;
 };
@@ -3171,6 +3180,7 @@ enum TG3_FLAGS {
 
 	TG3_FLAG_IOV_CAPABLE,
 	TG3_FLAG_ENABLE_IOV,
+	TG3_FLAG_JUMBO_HDR_SPLIT,
 
 	/* Add new flags before this comment and TG3_FLAG_NUMBER_OF_FLAGS */
 	TG3_FLAG_NUMBER_OF_FLAGS,	/* Last entry in enum TG3_FLAGS */
@@ -1535,6 +1535,8 @@ static void tg3_netq_stats_get_strings(struct tg3 *tp, u8 *buf)
 		buf += ETH_GSTRING_LEN;
 		sprintf(buf, "[%d]: tx_bcast_packets", i);
 		buf += ETH_GSTRING_LEN;
+		sprintf(buf, "[%d]: rx_alloc_bytes", i);
+		buf += ETH_GSTRING_LEN;
 	}
 }
 
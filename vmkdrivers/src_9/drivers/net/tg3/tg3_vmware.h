@@ -89,6 +89,7 @@ static const struct {
 	{ "[0]: tx_ucast_packets" },
 	{ "[0]: tx_mcast_packets" },
 	{ "[0]: tx_bcast_packets" },
+	{ "[0]: rx_alloc_bytes" },
 };
 
 /*
@@ -108,6 +109,7 @@ struct tg3_netq_stats {
 	u64	tx_ucast_packets;
 	u64	tx_mcast_packets;
 	u64	tx_bcast_packets;
+	u64	rx_alloc_bytes;
 } __attribute__((packed));
 
 #define TG3_NETQ_NUM_STATS	(sizeof(struct tg3_netq_stats)/sizeof(u64))
@@ -124,6 +124,7 @@
 #define FNIC_RMDEVICE_TIMEOUT        1000       /* mSec */
 #define FNIC_HOST_RESET_SETTLE_TIME  30         /* Sec */
 #define FNIC_ABT_TERM_DELAY_TIMEOUT  500        /* mSec */
+#define FNIC_TAG_WAIT_TIMEOUT        2000       /* mSec */
 
 #define FNIC_MAX_FCP_TARGET     256
 
@@ -476,6 +476,7 @@ static ssize_t fnic_reset_stats_write(struct file *file,
 		memset(&stats->reset_stats, 0, sizeof(struct reset_stats));
 		memset(&stats->misc_stats, 0, sizeof(struct misc_stats));
 		memset(&stats->vlan_stats, 0, sizeof(struct vlan_stats));
+		memset(&stats->tag_stats, 0, sizeof(struct tag_stats));
 		memset(io_stats_p+1, 0,
 			sizeof(struct io_path_stats) - sizeof(u64));
 		memset(fw_stats_p+1, 0,
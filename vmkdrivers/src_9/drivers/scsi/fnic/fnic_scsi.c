@@ -2313,7 +2313,7 @@ int fnic_device_reset(struct scsi_cmnd *sc)
 #if !defined(__VMKLNX__)
 	if (scsi_cmd_get_tag(sc) < 1) {
 #endif /* !defined(__VMKLNX__) */
-		tag = scsi_host_start_tag(lp->host, sc);
+		tag = scsi_host_start_tag_wait(lp->host, sc);
 		if (tag == SCSI_NO_TAG)
 			goto fnic_device_reset_end;
 #if !defined(__VMKLNX__)
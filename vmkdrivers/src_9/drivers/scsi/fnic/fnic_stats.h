@@ -96,8 +96,26 @@ struct misc_stats {
 	atomic64_t frame_errors;
 };
 
+/*
+ * Tag allocation latency buckets: bucket 0 is below
+ * 2^FNIC_TAG_LAT_SHIFT cycles, bucket n covers [2^(n-1), 2^n) of
+ * that unit, the last bucket collects everything slower.
+ */
+#define FNIC_TAG_LAT_SHIFT	6
+#define FNIC_TAG_LAT_BUCKETS	16
+
+struct tag_stats {
+	atomic64_t alloc_lat[FNIC_TAG_LAT_BUCKETS];
+	atomic64_t fail_lat[FNIC_TAG_LAT_BUCKETS];
+	atomic64_t cache_refills;
+	atomic64_t cache_steals;
+	atomic64_t waits;
+	atomic64_t wait_timeouts;
+};
+
 struct fnic_stats {
 	struct io_path_stats io_stats;
+	struct tag_stats tag_stats;
 	struct abort_stats abts_stats;
 	struct terminate_stats term_stats;
 	struct reset_stats reset_stats;
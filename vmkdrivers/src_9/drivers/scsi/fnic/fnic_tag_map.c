@@ -27,7 +27,9 @@ static int fnic_init_tag_map(struct fnic_host_tag *fht, int depth)
 {
 	struct scsi_cmnd **tag_index = NULL;
 	unsigned long *tag_map = NULL;
+	struct fnic_tag_cache *cache = NULL;
 	int nr_ulongs;
+	int cpu;
 
 	tag_index = kzalloc(depth * sizeof(struct scsi_cmnd *), GFP_ATOMIC);
 	if (!tag_index)
@@ -39,10 +41,25 @@ static int fnic_init_tag_map(struct fnic_host_tag *fht, int depth)
 	if (!tag_map)
 		goto fail;
 
+	fht->nr_caches = num_online_cpus();
+	cache = kmalloc(fht->nr_caches * sizeof(*cache), GFP_ATOMIC);
+	if (!cache)
+		goto fail;
+	for (cpu = 0; cpu < fht->nr_caches; cpu++) {
+		struct fnic_tag_cache *c = &cache[cpu];
+
+		spin_lock_init(&c->lock);
+		c->nr_free = 0;
+	}
+
 	fht->max_depth = depth;
 	fht->tag_index = tag_index;
 	fht->tag_map = tag_map;
 	fht->next_tag = 1;
+	fht->cache = cache;
+	spin_lock_init(&fht->lock);
+	init_waitqueue_head(&fht->wait);
+	atomic_set(&fht->waiters, 0);
 
 	return 0;
 fail:
@@ -78,10 +95,23 @@ fail:
 
 static inline void fnic_free_tags(struct fnic_host_tag *fht)
 {
+	int cpu, i;
+
+	/* Tags parked in the per-CPU caches are free, not busy */
+	for (cpu = 0; cpu < fht->nr_caches; cpu++) {
+		struct fnic_tag_cache *c = &fht->cache[cpu];
+
+		for (i = 0; i < c->nr_free; i++)
+			clear_bit(c->free[i], fht->tag_map);
+		c->nr_free = 0;
+	}
 
 	BUG_ON(find_first_bit(fht->tag_map, fht->max_depth) <
 	       fht->max_depth);
 
+	kfree(fht->cache);
+	fht->cache = NULL;
+
 	kfree(fht->tag_index);
 	fht->tag_index = NULL;
 
@@ -100,33 +130,203 @@ void fnic_free_shared_tag_map(struct Scsi_Host *shost)
 	fnic_free_tags(fnic->tags);
 }
 
+/*
+ * fnic_tag_cache - the free tag cache of @cpu.  A CPU id past the end of
+ * the array wraps onto another CPU's cache, which is safe as caches are
+ * only used under their lock.
+ */
+static inline struct fnic_tag_cache *fnic_tag_cache(struct fnic_host_tag *fht,
+						    int cpu)
+{
+	return &fht->cache[cpu % fht->nr_caches];
+}
+
+/*
+ * fnic_tag_cache_refill - move up to FNIC_TAG_CACHE_BATCH free tags
+ * from the bitmap into cache @c.  Called with c->lock held.
+ */
+static int fnic_tag_cache_refill(struct fnic_host_tag *fht,
+				 struct fnic_tag_cache *c)
+{
+	int tag;
+	int wrapped = 0;
+
+	spin_lock(&fht->lock);
+	while (c->nr_free < FNIC_TAG_CACHE_BATCH) {
+		tag = find_next_zero_bit(fht->tag_map, fht->max_depth,
+					 fht->next_tag);
+		if ((tag < 1) || (tag >= fht->max_depth)) {
+			if (wrapped || fht->next_tag == 1)
+				break;
+			wrapped = 1;
+			fht->next_tag = 1;
+			continue;
+		}
+		__set_bit(tag, fht->tag_map);
+		c->free[c->nr_free++] = tag;
+		fht->next_tag = (tag < (fht->max_depth - 1)) ? tag + 1 : 1;
+	}
+	spin_unlock(&fht->lock);
+
+	return c->nr_free;
+}
+
+/*
+ * fnic_tag_cache_flush - return FNIC_TAG_CACHE_BATCH tags from cache
+ * @c to the bitmap.  Called with c->lock held.
+ */
+static void fnic_tag_cache_flush(struct fnic_host_tag *fht,
+				 struct fnic_tag_cache *c)
+{
+	int n = FNIC_TAG_CACHE_BATCH;
+
+	spin_lock(&fht->lock);
+	while (n-- && c->nr_free)
+		__clear_bit(c->free[--c->nr_free], fht->tag_map);
+	spin_unlock(&fht->lock);
+}
+
+/*
+ * fnic_tag_cache_steal - the bitmap is exhausted, but other CPUs may
+ * still hold free tags in their caches.  Take one from the first
+ * cache that has any.
+ */
+static int fnic_tag_cache_steal(struct fnic_host_tag *fht, int self)
+{
+	struct fnic_tag_cache *c;
+	unsigned long flags;
+	int cpu;
+	int tag = SCSI_NO_TAG;
+
+	for (cpu = 0; cpu < fht->nr_caches; cpu++) {
+		c = &fht->cache[cpu];
+		if (c == fnic_tag_cache(fht, self))
+			continue;
+		if (!c->nr_free)
+			continue;
+		spin_lock_irqsave(&c->lock, flags);
+		if (c->nr_free)
+			tag = c->free[--c->nr_free];
+		spin_unlock_irqrestore(&c->lock, flags);
+		if (tag != SCSI_NO_TAG)
+			break;
+	}
+
+	return tag;
+}
+
+static int fnic_tag_alloc(struct fnic_host_tag *fht, struct tag_stats *stats)
+{
+	struct fnic_tag_cache *c;
+	unsigned long flags;
+	int cpu = raw_smp_processor_id();
+	int tag = SCSI_NO_TAG;
+
+	c = fnic_tag_cache(fht, cpu);
+	spin_lock_irqsave(&c->lock, flags);
+	if (!c->nr_free && fnic_tag_cache_refill(fht, c))
+		atomic64_inc(&stats->cache_refills);
+	if (c->nr_free)
+		tag = c->free[--c->nr_free];
+	spin_unlock_irqrestore(&c->lock, flags);
+
+	if (tag == SCSI_NO_TAG) {
+		tag = fnic_tag_cache_steal(fht, cpu);
+		if (tag != SCSI_NO_TAG)
+			atomic64_inc(&stats->cache_steals);
+	}
+
+	return tag;
+}
+
+static void fnic_tag_free(struct fnic_host_tag *fht, int tag)
+{
+	struct fnic_tag_cache *c;
+	unsigned long flags;
+
+	c = fnic_tag_cache(fht, raw_smp_processor_id());
+	spin_lock_irqsave(&c->lock, flags);
+	if (c->nr_free == FNIC_TAG_CACHE_SIZE)
+		fnic_tag_cache_flush(fht, c);
+	c->free[c->nr_free++] = tag;
+	spin_unlock_irqrestore(&c->lock, flags);
+
+	/* Pairs with the barrier in fnic_host_start_tag_wait */
+	smp_mb();
+	if (atomic_read(&fht->waiters))
+		wake_up(&fht->wait);
+}
+
+static inline void fnic_tag_lat_account(atomic64_t *hist, cycles_t start)
+{
+	u64 delta = (u64)(get_cycles() - start) >> FNIC_TAG_LAT_SHIFT;
+	int bucket = delta ? fls64(delta) : 0;
+
+	if (bucket >= FNIC_TAG_LAT_BUCKETS)
+		bucket = FNIC_TAG_LAT_BUCKETS - 1;
+	atomic64_inc(&hist[bucket]);
+}
+
 int fnic_host_start_tag(struct Scsi_Host *shost, struct scsi_cmnd *sc)
 {
 
 	struct fc_lport *lp = shost_priv(shost);
 	struct fnic *fnic = lport_priv(lp);
 	struct fnic_host_tag *fht = fnic->tags;
-	struct fnic_stats fnic_stats = fnic->fnic_stats;
+	struct fnic_stats *fnic_stats = &fnic->fnic_stats;
+	cycles_t start = get_cycles();
 	int tag;
-	unsigned long flags;
 
-	spin_lock_irqsave(&fnic->fnic_lock, flags);
-	tag = find_next_zero_bit(fht->tag_map, fht->max_depth, fht->next_tag);
-	if (((tag < 1) || (tag >= fht->max_depth)) && (fht->next_tag > 1)) {
-		tag = find_next_zero_bit(fht->tag_map, fht->max_depth, 1);
+	tag = fnic_tag_alloc(fht, &fnic_stats->tag_stats);
+	if (tag == SCSI_NO_TAG) {
+		fnic_tag_lat_account(fnic_stats->tag_stats.fail_lat, start);
+		atomic64_inc(&fnic_stats->io_stats.tag_alloc_failures);
+		if (printk_ratelimit())
+			printk(KERN_ERR "Tag allocation failure next_tag "
+			       "(0x%x)\n", fht->next_tag);
+		return SCSI_NO_TAG;
 	}
-	if ((tag < 1) || (tag >= fht->max_depth)) {
-		atomic64_inc(&fnic_stats.io_stats.tag_alloc_failures);
-		spin_unlock_irqrestore(&fnic->fnic_lock, flags);
-		printk(KERN_ERR "Tag allocation failure next_tag (0x%x)\n",
-		       fht->next_tag);
+	fht->tag_index[tag] = sc;
+	CMD_TAG(sc) = tag;
+	fnic_tag_lat_account(fnic_stats->tag_stats.alloc_lat, start);
+
+	return tag;
+}
+
+/*
+ * fnic_host_start_tag_wait - like fnic_host_start_tag, but sleep up to
+ * @timeout_ms for a tag to be freed rather than failing right away.
+ * Only for callers that may sleep, e.g. the error handler.
+ */
+int fnic_host_start_tag_wait(struct Scsi_Host *shost, struct scsi_cmnd *sc,
+			     unsigned int timeout_ms)
+{
+	struct fc_lport *lp = shost_priv(shost);
+	struct fnic *fnic = lport_priv(lp);
+	struct fnic_host_tag *fht = fnic->tags;
+	struct tag_stats *tag_stats = &fnic->fnic_stats.tag_stats;
+	cycles_t start = get_cycles();
+	int tag;
+
+	tag = fnic_tag_alloc(fht, tag_stats);
+	if (tag == SCSI_NO_TAG) {
+		atomic64_inc(&tag_stats->waits);
+		atomic_inc(&fht->waiters);
+		smp_mb();
+		wait_event_timeout(fht->wait,
+			(tag = fnic_tag_alloc(fht, tag_stats)) != SCSI_NO_TAG,
+			msecs_to_jiffies(timeout_ms));
+		atomic_dec(&fht->waiters);
+	}
+	if (tag == SCSI_NO_TAG) {
+		fnic_tag_lat_account(tag_stats->fail_lat, start);
+		atomic64_inc(&tag_stats->wait_timeouts);
+		atomic64_inc(&fnic->fnic_stats.io_stats.tag_alloc_failures);
 		return SCSI_NO_TAG;
 	}
-	fht->next_tag = (tag < (fht->max_depth - 1)) ? tag + 1 : 1;
-	set_bit(tag, fht->tag_map);
 	fht->tag_index[tag] = sc;
 	CMD_TAG(sc) = tag;
-	spin_unlock_irqrestore(&fnic->fnic_lock, flags);
+	fnic_tag_lat_account(tag_stats->alloc_lat, start);
 
 	return tag;
 }
@@ -137,7 +337,6 @@ void fnic_host_end_tag(struct Scsi_Host *shost, struct scsi_cmnd *sc)
 	struct fnic *fnic = lport_priv(lp);
 	struct fnic_host_tag *fht = fnic->tags;
 	int tag = CMD_TAG(sc);
-	unsigned long flags;
 
 	BUG_ON(tag == SCSI_NO_TAG);
 
@@ -147,7 +346,6 @@ void fnic_host_end_tag(struct Scsi_Host *shost, struct scsi_cmnd *sc)
 		return;
 	}
 
-	spin_lock_irqsave(&fnic->fnic_lock, flags);
 	if (unlikely(fht->tag_index[tag] == NULL)) {
 		printk(KERN_ERR "Tag 0x%x is missing sc 0x%p\n",
 		       tag, sc);
@@ -155,7 +353,6 @@ void fnic_host_end_tag(struct Scsi_Host *shost, struct scsi_cmnd *sc)
 	if (unlikely(fht->tag_index[tag] != sc)) {
 		printk(KERN_ERR "Tag 0x%x does not match sc 0x%p  0x%p\n",
 		      tag, sc, fht->tag_index[tag]);
-		spin_unlock_irqrestore(&fnic->fnic_lock, flags);
 		return;
 	}
 
@@ -164,18 +361,19 @@ void fnic_host_end_tag(struct Scsi_Host *shost, struct scsi_cmnd *sc)
 
 	if (unlikely(!test_bit(tag, fht->tag_map))) {
 		printk(KERN_ERR "Attempt to clear non-busy tag (0x%x)\n", tag);
-		spin_unlock_irqrestore(&fnic->fnic_lock, flags);
 		return;
 	}
 
-	clear_bit(tag, fht->tag_map);
-	spin_unlock_irqrestore(&fnic->fnic_lock, flags);
+	fnic_tag_free(fht, tag);
 }
 
 static inline struct scsi_cmnd *fnic_find_tag(struct fnic_host_tag *fht,
 					      int tag)
 {
-	/* Called with fnic_lock held */
+	/*
+	 * tag_index is not protected by fnic_lock; callers revalidate
+	 * the command under its io_lock before using it.
+	 */
 	if (unlikely(fht == NULL || tag >= fht->max_depth || tag < 1))
 		return NULL;
 	return fht->tag_index[tag];
@@ -186,7 +384,6 @@ struct scsi_cmnd *fnic_host_find_tag(struct Scsi_Host *shost, int tag)
 	struct fc_lport *lp = shost_priv(shost);
 	struct fnic *fnic = lport_priv(lp);
 
-	/* Called with fnic_lock held */
 	if (tag != SCSI_NO_TAG)
 		return fnic_find_tag(fnic->tags, tag);
 	return NULL;
@@ -35,6 +35,7 @@
 #include <linux/spinlock.h>
 #include <linux/kthread.h>
 #include <linux/bitops.h>
+#include <linux/wait.h>
 #include <asm/atomic.h>
 #include <scsi/scsi.h>
 #include <scsi/scsi_host.h>
@@ -51,6 +52,8 @@
 
 #define scsi_init_shared_tag_map         fnic_init_shared_tag_map
 #define scsi_host_start_tag(shost, sc)   fnic_host_start_tag(shost, sc)
+#define scsi_host_start_tag_wait(shost, sc) \
+	fnic_host_start_tag_wait(shost, sc, FNIC_TAG_WAIT_TIMEOUT)
 #define scsi_host_find_tag               fnic_host_find_tag
 #define scsi_host_end_tag(shost, sc)     fnic_host_end_tag(shost, sc)
 #define scsi_free_shared_tag_map(shost)  fnic_free_shared_tag_map(shost)
@@ -63,16 +66,39 @@ do { \
 	clear_bit(nr, addr); \
 } while (0); \
 
+/*
+ * Free tags are parked in small per-CPU caches so that the common
+ * start/end tag pair never touches shared state.  A cache is refilled
+ * from (and overflows back into) the bitmap FNIC_TAG_CACHE_BATCH tags
+ * at a time under fht->lock.  vmklinux has no per-CPU allocator, so the
+ * caches are a kmalloc'd array of nr_caches entries, one per online CPU.
+ */
+#define FNIC_TAG_CACHE_SIZE	32
+#define FNIC_TAG_CACHE_BATCH	16
+
+struct fnic_tag_cache {
+	spinlock_t lock;
+	int nr_free;
+	u16 free[FNIC_TAG_CACHE_SIZE];
+} ____cacheline_aligned_in_smp;
+
 struct fnic_host_tag {
 	struct scsi_cmnd **tag_index;	/* map of busy tags */
-	unsigned long *tag_map;		/* bit map of free/busy tags */
+	unsigned long *tag_map;		/* bit set: busy or parked in a cache */
 	int max_depth;			/* what we will send to device */
 	int next_tag;			/* Most recently allocated tag */
+	spinlock_t lock;		/* protects tag_map and next_tag */
+	struct fnic_tag_cache *cache;	/* per-CPU free tag caches */
+	int nr_caches;
+	wait_queue_head_t wait;		/* sleepers in start_tag_wait */
+	atomic_t waiters;
 };
 
 int fnic_init_shared_tag_map(struct Scsi_Host *shost, int depth);
 void fnic_free_shared_tag_map(struct Scsi_Host *shost);
 int fnic_host_start_tag(struct Scsi_Host *shost, struct scsi_cmnd *sc);
+int fnic_host_start_tag_wait(struct Scsi_Host *shost, struct scsi_cmnd *sc,
+			     unsigned int timeout_ms);
 void fnic_host_end_tag(struct Scsi_Host *shost, struct scsi_cmnd *sc);
 struct scsi_cmnd *fnic_host_find_tag(struct Scsi_Host *shost, int tag);
 
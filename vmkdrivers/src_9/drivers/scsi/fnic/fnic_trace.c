@@ -21,6 +21,8 @@
 #include <linux/mempool.h>
 #include <linux/errno.h>
 #include <linux/spinlock.h>
+#include <linux/vmalloc.h>
+#include <linux/log2.h>
 #include <linux/version.h>
 #include "fnic_io.h"
 #include "fnic.h"
@@ -29,147 +31,161 @@
 unsigned int trace_max_pages;
 int fnic_max_trace_entries;
 
-static u64 fnic_trace_buf_p;
-DEFINE_SPINLOCK(fnic_trace_lock);
-
-static fnic_trace_dbg_t fnic_trace_entries;
+/*
+ * One ring per online CPU.  vmklinux has no per-CPU allocator, so the
+ * rings are a kmalloc'd array; a CPU id past its end wraps onto another
+ * ring, which is safe since entries are reserved atomically.
+ */
+static fnic_trace_ring_t *fnic_trace_rings;
+static unsigned int fnic_trace_nr_rings;
 int fnic_tracing_enabled = 1;
 
+/*
+ * Trace timestamps are cycle counts; this pair, taken when the rings are
+ * set up, lets the reader turn them back into time since boot.
+ */
+static u64 fnic_trace_base_cycles;
+static unsigned long fnic_trace_base_jiffies;
+
 /*
  * fnic_trace_get_buf - Give buffer pointer to user to fill up trace information
  *
  * Description:
- * This routine gets next available trace buffer entry location @wr_idx
- * from allocated trace buffer pages and give that memory location
- * to user to store the trace information.
+ * This routine reserves the next trace entry on the current CPU's ring
+ * and gives that memory location to user to store the trace information.
+ * The oldest entry of the ring is overwritten once it is full.
  *
  * Return Value:
- * This routine returns pointer to next available trace entry
- * @fnic_buf_head for user to fill trace information.
+ * This routine returns pointer to next available trace entry for user
+ * to fill trace information.
  */
 fnic_trace_data_t *fnic_trace_get_buf()
 {
-	u64 fnic_buf_head;
-	unsigned long flags;
-
-	spin_lock_irqsave(&fnic_trace_lock, flags);
-
-	/*
-	 * Get next available memory location for writing trace information
-	 * at @wr_idx and increment @wr_idx
-	 */
-	fnic_buf_head =
-		fnic_trace_entries.page_offset[fnic_trace_entries.wr_idx];
-	fnic_trace_entries.wr_idx++;
-
-	/*
-	 * Verify if trace buffer is full then change wd_idx to
-	 * start from zero
-	 */
-	if (fnic_trace_entries.wr_idx >= fnic_max_trace_entries)
-		fnic_trace_entries.wr_idx = 0;
-
-	/*
-	 * Verify if write index @wr_idx and read index @rd_idx are same then
-	 * increment @rd_idx to move to next entry in trace buffer
-	 */
-	if (fnic_trace_entries.wr_idx == fnic_trace_entries.rd_idx) {
-		fnic_trace_entries.rd_idx++;
-		if (fnic_trace_entries.rd_idx >= fnic_max_trace_entries)
-			fnic_trace_entries.rd_idx = 0;
+	fnic_trace_ring_t *ring;
+	unsigned int idx;
+
+	if (unlikely(!fnic_trace_rings))
+		return NULL;
+
+	ring = &fnic_trace_rings[raw_smp_processor_id() % fnic_trace_nr_rings];
+	idx = (unsigned int)atomic_inc_return(&ring->wr) - 1;
+	return &ring->buf[idx % ring->nr_entries];
+}
+
+/*
+ * fnic_trace_cycles_per_ms - cycle counter rate since the rings were set up
+ */
+static u32 fnic_trace_cycles_per_ms(void)
+{
+	u64 cycles = get_cycles() - fnic_trace_base_cycles;
+	unsigned int ms = jiffies_to_msecs(jiffies - fnic_trace_base_jiffies);
+
+	if (!ms)
+		return 0;
+	do_div(cycles, ms);
+	return (u32)cycles;
+}
+
+/*
+ * fnic_trace_timestamp - convert an entry's cycle count to time since boot
+ */
+static void fnic_trace_timestamp(u64 timestamp, u32 cycles_per_ms,
+				 struct timespec *val)
+{
+	u64 delta, ns;
+	u32 rem;
+
+	if (!cycles_per_ms || timestamp < fnic_trace_base_cycles) {
+		val->tv_sec = 0;
+		val->tv_nsec = 0;
+		return;
 	}
-	spin_unlock_irqrestore(&fnic_trace_lock, flags);
-	return (fnic_trace_data_t *)fnic_buf_head;
+	delta = timestamp - fnic_trace_base_cycles;
+	rem = do_div(delta, cycles_per_ms);		/* delta is now in ms */
+	ns = (u64)rem * NSEC_PER_MSEC;
+	do_div(ns, cycles_per_ms);
+	ns += (delta + jiffies_to_msecs(fnic_trace_base_jiffies)) *
+	      NSEC_PER_MSEC;
+	val->tv_nsec = do_div(ns, NSEC_PER_SEC);
+	val->tv_sec = ns;
 }
 
+struct fnic_trace_cursor {
+	unsigned int rd;	/* next entry to dump */
+	unsigned int wr;	/* end of the snapshot */
+};
+
 /*
  * fnic_get_trace_data - Copy trace buffer to a memory file
  * @fnic_dbgfs_t: pointer to debugfs trace buffer
  *
  * Description:
- * This routine gathers the fnic trace debugfs data from the fnic_trace_data_t
- * buffer and dumps it to fnic_dbgfs_t. It will start at the rd_idx entry in
- * the log and process the log until the end of the buffer. Then it will gather
- * from the beginning of the log and process until the current entry @wr_idx.
+ * This routine gathers the fnic trace debugfs data from the per-CPU
+ * rings and dumps it to fnic_dbgfs_t, oldest entry first.  Each ring is
+ * already in time order, so the rings are merged by always dumping the
+ * ring head with the smallest timestamp.  The rings are read without
+ * stopping the writers: entries overwritten during the dump may come out
+ * torn, which is acceptable for a trace.
  *
  * Return Value:
  * This routine returns the amount of bytes that were dumped into fnic_dbgfs_t
  */
 int fnic_get_trace_data(fnic_dbgfs_t *fnic_dbgfs_prt)
 {
-	int rd_idx;
-	int wr_idx;
-	int len = 0;
-	unsigned long flags;
+	struct fnic_trace_cursor *cursor;
+	fnic_trace_ring_t *ring;
+	fnic_trace_data_t *tbp, *next;
 	struct timespec val;
-	fnic_trace_data_t *tbp;
-
-	spin_lock_irqsave(&fnic_trace_lock, flags);
-	rd_idx = fnic_trace_entries.rd_idx;
-	wr_idx = fnic_trace_entries.wr_idx;
-	if (wr_idx < rd_idx) {
-		while (1) {
-			/* Start from read index @rd_idx */
-			tbp = (fnic_trace_data_t *)
-				  fnic_trace_entries.page_offset[rd_idx];
-			if (!tbp)
-				return 0;
-			jiffies_to_timespec(tbp->timestamp, &val);
-			/*
-			 * Dump trace buffer entry to memory file
-			 * and increment read index @rd_idx
-			 */
-			len += snprintf(fnic_dbgfs_prt->buffer + len,
-				  (trace_max_pages * PAGE_SIZE * 3) - len,
-				  "%16lu.%16lu %16llx %8x %8x %16llx %16llx "
-				  "%16llx %16llx %16llx\n", val.tv_sec,
-				  val.tv_nsec, tbp->fnaddr, tbp->host_no,
-				  tbp->tag, tbp->data[0], tbp->data[1],
-				  tbp->data[2], tbp->data[3], tbp->data[4]);
-			rd_idx++;
-			/*
-			 * If rd_idx is reached to maximum trace entries
-			 * then move rd_idx to zero
-			 */
-			if (rd_idx > (fnic_max_trace_entries-1))
-				rd_idx = 0;
-			/*
-			 * Continure dumpping trace buffer entries into
-			 * memory file till rd_idx reaches write index
-			 */
-			if (rd_idx == wr_idx)
-				break;
-		}
-	} else if (wr_idx > rd_idx) {
-		while (1) {
-			/* Start from read index @rd_idx */
-			tbp = (fnic_trace_data_t *)
-				  fnic_trace_entries.page_offset[rd_idx];
-			if (!tbp)
-				return 0;
-			jiffies_to_timespec(tbp->timestamp, &val);
-			/*
-			 * Dump trace buffer entry to memory file
-			 * and increment read index @rd_idx
-			 */
-			len += snprintf(fnic_dbgfs_prt->buffer + len,
-				  (trace_max_pages * PAGE_SIZE * 3) - len,
-				  "%16lu.%16lu %16llx %8x %8x %16llx %16llx "
-				  "%16llx %16llx %16llx\n", val.tv_sec,
-				  val.tv_nsec, tbp->fnaddr, tbp->host_no,
-				  tbp->tag, tbp->data[0], tbp->data[1],
-				  tbp->data[2], tbp->data[3], tbp->data[4]);
-			rd_idx++;
-			/*
-			 * Continue dumpping trace buffer entries into
-			 * memory file till rd_idx reaches write index
-			 */
-			if (rd_idx == wr_idx)
-				break;
+	u32 cycles_per_ms;
+	int buf_size = trace_max_pages * PAGE_SIZE * 3;
+	int len = 0;
+	int cpu, best;
+
+	if (!fnic_trace_rings)
+		return 0;
+
+	cursor = kmalloc(fnic_trace_nr_rings * sizeof(*cursor), GFP_KERNEL);
+	if (!cursor)
+		return 0;
+
+	for (cpu = 0; cpu < fnic_trace_nr_rings; cpu++) {
+		ring = &fnic_trace_rings[cpu];
+		cursor[cpu].wr = (unsigned int)atomic_read(&ring->wr);
+		cursor[cpu].rd = cursor[cpu].wr > ring->nr_entries ?
+				 cursor[cpu].wr - ring->nr_entries : 0;
+	}
+	cycles_per_ms = fnic_trace_cycles_per_ms();
+
+	while (len < buf_size) {
+		best = -1;
+		tbp = NULL;
+		for (cpu = 0; cpu < fnic_trace_nr_rings; cpu++) {
+			if (cursor[cpu].rd == cursor[cpu].wr)
+				continue;
+			ring = &fnic_trace_rings[cpu];
+			next = &ring->buf[cursor[cpu].rd % ring->nr_entries];
+			if (!tbp || next->timestamp < tbp->timestamp) {
+				tbp = next;
+				best = cpu;
+			}
 		}
+		if (best < 0)
+			break;
+		cursor[best].rd++;
+
+		fnic_trace_timestamp(tbp->timestamp, cycles_per_ms, &val);
+		/*
+		 * Dump trace buffer entry to memory file
+		 */
+		len += snprintf(fnic_dbgfs_prt->buffer + len, buf_size - len,
+			  "%16lu.%16lu %16llx %8x %8x %16llx %16llx "
+			  "%16llx %16llx %16llx\n", val.tv_sec,
+			  val.tv_nsec, tbp->fnaddr, tbp->host_no,
+			  tbp->tag, tbp->data[0], tbp->data[1],
+			  tbp->data[2], tbp->data[3], tbp->data[4]);
 	}
-	spin_unlock_irqrestore(&fnic_trace_lock, flags);
-	return len;
+	kfree(cursor);
+	return min(len, buf_size - 1);
 }
 
 /*
@@ -189,6 +205,7 @@ int fnic_get_stats_data(struct stats_debug_info *debug, struct fnic_stats *stats
 	int len = 0;
 	int buf_size = debug->buf_size;
 	struct timespec val1, val2;
+	int i;
 
 	len = snprintf(debug->debug_buffer + len, buf_size - len,
 		  "------------------------------------------\n"
@@ -213,6 +230,37 @@ int fnic_get_stats_data(struct stats_debug_info *debug, struct fnic_stats *stats
 		  (u64)atomic64_read(&stats->io_stats.ioreq_null),
 		  (u64)atomic64_read(&stats->io_stats.sc_null));
 
+	len += snprintf(debug->debug_buffer + len, buf_size - len,
+		  "\n------------------------------------------\n"
+		  "\t\tTag Allocation Statistics\n"
+		  "------------------------------------------\n");
+
+	len += snprintf(debug->debug_buffer + len, buf_size - len,
+		  "Number of Cache Refills: %lld\n"
+		  "Number of Cache Steals: %lld\n"
+		  "Number of Tag Waits: %lld\n"
+		  "Number of Tag Wait Timeouts: %lld\n"
+		  "Latency (cycles)      Allocated       Failed\n",
+		  (u64)atomic64_read(&stats->tag_stats.cache_refills),
+		  (u64)atomic64_read(&stats->tag_stats.cache_steals),
+		  (u64)atomic64_read(&stats->tag_stats.waits),
+		  (u64)atomic64_read(&stats->tag_stats.wait_timeouts));
+
+	for (i = 0; i < FNIC_TAG_LAT_BUCKETS; i++) {
+		if (i == FNIC_TAG_LAT_BUCKETS - 1)
+			len += snprintf(debug->debug_buffer + len,
+				  buf_size - len, ">= %-13llu",
+				  1ULL << (FNIC_TAG_LAT_SHIFT + i - 1));
+		else
+			len += snprintf(debug->debug_buffer + len,
+				  buf_size - len, "<  %-13llu",
+				  1ULL << (FNIC_TAG_LAT_SHIFT + i));
+		len += snprintf(debug->debug_buffer + len, buf_size - len,
+			  "  %-14lld  %lld\n",
+			  (u64)atomic64_read(&stats->tag_stats.alloc_lat[i]),
+			  (u64)atomic64_read(&stats->tag_stats.fail_lat[i]));
+	}
+
 	len += snprintf(debug->debug_buffer + len, buf_size - len,
 		  "\n------------------------------------------\n"
 		  "\t\tAbort Statistics\n"
@@ -354,62 +402,81 @@ int fnic_get_stats_data(struct stats_debug_info *debug, struct fnic_stats *stats
 
 }
 
+/*
+ * fnic_trace_free_rings - Free the per-CPU trace rings
+ */
+static void fnic_trace_free_rings(void)
+{
+	fnic_trace_ring_t *ring;
+	int cpu;
+
+	if (!fnic_trace_rings)
+		return;
+	for (cpu = 0; cpu < fnic_trace_nr_rings; cpu++) {
+		ring = &fnic_trace_rings[cpu];
+		if (ring->buf)
+			vfree(ring->buf);
+	}
+	kfree(fnic_trace_rings);
+	fnic_trace_rings = NULL;
+}
+
 /*
  * fnic_trace_buf_init - Initialize fnic trace buffer logging facility
  *
  * Description:
- * Initialize trace buffer data structure by allocating required memory and
- * setting page_offset information for every trace entry by adding trace entry
- * length to previous page_offset value.
+ * Initialize trace buffer data structure by allocating one ring per
+ * online CPU.  The fnic_trace_max_pages budget is split evenly between
+ * the rings, a power of two pages each; trace_max_pages is the total
+ * actually allocated, which the readers size their buffers by.
  */
 int fnic_trace_buf_init()
 {
-	u64 fnic_buf_head;
-	int i;
+	fnic_trace_ring_t *ring;
+	unsigned int cpu_pages;
+	int cpu;
 	int err = 0;
 
-	trace_max_pages = fnic_trace_max_pages;
+	/* a power of two keeps the ring index continuous when @wr wraps */
+	fnic_trace_nr_rings = num_online_cpus();
+	cpu_pages = fnic_trace_max_pages / fnic_trace_nr_rings;
+	cpu_pages = cpu_pages ? rounddown_pow_of_two(cpu_pages) : 1;
+	trace_max_pages = cpu_pages * fnic_trace_nr_rings;
 	fnic_max_trace_entries = (trace_max_pages * PAGE_SIZE)/
 					  FNIC_ENTRY_SIZE_BYTES;
 
-	fnic_trace_buf_p = (u64)vmalloc((trace_max_pages * PAGE_SIZE));
-	if (!fnic_trace_buf_p) {
+	fnic_trace_rings = kzalloc(fnic_trace_nr_rings *
+				   sizeof(*fnic_trace_rings), GFP_KERNEL);
+	if (!fnic_trace_rings) {
 		printk(KERN_ERR PFX "Failed to allocate memory "
-				  "for fnic_trace_buf_p\n");
+				  "for fnic trace rings\n");
 		err = -ENOMEM;
 		goto err_fnic_trace_buf_init;
 	}
-	memset((void *)fnic_trace_buf_p, 0, (trace_max_pages * PAGE_SIZE));
-
-	fnic_trace_entries.page_offset = (u64 *)vmalloc(fnic_max_trace_entries *
-						  sizeof(unsigned long long));
-	if (!fnic_trace_entries.page_offset) {
-		printk(KERN_ERR PFX "Failed to allocate memory for"
-				  " page_offset\n");
-		if (fnic_trace_buf_p) {
-			vfree((void *)fnic_trace_buf_p);
-			fnic_trace_buf_p = 0;
+
+	for (cpu = 0; cpu < fnic_trace_nr_rings; cpu++) {
+		ring = &fnic_trace_rings[cpu];
+		atomic_set(&ring->wr, 0);
+		ring->nr_entries = (cpu_pages * PAGE_SIZE) /
+				   FNIC_ENTRY_SIZE_BYTES;
+		ring->buf = vmalloc(cpu_pages * PAGE_SIZE);
+		if (!ring->buf) {
+			printk(KERN_ERR PFX "Failed to allocate memory "
+					  "for fnic trace ring\n");
+			err = -ENOMEM;
+			goto err_fnic_trace_free_rings;
 		}
-		err = -ENOMEM;
-		goto err_fnic_trace_buf_init;
-	}
-	memset((void *)fnic_trace_entries.page_offset, 0,
-		  (fnic_max_trace_entries * sizeof(unsigned long long)));
-	fnic_trace_entries.wr_idx = fnic_trace_entries.rd_idx = 0;
-	fnic_buf_head = fnic_trace_buf_p;
-
-	/*
-	 * Set page_offset field of fnic_trace_entries struct by
-	 * calculating memory location for every trace entry using
-	 * length of each trace entry
-	 */
-	for (i = 0; i < fnic_max_trace_entries; i++) {
-		fnic_trace_entries.page_offset[i] = fnic_buf_head;
-		fnic_buf_head += FNIC_ENTRY_SIZE_BYTES;
+		memset(ring->buf, 0, cpu_pages * PAGE_SIZE);
 	}
+
+	fnic_trace_base_jiffies = jiffies;
+	fnic_trace_base_cycles = get_cycles();
 	fnic_ioctl_init();
 	printk(KERN_INFO PFX "Successfully Initialized Trace Buffer\n");
 	return err;
+
+err_fnic_trace_free_rings:
+	fnic_trace_free_rings();
 err_fnic_trace_buf_init:
 	return err;
 }
@@ -421,13 +488,6 @@ void fnic_trace_free()
 {
 	fnic_tracing_enabled = 0;
 	fnic_ioctl_exit();
-	if (fnic_trace_entries.page_offset) {
-		vfree((void *)fnic_trace_entries.page_offset);
-		fnic_trace_entries.page_offset = 0;
-	}
-	if (fnic_trace_buf_p) {
-		vfree((void *)fnic_trace_buf_p);
-		fnic_trace_buf_p = 0;
-	}
+	fnic_trace_free_rings();
 	printk(KERN_INFO PFX "Successfully Freed Trace Buffer\n");
 }
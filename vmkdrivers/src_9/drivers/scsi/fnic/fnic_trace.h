@@ -27,11 +27,17 @@ extern unsigned int fnic_trace_max_pages;
 extern int fnic_tracing_enabled;
 extern unsigned int trace_max_pages;
 
-typedef struct fnic_trace_dbg {
-	int wr_idx;
-	int rd_idx;
-	unsigned long long *page_offset;
-} fnic_trace_dbg_t;
+/*
+ * One trace ring per CPU.  @wr counts the entries ever reserved on the
+ * ring; the slot of entry n is n % @nr_entries.  Writers reserve with an
+ * atomic increment on their own CPU's ring, so no lock is shared between
+ * CPUs and nesting from interrupt context is safe.
+ */
+typedef struct fnic_trace_ring {
+	atomic_t wr;
+	int nr_entries;
+	struct fnic_trace_data *buf;
+} ____cacheline_aligned_in_smp fnic_trace_ring_t;
 
 typedef struct fnic_dbgfs {
 	int buffer_len;
@@ -55,7 +61,7 @@ typedef struct fnic_trace_data fnic_trace_data_t;
 	if (unlikely(fnic_tracing_enabled)) {                   \
 		fnic_trace_data_t *trace_buf = fnic_trace_get_buf(); \
 		if (trace_buf) { \
-			trace_buf->timestamp = jiffies; \
+			trace_buf->timestamp = get_cycles(); \
 			trace_buf->fnaddr = _fn; \
 			trace_buf->host_no = _hn; \
 			trace_buf->tag = _t; \
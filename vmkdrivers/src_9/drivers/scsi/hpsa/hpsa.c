@@ -47,6 +47,7 @@
 #include <linux/cciss_ioctl.h>
 #include <linux/string.h>
 #include <linux/bitmap.h>
+#include <linux/log2.h>
 #include <asm/atomic.h>
 #include <linux/jiffies.h>
 #include <linux/workqueue.h>
@@ -290,6 +291,7 @@ static int hpsa_compat_ioctl(struct scsi_device *dev, int cmd, void *arg);
 
 static void cmd_free(struct ctlr_info *h, struct CommandList *c);
 static struct CommandList *cmd_alloc(struct ctlr_info *h);
+static struct CommandList *cmd_alloc_io(struct ctlr_info *h);
 static int fill_cmd(struct CommandList *c, u8 cmd, struct ctlr_info *h,
 	void *buff, size_t size, u16 page_code, unsigned char *scsi3addr,
 	int cmd_type);
@@ -1305,6 +1307,7 @@ static void hpsa_scsi_update_entry(struct ctlr_info *h, int hostno,
 		 * h->dev[entry]->offload_enabled is currently 0.
 		 */
 		h->dev[entry]->raid_map = new_entry->raid_map;
+		h->dev[entry]->raid_geom = new_entry->raid_geom;
 		h->dev[entry]->ioaccel_handle = new_entry->ioaccel_handle;
 	}
 	if (new_entry->hba_ioaccel_enabled) {
@@ -2965,6 +2968,92 @@ static void hpsa_debug_map_buff(__attribute__((unused)) struct ctlr_info *h,
 }
 #endif
 
+/*
+ * Prepare d for hpsa_div32()/hpsa_div64().  Non-powers of 2 use the
+ * round-up reciprocal method (Granlund & Montgomery), which is exact for
+ * every 32-bit dividend.
+ */
+static void hpsa_div_init(struct hpsa_div *dv, u32 d)
+{
+	u64 m;
+	int l;
+
+	memset(dv, 0, sizeof(*dv));
+	dv->d = d;
+	if (is_power_of_2(d)) {
+		dv->shift = ilog2(d);
+		return;
+	}
+	l = fls(d - 1);
+	m = (1ULL << 32) * ((1ULL << l) - d);
+	do_div(m, d);
+	dv->m = (u32) m + 1;
+	dv->sh1 = 1;
+	dv->sh2 = l - 1;
+}
+
+static inline u32 hpsa_div32(u32 n, const struct hpsa_div *dv)
+{
+	u32 t;
+
+	if (!dv->m)
+		return n >> dv->shift;
+	t = (u32) (((u64) n * dv->m) >> 32);
+	return (t + ((n - t) >> dv->sh1)) >> dv->sh2;
+}
+
+static inline u32 hpsa_mod32(u32 n, const struct hpsa_div *dv)
+{
+	return n - hpsa_div32(n, dv) * dv->d;
+}
+
+/* Volumes past 2^32 blocks with odd geometry still need a real divide. */
+static inline u64 hpsa_div64(u64 n, const struct hpsa_div *dv, u32 *rem)
+{
+	u64 q;
+
+	if (!dv->m) {
+		*rem = (u32) n & (dv->d - 1);
+		return n >> dv->shift;
+	}
+	if (n <= 0xffffffffULL) {
+		q = hpsa_div32((u32) n, dv);
+		*rem = (u32) n - (u32) q * dv->d;
+		return q;
+	}
+	q = n;
+	*rem = do_div(q, dv->d);
+	return q;
+}
+
+/*
+ * Precompute the geometry hpsa_scsi_ioaccel_raid_map() needs, so that
+ * mapping an I/O takes no 64-bit divisions in the common case.  A map
+ * with a zero strip size, disk count or row count is left invalid and
+ * its I/O goes down the normal path.
+ */
+static void hpsa_compute_raid_geom(struct hpsa_scsi_dev_t *dev)
+{
+	struct raid_map_data *map = &dev->raid_map;
+	struct hpsa_raid_geom *geom = &dev->raid_geom;
+	u32 blocks_per_row;
+
+	memset(geom, 0, sizeof(*geom));
+	blocks_per_row = map->data_disks_per_row * map->strip_size;
+	if (blocks_per_row == 0 || map->row_cnt == 0)
+		return;
+
+	geom->total_disks_per_row = map->data_disks_per_row +
+					map->metadata_disks_per_row;
+	geom->group_entries = map->row_cnt * geom->total_disks_per_row;
+	hpsa_div_init(&geom->strip, map->strip_size);
+	hpsa_div_init(&geom->row, blocks_per_row);
+	hpsa_div_init(&geom->row_cnt, map->row_cnt);
+	hpsa_div_init(&geom->stripe,
+		blocks_per_row * max_t(u32, map->layout_map_count, 1));
+	geom->valid = 1;
+}
+
 static int hpsa_get_raid_map(struct ctlr_info *h,
 	unsigned char *scsi3addr, struct hpsa_scsi_dev_t *this_device)
 {
@@ -3000,6 +3089,8 @@ out:
 		dev_warn(&h->pdev->dev, "RAID map size is too large!\n");
 		rc = -1;
 	}
+	if (rc == 0)
+		hpsa_compute_raid_geom(this_device);
 	hpsa_debug_map_buff(h, rc, &this_device->raid_map);
 	return rc;
 }
@@ -4840,21 +4931,18 @@ static int hpsa_scsi_ioaccel_raid_map(struct ctlr_info *h,
 	struct hpsa_scsi_dev_t *dev = cmd->device->hostdata;
 	struct raid_map_data *map = &dev->raid_map;
 	struct raid_map_disk_data *dd = &map->data[0];
+	struct hpsa_raid_geom *geom = &dev->raid_geom;
 	int is_write = 0;
 	u32 map_index;
 	u64 first_block, last_block;
 	u32 block_cnt;
-	u32 blocks_per_row;
 	u64 first_row, last_row;
 	u32 first_row_offset, last_row_offset;
 	u32 first_column, last_column;
-	u64 r0_first_row, r0_last_row;
-	u32 r5or6_blocks_per_row;
-	u64 r5or6_first_row, r5or6_last_row;
-	u32 r5or6_first_row_offset, r5or6_last_row_offset;
-	u32 r5or6_first_column, r5or6_last_column;
+	u64 r5or6_last_row;
+	u32 first_stripe_offset, last_stripe_offset;
+	u32 r5or6_last_row_offset, r5or6_last_column;
 	u32 total_disks_per_row;
-	u32 stripesize;
 	u32 first_group, last_group, current_group;
 	u32 map_row;
 	u32 disk_handle;
@@ -4862,9 +4950,6 @@ static int hpsa_scsi_ioaccel_raid_map(struct ctlr_info *h,
 	u32 disk_block_cnt;
 	u8 cdb[16];
 	u8 cdb_len;
-#if BITS_PER_LONG == 32
-	u64 tmpdiv;
-#endif
 	int offload_to_mirror;
 
 	/* check for valid opcode, get LBA and block count */
@@ -4935,39 +5020,23 @@ static int hpsa_scsi_ioaccel_raid_map(struct ctlr_info *h,
 	if (last_block >= map->volume_blk_cnt || last_block < first_block)
 		return IO_ACCEL_INELIGIBLE;
 
+	if (unlikely(!geom->valid))
+		return IO_ACCEL_INELIGIBLE;
+
 	/* calculate stripe information for the request */
-	blocks_per_row = map->data_disks_per_row * map->strip_size;
-#if BITS_PER_LONG == 32
-	tmpdiv = first_block;
-	(void) do_div(tmpdiv, blocks_per_row);
-	first_row = tmpdiv;
-	tmpdiv = last_block;
-	(void) do_div(tmpdiv, blocks_per_row);
-	last_row = tmpdiv;
-	first_row_offset = (u32) (first_block - (first_row * blocks_per_row));
-	last_row_offset = (u32) (last_block - (last_row * blocks_per_row));
-	tmpdiv = first_row_offset;
-	(void) do_div(tmpdiv,  map->strip_size);
-	first_column = tmpdiv;
-	tmpdiv = last_row_offset;
-	(void) do_div(tmpdiv, map->strip_size);
-	last_column = tmpdiv;
-#else
-	first_row = first_block / blocks_per_row;
-	last_row = last_block / blocks_per_row;
-	first_row_offset = (u32) (first_block - (first_row * blocks_per_row));
-	last_row_offset = (u32) (last_block - (last_row * blocks_per_row));
-	first_column = first_row_offset / map->strip_size;
-	last_column = last_row_offset / map->strip_size;
-#endif
+	first_row = hpsa_div64(first_block, &geom->row, &first_row_offset);
+	last_row = hpsa_div64(last_block, &geom->row, &last_row_offset);
+	first_column = hpsa_div32(first_row_offset, &geom->strip);
+	last_column = hpsa_div32(last_row_offset, &geom->strip);
 
 	/* if this isn't a single row/column then give to the controller */
 	if ((first_row != last_row) || (first_column != last_column))
 		return IO_ACCEL_INELIGIBLE;
 
 	/* proceeding with driver mapping */
-	total_disks_per_row = map->data_disks_per_row + map->metadata_disks_per_row;
-	map_row = ((u32)(first_row >> map->parity_rotation_shift)) % map->row_cnt;
+	total_disks_per_row = geom->total_disks_per_row;
+	map_row = hpsa_mod32((u32)(first_row >> map->parity_rotation_shift),
+			&geom->row_cnt);
 	map_index = (map_row * total_disks_per_row ) + first_column;
 
 
@@ -5034,84 +5103,38 @@ static int hpsa_scsi_ioaccel_raid_map(struct ctlr_info *h,
 		dev->raid_level == HPSA_RAID_6) &&
 		map->layout_map_count > 1) {
 
-		/* Verify first and last block are in same RAID group */
-		r5or6_blocks_per_row = map->strip_size * map->data_disks_per_row;
-		BUG_ON(r5or6_blocks_per_row == 0);
-		stripesize = r5or6_blocks_per_row * map->layout_map_count;
-#if BITS_PER_LONG == 32
-		tmpdiv = first_block;
-		first_group = do_div(tmpdiv, stripesize);
-		tmpdiv = first_group;
-		(void) do_div(tmpdiv, r5or6_blocks_per_row);					
-		first_group = tmpdiv;
-		tmpdiv = last_block;
-		last_group = do_div(tmpdiv, stripesize);
-		tmpdiv = last_group;
-		(void) do_div(tmpdiv, r5or6_blocks_per_row);					
-		last_group = tmpdiv;
-#else
-		first_group = (first_block % stripesize) / r5or6_blocks_per_row;
-		last_group = (last_block % stripesize) / r5or6_blocks_per_row;
-#endif
-		if (first_group != last_group )  
-			return IO_ACCEL_INELIGIBLE;
-
 		/* Verify request is in a single row of RAID 5/6 */
-#if BITS_PER_LONG == 32
-		tmpdiv = first_block;
-		(void) do_div(tmpdiv, stripesize);
-		first_row = r5or6_first_row = r0_first_row = tmpdiv;
-		tmpdiv = last_block;
-		(void) do_div(tmpdiv, stripesize);
-		r5or6_last_row = r0_last_row = tmpdiv;
-#else 
-		first_row = r5or6_first_row = r0_first_row = first_block / stripesize;
-		r5or6_last_row = r0_last_row = last_block / stripesize;
-#endif
-		if (r5or6_first_row != r5or6_last_row )
+		first_row = hpsa_div64(first_block, &geom->stripe,
+				&first_stripe_offset);
+		r5or6_last_row = hpsa_div64(last_block, &geom->stripe,
+				&last_stripe_offset);
+		if (first_row != r5or6_last_row)
 			return IO_ACCEL_INELIGIBLE;
-		
-	
-		/* Verify request is in a single column */
-#if BITS_PER_LONG == 32
-		tmpdiv = first_block;
-		first_row_offset = do_div(tmpdiv, stripesize); 
-		tmpdiv = first_row_offset;
-		first_row_offset = (u32) do_div(tmpdiv, r5or6_blocks_per_row); 
-		r5or6_first_row_offset = first_row_offset;
-		tmpdiv = last_block;
-		r5or6_last_row_offset = do_div(tmpdiv, stripesize); 
-		tmpdiv = r5or6_last_row_offset;
-		r5or6_last_row_offset = do_div(tmpdiv, r5or6_blocks_per_row);
-		tmpdiv = r5or6_first_row_offset;
-		(void) do_div(tmpdiv, map->strip_size);
-		first_column = r5or6_first_column = tmpdiv; 
-		tmpdiv = r5or6_last_row_offset;
-		(void) do_div(tmpdiv, map->strip_size);
-		r5or6_last_column = tmpdiv; 
-#else
-		first_row_offset = r5or6_first_row_offset = 
-			(u32)((first_block % stripesize ) % r5or6_blocks_per_row);	
 
-		r5or6_last_row_offset = 
-			(u32)((last_block % stripesize ) % r5or6_blocks_per_row);	
+		/* Verify first and last block are in same RAID group */
+		first_group = hpsa_div32(first_stripe_offset, &geom->row);
+		last_group = hpsa_div32(last_stripe_offset, &geom->row);
+		if (first_group != last_group)
+			return IO_ACCEL_INELIGIBLE;
 
-		first_column = r5or6_first_column = 
-			r5or6_first_row_offset / map->strip_size; 
-		r5or6_last_column = 
-			r5or6_last_row_offset / map->strip_size;
-#endif
-		if (r5or6_first_column != r5or6_last_column ) 
+		/* Verify request is in a single column */
+		first_row_offset = first_stripe_offset -
+			first_group * geom->row.d;
+		r5or6_last_row_offset = last_stripe_offset -
+			last_group * geom->row.d;
+		first_column = hpsa_div32(first_row_offset, &geom->strip);
+		r5or6_last_column = hpsa_div32(r5or6_last_row_offset,
+				&geom->strip);
+		if (first_column != r5or6_last_column)
 			return IO_ACCEL_INELIGIBLE;
 
 		/* Request is eligible */
-		map_row = ((u32)(first_row >> map->parity_rotation_shift)) %
-			map->row_cnt;
-			
-		map_index = (first_group * 
-			(map->row_cnt * total_disks_per_row)) + 
-			(map_row * total_disks_per_row) + first_column; 
-		
+		map_row = hpsa_mod32((u32)(first_row >> map->parity_rotation_shift),
+				&geom->row_cnt);
+
+		map_index = (first_group * geom->group_entries) +
+			(map_row * total_disks_per_row) + first_column;
+
 	} /* end RAID 50/60 */
 
 	if (unlikely(map_index >= RAID_MAP_MAX_ENTRIES))
@@ -5404,7 +5427,7 @@ DECLARE_QUEUECOMMAND(hpsa_scsi_queue_command)
 		done(cmd);
 		return 0;
 	}
-	c = cmd_alloc(h);
+	c = cmd_alloc_io(h);
 
 	if (unlikely(h->lockup_detected)) {
 		cmd->result = DID_NO_CONNECT << 16;
@@ -5564,10 +5587,7 @@ static int hpsa_register_scsi(struct ctlr_info *h)
 	sh->max_cmd_len = MAX_COMMAND_SIZE;
 	sh->max_lun = HPSA_MAX_LUN;
 	sh->max_id = HPSA_MAX_LUN;
-	sh->can_queue = h->nr_cmds -
-			HPSA_CMDS_RESERVED_FOR_ABORTS -
-			HPSA_CMDS_RESERVED_FOR_DRIVER -
-			HPSA_MAX_CONCURRENT_PASSTHRUS;
+	sh->can_queue = h->nr_cmds - h->nr_reserved_cmds;
 	sh->cmd_per_lun = sh->can_queue;
 	sh->sg_tablesize = h->maxsgentries;
 	h->scsi_host = sh;
@@ -6337,62 +6357,210 @@ static int hpsa_eh_abort_handler(struct scsi_cmnd *sc)
         return SUCCESS;
 }
 
+static inline struct hpsa_tag_cache *hpsa_tag_cache(struct ctlr_info *h,
+	int cpu)
+{
+	return &h->tag_cache[cpu % h->nr_tag_caches];
+}
+
+/*
+ * Move up to n tags between a per-CPU cache and a pool.
+ * Caller holds the cache lock; the pool lock nests inside it.
+ */
+static int hpsa_tag_cache_refill(struct hpsa_tag_pool *pool,
+	struct hpsa_tag_cache *tc, int n)
+{
+	spin_lock(&pool->lock);
+	n = min(n, pool->count);
+	pool->count -= n;
+	memcpy(&tc->tags[tc->count], &pool->tags[pool->count],
+		n * sizeof(tc->tags[0]));
+	tc->count += n;
+	spin_unlock(&pool->lock);
+	return n;
+}
+
+static void hpsa_tag_cache_flush(struct hpsa_tag_pool *pool,
+	struct hpsa_tag_cache *tc, int n)
+{
+	spin_lock(&pool->lock);
+	tc->count -= n;
+	memcpy(&pool->tags[pool->count], &tc->tags[tc->count],
+		n * sizeof(tc->tags[0]));
+	pool->count += n;
+	spin_unlock(&pool->lock);
+}
+
+/* Take one free tag out of another CPU's cache, or return -1. */
+static int hpsa_tag_steal(struct ctlr_info *h, int this_cpu)
+{
+	struct hpsa_tag_cache *tc;
+	unsigned long flags;
+	int cpu, tag = -1;
+
+	for (cpu = 0; cpu < h->nr_tag_caches; cpu++) {
+		tc = &h->tag_cache[cpu];
+		if (tc == hpsa_tag_cache(h, this_cpu))
+			continue;
+		if (!tc->count)		/* benignly racy */
+			continue;
+		spin_lock_irqsave(&tc->lock, flags);
+		if (tc->count)
+			tag = tc->tags[--tc->count];
+		spin_unlock_irqrestore(&tc->lock, flags);
+		if (tag >= 0)
+			break;
+	}
+	return tag;
+}
+
+/*
+ * Returns a free command index, or -1 if none could be found.
+ * Internal commands draw from the reserved tags first so that aborts,
+ * resets and passthrus still get a command when I/O has used up the
+ * shared pool; I/O never touches the reserved tags.
+ */
+static int hpsa_tag_get(struct ctlr_info *h, int internal)
+{
+	struct hpsa_tag_pool *rsvd = &h->reserved_tags;
+	struct hpsa_tag_cache *tc;
+	unsigned long flags;
+	int cpu, tag = -1;
+
+	if (internal) {
+		spin_lock_irqsave(&rsvd->lock, flags);
+		if (rsvd->count) {
+			tag = rsvd->tags[--rsvd->count];
+			rsvd->allocs++;
+		}
+		spin_unlock_irqrestore(&rsvd->lock, flags);
+		if (tag >= 0)
+			return tag;
+	}
+
+	cpu = raw_smp_processor_id();
+	tc = hpsa_tag_cache(h, cpu);
+	spin_lock_irqsave(&tc->lock, flags);
+	if (!tc->count &&
+	    hpsa_tag_cache_refill(&h->tag_pool, tc, HPSA_TAG_CACHE_BATCH))
+		tc->refills++;
+	if (tc->count)
+		tag = tc->tags[--tc->count];
+	spin_unlock_irqrestore(&tc->lock, flags);
+	if (tag >= 0)
+		return tag;
+
+	tag = hpsa_tag_steal(h, cpu);
+	if (tag >= 0) {
+		spin_lock_irqsave(&tc->lock, flags);
+		tc->steals++;
+		spin_unlock_irqrestore(&tc->lock, flags);
+	}
+	return tag;
+}
+
+static void hpsa_tag_put(struct ctlr_info *h, int tag)
+{
+	struct hpsa_tag_pool *rsvd = &h->reserved_tags;
+	struct hpsa_tag_cache *tc;
+	unsigned long flags;
+
+	if (tag < h->nr_reserved_cmds) {
+		spin_lock_irqsave(&rsvd->lock, flags);
+		rsvd->tags[rsvd->count++] = tag;
+		spin_unlock_irqrestore(&rsvd->lock, flags);
+		return;
+	}
+
+	tc = hpsa_tag_cache(h, raw_smp_processor_id());
+	spin_lock_irqsave(&tc->lock, flags);
+	if (tc->count == HPSA_TAG_CACHE_SIZE)
+		hpsa_tag_cache_flush(&h->tag_pool, tc, HPSA_TAG_CACHE_BATCH);
+	tc->tags[tc->count++] = tag;
+	spin_unlock_irqrestore(&tc->lock, flags);
+}
+
+static void hpsa_tag_account(struct ctlr_info *h, cycles_t cycles,
+	int retries)
+{
+	struct hpsa_tag_cache *tc;
+	unsigned long flags;
+
+	tc = hpsa_tag_cache(h, raw_smp_processor_id());
+	spin_lock_irqsave(&tc->lock, flags);
+	tc->allocs++;
+	tc->retries += retries;
+	tc->alloc_cycles += cycles;
+	if (cycles > tc->max_alloc_cycles)
+		tc->max_alloc_cycles = cycles;
+	spin_unlock_irqrestore(&tc->lock, flags);
+}
+
 /*
  * For operations that cannot sleep, a command block is allocated at init,
- * and managed by cmd_alloc() and cmd_free() using a simple bitmap to track
- * which ones are free or in use.  Lock must be held when calling this.
- * cmd_free() is the complement.
+ * and managed by cmd_alloc() and cmd_free().  Free command indices live
+ * in per-CPU caches backed by a shared pool (see hpsa_tag_get()), and
+ * cmd_pool_bits tracks which ones are in use.  cmd_free() is the
+ * complement.
  * This function never gives up and returns NULL.  If it hangs,
  * another thread must call cmd_free() to free some tags.
  */
-static struct CommandList *cmd_alloc(struct ctlr_info *h)
+static struct CommandList *__cmd_alloc(struct ctlr_info *h, int internal)
 {
 	struct CommandList *c;
-	int refcount, i;
-	unsigned long offset = 0;
-
-	/* There is some *extremely* small but non-zero chance that that
-	 * multiple threads could get in here, and one thread could
-	 * be scanning through the list of bits looking for a free
-	 * one, but the free ones are always behind him, and other
-	 * threads sneak in behind him and eat them before he can
-	 * get to them, so that while there is always a free one, a
-	 * very unlucky thread might be starved anyway, never able to
-	 * beat the other threads.  In reality, this happens so
-	 * infrequently as to be indistinguishable from never.
-	 */
+	cycles_t start = get_cycles();
+	int i, retries = 0;
 
-	offset = h->last_allocation; /* benignly racy */
 	for (;;) {
-		i = find_next_zero_bit(h->cmd_pool_bits, h->nr_cmds, offset);
-		if (unlikely(i == h->nr_cmds)) {
-			offset = 0;
+		i = hpsa_tag_get(h, internal);
+		if (unlikely(i < 0)) {
+			retries++;
+			cpu_relax();
 			continue;
 		}
 		c = h->cmd_pool + i;
-		refcount = atomic_inc_return(&c->refcount);
-		if (unlikely(refcount > 1)) {
-			cmd_free(h, c); /* already in use */
-			offset = (i + 1) % h->nr_cmds;
+		if (unlikely(atomic_inc_return(&c->refcount) > 1)) {
+			/*
+			 * A pool walk (fail_all_outstanding_cmds() and
+			 * friends) holds a transient reference on this free
+			 * command; its cmd_free() won't release the tag since
+			 * the in-use bit is clear, so hand it back ourselves.
+			 */
+			atomic_dec(&c->refcount);
+			hpsa_tag_put(h, i);
+			retries++;
 			continue;
 		}
 		set_bit(i & (BITS_PER_LONG - 1),
 			h->cmd_pool_bits + (i / BITS_PER_LONG));
 		break; /* it's ours now. */
 	}
-	h->last_allocation = i; /* benignly racy */
+	hpsa_tag_account(h, get_cycles() - start, retries);
 	hpsa_cmd_partial_init(h, i, c);
 	return c;
 }
 
+/* Internal commands: may use the reserved tags. */
+static struct CommandList *cmd_alloc(struct ctlr_info *h)
+{
+	return __cmd_alloc(h, 1);
+}
+
+/* Commands on behalf of the SCSI midlayer. */
+static struct CommandList *cmd_alloc_io(struct ctlr_info *h)
+{
+	return __cmd_alloc(h, 0);
+}
+
 static void cmd_free(struct ctlr_info *h, struct CommandList *c)
 {
 	if (atomic_dec_and_test(&c->refcount)) {
 		int i;
 
 		i = c - h->cmd_pool;
-		clear_bit(i & (BITS_PER_LONG - 1),
-			  h->cmd_pool_bits + (i / BITS_PER_LONG));
+		if (test_and_clear_bit(i & (BITS_PER_LONG - 1),
+			  h->cmd_pool_bits + (i / BITS_PER_LONG)))
+			hpsa_tag_put(h, i);
 	}
 }
 
@@ -8245,6 +8413,8 @@ static __devinit int hpsa_init_reset_devices(struct pci_dev *pdev)
 static void hpsa_free_cmd_pool(struct ctlr_info *h)
 {
 	kfree(h->cmd_pool_bits);
+	kfree(h->tag_stack);
+	kfree(h->tag_cache);
 	if (h->cmd_pool)
 		pci_free_consistent(h->pdev,
 			    h->nr_cmds * sizeof(struct CommandList),
@@ -8256,6 +8426,39 @@ static void hpsa_free_cmd_pool(struct ctlr_info *h)
 			    h->errinfo_pool_dhandle);
 }
 
+/*
+ * Indices below nr_reserved_cmds go to the reserved pool, the rest to the
+ * shared pool; per-CPU caches start out empty.  Low indices are handed
+ * out first.
+ */
+static void hpsa_init_tags(struct ctlr_info *h)
+{
+	struct hpsa_tag_cache *tc;
+	int cpu, i;
+
+	h->nr_reserved_cmds = min(HPSA_NRESERVED_CMDS, h->nr_cmds / 2);
+
+	spin_lock_init(&h->reserved_tags.lock);
+	h->reserved_tags.tags = h->tag_stack;
+	h->reserved_tags.count = h->nr_reserved_cmds;
+	h->reserved_tags.allocs = 0;
+	for (i = 0; i < h->nr_reserved_cmds; i++)
+		h->reserved_tags.tags[i] = h->nr_reserved_cmds - 1 - i;
+
+	spin_lock_init(&h->tag_pool.lock);
+	h->tag_pool.tags = h->tag_stack + h->nr_reserved_cmds;
+	h->tag_pool.count = h->nr_cmds - h->nr_reserved_cmds;
+	h->tag_pool.allocs = 0;
+	for (i = 0; i < h->tag_pool.count; i++)
+		h->tag_pool.tags[i] = h->nr_cmds - 1 - i;
+
+	for (cpu = 0; cpu < h->nr_tag_caches; cpu++) {
+		tc = &h->tag_cache[cpu];
+		memset(tc, 0, sizeof(*tc));
+		spin_lock_init(&tc->lock);
+	}
+}
+
 static __devinit int hpsa_alloc_cmd_pool(struct ctlr_info *h)
 {
 	h->cmd_pool_bits = kzalloc(
@@ -8267,13 +8470,20 @@ static __devinit int hpsa_alloc_cmd_pool(struct ctlr_info *h)
 	h->errinfo_pool = pci_alloc_consistent(h->pdev,
 		    h->nr_cmds * sizeof(*h->errinfo_pool),
 		    &(h->errinfo_pool_dhandle));
+	h->tag_stack = kmalloc(h->nr_cmds * sizeof(*h->tag_stack), GFP_KERNEL);
+	h->nr_tag_caches = num_online_cpus();
+	h->tag_cache = kmalloc(h->nr_tag_caches * sizeof(*h->tag_cache),
+		GFP_KERNEL);
 	if ((h->cmd_pool_bits == NULL)
 	    || (h->cmd_pool == NULL)
-	    || (h->errinfo_pool == NULL)) {
+	    || (h->errinfo_pool == NULL)
+	    || (h->tag_stack == NULL)
+	    || (h->tag_cache == NULL)) {
 		dev_err(&h->pdev->dev, "out of memory in %s", __func__);
 		goto clean_up;
 	}
 	hpsa_preinitialize_commands(h);
+	hpsa_init_tags(h);
 	return 0;
 clean_up:
 	hpsa_free_cmd_pool(h);
@@ -9355,6 +9565,39 @@ clean1:	/* rq, ioaccel */
 	return rc;
 }
 
+/*
+ * Sum the per-CPU command allocation statistics.
+ * Counters are read without the cache locks, so they may be slightly stale.
+ */
+static int hpsa_proc_tag_stats(struct ctlr_info *h, char *buffer)
+{
+	struct hpsa_tag_cache *tc;
+	unsigned long allocs = 0, retries = 0, refills = 0, steals = 0;
+	u64 cycles = 0, max_cycles = 0;
+	int cpu;
+
+	for (cpu = 0; cpu < h->nr_tag_caches; cpu++) {
+		tc = &h->tag_cache[cpu];
+		allocs += tc->allocs;
+		retries += tc->retries;
+		refills += tc->refills;
+		steals += tc->steals;
+		cycles += tc->alloc_cycles;
+		if (tc->max_alloc_cycles > max_cycles)
+			max_cycles = tc->max_alloc_cycles;
+	}
+	if (allocs)
+		do_div(cycles, allocs);
+
+	return sprintf(buffer, "Command allocations: %lu (reserved: %lu)\n"
+		"Command allocation retries: %lu\n"
+		"Command allocation cycles: avg %llu max %llu\n"
+		"Command tag refills: %lu steals: %lu\n",
+		allocs, h->reserved_tags.allocs, retries,
+		(unsigned long long)cycles, (unsigned long long)max_cycles,
+		refills, steals);
+}
+
 /*ADDING VMW PROC STUFF JH FIXME*/
 /*
  * Report information about this controller.
@@ -9414,6 +9657,7 @@ static int hpsa_proc_get_info(char *buffer, char **start, off_t offset,
 		h->maxSG, h->nr_cmds, h->scsi_host->host_no,
 		(h->hba_mode_enabled == 1) ? "HBA" : "RAID");
 	len += size;
+	len += hpsa_proc_tag_stats(h, buffer + len);
 
 	for (i = 0; i < h->ndevices; i++) {
 		drv = h->dev[i];
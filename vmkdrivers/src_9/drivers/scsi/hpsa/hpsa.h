@@ -54,6 +54,32 @@ struct access_method {
 	unsigned long (*command_completed)(struct ctlr_info *h, u8 q);
 };
 
+/*
+ * A divisor prepared for fast division: a shift when it is a power of 2,
+ * otherwise a reciprocal multiplier (see hpsa_div_init()).
+ */
+struct hpsa_div {
+	u32	d;
+	u32	m;	/* 0 if d is a power of 2 */
+	u8	shift;	/* log2(d), power of 2 only */
+	u8	sh1;
+	u8	sh2;
+};
+
+/*
+ * RAID map geometry used on every ioaccel I/O, computed once when the
+ * RAID map is loaded.
+ */
+struct hpsa_raid_geom {
+	int	valid;
+	u32	total_disks_per_row;
+	u32	group_entries;		/* map entries per RAID 50/60 group */
+	struct hpsa_div strip;		/* strip_size */
+	struct hpsa_div row;		/* data blocks per row */
+	struct hpsa_div row_cnt;
+	struct hpsa_div stripe;		/* data blocks per row, all groups */
+};
+
 struct hpsa_scsi_dev_t {
 	int devtype;
 	int bus, target, lun;		/* as presented to the OS */
@@ -76,6 +102,7 @@ struct hpsa_scsi_dev_t {
 					 * offload request to mirror drive
 					 */
 	struct raid_map_data raid_map;	/* I/O accelerator RAID map */
+	struct hpsa_raid_geom raid_geom; /* derived from raid_map */
 	int supports_aborts;
 #define HPSA_NO_ULD_ATTACH	0x1
 #define HPSA_DO_NOT_EXPOSE	0x2
@@ -143,6 +170,37 @@ struct bmic_controller_parameters {
 };
 #pragma pack()
 
+/*
+ * Free command indices are kept in small per-CPU caches in front of a
+ * shared pool, so cmd_alloc()/cmd_free() normally only touch the local
+ * CPU's cache line.  Caches are refilled from and flushed to the shared
+ * pool HPSA_TAG_CACHE_BATCH tags at a time.  The caches are a plain
+ * array of nr_tag_caches entries, one per online CPU, since vmklinux has
+ * no per-CPU allocator; CPUs beyond it share a cache under its lock.
+ */
+#define HPSA_TAG_CACHE_SIZE	32
+#define HPSA_TAG_CACHE_BATCH	(HPSA_TAG_CACHE_SIZE / 2)
+
+struct hpsa_tag_cache {
+	spinlock_t	lock;
+	int		count;
+	u16		tags[HPSA_TAG_CACHE_SIZE];
+	/* allocation statistics, reported in /proc/hpsa */
+	unsigned long	allocs;
+	unsigned long	retries;	/* empty pool or collision */
+	unsigned long	refills;	/* batches taken from shared pool */
+	unsigned long	steals;		/* tags taken from other CPUs */
+	u64		alloc_cycles;
+	u64		max_alloc_cycles;
+} ____cacheline_aligned_in_smp;
+
+struct hpsa_tag_pool {
+	spinlock_t	lock;
+	int		count;
+	u16		*tags;
+	unsigned long	allocs;		/* reserved pool only */
+};
+
 struct ctlr_info {
 	int	ctlr;
 	char	devname[8];
@@ -155,10 +213,12 @@ struct ctlr_info {
 	int 	nr_cmds; /* Number of commands allowed on this controller */
 #define HPSA_CMDS_RESERVED_FOR_ABORTS 2
 #define HPSA_CMDS_RESERVED_FOR_DRIVER 1
+#define HPSA_NRESERVED_CMDS (HPSA_CMDS_RESERVED_FOR_ABORTS + \
+			     HPSA_CMDS_RESERVED_FOR_DRIVER + \
+			     HPSA_MAX_CONCURRENT_PASSTHRUS)
 	struct CfgTable __iomem *cfgtable;
 	int	interrupts_enabled;
 	int 	max_commands;
-	int last_allocation;
 	atomic_t commands_outstanding;
 #	define PERF_MODE_INT	0
 #	define DOORBELL_INT	1
@@ -190,7 +250,13 @@ struct ctlr_info {
 	dma_addr_t		ioaccel2_cmd_pool_dhandle;
 	struct ErrorInfo 	*errinfo_pool;
 	dma_addr_t		errinfo_pool_dhandle;
-	unsigned long  		*cmd_pool_bits;
+	unsigned long  		*cmd_pool_bits;	/* set while allocated */
+	int			nr_reserved_cmds;
+	struct hpsa_tag_cache	*tag_cache;	/* per-CPU */
+	int			nr_tag_caches;
+	struct hpsa_tag_pool	tag_pool;	/* shared overflow pool */
+	struct hpsa_tag_pool	reserved_tags;	/* internal/abort commands */
+	u16			*tag_stack;
 	int			scan_finished;
 	int			scan_waiting;
 	spinlock_t		scan_lock;
@@ -115,6 +115,16 @@ static int msix_disable = 0;
 module_param(msix_disable, int, S_IRUGO);
 MODULE_PARM_DESC(msix_disable, "Disable MSI interrupt handling. Default: 0");
 
+/*
+ * RAID1 read balancing policy, applied to each LD on the next RAID map
+ * update: 0 auto, 1 seek, 2 pending, 3 chunk, 4 latency
+ */
+int megasas_lb_policy = MR_LB_POLICY_AUTO;
+module_param_named(lb_policy, megasas_lb_policy, int, S_IRUGO);
+MODULE_PARM_DESC(lb_policy,
+	"RAID1 read balancing: 0=auto 1=seek 2=pending 3=chunk 4=latency "
+	"(default=0)");
+
 MODULE_LICENSE("GPL");
 MODULE_VERSION(MEGASAS_VERSION);
 MODULE_AUTHOR("megaraidlinux@lsi.com");
@@ -253,33 +263,128 @@ megasas_issue_dcmd(struct megasas_instance *instance, struct megasas_cmd *cmd)
 		cmd->frame_phys_addr, 0, instance->reg_set);
 }
 
-/**
- * megasas_get_cmd -	Get a command from the free pool
- * @instance:		Adapter soft state
- *
- * Returns a free command from the pool
+/*
+ * The command cache of a CPU.  Entries are locked, so a CPU id past the
+ * end of the array may safely share the entry it wraps to.
  */
-struct megasas_cmd *megasas_get_cmd(struct megasas_instance
-						  *instance)
+static inline struct megasas_cmd_cache *
+megasas_cmd_cache(struct megasas_instance *instance, int cpu)
+{
+	return &instance->cmd_cache[cpu % instance->nr_cpus];
+}
+
+/*
+ * Take a free command out of another CPU's cache.  Caches hold at most
+ * MEGASAS_CMD_CACHE_MAX commands each, but together they can hold all of
+ * them when the global pool runs dry.
+ */
+static struct megasas_cmd *
+megasas_steal_cmd(struct megasas_instance *instance, int this_cpu)
+{
+	struct megasas_cmd_cache *cache;
+	struct megasas_cmd *cmd = NULL;
+	unsigned long flags;
+	int cpu;
+
+	for (cpu = 0; cpu < instance->nr_cpus; cpu++) {
+		cache = &instance->cmd_cache[cpu];
+		if (cache == megasas_cmd_cache(instance, this_cpu))
+			continue;
+		if (!cache->count)	/* benignly racy */
+			continue;
+		spin_lock_irqsave(&cache->lock, flags);
+		if (!list_empty(&cache->free)) {
+			cmd = list_entry(cache->free.next, struct megasas_cmd,
+					 list);
+			list_del_init(&cmd->list);
+			cache->count--;
+		}
+		spin_unlock_irqrestore(&cache->lock, flags);
+		if (cmd)
+			break;
+	}
+	return cmd;
+}
+
+static struct megasas_cmd *
+__megasas_get_cmd(struct megasas_instance *instance, int reserved)
 {
 	unsigned long flags;
 	struct megasas_cmd *cmd = NULL;
+	struct megasas_cmd_cache *cache;
+	int cpu, n;
+
+	if (reserved) {
+		spin_lock_irqsave(&instance->cmd_pool_lock, flags);
+		if (!list_empty(&instance->cmd_pool_reserved)) {
+			cmd = list_entry(instance->cmd_pool_reserved.next,
+					 struct megasas_cmd, list);
+			list_del_init(&cmd->list);
+		}
+		spin_unlock_irqrestore(&instance->cmd_pool_lock, flags);
+		if (cmd)
+			return cmd;
+	}
 
-	spin_lock_irqsave(&instance->cmd_pool_lock, flags);
+	cpu = raw_smp_processor_id();
+	cache = megasas_cmd_cache(instance, cpu);
 
-	if (!list_empty(&instance->cmd_pool)) {
-		cmd = list_entry((&instance->cmd_pool)->next,
-				 struct megasas_cmd, list);
+	spin_lock_irqsave(&cache->lock, flags);
+	if (list_empty(&cache->free)) {
+		spin_lock(&instance->cmd_pool_lock);
+		for (n = 0; n < MEGASAS_CMD_CACHE_BATCH &&
+		     !list_empty(&instance->cmd_pool); n++)
+			list_move(instance->cmd_pool.next, &cache->free);
+		cache->count += n;
+		spin_unlock(&instance->cmd_pool_lock);
+	}
+	if (!list_empty(&cache->free)) {
+		cmd = list_entry(cache->free.next, struct megasas_cmd, list);
 		list_del_init(&cmd->list);
+		cache->count--;
+	}
+	spin_unlock_irqrestore(&cache->lock, flags);
+
+	if (!cmd)
+		cmd = megasas_steal_cmd(instance, cpu);
+
+	if (cmd) {
+		cmd->cpu = cpu;
 	} else {
+		spin_lock_irqsave(&cache->lock, flags);
+		cache->pool_empty++;
+		spin_unlock_irqrestore(&cache->lock, flags);
 		if (megasas_dbg_lvl)
 			printk(KERN_ERR "megasas: Command pool empty!\n");
 	}
-
-	spin_unlock_irqrestore(&instance->cmd_pool_lock, flags);
 	return cmd;
 }
 
+/**
+ * megasas_get_cmd -	Get a command from the free pool
+ * @instance:		Adapter soft state
+ *
+ * Returns a free command from the pool, for internal commands (DCMDs,
+ * aborts, ioctls).  These may use the reserved commands.
+ */
+struct megasas_cmd *megasas_get_cmd(struct megasas_instance
+						  *instance)
+{
+	return __megasas_get_cmd(instance, 1);
+}
+
+/**
+ * megasas_get_io_cmd -	Get a command from the free pool for I/O
+ * @instance:		Adapter soft state
+ *
+ * Like megasas_get_cmd(), but never hands out a reserved command.
+ */
+static struct megasas_cmd *megasas_get_io_cmd(struct megasas_instance
+						  *instance)
+{
+	return __megasas_get_cmd(instance, 0);
+}
+
 /**
  * megasas_return_cmd -	Return a cmd to free command pool
  * @instance:		Adapter soft state
@@ -289,14 +394,36 @@ void
 megasas_return_cmd(struct megasas_instance *instance, struct megasas_cmd *cmd)
 {
 	unsigned long flags;
-
-	spin_lock_irqsave(&instance->cmd_pool_lock, flags);
+	struct megasas_cmd_cache *cache;
+	int cpu, n;
 
 	cmd->scmd = NULL;
 	cmd->frame_count = 0;
-	list_add_tail(&cmd->list, &instance->cmd_pool);
+	cmd->io_stamp.start = 0;
 
-	spin_unlock_irqrestore(&instance->cmd_pool_lock, flags);
+	if (cmd->index < instance->reserved_mfi_cmds) {
+		spin_lock_irqsave(&instance->cmd_pool_lock, flags);
+		list_add_tail(&cmd->list, &instance->cmd_pool_reserved);
+		spin_unlock_irqrestore(&instance->cmd_pool_lock, flags);
+		return;
+	}
+
+	cpu = raw_smp_processor_id();
+	cache = megasas_cmd_cache(instance, cpu);
+
+	spin_lock_irqsave(&cache->lock, flags);
+	if (cmd->cpu != cpu)
+		cache->remote_returns++;
+	list_add(&cmd->list, &cache->free);
+	if (++cache->count > MEGASAS_CMD_CACHE_MAX) {
+		/* keep the most recently used commands, flush the coldest */
+		spin_lock(&instance->cmd_pool_lock);
+		for (n = 0; n < MEGASAS_CMD_CACHE_BATCH; n++)
+			list_move_tail(cache->free.prev, &instance->cmd_pool);
+		cache->count -= n;
+		spin_unlock(&instance->cmd_pool_lock);
+	}
+	spin_unlock_irqrestore(&cache->lock, flags);
 }
 
 
@@ -1358,38 +1485,54 @@ static inline u64 megasas_time_to_usecs(struct timeval *tv)
         return ((tv->tv_sec*1000000) + tv->tv_usec);
 }
 
-inline void UpdateIOMetric(struct megasas_instance *instance, u8 TargetId, u8 isRead, u64 startBlock, u32 NumBlocks)
+/*
+ * I/O metrics.  The I/O path only touches the local CPU's counters and
+ * timestamps with get_cycles(); everything is summed, and cycles converted
+ * to wall time, when the metrics are read.  The per-CPU counters are a
+ * kmalloc'd array of instance->nr_cpus entries, updated with preemption
+ * disabled.
+ */
+static inline struct megasas_perf_cpu *
+megasas_perf_cpu(struct megasas_instance *instance, int cpu)
+{
+	return &instance->perf_cpu[cpu % instance->nr_cpus];
+}
+
+inline void UpdateIOMetric(struct megasas_instance *instance, u8 TargetId, u8 isRead, u64 startBlock, u32 NumBlocks, struct megasas_io_stamp *stamp)
 {
     MR_IO_METRICS_SIZE          *pIOSizeMetric;
     MR_IO_METRICS_RANDOMNESS    *pIORandomMetric;
-    struct timeval              current_time;
+    MEGASAS_LD_PERF             *perf;
+    u64                         lastBlock, now;
+
+    stamp->start = 0;
 
     if (!instance->PerformanceMetric.LogOn)
         return;
 
-    if (TargetId > MAX_PERF_COLLECTION_VD)
+    if (TargetId >= MAX_PERF_COLLECTION_VD)
         return;
 
+    now = get_cycles();
+    perf = &megasas_perf_cpu(instance, get_cpu())->ld[TargetId];
+
     if (isRead)
     {
-        pIOSizeMetric = &instance->PerformanceMetric.IoMetricsLD[TargetId].readSize;
-        pIORandomMetric = &instance->PerformanceMetric.IoMetricsLD[TargetId].readRandomness;
-        instance->PerformanceMetric.IoMetricsLD[TargetId].readMB += NumBlocks; // lba to MB conversion happens later                                           
+        pIOSizeMetric = &perf->readSize;
+        pIORandomMetric = &perf->readRandomness;
+        perf->readBlocks += NumBlocks; // lba to MB conversion happens later
     }
     else
     {
-        pIOSizeMetric = &instance->PerformanceMetric.IoMetricsLD[TargetId].writeSize;
-        pIORandomMetric = &instance->PerformanceMetric.IoMetricsLD[TargetId].writeRandomness;
-        instance->PerformanceMetric.IoMetricsLD[TargetId].writeMB += NumBlocks; // lba to MB conversion happens later                                          
+        pIOSizeMetric = &perf->writeSize;
+        pIORandomMetric = &perf->writeRandomness;
+        perf->writeBlocks += NumBlocks; // lba to MB conversion happens later
     }
 
-    do_gettimeofday(&current_time);
-    instance->PerformanceMetric.LastIOTime[TargetId] = megasas_time_to_usecs(&current_time);
+    perf->lastIOCycles = now;
 
     if (NumBlocks  <= 1)
         pIOSizeMetric->lessThan512B++;
-
-
     else if (NumBlocks  <=  8)
         pIOSizeMetric->between512B_4K++;
     else if (NumBlocks  <=  32)
@@ -1399,39 +1542,165 @@ inline void UpdateIOMetric(struct megasas_instance *instance, u8 TargetId, u8 is
     else if (NumBlocks  <=  256)
         pIOSizeMetric->between64K_256K++;
     else if (NumBlocks  >  256)
-        pIOSizeMetric->moreThan256K++;                        // Number of IOs: 256K < size                                                                    
-    if (instance->PerformanceMetric.LastBlock[TargetId] == startBlock)
-        pIORandomMetric->sequential++;                         // Number of IOs: sequential ( inter-LBA distance is 0)                                         
-    else if ((instance->PerformanceMetric.LastBlock[TargetId] + 128 ) <= startBlock)
-        pIORandomMetric->lessThan64K++;                        // Number of IOs: within 64KB of previous IO                                                    
-    else if ((instance->PerformanceMetric.LastBlock[TargetId] + 1024 ) <= startBlock)
-        pIORandomMetric->between64K_512K++;                    // Number of IOs:  64K < LBA <=512K                                                             
-    else if ((instance->PerformanceMetric.LastBlock[TargetId] + 32768) <= startBlock)
-        pIORandomMetric->between512K_16M++;                    // Number of IOs: 512K < LBA <=16M                                                              
-    else if ((instance->PerformanceMetric.LastBlock[TargetId] + 524288) <= startBlock)
-        pIORandomMetric->between16M_256M++;                    // Number of IOs:  16M < LBA <=256M                                                             
-    else if ((instance->PerformanceMetric.LastBlock[TargetId] + 2097152) <= startBlock)
-        pIORandomMetric->between256M_1G++;                     // Number of IOs: 256M < LBA <=1G                                                               
-    else if ((instance->PerformanceMetric.LastBlock[TargetId] + 2097152) > startBlock)
-        pIORandomMetric->moreThan1G++;                         // Number of IOs:   1G < LBA                                                                    
+        pIOSizeMetric->moreThan256K++;                        // Number of IOs: 256K < size
+
+    /*
+     * LastBlock stays shared so a stream spread over several CPUs is still
+     * seen as one; a racing update can only misclassify a single I/O.
+     */
+    lastBlock = instance->PerformanceMetric.LastBlock[TargetId];
+    if (lastBlock == startBlock)
+        pIORandomMetric->sequential++;                         // Number of IOs: sequential ( inter-LBA distance is 0)
+    else if ((lastBlock + 128 ) <= startBlock)
+        pIORandomMetric->lessThan64K++;                        // Number of IOs: within 64KB of previous IO
+    else if ((lastBlock + 1024 ) <= startBlock)
+        pIORandomMetric->between64K_512K++;                    // Number of IOs:  64K < LBA <=512K
+    else if ((lastBlock + 32768) <= startBlock)
+        pIORandomMetric->between512K_16M++;                    // Number of IOs: 512K < LBA <=16M
+    else if ((lastBlock + 524288) <= startBlock)
+        pIORandomMetric->between16M_256M++;                    // Number of IOs:  16M < LBA <=256M
+    else if ((lastBlock + 2097152) <= startBlock)
+        pIORandomMetric->between256M_1G++;                     // Number of IOs: 256M < LBA <=1G
+    else if ((lastBlock + 2097152) > startBlock)
+        pIORandomMetric->moreThan1G++;                         // Number of IOs:   1G < LBA
 
     instance->PerformanceMetric.LastBlock[TargetId] = startBlock + NumBlocks;
 
+    put_cpu();
+
+    stamp->start = now ? now : 1;
+    stamp->targetId = TargetId;
+    stamp->isRead = isRead;
+}
+
+/*
+ * Account the completion of an I/O stamped by UpdateIOMetric() in the
+ * latency histogram of its LD.
+ */
+inline void CompleteIOMetric(struct megasas_instance *instance, struct megasas_io_stamp *stamp)
+{
+    MEGASAS_LD_PERF *perf;
+    u32 bucket;
+
+    if (!stamp->start)
+        return;
+
+    bucket = fls64((get_cycles() - stamp->start) >> MEGASAS_LAT_SHIFT);
+    if (bucket >= MEGASAS_LAT_BUCKETS)
+        bucket = MEGASAS_LAT_BUCKETS - 1;
+    stamp->start = 0;
+
+    perf = &megasas_perf_cpu(instance, get_cpu())->ld[stamp->targetId];
+    if (stamp->isRead)
+        perf->readLatency[bucket]++;
+    else
+        perf->writeLatency[bucket]++;
+    put_cpu();
+}
+
+/* Number of u32 size and randomness buckets of MEGASAS_LD_PERF */
+#define MEGASAS_LD_PERF_NR_BUCKETS \
+	((offsetof(MEGASAS_LD_PERF, readLatency) - \
+	  offsetof(MEGASAS_LD_PERF, readSize)) / sizeof(u32))
+
+/* Number of u32 counters following the u64 fields of MEGASAS_LD_PERF */
+#define MEGASAS_LD_PERF_NR_U32 \
+	((sizeof(MEGASAS_LD_PERF) - offsetof(MEGASAS_LD_PERF, readSize)) / sizeof(u32))
+
+/* Sum the per-CPU counters of one LD */
+static void megasas_perf_merge(struct megasas_instance *instance, u8 TargetId, MEGASAS_LD_PERF *sum)
+{
+	MEGASAS_LD_PERF *perf;
+	u32 *src, *dst;
+	int cpu, i;
+
+	memset(sum, 0, sizeof(*sum));
+	dst = (u32 *)&sum->readSize;
+	for (cpu = 0; cpu < instance->nr_cpus; cpu++) {
+		perf = &instance->perf_cpu[cpu].ld[TargetId];
+		sum->readBlocks += perf->readBlocks;
+		sum->writeBlocks += perf->writeBlocks;
+		if (perf->lastIOCycles > sum->lastIOCycles)
+			sum->lastIOCycles = perf->lastIOCycles;
+		src = (u32 *)&perf->readSize;
+		for (i = 0; i < MEGASAS_LD_PERF_NR_U32; i++)
+			dst[i] += src[i];
+	}
+}
+
+/* Cycles per microsecond, measured over the current collection period */
+static u32 megasas_perf_cycles_per_usec(struct megasas_instance *instance, u64 CurrentTime, u64 CurrentCycles)
+{
+	u64 cycles = CurrentCycles - instance->PerformanceMetric.CollectStartCycles;
+	u64 usecs = CurrentTime - instance->PerformanceMetric.CollectStartTime;
+
+	while (usecs >> 32) {
+		usecs >>= 1;
+		cycles >>= 1;
+	}
+	if (!usecs)
+		return 0;
+	do_div(cycles, (u32)usecs);
+	return (u32)cycles;
+}
+
+/* Start a collection period: reset the timers and the counter baseline */
+static void megasas_perf_start(struct megasas_instance *instance)
+{
+	struct timeval current_time;
+	u8 i;
+
+	do_gettimeofday(&current_time);
+	instance->PerformanceMetric.CollectStartTime = megasas_time_to_usecs(&current_time);
+	instance->PerformanceMetric.CollectStartCycles = get_cycles();
+	for (i = 0; i < MAX_PERF_COLLECTION_VD; i++)
+		megasas_perf_merge(instance, i, &instance->PerformanceMetric.Base[i]);
 }
 
 static void CopyPerfMetricData(struct megasas_instance *instance, u64 CurrentTime)
 {
+	MR_IO_METRICS_LD_OVERALL *ld;
+	MEGASAS_LD_PERF sum, *base;
+	u64 temp, CurrentCycles, lastIO;
+	u32 cyclesPerUsec, *cur, *prev;
+	u32 delta[MEGASAS_LD_PERF_NR_BUCKETS];
 	u8 i;
-	u64 temp;
+	int j;
+
+	CurrentCycles = get_cycles();
+	cyclesPerUsec = megasas_perf_cycles_per_usec(instance, CurrentTime, CurrentCycles);
 
-	// Block to MB conversion & idle time calculation.                         
+	// Merge the per-CPU counters, block to MB conversion & idle time calculation.
 	for (i=0; i <MAX_PERF_COLLECTION_VD; i++ ) {
-		instance->PerformanceMetric.IoMetricsLD[i].readMB  >>= BLOCKTOMB_BITSHIFT;
-		instance->PerformanceMetric.IoMetricsLD[i].writeMB >>= BLOCKTOMB_BITSHIFT;
-		instance->PerformanceMetric.IoMetricsLD[i].targetId = i;
-		temp = CurrentTime - instance->PerformanceMetric.LastIOTime[i];
-		do_div(temp, 1000000);
-		instance->PerformanceMetric.IoMetricsLD[i].idleTime += (u16)temp;
+		megasas_perf_merge(instance, i, &sum);
+		base = &instance->PerformanceMetric.Base[i];
+		ld = &instance->PerformanceMetric.IoMetricsLD[i];
+
+		memset(ld, 0, sizeof(*ld));
+		ld->targetId = i;
+		ld->readMB  = (u32)((sum.readBlocks - base->readBlocks) >> BLOCKTOMB_BITSHIFT);
+		ld->writeMB = (u32)((sum.writeBlocks - base->writeBlocks) >> BLOCKTOMB_BITSHIFT);
+
+		/*
+		 * Size and randomness buckets are laid out alike in both, but
+		 * ld is packed: compute them in a local and copy them over.
+		 */
+		cur = (u32 *)&sum.readSize;
+		prev = (u32 *)&base->readSize;
+		for (j = 0; j < MEGASAS_LD_PERF_NR_BUCKETS; j++)
+			delta[j] = cur[j] - prev[j];
+		memcpy((u8 *)ld + offsetof(MR_IO_METRICS_LD_OVERALL, readSize),
+		       delta, sizeof(delta));
+
+		lastIO = max(sum.lastIOCycles, instance->PerformanceMetric.CollectStartCycles);
+		if (cyclesPerUsec && CurrentCycles > lastIO) {
+			temp = CurrentCycles - lastIO;
+			do_div(temp, cyclesPerUsec);
+			do_div(temp, 1000000);
+			ld->idleTime = (u16)temp;
+		}
+
+		*base = sum;
 	}
 	temp = CurrentTime - instance->PerformanceMetric.CollectStartTime;
 	do_div(temp, 1000000);
@@ -1439,14 +1708,13 @@ static void CopyPerfMetricData(struct megasas_instance *instance, u64 CurrentTim
 
 	memcpy(instance->PerformanceMetric.SavedIoMetricsLD, instance->PerformanceMetric.IoMetricsLD, sizeof(MR_IO_METRICS_LD_OVERALL) * MAX_PERF_COLLECTION_VD);
 
-	// Zero out the original buffer for new collection.                        
+	// Zero out the original buffer for new collection.
 	memset(instance->PerformanceMetric.IoMetricsLD, 0, sizeof(MR_IO_METRICS_LD_OVERALL) * MAX_PERF_COLLECTION_VD);
 }
 
 static void ProcessPerfMetricAEN(struct megasas_instance *instance, MR_CTRL_IO_METRICS_CMD_TYPE MetricType)
 {
     struct timeval      current_time;
-    u8 i;
 
     do_gettimeofday(&current_time);
 
@@ -1454,7 +1722,7 @@ static void ProcessPerfMetricAEN(struct megasas_instance *instance, MR_CTRL_IO_M
     case MR_CTRL_IO_METRICS_CMD_STOP:
         if (instance->PerformanceMetric.LogOn) {
 
-            // Set the flag to Stop collection.                                 
+            // Set the flag to Stop collection.
             instance->PerformanceMetric.LogOn = 0;
 
             CopyPerfMetricData(instance, megasas_time_to_usecs(&current_time));
@@ -1463,16 +1731,14 @@ static void ProcessPerfMetricAEN(struct megasas_instance *instance, MR_CTRL_IO_M
 
     case MR_CTRL_IO_METRICS_CMD_START:
 
-		// Save the previously collected data.                                  
+		// Save the previously collected data.
 		if (instance->PerformanceMetric.LogOn)
 			CopyPerfMetricData(instance, megasas_time_to_usecs(&current_time));
 
-        //Initialize the timers.                                                
-        instance->PerformanceMetric.CollectStartTime = megasas_time_to_usecs(&current_time);
-        for (i=0;i <MAX_PERF_COLLECTION_VD ; i++ )
-            instance->PerformanceMetric.LastIOTime[i]  = megasas_time_to_usecs(&current_time);
+        //Initialize the timers and the counter baseline.
+        megasas_perf_start(instance);
 
-        // Set the flag to start collection.                                    
+        // Set the flag to start collection.
         instance->PerformanceMetric.LogOn = 1;
 
         break;
@@ -1511,7 +1777,6 @@ megasas_build_ldio(struct megasas_instance *instance, struct scsi_cmnd *scp,
 	u8 sc = scp->cmnd[0];
 	u16 flags = 0;
 	struct megasas_io_frame *ldio;
-	unsigned long spinlock_flags;
 	u64 lba;
 
 	device_id = MEGASAS_DEV_INDEX(instance, scp);
@@ -1624,9 +1889,7 @@ megasas_build_ldio(struct megasas_instance *instance, struct scsi_cmnd *scp,
 	cmd->frame_count = megasas_get_frame_count(instance, ldio->sge_count, IO_FRAME);
 
         lba     = (u64)ldio->start_lba_hi << 32 | ldio->start_lba_lo;
-        spin_lock_irqsave(&instance->hba_lock, spinlock_flags);
-        UpdateIOMetric(instance, device_id, ldio->cmd == MFI_CMD_LD_READ ? 1 : 0, lba, ldio->lba_count);
-        spin_unlock_irqrestore(&instance->hba_lock, spinlock_flags);
+        UpdateIOMetric(instance, device_id, ldio->cmd == MFI_CMD_LD_READ ? 1 : 0, lba, ldio->lba_count, &cmd->io_stamp);
 
 	return cmd->frame_count;
 }
@@ -1727,7 +1990,7 @@ megasas_build_and_issue_cmd(struct megasas_instance *instance, struct scsi_cmnd
 	u32 frame_count;
 	
 
-	cmd = megasas_get_cmd(instance);
+	cmd = megasas_get_io_cmd(instance);
 	if (!cmd)
 		return SCSI_MLQUEUE_HOST_BUSY;
 
@@ -2695,6 +2958,163 @@ static void megasas_complete_cmd_dpc(unsigned long instance_addr)
 	spin_unlock_irqrestore(&instance->completion_lock, flags);
 }
 
+#if defined(__VMKLNX__)
+static int
+megasas_proc_cmd_pool(struct megasas_instance *instance, char *buf, int size)
+{
+	struct megasas_cmd_cache *cache;
+	unsigned long remote_returns = 0, pool_empty = 0;
+	u32 cached = 0;
+	int cpu;
+
+	if (!instance->cmd_cache)
+		return 0;
+
+	for (cpu = 0; cpu < instance->nr_cpus; cpu++) {
+		cache = &instance->cmd_cache[cpu];
+		remote_returns += cache->remote_returns;
+		pool_empty += cache->pool_empty;
+		cached += cache->count;
+	}
+	return scnprintf(buf, size, "cmd pool: cached %u remote_returns %lu "
+			 "pool_empty %lu\n", cached, remote_returns, pool_empty);
+}
+
+/*
+ * Latency histograms of the current collection period, merged from
+ * the per-CPU counters; LDs without completions are skipped.
+ */
+static int
+megasas_proc_io_latency(struct megasas_instance *instance, char *buf, int size)
+{
+	MEGASAS_LD_PERF sum, *base;
+	struct timeval current_time;
+	u64 edge;
+	u32 cyclesPerUsec, rd, wr;
+	int len = 0, ld, b;
+
+	if (!instance->perf_cpu)
+		return 0;
+
+	do_gettimeofday(&current_time);
+	cyclesPerUsec = megasas_perf_cycles_per_usec(instance,
+			megasas_time_to_usecs(&current_time), get_cycles());
+	len += scnprintf(buf + len, size - len, "io latency %s buckets (%s):",
+			 instance->PerformanceMetric.LogOn ? "on" : "off",
+			 cyclesPerUsec ? "us" : "cycles");
+	for (b = 0; b < MEGASAS_LAT_BUCKETS - 1; b++) {
+		edge = 1ULL << (b + MEGASAS_LAT_SHIFT);
+		if (cyclesPerUsec)
+			do_div(edge, cyclesPerUsec);
+		len += scnprintf(buf + len, size - len, " <%llu",
+				 (unsigned long long)edge);
+	}
+	len += scnprintf(buf + len, size - len, " more\n");
+
+	for (ld = 0; ld < MAX_PERF_COLLECTION_VD; ld++) {
+		megasas_perf_merge(instance, ld, &sum);
+		base = &instance->PerformanceMetric.Base[ld];
+		rd = wr = 0;
+		for (b = 0; b < MEGASAS_LAT_BUCKETS; b++) {
+			rd += sum.readLatency[b] - base->readLatency[b];
+			wr += sum.writeLatency[b] - base->writeLatency[b];
+		}
+		if (!rd && !wr)
+			continue;
+		len += scnprintf(buf + len, size - len, "  ld%u read ", ld);
+		for (b = 0; b < MEGASAS_LAT_BUCKETS; b++)
+			len += scnprintf(buf + len, size - len, " %u",
+					 sum.readLatency[b] -
+					 base->readLatency[b]);
+		len += scnprintf(buf + len, size - len, "\n  ld%u write", ld);
+		for (b = 0; b < MEGASAS_LAT_BUCKETS; b++)
+			len += scnprintf(buf + len, size - len, " %u",
+					 sum.writeLatency[b] -
+					 base->writeLatency[b]);
+		len += scnprintf(buf + len, size - len, "\n");
+	}
+	return len;
+}
+
+/* Per-arm state of every load balanced (two drive RAID1) LD */
+static int
+megasas_proc_ld_balance(struct megasas_instance *instance, char *buf, int size)
+{
+	static const char *policy_name[] = {
+		"auto", "seek", "pending", "chunk", "latency"
+	};
+	struct fusion_context *fusion = instance->ctrl_context;
+	PLD_LOAD_BALANCE_INFO lbInfo;
+	u32 cyclesPerUsec, lat[2];
+	int len = 0, ld, arm;
+
+	if (!fusion)
+		return 0;
+	cyclesPerUsec = fusion->lb_cycles_per_usec;
+
+	for (ld = 0; ld < MAX_LOGICAL_DRIVES; ld++) {
+		lbInfo = &fusion->load_balance_info[ld];
+		if (!lbInfo->loadBalanceFlag)
+			continue;
+		for (arm = 0; arm < 2; arm++) {
+			lat[arm] = lbInfo->lat_ewma[arm];
+			if (cyclesPerUsec)
+				lat[arm] /= cyclesPerUsec;
+		}
+		len += scnprintf(buf + len, size - len,
+				 "ld%u balance %s%s pending %d/%d "
+				 "reads %u/%u latency(%s) %u/%u\n", ld,
+				 policy_name[lbInfo->policy],
+				 lbInfo->policy == MR_LB_POLICY_AUTO ?
+				 (lbInfo->ssd ? "(ssd)" : "(hdd)") : "",
+				 atomic_read(&lbInfo->scsi_pending_cmds[0]),
+				 atomic_read(&lbInfo->scsi_pending_cmds[1]),
+				 atomic_read(&lbInfo->arm_reads[0]),
+				 atomic_read(&lbInfo->arm_reads[1]),
+				 cyclesPerUsec ? "us" : "cycles",
+				 lat[0], lat[1]);
+	}
+	return len;
+}
+
+/**
+ * megasas_proc_info -		/proc/scsi read handler
+ * @host:			SCSI host of the adapter
+ * @buffer:			output buffer
+ * @start:			where the requested data starts in @buffer
+ * @offset:			offset into the imaginary file
+ * @length:			size of @buffer
+ * @func:			0 for read, 1 for write
+ *
+ * driver_create_file() is a no-op on vmklinux, so the per-adapter
+ * statistics are reported here instead of through driver attributes.
+ */
+static int
+megasas_proc_info(struct Scsi_Host *host, char *buffer, char **start,
+		  off_t offset, int length, int func)
+{
+	struct megasas_instance *instance =
+	    (struct megasas_instance *)host->hostdata;
+	int len = 0, datalen;
+
+	if (func)
+		return -EINVAL;
+
+	len += megasas_proc_cmd_pool(instance, buffer + len, length - len);
+	len += megasas_proc_io_latency(instance, buffer + len, length - len);
+	len += megasas_proc_ld_balance(instance, buffer + len, length - len);
+
+	datalen = len - offset;
+	if (datalen < 0) {	/* read past EOF */
+		datalen = 0;
+		*start = buffer + len;
+	} else
+		*start = buffer + offset;
+
+	return datalen;
+}
+#endif /* defined(__VMKLNX__) */
+
 /*
  * Scsi host template for megaraid_sas driver
  */
@@ -2708,6 +3128,7 @@ static struct scsi_host_template megasas_template = {
 	.queuecommand = megasas_queue_command,
 #if defined(__VMKLNX__)
 	.eh_abort_handler = megasas_abort,
+	.proc_info = megasas_proc_info,
 #endif /* defined(__VMKLNX__) */
 	.eh_device_reset_handler = megasas_reset_device,
 	.eh_bus_reset_handler = megasas_reset_bus_host,
@@ -3000,6 +3421,7 @@ megasas_complete_cmd(struct megasas_instance *instance, struct megasas_cmd *cmd,
 
 		atomic_dec(&instance->fw_outstanding);
 
+		CompleteIOMetric(instance, &cmd->io_stamp);
 		megasas_unmap_sgbuf(instance, cmd);
 		cmd->scmd->scsi_done(cmd->scmd);
 		megasas_return_cmd(instance, cmd);
@@ -3747,7 +4169,11 @@ void megasas_free_cmds(struct megasas_instance *instance)
 	kfree(instance->cmd_list);
 	instance->cmd_list = NULL;
 
+	kfree(instance->cmd_cache);
+	instance->cmd_cache = NULL;
+
 	INIT_LIST_HEAD(&instance->cmd_pool);
+	INIT_LIST_HEAD(&instance->cmd_pool_reserved);
 }
 
 /**
@@ -3810,8 +4236,28 @@ int megasas_alloc_cmds(struct megasas_instance *instance)
 		memset(instance->cmd_list[i], 0, sizeof(struct megasas_cmd));
 	}
 
+	instance->cmd_cache = kmalloc(instance->nr_cpus *
+				      sizeof(*instance->cmd_cache), GFP_KERNEL);
+	if (!instance->cmd_cache) {
+		for (i = 0; i < max_cmd; i++)
+			kfree(instance->cmd_list[i]);
+		kfree(instance->cmd_list);
+		instance->cmd_list = NULL;
+		return -ENOMEM;
+	}
+	for (i = 0; i < instance->nr_cpus; i++) {
+		struct megasas_cmd_cache *cache = &instance->cmd_cache[i];
+
+		memset(cache, 0, sizeof(*cache));
+		spin_lock_init(&cache->lock);
+		INIT_LIST_HEAD(&cache->free);
+	}
+	instance->reserved_mfi_cmds = min_t(u32, MEGASAS_RESERVED_MFI_CMDS,
+					    max_cmd);
+
 	/*
-	 * Add all the commands to command pool (instance->cmd_pool)
+	 * Add all the commands to command pool (instance->cmd_pool), the
+	 * first reserved_mfi_cmds to instance->cmd_pool_reserved
 	 */
 	for (i = 0; i < max_cmd; i++) {
 		cmd = instance->cmd_list[i];
@@ -3820,7 +4266,10 @@ int megasas_alloc_cmds(struct megasas_instance *instance)
 		cmd->scmd = NULL;
 		cmd->instance = instance;
 
-		list_add_tail(&cmd->list, &instance->cmd_pool);
+		if (i < instance->reserved_mfi_cmds)
+			list_add_tail(&cmd->list, &instance->cmd_pool_reserved);
+		else
+			list_add_tail(&cmd->list, &instance->cmd_pool);
 	}
 
 	/*
@@ -5023,6 +5472,7 @@ megasas_probe_one(struct pci_dev *pdev, const struct pci_device_id *id)
 	instance->host = host;
 	instance->unique_id = pdev->bus->number << 8 | pdev->devfn;
 	instance->init_id = MEGASAS_DEFAULT_INIT_ID;
+	instance->nr_cpus = num_online_cpus();
 
 	switch(instance->pdev->device)
 	{
@@ -5084,10 +5534,20 @@ megasas_probe_one(struct pci_dev *pdev, const struct pci_device_id *id)
 		goto fail_alloc_dma_buf;
 	}
 
+	instance->perf_cpu = kzalloc(instance->nr_cpus *
+				     sizeof(*instance->perf_cpu), GFP_KERNEL);
+	if (!instance->perf_cpu) {
+		printk(KERN_DEBUG "megasas: Failed to allocate memory for "
+		       "I/O metrics\n");
+		goto fail_alloc_dma_buf;
+	}
+	megasas_perf_start(instance);
+
 	/*
 	 * Initialize locks and queues
 	 */
 	INIT_LIST_HEAD(&instance->cmd_pool);
+	INIT_LIST_HEAD(&instance->cmd_pool_reserved);
 	INIT_LIST_HEAD(&instance->internal_reset_pending_q);
 
 	atomic_set(&instance->fw_outstanding,0);
@@ -5238,6 +5698,7 @@ retry_irq_register:
 	if (instance->msix_vectors)
 		pci_disable_msix(instance->pdev);
 	fail_alloc_dma_buf:
+	kfree(instance->perf_cpu);
 	if (instance->evt_detail)
 		pci_free_consistent(pdev, sizeof(struct megasas_evt_detail),
 				    instance->evt_detail,
@@ -5593,6 +6054,8 @@ static void megasas_detach_one(struct pci_dev *pdev)
 				    instance->verbuf, instance->verbuf_h);
 	}
 
+	kfree(instance->perf_cpu);
+
 	scsi_host_put(host);
 
 	pci_set_drvdata(pdev, NULL);
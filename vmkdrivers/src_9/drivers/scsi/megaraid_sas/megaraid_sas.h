@@ -1547,16 +1547,43 @@ typedef struct _MR_IO_METRICS {
     MR_IO_METRICS_LD_OVERALL_LIST   ldIoMetrics;    // overall host IO metrics  
 } __attribute__ ((packed)) MR_IO_METRICS;
 
+/*
+ * Host side per-LD counters, kept per CPU so that the I/O path never shares
+ * a cache line with another CPU.  They only ever count up; a collection
+ * period is the difference between two merged snapshots.  Latency bucket i
+ * counts completions that took less than 2^(i + MEGASAS_LAT_SHIFT) cycles,
+ * the last bucket everything slower.
+ */
+#define MEGASAS_LAT_SHIFT       12
+#define MEGASAS_LAT_BUCKETS     20
+
+typedef struct _MEGASAS_LD_PERF {
+    u64                         readBlocks;
+    u64                         writeBlocks;
+    u64                         lastIOCycles;
+    MR_IO_METRICS_SIZE          readSize;
+    MR_IO_METRICS_SIZE          writeSize;
+    MR_IO_METRICS_RANDOMNESS    readRandomness;
+    MR_IO_METRICS_RANDOMNESS    writeRandomness;
+    u32                         readLatency[MEGASAS_LAT_BUCKETS];
+    u32                         writeLatency[MEGASAS_LAT_BUCKETS];
+} MEGASAS_LD_PERF;
+
+struct megasas_perf_cpu {
+    MEGASAS_LD_PERF             ld[MAX_PERF_COLLECTION_VD];
+} ____cacheline_aligned_in_smp;
+
 typedef struct _PERFORMANCEMETRIC
 {
     u8                          LogOn;
     MR_IO_METRICS_LD_OVERALL    IoMetricsLD[MAX_PERF_COLLECTION_VD];
     MR_IO_METRICS_LD_OVERALL    SavedIoMetricsLD[MAX_PERF_COLLECTION_VD];
     u64                         LastBlock[MAX_LOGICAL_DRIVES];
-    u64                         LastIOTime[MAX_PERF_COLLECTION_VD];
     u64                         CollectEndTime;
     u64                         CollectStartTime;
+    u64                         CollectStartCycles;
     u32                         SavedCollectTimeSecs;
+    MEGASAS_LD_PERF             Base[MAX_PERF_COLLECTION_VD];   // merged counters at collection start
 }PERFORMANCEMETRIC;
 
 struct megasas_irq_context {
@@ -1595,6 +1622,10 @@ struct megasas_instance {
 
 	struct megasas_cmd **cmd_list;
 	struct list_head cmd_pool;
+	struct list_head cmd_pool_reserved;
+	struct megasas_cmd_cache *cmd_cache;	/* per-CPU */
+	u32 nr_cpus;				/* entries of per-CPU arrays */
+	u16 reserved_mfi_cmds;
 	spinlock_t cmd_pool_lock;
 	spinlock_t hba_lock;
 	spinlock_t completion_lock;
@@ -1665,6 +1696,7 @@ struct megasas_instance {
 	unsigned long bar;
 	long reset_flags;
 	PERFORMANCEMETRIC PerformanceMetric;
+	struct megasas_perf_cpu *perf_cpu;	/* per-CPU */
 	u32 CurLdCount;
 	struct mutex reset_mutex;
 	u8 is_imr;
@@ -1707,6 +1739,26 @@ struct megasas_instance_template {
 	((scp->device->channel % 2) * MEGASAS_MAX_DEV_PER_CHANNEL) + 	\
 	scp->device->id
 
+/*
+ * Free MFI commands are cached per CPU in front of instance->cmd_pool and
+ * moved between the two MEGASAS_CMD_CACHE_BATCH at a time.  The first
+ * MEGASAS_RESERVED_MFI_CMDS commands live on instance->cmd_pool_reserved
+ * instead, for DCMDs and aborts, so that I/O can never use them up.
+ * vmklinux has no per-CPU allocator, so the caches are a kmalloc'd array
+ * of instance->nr_cpus entries; see megasas_cmd_cache().
+ */
+#define MEGASAS_CMD_CACHE_BATCH			8
+#define MEGASAS_CMD_CACHE_MAX			(2 * MEGASAS_CMD_CACHE_BATCH)
+#define MEGASAS_RESERVED_MFI_CMDS		MEGASAS_SKINNY_INT_CMDS
+
+struct megasas_cmd_cache {
+	spinlock_t lock;
+	struct list_head free;
+	u32 count;
+	unsigned long remote_returns;	/* freed on another CPU */
+	unsigned long pool_empty;	/* allocations that found no command */
+} ____cacheline_aligned_in_smp;
+
 struct megasas_cmd {
 
 	union megasas_frame *frame;
@@ -1719,6 +1771,8 @@ struct megasas_cmd {
 	u8 cmd_status;
 	u8 abort_aen;
         u8 retry_for_fw_reset;
+	u16 cpu;		/* CPU the command was allocated on */
+	struct megasas_io_stamp io_stamp;
 
 	struct list_head list;
 	struct scsi_cmnd *scmd;
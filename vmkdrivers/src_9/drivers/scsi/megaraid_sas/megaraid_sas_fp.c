@@ -72,6 +72,8 @@
 void	mr_update_load_balance_params(MR_FW_RAID_MAP_ALL *map, 
 		PLD_LOAD_BALANCE_INFO lbInfo);
 void mr_update_span_set(MR_FW_RAID_MAP_ALL *map, PLD_SPAN_INFO ldSpanInfo);
+void mr_update_fp_layout(MR_FW_RAID_MAP_ALL *map, PLD_SPAN_INFO ldSpanInfo,
+	PLD_FP_LAYOUT fpLayout);
 static u8 mr_spanset_get_phy_params(struct megasas_instance *instance, u32 ld, 
 	u64 stripRow, u16 stripRef, struct IO_REQUEST_INFO *io_info,
 	RAID_CONTEXT *pRAID_Context, MR_FW_RAID_MAP_ALL *map);
@@ -109,6 +111,91 @@ u64 mega_div64_32(uint64_t dividend, uint32_t divisor)
 	return d;
 }
 
+/*
+ * Prepare divisor d for mr_fp_div64().  A power of 2 becomes a shift, any
+ * other d gets a round-up reciprocal (Granlund & Montgomery) that is exact
+ * for all 32-bit dividends.
+ */
+static void mr_fp_div_init(MR_FP_DIV *dv, u32 d)
+{
+	u64 m;
+	int l;
+
+	memset(dv, 0, sizeof(*dv));
+	dv->d = d;
+	if (d == 0)
+		return;
+	if ((d & (d - 1)) == 0) {
+		dv->shift = ffs(d) - 1;
+		return;
+	}
+	l = fls(d - 1);
+	m = (1ULL << 32) * ((1ULL << l) - d);
+	do_div(m, d);
+	dv->m = (u32)m + 1;
+	dv->shift = l - 1;
+}
+
+/**
+ * @param dividend    : Dividend
+ * @param dv          : Divisor prepared by mr_fp_div_init(), not 0
+ * @param rem         : Remainder
+ *
+ * @return quotient
+ **/
+static inline u64 mr_fp_div64(u64 dividend, const MR_FP_DIV *dv, u32 *rem)
+{
+	u64 d;
+	u32 n, q;
+
+	if (!dv->m) {
+		*rem = (u32)dividend & (dv->d - 1);
+		return dividend >> dv->shift;
+	}
+	if (dividend >> 32) {
+		d = dividend;
+		*rem = do_div(d, dv->d);
+		return d;
+	}
+	n = (u32)dividend;
+	q = (u32)(((u64)n * dv->m) >> 32);
+	q = (q + ((n - q) >> 1)) >> dv->shift;
+	*rem = n - q * dv->d;
+	return q;
+}
+
+/* Returns the compiled layout of ld, or NULL if it does not match the map. */
+static inline PLD_FP_LAYOUT mr_fp_layout_get(struct megasas_instance *instance,
+	u32 ld, MR_LD_RAID *raid)
+{
+	struct fusion_context *fusion = instance->ctrl_context;
+	PLD_FP_LAYOUT layout = &fusion->fp_layout[ld];
+
+	if (layout->valid && layout->seqNum == raid->seqNum)
+		return layout;
+	return NULL;
+}
+
+/*
+ * Returns TRUE if row lies on the stride of quad, and the row's block
+ * within the quad in *blk.  Caller has checked the row is within quad.
+ */
+static inline u8 mr_quad_row_blk(PLD_FP_LAYOUT layout, u32 span, u32 element,
+	MR_QUAD_ELEMENT *quad, u64 row, u64 *blk)
+{
+	u32 rem;
+
+	if (layout) {
+		*blk = mr_fp_div64(row - quad->logStart,
+				&layout->quadDiff[span][element], &rem);
+		return rem == 0;
+	}
+	if (mega_mod64(row - quad->logStart, quad->diff))
+		return FALSE;
+	*blk = mega_div64_32(row - quad->logStart, quad->diff);
+	return TRUE;
+}
+
 MR_LD_RAID *MR_LdRaidGet(u32 ld, MR_FW_RAID_MAP_ALL *map)
 {
 	return &map->raidMap.ldSpanMap[ld].ldRaid;
@@ -178,17 +265,22 @@ u8 MR_ValidateMapInfo(struct megasas_instance *instance)
 	if (instance->UnevenSpanSupport)
 		mr_update_span_set(map, ldSpanInfo);
 
+	mr_update_fp_layout(map, instance->UnevenSpanSupport ? ldSpanInfo : NULL,
+		fusion->fp_layout);
+
 	mr_update_load_balance_params(map, lbInfo);
 
 	return 1;
 }
 
-u32    MR_GetSpanBlock(u32 ld, u64 row, u64 *span_blk, MR_FW_RAID_MAP_ALL *map)
+u32    MR_GetSpanBlock(u32 ld, u64 row, u64 *span_blk, MR_FW_RAID_MAP_ALL *map,
+	PLD_FP_LAYOUT layout)
 {
 	MR_SPAN_BLOCK_INFO *pSpanBlock = MR_LdSpanInfoGet(ld, map);
 	MR_QUAD_ELEMENT    *quad;
 	MR_LD_RAID         *raid = MR_LdRaidGet(ld, map);
 	u32                span, j;
+	u64                blk;
 
 	for (span=0; span<raid->spanDepth; span++, pSpanBlock++) {
 
@@ -198,12 +290,9 @@ u32    MR_GetSpanBlock(u32 ld, u64 row, u64 *span_blk, MR_FW_RAID_MAP_ALL *map)
 			if (quad->diff == 0) 
 				return SPAN_INVALID;
 
-			if (quad->logStart <= row  &&  row <= quad->logEnd  &&  ( mega_mod64(row-quad->logStart, quad->diff)) == 0) {
+			if (quad->logStart <= row  &&  row <= quad->logEnd  &&
+			    mr_quad_row_blk(layout, span, j, quad, row, &blk)) {
 				if (span_blk != NULL) {
-					u64  blk, debugBlk;
-					blk =  mega_div64_32((row-quad->logStart), quad->diff);
-					debugBlk = blk;
-
 					blk = (blk + quad->offsetInSpan) << raid->stripeShift;
 					*span_blk = blk;
 				}
@@ -312,6 +401,8 @@ u32 mr_spanset_get_span_block(struct megasas_instance *instance, u32 ld, u64 row
 	MR_QUAD_ELEMENT    *quad;
 	u32    span, info;
 	PLD_SPAN_INFO ldSpanInfo = fusion->log_to_span;
+	PLD_FP_LAYOUT layout = mr_fp_layout_get(instance, ld, raid);
+	u64    blk;
 
 	for (info=0; info < MAX_QUAD_DEPTH; info++) {
 		span_set = &(ldSpanInfo[ld].span_set[info]);
@@ -330,13 +421,9 @@ u32 mr_spanset_get_span_block(struct megasas_instance *instance, u32 ld, u64 row
 
 				if ( quad->logStart <= row  && 
 					row <= quad->logEnd  && 
-					(mega_mod64(row - quad->logStart, 
-						quad->diff)) == 0 ) {
+					mr_quad_row_blk(layout, span, info,
+						quad, row, &blk)) {
 					if (span_blk != NULL) {
-						u64  blk;
-						blk = mega_div64_32
-						    ((row - quad->logStart), 
-						    quad->diff);
 						blk = (blk + quad->offsetInSpan)
 							 << raid->stripeShift;
 						*span_blk = blk;
@@ -371,6 +458,7 @@ static u64  get_row_from_strip(struct megasas_instance *instance,
 	MR_LD_RAID	*raid = MR_LdRaidGet(ld, map);
 	LD_SPAN_SET 	*span_set;
 	PLD_SPAN_INFO	ldSpanInfo = fusion->log_to_span;
+	PLD_FP_LAYOUT	layout = mr_fp_layout_get(instance, ld, raid);
 	u32		info, strip_offset, span, span_offset;
 	u64		span_set_Strip, span_set_Row;
 
@@ -381,10 +469,17 @@ static u64  get_row_from_strip(struct megasas_instance *instance,
 		if (strip > span_set->data_strip_end) continue;
 
 		span_set_Strip = strip - span_set->data_strip_start;
-        	strip_offset = mega_mod64(span_set_Strip, 
+		if (layout && layout->spanSetWidth[info].d ==
+				span_set->span_row_data_width) {
+			span_set_Row = mr_fp_div64(span_set_Strip,
+				&layout->spanSetWidth[info], &strip_offset);
+		} else {
+			strip_offset = mega_mod64(span_set_Strip, 
+				span_set->span_row_data_width);
+			span_set_Row = mega_div64_32(span_set_Strip, 
 				span_set->span_row_data_width);
-		span_set_Row = mega_div64_32(span_set_Strip, 
-				span_set->span_row_data_width) * span_set->diff;
+		}
+		span_set_Row *= span_set->diff;
 		for (span=0,span_offset=0; span<raid->spanDepth; span++)
 			if (map->raidMap.ldSpanMap[ld].spanBlock[span].
 				block_span_info.noElements >=info+1) {
@@ -491,6 +586,7 @@ static u32 get_arm_from_strip(struct megasas_instance *instance,
 	MR_LD_RAID         *raid = MR_LdRaidGet(ld, map);
 	LD_SPAN_SET *span_set;
 	PLD_SPAN_INFO ldSpanInfo = fusion->log_to_span;
+	PLD_FP_LAYOUT layout = mr_fp_layout_get(instance, ld, raid);
 	u32    info, strip_offset, span, span_offset;
 
 	for (info=0; info<MAX_QUAD_DEPTH; info++) {
@@ -499,7 +595,12 @@ static u32 get_arm_from_strip(struct megasas_instance *instance,
 		if (span_set->span_row_data_width == 0) break;
 		if (strip > span_set->data_strip_end) continue;
 
-		strip_offset = (uint)mega_mod64
+		if (layout && layout->spanSetWidth[info].d ==
+				span_set->span_row_data_width)
+			(void)mr_fp_div64(strip - span_set->data_strip_start,
+				&layout->spanSetWidth[info], &strip_offset);
+		else
+			strip_offset = (uint)mega_mod64
 				((strip - span_set->data_strip_start), 
 				span_set->span_row_data_width);
 
@@ -580,6 +681,7 @@ static u8 mr_spanset_get_phy_params(struct megasas_instance *instance, u32 ld, u
 	u64	*pdBlock = &io_info->pdBlock;
 	u16	*pDevHandle = &io_info->devHandle;
 	u32	logArm, rowMod, armQ, arm;
+	PLD_FP_LAYOUT layout = mr_fp_layout_get(instance, ld, raid);
 
 	// Get row and span from io_info for Uneven Span IO.
 	row 	    = io_info->start_row;
@@ -593,7 +695,10 @@ static u8 mr_spanset_get_phy_params(struct megasas_instance *instance, u32 ld, u
 		logArm = get_arm_from_strip(instance, ld, stripRow, map);
 		if (logArm == (u32)-1)
 			return FALSE;                
-		rowMod = mega_mod64(row, SPAN_ROW_SIZE(map, ld, span));   
+		if (layout)
+			(void)mr_fp_div64(row, &layout->spanRowSize[span], &rowMod);
+		else
+			rowMod = mega_mod64(row, SPAN_ROW_SIZE(map, ld, span));
 		armQ = SPAN_ROW_SIZE(map,ld,span) - 1 - rowMod;  
 		arm = armQ + 1 + logArm;                        
 		if (arm >= SPAN_ROW_SIZE(map, ld, span))               
@@ -659,36 +764,51 @@ u8 MR_GetPhyParams(struct megasas_instance *instance,u32 ld, u64 stripRow,
 	u8          do_invader = 0;
 	u64 *pdBlock = &io_info->pdBlock;
 	u16 *pDevHandle = &io_info->devHandle;
+	PLD_FP_LAYOUT layout = mr_fp_layout_get(instance, ld, raid);
+	u32         logArm;
 
 	if (instance->pdev->device == PCI_DEVICE_ID_LSI_INVADER ||
 		instance->pdev->device == PCI_DEVICE_ID_LSI_FURY)
 		do_invader = 1;
 
-	row =  mega_div64_32(stripRow, raid->rowDataSize);
+	if (layout)
+		row = mr_fp_div64(stripRow, &layout->rowDataSize, &logArm);
+	else
+		row =  mega_div64_32(stripRow, raid->rowDataSize);
 
 	if (raid->level == 6) {
-		u32 logArm =  mega_mod64(stripRow, raid->rowDataSize);      // logical arm within row
 		u32 rowMod, armQ, arm;
 
+		if (!layout)
+			logArm =  mega_mod64(stripRow, raid->rowDataSize);      // logical arm within row
 		if (raid->rowSize == 0)
 			return FALSE;
-		rowMod = mega_mod64(row, raid->rowSize);               // get logical row mod
+		if (layout)
+			(void)mr_fp_div64(row, &layout->rowSize, &rowMod);
+		else
+			rowMod = mega_mod64(row, raid->rowSize);               // get logical row mod
 		armQ = raid->rowSize-1-rowMod;              // index of Q drive
 		arm = armQ+1+logArm;                        // data always logically follows Q
 		if (arm >= raid->rowSize)                       // handle wrap condition
 			arm -= raid->rowSize;
 		physArm = (u8)arm;
 	} else  {
+		u32 armIdx;
+
 		if (raid->modFactor == 0)
 			return FALSE;
-		physArm = MR_LdDataArmGet(ld,  mega_mod64(stripRow, raid->modFactor), map);
+		if (layout)
+			(void)mr_fp_div64(stripRow, &layout->modFactor, &armIdx);
+		else
+			armIdx = mega_mod64(stripRow, raid->modFactor);
+		physArm = MR_LdDataArmGet(ld, armIdx, map);
 	}
 
 	if (raid->spanDepth == 1) {
 		span = 0;
 		*pdBlock = row << raid->stripeShift;
 	} else {
-		span = (u8)MR_GetSpanBlock(ld, row, pdBlock, map);
+		span = (u8)MR_GetSpanBlock(ld, row, pdBlock, map, layout);
 		if (span == SPAN_INVALID) 
 			return FALSE;
 	}
@@ -747,6 +867,8 @@ MR_BuildRaidContext(struct megasas_instance *instance,
 	u8	    retval = 0;
 	u8	    startlba_span = SPAN_INVALID;
 	u64 *pdBlock = &io_info->pdBlock;
+	PLD_FP_LAYOUT layout;
+	u32         rem;
 
 	ldStartBlock = io_info->ldStartBlock;
 	numBlocks = io_info->numBlocks;
@@ -822,6 +944,9 @@ MR_BuildRaidContext(struct megasas_instance *instance,
 		printk("LSI Debug : 1. start_row 0x%llx endRow 0x%llx Start span 0x%x\n", 
 			(unsigned long long)start_row, (unsigned long long)endRow, startlba_span);
 #endif
+	} else if ((layout = mr_fp_layout_get(instance, ld, raid)) != NULL) {
+		start_row           =  mr_fp_div64(start_strip, &layout->rowDataSize, &rem);
+		endRow              =  mr_fp_div64(endStrip, &layout->rowDataSize, &rem);
 	} else {
 		start_row           =  mega_div64_32(start_strip, raid->rowDataSize);      // Start Row
 		endRow              =  mega_div64_32(endStrip, raid->rowDataSize);
@@ -1055,6 +1180,66 @@ void mr_update_span_set(MR_FW_RAID_MAP_ALL *map, PLD_SPAN_INFO ldSpanInfo)
 
 }
 
+/*
+******************************************************************************
+*
+* This routine compiles the divisors used by fast path I/O mapping for every
+* ld in a validated Raid map.  Must run after mr_update_span_set() when
+* uneven spans are supported.
+*
+* Inputs :
+*    map    - LD map
+*    ldSpanInfo - ldSpanInfo per HBA instance, NULL without uneven span support
+*    fpLayout - fp_layout per HBA instance
+*
+*/
+void mr_update_fp_layout(MR_FW_RAID_MAP_ALL *map, PLD_SPAN_INFO ldSpanInfo,
+	PLD_FP_LAYOUT fpLayout)
+{
+	MR_LD_RAID *raid;
+	MR_SPAN_INFO *spanInfo;
+	PLD_FP_LAYOUT layout;
+	u32 span, element;
+	int ldCount;
+	u16 ld;
+
+	for (ld = 0; ld < MAX_LOGICAL_DRIVES; ld++)
+		fpLayout[ld].valid = 0;
+	wmb();
+
+	for (ldCount = 0; ldCount < MAX_LOGICAL_DRIVES; ldCount++) {
+		ld = MR_TargetIdToLdGet(ldCount, map);
+		if (ld >= MAX_LOGICAL_DRIVES)
+			continue;
+		raid = MR_LdRaidGet(ld, map);
+		if (raid->spanDepth > MAX_SPAN_DEPTH)
+			continue;
+		layout = &fpLayout[ld];
+
+		mr_fp_div_init(&layout->rowDataSize, raid->rowDataSize);
+		mr_fp_div_init(&layout->rowSize, raid->rowSize);
+		mr_fp_div_init(&layout->modFactor, raid->modFactor);
+		for (span = 0; span < raid->spanDepth; span++) {
+			mr_fp_div_init(&layout->spanRowSize[span],
+				SPAN_ROW_SIZE(map, ld, span));
+			spanInfo = &map->raidMap.ldSpanMap[ld].spanBlock[span].
+					block_span_info;
+			for (element = 0; element < MAX_QUAD_DEPTH &&
+					element < spanInfo->noElements; element++)
+				mr_fp_div_init(&layout->quadDiff[span][element],
+					spanInfo->quad[element].diff);
+		}
+		for (element = 0; element < MAX_QUAD_DEPTH; element++)
+			mr_fp_div_init(&layout->spanSetWidth[element],
+				ldSpanInfo ? ldSpanInfo[ld].span_set[element].
+					span_row_data_width : 0);
+
+		layout->seqNum = raid->seqNum;
+		wmb();
+		layout->valid = 1;
+	}
+}
+
 
 void
 mr_update_load_balance_params(MR_FW_RAID_MAP_ALL *map, PLD_LOAD_BALANCE_INFO lbInfo)
@@ -1079,6 +1264,11 @@ mr_update_load_balance_params(MR_FW_RAID_MAP_ALL *map, PLD_LOAD_BALANCE_INFO lbI
 			u32 pd, arRef;
 
 			lbInfo[ldCount].loadBalanceFlag = 1;
+			lbInfo[ldCount].stripeShift = raid->stripeShift;
+			lbInfo[ldCount].policy =
+				(megasas_lb_policy > 0 &&
+				 megasas_lb_policy <= MR_LB_POLICY_MAX) ?
+				megasas_lb_policy : MR_LB_POLICY_AUTO;
 			
 			arRef = MR_LdSpanArrayGet(ld, 0, map);    // Get the array on which this span is present.
 
@@ -1091,16 +1281,13 @@ mr_update_load_balance_params(MR_FW_RAID_MAP_ALL *map, PLD_LOAD_BALANCE_INFO lbI
 	}
 }
 
-u8 megasas_get_best_arm(PLD_LOAD_BALANCE_INFO lbInfo, u8 arm, u64 block, u32 count)
+/* Legacy choice: nearest head, unless that arm is 4+ commands deeper */
+static u8 mr_lb_seek_arm(PLD_LOAD_BALANCE_INFO lbInfo, u8 arm, u64 block,
+			 u16 pend0, u16 pend1)
 {
-	u16     pend0, pend1;
 	u64     diff0, diff1;
 	u8      bestArm;
 
-	/* get the pending cmds for the data and mirror arms */
-	pend0 = atomic_read(&lbInfo->scsi_pending_cmds[0]);
-	pend1 = atomic_read(&lbInfo->scsi_pending_cmds[1]);
-
 	/* Determine the disk whose head is nearer to the req. block */
 	diff0 = ABS_DIFF(block, lbInfo->last_accessed_block[0]);
 	diff1 = ABS_DIFF(block, lbInfo->last_accessed_block[1]);
@@ -1110,12 +1297,102 @@ u8 megasas_get_best_arm(PLD_LOAD_BALANCE_INFO lbInfo, u8 arm, u64 block, u32 cou
 	if ((bestArm == arm && pend0 > pend1 + 4)  || (bestArm != arm && pend1 > pend0 + 4))
 		bestArm ^= 1;
 
+	return bestArm;
+}
+
+/* Expected wait on each arm is (pending + 1) * mean service time */
+static u8 mr_lb_latency_arm(PLD_LOAD_BALANCE_INFO lbInfo, u8 arm,
+			    u16 pend0, u16 pend1)
+{
+	u64 cost0, cost1;
+
+	if (!lbInfo->lat_ewma[0] || !lbInfo->lat_ewma[1])
+		return pend0 == pend1 ? arm : (pend0 < pend1 ? 0 : 1);
+
+	cost0 = (u64)(pend0 + 1) * lbInfo->lat_ewma[0];
+	cost1 = (u64)(pend1 + 1) * lbInfo->lat_ewma[1];
+	if (cost0 == cost1)
+		return arm;
+	return cost0 < cost1 ? 0 : 1;
+}
+
+u8 megasas_get_best_arm(PLD_LOAD_BALANCE_INFO lbInfo, u8 arm, u64 block, u32 count)
+{
+	u16     pend0, pend1;
+	u8      bestArm;
+	u8      policy = lbInfo->policy;
+
+	/* get the pending cmds for the data and mirror arms */
+	pend0 = atomic_read(&lbInfo->scsi_pending_cmds[0]);
+	pend1 = atomic_read(&lbInfo->scsi_pending_cmds[1]);
+
+	if (policy == MR_LB_POLICY_AUTO)
+		policy = lbInfo->ssd ? MR_LB_POLICY_LATENCY : MR_LB_POLICY_SEEK;
+
+	switch (policy) {
+	case MR_LB_POLICY_PENDING:
+		if (pend0 == pend1)
+			bestArm = mr_lb_seek_arm(lbInfo, arm, block, pend0, pend1);
+		else
+			bestArm = pend0 < pend1 ? 0 : 1;
+		break;
+	case MR_LB_POLICY_CHUNK:
+		bestArm = (block >> lbInfo->stripeShift) & 1;
+		break;
+	case MR_LB_POLICY_LATENCY:
+		bestArm = mr_lb_latency_arm(lbInfo, arm, pend0, pend1);
+		break;
+	default:
+		bestArm = mr_lb_seek_arm(lbInfo, arm, block, pend0, pend1);
+		break;
+	}
+
 	/* Update the last accessed block on the correct pd */
 	lbInfo->last_accessed_block[bestArm] = block + count - 1;
 
 	return bestArm;
 }
 
+/*
+ * megasas_lb_complete - account a completed load balanced read
+ *
+ * Drops the arm's pending count and folds the service time into its
+ * latency EWMA.  The EWMA is updated without a lock: a lost sample only
+ * costs precision.  For AUTO LDs the mean of both arms decides, with
+ * hysteresis, whether the arms are treated as SSD or rotating media.
+ */
+void megasas_lb_complete(struct fusion_context *fusion,
+			 PLD_LOAD_BALANCE_INFO lbInfo, u8 arm, u64 start)
+{
+	u32 sample, ewma, mean;
+	u64 delta;
+
+	atomic_dec(&lbInfo->scsi_pending_cmds[arm]);
+	if (!start)
+		return;
+
+	delta = get_cycles() - start;
+	sample = delta > 0xFFFFFFFFULL ? 0xFFFFFFFF : (u32)delta;
+	ewma = lbInfo->lat_ewma[arm];
+	if (!ewma)
+		ewma = sample;
+	else
+		ewma = ewma - (ewma >> MR_LB_EWMA_SHIFT) +
+			(sample >> MR_LB_EWMA_SHIFT);
+	lbInfo->lat_ewma[arm] = ewma;
+
+	if (lbInfo->policy != MR_LB_POLICY_AUTO || !fusion->lb_cycles_per_usec)
+		return;
+	if (!lbInfo->lat_ewma[0] || !lbInfo->lat_ewma[1])
+		return;
+	mean = (lbInfo->lat_ewma[0] >> 1) + (lbInfo->lat_ewma[1] >> 1);
+	mean /= fusion->lb_cycles_per_usec;
+	if (!lbInfo->ssd && mean < MR_LB_SSD_LATENCY_US)
+		lbInfo->ssd = 1;
+	else if (lbInfo->ssd && mean > MR_LB_HDD_LATENCY_US)
+		lbInfo->ssd = 0;
+}
+
 u16 get_updated_dev_handle(PLD_LOAD_BALANCE_INFO lbInfo, struct IO_REQUEST_INFO *io_info)
 {
 	u8 arm, old_arm;
@@ -1127,6 +1404,7 @@ u16 get_updated_dev_handle(PLD_LOAD_BALANCE_INFO lbInfo, struct IO_REQUEST_INFO
 	arm  = megasas_get_best_arm(lbInfo, old_arm, io_info->ldStartBlock, io_info->numBlocks);
 	devHandle = lbInfo->raid1DevHandle[arm];
 	atomic_inc(&lbInfo->scsi_pending_cmds[arm]);
+	atomic_inc(&lbInfo->arm_reads[arm]);
 
 	return devHandle;
 }
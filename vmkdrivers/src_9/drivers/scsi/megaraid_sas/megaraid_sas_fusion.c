@@ -88,9 +88,11 @@ megasas_check_and_restore_queue_depth(struct megasas_instance *instance);
 
 u8 MR_ValidateMapInfo(struct megasas_instance *instance);
 u16 get_updated_dev_handle(PLD_LOAD_BALANCE_INFO lbInfo, struct IO_REQUEST_INFO *in_info);
+void megasas_lb_complete(struct fusion_context *fusion, PLD_LOAD_BALANCE_INFO lbInfo, u8 arm, u64 start);
 int megasas_transition_to_ready(struct megasas_instance* instance, int ocr);
 void megaraid_sas_kill_hba(struct megasas_instance *instance);
-void UpdateIOMetric(struct megasas_instance *instance, u8 TargetId, u8 isRead, u64 startBlock, u32 NumBlocks);
+void UpdateIOMetric(struct megasas_instance *instance, u8 TargetId, u8 isRead, u64 startBlock, u32 NumBlocks, struct megasas_io_stamp *stamp);
+void CompleteIOMetric(struct megasas_instance *instance, struct megasas_io_stamp *stamp);
 
 extern u32 megasas_dbg_lvl;
 
@@ -198,6 +200,8 @@ megasas_return_cmd_fusion(struct megasas_instance *instance, struct megasas_cmd_
 
 	cmd->scmd = NULL;
         cmd->sync_cmd_idx = (u32)ULONG_MAX;
+	cmd->io_stamp.start = 0;
+	cmd->lb_start = 0;
 	list_add_tail(&cmd->list, &fusion->cmd_pool);
 
 	spin_unlock_irqrestore(&fusion->cmd_pool_lock, flags);
@@ -860,11 +864,17 @@ megasas_init_adapter_fusion(struct megasas_instance *instance)
 {
 	struct megasas_register_set __iomem *reg_set;
 	struct fusion_context *fusion;
+	struct timeval tv_start, tv_end;
+	u64 cycles_start, cycles, usecs;
 	u32 max_cmd;
 	int i = 0, count;
 
 	fusion = instance->ctrl_context;
 
+	/* Bracket FW init to calibrate cycles for the load balance EWMA */
+	do_gettimeofday(&tv_start);
+	cycles_start = get_cycles();
+
 	reg_set = instance->reg_set;
 
 	/*
@@ -936,6 +946,16 @@ megasas_init_adapter_fusion(struct megasas_instance *instance)
         if (!megasas_get_map_info(instance))
                 megasas_sync_map_info(instance);
 
+	cycles = get_cycles() - cycles_start;
+	do_gettimeofday(&tv_end);
+	usecs = (u64)(tv_end.tv_sec - tv_start.tv_sec) * 1000000 +
+		tv_end.tv_usec - tv_start.tv_usec;
+	fusion->lb_cycles_per_usec = 0;
+	if (usecs && !(usecs >> 32)) {
+		do_div(cycles, (u32)usecs);
+		fusion->lb_cycles_per_usec = (u32)cycles;
+	}
+
 	return 0;
 
 fail_map_info:
@@ -1388,7 +1408,6 @@ megasas_build_ldio_fusion(struct megasas_instance *instance,struct scsi_cmnd *sc
 	struct IO_REQUEST_INFO io_info;
 	struct fusion_context *fusion;
         MR_FW_RAID_MAP_ALL *local_map_ptr;
-	unsigned long spinlock_flags;
 	u64 lba;
 
 	device_id = MEGASAS_DEV_INDEX(instance, scp);
@@ -1495,6 +1514,7 @@ megasas_build_ldio_fusion(struct megasas_instance *instance,struct scsi_cmnd *sc
 		if ((fusion->load_balance_info[device_id].loadBalanceFlag) && (io_info.isRead)) {
 			io_info.devHandle = get_updated_dev_handle(&fusion->load_balance_info[device_id], &io_info);
 			scp->SCp.Status |= MEGASAS_LOAD_BALANCE_FLAG;
+			cmd->lb_start = get_cycles();
 		} else
 			scp->SCp.Status &= ~MEGASAS_LOAD_BALANCE_FLAG;
 		cmd->request_desc->SCSIIO.DevHandle = io_info.devHandle;
@@ -1518,9 +1538,7 @@ megasas_build_ldio_fusion(struct megasas_instance *instance,struct scsi_cmnd *sc
 
 	/* Update IO metrics */
 	lba = (u64)start_lba_hi << 32 | start_lba_lo;
-	spin_lock_irqsave(&instance->hba_lock, spinlock_flags);
-	UpdateIOMetric(instance, device_id, io_info.isRead, lba, fp_possible ? io_request->DataLength/512 : io_request->DataLength);
-	spin_unlock_irqrestore(&instance->hba_lock, spinlock_flags);
+	UpdateIOMetric(instance, device_id, io_info.isRead, lba, fp_possible ? io_request->DataLength/512 : io_request->DataLength, &cmd->io_stamp);
 }
 
 /**
@@ -1827,7 +1845,8 @@ complete_cmd_fusion(struct megasas_instance *instance, u32 MSIxIndex)
                         lbinfo = &fusion->load_balance_info[device_id];
                         if (cmd_fusion->scmd->SCp.Status & MEGASAS_LOAD_BALANCE_FLAG) {
                                 arm = lbinfo->raid1DevHandle[0] == cmd_fusion->io_request->DevHandle ? 0 : 1;
-                                atomic_dec(&lbinfo->scsi_pending_cmds[arm]);
+				megasas_lb_complete(fusion, lbinfo, arm, cmd_fusion->lb_start);
+				cmd_fusion->lb_start = 0;
 				cmd_fusion->scmd->SCp.Status &= ~MEGASAS_LOAD_BALANCE_FLAG;
                         }
 			if (reply_descript_type == MPI2_RPY_DESCRIPT_FLAGS_SCSI_IO_SUCCESS) {
@@ -1839,6 +1858,7 @@ complete_cmd_fusion(struct megasas_instance *instance, u32 MSIxIndex)
 		case MEGASAS_MPI2_FUNCTION_LD_IO_REQUEST : /* LD-IO Path */
 			/* Map the FW Cmd Status */
 			map_cmd_status(instance,cmd_fusion,status,extStatus);
+			CompleteIOMetric(instance, &cmd_fusion->io_stamp);
 			megasas_unmap_sgbuf_fusion(instance, cmd_fusion);
 			cmd_fusion->scmd->scsi_done(cmd_fusion->scmd);
         		scsi_io_req->RaidContext.status = 0;
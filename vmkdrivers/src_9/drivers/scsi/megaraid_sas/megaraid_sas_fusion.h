@@ -708,6 +708,16 @@ union desc_word {
 	} u;
 };
 
+/*
+ * I/O metrics submission stamp, consumed on completion.  Shared with
+ * struct megasas_cmd, hence defined here (this header is included first).
+ */
+struct megasas_io_stamp {
+	u64 start;		/* get_cycles() at submission, 0 if not sampled */
+	u8 targetId;
+	u8 isRead;
+};
+
 struct megasas_cmd_fusion {
 	MEGASAS_RAID_SCSI_IO_REQUEST	*io_request;
 	dma_addr_t			io_request_phys_addr;
@@ -732,8 +742,29 @@ struct megasas_cmd_fusion {
 	u32 sync_cmd_idx;
 	u32 index;
 	u8 flags;
+	struct megasas_io_stamp io_stamp;
+	u64 lb_start;		/* get_cycles() at load balanced submission */
 };
 
+/*
+ * RAID1 read balancing policies (lb_policy module parameter).  AUTO
+ * picks SEEK or LATENCY per LD from the measured arm latency, since the
+ * RAID map does not say whether the arms are rotating or solid state.
+ */
+#define MR_LB_POLICY_AUTO	0	/* classify LD by measured latency */
+#define MR_LB_POLICY_SEEK	1	/* nearest head, pending threshold */
+#define MR_LB_POLICY_PENDING	2	/* fewest outstanding commands */
+#define MR_LB_POLICY_CHUNK	3	/* alternate arms per stripe */
+#define MR_LB_POLICY_LATENCY	4	/* pending weighted by latency EWMA */
+#define MR_LB_POLICY_MAX	MR_LB_POLICY_LATENCY
+
+/* AUTO switches to LATENCY below the first mark, back to SEEK above the second */
+#define MR_LB_SSD_LATENCY_US	1000
+#define MR_LB_HDD_LATENCY_US	2000
+#define MR_LB_EWMA_SHIFT	3	/* new sample weight 1/8 */
+
+extern int megasas_lb_policy;
+
 typedef struct _LD_LOAD_BALANCE_INFO
 {
 	u8    loadBalanceFlag;
@@ -741,6 +772,11 @@ typedef struct _LD_LOAD_BALANCE_INFO
 	u16     raid1DevHandle[2];
 	atomic_t     scsi_pending_cmds[2];
 	u64     last_accessed_block[2];
+	u8	policy;			/* MR_LB_POLICY_*, resolved from lb_policy */
+	u8	ssd;			/* AUTO: arms currently classed as SSD */
+	u8	stripeShift;		/* CHUNK: stripe size, log2 blocks */
+	atomic_t	arm_reads[2];	/* reads issued per arm */
+	u32	lat_ewma[2];		/* per-arm read latency, cycles */
 } LD_LOAD_BALANCE_INFO, *PLD_LOAD_BALANCE_INFO;
 
 /* SPAN_SET is info caclulated from span info from Raid map per ld */
@@ -763,6 +799,30 @@ typedef struct LOG_BLOCK_SPAN_INFO {
     LD_SPAN_SET  span_set[MAX_SPAN_DEPTH];
 }LD_SPAN_INFO, *PLD_SPAN_INFO;
 
+/* Divisor prepared by mr_fp_div_init() for mr_fp_div64() */
+typedef struct _MR_FP_DIV {
+    u32  d;
+    u32  m;                 // reciprocal multiplier, 0 if d is a power of 2
+    u8   shift;
+    u8   reserved[3];
+} MR_FP_DIV;
+
+/*
+ * Per ld divisors for fast path I/O mapping, compiled from the raid map by
+ * mr_update_fp_layout() so the I/O path does no 64-bit divisions.
+ */
+typedef struct _LD_FP_LAYOUT {
+    u8         valid;
+    u8         reserved;
+    u16        seqNum;                              // raid->seqNum it was built from
+    MR_FP_DIV  rowDataSize;
+    MR_FP_DIV  rowSize;
+    MR_FP_DIV  modFactor;
+    MR_FP_DIV  spanRowSize[MAX_SPAN_DEPTH];          // per span spanRowSize
+    MR_FP_DIV  spanSetWidth[MAX_SPAN_DEPTH];         // span_set[].span_row_data_width
+    MR_FP_DIV  quadDiff[MAX_SPAN_DEPTH][MAX_QUAD_DEPTH];
+} LD_FP_LAYOUT, *PLD_FP_LAYOUT;
+
 typedef struct _MR_FW_RAID_MAP_ALL {
 
 	MR_FW_RAID_MAP raidMap;
@@ -808,8 +868,10 @@ struct fusion_context
 
 	u32 map_sz;
 	u8 fast_path_io;
+	u32 lb_cycles_per_usec;		/* measured in init_adapter, 0 if unknown */
         LD_LOAD_BALANCE_INFO load_balance_info[MAX_LOGICAL_DRIVES];
 	LD_SPAN_INFO log_to_span[MAX_LOGICAL_DRIVES];
+	LD_FP_LAYOUT fp_layout[MAX_LOGICAL_DRIVES];
 };
 
 union desc_value {
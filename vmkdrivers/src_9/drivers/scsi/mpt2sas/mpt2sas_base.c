@@ -57,6 +57,7 @@
 #include <linux/blkdev.h>
 #include <linux/delay.h>
 #include <linux/interrupt.h>
+#include <linux/prefetch.h>
 #include <linux/dma-mapping.h>
 #include <linux/io.h>
 #include <linux/time.h>
@@ -133,6 +134,11 @@ static int disable_discovery = -1;
 module_param(disable_discovery, int, 0);
 MODULE_PARM_DESC(disable_discovery, " disable discovery ");
 
+static int reply_budget = 256;
+module_param(reply_budget, int, 0);
+MODULE_PARM_DESC(reply_budget, " reply descriptors handled per interrupt "
+    "before deferring to a tasklet, 0 = no limit (default=256) ");
+
 /**
  * _base_fault_reset_work - workq handling ioc fault conditions
  * @work: input argument, used to derive ioc
@@ -868,21 +874,127 @@ union reply_descriptor {
 };
 
 /**
- * _base_interrupt - MPT adapter (IOC) specific interrupt handler.
- * @irq: irq number (not used)
- * @bus_id: bus identifier cookie == pointer to reply_q structure
- * @r: pt_regs pointer (not used)
+ * _base_reply_q_done_flush - hand batched scsi commands to the midlayer
+ * @reply_q: per reply queue object
  *
- * Return IRQ_HANDLE if processed, else IRQ_NONE.
+ * Return nothing.
  */
-static irqreturn_t
-#if (ESX_VERS > ESX41_VERS) || (LINUX_VERSION_CODE > KERNEL_VERSION(2,6,18))
-_base_interrupt(int irq, void *bus_id)
-#else
-_base_interrupt(int irq, void *bus_id, struct pt_regs *r)
-#endif
+static void
+_base_reply_q_done_flush(struct adapter_reply_queue *reply_q)
+{
+	struct scsi_cmnd *scmd;
+	u16 i;
+
+	for (i = 0; i < reply_q->done_count; i++) {
+		scmd = reply_q->done[i];
+		scmd->scsi_done(scmd);
+	}
+	reply_q->done_count = 0;
+}
+
+/**
+ * mpt2sas_base_scsi_done - complete a scsi command from a reply callback
+ * @ioc: per adapter object
+ * @msix_index: MSIX table index supplied by the OS
+ * @scmd: scsi command
+ * Context: reply queue processing
+ *
+ * While the reply queue is being drained the command is parked and
+ * returned to the midlayer together with the rest of its batch, after
+ * the smid and reply frame have been recycled.
+ *
+ * Return nothing.
+ */
+void
+mpt2sas_base_scsi_done(struct MPT2SAS_ADAPTER *ioc, u8 msix_index,
+    struct scsi_cmnd *scmd)
+{
+	struct adapter_reply_queue *reply_q = NULL;
+
+	if (msix_index < MPT2SAS_MAX_REPLY_QUEUES)
+		reply_q = ioc->reply_q_lookup[msix_index];
+	if (!reply_q || !atomic_read(&reply_q->busy)) {
+		scmd->scsi_done(scmd);
+		return;
+	}
+	if (reply_q->done_count == MPT2SAS_REPLY_BATCH)
+		_base_reply_q_done_flush(reply_q);
+	reply_q->done[reply_q->done_count++] = scmd;
+}
+
+/**
+ * _base_reply_post_host_index_update - return consumed descriptors to FW
+ * @ioc: per adapter object
+ * @reply_q: per reply queue object
+ *
+ * Return nothing.
+ */
+static inline void
+_base_reply_post_host_index_update(struct MPT2SAS_ADAPTER *ioc,
+    struct adapter_reply_queue *reply_q)
+{
+	wmb();
+	if (ioc->is_warpdrive) {
+		writel(reply_q->reply_post_host_index,
+		       ioc->reply_post_host_index[reply_q->msix_index]);
+		return;
+	}
+	writel(reply_q->reply_post_host_index | (reply_q->msix_index <<
+	    MPI2_RPHI_MSIX_INDEX_SHIFT), &ioc->chip->ReplyPostHostIndex);
+}
+
+/**
+ * _base_reply_prefetch - warm the cache for the next descriptors
+ * @ioc: per adapter object
+ * @reply_q: per reply queue object
+ * @rpf: descriptor about to be processed
+ *
+ * The descriptor after @rpf was prefetched on the previous pass, so its
+ * smid can be read cheaply to prefetch the scsiio_tracker; the one after
+ * that is prefetched for the next pass.  The tracker of @rpf itself was
+ * fetched last pass, so its scmd is prefetched now.
+ *
+ * Return nothing.
+ */
+static inline void
+_base_reply_prefetch(struct MPT2SAS_ADAPTER *ioc,
+    struct adapter_reply_queue *reply_q, Mpi2ReplyDescriptorsUnion_t *rpf)
+{
+	Mpi2ReplyDescriptorsUnion_t *next;
+	u32 index;
+	u16 smid;
+
+	smid = le16_to_cpu(rpf->Default.DescriptorTypeDependent1);
+	if (smid && smid < ioc->hi_priority_smid)
+		prefetch(ioc->scsi_lookup[smid - 1].scmd);
+
+	index = rpf - reply_q->reply_post_free;
+	index = (index == ioc->reply_post_queue_depth - 1) ? 0 : index + 1;
+	next = &reply_q->reply_post_free[index];
+	if ((next->Default.ReplyFlags & MPI2_RPY_DESCRIPT_FLAGS_TYPE_MASK) !=
+	    MPI2_RPY_DESCRIPT_FLAGS_UNUSED) {
+		smid = le16_to_cpu(next->Default.DescriptorTypeDependent1);
+		if (smid && smid < ioc->hi_priority_smid)
+			prefetch(&ioc->scsi_lookup[smid - 1]);
+	}
+	index = (index == ioc->reply_post_queue_depth - 1) ? 0 : index + 1;
+	prefetch(&reply_q->reply_post_free[index]);
+}
+
+/**
+ * _base_process_reply_queue - drain reply descriptors of one queue
+ * @reply_q: per reply queue object
+ * @budget: stop after this many descriptors, 0 for no limit
+ *
+ * The host index is written back and completed commands are handed to
+ * the midlayer every MPT2SAS_REPLY_BATCH descriptors, and once more when
+ * the queue is empty or the budget is used up.
+ *
+ * Return number of descriptors processed.
+ */
+static u32
+_base_process_reply_queue(struct adapter_reply_queue *reply_q, u32 budget)
 {
-	struct adapter_reply_queue *reply_q = bus_id;
 	union reply_descriptor rd;
 	u32 completed_cmds;
 	u8 request_desript_type;
@@ -893,25 +1005,26 @@ _base_interrupt(int irq, void *bus_id, struct pt_regs *r)
 	struct MPT2SAS_ADAPTER *ioc = reply_q->ioc;
 	Mpi2ReplyDescriptorsUnion_t *rpf;
 	u8 rc;
+	int bucket;
 
 	if (ioc->mask_interrupts)
-		return IRQ_NONE;
+		return 0;
 
 	if (!atomic_add_unless(&reply_q->busy, 1, 1))
-		return IRQ_NONE;
+		return 0;
 
 	rpf = &reply_q->reply_post_free[reply_q->reply_post_host_index];
 
 	if (unlikely(!rpf)) {
 		atomic_dec(&reply_q->busy);
-		return IRQ_NONE;
+		return 0;
 	}
 
 	request_desript_type = rpf->Default.ReplyFlags
 	     & MPI2_RPY_DESCRIPT_FLAGS_TYPE_MASK;
 	if (request_desript_type == MPI2_RPY_DESCRIPT_FLAGS_UNUSED) {
 		atomic_dec(&reply_q->busy);
-		return IRQ_NONE;
+		return 0;
 	}
 
 	completed_cmds = 0;
@@ -920,6 +1033,7 @@ _base_interrupt(int irq, void *bus_id, struct pt_regs *r)
 		rd.word = le64_to_cpu(rpf->Words);
 		if (rd.u.low == UINT_MAX || rd.u.high == UINT_MAX)
 			goto out;
+		_base_reply_prefetch(ioc, reply_q, rpf);
 		reply = 0;
 		smid = le16_to_cpu(rpf->Default.DescriptorTypeDependent1);
 		if (request_desript_type ==
@@ -938,6 +1052,9 @@ _base_interrupt(int irq, void *bus_id, struct pt_regs *r)
 		}
 		if (smid) {
 			cb_idx = _base_get_cb_idx(ioc, smid);
+			/* keep scsi io completions ahead of TM/internal ones */
+			if (cb_idx != ioc->scsi_io_cb_idx)
+				_base_reply_q_done_flush(reply_q);
 			if ((likely(cb_idx < MPT_MAX_CALLBACKS))
 			    && (likely(mpt_callbacks[cb_idx] != NULL))) {
 				rc = mpt_callbacks[cb_idx](ioc, smid,
@@ -950,6 +1067,7 @@ _base_interrupt(int irq, void *bus_id, struct pt_regs *r)
 			}
 		}
 		if (!smid) {
+			_base_reply_q_done_flush(reply_q);
 			_base_async_event(ioc, msix_index, reply);
 		}
 
@@ -979,6 +1097,12 @@ _base_interrupt(int irq, void *bus_id, struct pt_regs *r)
 		completed_cmds++;
 		if (request_desript_type == MPI2_RPY_DESCRIPT_FLAGS_UNUSED)
 			goto out;
+		if (budget && completed_cmds >= budget)
+			goto out;
+		if (!(completed_cmds % MPT2SAS_REPLY_BATCH)) {
+			_base_reply_post_host_index_update(ioc, reply_q);
+			_base_reply_q_done_flush(reply_q);
+		}
 		if (!reply_q->reply_post_host_index)
 			rpf = reply_q->reply_post_free;
 		else
@@ -989,19 +1113,81 @@ _base_interrupt(int irq, void *bus_id, struct pt_regs *r)
 
 	if (!completed_cmds) {
 		atomic_dec(&reply_q->busy);
-		return IRQ_NONE;
+		return 0;
 	}
+	reply_q->completions += completed_cmds;
+	bucket = fls(completed_cmds) - 1;
+	if (bucket >= MPT2SAS_REPLY_HIST_BUCKETS)
+		bucket = MPT2SAS_REPLY_HIST_BUCKETS - 1;
+	reply_q->reply_hist[bucket]++;
 
-	wmb();
-	if (ioc->is_warpdrive) {
-		writel(reply_q->reply_post_host_index,
-		       ioc->reply_post_host_index[msix_index]);
-		atomic_dec(&reply_q->busy);
-		return IRQ_HANDLED;
-	}
-	writel(reply_q->reply_post_host_index | (msix_index <<
-	    MPI2_RPHI_MSIX_INDEX_SHIFT), &ioc->chip->ReplyPostHostIndex);
+	_base_reply_post_host_index_update(ioc, reply_q);
+	_base_reply_q_done_flush(reply_q);
 	atomic_dec(&reply_q->busy);
+	return completed_cmds;
+}
+
+/**
+ * _base_reply_q_pending - are there unprocessed reply descriptors
+ * @reply_q: per reply queue object
+ */
+static inline int
+_base_reply_q_pending(struct adapter_reply_queue *reply_q)
+{
+	return (reply_q->reply_post_free[reply_q->reply_post_host_index].
+	    Default.ReplyFlags & MPI2_RPY_DESCRIPT_FLAGS_TYPE_MASK) !=
+	    MPI2_RPY_DESCRIPT_FLAGS_UNUSED;
+}
+
+/**
+ * _base_reply_tasklet - continue draining a reply queue
+ * @data: pointer to reply_q structure
+ *
+ * Scheduled by the isr when it used up its reply_budget.  Reschedules
+ * itself until the queue is empty, so a long burst of completions never
+ * runs with interrupts off for more than one budget.
+ *
+ * Return nothing.
+ */
+static void
+_base_reply_tasklet(unsigned long data)
+{
+	struct adapter_reply_queue *reply_q =
+	    (struct adapter_reply_queue *)data;
+
+	_base_process_reply_queue(reply_q, max(reply_budget, 0));
+	if (!reply_q->ioc->mask_interrupts && _base_reply_q_pending(reply_q))
+		tasklet_schedule(&reply_q->reply_tasklet);
+}
+
+/**
+ * _base_interrupt - MPT adapter (IOC) specific interrupt handler.
+ * @irq: irq number (not used)
+ * @bus_id: bus identifier cookie == pointer to reply_q structure
+ * @r: pt_regs pointer (not used)
+ *
+ * Return IRQ_HANDLE if processed, else IRQ_NONE.
+ */
+static irqreturn_t
+#if (ESX_VERS > ESX41_VERS) || (LINUX_VERSION_CODE > KERNEL_VERSION(2,6,18))
+_base_interrupt(int irq, void *bus_id)
+#else
+_base_interrupt(int irq, void *bus_id, struct pt_regs *r)
+#endif
+{
+	struct adapter_reply_queue *reply_q = bus_id;
+	u32 budget = max(reply_budget, 0);
+	u32 completed_cmds;
+
+	completed_cmds = _base_process_reply_queue(reply_q, budget);
+	if (!completed_cmds)
+		return IRQ_NONE;
+
+	if (budget && completed_cmds >= budget &&
+	    _base_reply_q_pending(reply_q)) {
+		reply_q->deferred++;
+		tasklet_schedule(&reply_q->reply_tasklet);
+	}
 	return IRQ_HANDLED;
 }
 
@@ -1023,7 +1209,8 @@ _base_interrupt_coredump(int irq, void *context)
 	irqreturn_t irq_rc = IRQ_NONE, rc;
 
 	list_for_each_entry(reply_q, &ioc->reply_queue_list, list) {
-		rc = _base_interrupt(irq, reply_q);
+		rc = _base_process_reply_queue(reply_q, 0) ? IRQ_HANDLED :
+		    IRQ_NONE;
 		irq_rc = ((irq_rc == IRQ_HANDLED) ? irq_rc : rc);
 	}
 	return irq_rc;
@@ -1071,11 +1258,7 @@ mpt2sas_base_flush_reply_queues(struct MPT2SAS_ADAPTER *ioc)
 		/* TMs are on msix_index == 0 */
 		if (reply_q->msix_index == 0)
 			continue;
-#if (ESX_VERS > ESX41_VERS) || (LINUX_VERSION_CODE > KERNEL_VERSION(2,6,18))
-		_base_interrupt(reply_q->vector, (void *)reply_q);
-#else
-		_base_interrupt(reply_q->vector, (void *)reply_q, NULL);
-#endif
+		_base_process_reply_queue(reply_q, 0);
 	}
 }
 
@@ -1376,6 +1559,9 @@ _base_free_irq(struct MPT2SAS_ADAPTER *ioc)
 		list_del(&reply_q->list);
 		synchronize_irq(reply_q->vector);
 		free_irq(reply_q->vector, reply_q);
+		tasklet_kill(&reply_q->reply_tasklet);
+		if (reply_q->msix_index < MPT2SAS_MAX_REPLY_QUEUES)
+			ioc->reply_q_lookup[reply_q->msix_index] = NULL;
 		kfree(reply_q);
 	}
 }
@@ -1404,6 +1590,8 @@ _base_request_irq(struct MPT2SAS_ADAPTER *ioc, u8 index, u32 vector)
 	reply_q->msix_index = index;
 	reply_q->vector = vector;
 	atomic_set(&reply_q->busy, 0);
+	tasklet_init(&reply_q->reply_tasklet, _base_reply_tasklet,
+	    (unsigned long)reply_q);
 	if (ioc->msix_enable)
 		snprintf(reply_q->name, MPT_NAME_LENGTH, "%s%d-msix%d",
 		    MPT2SAS_DRIVER_NAME, ioc->id, index);
@@ -1426,6 +1614,8 @@ _base_request_irq(struct MPT2SAS_ADAPTER *ioc, u8 index, u32 vector)
 
 	INIT_LIST_HEAD(&reply_q->list);
 	list_add_tail(&reply_q->list, &ioc->reply_queue_list);
+	if (index < MPT2SAS_MAX_REPLY_QUEUES)
+		ioc->reply_q_lookup[index] = reply_q;
 	return 0;
 }
 
@@ -1812,6 +2002,163 @@ mpt2sas_base_get_smid(struct MPT2SAS_ADAPTER *ioc, u8 cb_idx)
 	return smid;
 }
 
+/**
+ * _base_lookup_lock_account - account a scsi_lookup_lock hold
+ * @cache: per cpu smid cache of the holder
+ * @start: cycle count when the lock was taken
+ */
+static inline void
+_base_lookup_lock_account(struct smid_cache *cache, cycles_t start)
+{
+	u64 held = get_cycles() - start;
+
+	cache->lookup_lock_count++;
+	cache->lookup_lock_cycles += held;
+	if (held > cache->lookup_lock_max)
+		cache->lookup_lock_max = held;
+}
+
+/**
+ * _base_smid_cache_refill - move a batch of smids from free_list to a cache
+ * @ioc: per adapter object
+ * @cache: per cpu smid cache, locked by the caller
+ *
+ * Context: takes ioc->scsi_lookup_lock inside cache->lock.
+ */
+static void
+_base_smid_cache_refill(struct MPT2SAS_ADAPTER *ioc, struct smid_cache *cache)
+{
+	struct scsiio_tracker *request;
+	cycles_t start;
+
+	spin_lock(&ioc->scsi_lookup_lock);
+	start = get_cycles();
+	while (cache->count < MPT2SAS_SMID_CACHE_BATCH &&
+	    !list_empty(&ioc->free_list)) {
+		request = list_entry(ioc->free_list.next,
+		    struct scsiio_tracker, tracker_list);
+		list_del(&request->tracker_list);
+		cache->smid[cache->count++] = request->smid;
+	}
+	_base_lookup_lock_account(cache, start);
+	spin_unlock(&ioc->scsi_lookup_lock);
+	cache->refills++;
+}
+
+/**
+ * _base_smid_cache_flush - return the oldest batch of a full cache
+ * @ioc: per adapter object
+ * @cache: per cpu smid cache, locked by the caller
+ *
+ * Context: takes ioc->scsi_lookup_lock inside cache->lock.
+ */
+static void
+_base_smid_cache_flush(struct MPT2SAS_ADAPTER *ioc, struct smid_cache *cache)
+{
+	cycles_t start;
+	int i;
+
+	spin_lock(&ioc->scsi_lookup_lock);
+	start = get_cycles();
+	for (i = 0; i < MPT2SAS_SMID_CACHE_BATCH; i++)
+		list_add_tail(&ioc->scsi_lookup[cache->smid[i] - 1].tracker_list,
+		    &ioc->free_list);
+	_base_lookup_lock_account(cache, start);
+	spin_unlock(&ioc->scsi_lookup_lock);
+
+	cache->count -= MPT2SAS_SMID_CACHE_BATCH;
+	memmove(cache->smid, cache->smid + MPT2SAS_SMID_CACHE_BATCH,
+	    cache->count * sizeof(cache->smid[0]));
+	cache->flushes++;
+}
+
+/**
+ * _base_smid_cache - the smid cache of a cpu
+ * @ioc: per adapter object
+ * @cpu: cpu id
+ *
+ * A cpu id past the end of the array wraps onto another cpu's cache,
+ * which is safe since every cache access takes its lock.
+ */
+static inline struct smid_cache *
+_base_smid_cache(struct MPT2SAS_ADAPTER *ioc, int cpu)
+{
+	return &ioc->smid_cache[cpu % ioc->cpu_count];
+}
+
+/**
+ * _base_smid_steal - take a smid from another cpu's cache
+ * @ioc: per adapter object
+ * @this_cpu: the cpu whose cache (and free_list) came up empty
+ *
+ * Returns smid (zero is invalid)
+ */
+static u16
+_base_smid_steal(struct MPT2SAS_ADAPTER *ioc, int this_cpu)
+{
+	struct smid_cache *cache;
+	unsigned long flags;
+	u16 smid = 0;
+	int cpu;
+
+	for (cpu = 0; cpu < ioc->cpu_count; cpu++) {
+		cache = &ioc->smid_cache[cpu];
+		if (cache == _base_smid_cache(ioc, this_cpu))
+			continue;
+		if (!cache->count)
+			continue;
+		spin_lock_irqsave(&cache->lock, flags);
+		if (cache->count) {
+			smid = cache->smid[--cache->count];
+			cache->steals++;
+		}
+		spin_unlock_irqrestore(&cache->lock, flags);
+		if (smid)
+			break;
+	}
+	return smid;
+}
+
+/**
+ * _base_smid_cache_put - free a scsiio smid to the local cpu's cache
+ * @ioc: per adapter object
+ * @smid: system request message index
+ */
+static void
+_base_smid_cache_put(struct MPT2SAS_ADAPTER *ioc, u16 smid)
+{
+	struct smid_cache *cache;
+	unsigned long flags;
+
+	cache = _base_smid_cache(ioc, raw_smp_processor_id());
+	spin_lock_irqsave(&cache->lock, flags);
+	if (cache->count == MPT2SAS_SMID_CACHE_SIZE)
+		_base_smid_cache_flush(ioc, cache);
+	cache->smid[cache->count++] = smid;
+	spin_unlock_irqrestore(&cache->lock, flags);
+}
+
+/**
+ * _base_smid_cache_reset - empty the per cpu smid caches
+ * @ioc: per adapter object
+ *
+ * Called before free_list is rebuilt from scratch after a reset.
+ */
+static void
+_base_smid_cache_reset(struct MPT2SAS_ADAPTER *ioc)
+{
+	struct smid_cache *cache;
+	unsigned long flags;
+	int cpu;
+
+	for (cpu = 0; cpu < ioc->cpu_count; cpu++) {
+		cache = &ioc->smid_cache[cpu];
+		spin_lock_irqsave(&cache->lock, flags);
+		cache->count = 0;
+		spin_unlock_irqrestore(&cache->lock, flags);
+	}
+}
+
 /**
  * mpt2sas_base_get_smid_scsiio - obtain a free smid from scsiio queue
  * @ioc: per adapter object
@@ -1826,23 +2173,32 @@ mpt2sas_base_get_smid_scsiio(struct MPT2SAS_ADAPTER *ioc, u8 cb_idx,
 {
 	unsigned long flags;
 	struct scsiio_tracker *request;
-	u16 smid;
-
-	spin_lock_irqsave(&ioc->scsi_lookup_lock, flags);
-	if (list_empty(&ioc->free_list)) {
-		spin_unlock_irqrestore(&ioc->scsi_lookup_lock, flags);
+	struct smid_cache *cache;
+	u16 smid = 0;
+	int cpu;
+
+	cpu = raw_smp_processor_id();
+	cache = _base_smid_cache(ioc, cpu);
+	spin_lock_irqsave(&cache->lock, flags);
+	if (!cache->count)
+		_base_smid_cache_refill(ioc, cache);
+	if (cache->count) {
+		smid = cache->smid[--cache->count];
+		cache->allocs++;
+	}
+	spin_unlock_irqrestore(&cache->lock, flags);
+
+	if (!smid)
+		smid = _base_smid_steal(ioc, cpu);
+	if (!smid) {
 		printk(MPT2SAS_ERR_FMT "%s: smid not available\n",
 		    ioc->name, __func__);
 		return 0;
 	}
 
-	request = list_entry(ioc->free_list.next,
-	    struct scsiio_tracker, tracker_list);
+	request = &ioc->scsi_lookup[smid - 1];
 	request->scmd = scmd;
 	request->cb_idx = cb_idx;
-	smid = request->smid;
-	list_del(&request->tracker_list);
-	spin_unlock_irqrestore(&ioc->scsi_lookup_lock, flags);
 	return smid;
 }
 
@@ -1889,24 +2245,23 @@ mpt2sas_base_free_smid(struct MPT2SAS_ADAPTER *ioc, u16 smid)
 	int i;
 	struct chain_tracker *chain_req, *next;
 
-	spin_lock_irqsave(&ioc->scsi_lookup_lock, flags);
 	if (smid < ioc->hi_priority_smid) {
 		/* scsiio queue */
 		i = smid - 1;
 		if (!list_empty(&ioc->scsi_lookup[i].chain_list)) {
+			spin_lock_irqsave(&ioc->scsi_lookup_lock, flags);
 			list_for_each_entry_safe(chain_req, next,
 			    &ioc->scsi_lookup[i].chain_list, tracker_list) {
 				list_del_init(&chain_req->tracker_list);
 				list_add(&chain_req->tracker_list,
 				    &ioc->free_chain_list);
 			}
+			spin_unlock_irqrestore(&ioc->scsi_lookup_lock, flags);
 		}
 		ioc->scsi_lookup[i].cb_idx = 0xFF;
 		ioc->scsi_lookup[i].scmd = NULL;
 		ioc->scsi_lookup[i].direct_io = 0;
-		list_add(&ioc->scsi_lookup[i].tracker_list,
-		    &ioc->free_list);
-		spin_unlock_irqrestore(&ioc->scsi_lookup_lock, flags);
+		_base_smid_cache_put(ioc, smid);
 
 		/*
 		 * See _wait_for_commands_to_complete() call with regards
@@ -1918,7 +2273,10 @@ mpt2sas_base_free_smid(struct MPT2SAS_ADAPTER *ioc, u16 smid)
 			ioc->pending_io_count--;
 		}
 		return;
-	} else if (smid < ioc->internal_smid) {
+	}
+
+	spin_lock_irqsave(&ioc->scsi_lookup_lock, flags);
+	if (smid < ioc->internal_smid) {
 		/* hi-priority */
 		i = smid - ioc->hi_priority_smid;
 		ioc->hpr_lookup[i].cb_idx = 0xFF;
@@ -4278,6 +4636,7 @@ _base_make_ioc_operational(struct MPT2SAS_ADAPTER *ioc, int sleep_flag)
 	}
 
 	/* initialize the scsi lookup free list */
+	_base_smid_cache_reset(ioc);
 	spin_lock_irqsave(&ioc->scsi_lookup_lock, flags);
 	INIT_LIST_HEAD(&ioc->free_list);
 	smid = 1;
@@ -4473,6 +4832,21 @@ mpt2sas_base_attach(struct MPT2SAS_ADAPTER *ioc)
 		goto out_free_resources;
 	}
 
+	ioc->smid_cache = kmalloc(ioc->cpu_count * sizeof(*ioc->smid_cache),
+	    GFP_KERNEL);
+	if (!ioc->smid_cache) {
+		dfailprintk(ioc, printk(MPT2SAS_INFO_FMT "allocation for "
+		    "smid_cache failed!!!\n", ioc->name));
+		r = -ENOMEM;
+		goto out_free_resources;
+	}
+	for (cpu_id = 0; cpu_id < ioc->cpu_count; cpu_id++) {
+		struct smid_cache *cache = &ioc->smid_cache[cpu_id];
+
+		memset(cache, 0, sizeof(*cache));
+		spin_lock_init(&cache->lock);
+	}
+
 	if (ioc->is_warpdrive) {
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,18))
 		ioc->reply_post_host_index = kcalloc(ioc->cpu_msix_table_sz,
@@ -4662,6 +5036,8 @@ mpt2sas_base_attach(struct MPT2SAS_ADAPTER *ioc)
 	_base_release_memory_pools(ioc);
 	pci_set_drvdata(ioc->pdev, NULL);
 	kfree(ioc->cpu_msix_table);
+	kfree(ioc->smid_cache);
+	ioc->smid_cache = NULL;
 	if (ioc->is_warpdrive)
 		kfree(ioc->reply_post_host_index);
 	kfree(ioc->pd_handles);
@@ -4705,6 +5081,8 @@ mpt2sas_base_detach(struct MPT2SAS_ADAPTER *ioc)
 	_base_release_memory_pools(ioc);
 	pci_set_drvdata(ioc->pdev, NULL);
 	kfree(ioc->cpu_msix_table);
+	kfree(ioc->smid_cache);
+	ioc->smid_cache = NULL;
 	if (ioc->is_warpdrive)
 		kfree(ioc->reply_post_host_index);
 	kfree(ioc->pd_handles);
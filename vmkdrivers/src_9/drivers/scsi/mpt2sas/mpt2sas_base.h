@@ -58,6 +58,8 @@
 #include "mpi/mpi2_tool.h"
 #include "mpi/mpi2_sas.h"
 
+#include <linux/interrupt.h>
+
 #include <scsi/scsi.h>
 #include <scsi/scsi_cmnd.h>
 #include <scsi/scsi_device.h>
@@ -641,6 +643,41 @@ struct scsiio_tracker {
 	struct list_head tracker_list;
 };
 
+/**
+ * struct smid_cache - per cpu cache of free scsiio smids
+ * @lock: protects this cache
+ * @count: number of smids in the cache
+ * @smid: cached smids, most recently freed last
+ * @allocs: smids handed out from this cache
+ * @refills: batches taken from ioc->free_list
+ * @flushes: batches returned to ioc->free_list
+ * @steals: smids other cpus took from this cache
+ * @lookup_lock_count: times this cpu took scsi_lookup_lock for smids
+ * @lookup_lock_cycles: total cycles scsi_lookup_lock was held
+ * @lookup_lock_max: longest hold, in cycles
+ *
+ * The scsiio smids cycle between ioc->free_list and these caches
+ * MPT2SAS_SMID_CACHE_BATCH at a time, so submission and completion
+ * normally only take the local cache lock.  vmklinux has no per cpu
+ * allocator, so ioc->smid_cache is a kmalloc'd array of ioc->cpu_count
+ * caches; see _base_smid_cache().
+ */
+#define MPT2SAS_SMID_CACHE_SIZE		32
+#define MPT2SAS_SMID_CACHE_BATCH	(MPT2SAS_SMID_CACHE_SIZE / 2)
+
+struct smid_cache {
+	spinlock_t	lock;
+	u16		count;
+	u16		smid[MPT2SAS_SMID_CACHE_SIZE];
+	unsigned long	allocs;
+	unsigned long	refills;
+	unsigned long	flushes;
+	unsigned long	steals;
+	unsigned long	lookup_lock_count;
+	u64		lookup_lock_cycles;
+	u64		lookup_lock_max;
+} ____cacheline_aligned_in_smp;
+
 /**
  * struct request_tracker - misc mf request tracker
  * @smid: system message id
@@ -667,6 +704,15 @@ struct _tr_list {
 
 typedef void (*MPT_ADD_SGE)(void *paddr, u32 flags_length, dma_addr_t dma_addr);
 
+/*
+ * Reply descriptors are consumed in batches of MPT2SAS_REPLY_BATCH: the
+ * host index is written back and the completed scsi commands are handed
+ * to the midlayer once per batch rather than once per descriptor.
+ */
+#define MPT2SAS_REPLY_BATCH		16
+#define MPT2SAS_REPLY_HIST_BUCKETS	10	/* 1, 2-3, ... 512+ replies */
+#define MPT2SAS_MAX_REPLY_QUEUES	64
+
 /**
  * struct adapter_reply_queue - the reply queue struct
  * @ioc: per adapter object
@@ -676,6 +722,12 @@ typedef void (*MPT_ADD_SGE)(void *paddr, u32 flags_length, dma_addr_t dma_addr);
  * @reply_post_free: reply post base virt address
  * @name: the name registered to request_irq()
  * @busy: isr is actively processing replies on another cpu
+ * @completions: reply descriptors processed on this queue
+ * @deferred: times the reply budget ran out and the tasklet took over
+ * @reply_hist: replies handled per invocation, log2 buckets
+ * @reply_tasklet: drains the queue once the isr budget is exhausted
+ * @done_count: number of entries in @done
+ * @done: scsi commands waiting to be handed back to the midlayer
  * @list: this list
 */
 struct adapter_reply_queue {
@@ -686,6 +738,12 @@ struct adapter_reply_queue {
 	Mpi2ReplyDescriptorsUnion_t *reply_post_free;
 	char			name[MPT_NAME_LENGTH];
 	atomic_t		busy;
+	unsigned long		completions;
+	unsigned long		deferred;
+	unsigned long		reply_hist[MPT2SAS_REPLY_HIST_BUCKETS];
+	struct tasklet_struct	reply_tasklet;
+	u16			done_count;
+	struct scsi_cmnd	*done[MPT2SAS_REPLY_BATCH];
 	struct list_head	list;
 };
 
@@ -837,6 +895,7 @@ struct mpt2sas_port_facts {
  * @scsi_lookup: firmware request tracker list
  * @scsi_lookup_lock:
  * @free_list: free list of request
+ * @smid_cache: per cpu caches in front of free_list
  * @pending_io_count:
  * @reset_wq:
  * @pending_tm_count: pending task mangement request
@@ -881,6 +940,7 @@ struct mpt2sas_port_facts {
  * @reply_post_free_dma:
  * @reply_queue_count: number of reply queue's
  * @reply_queue_list: link list contaning the reply queue info
+ * @reply_q_lookup: reply queues indexed by msix_index
  * @reply_post_host_index: head index in the pool where FW completes IO
  * @delayed_tr_list: target reset link list
  * @delayed_tr_volume_list: volume target reset link list
@@ -1053,6 +1113,7 @@ struct MPT2SAS_ADAPTER {
 	ulong		scsi_lookup_pages;
 	spinlock_t	scsi_lookup_lock;
 	struct list_head free_list;
+	struct smid_cache *smid_cache;
 	int		pending_io_count;
 	wait_queue_head_t reset_wq;
 	int		pending_tm_count;
@@ -1115,6 +1176,7 @@ struct MPT2SAS_ADAPTER {
 	struct dma_pool *reply_post_free_dma_pool;
 	u8		reply_queue_count;
 	struct list_head reply_queue_list;
+	struct adapter_reply_queue *reply_q_lookup[MPT2SAS_MAX_REPLY_QUEUES];
 
 	struct list_head delayed_tr_list;
 	struct list_head delayed_tr_volume_list;
@@ -1169,6 +1231,8 @@ void mpt2sas_base_build_zero_len_sge(struct MPT2SAS_ADAPTER *ioc, void *paddr);
 __le32 mpt2sas_base_get_sense_buffer_dma(struct MPT2SAS_ADAPTER *ioc,
     u16 smid);
 void mpt2sas_base_flush_reply_queues(struct MPT2SAS_ADAPTER *ioc);
+void mpt2sas_base_scsi_done(struct MPT2SAS_ADAPTER *ioc, u8 msix_index,
+    struct scsi_cmnd *scmd);
 
 /* hi-priority queue */
 u16 mpt2sas_base_get_smid_hpr(struct MPT2SAS_ADAPTER *ioc, u8 cb_idx);
@@ -3737,6 +3737,84 @@ static CLASS_DEVICE_ATTR(reply_queue_count, S_IRUGO,
 	_ctl_ioc_reply_queue_count_show, NULL);
 #endif
 
+/**
+ * _ctl_smid_stats_show - smid allocation and reply queue statistics
+ * @cdev - pointer to embedded class device
+ * @buf - the buffer returned
+ *
+ * Totals of the per cpu smid caches, how long scsi_lookup_lock was
+ * held on their behalf (in cycles), and per reply queue completions,
+ * tasklet deferrals and a replies-per-interrupt histogram (log2 buckets
+ * starting at 1).
+ *
+ * A sysfs 'read-only' shost attribute.
+ */
+#if (LINUX_VERSION_CODE > KERNEL_VERSION(2,6,25))
+static ssize_t
+_ctl_smid_stats_show(struct device *cdev,
+	struct device_attribute *attr, char *buf)
+#else
+static ssize_t
+_ctl_smid_stats_show(struct class_device *cdev, char *buf)
+#endif
+{
+	struct Scsi_Host *shost = class_to_shost(cdev);
+	struct MPT2SAS_ADAPTER *ioc = shost_private(shost);
+	struct adapter_reply_queue *reply_q;
+	struct smid_cache *cache;
+	unsigned long allocs = 0, refills = 0, flushes = 0, steals = 0;
+	unsigned long lock_count = 0;
+	u64 lock_cycles = 0, lock_max = 0;
+	u32 cached = 0;
+	ssize_t len;
+	int cpu, i;
+
+	if (!ioc->smid_cache)
+		return 0;
+
+	for (cpu = 0; cpu < ioc->cpu_count; cpu++) {
+		cache = &ioc->smid_cache[cpu];
+		cached += cache->count;
+		allocs += cache->allocs;
+		refills += cache->refills;
+		flushes += cache->flushes;
+		steals += cache->steals;
+		lock_count += cache->lookup_lock_count;
+		lock_cycles += cache->lookup_lock_cycles;
+		if (cache->lookup_lock_max > lock_max)
+			lock_max = cache->lookup_lock_max;
+	}
+
+	len = snprintf(buf, PAGE_SIZE, "cached %u allocs %lu refills %lu "
+	    "flushes %lu steals %lu\n", cached, allocs, refills, flushes,
+	    steals);
+	len += snprintf(buf + len, PAGE_SIZE - len, "lookup_lock holds %lu "
+	    "cycles %llu max %llu\n", lock_count,
+	    (unsigned long long)lock_cycles, (unsigned long long)lock_max);
+	list_for_each_entry(reply_q, &ioc->reply_queue_list, list) {
+		if (len >= PAGE_SIZE)
+			break;
+		len += snprintf(buf + len, PAGE_SIZE - len,
+		    "reply_queue%d completions %lu deferred %lu hist",
+		    reply_q->msix_index, reply_q->completions,
+		    reply_q->deferred);
+		for (i = 0; i < MPT2SAS_REPLY_HIST_BUCKETS && len < PAGE_SIZE;
+		    i++)
+			len += snprintf(buf + len, PAGE_SIZE - len, " %lu",
+			    reply_q->reply_hist[i]);
+		if (len < PAGE_SIZE)
+			len += snprintf(buf + len, PAGE_SIZE - len, "\n");
+	}
+	return min_t(ssize_t, len, PAGE_SIZE - 1);
+}
+#if (LINUX_VERSION_CODE > KERNEL_VERSION(2,6,25))
+static DEVICE_ATTR(smid_stats, S_IRUGO,
+	_ctl_smid_stats_show, NULL);
+#else
+static CLASS_DEVICE_ATTR(smid_stats, S_IRUGO,
+	_ctl_smid_stats_show, NULL);
+#endif
+
 struct DIAG_BUFFER_START {
 	__le32 Size;
 	__le32 DiagVersion;
@@ -4220,6 +4298,7 @@ struct device_attribute *mpt2sas_host_attrs[] = {
 	&dev_attr_host_trace_buffer,
 	&dev_attr_host_trace_buffer_enable,
 	&dev_attr_reply_queue_count,
+	&dev_attr_smid_stats,
 #ifdef MPT2SAS_WD_DDIOCOUNT
 	&dev_attr_ddio_count,
 	&dev_attr_ddio_err_count,
@@ -4249,6 +4328,7 @@ struct class_device_attribute *mpt2sas_host_attrs[] = {
 	&class_device_attr_host_trace_buffer,
 	&class_device_attr_host_trace_buffer_enable,
 	&class_device_attr_reply_queue_count,
+	&class_device_attr_smid_stats,
 #ifdef MPT2SAS_WD_DDIOCOUNT
 	&class_device_attr_ddio_count,
 	&class_device_attr_ddio_err_count,
@@ -1184,17 +1184,21 @@ _scsih_scsi_lookup_get(struct MPT2SAS_ADAPTER *ioc, u16 smid)
  *
  * Returns the smid stored scmd pointer.
  * Then will derefrence the stored scmd pointer.
+ *
+ * This is the completion path, so it does not take scsi_lookup_lock.
+ * The entry is cleared atomically; if a scan of scsi_lookup (which
+ * dereferences the stored pointers under scsi_lookup_lock) may have seen
+ * it, wait for that scan to drop the lock before the caller completes
+ * the command.
  */
 static inline struct scsi_cmnd *
 _scsih_scsi_lookup_get_clear(struct MPT2SAS_ADAPTER *ioc, u16 smid)
 {
-	unsigned long flags;
 	struct scsi_cmnd *scmd;
 
-	spin_lock_irqsave(&ioc->scsi_lookup_lock, flags);
-	scmd = ioc->scsi_lookup[smid - 1].scmd;
-	ioc->scsi_lookup[smid - 1].scmd = NULL;
-	spin_unlock_irqrestore(&ioc->scsi_lookup_lock, flags);
+	scmd = xchg(&ioc->scsi_lookup[smid - 1].scmd, NULL);
+	if (scmd && spin_is_locked(&ioc->scsi_lookup_lock))
+		spin_unlock_wait(&ioc->scsi_lookup_lock);
 
 	return scmd;
 }
@@ -6476,7 +6480,7 @@ _scsih_io_done(struct MPT2SAS_ADAPTER *ioc, u16 smid, u8 msix_index, u32 reply)
 	scsi_dma_unmap(scmd);
 #endif
 
-	scmd->scsi_done(scmd);
+	mpt2sas_base_scsi_done(ioc, msix_index, scmd);
 	return 1;
 }
 
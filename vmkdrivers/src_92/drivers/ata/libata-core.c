@@ -409,7 +409,11 @@ void ata_tf_to_fis(const struct ata_taskfile *tf, u8 pmp, int is_cmd, u8 *fis)
 	fis[14] = 0;
 	fis[15] = tf->ctl;
 
+#if defined(__VMKLNX__)
+	fis[16] = tf->auxiliary;
+#else
 	fis[16] = 0;
+#endif
 	fis[17] = 0;
 	fis[18] = 0;
 	fis[19] = 0;
@@ -2295,10 +2299,39 @@ static void ata_dev_config_ncq(struct ata_device *dev,
 		dev->flags |= ATA_DFLAG_NCQ;
 	}
 
+#if defined(__VMKLNX__)
+	/*
+	 * Queued TRIM (SEND FPDMA QUEUED / DSM) lets UNMAP run without
+	 * draining the NCQ queue.  Support is advertised in log page 13h.
+	 */
+	if ((dev->flags & ATA_DFLAG_NCQ) && ata_id_has_trim(dev->id) &&
+	    ata_id_has_ncq_send_and_recv(dev->id)) {
+		u8 *log = ap->sector_buf;
+
+		if (ata_read_log_page(dev, ATA_LOG_NCQ_SEND_RECV, log, 1))
+			ata_dev_printk(dev, KERN_WARNING,
+				       "failed to read NCQ Send/Recv log\n");
+		else if ((log[ATA_LOG_NCQ_SEND_RECV_SUBCMDS_OFFSET] &
+			  ATA_LOG_NCQ_SEND_RECV_SUBCMDS_DSM) &&
+			 (log[ATA_LOG_NCQ_SEND_RECV_DSM_OFFSET] &
+			  ATA_LOG_NCQ_SEND_RECV_DSM_TRIM)) {
+			if (dev->horkage & ATA_HORKAGE_NO_NCQ_TRIM)
+				ata_dev_printk(dev, KERN_INFO,
+					       "queued TRIM blacklisted\n");
+			else
+				dev->flags |= ATA_DFLAG_NCQ_TRIM;
+		}
+	}
+#endif /* defined(__VMKLNX__) */
+
 	if (hdepth >= ddepth)
 		snprintf(desc, desc_sz, "NCQ (depth %d)", ddepth);
 	else
 		snprintf(desc, desc_sz, "NCQ (depth %d/%d)", hdepth, ddepth);
+#if defined(__VMKLNX__)
+	if (dev->flags & ATA_DFLAG_NCQ_TRIM)
+		strlcat(desc, ", queued TRIM", desc_sz);
+#endif
 }
 
 /**
@@ -2408,7 +2441,7 @@ int ata_dev_configure(struct ata_device *dev)
 
 		if (ata_id_has_lba(id)) {
 			const char *lba_desc;
-			char ncq_desc[20];
+			char ncq_desc[32];
 
 			lba_desc = "LBA";
 			dev->flags |= ATA_DFLAG_LBA;
@@ -4527,6 +4560,14 @@ static const struct ata_blacklist_entry ata_device_blacklist [] = {
 	{ "TSSTcorp CDDVDW SH-S202N", "SB00",	  ATA_HORKAGE_IVB, },
 	{ "TSSTcorp CDDVDW SH-S202N", "SB01",	  ATA_HORKAGE_IVB, },
 
+#if defined(__VMKLNX__)
+	/* Devices that corrupt data or hang on queued TRIM */
+	{ "Micron_M500*",	NULL,		ATA_HORKAGE_NO_NCQ_TRIM, },
+	{ "Micron_M550*",	NULL,		ATA_HORKAGE_NO_NCQ_TRIM, },
+	{ "Crucial_CT*",	NULL,		ATA_HORKAGE_NO_NCQ_TRIM, },
+	{ "Samsung SSD 8*",	NULL,		ATA_HORKAGE_NO_NCQ_TRIM, },
+#endif /* defined(__VMKLNX__) */
+
 	/* End Marker */
 	{ }
 };
@@ -5887,6 +5928,10 @@ fsm_start:
  *	@ap: Port associated with device @dev
  *	@dev: Device from whom we request an available command structure
  *
+ *	Tags are handed out round-robin starting after ap->last_tag, so
+ *	the device sees every tag in turn instead of the low tags being
+ *	reused constantly, which some SSD firmwares serialize on.
+ *
  *	LOCKING:
  *	None.
  */
@@ -5895,17 +5940,48 @@ static struct ata_queued_cmd *ata_qc_new(struct ata_port *ap)
 {
 	struct ata_queued_cmd *qc = NULL;
 	unsigned int i;
+#if defined(__VMKLNX__)
+	unsigned long free, above;
+	unsigned int max_queue;
+#endif
 
 	/* no command while frozen */
 	if (unlikely(ap->pflags & ATA_PFLAG_FROZEN))
 		return NULL;
 
+#if defined(__VMKLNX__)
+	/*
+	 * Pick the first free tag above the hint, wrapping around to
+	 * the lowest free one.  Stay below the host's can_queue so that
+	 * controllers with fewer command slots never see a higher tag;
+	 * the last tag is reserved for internal command either way.
+	 * Retry if another CPU claims the tag first.
+	 */
+	max_queue = ATA_MAX_QUEUE - 1;
+	if (ap->scsi_host && ap->scsi_host->can_queue < max_queue)
+		max_queue = ap->scsi_host->can_queue;
+
+	for (;;) {
+		free = ~ap->qc_allocated & ((1UL << max_queue) - 1);
+		if (!free)
+			return NULL;
+
+		above = free & ~((2UL << ap->last_tag) - 1);
+		i = __ffs(above ? above : free);
+		if (!test_and_set_bit(i, &ap->qc_allocated))
+			break;
+	}
+
+	ap->last_tag = i;
+	qc = __ata_qc_from_tag(ap, i);
+#else
 	/* the last tag is reserved for internal command. */
 	for (i = 0; i < ATA_MAX_QUEUE - 1; i++)
 		if (!test_and_set_bit(i, &ap->qc_allocated)) {
 			qc = __ata_qc_from_tag(ap, i);
 			break;
 		}
+#endif /* defined(__VMKLNX__) */
 
 	if (qc)
 		qc->tag = i;
@@ -6148,6 +6224,10 @@ int ata_qc_complete_multiple(struct ata_port *ap, u32 qc_active,
 	int nr_done = 0;
 	u32 done_mask;
 	int i;
+#if defined(__VMKLNX__)
+	struct ata_done_batch batch;
+	int own_batch;
+#endif
 
 	done_mask = ap->qc_active ^ qc_active;
 
@@ -6157,6 +6237,13 @@ int ata_qc_complete_multiple(struct ata_port *ap, u32 qc_active,
 		return -EINVAL;
 	}
 
+#if defined(__VMKLNX__)
+	/* unless the LLD already opened a batch, hand this pass over as one */
+	own_batch = (ap->done_batch == NULL);
+	if (own_batch)
+		ata_port_done_batch_begin(ap, &batch);
+#endif
+
 	for (i = 0; i < ATA_MAX_QUEUE; i++) {
 		struct ata_queued_cmd *qc;
 
@@ -6171,9 +6258,74 @@ int ata_qc_complete_multiple(struct ata_port *ap, u32 qc_active,
 		}
 	}
 
+#if defined(__VMKLNX__)
+	if (own_batch) {
+		ata_port_done_batch_end(ap);
+		ata_done_batch_complete(&batch);
+	}
+#endif
+
 	return nr_done;
 }
 
+#if defined(__VMKLNX__)
+/**
+ *	ata_port_done_batch_begin - start collecting SCSI completions
+ *	@ap: port in question
+ *	@batch: caller-owned batch to collect into
+ *
+ *	Until ata_port_done_batch_end() is called, SCSI commands whose
+ *	qcs complete on @ap are parked in @batch instead of being handed
+ *	to the midlayer one at a time.  An LLD can wrap its per-port
+ *	interrupt handling with this pair and call
+ *	ata_done_batch_complete() once the host lock is dropped.
+ *
+ *	LOCKING:
+ *	spin_lock_irqsave(host lock)
+ */
+void ata_port_done_batch_begin(struct ata_port *ap,
+			       struct ata_done_batch *batch)
+{
+	batch->nr = 0;
+	ap->done_batch = batch;
+}
+
+/**
+ *	ata_port_done_batch_end - stop collecting SCSI completions
+ *	@ap: port in question
+ *
+ *	LOCKING:
+ *	spin_lock_irqsave(host lock)
+ */
+void ata_port_done_batch_end(struct ata_port *ap)
+{
+	struct ata_done_batch *batch = ap->done_batch;
+
+	ap->done_batch = NULL;
+	if (batch && batch->nr)
+		ap->batch_size[batch->nr - 1]++;
+}
+
+/**
+ *	ata_done_batch_complete - hand a batch of completions to SCSI
+ *	@batch: batch filled between ata_port_done_batch_begin/end
+ *
+ *	The qcs behind @batch have already been freed, so this may be
+ *	called with or without the host lock held.
+ *
+ *	LOCKING:
+ *	None.
+ */
+void ata_done_batch_complete(struct ata_done_batch *batch)
+{
+	unsigned int i;
+
+	for (i = 0; i < batch->nr; i++)
+		batch->done[i](batch->cmd[i]);
+	batch->nr = 0;
+}
+#endif /* defined(__VMKLNX__) */
+
 /**
  *	ata_qc_issue - issue taskfile to device
  *	@qc: command to issue to device
@@ -6213,6 +6365,10 @@ void ata_qc_issue(struct ata_queued_cmd *qc)
 
 	qc->flags |= ATA_QCFLAG_ACTIVE;
 	ap->qc_active |= 1 << qc->tag;
+#if defined(__VMKLNX__)
+	if (ata_is_ncq(prot))
+		ap->ncq_depth[hweight32(ap->qc_active) - 1]++;
+#endif
 
 	/* We guarantee to LLDs that they will have at least one
 	 * non-zero sg if the command is a data command.
@@ -8051,6 +8207,9 @@ EXPORT_SYMBOL_GPL(ata_sg_init_one);
 EXPORT_SYMBOL_GPL(ata_hsm_move);
 EXPORT_SYMBOL_GPL(ata_qc_complete);
 EXPORT_SYMBOL_GPL(ata_qc_complete_multiple);
+EXPORT_SYMBOL_GPL(ata_port_done_batch_begin);
+EXPORT_SYMBOL_GPL(ata_port_done_batch_end);
+EXPORT_SYMBOL_GPL(ata_done_batch_complete);
 EXPORT_SYMBOL_GPL(ata_qc_issue_prot);
 EXPORT_SYMBOL_GPL(ata_noop_dev_select);
 EXPORT_SYMBOL_GPL(ata_std_dev_select);
@@ -1186,8 +1186,13 @@ static const char *ata_err_string(unsigned int err_mask)
  *	RETURNS:
  *	0 on success, AC_ERR_* mask otherwise.
  */
+#if defined(__VMKLNX__)
+unsigned int ata_read_log_page(struct ata_device *dev,
+			       u8 page, void *buf, unsigned int sectors)
+#else
 static unsigned int ata_read_log_page(struct ata_device *dev,
 				      u8 page, void *buf, unsigned int sectors)
+#endif
 {
 	struct ata_taskfile tf;
 	unsigned int err_mask;
@@ -53,6 +53,7 @@
 #endif /* !defined(__VMKLNX__) */
 
 #if defined(__VMKLNX__)
+#include <linux/sort.h>
 #include <vmklinux_92/vmklinux_scsi.h>
 #endif /* defined(__VMKLNX__) */
 
@@ -222,6 +223,83 @@ CLASS_DEVICE_ATTR(link_power_management_policy, S_IRUGO | S_IWUSR,
 		ata_scsi_lpm_show, ata_scsi_lpm_put);
 EXPORT_SYMBOL_GPL(class_device_attr_link_power_management_policy);
 
+#if defined(__VMKLNX__)
+/**
+ *	ata_scsi_proc_info - /proc/scsi read handler for libata ports
+ *	@shost: SCSI host of the port
+ *	@buffer: output buffer
+ *	@start: where the requested data starts in @buffer
+ *	@offset: offset into the imaginary file
+ *	@length: size of @buffer
+ *	@func: 0 for read, 1 for write
+ *
+ *	Dumps the port's NCQ depth and completion batch histograms
+ *	along with the per-device UNMAP counters, for queue tuning.
+ *	Only buckets that were hit are listed.
+ *
+ *	RETURNS:
+ *	Number of bytes available from @offset, -EINVAL on write.
+ */
+int ata_scsi_proc_info(struct Scsi_Host *shost, char *buffer, char **start,
+		       off_t offset, int length, int func)
+{
+	struct ata_port *ap = ata_shost_to_port(shost);
+	struct ata_link *link;
+	struct ata_device *dev;
+	struct ata_unmap_stats *us;
+	int len = 0, datalen, i;
+
+	if (func)
+		return -EINVAL;
+
+	len += scnprintf(buffer + len, length - len,
+			"ata%u: qc_active 0x%08x last_tag %u\n",
+			ap->print_id, ap->qc_active, ap->last_tag);
+
+	len += scnprintf(buffer + len, length - len, "NCQ depth at issue:\n");
+	for (i = 0; i < ATA_MAX_QUEUE; i++)
+		if (ap->ncq_depth[i])
+			len += scnprintf(buffer + len, length - len,
+					"  %2d: %llu\n", i + 1,
+					(unsigned long long)ap->ncq_depth[i]);
+
+	len += scnprintf(buffer + len, length - len,
+			"Completions per batch:\n");
+	for (i = 0; i < ATA_MAX_QUEUE; i++)
+		if (ap->batch_size[i])
+			len += scnprintf(buffer + len, length - len,
+					"  %2d: %llu\n", i + 1,
+					(unsigned long long)ap->batch_size[i]);
+
+	ata_port_for_each_link(link, ap) {
+		ata_link_for_each_dev(dev, link) {
+			if (!ata_dev_enabled(dev))
+				continue;
+			us = ata_dev_unmap_stats(dev);
+			len += scnprintf(buffer + len, length - len,
+				"dev %u.%u: unmap %llu descs %llu trim %llu "
+				"queued %llu ranges %llu\n",
+				link->pmp, dev->devno,
+				(unsigned long long)us->unmap_cmds,
+				(unsigned long long)us->unmap_descs,
+				(unsigned long long)us->trim_cmds,
+				(unsigned long long)us->trim_queued,
+				(unsigned long long)us->trim_ranges);
+		}
+	}
+
+	datalen = len - offset;
+	if (datalen < 0) {	/* read past EOF */
+		datalen = 0;
+		*start = buffer + len;
+	} else
+		*start = buffer + offset;
+
+	return datalen;
+}
+EXPORT_SYMBOL_GPL(ata_scsi_proc_info);
+#endif /* defined(__VMKLNX__) */
+
 static void ata_scsi_invalid_field(struct scsi_cmnd *cmd,
 				   void (*done)(struct scsi_cmnd *))
 {
@@ -1740,6 +1818,33 @@ nothing_to_do:
 	return 1;
 }
 
+#if defined(__VMKLNX__)
+/**
+ *	ata_scsi_qc_done - hand a completed command back to SCSI
+ *	@qc: command whose translation finished
+ *	@cmd: SCSI command to complete
+ *
+ *	Parks @cmd in the port's open completion batch, if any, so that
+ *	all commands finished in one interrupt reach the midlayer
+ *	together; see ata_port_done_batch_begin().
+ *
+ *	LOCKING:
+ *	spin_lock_irqsave(host lock)
+ */
+static inline void ata_scsi_qc_done(struct ata_queued_cmd *qc,
+				    struct scsi_cmnd *cmd)
+{
+	struct ata_done_batch *batch = qc->ap->done_batch;
+
+	if (batch && batch->nr < ATA_MAX_QUEUE) {
+		batch->cmd[batch->nr] = cmd;
+		batch->done[batch->nr] = qc->scsidone;
+		batch->nr++;
+	} else
+		qc->scsidone(cmd);
+}
+#endif /* defined(__VMKLNX__) */
+
 static void ata_scsi_qc_complete(struct ata_queued_cmd *qc)
 {
 	struct ata_port *ap = qc->ap;
@@ -1799,9 +1904,11 @@ static void ata_scsi_qc_complete(struct ata_queued_cmd *qc)
 	if (cdb[0] == UNMAP && cmd->SCp.ptr) {
 		kfree(cmd->SCp.ptr);
 	}
-#endif /* defined(__VMKLNX__) */
 
+	ata_scsi_qc_done(qc, cmd);
+#else
 	qc->scsidone(cmd);
+#endif /* defined(__VMKLNX__) */
 
 	ata_qc_free(qc);
 }
@@ -3755,47 +3862,103 @@ typedef struct unmap_blk_desc {
 	u32 reserved;
 } __attribute__ ((packed)) unmap_blk_desc_t;
 
+/* One UNMAP extent, [lba, lba + len) in device sectors */
+struct ata_unmap_extent {
+	u64 lba;
+	u64 len;
+};
+
+static int ata_unmap_extent_cmp(const void *a, const void *b)
+{
+	const struct ata_unmap_extent *x = a, *y = b;
+
+	if (x->lba < y->lba)
+		return -1;
+	return x->lba > y->lba;
+}
+
+/**
+ *	ata_unmap_coalesce - sort and merge UNMAP extents
+ *	@ext: extents decoded from the UNMAP block descriptors
+ *	@n: number of entries in @ext
+ *
+ *	Sorts @ext by starting LBA and merges overlapping or adjacent
+ *	extents in place, so the TRIM payload carries the fewest LBA
+ *	range entries and never trims the same sector twice.
+ *
+ *	LOCKING:
+ *	spin_lock_irqsave(host lock)
+ *
+ *	RETURNS:
+ *	Number of extents left in @ext.
+ */
+static u32 ata_unmap_coalesce(struct ata_unmap_extent *ext, u32 n)
+{
+	u32 i, out = 0;
+
+	if (n == 0)
+		return 0;
+
+	sort(ext, n, sizeof(*ext), ata_unmap_extent_cmp, NULL);
+
+	for (i = 1; i < n; i++) {
+		struct ata_unmap_extent *cur = &ext[out];
+		u64 cur_end = cur->lba + cur->len;
+
+		if (ext[i].lba <= cur_end) {
+			if (ext[i].lba + ext[i].len > cur_end)
+				cur->len = ext[i].lba + ext[i].len - cur->lba;
+		} else
+			ext[++out] = ext[i];
+	}
+
+	return out + 1;
+}
+
+/**
+ *	ata_scsi_unmap_xlat - Translate SCSI UNMAP command into TRIM
+ *	@qc: Storage for translated ATA taskfile
+ *
+ *	Decodes the UNMAP block descriptors, coalesces them with
+ *	ata_unmap_coalesce() and packs the result into a DATA SET
+ *	MANAGEMENT payload.  Devices that advertise queued TRIM get a
+ *	SEND FPDMA QUEUED command so the UNMAP does not drain the NCQ
+ *	queue; everything else gets the non-queued DSM command.
+ *
+ *	LOCKING:
+ *	spin_lock_irqsave(host lock)
+ *
+ *	RETURNS:
+ *	Zero on success, non-zero on error.
+ */
 static unsigned int ata_scsi_unmap_xlat(struct ata_queued_cmd *qc)
 {
 	struct ata_taskfile *tf = &qc->tf;
 	struct scsi_cmnd *scmd = qc->scsicmd;
 	struct ata_device *dev = qc->dev;
+	struct ata_unmap_stats *us = ata_dev_unmap_stats(dev);
 	const u8 *cdb = scmd->cmnd;
+	struct scatterlist *sg = scsi_sglist(scmd);
 	unmap_param_hdr_t *param_hdr;
 	unmap_blk_desc_t *blk_desc;
+	struct ata_unmap_extent *ext;
 	void *param_list;
 	u32 param_len;
-	u32 blk_desc_len, blk_desc_num, i;
-	u32 num_blk;
+	u32 blk_desc_len, blk_desc_num, ext_num, i;
 	u32 lre_num;
 	unsigned count = 0;
-	void *buf_start;
-	unsigned buf_size;
 	u32 size = 0;
-	u64 lba = 0;
-	u32 len = 0;
-
-#if !defined(__VMKLNX__)
-	ata_dev_printk(dev, KERN_WARNING, "%s: translate UNMAP to TRIM\n",
-		       __FUNCTION__);
-#endif
+	u8 sense_asc = 0x24;	/* "Invalid field in cdb" */
 
 	/* Parameter List Length field */
 	param_len = (cdb[7] << 8) | cdb[8];
-#if !defined(__VMKLNX__)
-	ata_dev_printk(dev, KERN_DEBUG, "%s: Parameter List Length %d\n",
-			__FUNCTION__, param_len);
-#endif
 	if (param_len == 0) {
 		ata_dev_printk(dev, KERN_WARNING, "%s: param_len is zero\n",
 			__FUNCTION__);
 		goto invalid_fld;
-	}	
+	}
 
-	/*
-	 * Calculate the memory size we need for TRIM
-	 */
-	param_list = page_address(sg_page(scsi_sglist(scmd)));
+	param_list = page_address(sg_page(sg)) + vmklnx_sg_offset(sg);
 	param_hdr = (unmap_param_hdr_t *) param_list;
 	blk_desc_len = be16_to_cpu(param_hdr->blk_desc_len);
 	if (blk_desc_len == 0) {
@@ -3803,34 +3966,71 @@ static unsigned int ata_scsi_unmap_xlat(struct ata_queued_cmd *qc)
 			__FUNCTION__);
 		goto invalid_fld;
 	}
+
 	/*
-	 * Number of block descriptor should be a multiple of
-	 * sizeof (unmap_blk_desc_t)
+	 * The block descriptors must be whole and must lie within both
+	 * the parameter list and the (single) data buffer.
 	 */
-	VMK_ASSERT(blk_desc_len % sizeof (unmap_blk_desc_t) == 0);
-	blk_desc_num = blk_desc_len / sizeof (unmap_blk_desc_t);
+	if (blk_desc_len % sizeof(unmap_blk_desc_t) ||
+	    blk_desc_len + sizeof(unmap_param_hdr_t) > param_len ||
+	    blk_desc_len + sizeof(unmap_param_hdr_t) > sg_dma_len(sg) ||
+	    blk_desc_len + sizeof(unmap_param_hdr_t) > scsi_bufflen(scmd)) {
+		ata_dev_printk(dev, KERN_WARNING, "%s: bad blk_desc_len %u "
+			       "(param_len %u)\n", __FUNCTION__,
+			       blk_desc_len, param_len);
+		sense_asc = 0x26;	/* "Invalid field in parameter list" */
+		goto invalid_fld;
+	}
+	blk_desc_num = blk_desc_len / sizeof(unmap_blk_desc_t);
 	blk_desc = (unmap_blk_desc_t *) ((char *)param_list +
 		   sizeof(unmap_param_hdr_t));
 
-	/*
-	 * The number of logical blocks in UNMAP block descriptor
-	 * occupies 4 bytes, whereas TRIM LBA Range Entry only
-	 * uses 2 bytes to represent Range Length. Thus need to
-	 * calculate the number of LBA Range Entries.
-	 */
-	lre_num = 0;
+	ext = kmalloc(blk_desc_num * sizeof(*ext), GFP_ATOMIC);
+	if (ext == NULL) {
+		ata_dev_printk(dev, KERN_WARNING, "Failed to allocate "
+			       "UNMAP extent array\n");
+		return -1;
+	}
+
+	/* Decode the descriptors, dropping empty ones */
+	ext_num = 0;
 	for (i = 0; i < blk_desc_num; i++) {
-		unmap_blk_desc_t *blk_desc_idx;
-		blk_desc_idx = &blk_desc[i];
-		num_blk = be32_to_cpu((u32)(blk_desc_idx->num_blk));
+		u64 lba = be64_to_cpu(blk_desc[i].lba);
+		u32 num_blk = be32_to_cpu(blk_desc[i].num_blk);
+
+		if (num_blk == 0)
+			continue;
 
-		lre_num += num_blk / 0xffff;
-		if (num_blk % 0xffff) {
-			lre_num++;
+		if (lba >= dev->n_sectors ||
+		    num_blk > dev->n_sectors - lba) {
+			kfree(ext);
+			ata_scsi_set_sense(scmd, ILLEGAL_REQUEST, 0x21, 0x00);
+			/* "Logical block address out of range" */
+			return 1;
 		}
+
+		ext[ext_num].lba = lba;
+		ext[ext_num].len = num_blk;
+		ext_num++;
 	}
 
+	ext_num = ata_unmap_coalesce(ext, ext_num);
+
+	/*
+	 * TRIM LBA Range Entries only carry a 16-bit range length, so
+	 * each extent may need several of them.
+	 */
+	lre_num = 0;
+	for (i = 0; i < ext_num; i++)
+		lre_num += DIV_ROUND_UP(ext[i].len, 0xffff);
+
+	/*
+	 * An UNMAP whose descriptors are all empty still goes down as a
+	 * single all-zero payload sector, which the device ignores.
+	 */
 	size = roundup(lre_num * 8, 512);
+	if (size == 0)
+		size = 512;
 
 	/*
 	 * Initialize a local SG elmenent to hold the TRIM
@@ -3847,57 +4047,57 @@ static unsigned int ata_scsi_unmap_xlat(struct ata_queued_cmd *qc)
 	if (scmd->SCp.ptr == NULL) {
 		ata_dev_printk(dev, KERN_WARNING, "Failed to allocate "
 			       "TRIM command buffer\n");
-#if !defined(__VMKLNX__)
-		qc->scsidone(qc->scsicmd);
-		ata_qc_free(qc);
-#endif 
+		kfree(ext);
 		return -1;
 	}
 	sg_init_one(&qc->sgent, scmd->SCp.ptr, size);
 	ata_sg_init(qc, &qc->sgent, 1);
 
 	/*
-	 * Convert the to-be-unmapped LBA range into TRIM command
-	 * data format.
+	 * Convert the coalesced extents into TRIM command data format.
 	 */
-	for (i = 0; i < blk_desc_num; i++) {
-                unmap_blk_desc_t *blk_desc_idx;
-                blk_desc_idx = &blk_desc[i];
-                num_blk = be32_to_cpu((u32)(blk_desc_idx->num_blk));
-
-		lba = be64_to_cpu((u64)(blk_desc_idx->lba));
-		len = be32_to_cpu((u32)(blk_desc_idx->num_blk));
-
-#if !defined(__VMKLNX__)
-		ata_dev_printk(dev, KERN_WARNING, "%s: lba(0x%llx),len(0x%x)\n",
-				__FUNCTION__, lba, len);
-#endif
-
-		buf_start = (void *)scmd->SCp.ptr + count * 8;
-		buf_size = size - count * 8;
-		count += ata_set_lba_range_entries(buf_start, buf_size, lba, len);
-	}
+	for (i = 0; i < ext_num; i++)
+		count += ata_set_lba_range_entries(
+				(void *)scmd->SCp.ptr + count * 8,
+				size - count * 8, ext[i].lba, ext[i].len);
 
 	VMK_ASSERT(lre_num == count);
 	memset((void *)scmd->SCp.ptr + count * 8, 0, size - count * 8);
+	kfree(ext);
 
 	/* Build the ATA taskfile */
-	tf->protocol = ATA_PROT_DMA;
-	tf->command = ATA_CMD_DSM;
-	tf->feature = ATA_DSM_TRIM;
-	tf->hob_feature = 0;
-	tf->nsect = size / 512;
-	tf->hob_nsect = (size / 512) >> 8;
+	if (ata_ncq_enabled(dev) && (dev->flags & ATA_DFLAG_NCQ_TRIM) &&
+	    likely(qc->tag != ATA_TAG_INTERNAL)) {
+		tf->protocol = ATA_PROT_NCQ;
+		tf->command = ATA_CMD_FPDMA_SEND;
+		tf->hob_nsect = ATA_SUBCMD_FPDMA_SEND_DSM & 0x1f;
+		tf->nsect = qc->tag << 3;
+		tf->feature = size / 512;
+		tf->hob_feature = (size / 512) >> 8;
+		tf->auxiliary = 1;	/* DSM TRIM */
+		us->trim_queued++;
+	} else {
+		tf->protocol = ATA_PROT_DMA;
+		tf->command = ATA_CMD_DSM;
+		tf->feature = ATA_DSM_TRIM;
+		tf->hob_feature = 0;
+		tf->nsect = size / 512;
+		tf->hob_nsect = (size / 512) >> 8;
+	}
 	tf->flags |= ATA_TFLAG_ISADDR | ATA_TFLAG_DEVICE |
 		     ATA_TFLAG_LBA48 | ATA_TFLAG_WRITE;
 
 	qc->nbytes = size;
 
+	us->unmap_cmds++;
+	us->unmap_descs += blk_desc_num;
+	us->trim_ranges += count;
+	us->trim_cmds++;
+
 	return 0;
 
 invalid_fld:
-	ata_scsi_set_sense(scmd, ILLEGAL_REQUEST, 0x24, 0x00);
-	/* "Invalid field in cdb" */
+	ata_scsi_set_sense(scmd, ILLEGAL_REQUEST, sense_asc, 0x00);
 	return 1;
 }
 #endif /* defined(__VMKLNX__) */
@@ -236,6 +236,10 @@ extern enum scsi_eh_timer_return ata_scsi_timed_out(struct scsi_cmnd *cmd);
 extern void ata_scsi_error(struct Scsi_Host *host);
 extern void ata_port_wait_eh(struct ata_port *ap);
 extern void ata_eh_fastdrain_timerfn(unsigned long arg);
+#if defined(__VMKLNX__)
+extern unsigned int ata_read_log_page(struct ata_device *dev, u8 page,
+				      void *buf, unsigned int sectors);
+#endif
 extern void ata_qc_schedule_eh(struct ata_queued_cmd *qc);
 extern void ata_eh_detach_dev(struct ata_device *dev);
 extern void ata_eh_about_to_do(struct ata_link *link, struct ata_device *dev,
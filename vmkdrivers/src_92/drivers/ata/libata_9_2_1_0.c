@@ -81,6 +81,7 @@ VMK_MODULE_EXPORT_ALIAS(ata_dev_classify);
 VMK_MODULE_EXPORT_ALIAS(ata_dev_pair);
 VMK_MODULE_EXPORT_ALIAS(ata_do_eh);
 VMK_MODULE_EXPORT_ALIAS(ata_do_set_mode);
+VMK_MODULE_EXPORT_ALIAS(ata_done_batch_complete);
 VMK_MODULE_EXPORT_ALIAS(ata_dumb_qc_prep);
 VMK_MODULE_EXPORT_ALIAS(ata_dummy_port_info);
 VMK_MODULE_EXPORT_ALIAS(ata_dummy_port_ops);
@@ -116,6 +117,8 @@ VMK_MODULE_EXPORT_ALIAS(ata_pci_remove_one);
 VMK_MODULE_EXPORT_ALIAS(ata_pio_need_iordy);
 VMK_MODULE_EXPORT_ALIAS(ata_port_abort);
 VMK_MODULE_EXPORT_ALIAS(ata_port_disable);
+VMK_MODULE_EXPORT_ALIAS(ata_port_done_batch_begin);
+VMK_MODULE_EXPORT_ALIAS(ata_port_done_batch_end);
 VMK_MODULE_EXPORT_ALIAS(ata_port_freeze);
 VMK_MODULE_EXPORT_ALIAS(ata_port_pbar_desc);
 VMK_MODULE_EXPORT_ALIAS(ata_port_probe);
@@ -134,6 +137,7 @@ VMK_MODULE_EXPORT_ALIAS(ata_sas_queuecmd);
 VMK_MODULE_EXPORT_ALIAS(ata_sas_slave_configure);
 VMK_MODULE_EXPORT_ALIAS(ata_scsi_change_queue_depth);
 VMK_MODULE_EXPORT_ALIAS(ata_scsi_ioctl);
+VMK_MODULE_EXPORT_ALIAS(ata_scsi_proc_info);
 VMK_MODULE_EXPORT_ALIAS(ata_scsi_queuecmd);
 VMK_MODULE_EXPORT_ALIAS(ata_scsi_slave_config);
 VMK_MODULE_EXPORT_ALIAS(ata_scsi_slave_destroy);
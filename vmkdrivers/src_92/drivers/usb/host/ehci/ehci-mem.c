@@ -262,6 +262,9 @@ static void ehci_mem_cleanup (struct ehci_hcd *ehci)
 	/* shadow periodic table */
 	kfree(ehci->pshadow);
 	ehci->pshadow = NULL;
+
+	kfree(ehci->bandwidth);
+	ehci->bandwidth = NULL;
 }
 
 /* remember to add cleanup code (above) if you add anything here */
@@ -343,7 +346,13 @@ static int ehci_mem_init (struct ehci_hcd *ehci, gfp_t flags)
 
 	/* software shadow of hardware table */
 	ehci->pshadow = kcalloc(ehci->periodic_size, sizeof(void *), flags);
-	if (ehci->pshadow != NULL)
+	if (ehci->pshadow == NULL)
+		goto fail;
+
+	/* periodic bandwidth claimed in each uframe, see ehci-sched.c */
+	ehci->bandwidth = kcalloc(ehci->periodic_size * 8,
+			sizeof(*ehci->bandwidth), flags);
+	if (ehci->bandwidth != NULL)
 		return 0;
 
 fail:
@@ -107,9 +107,74 @@ static void periodic_unlink (struct ehci_hcd *ehci, unsigned frame, void *ptr)
 		*hw_p = ehci->dummy->qh_dma;
 }
 
-/* how many of the uframe's 125 usecs are allocated? */
+/*
+ * ehci->bandwidth[] holds the periodic usecs claimed in each uframe of the
+ * schedule.  It is updated as QHs, iTDs and siTDs are linked and unlinked,
+ * charging them exactly as a walk of the frame's list would, so admission
+ * checks are table lookups rather than list walks.
+ */
+static void
+qh_bandwidth (struct ehci_hcd *ehci, unsigned frame, struct ehci_qh *qh,
+		int sign)
+{
+	unsigned short	*bw = &ehci->bandwidth [frame << 3];
+	u32		info2 = hc32_to_cpup(ehci, &qh->hw->hw_info2);
+	unsigned	uf;
+
+	for (uf = 0; uf < 8; uf++) {
+		/* S-mask, then C-mask */
+		if (info2 & (1 << uf))
+			bw [uf] += sign * qh->usecs;
+		if (info2 & (1 << (8 + uf)))
+			bw [uf] += sign * qh->c_usecs;
+	}
+}
+
+/*
+ * An iTD is charged for the uframes itd_patch() filled in.  Its
+ * hw_transaction[] words can't say which those were:  the HC writes them
+ * back, and itd_complete() clears them.  itd->index[] is stable from
+ * itd_patch() until the iTD is reinitialized, so link and unlink agree.
+ */
+static void
+itd_bandwidth (struct ehci_hcd *ehci, unsigned frame, struct ehci_itd *itd,
+		int sign)
+{
+	unsigned short	*bw = &ehci->bandwidth [frame << 3];
+	unsigned	uf;
+
+	for (uf = 0; uf < 8; uf++) {
+		if (itd->index [uf] != -1)
+			bw [uf] += sign * itd->stream->usecs;
+	}
+}
+
+static void
+sitd_bandwidth (struct ehci_hcd *ehci, unsigned frame,
+		struct ehci_sitd *sitd, int sign)
+{
+	unsigned short	*bw = &ehci->bandwidth [frame << 3];
+	u32		mask = hc32_to_cpup(ehci, &sitd->hw_uframe);
+	unsigned	uf;
+
+	for (uf = 0; uf < 8; uf++) {
+		/* S-mask?  (count SPLIT, DATA) */
+		if (mask & (1 << uf)) {
+			if (sitd->hw_fullspeed_ep & cpu_to_hc32(ehci, 1<<31))
+				bw [uf] += sign * sitd->stream->usecs;
+			else	/* worst case for OUT start-split */
+				bw [uf] += sign * HS_USECS_ISO (188);
+		}
+		/* ... C-mask?  worst case for IN complete-split */
+		if (mask & (1 << (8 + uf)))
+			bw [uf] += sign * sitd->stream->c_usecs;
+	}
+}
+
+#ifdef	DEBUG
+/* the list walk ehci->bandwidth[] replaced; DEBUG builds cross-check it */
 static unsigned short
-periodic_usecs (struct ehci_hcd *ehci, unsigned frame, unsigned uframe)
+periodic_usecs_scan (struct ehci_hcd *ehci, unsigned frame, unsigned uframe)
 {
 	__hc32			*hw_p = &ehci->periodic [frame];
 	union ehci_shadow	*q = &ehci->pshadow [frame];
@@ -142,7 +207,7 @@ periodic_usecs (struct ehci_hcd *ehci, unsigned frame, unsigned uframe)
 			q = &q->fstn->fstn_next;
 			break;
 		case Q_TYPE_ITD:
-			if (q->itd->hw_transaction[uframe])
+			if (q->itd->index[uframe] != -1)
 				usecs += q->itd->stream->usecs;
 			hw_p = &q->itd->hw_next;
 			q = &q->itd->itd_next;
@@ -170,7 +235,22 @@ periodic_usecs (struct ehci_hcd *ehci, unsigned frame, unsigned uframe)
 			break;
 		}
 	}
+	return usecs;
+}
+#endif
+
+/* how many of the uframe's 125 usecs are allocated? */
+static unsigned short
+periodic_usecs (struct ehci_hcd *ehci, unsigned frame, unsigned uframe)
+{
+	unsigned		usecs;
+
+	usecs = ehci->bandwidth [(frame << 3) + uframe];
 #ifdef	DEBUG
+	if (usecs != periodic_usecs_scan (ehci, frame, uframe))
+		ehci_err (ehci, "uframe %d bandwidth %d usecs, schedule %d\n",
+			frame * 8 + uframe, usecs,
+			periodic_usecs_scan (ehci, frame, uframe));
 	if (usecs > 100)
 		ehci_err (ehci, "uframe %d sched overrun: %d usecs\n",
 			frame * 8 + uframe, usecs);
@@ -594,6 +674,7 @@ static int qh_link_periodic (struct ehci_hcd *ehci, struct ehci_qh *qh)
 			prev->qh = qh;
 			*hw_p = QH_NEXT (ehci, qh->qh_dma);
 		}
+		qh_bandwidth (ehci, i, qh, 1);
 	}
 	qh->qh_state = QH_STATE_LINKED;
 	qh->xacterrs = 0;
@@ -624,8 +705,10 @@ static int qh_unlink_periodic(struct ehci_hcd *ehci, struct ehci_qh *qh)
 	if ((period = qh->period) == 0)
 		period = 1;
 
-	for (i = qh->start; i < ehci->periodic_size; i += period)
+	for (i = qh->start; i < ehci->periodic_size; i += period) {
 		periodic_unlink (ehci, i, qh);
+		qh_bandwidth (ehci, i, qh, -1);
+	}
 
 	/* update per-qh bandwidth for usbfs */
 	ehci_to_hcd(ehci)->self.bandwidth_allocated -= qh->period
@@ -1603,6 +1686,7 @@ itd_link (struct ehci_hcd *ehci, unsigned frame, struct ehci_itd *itd)
 	itd->hw_next = *hw_p;
 	prev->itd = itd;
 	itd->frame = frame;
+	itd_bandwidth (ehci, frame, itd, 1);
 	wmb ();
 	*hw_p = cpu_to_hc32(ehci, itd->itd_dma | Q_TYPE_ITD);
 }
@@ -2025,6 +2109,7 @@ sitd_link (struct ehci_hcd *ehci, unsigned frame, struct ehci_sitd *sitd)
 	sitd->hw_next = ehci->periodic [frame];
 	ehci->pshadow [frame].sitd = sitd;
 	sitd->frame = frame;
+	sitd_bandwidth (ehci, frame, sitd, 1);
 	wmb ();
 	ehci->periodic[frame] = cpu_to_hc32(ehci, sitd->sitd_dma | Q_TYPE_SITD);
 }
@@ -2395,6 +2480,7 @@ restart:
 
 				type = Q_NEXT_TYPE(ehci, q.itd->hw_next);
 				wmb();
+				itd_bandwidth (ehci, frame, q.itd, -1);
 				modified = itd_complete (ehci, q.itd);
 				q = *q_p;
 				break;
@@ -2433,6 +2519,7 @@ restart:
 
 				type = Q_NEXT_TYPE(ehci, q.sitd->hw_next);
 				wmb();
+				sitd_bandwidth (ehci, frame, q.sitd, -1);
 				modified = sitd_complete (ehci, q.sitd);
 				q = *q_p;
 				break;
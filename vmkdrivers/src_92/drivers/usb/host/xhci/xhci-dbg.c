@@ -222,6 +222,25 @@ void xhci_print_ir_set(struct xhci_hcd *xhci, int set_num)
 			addr, temp_64);
 }
 
+void xhci_dbg_ir_stats(struct xhci_hcd *xhci, int set_num)
+{
+	struct xhci_intr_stats *stats = &xhci->ir_stats;
+
+	if (set_num != 0)
+		return;
+
+	xhci_dbg(xhci, "ir_set[%i] event handling:\n", set_num);
+	xhci_dbg(xhci, "  irqs = %lu, events = %lu\n",
+			stats->irqs, stats->events);
+	xhci_dbg(xhci, "  events per irq = %lu avg, %u max\n",
+			stats->irqs ? stats->events / stats->irqs : 0,
+			stats->max_events);
+	xhci_dbg(xhci, "  erst_dequeue writes = %lu\n", stats->erdp_writes);
+	xhci_dbg(xhci, "  transfer events matched to TD end = %lu, "
+			"walked = %lu\n",
+			stats->td_cache_hits, stats->td_cache_misses);
+}
+
 void xhci_print_run_regs(struct xhci_hcd *xhci)
 {
 	u32 temp;
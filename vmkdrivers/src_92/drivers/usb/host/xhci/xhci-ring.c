@@ -2441,9 +2441,20 @@ static int handle_tx_event(struct xhci_hcd *xhci,
 		if (ep->skip)
 			td_num--;
 
-		/* Is this a TRB in the currently executing TD? */
-		event_seg = trb_in_td(xhci, ep_ring->deq_seg, ep_ring->dequeue,
-				td->last_trb, event_dma, false);
+		/* Is this a TRB in the currently executing TD?  Most events
+		 * are for the TD's last TRB, whose segment is already known,
+		 * so only walk the TD's segments for the others.
+		 */
+		if (td->last_seg && event_dma ==
+		    xhci_trb_virt_to_dma(td->last_seg, td->last_trb)) {
+			event_seg = td->last_seg;
+			xhci->ir_stats.td_cache_hits++;
+		} else {
+			event_seg = trb_in_td(xhci, ep_ring->deq_seg,
+					ep_ring->dequeue, td->last_trb,
+					event_dma, false);
+			xhci->ir_stats.td_cache_misses++;
+		}
 
 		/*
 		 * Skip the Force Stopped Event. The event_trb(event_dma) of FSE
@@ -2650,6 +2661,41 @@ static int xhci_handle_event(struct xhci_hcd *xhci)
 	return 1;
 }
 
+/*
+ * Tell the xHC how far software has consumed the event ring.  EHB is
+ * RW1C, so it is only written back as 1 once the ring has been drained;
+ * intermediate updates leave it set.
+ */
+static void xhci_update_erst_dequeue(struct xhci_hcd *xhci,
+		union xhci_trb *event_ring_deq, bool clear_ehb)
+{
+	u64 temp_64;
+	dma_addr_t deq;
+
+	if (!clear_ehb && event_ring_deq == xhci->event_ring->dequeue)
+		return;
+
+	temp_64 = xhci_read_64(xhci, &xhci->ir_set->erst_dequeue);
+	/* If necessary, update the HW's version of the event ring deq ptr. */
+	if (event_ring_deq != xhci->event_ring->dequeue) {
+		deq = xhci_trb_virt_to_dma(xhci->event_ring->deq_seg,
+				xhci->event_ring->dequeue);
+		if (deq == 0)
+			xhci_warn(xhci, "WARN something wrong with SW event "
+					"ring dequeue ptr.\n");
+		/* Update HC event ring dequeue pointer */
+		temp_64 &= ERST_PTR_MASK;
+		temp_64 |= ((u64) deq & (u64) ~ERST_PTR_MASK);
+	}
+
+	if (clear_ehb)
+		temp_64 |= ERST_EHB;
+	else
+		temp_64 &= ~((u64) ERST_EHB);
+	xhci_write_64(xhci, temp_64, &xhci->ir_set->erst_dequeue);
+	xhci->ir_stats.erdp_writes++;
+}
+
 /*
  * xHCI spec says we can get an interrupt, and if the HC has an error condition,
  * we might get bad data out of the event ring.  Section 4.10.2.7 has a list of
@@ -2658,10 +2704,11 @@ static int xhci_handle_event(struct xhci_hcd *xhci)
 irqreturn_t xhci_irq(struct usb_hcd *hcd)
 {
 	struct xhci_hcd *xhci = hcd_to_xhci(hcd);
+	struct xhci_intr_stats *stats = &xhci->ir_stats;
 	u32 status;
 	u64 temp_64;
 	union xhci_trb *event_ring_deq;
-	dma_addr_t deq;
+	unsigned int events = 0;
 
 	spin_lock(&xhci->lock);
 	/* Check if the xHC generated the interrupt, or the irq is shared */
@@ -2733,24 +2780,23 @@ hw_died:
 	/* FIXME this should be a delayed service routine
 	 * that clears the EHB.
 	 */
-	while (xhci_handle_event(xhci) > 0) {}
-
-	temp_64 = xhci_read_64(xhci, &xhci->ir_set->erst_dequeue);
-	/* If necessary, update the HW's version of the event ring deq ptr. */
-	if (event_ring_deq != xhci->event_ring->dequeue) {
-		deq = xhci_trb_virt_to_dma(xhci->event_ring->deq_seg,
-				xhci->event_ring->dequeue);
-		if (deq == 0)
-			xhci_warn(xhci, "WARN something wrong with SW event "
-					"ring dequeue ptr.\n");
-		/* Update HC event ring dequeue pointer */
-		temp_64 &= ERST_PTR_MASK;
-		temp_64 |= ((u64) deq & (u64) ~ERST_PTR_MASK);
+	while (xhci_handle_event(xhci) > 0) {
+		/* Return consumed TRBs to the xHC once per batch rather than
+		 * once per event.
+		 */
+		if (++events % XHCI_EVENT_BATCH == 0) {
+			xhci_update_erst_dequeue(xhci, event_ring_deq, false);
+			event_ring_deq = xhci->event_ring->dequeue;
+		}
 	}
 
 	/* Clear the event handler busy flag (RW1C); event ring is empty. */
-	temp_64 |= ERST_EHB;
-	xhci_write_64(xhci, temp_64, &xhci->ir_set->erst_dequeue);
+	xhci_update_erst_dequeue(xhci, event_ring_deq, true);
+
+	stats->irqs++;
+	stats->events += events;
+	if (events > stats->max_events)
+		stats->max_events = events;
 
 	spin_unlock(&xhci->lock);
 
@@ -3166,6 +3212,7 @@ static int queue_bulk_sg_tx(struct xhci_hcd *xhci, gfp_t mem_flags,
 		} else {
 			/* FIXME - add check for ZERO_PACKET flag before this */
 			td->last_trb = ep_ring->enqueue;
+			td->last_seg = ep_ring->enq_seg;
 			field |= TRB_IOC;
 		}
 
@@ -3332,6 +3379,7 @@ int xhci_queue_bulk_tx(struct xhci_hcd *xhci, gfp_t mem_flags,
 		} else {
 			/* FIXME - add check for ZERO_PACKET flag before this */
 			td->last_trb = ep_ring->enqueue;
+			td->last_seg = ep_ring->enq_seg;
 			field |= TRB_IOC;
 		}
 
@@ -3476,6 +3524,7 @@ int xhci_queue_ctrl_tx(struct xhci_hcd *xhci, gfp_t mem_flags,
 
 	/* Save the DMA address of the last TRB in the TD */
 	td->last_trb = ep_ring->enqueue;
+	td->last_seg = ep_ring->enq_seg;
 
 	/* Queue status TRB - see Table 7 and sections 4.11.2.2 and 6.4.1.2.3 */
 	/* If the device sent data, the status stage is an OUT transfer */
@@ -3668,6 +3717,7 @@ static int xhci_queue_isoc_tx(struct xhci_hcd *xhci, gfp_t mem_flags,
 				more_trbs_coming = true;
 			} else {
 				td->last_trb = ep_ring->enqueue;
+				td->last_seg = ep_ring->enq_seg;
 				field |= TRB_IOC;
 				if (xhci->hci_version == 0x100 &&
 						!(xhci->quirks &
@@ -3739,6 +3789,7 @@ cleanup:
 	 * overwrite them.  td->first_trb and td->start_seg are already set.
 	 */
 	urb_priv->td[0]->last_trb = ep_ring->enqueue;
+	urb_priv->td[0]->last_seg = ep_ring->enq_seg;
 	/* Every TRB except the first & last will have its cycle bit flipped. */
 	td_to_noop(xhci, ep_ring, urb_priv->td[0], true);
 
@@ -1277,6 +1277,11 @@ union xhci_trb {
  * It must also be greater than 16.
  */
 #define TRBS_PER_SEGMENT	256
+/*
+ * xhci_irq() hands the xHC back the event TRBs it has consumed every
+ * XHCI_EVENT_BATCH events, so a long drain doesn't fill the event ring.
+ */
+#define XHCI_EVENT_BATCH	(TRBS_PER_SEGMENT / 4)
 /* Allow two commands + a link TRB, along with any reserved command TRBs */
 #define MAX_RSVD_CMD_TRBS	(TRBS_PER_SEGMENT - 3)
 #define TRB_SEGMENT_SIZE	(TRBS_PER_SEGMENT*16)
@@ -1299,6 +1304,8 @@ struct xhci_td {
 	struct xhci_segment	*start_seg;
 	union xhci_trb		*first_trb;
 	union xhci_trb		*last_trb;
+	/* segment holding last_trb, so events for it need no ring walk */
+	struct xhci_segment	*last_seg;
 	/* actual_length of the URB has already been set */
 	bool			urb_length_set;
 };
@@ -1452,6 +1459,17 @@ static inline unsigned int hcd_index(struct usb_hcd *hcd)
 		return 1;
 }
 
+/* Event handling statistics for one interrupter, see xhci_dbg_ir_stats() */
+struct xhci_intr_stats {
+	unsigned long		irqs;
+	unsigned long		events;
+	unsigned int		max_events;	/* in a single irq */
+	unsigned long		erdp_writes;
+	/* transfer events resolved without walking the TD's segments */
+	unsigned long		td_cache_hits;
+	unsigned long		td_cache_misses;
+};
+
 /* There is one xhci_hcd structure per controller */
 struct xhci_hcd {
 	struct usb_hcd *main_hcd;
@@ -1503,6 +1521,8 @@ struct xhci_hcd {
 	struct xhci_command	*current_cmd;
 	struct xhci_ring	*event_ring;
 	struct xhci_erst	erst;
+	/* every MSI-X vector services interrupter 0 and its event ring */
+	struct xhci_intr_stats	ir_stats;
 	/* Scratchpad */
 	struct xhci_scratchpad  *scratchpad;
 	/* Store LPM test failed devices' information */
@@ -1712,6 +1732,7 @@ static inline int xhci_link_trb_quirk(struct xhci_hcd *xhci)
 
 /* xHCI debugging */
 void xhci_print_ir_set(struct xhci_hcd *xhci, int set_num);
+void xhci_dbg_ir_stats(struct xhci_hcd *xhci, int set_num);
 void xhci_print_registers(struct xhci_hcd *xhci);
 void xhci_dbg_regs(struct xhci_hcd *xhci);
 void xhci_print_run_regs(struct xhci_hcd *xhci);
@@ -56,15 +56,15 @@
  * For high speed, each frame comfortably fits almost 36 max size
  * Ethernet packets (so queues should be bigger).
  *
- * REVISIT qlens should be members of 'struct usbnet'; the goal is to
- * let the USB host controller be busy for 5msec or more before an irq
- * is required, under load.  Jumbograms change the equation.
+ * The goal is to let the USB host controller be busy for 5msec or more
+ * before an irq is required, under load.  SuperSpeed moves several times
+ * more data per microframe, so it gets proportionally deeper queues.
+ * Jumbograms change the equation; usbnet_update_max_qlen() recomputes
+ * the depths whenever the urb sizes change.
  */
 #define RX_MAX_QUEUE_MEMORY (60 * 1518)
-#define	RX_QLEN(dev) (((dev)->udev->speed == USB_SPEED_HIGH) ? \
-			(RX_MAX_QUEUE_MEMORY/(dev)->rx_urb_size) : 4)
-#define	TX_QLEN(dev) (((dev)->udev->speed == USB_SPEED_HIGH) ? \
-			(RX_MAX_QUEUE_MEMORY/(dev)->hard_mtu) : 4)
+#define	RX_QLEN(dev) ((dev)->rx_qlen)
+#define	TX_QLEN(dev) ((dev)->tx_qlen)
 
 // reawaken network queue this soon after stopping; else watchdog barks
 #define TX_TIMEOUT_JIFFIES	(5*HZ)
@@ -90,6 +90,79 @@ MODULE_PARM_DESC (msg_level, "Override default message level");
 
 /*-------------------------------------------------------------------------*/
 
+static void usbnet_update_max_qlen (struct usbnet *dev)
+{
+	switch (dev->udev->speed) {
+	case USB_SPEED_HIGH:
+		dev->rx_qlen = RX_MAX_QUEUE_MEMORY / dev->rx_urb_size;
+		dev->tx_qlen = RX_MAX_QUEUE_MEMORY / dev->hard_mtu;
+		break;
+	case USB_SPEED_SUPER:
+		dev->rx_qlen = 5 * RX_MAX_QUEUE_MEMORY / dev->rx_urb_size;
+		dev->tx_qlen = 5 * RX_MAX_QUEUE_MEMORY / dev->hard_mtu;
+		break;
+	default:
+		dev->rx_qlen = dev->tx_qlen = 4;
+	}
+
+	/* urbs larger than the queue budget still need one in flight */
+	if (!dev->rx_qlen)
+		dev->rx_qlen = 1;
+	if (!dev->tx_qlen)
+		dev->tx_qlen = 1;
+}
+
+/* Completed urbs are recycled through a small per-device pool rather
+ * than freed, so steady-state rx and tx don't touch the allocator.
+ */
+static struct urb *usbnet_get_urb (struct usbnet *dev, gfp_t flags)
+{
+	struct urb		*urb = NULL;
+	unsigned long		lockflags;
+
+	spin_lock_irqsave (&dev->urb_pool_lock, lockflags);
+	if (dev->urb_pool_count)
+		urb = dev->urb_pool [--dev->urb_pool_count];
+	spin_unlock_irqrestore (&dev->urb_pool_lock, lockflags);
+
+	if (urb) {
+		dev->xstats.urb_recycles++;
+		// usb_fill_bulk_urb() leaves these alone
+		urb->transfer_flags = 0;
+		return urb;
+	}
+
+	urb = usb_alloc_urb (0, flags);
+	if (urb)
+		dev->xstats.urb_allocs++;
+	return urb;
+}
+
+static void usbnet_put_urb (struct usbnet *dev, struct urb *urb)
+{
+	unsigned long		lockflags;
+
+	if (!urb)
+		return;
+
+	spin_lock_irqsave (&dev->urb_pool_lock, lockflags);
+	if (dev->urb_pool_count < USBNET_URB_POOL) {
+		dev->urb_pool [dev->urb_pool_count++] = urb;
+		urb = NULL;
+	}
+	spin_unlock_irqrestore (&dev->urb_pool_lock, lockflags);
+
+	usb_free_urb (urb);
+}
+
+static void usbnet_drain_urb_pool (struct usbnet *dev)
+{
+	while (dev->urb_pool_count)
+		usb_free_urb (dev->urb_pool [--dev->urb_pool_count]);
+}
+
+/*-------------------------------------------------------------------------*/
+
 /* handles CDC Ethernet and many other network "bulk data" interfaces */
 int usbnet_get_endpoints(struct usbnet *dev, struct usb_interface *intf)
 {
@@ -252,6 +325,7 @@ static int usbnet_change_mtu (struct net_device *net, int new_mtu)
 			usbnet_unlink_rx_urbs(dev);
 	}
 
+	usbnet_update_max_qlen (dev);
 	return 0;
 }
 
@@ -317,7 +391,7 @@ static void rx_submit (struct usbnet *dev, struct urb *urb, gfp_t flags)
 		if (netif_msg_rx_err (dev))
 			devdbg (dev, "no rx skb");
 		usbnet_defer_kevent (dev, EVENT_RX_MEMORY);
-		usb_free_urb (urb);
+		usbnet_put_urb (dev, urb);
 		return;
 	}
 	skb_reserve (skb, NET_IP_ALIGN);
@@ -364,7 +438,7 @@ static void rx_submit (struct usbnet *dev, struct urb *urb, gfp_t flags)
 	spin_unlock_irqrestore (&dev->rxq.lock, lockflags);
 	if (retval) {
 		dev_kfree_skb_any (skb);
-		usb_free_urb (urb);
+		usbnet_put_urb (dev, urb);
 	}
 }
 
@@ -373,6 +447,9 @@ static void rx_submit (struct usbnet *dev, struct urb *urb, gfp_t flags)
 
 static inline void rx_process (struct usbnet *dev, struct sk_buff *skb)
 {
+	unsigned long	rx_packets = dev->stats.rx_packets;
+
+	// framings that batch may return several frames per urb
 	if (dev->driver_info->rx_fixup
 			&& !dev->driver_info->rx_fixup (dev, skb))
 		goto error;
@@ -387,6 +464,9 @@ error:
 		dev->stats.rx_errors++;
 		skb_queue_tail (&dev->done, skb);
 	}
+
+	dev->xstats.rx_urbs++;
+	dev->xstats.rx_frames += dev->stats.rx_packets - rx_packets;
 }
 
 /*-------------------------------------------------------------------------*/
@@ -471,7 +551,7 @@ block:
 			rx_submit (dev, urb, GFP_ATOMIC);
 			return;
 		}
-		usb_free_urb (urb);
+		usbnet_put_urb (dev, urb);
 	}
 	if (netif_msg_rx_err (dev))
 		devdbg (dev, "no read resubmitted");
@@ -783,6 +863,47 @@ void usbnet_set_msglevel (struct net_device *net, u32 level)
 }
 EXPORT_SYMBOL_GPL(usbnet_set_msglevel);
 
+static const struct {
+	const char	string [ETH_GSTRING_LEN];
+	size_t		offset;
+} usbnet_xstats_keys [] = {
+	{ "rx_urbs",		offsetof (struct usbnet_xstats, rx_urbs) },
+	{ "rx_frames",		offsetof (struct usbnet_xstats, rx_frames) },
+	{ "tx_urbs",		offsetof (struct usbnet_xstats, tx_urbs) },
+	{ "urb_allocs",		offsetof (struct usbnet_xstats, urb_allocs) },
+	{ "urb_recycles",	offsetof (struct usbnet_xstats, urb_recycles) },
+};
+
+int usbnet_get_stats_count (struct net_device *net)
+{
+	return ARRAY_SIZE (usbnet_xstats_keys);
+}
+EXPORT_SYMBOL_GPL(usbnet_get_stats_count);
+
+void usbnet_get_strings (struct net_device *net, u32 stringset, u8 *buf)
+{
+	int	i;
+
+	if (stringset != ETH_SS_STATS)
+		return;
+	for (i = 0; i < ARRAY_SIZE (usbnet_xstats_keys); i++)
+		memcpy (buf + i * ETH_GSTRING_LEN,
+			usbnet_xstats_keys [i].string, ETH_GSTRING_LEN);
+}
+EXPORT_SYMBOL_GPL(usbnet_get_strings);
+
+void usbnet_get_ethtool_stats (struct net_device *net,
+		struct ethtool_stats *stats, u64 *data)
+{
+	struct usbnet	*dev = netdev_priv(net);
+	int		i;
+
+	for (i = 0; i < ARRAY_SIZE (usbnet_xstats_keys); i++)
+		data [i] = *(unsigned long *) ((char *) &dev->xstats
+				+ usbnet_xstats_keys [i].offset);
+}
+EXPORT_SYMBOL_GPL(usbnet_get_ethtool_stats);
+
 /* drivers may override default ethtool_ops in their bind() routine */
 static struct ethtool_ops usbnet_ethtool_ops = {
 	.get_settings		= usbnet_get_settings,
@@ -792,6 +913,9 @@ static struct ethtool_ops usbnet_ethtool_ops = {
 	.get_drvinfo		= usbnet_get_drvinfo,
 	.get_msglevel		= usbnet_get_msglevel,
 	.set_msglevel		= usbnet_set_msglevel,
+	.get_strings		= usbnet_get_strings,
+	.get_stats_count	= usbnet_get_stats_count,
+	.get_ethtool_stats	= usbnet_get_ethtool_stats,
 };
 
 /*-------------------------------------------------------------------------*/
@@ -844,7 +968,7 @@ kevent (struct work_struct *work)
 		struct urb	*urb = NULL;
 
 		if (netif_running (dev->net))
-			urb = usb_alloc_urb (0, GFP_KERNEL);
+			urb = usbnet_get_urb (dev, GFP_KERNEL);
 		else
 			clear_bit (EVENT_RX_MEMORY, &dev->flags);
 		if (urb != NULL) {
@@ -958,7 +1082,7 @@ static int usbnet_start_xmit (struct sk_buff *skb, struct net_device *net)
 	}
 	length = skb->len;
 
-	if (!(urb = usb_alloc_urb (0, GFP_ATOMIC))) {
+	if (!(urb = usbnet_get_urb (dev, GFP_ATOMIC))) {
 		if (netif_msg_tx_err (dev))
 			devdbg (dev, "no urb");
 		goto drop;
@@ -1033,6 +1157,7 @@ static int usbnet_start_xmit (struct sk_buff *skb, struct net_device *net)
 		__skb_queue_tail (&dev->txq, skb);
 		if (dev->txq.qlen >= TX_QLEN (dev))
 			netif_stop_queue (net);
+		dev->xstats.tx_urbs++;
 	}
 	spin_unlock_irqrestore (&dev->txq.lock, flags);
 
@@ -1044,7 +1169,7 @@ drop:
 		dev->stats.tx_dropped++;
 		if (skb)
 			dev_kfree_skb_any (skb);
-		usb_free_urb (urb);
+		usbnet_put_urb (dev, urb);
 	} else if (netif_msg_tx_queued (dev)) {
 		devdbg (dev, "> tx, len %d, type 0x%x",
 			length, skb->protocol);
@@ -1072,7 +1197,7 @@ static void usbnet_bh (unsigned long param)
 			continue;
 		case tx_done:
 		case rx_cleanup:
-			usb_free_urb (entry->urb);
+			usbnet_put_urb (dev, entry->urb);
 			dev_kfree_skb (skb);
 			continue;
 		default:
@@ -1100,7 +1225,7 @@ static void usbnet_bh (unsigned long param)
 
 			// don't refill the queue all at once
 			for (i = 0; i < 10 && dev->rxq.qlen < qlen; i++) {
-				urb = usb_alloc_urb (0, GFP_ATOMIC);
+				urb = usbnet_get_urb (dev, GFP_ATOMIC);
 				if (urb != NULL)
 					rx_submit (dev, urb, GFP_ATOMIC);
 			}
@@ -1153,6 +1278,7 @@ void usbnet_disconnect (struct usb_interface *intf)
 	if (dev->driver_info->unbind)
 		dev->driver_info->unbind (dev, intf);
 
+	usbnet_drain_urb_pool (dev);
 	free_netdev(net);
 	usb_put_dev (xdev);
 }
@@ -1217,6 +1343,7 @@ usbnet_probe (struct usb_interface *udev, const struct usb_device_id *prod)
 	dev->delay.data = (unsigned long) dev;
 	init_timer (&dev->delay);
 	mutex_init (&dev->phy_mutex);
+	spin_lock_init (&dev->urb_pool_lock);
 
 	dev->net = net;
 	strcpy (net->name, "vusb%d");
@@ -1285,6 +1412,7 @@ usbnet_probe (struct usb_interface *udev, const struct usb_device_id *prod)
 	if (!dev->rx_urb_size)
 		dev->rx_urb_size = dev->hard_mtu;
 	dev->maxpacket = usb_maxpacket (dev->udev, dev->out, 1);
+	usbnet_update_max_qlen (dev);
 
 #if !defined(__VMKLNX__)
 	/* PR308723 */
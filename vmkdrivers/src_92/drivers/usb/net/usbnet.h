@@ -23,6 +23,17 @@
 #ifndef	__USBNET_H
 #define	__USBNET_H
 
+/* completed urbs kept for reuse by the rx and tx paths */
+#define USBNET_URB_POOL		64
+
+/* extended counters, reported through ethtool -S */
+struct usbnet_xstats {
+	unsigned long		rx_urbs;	/* rx urbs handed to rx_fixup */
+	unsigned long		rx_frames;	/* frames those urbs carried */
+	unsigned long		tx_urbs;	/* tx urbs submitted */
+	unsigned long		urb_allocs;	/* urbs from usb_alloc_urb() */
+	unsigned long		urb_recycles;	/* urbs reused from the pool */
+};
 
 /* interface from usbnet core to each USB networking link we handle */
 struct usbnet {
@@ -49,6 +60,7 @@ struct usbnet {
 	u32			xid;
 	u32			hard_mtu;	/* count any extra framing */
 	size_t			rx_urb_size;	/* size for rx urbs */
+	unsigned		rx_qlen, tx_qlen;
 	struct mii_if_info	mii;
 
 	/* various kinds of pending driver work */
@@ -58,6 +70,12 @@ struct usbnet {
 	struct urb		*interrupt;
 	struct tasklet_struct	bh;
 
+	/* urb recycling; see usbnet_get_urb() */
+	spinlock_t		urb_pool_lock;
+	struct urb		*urb_pool [USBNET_URB_POOL];
+	unsigned		urb_pool_count;
+	struct usbnet_xstats	xstats;
+
 	struct work_struct	kevent;
 	unsigned long		flags;
 #		define EVENT_TX_HALT	0
@@ -179,6 +197,10 @@ extern u32 usbnet_get_msglevel (struct net_device *);
 extern void usbnet_set_msglevel (struct net_device *, u32);
 extern void usbnet_get_drvinfo (struct net_device *, struct ethtool_drvinfo *);
 extern int usbnet_nway_reset(struct net_device *net);
+extern int usbnet_get_stats_count (struct net_device *);
+extern void usbnet_get_strings (struct net_device *, u32, u8 *);
+extern void usbnet_get_ethtool_stats (struct net_device *,
+		struct ethtool_stats *, u64 *);
 
 /* messaging support includes the interface name, so it must not be
  * used before it has one ... notably, in minidriver bind() calls.
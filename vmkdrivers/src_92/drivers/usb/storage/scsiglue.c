@@ -553,6 +553,11 @@ static int proc_info (struct Scsi_Host *host, char *buffer,
 	/* show the protocol and transport */
 	SPRINTF("     Protocol: %s\n", us->protocol_name);
 	SPRINTF("    Transport: %s\n", us->transport_name);
+#if defined(__VMKLNX__)
+	if (us->protocol == USB_PR_BULK)
+		SPRINTF("    Pipelined: %lu (%lu recovered)\n",
+				us->pipe_cmds, us->pipe_fallbacks);
+#endif
 
 	/* show the device flags */
 	if (pos < buffer + length) {
@@ -69,8 +69,6 @@
 #else
 #include "vmklinux_dist.h"
 #include "vmklinux_usb.h"
-
-extern long wait_for_urb_completion(struct urb *, struct completion *);
 #endif
 
 /***********************************************************************
@@ -1173,6 +1171,14 @@ void usb_stor_stop_transport(struct us_data *us)
 		US_DEBUGP("-- cancelling sg request\n");
 		usb_sg_cancel(&us->current_sg);
 	}
+
+#if defined(__VMKLNX__)
+	/* Likewise for the stages of a pipelined Bulk-Only command */
+	if (test_and_clear_bit(US_FLIDX_PIPE_ACTIVE, &us->dflags)) {
+		US_DEBUGP("-- cancelling pipelined urbs\n");
+		usb_unlink_anchored_urbs(&us->pipe_anchor);
+	}
+#endif
 }
 
 /*
@@ -1288,6 +1294,148 @@ EXPORT_SYMBOL_GPL(usb_stor_CB_transport);
  * Bulk only transport
  */
 
+#if defined(__VMKLNX__)
+/*
+ * Completion handler for the stages of a pipelined Bulk-Only command.
+ * Wake the control thread once every stage is done, or as soon as one
+ * fails, since the stages queued behind a failed one may never finish.
+ */
+static void usb_stor_pipe_completion(struct urb *urb)
+{
+	struct us_data *us = urb->context;
+
+	if (atomic_dec_and_test(&us->pipe_pending) || urb->status)
+		complete(&us->pipe_done);
+}
+
+/*
+ * A command can be pipelined when its data stage fits in one urb: either
+ * there is no data, or the host controller takes the scatterlist as is.
+ * Controllers without SG support still go through usb_sg_init(), which
+ * splits the list into one urb per entry.
+ */
+static inline int usb_stor_can_pipeline(struct us_data *us,
+		struct scsi_cmnd *srb)
+{
+	if (unlikely(scsi_dump_active(srb)))
+		return 0;
+	if (us->fflags & US_FL_GO_SLOW)
+		return 0;
+	if (!scsi_bufflen(srb))
+		return 1;
+	return srb->use_sg && us->pusb_dev->bus->sg_tablesize > 0;
+}
+
+/*
+ * Queue the CBW, data and CSW stages of a Bulk-Only command together and
+ * wait for them once, rather than once per stage.  The bulk-in pipe
+ * completes in order, so the CSW urb queued behind a short data-in stage
+ * still receives the CSW.
+ *
+ * Returns the result of the command stage.  *data_result is the result of
+ * the data stage; *csw_ok says whether the CSW arrived, in which case it
+ * is at us->iobuf + US_BULK_CSW_OFFSET and *cswlen bytes long.  Anything
+ * else is left for usb_stor_Bulk_transport() to recover the usual way.
+ */
+static int usb_stor_Bulk_pipeline(struct us_data *us, struct scsi_cmnd *srb,
+		unsigned int cbwlen, int *data_result, int *csw_ok,
+		unsigned int *cswlen)
+{
+	unsigned int transfer_length = scsi_bufflen(srb);
+	unsigned int pipe = srb->sc_data_direction == DMA_FROM_DEVICE ?
+			us->recv_bulk_pipe : us->send_bulk_pipe;
+	struct urb *urbs[3];
+	int i, n = 0;
+
+	*data_result = USB_STOR_XFER_GOOD;
+	*csw_ok = 0;
+
+	/* don't submit URBs during abort processing */
+	if (test_bit(US_FLIDX_ABORTING, &us->dflags))
+		return USB_STOR_XFER_ERROR;
+
+	init_completion(&us->pipe_done);
+
+	usb_fill_bulk_urb(us->current_urb, us->pusb_dev, us->send_bulk_pipe,
+			us->iobuf, cbwlen, usb_stor_pipe_completion, us);
+	us->current_urb->transfer_flags = URB_NO_TRANSFER_DMA_MAP;
+	us->current_urb->transfer_dma = us->iobuf_dma;
+	urbs[n++] = us->current_urb;
+
+	if (transfer_length) {
+		/* hand the SCSI scatterlist straight to the HCD */
+		usb_fill_bulk_urb(us->data_urb, us->pusb_dev, pipe, NULL,
+				transfer_length, usb_stor_pipe_completion, us);
+		us->data_urb->transfer_flags = 0;
+		us->data_urb->sg = scsi_sglist(srb);
+		us->data_urb->num_sgs = scsi_sg_count(srb);
+		urbs[n++] = us->data_urb;
+	}
+
+	usb_fill_bulk_urb(us->csw_urb, us->pusb_dev, us->recv_bulk_pipe,
+			us->iobuf + US_BULK_CSW_OFFSET, US_BULK_CS_WRAP_LEN,
+			usb_stor_pipe_completion, us);
+	us->csw_urb->transfer_flags = URB_NO_TRANSFER_DMA_MAP;
+	us->csw_urb->transfer_dma = us->iobuf_dma + US_BULK_CSW_OFFSET;
+	urbs[n++] = us->csw_urb;
+
+	atomic_set(&us->pipe_pending, n);
+	for (i = 0; i < n; i++) {
+		usb_anchor_urb(urbs[i], &us->pipe_anchor);
+		if (usb_submit_urb(urbs[i], GFP_NOIO)) {
+			usb_unanchor_urb(urbs[i]);
+			break;
+		}
+	}
+	if (i < n) {
+		/* the device may already have the CBW; let a reset sort it out */
+		usb_kill_anchored_urbs(&us->pipe_anchor);
+		us->pipe_fallbacks++;
+		return USB_STOR_XFER_ERROR;
+	}
+
+	/* since the URBs have been submitted successfully, it's now okay
+	 * to cancel them */
+	set_bit(US_FLIDX_PIPE_ACTIVE, &us->dflags);
+
+	/* did an abort occur during the submission? */
+	if (test_bit(US_FLIDX_ABORTING, &us->dflags)) {
+		if (test_and_clear_bit(US_FLIDX_PIPE_ACTIVE, &us->dflags)) {
+			US_DEBUGP("-- cancelling pipelined urbs\n");
+			usb_unlink_anchored_urbs(&us->pipe_anchor);
+		}
+	}
+
+	wait_for_completion_interruptible(&us->pipe_done);
+	clear_bit(US_FLIDX_PIPE_ACTIVE, &us->dflags);
+
+	/* reap whatever is still queued behind a failed stage */
+	usb_kill_anchored_urbs(&us->pipe_anchor);
+	us->pipe_cmds++;
+
+	if (us->current_urb->status) {
+		US_DEBUGP("Pipelined CBW status %d\n", us->current_urb->status);
+		us->pipe_fallbacks++;
+		return USB_STOR_XFER_ERROR;
+	}
+
+	if (transfer_length) {
+		*data_result = interpret_urb_result(us, pipe, transfer_length,
+				us->data_urb->status,
+				us->data_urb->actual_length);
+		scsi_set_resid(srb,
+				transfer_length - us->data_urb->actual_length);
+	}
+
+	*csw_ok = us->csw_urb->status == 0;
+	*cswlen = us->csw_urb->actual_length;
+	if (!*csw_ok)
+		us->pipe_fallbacks++;
+
+	return USB_STOR_XFER_GOOD;
+}
+#endif
+
 /* Determine what the maximum LUN supported is */
 int usb_stor_Bulk_max_lun(struct us_data *us)
 {
@@ -1356,6 +1504,30 @@ int usb_stor_Bulk_transport(struct scsi_cmnd *srb, struct us_data *us)
 			le32_to_cpu(bcb->DataTransferLength), bcb->Flags,
 			(bcb->Lun >> 4), (bcb->Lun & 0x0F), 
 			bcb->Length);
+#if defined(__VMKLNX__)
+	if (usb_stor_can_pipeline(us, srb)) {
+		int data_result, csw_ok;
+
+		result = usb_stor_Bulk_pipeline(us, srb, cbwlen,
+				&data_result, &csw_ok, &cswlen);
+		US_DEBUGP("Bulk pipeline result=%d data=%d csw=%d\n",
+				result, data_result, csw_ok);
+		if (result != USB_STOR_XFER_GOOD ||
+		    data_result == USB_STOR_XFER_ERROR)
+			return USB_STOR_TRANSPORT_ERROR;
+		if (data_result == USB_STOR_XFER_LONG)
+			fake_sense = 1;
+
+		/* a stalled data stage was cleared; read the CSW afresh */
+		if (!csw_ok)
+			goto get_csw;
+
+		bcs = (struct bulk_cs_wrap *) (us->iobuf + US_BULK_CSW_OFFSET);
+		result = cswlen == US_BULK_CS_WRAP_LEN ?
+				USB_STOR_XFER_GOOD : USB_STOR_XFER_SHORT;
+		goto check_csw;
+	}
+#endif
 	result = usb_stor_bulk_transfer_buf(us, us->send_bulk_pipe,
 				bcb, cbwlen, NULL);
 	_VMKLNX_USB_STOR_MSG("Bulk command transfer result=%d\n", srb, result);
@@ -1407,10 +1579,16 @@ int usb_stor_Bulk_transport(struct scsi_cmnd *srb, struct us_data *us)
 	 */
 
 	/* get CSW for device status */
+#if defined(__VMKLNX__)
+get_csw:
+#endif
 	US_DEBUGP("Attempting to get CSW...\n");
 	result = usb_stor_bulk_transfer_buf(us, us->recv_bulk_pipe,
 				bcs, US_BULK_CS_WRAP_LEN, &cswlen);
 
+#if defined(__VMKLNX__)
+check_csw:
+#endif
 	/* Some broken devices add unnecessary zero-length packets to the
 	 * end of their data transfers.  Such packets show up as 0-length
 	 * CSWs.  If we encounter such a thing, try to read the CSW again.
@@ -1418,6 +1596,9 @@ int usb_stor_Bulk_transport(struct scsi_cmnd *srb, struct us_data *us)
 	if (result == USB_STOR_XFER_SHORT && cswlen == 0) {
 		_VMKLNX_USB_STOR_MSG("Received 0-length CSW; retrying...\n", us->srb);
 		US_DEBUGP("Received 0-length CSW; retrying...\n");
+#if defined(__VMKLNX__)
+		bcs = (struct bulk_cs_wrap *) us->iobuf;
+#endif
 		result = usb_stor_bulk_transfer_buf(us, us->recv_bulk_pipe,
 				bcs, US_BULK_CS_WRAP_LEN, &cswlen);
 	}
@@ -74,6 +74,17 @@
 
 #define US_CBI_ADSC		0
 
+#if defined(__VMKLNX__)
+/*
+ * Offset of the CSW in us->iobuf for pipelined Bulk-Only commands, which
+ * need the CBW and the CSW buffers at the same time.
+ */
+#define US_BULK_CSW_OFFSET	32
+
+/* Busy waits for an URB to complete, see drivers/usb/core/urb.c */
+extern long wait_for_urb_completion(struct urb *, struct completion *);
+#endif
+
 extern int usb_stor_CB_transport(struct scsi_cmnd *, struct us_data*);
 extern int usb_stor_CB_reset(struct us_data*);
 
@@ -0,0 +1,1146 @@
+/*
+ * Portions Copyright 2013 VMware, Inc.
+ */
+/* Driver for USB Attached SCSI devices
+ *
+ * UAS moves the command, status and data phases of a SCSI command onto
+ * four separate bulk pipes.  On SuperSpeed the status and data pipes
+ * carry bulk streams, one stream per outstanding command, which lets the
+ * device reorder and overlap commands instead of serializing them the way
+ * the Bulk-Only transport does.
+ *
+ * This driver is linked into the usb-storage module.  storage_probe()
+ * hands an interface to uas_probe() only when uas_use_uas_driver() says
+ * the device, the link and the host controller can all do streams; any
+ * failure in uas_probe() falls back to the Bulk-Only path.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ */
+
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/workqueue.h>
+#include <linux/usb.h>
+#include <linux/usb/hcd.h>
+#include <linux/usb/quirks.h>
+#include <linux/usb/storage.h>
+#include <linux/usb/uas.h>
+#include <linux/usb_usual.h>
+
+#include <scsi/scsi.h>
+#include <scsi/scsi_eh.h>
+#include <scsi/scsi_cmnd.h>
+#include <scsi/scsi_device.h>
+#include <scsi/scsi_host.h>
+#include <scsi/scsi_tcq.h>
+
+#include "usb.h"
+#include "transport.h"
+#include "scsiglue.h"
+#include "uas.h"
+
+#if defined(__VMKLNX__)
+#include "vmklinux_92/vmklinux_scsi.h"
+
+static unsigned int use_uas = 1;
+module_param(use_uas, uint, S_IRUGO | S_IWUSR);
+MODULE_PARM_DESC(use_uas, "Drive UAS capable SuperSpeed devices with UAS "
+		"instead of Bulk-Only (default 1)");
+
+/*
+ * Upper bound on the number of bulk streams per device.  All but the
+ * last carry commands; the tag map is a single u32.
+ */
+#define UAS_MAX_STREAMS		32
+
+/* CDB room in a command IU without additional CDB bytes */
+#define UAS_MAX_CDB_LEN		16
+
+/* How long the abort handler waits for a task management response */
+#define UAS_TMF_TIMEOUT		(5 * HZ)
+
+/* uas_cmd_info.state bits */
+#define UAS_CMD_INFLIGHT	(1 << 0)	/* command IU urb submitted */
+#define UAS_STAT_INFLIGHT	(1 << 1)	/* status urb submitted */
+#define UAS_DATA_INFLIGHT	(1 << 2)	/* data urb submitted */
+#define UAS_GOT_STATUS		(1 << 3)	/* sense IU received */
+#define UAS_CMD_ABORTED		(1 << 4)	/* owned by the abort handler */
+#define UAS_CMD_DUMP		(1 << 5)	/* issued from the dump path */
+#define UAS_CMD_ABORTING	(1 << 6)	/* ABORT TASK pending, tag held */
+
+#define UAS_URBS_INFLIGHT \
+	(UAS_CMD_INFLIGHT | UAS_STAT_INFLIGHT | UAS_DATA_INFLIGHT)
+
+/* uas_dev_info.dflags bits */
+#define UAS_FLIDX_DISCONNECTING	0	/* disconnect in progress */
+#define UAS_FLIDX_RESETTING	1	/* device reset in progress */
+
+struct uas_dev_info;
+
+struct uas_cmd_info {
+	struct scsi_cmnd	*cmnd;
+	struct uas_dev_info	*devinfo;
+	u16			tag;		/* also the stream id */
+	unsigned int		state;
+	unsigned char		host_status;	/* DID_* */
+	unsigned char		scsi_status;	/* SAM status from sense IU */
+	struct urb		*cmd_urb;
+	struct urb		*stat_urb;
+	struct urb		*data_urb;
+	struct command_iu	*iu;
+	struct sense_iu		*sense;
+	struct completion	dump_done;
+};
+
+struct uas_stats {
+	u64			cmds;
+	u64			busy;		/* no free tag */
+	u64			errors;
+	u64			aborts;
+	u64			abort_failures;	/* no ABORT TASK response */
+	u64			resets;
+	unsigned int		peak;		/* deepest queue seen */
+};
+
+struct uas_dev_info {
+	struct usb_interface	*intf;
+	struct usb_device	*udev;
+	struct Scsi_Host	*shost;
+	unsigned long		dflags;
+
+	/* Protects the tag map and every uas_cmd_info */
+	spinlock_t		lock;
+
+	/* Endpoints indexed by pipe id - 1 */
+	struct usb_host_endpoint *eps[DATA_OUT_PIPE_ID];
+	unsigned int		cmd_pipe;
+	unsigned int		status_pipe;
+	unsigned int		data_in_pipe;
+	unsigned int		data_out_pipe;
+
+	unsigned int		qdepth;		/* streams, tags 1..qdepth */
+	u32			tag_map;	/* bit n set: tag n + 1 busy */
+	unsigned int		last_tag;
+	unsigned int		outstanding;
+
+	struct uas_cmd_info	cmds[UAS_MAX_STREAMS + 1];
+
+	/*
+	 * Task management, from the error handler only.  Stream
+	 * qdepth + 1 is reserved for its response.
+	 */
+	u16			tmf_tag;
+	struct urb		*tmf_urb;
+	struct urb		*tmf_stat_urb;
+	struct task_mgmt_iu	*tmf_iu;
+	struct sense_iu		*tmf_resp;	/* big enough for any IU */
+	struct completion	tmf_done;
+	struct uas_stats	stats;
+
+	struct work_struct	unclaim_work;
+};
+
+static inline struct uas_dev_info *host_to_uas(struct Scsi_Host *shost)
+{
+	return (struct uas_dev_info *) shost->hostdata;
+}
+
+/***********************************************************************
+ * Device matching
+ ***********************************************************************/
+
+static int uas_find_uas_alt_setting(struct usb_interface *intf)
+{
+	int i;
+
+	for (i = 0; i < intf->num_altsetting; i++) {
+		struct usb_host_interface *alt = &intf->altsetting[i];
+
+		if (alt->desc.bInterfaceClass == USB_CLASS_MASS_STORAGE &&
+		    alt->desc.bInterfaceSubClass == USB_SC_SCSI &&
+		    alt->desc.bInterfaceProtocol == USB_PR_UAS)
+			return alt->desc.bAlternateSetting;
+	}
+
+	return -ENODEV;
+}
+
+/* Return the pipe id from the Pipe Usage descriptor following @ep */
+static int uas_pipe_id(struct usb_host_endpoint *ep)
+{
+	unsigned char *extra = ep->extra;
+	int len = ep->extralen;
+
+	while (len >= 2) {
+		if (extra[0] < 2 || extra[0] > len)
+			break;
+		if (extra[1] == USB_DT_PIPE_USAGE &&
+		    extra[0] >= sizeof(struct usb_pipe_usage_descriptor))
+			return ((struct usb_pipe_usage_descriptor *)
+				extra)->bPipeID;
+		len -= extra[0];
+		extra += extra[0];
+	}
+
+	return 0;
+}
+
+/*
+ * Decide whether @intf should be driven by UAS.  Streams are what make
+ * UAS worthwhile, so anything not running at SuperSpeed behind a host
+ * controller that can allocate them is left to Bulk-Only.
+ */
+int uas_use_uas_driver(struct usb_interface *intf,
+		const struct usb_device_id *id)
+{
+	struct usb_device *udev = interface_to_usbdev(intf);
+	struct usb_hcd *hcd = bus_to_hcd(udev->bus);
+
+	if (!use_uas || (id->driver_info & US_FL_IGNORE_UAS))
+		return 0;
+
+	if (udev->speed != USB_SPEED_SUPER)
+		return 0;
+
+	if (!hcd->driver->alloc_streams || !hcd->driver->free_streams)
+		return 0;
+
+	return uas_find_uas_alt_setting(intf) >= 0;
+}
+
+/***********************************************************************
+ * Tag management
+ ***********************************************************************/
+
+/*
+ * Hand out tags round robin so a stream that just completed is not
+ * immediately reused while the device may still be retiring it.
+ * Called with devinfo->lock held.  Returns 0 if no tag is free.
+ */
+static u16 uas_alloc_tag(struct uas_dev_info *devinfo)
+{
+	u32 all, free, after;
+	unsigned int bit;
+
+	all = devinfo->qdepth >= 32 ? ~0U : (1U << devinfo->qdepth) - 1;
+	free = ~devinfo->tag_map & all;
+	if (!free)
+		return 0;
+
+	after = devinfo->last_tag >= 32 ? 0 :
+		free & ~((1U << devinfo->last_tag) - 1);
+	bit = __ffs(after ? after : free);
+
+	devinfo->tag_map |= 1U << bit;
+	devinfo->last_tag = bit + 1;
+	return bit + 1;
+}
+
+/*
+ * Retire @cmdinfo once its last urb has completed.  Called with
+ * devinfo->lock held; returns the command to hand back to the midlayer,
+ * or NULL if urbs are still outstanding or the abort handler owns it.
+ */
+static struct scsi_cmnd *uas_cmd_finished(struct uas_dev_info *devinfo,
+		struct uas_cmd_info *cmdinfo)
+{
+	struct scsi_cmnd *cmnd = cmdinfo->cmnd;
+	unsigned char host_status = cmdinfo->host_status;
+
+	if (!cmnd || (cmdinfo->state & UAS_URBS_INFLIGHT))
+		return NULL;
+
+	if (host_status == DID_OK && !(cmdinfo->state & UAS_GOT_STATUS))
+		host_status = DID_ERROR;
+	if (host_status != DID_OK)
+		devinfo->stats.errors++;
+
+	cmnd->result = (host_status << 16) | cmdinfo->scsi_status;
+	cmnd->host_scribble = NULL;
+	cmdinfo->cmnd = NULL;
+	devinfo->outstanding--;
+
+	/*
+	 * The device may still own the task until it answers the ABORT
+	 * TASK; uas_release_aborted() frees the tag.
+	 */
+	if (!(cmdinfo->state & UAS_CMD_ABORTING))
+		devinfo->tag_map &= ~(1U << (cmdinfo->tag - 1));
+
+	if (cmdinfo->state & UAS_CMD_DUMP)
+		complete(&cmdinfo->dump_done);
+
+	/* The abort handler reports aborted commands itself */
+	if (cmdinfo->state & UAS_CMD_ABORTED)
+		return NULL;
+
+	return cmnd;
+}
+
+/* First error wins; called with devinfo->lock held */
+static inline void uas_set_host_status(struct uas_cmd_info *cmdinfo,
+		unsigned char host_status)
+{
+	if (cmdinfo->host_status == DID_OK)
+		cmdinfo->host_status = host_status;
+}
+
+/***********************************************************************
+ * URB completion handlers
+ ***********************************************************************/
+
+static void uas_cmd_cmplt(struct urb *urb)
+{
+	struct uas_cmd_info *cmdinfo = urb->context;
+	struct uas_dev_info *devinfo = cmdinfo->devinfo;
+	struct scsi_cmnd *cmnd;
+	unsigned long flags;
+	int kill = 0;
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	cmdinfo->state &= ~UAS_CMD_INFLIGHT;
+	if (urb->status) {
+		uas_set_host_status(cmdinfo, DID_ERROR);
+		kill = 1;
+	}
+	cmnd = uas_cmd_finished(devinfo, cmdinfo);
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+
+	/*
+	 * The device never saw the command, so nothing will arrive on its
+	 * streams.  usb_unlink_urb() is asynchronous and safe here.
+	 */
+	if (kill && !cmnd) {
+		usb_unlink_urb(cmdinfo->stat_urb);
+		usb_unlink_urb(cmdinfo->data_urb);
+	}
+
+	if (cmnd)
+		cmnd->scsi_done(cmnd);
+}
+
+static void uas_stat_cmplt(struct urb *urb)
+{
+	struct uas_cmd_info *cmdinfo = urb->context;
+	struct uas_dev_info *devinfo = cmdinfo->devinfo;
+	struct sense_iu *sense = cmdinfo->sense;
+	struct scsi_cmnd *cmnd;
+	unsigned long flags;
+	int kill = 0;
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	cmdinfo->state &= ~UAS_STAT_INFLIGHT;
+
+	if (urb->status) {
+		uas_set_host_status(cmdinfo, DID_ERROR);
+		kill = 1;
+	} else if (be16_to_cpu(sense->tag) != cmdinfo->tag) {
+		uas_set_host_status(cmdinfo, DID_ERROR);
+		kill = 1;
+	} else if (sense->iu_id == IU_ID_STATUS && cmdinfo->cmnd) {
+		unsigned int len = be16_to_cpu(sense->len);
+
+		if (len > SCSI_SENSE_BUFFERSIZE)
+			len = SCSI_SENSE_BUFFERSIZE;
+		if (len)
+			memcpy(cmdinfo->cmnd->sense_buffer, sense->sense, len);
+		cmdinfo->scsi_status = sense->status;
+		cmdinfo->state |= UAS_GOT_STATUS;
+	} else {
+		/*
+		 * A response IU for a command means the device rejected it
+		 * (bad IU, incorrect LUN, overlapped tag).
+		 */
+		uas_set_host_status(cmdinfo, DID_ERROR);
+		kill = 1;
+	}
+
+	cmnd = uas_cmd_finished(devinfo, cmdinfo);
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+
+	if (kill && !cmnd)
+		usb_unlink_urb(cmdinfo->data_urb);
+
+	if (cmnd)
+		cmnd->scsi_done(cmnd);
+}
+
+static void uas_data_cmplt(struct urb *urb)
+{
+	struct uas_cmd_info *cmdinfo = urb->context;
+	struct uas_dev_info *devinfo = cmdinfo->devinfo;
+	struct scsi_cmnd *cmnd;
+	unsigned long flags;
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	cmdinfo->state &= ~UAS_DATA_INFLIGHT;
+	if (cmdinfo->cmnd)
+		cmdinfo->cmnd->resid = urb->transfer_buffer_length -
+				urb->actual_length;
+	if (urb->status)
+		uas_set_host_status(cmdinfo, DID_ERROR);
+	cmnd = uas_cmd_finished(devinfo, cmdinfo);
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+
+	if (cmnd)
+		cmnd->scsi_done(cmnd);
+}
+
+/***********************************************************************
+ * Command submission
+ ***********************************************************************/
+
+static void uas_prep_urbs(struct uas_dev_info *devinfo,
+		struct uas_cmd_info *cmdinfo, struct scsi_cmnd *cmnd)
+{
+	struct command_iu *iu = cmdinfo->iu;
+
+	memset(iu, 0, sizeof(*iu));
+	iu->iu_id = IU_ID_COMMAND;
+	iu->tag = cpu_to_be16(cmdinfo->tag);
+	iu->prio_attr = UAS_SIMPLE_TAG;
+	int_to_scsilun(cmnd->device->lun, &iu->lun);
+	memcpy(iu->cdb, cmnd->cmnd, cmnd->cmd_len);
+
+	usb_fill_bulk_urb(cmdinfo->cmd_urb, devinfo->udev, devinfo->cmd_pipe,
+			iu, sizeof(*iu), uas_cmd_cmplt, cmdinfo);
+	cmdinfo->cmd_urb->transfer_flags = 0;
+
+	usb_fill_bulk_urb(cmdinfo->stat_urb, devinfo->udev,
+			devinfo->status_pipe, cmdinfo->sense,
+			sizeof(*cmdinfo->sense), uas_stat_cmplt, cmdinfo);
+	cmdinfo->stat_urb->transfer_flags = 0;
+	cmdinfo->stat_urb->stream_id = cmdinfo->tag;
+
+	if (!scsi_bufflen(cmnd))
+		return;
+
+	/* Let the HCD map the midlayer's scatterlist directly */
+	usb_fill_bulk_urb(cmdinfo->data_urb, devinfo->udev,
+			cmnd->sc_data_direction == DMA_FROM_DEVICE ?
+			devinfo->data_in_pipe : devinfo->data_out_pipe,
+			NULL, scsi_bufflen(cmnd), uas_data_cmplt, cmdinfo);
+	cmdinfo->data_urb->transfer_flags = 0;
+	cmdinfo->data_urb->sg = scsi_sglist(cmnd);
+	cmdinfo->data_urb->num_sgs = scsi_sg_count(cmnd);
+	cmdinfo->data_urb->stream_id = cmdinfo->tag;
+}
+
+/*
+ * Submit status, then data, then command so the device never has a
+ * stream to write into before we are listening on it.  On failure the
+ * urbs already submitted are unlinked and the command completes through
+ * the normal path with DID_SOFT_ERROR so the midlayer retries it.
+ */
+static void uas_submit_urbs(struct uas_dev_info *devinfo,
+		struct uas_cmd_info *cmdinfo)
+{
+	struct scsi_cmnd *cmnd;
+	unsigned int failed = 0;
+	unsigned long flags;
+
+	if (usb_submit_urb(cmdinfo->stat_urb, GFP_ATOMIC))
+		failed = UAS_URBS_INFLIGHT;
+	else if ((cmdinfo->state & UAS_DATA_INFLIGHT) &&
+		 usb_submit_urb(cmdinfo->data_urb, GFP_ATOMIC))
+		failed = UAS_DATA_INFLIGHT | UAS_CMD_INFLIGHT;
+	else if (usb_submit_urb(cmdinfo->cmd_urb, GFP_ATOMIC))
+		failed = UAS_CMD_INFLIGHT;
+
+	if (!failed)
+		return;
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	cmdinfo->state &= ~failed;
+	uas_set_host_status(cmdinfo, DID_SOFT_ERROR);
+	cmnd = uas_cmd_finished(devinfo, cmdinfo);
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+
+	if (!cmnd) {
+		usb_unlink_urb(cmdinfo->stat_urb);
+		usb_unlink_urb(cmdinfo->data_urb);
+	} else
+		cmnd->scsi_done(cmnd);
+}
+
+static int uas_queuecommand(struct scsi_cmnd *cmnd,
+		void (*done)(struct scsi_cmnd *))
+{
+	struct uas_dev_info *devinfo = host_to_uas(cmnd->device->host);
+	struct uas_cmd_info *cmdinfo;
+	unsigned long flags;
+	u16 tag;
+
+	if (test_bit(UAS_FLIDX_DISCONNECTING, &devinfo->dflags)) {
+		cmnd->result = DID_NO_CONNECT << 16;
+		done(cmnd);
+		return 0;
+	}
+
+	if (test_bit(UAS_FLIDX_RESETTING, &devinfo->dflags))
+		return SCSI_MLQUEUE_HOST_BUSY;
+
+	if (cmnd->cmd_len > UAS_MAX_CDB_LEN) {
+		cmnd->result = DID_ERROR << 16;
+		done(cmnd);
+		return 0;
+	}
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	tag = uas_alloc_tag(devinfo);
+	if (!tag) {
+		devinfo->stats.busy++;
+		spin_unlock_irqrestore(&devinfo->lock, flags);
+		return SCSI_MLQUEUE_HOST_BUSY;
+	}
+
+	cmdinfo = &devinfo->cmds[tag];
+	cmdinfo->cmnd = cmnd;
+	cmdinfo->host_status = DID_OK;
+	cmdinfo->scsi_status = SAM_STAT_GOOD;
+	cmdinfo->state = UAS_CMD_INFLIGHT | UAS_STAT_INFLIGHT;
+	if (scsi_bufflen(cmnd))
+		cmdinfo->state |= UAS_DATA_INFLIGHT;
+	if (unlikely(scsi_dump_active(cmnd))) {
+		cmdinfo->state |= UAS_CMD_DUMP;
+		init_completion(&cmdinfo->dump_done);
+	}
+
+	cmnd->scsi_done = done;
+	cmnd->host_scribble = (unsigned char *) cmdinfo;
+	cmnd->resid = 0;
+
+	devinfo->stats.cmds++;
+	if (++devinfo->outstanding > devinfo->stats.peak)
+		devinfo->stats.peak = devinfo->outstanding;
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+
+	uas_prep_urbs(devinfo, cmdinfo, cmnd);
+	uas_submit_urbs(devinfo, cmdinfo);
+
+	/*
+	 * While dumping, interrupts are off; poll the HCD until the status
+	 * urb (always the last of the three to complete on a healthy
+	 * device) has come back.
+	 */
+	if (unlikely(scsi_dump_active(cmnd)))
+		wait_for_urb_completion(cmdinfo->stat_urb, &cmdinfo->dump_done);
+
+	return 0;
+}
+
+/***********************************************************************
+ * Error handling
+ ***********************************************************************/
+
+/*
+ * Give back the tag of an aborted command once the device no longer owns
+ * the task and its urbs have all completed.  Called with devinfo->lock
+ * held.
+ */
+static void uas_release_aborted(struct uas_dev_info *devinfo,
+		struct uas_cmd_info *cmdinfo)
+{
+	if (!(cmdinfo->state & UAS_CMD_ABORTING))
+		return;
+
+	cmdinfo->state &= ~UAS_CMD_ABORTING;
+	if (!cmdinfo->cmnd)
+		devinfo->tag_map &= ~(1U << (cmdinfo->tag - 1));
+}
+
+/*
+ * Kill every urb of every outstanding command.  The device is being
+ * reset or is gone, so it owns no tasks afterwards.  Process context
+ * only.
+ */
+static void uas_kill_all(struct uas_dev_info *devinfo,
+		unsigned char host_status)
+{
+	unsigned long flags;
+	unsigned int tag;
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	for (tag = 1; tag <= devinfo->qdepth; tag++)
+		if (devinfo->cmds[tag].cmnd)
+			uas_set_host_status(&devinfo->cmds[tag], host_status);
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+
+	usb_kill_urb(devinfo->tmf_urb);
+	usb_kill_urb(devinfo->tmf_stat_urb);
+	for (tag = 1; tag <= devinfo->qdepth; tag++) {
+		usb_kill_urb(devinfo->cmds[tag].cmd_urb);
+		usb_kill_urb(devinfo->cmds[tag].data_urb);
+		usb_kill_urb(devinfo->cmds[tag].stat_urb);
+	}
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	for (tag = 1; tag <= devinfo->qdepth; tag++)
+		uas_release_aborted(devinfo, &devinfo->cmds[tag]);
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+}
+
+static void uas_tmf_cmplt(struct urb *urb)
+{
+	struct uas_dev_info *devinfo = urb->context;
+
+	/* The device never saw the TMF, so no response will come */
+	if (urb->status)
+		usb_unlink_urb(devinfo->tmf_stat_urb);
+}
+
+static void uas_tmf_stat_cmplt(struct urb *urb)
+{
+	struct uas_dev_info *devinfo = urb->context;
+
+	complete(&devinfo->tmf_done);
+}
+
+/*
+ * Send task management @function for @task_tag on the command pipe and
+ * wait for the response IU on the reserved stream.  Returns 0 if the
+ * device completed the function.  The midlayer runs one error handler
+ * at a time per host, so the TMF urbs are never shared.
+ */
+static int uas_task_mgmt(struct uas_dev_info *devinfo,
+		struct scsi_device *sdev, u8 function, u16 task_tag)
+{
+	struct task_mgmt_iu *iu = devinfo->tmf_iu;
+	struct response_iu *resp = (struct response_iu *) devinfo->tmf_resp;
+
+	memset(iu, 0, sizeof(*iu));
+	iu->iu_id = IU_ID_TASK_MGMT;
+	iu->tag = cpu_to_be16(devinfo->tmf_tag);
+	iu->function = function;
+	iu->task_tag = cpu_to_be16(task_tag);
+	int_to_scsilun(sdev->lun, &iu->lun);
+	memset(resp, 0, sizeof(*devinfo->tmf_resp));
+
+	usb_fill_bulk_urb(devinfo->tmf_urb, devinfo->udev, devinfo->cmd_pipe,
+			iu, sizeof(*iu), uas_tmf_cmplt, devinfo);
+	devinfo->tmf_urb->transfer_flags = 0;
+
+	usb_fill_bulk_urb(devinfo->tmf_stat_urb, devinfo->udev,
+			devinfo->status_pipe, devinfo->tmf_resp,
+			sizeof(*devinfo->tmf_resp), uas_tmf_stat_cmplt, devinfo);
+	devinfo->tmf_stat_urb->transfer_flags = 0;
+	devinfo->tmf_stat_urb->stream_id = devinfo->tmf_tag;
+
+	init_completion(&devinfo->tmf_done);
+
+	/* Listen on the stream before the device can answer on it */
+	if (usb_submit_urb(devinfo->tmf_stat_urb, GFP_NOIO))
+		return -EIO;
+	if (usb_submit_urb(devinfo->tmf_urb, GFP_NOIO)) {
+		usb_kill_urb(devinfo->tmf_stat_urb);
+		return -EIO;
+	}
+
+	if (!wait_for_completion_timeout(&devinfo->tmf_done,
+			UAS_TMF_TIMEOUT)) {
+		usb_kill_urb(devinfo->tmf_urb);
+		usb_kill_urb(devinfo->tmf_stat_urb);
+		return -ETIMEDOUT;
+	}
+	usb_kill_urb(devinfo->tmf_urb);
+
+	if (devinfo->tmf_stat_urb->status ||
+	    resp->iu_id != IU_ID_RESPONSE ||
+	    be16_to_cpu(resp->tag) != devinfo->tmf_tag)
+		return -EIO;
+
+	switch (resp->response_code) {
+	case RC_TMF_COMPLETE:
+	case RC_TMF_SUCCEEDED:
+		return 0;
+	default:
+		dev_warn(&devinfo->intf->dev,
+				"TMF 0x%02x for tag %u: response 0x%02x\n",
+				function, task_tag, resp->response_code);
+		return -EIO;
+	}
+}
+
+/*
+ * Abort a command with ABORT TASK.  Its tag stays allocated until the
+ * device has answered, so the stream can't be handed to a new command
+ * while the device may still be working on the old one.  If the device
+ * doesn't answer, the tag stays held and FAILED escalates to a reset,
+ * whose pre_reset gives every tag back.
+ */
+static int uas_eh_abort_handler(struct scsi_cmnd *cmnd)
+{
+	struct uas_dev_info *devinfo = host_to_uas(cmnd->device->host);
+	struct uas_cmd_info *cmdinfo;
+	unsigned long flags;
+	int result;
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	cmdinfo = (struct uas_cmd_info *) cmnd->host_scribble;
+	if (!cmdinfo || cmdinfo->cmnd != cmnd) {
+		spin_unlock_irqrestore(&devinfo->lock, flags);
+		return FAILED;
+	}
+
+	/* From here on the completion handlers will not call scsi_done */
+	cmdinfo->state |= UAS_CMD_ABORTED | UAS_CMD_ABORTING;
+	cmdinfo->host_status = DID_ABORT;
+	devinfo->stats.aborts++;
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+
+	dev_warn(&devinfo->intf->dev, "abort tag %u cmd 0x%02x\n",
+			cmdinfo->tag, cmnd->cmnd[0]);
+
+	if (test_bit(UAS_FLIDX_DISCONNECTING, &devinfo->dflags))
+		result = -ENODEV;
+	else
+		result = uas_task_mgmt(devinfo, cmnd->device,
+				TMF_ABORT_TASK, cmdinfo->tag);
+	if (result) {
+		dev_warn(&devinfo->intf->dev, "abort tag %u failed (%d)\n",
+				cmdinfo->tag, result);
+		devinfo->stats.abort_failures++;
+		return FAILED;
+	}
+
+	/* The device dropped the task; nothing more comes on its stream */
+	usb_kill_urb(cmdinfo->cmd_urb);
+	usb_kill_urb(cmdinfo->data_urb);
+	usb_kill_urb(cmdinfo->stat_urb);
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	uas_release_aborted(devinfo, cmdinfo);
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+
+	return SUCCESS;
+}
+
+/*
+ * UAS has no lighter reset than a port reset that we can rely on across
+ * bridges, so device and bus resets both reset the port.  pre_reset
+ * fails whatever is outstanding and post_reset restores the streams.
+ */
+static int uas_eh_reset(struct scsi_cmnd *cmnd)
+{
+	struct uas_dev_info *devinfo = host_to_uas(cmnd->device->host);
+	struct usb_device *udev = devinfo->udev;
+	int result;
+
+	if (udev->quirks & USB_QUIRK_RESET_MORPHS)
+		return FAILED;
+
+	dev_warn(&devinfo->intf->dev, "resetting device\n");
+	devinfo->stats.resets++;
+
+	result = usb_lock_device_for_reset(udev, devinfo->intf);
+	if (result < 0)
+		return FAILED;
+
+	if (test_bit(UAS_FLIDX_DISCONNECTING, &devinfo->dflags))
+		result = -EIO;
+	else
+		result = usb_reset_device(udev);
+	usb_unlock_device(udev);
+
+	return result < 0 ? FAILED : SUCCESS;
+}
+
+/***********************************************************************
+ * Host template
+ ***********************************************************************/
+
+static int uas_slave_configure(struct scsi_device *sdev)
+{
+	struct uas_dev_info *devinfo = host_to_uas(sdev->host);
+
+	scsi_adjust_queue_depth(sdev, MSG_SIMPLE_TAG, devinfo->qdepth);
+	return 0;
+}
+
+#undef SPRINTF
+#define SPRINTF(args...) \
+	do { if (pos < buffer+length) pos += sprintf(pos, ## args); } while (0)
+
+static int uas_proc_info(struct Scsi_Host *host, char *buffer,
+		char **start, off_t offset, int length, int inout)
+{
+	struct uas_dev_info *devinfo = host_to_uas(host);
+	struct uas_stats stats;
+	char *pos = buffer;
+	unsigned int outstanding;
+	unsigned long flags;
+
+	/* if someone is sending us data, just throw it away */
+	if (inout)
+		return length;
+
+	if (test_bit(UAS_FLIDX_DISCONNECTING, &devinfo->dflags) ||
+	    (host->shost_state == SHOST_DEL))
+		return 0;
+
+	spin_lock_irqsave(&devinfo->lock, flags);
+	stats = devinfo->stats;
+	outstanding = devinfo->outstanding;
+	spin_unlock_irqrestore(&devinfo->lock, flags);
+
+	SPRINTF("   Host scsi%d: uas\n", host->host_no);
+	SPRINTF("       Vendor: %s\n", devinfo->udev->manufacturer ?
+			devinfo->udev->manufacturer : "Unknown");
+	SPRINTF("      Product: %s\n", devinfo->udev->product ?
+			devinfo->udev->product : "Unknown");
+	SPRINTF("Serial Number: %s\n", devinfo->udev->serial ?
+			devinfo->udev->serial : "None");
+	SPRINTF("    Transport: USB Attached SCSI\n");
+	SPRINTF("      Streams: %u\n", devinfo->qdepth);
+	SPRINTF("     Commands: %llu\n", (unsigned long long) stats.cmds);
+	SPRINTF("  Outstanding: %u (peak %u)\n", outstanding, stats.peak);
+	SPRINTF("    Tags busy: %llu\n", (unsigned long long) stats.busy);
+	SPRINTF("       Errors: %llu\n", (unsigned long long) stats.errors);
+	SPRINTF("       Aborts: %llu (%llu failed)\n",
+			(unsigned long long) stats.aborts,
+			(unsigned long long) stats.abort_failures);
+	SPRINTF("       Resets: %llu\n", (unsigned long long) stats.resets);
+
+	/*
+	 * Calculate start of next buffer, and return value.
+	 */
+	*start = buffer + offset;
+
+	if ((pos - buffer) < offset)
+		return (0);
+	else if ((pos - buffer - offset) < length)
+		return (pos - buffer - offset);
+	else
+		return (length);
+}
+
+static struct scsi_host_template uas_host_template = {
+	.name =				"uas",
+	.proc_name =			"uas",
+	.proc_info =			uas_proc_info,
+	.queuecommand =			uas_queuecommand,
+	.eh_abort_handler =		uas_eh_abort_handler,
+	.eh_device_reset_handler =	uas_eh_reset,
+	.eh_bus_reset_handler =		uas_eh_reset,
+	.slave_configure =		uas_slave_configure,
+	.can_queue =			UAS_MAX_STREAMS,
+	.cmd_per_lun =			UAS_MAX_STREAMS,
+	.this_id =			-1,
+	.sg_tablesize =			SG_ALL,
+	.max_sectors =			240,
+	.use_clustering =		1,
+	.emulated =			1,
+	.skip_settle_delay =		1,
+	.module =			THIS_MODULE
+};
+
+/***********************************************************************
+ * Resource management
+ ***********************************************************************/
+
+static int uas_find_endpoints(struct uas_dev_info *devinfo)
+{
+	struct usb_host_interface *alt = devinfo->intf->cur_altsetting;
+	struct usb_device *udev = devinfo->udev;
+	struct usb_host_endpoint **eps = devinfo->eps;
+	int i, pipe_id;
+
+	memset(devinfo->eps, 0, sizeof(devinfo->eps));
+	for (i = 0; i < alt->desc.bNumEndpoints; i++) {
+		pipe_id = uas_pipe_id(&alt->endpoint[i]);
+		if (pipe_id < CMD_PIPE_ID || pipe_id > DATA_OUT_PIPE_ID)
+			continue;
+		if (!usb_endpoint_xfer_bulk(&alt->endpoint[i].desc))
+			return -ENODEV;
+		eps[pipe_id - 1] = &alt->endpoint[i];
+	}
+
+	for (i = 0; i < DATA_OUT_PIPE_ID; i++)
+		if (!eps[i])
+			return -ENODEV;
+
+	devinfo->cmd_pipe = usb_sndbulkpipe(udev,
+			usb_endpoint_num(&eps[CMD_PIPE_ID - 1]->desc));
+	devinfo->status_pipe = usb_rcvbulkpipe(udev,
+			usb_endpoint_num(&eps[STATUS_PIPE_ID - 1]->desc));
+	devinfo->data_in_pipe = usb_rcvbulkpipe(udev,
+			usb_endpoint_num(&eps[DATA_IN_PIPE_ID - 1]->desc));
+	devinfo->data_out_pipe = usb_sndbulkpipe(udev,
+			usb_endpoint_num(&eps[DATA_OUT_PIPE_ID - 1]->desc));
+	return 0;
+}
+
+/* Allocate streams on the status and both data pipes */
+static int uas_alloc_streams(struct uas_dev_info *devinfo)
+{
+	int streams;
+
+	streams = usb_alloc_streams(devinfo->intf,
+			&devinfo->eps[STATUS_PIPE_ID - 1], 3,
+			UAS_MAX_STREAMS + 1, GFP_NOIO);
+	if (streams <= 0)
+		return streams < 0 ? streams : -ENODEV;
+
+	return min(streams, UAS_MAX_STREAMS);
+}
+
+static void uas_free_streams(struct uas_dev_info *devinfo)
+{
+	usb_free_streams(devinfo->intf, &devinfo->eps[STATUS_PIPE_ID - 1], 3,
+			GFP_NOIO);
+}
+
+static void uas_free_cmds(struct uas_dev_info *devinfo)
+{
+	unsigned int tag;
+
+	for (tag = 1; tag <= UAS_MAX_STREAMS; tag++) {
+		struct uas_cmd_info *cmdinfo = &devinfo->cmds[tag];
+
+		usb_free_urb(cmdinfo->cmd_urb);
+		usb_free_urb(cmdinfo->stat_urb);
+		usb_free_urb(cmdinfo->data_urb);
+		kfree(cmdinfo->iu);
+		kfree(cmdinfo->sense);
+	}
+
+	usb_free_urb(devinfo->tmf_urb);
+	usb_free_urb(devinfo->tmf_stat_urb);
+	kfree(devinfo->tmf_iu);
+	kfree(devinfo->tmf_resp);
+}
+
+/*
+ * Preallocate the urbs and IU buffers of every tag so the I/O path never
+ * allocates.  Tags are bound to stream ids for the life of the device.
+ */
+static int uas_alloc_cmds(struct uas_dev_info *devinfo)
+{
+	unsigned int tag;
+
+	for (tag = 1; tag <= devinfo->qdepth; tag++) {
+		struct uas_cmd_info *cmdinfo = &devinfo->cmds[tag];
+
+		cmdinfo->devinfo = devinfo;
+		cmdinfo->tag = tag;
+		cmdinfo->cmd_urb = usb_alloc_urb(0, GFP_KERNEL);
+		cmdinfo->stat_urb = usb_alloc_urb(0, GFP_KERNEL);
+		cmdinfo->data_urb = usb_alloc_urb(0, GFP_KERNEL);
+		cmdinfo->iu = kzalloc(sizeof(*cmdinfo->iu), GFP_KERNEL);
+		cmdinfo->sense = kzalloc(sizeof(*cmdinfo->sense), GFP_KERNEL);
+		if (!cmdinfo->cmd_urb || !cmdinfo->stat_urb ||
+		    !cmdinfo->data_urb || !cmdinfo->iu || !cmdinfo->sense)
+			return -ENOMEM;
+	}
+
+	devinfo->tmf_urb = usb_alloc_urb(0, GFP_KERNEL);
+	devinfo->tmf_stat_urb = usb_alloc_urb(0, GFP_KERNEL);
+	devinfo->tmf_iu = kzalloc(sizeof(*devinfo->tmf_iu), GFP_KERNEL);
+	devinfo->tmf_resp = kzalloc(sizeof(*devinfo->tmf_resp), GFP_KERNEL);
+	if (!devinfo->tmf_urb || !devinfo->tmf_stat_urb ||
+	    !devinfo->tmf_iu || !devinfo->tmf_resp)
+		return -ENOMEM;
+
+	return 0;
+}
+
+static void uas_unclaim(struct work_struct *work)
+{
+	struct uas_dev_info *devinfo =
+		container_of(work, struct uas_dev_info, unclaim_work);
+	struct usb_interface *intf = devinfo->intf;
+	const char *name = vmklnx_get_vmhba_name(devinfo->shost);
+
+	dev_info(&intf->dev, "unclaiming %s\n", name ? name : "");
+	usb_lock_device(devinfo->udev);
+	if (intf->dev.driver)
+		usb_driver_release_interface(to_usb_driver(intf->dev.driver),
+				intf);
+	usb_unlock_device(devinfo->udev);
+
+	usb_put_intf(intf);
+	usb_put_dev(devinfo->udev);
+	scsi_host_put(devinfo->shost);
+}
+
+/***********************************************************************
+ * USB driver entry points, dispatched from usb.c
+ ***********************************************************************/
+
+int uas_probe(struct usb_interface *intf, const struct usb_device_id *id)
+{
+	struct usb_device *udev = interface_to_usbdev(intf);
+	int ifnum = intf->cur_altsetting->desc.bInterfaceNumber;
+	struct uas_dev_info *devinfo;
+	struct Scsi_Host *shost;
+	int alt, result;
+
+	alt = uas_find_uas_alt_setting(intf);
+	if (alt < 0)
+		return alt;
+
+	result = usb_set_interface(udev, ifnum, alt);
+	if (result)
+		return result;
+
+	shost = scsi_host_alloc(&uas_host_template, sizeof(*devinfo));
+	if (!shost) {
+		result = -ENOMEM;
+		goto set_alt0;
+	}
+
+	devinfo = host_to_uas(shost);
+	memset(devinfo, 0, sizeof(*devinfo));
+	devinfo->intf = intf;
+	devinfo->udev = udev;
+	devinfo->shost = shost;
+	spin_lock_init(&devinfo->lock);
+	INIT_WORK(&devinfo->unclaim_work, uas_unclaim);
+
+	result = uas_find_endpoints(devinfo);
+	if (result)
+		goto free_host;
+
+	result = uas_alloc_streams(devinfo);
+	if (result < 0)
+		goto free_host;
+	/* One stream for commands, plus the one reserved for TMFs */
+	if (result < 2) {
+		result = -ENODEV;
+		goto free_streams;
+	}
+	devinfo->qdepth = result - 1;
+	devinfo->tmf_tag = result;
+
+	result = uas_alloc_cmds(devinfo);
+	if (result)
+		goto free_streams;
+
+	shost->can_queue = devinfo->qdepth;
+	shost->cmd_per_lun = devinfo->qdepth;
+	shost->max_cmd_len = UAS_MAX_CDB_LEN;
+	shost->max_id = 1;
+	shost->max_lun = 1;
+	/* Same SG constraint as Bulk-Only; see usb_stor_probe2() */
+	shost->sg_elem_size_mult = 512;
+	shost->xportFlags = VMKLNX_SCSI_TRANSPORT_TYPE_USB;
+
+	usb_set_intfdata(intf, devinfo);
+	result = scsi_add_host(shost, &intf->dev);
+	if (result)
+		goto clear_intfdata;
+
+	dev_info(&intf->dev, "UAS device using %u streams\n", devinfo->qdepth);
+	scsi_scan_host(shost);
+	return 0;
+
+clear_intfdata:
+	usb_set_intfdata(intf, NULL);
+free_streams:
+	uas_free_streams(devinfo);
+free_host:
+	uas_free_cmds(devinfo);
+	scsi_host_put(shost);
+set_alt0:
+	usb_set_interface(udev, ifnum, 0);
+	return result;
+}
+
+void uas_disconnect(struct usb_interface *intf)
+{
+	struct uas_dev_info *devinfo = usb_get_intfdata(intf);
+	struct Scsi_Host *shost = devinfo->shost;
+
+	/*
+	 * If the device is really gone, fail what is outstanding before
+	 * removing the host, which would otherwise wait for the midlayer
+	 * to time those commands out.  Same order as
+	 * quiesce_and_remove_host() in usb.c.
+	 */
+	if (devinfo->udev->state == USB_STATE_NOTATTACHED) {
+		set_bit(UAS_FLIDX_DISCONNECTING, &devinfo->dflags);
+		uas_kill_all(devinfo, DID_NO_CONNECT);
+	}
+
+	/*
+	 * Removing the host will perform an orderly shutdown: caches
+	 * synchronized, disks spun down, etc.
+	 */
+	scsi_remove_host(shost);
+
+	set_bit(UAS_FLIDX_DISCONNECTING, &devinfo->dflags);
+	uas_kill_all(devinfo, DID_NO_CONNECT);
+	uas_free_streams(devinfo);
+	uas_free_cmds(devinfo);
+	usb_set_intfdata(intf, NULL);
+	scsi_host_put(shost);
+}
+
+int uas_pre_reset(struct usb_interface *intf)
+{
+	struct uas_dev_info *devinfo = usb_get_intfdata(intf);
+
+	set_bit(UAS_FLIDX_RESETTING, &devinfo->dflags);
+	uas_kill_all(devinfo, DID_RESET);
+	uas_free_streams(devinfo);
+	return 0;
+}
+
+int uas_post_reset(struct usb_interface *intf)
+{
+	struct uas_dev_info *devinfo = usb_get_intfdata(intf);
+	struct Scsi_Host *shost = devinfo->shost;
+	int streams;
+
+	/* The tags are already bound; the device must give them all back */
+	streams = uas_alloc_streams(devinfo);
+	if (streams < (int) devinfo->tmf_tag) {
+		dev_warn(&intf->dev, "lost streams across reset (%d)\n",
+				streams);
+		if (streams > 0)
+			uas_free_streams(devinfo);
+		/* Ask the USB core to rebind us */
+		return 1;
+	}
+
+	clear_bit(UAS_FLIDX_RESETTING, &devinfo->dflags);
+
+	scsi_lock(shost);
+	scsi_report_bus_reset(shost, 0);
+	scsi_unlock(shost);
+	return 0;
+}
+
+int uas_ioctl(struct usb_interface *intf, unsigned int code, void *buf)
+{
+	struct uas_dev_info *devinfo = usb_get_intfdata(intf);
+	const char *name;
+
+	if (code != USBPASSTHROUGH_UNCLAIM)
+		return 0;
+
+	name = vmklnx_get_vmhba_name(devinfo->shost);
+	if (name && buf && !strncmp(name, buf, VMK_MISC_NAME_MAX))
+		return 0;
+
+	if (!scsi_host_get(devinfo->shost))
+		return -EIO;
+	usb_get_dev(devinfo->udev);
+	usb_get_intf(intf);
+	if (schedule_work(&devinfo->unclaim_work))
+		return 0;
+
+	usb_put_intf(intf);
+	usb_put_dev(devinfo->udev);
+	scsi_host_put(devinfo->shost);
+	return -EIO;
+}
+#endif /* __VMKLNX__ */
@@ -0,0 +1,38 @@
+/*
+ * Portions Copyright 2013 VMware, Inc.
+ */
+/* Driver for USB Attached SCSI devices - Header File
+ *
+ * UAS devices are driven by uas.c whenever the device exposes a UAS
+ * alternate setting, is connected at SuperSpeed and the host controller
+ * can allocate bulk streams.  Everything else stays on the Bulk-Only
+ * transport in usb.c.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ */
+
+#ifndef _UAS_H_
+#define _UAS_H_
+
+#if defined(__VMKLNX__)
+extern int uas_use_uas_driver(struct usb_interface *intf,
+		const struct usb_device_id *id);
+extern int uas_probe(struct usb_interface *intf,
+		const struct usb_device_id *id);
+extern void uas_disconnect(struct usb_interface *intf);
+extern int uas_pre_reset(struct usb_interface *intf);
+extern int uas_post_reset(struct usb_interface *intf);
+extern int uas_ioctl(struct usb_interface *intf, unsigned int code,
+		void *buf);
+
+/* True if @intf is currently bound through the UAS transport */
+static inline int uas_intf_is_uas(struct usb_interface *intf)
+{
+	return intf->cur_altsetting->desc.bInterfaceProtocol == USB_PR_UAS;
+}
+#endif /* __VMKLNX__ */
+
+#endif
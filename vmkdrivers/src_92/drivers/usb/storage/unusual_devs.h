@@ -2130,3 +2130,8 @@ USUAL_DEV(USB_SC_QIC, USB_PR_BULK, USB_US_TYPE_STOR),
 USUAL_DEV(USB_SC_UFI, USB_PR_BULK, USB_US_TYPE_STOR),
 USUAL_DEV(USB_SC_8070, USB_PR_BULK, USB_US_TYPE_STOR),
 USUAL_DEV(USB_SC_SCSI, USB_PR_BULK, 0),
+
+#if defined(__VMKLNX__)
+/* USB Attached SCSI, for devices whose only setting is UAS; see uas.c */
+USUAL_DEV(USB_SC_SCSI, USB_PR_UAS, 0),
+#endif
@@ -85,6 +85,7 @@
 
 #if defined(__VMKLNX__)
 #include "vmklinux_92/vmklinux_scsi.h"
+#include "uas.h"
 #endif
 
 /* Some informational data */
@@ -990,6 +991,16 @@ static int usb_stor_acquire_resources(struct us_data *us)
 		return -ENOMEM;
 	}
 
+#if defined(__VMKLNX__)
+	us->data_urb = usb_alloc_urb(0, GFP_KERNEL);
+	us->csw_urb = usb_alloc_urb(0, GFP_KERNEL);
+	if (!us->data_urb || !us->csw_urb) {
+		US_DEBUGP("URB allocation failed\n");
+		return -ENOMEM;
+	}
+	init_usb_anchor(&us->pipe_anchor);
+#endif
+
 	/* Just before we start our control thread, initialize
 	 * the device if it needs initialization */
 	if (us->unusual_dev->initFunction) {
@@ -1033,6 +1044,10 @@ static void usb_stor_release_resources(struct us_data *us)
 	/* Free the extra data and the URB */
 	kfree(us->extra);
 	usb_free_urb(us->current_urb);
+#if defined(__VMKLNX__)
+	usb_free_urb(us->data_urb);
+	usb_free_urb(us->csw_urb);
+#endif
 }
 
 /* Dissociate from the USB device */
@@ -1375,6 +1390,21 @@ static int storage_probe(struct usb_interface *intf,
 			usb_usual_ignore_device(intf))
 		return -ENXIO;
 
+#if defined(__VMKLNX__)
+	/*
+	 * SuperSpeed devices with a UAS alternate setting behind a host
+	 * controller that supports streams are driven by UAS.  If that
+	 * fails for any reason, carry on with Bulk-Only.
+	 */
+	if (uas_use_uas_driver(intf, id)) {
+		result = uas_probe(intf, id);
+		if (!result)
+			return 0;
+		dev_warn(&intf->dev, "UAS setup failed (%d), "
+				"falling back to Bulk-Only\n", result);
+	}
+#endif
+
 	/*
 	 * Call the general probe procedures.
 	 *
@@ -1429,14 +1459,15 @@ host:
 	return -EIO;
 }
 
-#define USBPASSTHROUGH_UNCLAIM _IOW('P', 0, char[VMK_MISC_NAME_MAX])
-
 static int storage_ioctl(struct usb_interface *intf, unsigned int code, void *buf)
 {
 	struct us_data *us = usb_get_intfdata(intf);
 	const char *name;
 	int rc = 0;
 
+	if (uas_intf_is_uas(intf))
+		return uas_ioctl(intf, code, buf);
+
 	switch (code) {
 	case USBPASSTHROUGH_UNCLAIM:
 		if (us->fflags & US_FL_VMKLNX_NO_UNCLAIM)
@@ -1451,6 +1482,32 @@ static int storage_ioctl(struct usb_interface *intf, unsigned int code, void *bu
 
 	return rc;
 }
+
+/*
+ * An interface is bound either through UAS or through the usb-storage
+ * core; the current alternate setting tells which one owns intfdata.
+ */
+static void storage_disconnect(struct usb_interface *intf)
+{
+	if (uas_intf_is_uas(intf))
+		uas_disconnect(intf);
+	else
+		usb_stor_disconnect(intf);
+}
+
+static int storage_pre_reset(struct usb_interface *intf)
+{
+	if (uas_intf_is_uas(intf))
+		return uas_pre_reset(intf);
+	return usb_stor_pre_reset(intf);
+}
+
+static int storage_post_reset(struct usb_interface *intf)
+{
+	if (uas_intf_is_uas(intf))
+		return uas_post_reset(intf);
+	return usb_stor_post_reset(intf);
+}
 #endif
 
 /***********************************************************************
@@ -1460,12 +1517,21 @@ static int storage_ioctl(struct usb_interface *intf, unsigned int code, void *bu
 static struct usb_driver usb_storage_driver = {
 	.name =		"usb-storage",
 	.probe =	storage_probe,
+#if defined(__VMKLNX__)
+	.disconnect =	storage_disconnect,
+#else
 	.disconnect =	usb_stor_disconnect,
+#endif
 	.suspend =	usb_stor_suspend,
 	.resume =	usb_stor_resume,
 	.reset_resume =	usb_stor_reset_resume,
+#if defined(__VMKLNX__)
+	.pre_reset =	storage_pre_reset,
+	.post_reset =	storage_post_reset,
+#else
 	.pre_reset =	usb_stor_pre_reset,
 	.post_reset =	usb_stor_post_reset,
+#endif
 	.id_table =	usb_storage_usb_ids,
 	.supports_autosuspend = 1,
 	.soft_unbind =	1,
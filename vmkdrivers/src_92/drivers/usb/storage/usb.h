@@ -82,6 +82,9 @@ struct us_unusual_dev {
 #define US_FLIDX_SCAN_PENDING	6	/* scanning not yet done    */
 #define US_FLIDX_REDO_READ10	7	/* redo READ(10) command    */
 #define US_FLIDX_READ10_WORKED	8	/* previous READ(10) succeeded */
+#if defined(__VMKLNX__)
+#define US_FLIDX_PIPE_ACTIVE	9	/* pipelined Bulk-Only urbs in use */
+#endif
 
 #define USB_STOR_STRING_LEN 32
 
@@ -156,6 +159,15 @@ struct us_data {
 	u8			devtype;
 	struct work_struct	unclaim_work;
 	u8			unclaim_rq;
+
+	/* pipelined Bulk-Only commands; see usb_stor_Bulk_pipeline() */
+	struct urb		*data_urb;	 /* data stage          */
+	struct urb		*csw_urb;	 /* status stage        */
+	struct usb_anchor	pipe_anchor;	 /* all three stages    */
+	atomic_t		pipe_pending;	 /* stages not yet done */
+	struct completion	pipe_done;
+	unsigned long		pipe_cmds;	 /* commands pipelined  */
+	unsigned long		pipe_fallbacks;	 /* ... needing recovery */
 #endif /* defined(__VMKLNX__) */
 	struct task_struct	*ctl_thread;	 /* the control thread   */
 
@@ -230,4 +242,9 @@ extern int usb_stor_probe1(struct us_data **pus,
 extern int usb_stor_probe2(struct us_data *us);
 extern void usb_stor_disconnect(struct usb_interface *intf);
 
+#if defined(__VMKLNX__)
+/* Passthrough request asking us to give up the interface */
+#define USBPASSTHROUGH_UNCLAIM _IOW('P', 0, char[VMK_MISC_NAME_MAX])
+#endif
+
 #endif
@@ -66,6 +66,7 @@ enum {
 #if defined(__VMKLNX__)
 	ATA_ID_SECTOR_SIZE      = 106,
 	ATA_ID_DATA_SET_MGMT    = 169,
+	ATA_ID_SATA_CAPABILITY_2 = 77,
 #endif
 	ATA_ID_PIO4		= (1 << 1),
 
@@ -204,10 +205,21 @@ enum {
 #if defined(__VMKLNX__)
 	ATA_CMD_SMART		= 0xB0,
 	ATA_CMD_DSM		= 0x06,
+	ATA_CMD_FPDMA_SEND	= 0x64,
+
+	/* SEND FPDMA QUEUED subcommands */
+	ATA_SUBCMD_FPDMA_SEND_DSM = 0x00,
 #endif
 
 	/* READ_LOG_EXT pages */
 	ATA_LOG_SATA_NCQ	= 0x10,
+#if defined(__VMKLNX__)
+	ATA_LOG_NCQ_SEND_RECV	= 0x13,
+	ATA_LOG_NCQ_SEND_RECV_SUBCMDS_OFFSET = 0x00,
+	ATA_LOG_NCQ_SEND_RECV_SUBCMDS_DSM = (1 << 0),
+	ATA_LOG_NCQ_SEND_RECV_DSM_OFFSET = 0x04,
+	ATA_LOG_NCQ_SEND_RECV_DSM_TRIM = (1 << 0),
+#endif
 
 	/* READ/WRITE LONG (obsolete) */
 	ATA_CMD_READ_LONG	= 0x22,
@@ -400,6 +412,13 @@ struct ata_taskfile {
 	u8			device;
 
 	u8			command;	/* IO operation */
+#if defined(__VMKLNX__)
+	/*
+	 * FIS byte 16 (SATA 3.1 auxiliary field).  Sits in what used to
+	 * be tail padding so the layout seen by LLDs does not change.
+	 */
+	u8			auxiliary;
+#endif
 };
 
 /*
@@ -510,6 +529,12 @@ static inline int ata_is_data(u8 prot)
 /* _VMKLNX_CODECHECK_: ata_id_has_ncq */
 #define ata_id_has_ncq(id)	((id)[76] & (1 << 8))
 
+#if defined(__VMKLNX__)
+/* SEND/RECEIVE FPDMA QUEUED supported, see log page 13h for subcommands */
+#define ata_id_has_ncq_send_and_recv(id) \
+	((id)[ATA_ID_SATA_CAPABILITY_2] & (1 << 6))
+#endif
+
 /**
  *  ata_id_queue_depth - Get the supported maximum queue depth
  *  @id: the pointer to IDENTIFY DEVICE data
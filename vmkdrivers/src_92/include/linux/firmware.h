@@ -19,4 +19,9 @@ int request_firmware_nowait(
 	void (*cont)(const struct firmware *fw, void *context));
 
 void release_firmware(const struct firmware *fw);
+
+#if defined(__VMKLNX__)
+int vmklnx_register_firmware(const char *name, const void *data, size_t size);
+void vmklnx_unregister_firmware(const char *name);
+#endif /* defined(__VMKLNX__) */
 #endif
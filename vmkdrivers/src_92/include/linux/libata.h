@@ -242,6 +242,9 @@ enum {
 	ATA_DFLAG_HIPM		= (1 << 8), /* device supports HIPM */
 	ATA_DFLAG_DIPM		= (1 << 9), /* device supports DIPM */
 	ATA_DFLAG_DMADIR	= (1 << 10), /* device requires DMADIR */
+#if defined(__VMKLNX__)
+	ATA_DFLAG_NCQ_TRIM	= (1 << 11), /* device supports queued TRIM */
+#endif
 	ATA_DFLAG_CFG_MASK	= (1 << 12) - 1,
 
 	ATA_DFLAG_PIO		= (1 << 12), /* device limited to PIO mode */
@@ -443,6 +446,9 @@ enum {
 	ATA_HORKAGE_IPM		= (1 << 7),	/* Link PM problems */
 	ATA_HORKAGE_IVB		= (1 << 8),	/* cbl det validity bit bugs */
 	ATA_HORKAGE_STUCK_ERR	= (1 << 9),	/* stuck ERR on next PACKET */
+#if defined(__VMKLNX__)
+	ATA_HORKAGE_NO_NCQ_TRIM	= (1 << 10),	/* don't use queued TRIM */
+#endif
 
 	 /* DMA mask for user DMA control: User visible values; DO NOT
 	    renumber */
@@ -613,6 +619,37 @@ struct ata_port_stats {
 	unsigned long		rw_reqbuf;
 };
 
+#if defined(__VMKLNX__)
+/*
+ * Per-device UNMAP translation counters.  Kept in the port rather
+ * than in struct ata_device, which is embedded in structures LLDs
+ * see; being outside the device they also survive revalidation.
+ */
+struct ata_unmap_stats {
+	u64			unmap_cmds;	/* SCSI UNMAPs translated */
+	u64			unmap_descs;	/* block descriptors received */
+	u64			trim_ranges;	/* LBA range entries sent */
+	u64			trim_cmds;	/* DSM TRIM commands issued */
+	u64			trim_queued;	/* ... of which SEND FPDMA QUEUED */
+};
+
+/* host link devices first, then one device per PMP link */
+#define ATA_UNMAP_STATS_MAX	(ATA_MAX_DEVICES + SATA_PMP_MAX_PORTS)
+#endif
+
+#if defined(__VMKLNX__)
+/*
+ * SCSI commands completed in one pass over a port.  They are handed
+ * to the midlayer together by ata_done_batch_complete(), which the LLD
+ * may call after dropping the host lock.
+ */
+struct ata_done_batch {
+	unsigned int		nr;
+	struct scsi_cmnd	*cmd[ATA_MAX_QUEUE];
+	void			(*done[ATA_MAX_QUEUE])(struct scsi_cmnd *);
+};
+#endif /* defined(__VMKLNX__) */
+
 struct ata_ering_entry {
 	unsigned int		eflags;
 	unsigned int		err_mask;
@@ -790,6 +827,17 @@ struct ata_port {
 	struct ata_acpi_gtm	__acpi_init_gtm; /* use ata_acpi_init_gtm() */
 #endif
 	u8			sector_buf[ATA_SECT_SIZE]; /* owned by EH */
+#if defined(__VMKLNX__)
+	/*
+	 * Only libata allocates ports, so fields added after this point
+	 * leave the offsets LLDs were built against untouched.
+	 */
+	unsigned int		last_tag;	/* last tag handed out */
+	struct ata_done_batch	*done_batch;	/* open completion batch */
+	u64			ncq_depth[ATA_MAX_QUEUE]; /* NCQ issues by depth - 1 */
+	u64			batch_size[ATA_MAX_QUEUE]; /* batches by size - 1 */
+	struct ata_unmap_stats	unmap_stats[ATA_UNMAP_STATS_MAX];
+#endif
 };
 
 struct ata_port_operations {
@@ -1062,6 +1110,15 @@ extern int ata_hsm_move(struct ata_port *ap, struct ata_queued_cmd *qc,
 extern void ata_qc_complete(struct ata_queued_cmd *qc);
 extern int ata_qc_complete_multiple(struct ata_port *ap, u32 qc_active,
 				    void (*finish_qc)(struct ata_queued_cmd *));
+#if defined(__VMKLNX__)
+extern void ata_port_done_batch_begin(struct ata_port *ap,
+				      struct ata_done_batch *batch);
+extern void ata_port_done_batch_end(struct ata_port *ap);
+extern void ata_done_batch_complete(struct ata_done_batch *batch);
+extern int ata_scsi_proc_info(struct Scsi_Host *shost, char *buffer,
+			      char **start, off_t offset, int length,
+			      int func);
+#endif /* defined(__VMKLNX__) */
 extern void ata_scsi_simulate(struct ata_device *dev, struct scsi_cmnd *cmd,
 			      void (*done)(struct scsi_cmnd *));
 extern int ata_std_bios_param(struct scsi_device *sdev,
@@ -1436,6 +1493,18 @@ static inline int ata_is_host_link(const struct ata_link *link)
 	return link == &link->ap->link;
 }
 
+#if defined(__VMKLNX__)
+static inline struct ata_unmap_stats *ata_dev_unmap_stats(struct ata_device *dev)
+{
+	struct ata_link *link = dev->link;
+	unsigned int idx = dev->devno;
+
+	if (!ata_is_host_link(link))
+		idx = ATA_MAX_DEVICES + link->pmp;
+	return &link->ap->unmap_stats[idx];
+}
+#endif
+
 /**
  *  ata_link_max_devices - get maximum number of ATA devices
  *  @link: pointer to the struct ata_link
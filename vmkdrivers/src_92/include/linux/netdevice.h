@@ -289,6 +289,16 @@ struct napi_wdt_priv {
         struct napi_struct     *napi; /* napi context being polled */
 };
 
+/*
+ * vmklinux private busy-poll state of a napi context. It reuses the space
+ * of the unused napi_wdt_priv in napi_struct, see the assertions in
+ * linux_net.c.
+ */
+struct napi_busy_poll {
+        vmk_TimerCycles        deadline; /* keep polling until; 0 if idle */
+        vmk_Bool               active;   /* current poll was not irq driven */
+};
+
 /* 
  * Poll type being used. vmklinux creates poll for per queue and a backup 
  * poll for the device. The type specifies the kind of poll being used.
@@ -343,7 +353,10 @@ struct napi_struct {
         vmk_Bool                dev_poll;
         void *                  net_poll;
         vmklnx_poll_type        net_poll_type;
-        struct napi_wdt_priv    napi_wdt_priv;  /* not used */
+        union {
+                struct napi_wdt_priv    napi_wdt_priv;  /* not used */
+                struct napi_busy_poll   busy_poll;
+        };
         /*
          * With that we have a 4-byte hole after member "vector" in
          * napi_struct_9_2_1_x, we can change the 32-bit "vector" to 64-bit
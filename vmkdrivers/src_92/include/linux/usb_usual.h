@@ -68,6 +68,8 @@
 		/* cannot handle READ_CAPACITY_16 */		\
 	US_FLAG(INITIAL_READ10,	0x00100000)			\
 		/* Initial READ(10) (and others) must be retried */ \
+	US_FLAG(IGNORE_UAS,	0x00200000)			\
+		/* Device advertises UAS but it is broken */	\
 	US_FLAG(VMKLNX_NO_FILTERING, 0x00040000)		\
 		/* Don't filter SCSI commands */		\
 	US_FLAG(VMKLNX_NO_UNCLAIM, 0x00080000)			\
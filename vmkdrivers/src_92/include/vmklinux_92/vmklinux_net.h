@@ -59,4 +59,47 @@ extern void vmklnx_netdev_set_geneve_offload_params(struct net_device *dev,
                                                     unsigned int flags);
 extern unsigned short vmklnx_netdev_get_geneve_port(void);
 
+/* Functions used for NAPI busy polling */
+
+/**
+ * vmklnx_busy_poll_stats - busy-poll counters of one napi context
+ * @polls: number of polls issued by vmklinux in busy-poll mode
+ * @hits: number of those polls that found work
+ * @usecs: CPU time spent in busy polls, in microseconds
+ */
+struct vmklnx_busy_poll_stats {
+   unsigned long polls;
+   unsigned long hits;
+   unsigned long usecs;
+};
+
+extern void vmklnx_netdev_set_busy_poll(struct net_device *dev,
+                                        unsigned int usecs);
+extern int vmklnx_netdev_get_busy_poll_stats(struct net_device *dev,
+                                             unsigned int napi_id,
+                                             struct vmklnx_busy_poll_stats *stats);
+
+/* Functions used for RSS indirection table rebalancing */
+
+/**
+ * vmklnx_rss_rebalance_stats - counters of the RSS rebalancer of a device
+ * @samples: load samples taken
+ * @rebalances: indirection table updates pushed to the driver
+ * @buckets_moved: indirection table entries moved to another queue
+ * @imbalance_pct: last sample, load of the busiest queue over the mean, in %
+ * @max_imbalance_pct: largest @imbalance_pct seen
+ */
+struct vmklnx_rss_rebalance_stats {
+   unsigned long samples;
+   unsigned long rebalances;
+   unsigned long buckets_moved;
+   unsigned int  imbalance_pct;
+   unsigned int  max_imbalance_pct;
+};
+
+extern int vmklnx_netdev_set_rss_rebalance(struct net_device *dev,
+                                           unsigned int threshold_pct);
+extern int vmklnx_netdev_get_rss_rebalance_stats(struct net_device *dev,
+                                                 struct vmklnx_rss_rebalance_stats *stats);
+
 #endif /* _VMKLNX_NET_H */
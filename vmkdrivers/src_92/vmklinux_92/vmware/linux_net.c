@@ -92,6 +92,41 @@ enum {
 
 #define get_SharedData(dev) (get_LinNetDev(dev)->sharedData)
 
+/* RSS rebalancer: sampling period, and how long/how much load must persist */
+#define RSS_REBALANCE_PERIOD_MS   1000
+#define RSS_REBALANCE_HOLD        3     /* consecutive hot samples before a move */
+#define RSS_REBALANCE_MIN_PKTS    1000  /* ignore samples with less traffic */
+#define RSS_REBALANCE_MAX_MOVES   4     /* buckets moved per table update */
+
+static void rss_rebalance_stop(struct net_device *dev);
+static void rss_rebalance_work_cb(struct work_struct *work);
+
+/*
+ * Hardware indexes the indirection table with the low bits of the hash
+ * and the bucket's entry names the queue that received the packet. The
+ * packet is counted in that queue's row, which is only written from the
+ * queue's poll context and so needs no atomics.
+ */
+static inline void
+rss_rebalance_count(struct linnet_rss_rebalance *rss, u32 hash)
+{
+   unsigned int mask = rss->bucketMask;
+   unsigned int b, q;
+
+   if (mask != 0) {
+      b = hash & mask;
+      q = rss->table[b];
+      if (likely(q < VMKNETDDI_NETQUEUE_MAX_RSS_QUEUES)) {
+         rss->hits[q][b]++;
+      }
+   }
+}
+
+/* RSS rebalance threshold of devices whose driver does not pick one */
+static unsigned int vmklnx_rss_rebalance_pct = 0;
+module_param(vmklnx_rss_rebalance_pct, uint, 0444);
+MODULE_PARM_DESC(vmklnx_rss_rebalance_pct, "Rebalance the RSS indirection table when a queue carries this many percent over the mean load, 0 to disable.");
+
 static vmk_Timer  devWatchdogTimer;
 static void link_state_work_cb(struct work_struct *work);
 static void watchdog_work_cb(struct work_struct *work);
@@ -161,6 +196,11 @@ static vmk_ConfigParamHandle vmklnxLROMaxAggrConfigHandle;
 unsigned int vmklnxLROEnabled;
 unsigned int vmklnxLROMaxAggr;
 
+/* NAPI busy-poll budget of devices whose driver does not pick one */
+static unsigned int vmklnx_busy_poll_usecs = 0;
+module_param(vmklnx_busy_poll_usecs, uint, 0444);
+MODULE_PARM_DESC(vmklnx_busy_poll_usecs, "NAPI busy-poll budget in microseconds, 0 to disable.");
+
 extern void LinStress_SetupStress(void);
 extern void LinStress_CleanupStress(void);
 extern void LinStress_CorruptSkbData(struct sk_buff*, unsigned int,
@@ -370,6 +410,11 @@ VMK_ASSERT_LIST(VMKLNX_NET,
                          offsetof(struct napi_struct_9_2_1_x, vector));
    VMK_ASSERT_ON_COMPILE(offsetof(struct napi_struct, lro_mgr) ==
                          offsetof(struct napi_struct_9_2_1_x, lro_mgr));
+   /* busy-poll state lives in the space of the unused napi_wdt_priv */
+   VMK_ASSERT_ON_COMPILE(sizeof(struct napi_busy_poll) <=
+                         sizeof(struct napi_wdt_priv));
+   VMK_ASSERT_ON_COMPILE(offsetof(struct napi_struct, busy_poll) ==
+                         offsetof(struct napi_struct_9_2_1_x, napi_wdt_priv));
 
    /* make sure backward compatibility of netqueue filter structure */
    VMK_ASSERT_ON_COMPILE(sizeof(vmknetddi_queueops_filter_t) ==
@@ -560,6 +605,9 @@ map_skb_to_pkt(struct sk_buff *skb)
       vmklnx_rss_type  rss_type;
       if (rss_skb_get_info(skb, &rss_hash, &rss_type) == 0) {
          vmk_PktRssHashSet(pkt, rss_hash, (vmk_PktRssType)rss_type);
+         if (unlikely(linDev->rssRebalance != NULL)) {
+            rss_rebalance_count(linDev->rssRebalance, rss_hash);
+         }
       }
    }
 
@@ -769,6 +817,71 @@ EXPORT_SYMBOL(netif_receive_skb);
 
 
 
+/*
+ *----------------------------------------------------------------------------
+ *
+ *  napi_busy_poll --
+ *
+ *    Account for a poll of a napi context on a busy-poll enabled device
+ *    and decide whether to keep polling it.
+ *
+ *    Every poll that finds work extends the busy-poll window by the
+ *    device's time budget. While the window is open and the driver has
+ *    completed its napi context, we take NAPI_STATE_SCHED back so the
+ *    worldlet keeps calling the driver's poll routine. Interrupts the
+ *    driver re-arms in the meantime find the context already scheduled
+ *    and do not wake the worldlet. Once the window expires without new
+ *    traffic the context is left completed and we are back to interrupt
+ *    driven polling.
+ *
+ *  Results:
+ *    VMK_TRUE if we need to keep polling and VMK_FALSE otherwise.
+ *
+ *  Side effects:
+ *    May set NAPI_STATE_SCHED on napi.
+ *
+ *----------------------------------------------------------------------------
+ */
+
+static vmk_Bool
+napi_busy_poll(struct napi_struct *napi, unsigned int usecs, int work,
+               vmk_TimerCycles start)
+{
+   LinNetDev *linDev = get_LinNetDev(napi->dev);
+   struct napi_busy_poll *bp = &napi->busy_poll;
+   struct linnet_qstats *qstats =
+      &linDev->qstats[napi->napi_id & (VMKLNX_QUEUE_STATS_MAX - 1)];
+   vmk_TimerCycles now = vmk_GetTimerCycles();
+
+   if (bp->active) {
+      bp->active = VMK_FALSE;
+      qstats->busy_polls++;
+      qstats->busy_poll_cycles += now - start;
+      if (work > 0) {
+         qstats->busy_poll_hits++;
+      }
+   }
+
+   if (work > 0) {
+      bp->deadline = now + vmk_TimerUSToTC(usecs);
+   }
+
+   if (test_bit(NAPI_STATE_SCHED, &napi->state)) {
+      /* driver did not complete, this is a regular repoll */
+      return VMK_TRUE;
+   }
+
+   if (bp->deadline != 0 && now < bp->deadline &&
+       napi_schedule_prep(napi)) {
+      bp->active = VMK_TRUE;
+      return VMK_TRUE;
+   }
+
+   /* idle for a whole budget, fall back to interrupt mode */
+   bp->deadline = 0;
+   return VMK_FALSE;
+}
+
 /*
  *----------------------------------------------------------------------------
  *
@@ -793,8 +906,10 @@ EXPORT_SYMBOL(netif_receive_skb);
 static vmk_Bool
 napi_poll(vmk_AddrCookie cookie, vmk_uint32 budget)
 {
-   VMK_ReturnStatus status = VMK_OK;
    struct napi_struct *napi = pollpriv_napi(cookie.ptr);
+   unsigned int busyPollUsecs = get_LinNetDev(napi->dev)->busyPollUsecs;
+   vmk_TimerCycles start = 0;
+   int work = 0;
 
    /*
     * napi_schedule_prep()/napi_schedule() depend on accurately seeing whether
@@ -812,12 +927,18 @@ napi_poll(vmk_AddrCookie cookie, vmk_uint32 budget)
    smp_mb();
  
    if (test_bit(NAPI_STATE_SCHED, &napi->state)) {
-      VMKAPI_MODULE_CALL(napi->dev->module_id, status, napi->poll, napi,
+      if (unlikely(busyPollUsecs)) {
+         start = vmk_GetTimerCycles();
+      }
+      VMKAPI_MODULE_CALL(napi->dev->module_id, work, napi->poll, napi,
                          napi->weight);
       if (vmklnxLROEnabled && !(napi->dev->features & NETIF_F_SW_LRO)) {
          /* Flush all the lro sessions as we are done polling the napi context */
          lro_flush_all(&napi->lro_mgr);
       }
+      if (unlikely(busyPollUsecs)) {
+         return napi_busy_poll(napi, busyPollUsecs, work, start);
+      }
    }
 
    if (test_bit(NAPI_STATE_SCHED, &napi->state)) {
@@ -1275,6 +1396,9 @@ netif_napi_add(struct net_device *dev,
         lro_mgr->max_aggr = vmklnxLROMaxAggr;
         lro_mgr->frag_align_pad = 0;
 
+        napi->busy_poll.deadline = 0;
+        napi->busy_poll.active = VMK_FALSE;
+
         napi_poll_init(napi);
 
         set_bit(NAPI_STATE_SCHED, &napi->state);
@@ -3113,6 +3237,7 @@ vmklnx_free_netdev(struct kmem_cache_s *pmCache, struct net_device *dev)
    kfree(dev->tx_netqueue_info);
    kfree(dev->_tx);
    vmklnx_kfree(VMK_MODULE_HEAP_ID, linDev->qstats);
+   kfree(linDev->rssRebalance);
    kfree((char *)linDev - linDev->padded);
 }
 EXPORT_SYMBOL(vmklnx_free_netdev);
@@ -3223,6 +3348,7 @@ vmklnx_alloc_netdev_mq(struct module *this_module,
    dev->real_num_tx_queues = queue_count;
    dev->tx_netqueue_info = tx_netqueue_info;
    linDev->qstats = qstats;
+   mutex_init(&linDev->rssLock);
 
    if (sizeof_priv) {
       dev->priv = ((char *)dev +
@@ -3968,6 +4094,12 @@ register_netdevice(struct net_device *dev)
    dev_hold(dev);
    dev->reg_state = NETREG_REGISTERED;
 
+   /* drivers that did not choose a busy-poll budget get the vmklinux one */
+   if (!(dev->features & NETIF_F_CNA) &&
+       get_LinNetDev(dev)->busyPollUsecs == 0) {
+      get_LinNetDev(dev)->busyPollUsecs = vmklnx_busy_poll_usecs;
+   }
+
  out:
    return ret;
 
@@ -4421,6 +4553,7 @@ unregister_netdevice(struct net_device *dev)
 
    dev->reg_state = NETREG_UNREGISTERED;
 
+   rss_rebalance_stop(dev);
    netdev_poll_cleanup(dev);
 
    VMK_ASSERT(dev->vlan_group == NULL);
@@ -7255,6 +7388,416 @@ netqueue_op_get_queue_supported_feat(void *clientData,
 }
 
 
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  netqueue_rss_call_ind_table --
+ *
+ *    Pass an RSS indirection table operation to the driver.
+ *
+ *  Results:
+ *    VMK_OK on success, error on failure.
+ *
+ *  Side effects:
+ *    None
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+static VMK_ReturnStatus
+netqueue_rss_call_ind_table(struct net_device *netdev,
+                            vmknetddi_queue_rss_op_t op_type,
+                            vmknetddi_queue_rssop_ind_table_t *table)
+{
+   int result;
+   vmknetddi_queueop_config_rss_args_t config_rss_args;
+   vmknetddi_queue_rssop_ind_table_args_t rss_op_args;
+
+   if (!netdev->netqueue_ops) {
+      VMKLNX_DEBUG(0, "!netdev->netqueue_ops");
+      return VMK_NOT_SUPPORTED;
+   }
+
+   rss_op_args.netdev = netdev;
+   rss_op_args.rss_ind_table = table;
+
+   config_rss_args.op_type = op_type;
+   config_rss_args.op_args = &rss_op_args;
+
+   VMKAPI_MODULE_CALL(netdev->module_id, result, netdev->netqueue_ops,
+                      VMKNETDDI_QUEUEOPS_OP_CONFIG_RSS, &config_rss_args);
+
+   return result == 0 ? VMK_OK : VMK_FAILURE;
+}
+
+
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  rss_rebalance_bucket_hits --
+ *
+ *    Sum the rx packets of an indirection table bucket over the per
+ *    queue rows it has been counted in.
+ *
+ *  Results:
+ *    Packets received in the bucket, modulo 2^32.
+ *
+ *  Side effects:
+ *    None.
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+static u32
+rss_rebalance_bucket_hits(struct linnet_rss_rebalance *rss, unsigned int b)
+{
+   u32 hits = 0;
+   unsigned int q;
+
+   for (q = 0; q < VMKNETDDI_NETQUEUE_MAX_RSS_QUEUES; q++) {
+      hits += rss->hits[q][b];
+   }
+
+   return hits;
+}
+
+
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  rss_rebalance_set_table --
+ *
+ *    Record the indirection table the driver is now using. Bucket
+ *    counting only runs while enabled and for power of two table sizes,
+ *    since the bucket is computed by masking the hash.
+ *
+ *    Caller must hold rssLock.
+ *
+ *  Results:
+ *    None.
+ *
+ *  Side effects:
+ *    Restarts load sampling.
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+static void
+rss_rebalance_set_table(struct linnet_rss_rebalance *rss,
+                        vmknetddi_queue_rssop_ind_table_t *table)
+{
+   u16 size = table->table_size;
+   unsigned int b;
+
+   if (size == 0 || size > VMKNETDDI_NETQUEUE_MAX_RSS_IND_TABLE_SIZE) {
+      rss->tableSize = 0;
+      rss->bucketMask = 0;
+      return;
+   }
+
+   memcpy(rss->table, table->table, size);
+   rss->tableSize = size;
+   for (b = 0; b < size; b++) {
+      rss->lastHits[b] = rss_rebalance_bucket_hits(rss, b);
+   }
+   rss->hotSamples = 0;
+   rss->bucketMask = (rss->thresholdPct != 0 && (size & (size - 1)) == 0) ?
+                     size - 1 : 0;
+}
+
+
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  rss_rebalance_sample --
+ *
+ *    Take one load sample and, if one queue has been carrying more than
+ *    thresholdPct above the mean load for RSS_REBALANCE_HOLD consecutive
+ *    samples, move up to RSS_REBALANCE_MAX_MOVES of its buckets to the
+ *    least loaded queue. A bucket only moves if that lowers the load of
+ *    the busiest queue, so a single elephant flow is left alone.
+ *
+ *    Caller must hold rssLock.
+ *
+ *  Results:
+ *    Number of buckets moved in rss->table.
+ *
+ *  Side effects:
+ *    Updates the rebalancer statistics.
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+static int
+rss_rebalance_sample(struct linnet_rss_rebalance *rss)
+{
+   u32 load[VMKNETDDI_NETQUEUE_MAX_RSS_QUEUES];
+   u64 total = 0;
+   u32 mean, imbalance;
+   unsigned int b, q, nqueues = 0, qmax, qmin;
+   int moved;
+
+   memset(load, 0, sizeof(load));
+   for (b = 0; b < rss->tableSize; b++) {
+      u32 hits = rss_rebalance_bucket_hits(rss, b);
+
+      rss->delta[b] = hits - rss->lastHits[b];
+      rss->lastHits[b] = hits;
+
+      q = rss->table[b];
+      if (q >= VMKNETDDI_NETQUEUE_MAX_RSS_QUEUES) {
+         return 0;
+      }
+      load[q] += rss->delta[b];
+      total += rss->delta[b];
+      nqueues = max(nqueues, q + 1);
+   }
+
+   rss->stats.samples++;
+   if (nqueues < 2 || total < RSS_REBALANCE_MIN_PKTS) {
+      rss->stats.imbalance_pct = 0;
+      rss->hotSamples = 0;
+      return 0;
+   }
+
+   mean = (u32)(total / nqueues);
+   qmax = 0;
+   for (q = 1; q < nqueues; q++) {
+      if (load[q] > load[qmax]) {
+         qmax = q;
+      }
+   }
+   imbalance = (u32)(((u64)(load[qmax] - mean) * 100) / mean);
+   rss->stats.imbalance_pct = imbalance;
+   rss->stats.max_imbalance_pct = max(rss->stats.max_imbalance_pct, imbalance);
+
+   if (imbalance < rss->thresholdPct) {
+      rss->hotSamples = 0;
+      return 0;
+   }
+   if (++rss->hotSamples < RSS_REBALANCE_HOLD) {
+      return 0;
+   }
+   rss->hotSamples = 0;
+
+   for (moved = 0; moved < RSS_REBALANCE_MAX_MOVES; moved++) {
+      u32 gap, best_hits = 0;
+      int best = -1;
+
+      qmax = qmin = 0;
+      for (q = 1; q < nqueues; q++) {
+         if (load[q] > load[qmax]) {
+            qmax = q;
+         }
+         if (load[q] < load[qmin]) {
+            qmin = q;
+         }
+      }
+      gap = load[qmax] - load[qmin];
+
+      /* the bucket closest to half the gap evens the two queues out best */
+      for (b = 0; b < rss->tableSize; b++) {
+         u32 hits = rss->delta[b];
+
+         if (rss->table[b] != qmax || hits == 0 || hits >= gap) {
+            continue;
+         }
+         if (best < 0 ||
+             abs((int)(gap / 2) - (int)hits) <
+             abs((int)(gap / 2) - (int)best_hits)) {
+            best = b;
+            best_hits = hits;
+         }
+      }
+      if (best < 0) {
+         break;
+      }
+
+      rss->table[best] = qmin;
+      load[qmax] -= best_hits;
+      load[qmin] += best_hits;
+   }
+
+   return moved;
+}
+
+
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  rss_rebalance_get --
+ *
+ *    Return the RSS rebalancer state of a device, allocating it on first
+ *    use. The state is published under rssLock, and only once it is
+ *    fully initialized since the rx path looks at it without the lock.
+ *
+ *    Caller must hold rssLock.
+ *
+ *  Results:
+ *    The rebalancer state, or NULL if it could not be allocated.
+ *
+ *  Side effects:
+ *    None.
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+static struct linnet_rss_rebalance *
+rss_rebalance_get(struct net_device *dev)
+{
+   LinNetDev *linDev = get_LinNetDev(dev);
+   struct linnet_rss_rebalance *rss = linDev->rssRebalance;
+
+   if (rss == NULL) {
+      rss = kzalloc(sizeof(*rss), GFP_KERNEL);
+      if (rss == NULL) {
+         return NULL;
+      }
+      INIT_DELAYED_WORK(&rss->work, rss_rebalance_work_cb);
+      rss->dev = dev;
+      smp_wmb();
+      linDev->rssRebalance = rss;
+   }
+
+   return rss;
+}
+
+
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  rss_rebalance_start --
+ *
+ *    Enable rebalancing at threshold_pct and start the sampling work.
+ *
+ *    Caller must hold rssLock.
+ *
+ *  Results:
+ *    None.
+ *
+ *  Side effects:
+ *    Starts bucket counting if the table size allows it.
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+static void
+rss_rebalance_start(struct linnet_rss_rebalance *rss,
+                    unsigned int threshold_pct)
+{
+   rss->thresholdPct = threshold_pct;
+   rss->hotSamples = 0;
+   if (rss->tableSize != 0 && (rss->tableSize & (rss->tableSize - 1)) == 0) {
+      rss->bucketMask = rss->tableSize - 1;
+   }
+
+   schedule_delayed_work(&rss->work,
+                         msecs_to_jiffies(RSS_REBALANCE_PERIOD_MS));
+}
+
+
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  rss_rebalance_work_cb --
+ *
+ *    Periodic RSS rebalancer of a device. Samples the per bucket rx load
+ *    and pushes a rewritten indirection table to the driver when the
+ *    load is skewed. The next table vmkernel pushes replaces ours.
+ *
+ *  Results:
+ *    None.
+ *
+ *  Side effects:
+ *    May update the device's RSS indirection table.
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+static void
+rss_rebalance_work_cb(struct work_struct *work)
+{
+   struct linnet_rss_rebalance *rss =
+      container_of(work, struct linnet_rss_rebalance, work.work);
+   struct net_device *dev = rss->dev;
+   LinNetDev *linDev = get_LinNetDev(dev);
+   vmknetddi_queue_rssop_ind_table_t *table;
+   u8 saved[VMKNETDDI_NETQUEUE_MAX_RSS_IND_TABLE_SIZE];
+   int moved;
+
+   table = kmalloc(sizeof(*table) + VMKNETDDI_NETQUEUE_MAX_RSS_IND_TABLE_SIZE,
+                   GFP_KERNEL);
+
+   mutex_lock(&linDev->rssLock);
+   if (rss->thresholdPct == 0) {
+      mutex_unlock(&linDev->rssLock);
+      kfree(table);
+      return;
+   }
+
+   if (rss->tableSize != 0 && table != NULL &&
+       netif_running(dev)) {
+      memcpy(saved, rss->table, rss->tableSize);
+      moved = rss_rebalance_sample(rss);
+      if (moved > 0) {
+         table->table_size = rss->tableSize;
+         memcpy(table->table, rss->table, rss->tableSize);
+         if (netqueue_rss_call_ind_table(dev,
+                                         VMKNETDDI_QUEUEOPS_RSS_OP_UPDATE_IND_TABLE,
+                                         table) == VMK_OK) {
+            rss->stats.rebalances++;
+            rss->stats.buckets_moved += moved;
+            VMKLNX_DEBUG(1, "%s: moved %d RSS buckets, imbalance %u%%",
+                         dev->name, moved, rss->stats.imbalance_pct);
+         } else {
+            memcpy(rss->table, saved, rss->tableSize);
+         }
+      }
+   }
+   mutex_unlock(&linDev->rssLock);
+   kfree(table);
+
+   schedule_delayed_work(&rss->work,
+                         msecs_to_jiffies(RSS_REBALANCE_PERIOD_MS));
+}
+
+
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  rss_rebalance_stop --
+ *
+ *    Stop the RSS rebalancer of a device being unregistered.
+ *
+ *  Results:
+ *    None.
+ *
+ *  Side effects:
+ *    Waits for a running rebalance pass to finish.
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+static void
+rss_rebalance_stop(struct net_device *dev)
+{
+   LinNetDev *linDev = get_LinNetDev(dev);
+   struct linnet_rss_rebalance *rss;
+
+   mutex_lock(&linDev->rssLock);
+   rss = linDev->rssRebalance;
+   if (rss == NULL) {
+      mutex_unlock(&linDev->rssLock);
+      return;
+   }
+   rss->thresholdPct = 0;
+   rss->bucketMask = 0;
+   mutex_unlock(&linDev->rssLock);
+
+   cancel_delayed_work_sync(&rss->work);
+}
+
+
 /*
  *-----------------------------------------------------------------------------
  *
@@ -7331,6 +7874,7 @@ netqueue_rss_op_init_state(struct net_device *netdev, void *rssOpArgs)
    vmknetddi_queue_rssop_init_state_args_t rss_op_args;
    vmk_NetqueueRSSOpInitStateArgs *vmkArgs =
       (vmk_NetqueueRSSOpInitStateArgs *)rssOpArgs;
+   LinNetDev *linDev = get_LinNetDev(netdev);
 
    VMK_ASSERT(netdev);
 
@@ -7369,11 +7913,23 @@ netqueue_rss_op_init_state(struct net_device *netdev, void *rssOpArgs)
    config_rss_args.op_args = &rss_op_args;
 
    if (netdev->netqueue_ops) {
+      mutex_lock(&linDev->rssLock);
       VMKAPI_MODULE_CALL(netdev->module_id, result, netdev->netqueue_ops,
                          VMKNETDDI_QUEUEOPS_OP_CONFIG_RSS, &config_rss_args);
       if (result != 0) {
          status = VMK_FAILURE;
+      } else if (linDev->rssRebalance != NULL) {
+         rss_rebalance_set_table(linDev->rssRebalance,
+                                 rss_op_args.rss_ind_table);
+      } else if (vmklnx_rss_rebalance_pct != 0) {
+         struct linnet_rss_rebalance *rss = rss_rebalance_get(netdev);
+
+         if (rss != NULL) {
+            rss_rebalance_set_table(rss, rss_op_args.rss_ind_table);
+            rss_rebalance_start(rss, vmklnx_rss_rebalance_pct);
+         }
       }
+      mutex_unlock(&linDev->rssLock);
    } else {
       VMKLNX_DEBUG(0, "!netdev->netqueue_ops");
       status = VMK_NOT_SUPPORTED;
@@ -7408,46 +7964,38 @@ free_rss_key:
 static VMK_ReturnStatus
 netqueue_rss_op_update_ind_table(struct net_device *netdev, void *rssOpArgs)
 {
-   int result;
    VMK_ReturnStatus status;
-   vmknetddi_queueop_config_rss_args_t config_rss_args;
-   vmknetddi_queue_rssop_ind_table_args_t rss_op_args;
+   vmknetddi_queue_rssop_ind_table_t *rss_ind_table;
    vmk_NetqueueRSSIndTable *vmkRSSTable = (vmk_NetqueueRSSIndTable *)rssOpArgs;
+   LinNetDev *linDev = get_LinNetDev(netdev);
 
    VMK_ASSERT(netdev);
 
-   rss_op_args.netdev = netdev;
-
    /* Allocate memory for the ddi args rss indirection table */
-   rss_op_args.rss_ind_table = kmalloc((sizeof (vmknetddi_queue_rssop_ind_table_t) +
-                                        vmkRSSTable->tableSize * sizeof (u8)),
-                                       GFP_KERNEL);
-   if (rss_op_args.rss_ind_table == NULL) {
+   rss_ind_table = kmalloc((sizeof (vmknetddi_queue_rssop_ind_table_t) +
+                            vmkRSSTable->tableSize * sizeof (u8)),
+                           GFP_KERNEL);
+   if (rss_ind_table == NULL) {
       return VMK_NO_MEMORY;
    }
 
-   status = marshall_from_vmknetq_rss_ind_table(vmkRSSTable, rss_op_args.rss_ind_table);
+   status = marshall_from_vmknetq_rss_ind_table(vmkRSSTable, rss_ind_table);
    VMK_ASSERT(status == VMK_OK);
    if (status != VMK_OK) {
       goto free_rss_ind_table;
    }
 
-   config_rss_args.op_type = VMKNETDDI_QUEUEOPS_RSS_OP_UPDATE_IND_TABLE;
-   config_rss_args.op_args = &rss_op_args;
-
-   if (netdev->netqueue_ops) {
-      VMKAPI_MODULE_CALL(netdev->module_id, result, netdev->netqueue_ops,
-                         VMKNETDDI_QUEUEOPS_OP_CONFIG_RSS, &config_rss_args);
-      if (result != 0) {
-         status = VMK_FAILURE;
-      }
-   } else {
-      VMKLNX_DEBUG(0, "!netdev->netqueue_ops");
-      status = VMK_NOT_SUPPORTED;
+   mutex_lock(&linDev->rssLock);
+   status = netqueue_rss_call_ind_table(netdev,
+                                        VMKNETDDI_QUEUEOPS_RSS_OP_UPDATE_IND_TABLE,
+                                        rss_ind_table);
+   if (status == VMK_OK && linDev->rssRebalance != NULL) {
+      rss_rebalance_set_table(linDev->rssRebalance, rss_ind_table);
    }
+   mutex_unlock(&linDev->rssLock);
 
 free_rss_ind_table:
-   kfree(rss_op_args.rss_ind_table);
+   kfree(rss_ind_table);
 
    return status;
 }
@@ -7472,48 +8020,34 @@ free_rss_ind_table:
 static VMK_ReturnStatus
 netqueue_rss_op_get_ind_table(struct net_device *netdev, void *rssOpArgs)
 {
-   int result;
-   VMK_ReturnStatus status = VMK_OK;
-   vmknetddi_queueop_config_rss_args_t config_rss_args;
-   vmknetddi_queue_rssop_ind_table_args_t rss_op_args;
+   VMK_ReturnStatus status;
+   vmknetddi_queue_rssop_ind_table_t *rss_ind_table;
    vmk_NetqueueRSSIndTable *vmkRSSTable = (vmk_NetqueueRSSIndTable *)rssOpArgs;
+   LinNetDev *linDev = get_LinNetDev(netdev);
 
    VMK_ASSERT(netdev);
 
-   rss_op_args.netdev = netdev;
-
    /* Allocate memory for the ddi args rss indirection table */
-   rss_op_args.rss_ind_table = kmalloc((sizeof (vmknetddi_queue_rssop_ind_table_t) +
-                                        vmkRSSTable->tableSize * sizeof (u8)),
-                                       GFP_KERNEL);
-   if (rss_op_args.rss_ind_table == NULL) {
+   rss_ind_table = kmalloc((sizeof (vmknetddi_queue_rssop_ind_table_t) +
+                            vmkRSSTable->tableSize * sizeof (u8)),
+                           GFP_KERNEL);
+   if (rss_ind_table == NULL) {
       return VMK_NO_MEMORY;
    }
 
-   rss_op_args.rss_ind_table->table_size = vmkRSSTable->tableSize;
+   rss_ind_table->table_size = vmkRSSTable->tableSize;
 
-   config_rss_args.op_type = VMKNETDDI_QUEUEOPS_RSS_OP_GET_IND_TABLE;
-   config_rss_args.op_args = &rss_op_args;
-
-   if (netdev->netqueue_ops) {
-      VMKAPI_MODULE_CALL(netdev->module_id, result, netdev->netqueue_ops,
-                         VMKNETDDI_QUEUEOPS_OP_CONFIG_RSS, &config_rss_args);
-      if (result != 0) {
-         status = VMK_FAILURE;
-      } else {
-         status = marshall_to_vmknetq_rss_ind_table(rss_op_args.rss_ind_table, vmkRSSTable);
-         VMK_ASSERT(status == VMK_OK);
-         if (status != VMK_OK) {
-            goto free_rss_ind_table;
-         }
-      }
-   } else {
-      VMKLNX_DEBUG(0, "!netdev->netqueue_ops");
-      status = VMK_NOT_SUPPORTED;
+   mutex_lock(&linDev->rssLock);
+   status = netqueue_rss_call_ind_table(netdev,
+                                        VMKNETDDI_QUEUEOPS_RSS_OP_GET_IND_TABLE,
+                                        rss_ind_table);
+   mutex_unlock(&linDev->rssLock);
+   if (status == VMK_OK) {
+      status = marshall_to_vmknetq_rss_ind_table(rss_ind_table, vmkRSSTable);
+      VMK_ASSERT(status == VMK_OK);
    }
 
-free_rss_ind_table:
-   kfree(rss_op_args.rss_ind_table);
+   kfree(rss_ind_table);
 
    return status;
 }
@@ -8025,6 +8559,111 @@ UplinkOpStatsGet(vmk_AddrCookie cookie, vmk_UplinkStats *stats)
 }
 
 
+/*
+ *----------------------------------------------------------------------------
+ *
+ * LinNetPrivStatsLength --
+ *
+ *    Return the number of vmklinux counter lines appended to the private
+ *    stats of a device.
+ *
+ * Results:
+ *    Number of lines.
+ *
+ * Side effects:
+ *    None
+ *
+ *----------------------------------------------------------------------------
+ */
+static int
+LinNetPrivStatsLength(struct net_device *dev)
+{
+   LinNetDev *linDev = get_LinNetDev(dev);
+   int lines = 0;
+
+   if (linDev->busyPollUsecs != 0) {
+      lines += 3;
+   }
+   if (linDev->rssRebalance != NULL) {
+      lines += 4;
+   }
+
+   return lines;
+}
+
+
+/*
+ *----------------------------------------------------------------------------
+ *
+ * LinNetPrivStatsGet --
+ *
+ *    Append the vmklinux counters of a device (NAPI busy polling, RSS
+ *    rebalancing) to its private stats, in the format used for the
+ *    driver's ethtool stats.
+ *
+ * Results:
+ *    New length of the private stats string.
+ *
+ * Side effects:
+ *    None
+ *
+ *----------------------------------------------------------------------------
+ */
+static int
+LinNetPrivStatsGet(struct net_device *dev, char *privStats, int pidx,
+                   vmk_ByteCount privStatsLen)
+{
+   LinNetDev *linDev = get_LinNetDev(dev);
+   const char *names[7];
+   u64 values[7];
+   int i, n = 0;
+
+   if (linDev->busyPollUsecs != 0) {
+      u64 polls = 0, hits = 0, cycles = 0;
+
+      for (i = 0; i < VMKLNX_QUEUE_STATS_MAX; i++) {
+         polls += linDev->qstats[i].busy_polls;
+         hits += linDev->qstats[i].busy_poll_hits;
+         cycles += linDev->qstats[i].busy_poll_cycles;
+      }
+      names[n] = "vmklnx_busy_polls";
+      values[n++] = polls;
+      names[n] = "vmklnx_busy_poll_hits";
+      values[n++] = hits;
+      names[n] = "vmklnx_busy_poll_usecs";
+      values[n++] = vmk_TimerTCToUS(cycles);
+   }
+   if (linDev->rssRebalance != NULL) {
+      struct vmklnx_rss_rebalance_stats rss;
+
+      mutex_lock(&linDev->rssLock);
+      rss = linDev->rssRebalance->stats;
+      mutex_unlock(&linDev->rssLock);
+
+      names[n] = "vmklnx_rss_rebalances";
+      values[n++] = rss.rebalances;
+      names[n] = "vmklnx_rss_buckets_moved";
+      values[n++] = rss.buckets_moved;
+      names[n] = "vmklnx_rss_imbalance_pct";
+      values[n++] = rss.imbalance_pct;
+      names[n] = "vmklnx_rss_max_imbalance_pct";
+      values[n++] = rss.max_imbalance_pct;
+   }
+
+   for (i = 0; (pidx < privStatsLen - 1) && (i < n); i++) {
+      char tmp[128];
+
+      snprintf(tmp, 128, "   %s : %lld\n", names[i], values[i]);
+      memcpy(privStats + pidx, tmp,
+             min(strlen(tmp), privStatsLen - pidx - 1));
+
+      pidx += min(strlen(tmp), privStatsLen - pidx - 1);
+   }
+
+   return pidx;
+}
+
+
 /*
  *----------------------------------------------------------------------------
  *
@@ -8046,11 +8685,16 @@ UplinkOpPrivStatsLengthGet(vmk_AddrCookie cookie, vmk_ByteCount *length)
    struct net_device *dev = cookie.ptr;
    struct ethtool_ops *ops = dev->ethtool_ops;
    struct ethtool_stats stat;
+   int linNetLines = LinNetPrivStatsLength(dev);
 
    VMK_ASSERT(length != NULL);
 
    if (!ops || (!ops->get_stats_count && !ops->get_sset_count)) {
-      return VMK_FAILURE;
+      if (linNetLines == 0) {
+         return VMK_FAILURE;
+      }
+      *length = (linNetLines + 1) * 128;
+      return VMK_OK;
    }
 
    rtnl_lock();
@@ -8063,7 +8707,7 @@ UplinkOpPrivStatsLengthGet(vmk_AddrCookie cookie, vmk_ByteCount *length)
    }
    rtnl_unlock();
 
-   *length = stat.n_stats * 128;
+   *length = (stat.n_stats + linNetLines) * 128;
 
    return VMK_OK;
 }
@@ -8105,7 +8749,14 @@ UplinkOpPrivStatsGet(vmk_AddrCookie cookie, char *privStats,
        !ops->get_ethtool_stats ||
        (!ops->get_stats_count && !ops->get_sset_count) ||
        !ops->get_strings) {
-      goto done;
+      if (LinNetPrivStatsLength(dev) == 0) {
+         goto done;
+      }
+      /* no driver stats, report the vmklinux counters alone */
+      privStats[pidx++] = '\n';
+      pidx = LinNetPrivStatsGet(dev, privStats, pidx, privStatsLen);
+      privStats[pidx] = '\0';
+      return VMK_OK;
    }
 
    rtnl_lock();
@@ -8146,6 +8797,7 @@ UplinkOpPrivStatsGet(vmk_AddrCookie cookie, char *privStats,
       pidx += min(strlen(tmp), privStatsLen - pidx - 1);
       pbuf += ETH_GSTRING_LEN;
    }
+   pidx = LinNetPrivStatsGet(dev, privStats, pidx, privStatsLen);
 
    privStats[pidx] = '\0';
 
@@ -10980,6 +11632,183 @@ vmklnx_netdev_set_geneve_offload_params(struct net_device *dev,
 EXPORT_SYMBOL(vmklnx_netdev_set_geneve_offload_params);
 
 
+/**
+ * vmklnx_netdev_set_busy_poll - enable busy polling of a device's napi contexts
+ * @dev: pointer to net_device to configure
+ * @usecs: time budget in microseconds, 0 to disable busy polling
+ *
+ * When enabled, vmklinux keeps polling a napi context for up to @usecs
+ * microseconds after the last poll that found work instead of waiting for
+ * the next interrupt, trading CPU time for receive latency. Contexts that
+ * stay idle for the whole budget go back to interrupt driven polling.
+ * Contexts attached to the device's backup net poll are not busy polled.
+ *
+ * SYNOPSIS:
+ * vmklnx_netdev_set_busy_poll(dev, usecs)
+ *
+ * RETURN VALUE:
+ * none
+ */
+/* _VMKLNX_CODECHECK_: vmklnx_netdev_set_busy_poll */
+void
+vmklnx_netdev_set_busy_poll(struct net_device *dev, unsigned int usecs)
+{
+   struct LinNetDev *linNetDev = get_LinNetDev(dev);
+
+   linNetDev->busyPollUsecs = usecs;
+}
+EXPORT_SYMBOL(vmklnx_netdev_set_busy_poll);
+
+
+/**
+ * vmklnx_netdev_get_busy_poll_stats - return busy-poll counters of a napi context
+ * @dev: pointer to net_device the napi context belongs to
+ * @napi_id: napi_id of the napi context
+ * @stats: counters to fill in
+ *
+ * Counters are kept in VMKLNX_QUEUE_STATS_MAX slots, napi contexts whose ids
+ * collide modulo that number share a slot.
+ *
+ * SYNOPSIS:
+ * vmklnx_netdev_get_busy_poll_stats(dev, napi_id, stats)
+ *
+ * RETURN VALUE:
+ * 0 on success, -EINVAL if @stats is NULL
+ */
+/* _VMKLNX_CODECHECK_: vmklnx_netdev_get_busy_poll_stats */
+int
+vmklnx_netdev_get_busy_poll_stats(struct net_device *dev,
+                                  unsigned int napi_id,
+                                  struct vmklnx_busy_poll_stats *stats)
+{
+   struct linnet_qstats *qstats;
+
+   if (stats == NULL) {
+      return -EINVAL;
+   }
+
+   qstats = &get_LinNetDev(dev)->qstats[napi_id & (VMKLNX_QUEUE_STATS_MAX - 1)];
+   stats->polls = qstats->busy_polls;
+   stats->hits = qstats->busy_poll_hits;
+   stats->usecs = vmk_TimerTCToUS(qstats->busy_poll_cycles);
+
+   return 0;
+}
+EXPORT_SYMBOL(vmklnx_netdev_get_busy_poll_stats);
+
+
+/**
+ * vmklnx_netdev_set_rss_rebalance - enable rebalancing of a device's RSS table
+ * @dev: pointer to net_device to configure
+ * @threshold_pct: load skew that triggers a rebalance, 0 to disable
+ *
+ * When enabled, vmklinux counts received packets per RSS indirection table
+ * bucket and once a second compares the load of the RSS queues. If the
+ * busiest queue stays more than @threshold_pct above the mean for several
+ * seconds, some of its buckets are moved to the least loaded queue and the
+ * new table is pushed to the driver. Only devices whose table size is a
+ * power of two are rebalanced.
+ *
+ * SYNOPSIS:
+ * vmklnx_netdev_set_rss_rebalance(dev, threshold_pct)
+ *
+ * RETURN VALUE:
+ * 0 on success, -ENOMEM if the rebalancer state could not be allocated
+ */
+/* _VMKLNX_CODECHECK_: vmklnx_netdev_set_rss_rebalance */
+int
+vmklnx_netdev_set_rss_rebalance(struct net_device *dev,
+                                unsigned int threshold_pct)
+{
+   LinNetDev *linDev = get_LinNetDev(dev);
+   struct linnet_rss_rebalance *rss;
+   vmknetddi_queue_rssop_ind_table_t *table;
+   vmknetddi_queueop_config_rss_args_t config_rss_args;
+   vmknetddi_queue_rssop_get_params_args_t params;
+   int result;
+
+   might_sleep();
+
+   if (threshold_pct == 0) {
+      rss_rebalance_stop(dev);
+      return 0;
+   }
+
+   mutex_lock(&linDev->rssLock);
+   rss = rss_rebalance_get(dev);
+   if (rss == NULL) {
+      mutex_unlock(&linDev->rssLock);
+      return -ENOMEM;
+   }
+
+   if (rss->tableSize == 0 && dev->netqueue_ops) {
+      /* nothing pushed by vmkernel yet, start from the driver's table */
+      memset(&params, 0, sizeof(params));
+      params.netdev = dev;
+      config_rss_args.op_type = VMKNETDDI_QUEUEOPS_RSS_OP_GET_PARAMS;
+      config_rss_args.op_args = &params;
+      VMKAPI_MODULE_CALL(dev->module_id, result, dev->netqueue_ops,
+                         VMKNETDDI_QUEUEOPS_OP_CONFIG_RSS, &config_rss_args);
+      if (result == 0 && params.rss_ind_table_size != 0 &&
+          params.rss_ind_table_size <= VMKNETDDI_NETQUEUE_MAX_RSS_IND_TABLE_SIZE) {
+         table = kmalloc(sizeof(*table) + params.rss_ind_table_size,
+                         GFP_KERNEL);
+         if (table != NULL) {
+            table->table_size = params.rss_ind_table_size;
+            if (netqueue_rss_call_ind_table(dev,
+                                            VMKNETDDI_QUEUEOPS_RSS_OP_GET_IND_TABLE,
+                                            table) == VMK_OK) {
+               rss_rebalance_set_table(rss, table);
+            }
+            kfree(table);
+         }
+      }
+   }
+   rss_rebalance_start(rss, threshold_pct);
+   mutex_unlock(&linDev->rssLock);
+
+   return 0;
+}
+EXPORT_SYMBOL(vmklnx_netdev_set_rss_rebalance);
+
+
+/**
+ * vmklnx_netdev_get_rss_rebalance_stats - return RSS rebalancer counters
+ * @dev: pointer to net_device to query
+ * @stats: counters to fill in
+ *
+ * SYNOPSIS:
+ * vmklnx_netdev_get_rss_rebalance_stats(dev, stats)
+ *
+ * RETURN VALUE:
+ * 0 on success, -EINVAL if @stats is NULL, -ENOENT if rebalancing was
+ * never enabled on @dev
+ */
+/* _VMKLNX_CODECHECK_: vmklnx_netdev_get_rss_rebalance_stats */
+int
+vmklnx_netdev_get_rss_rebalance_stats(struct net_device *dev,
+                                      struct vmklnx_rss_rebalance_stats *stats)
+{
+   LinNetDev *linDev = get_LinNetDev(dev);
+   int ret = 0;
+
+   if (stats == NULL) {
+      return -EINVAL;
+   }
+
+   mutex_lock(&linDev->rssLock);
+   if (linDev->rssRebalance == NULL) {
+      ret = -ENOENT;
+   } else {
+      *stats = linDev->rssRebalance->stats;
+   }
+   mutex_unlock(&linDev->rssLock);
+
+   return ret;
+}
+EXPORT_SYMBOL(vmklnx_netdev_get_rss_rebalance_stats);
+
+
 /**
  * vmklnx_netdev_get_geneve_port - return the Geneve port being used by vmkernel
  *
@@ -18,6 +18,8 @@
 
 #include <linux/pci.h>
 #include <linux/netdevice.h>
+#include <linux/mutex.h>
+#include <linux/workqueue.h>
 
 #include "vmkapi.h"
 #include "vmklinux_net.h"
@@ -46,6 +48,33 @@ struct linnet_qstats {
       unsigned long tx_packets;
      unsigned long tx_dropped;
    } ____cacheline_aligned_in_smp;
+   /* busy-poll counters of the napi contexts hashed to this slot */
+   struct {
+      unsigned long   busy_polls;         /* polls issued in busy-poll mode */
+      unsigned long   busy_poll_hits;     /* busy polls that found work */
+      unsigned long   busy_poll_cycles;   /* time spent in busy polls */
+   } ____cacheline_aligned_in_smp;
+};
+
+/* RSS indirection table rebalancer, see rss_rebalance_work_cb() */
+struct linnet_rss_rebalance {
+   struct delayed_work work;
+   struct net_device  *dev;
+   unsigned int        thresholdPct; /* imbalance that triggers a move; 0 if off */
+   unsigned int        hotSamples;   /* consecutive samples over threshold */
+   unsigned int        bucketMask;   /* tableSize - 1; 0 while not counting */
+   u16                 tableSize;    /* 0 until a table has been seen */
+   u8                  table[VMKNETDDI_NETQUEUE_MAX_RSS_IND_TABLE_SIZE];
+   u32                 lastHits[VMKNETDDI_NETQUEUE_MAX_RSS_IND_TABLE_SIZE];
+   u32                 delta[VMKNETDDI_NETQUEUE_MAX_RSS_IND_TABLE_SIZE];
+   struct vmklnx_rss_rebalance_stats stats;
+   /*
+    * rx packets per bucket, bumped on the rx path. Each queue counts in
+    * its own row so that queues never write to the same cache line.
+    */
+   u32                 hits[VMKNETDDI_NETQUEUE_MAX_RSS_QUEUES]
+                           [VMKNETDDI_NETQUEUE_MAX_RSS_IND_TABLE_SIZE]
+                       ____cacheline_aligned_in_smp;
 };
 
 /*
@@ -67,6 +96,9 @@ struct LinNetDev {
    unsigned int               geneve_inner_l7_offset_limit;
    unsigned int               geneve_offload_flags;
    struct linnet_qstats      *qstats;
+   unsigned int               busyPollUsecs; /* 0 if busy polling is off */
+   struct mutex               rssLock;       /* serializes RSS table updates */
+   struct linnet_rss_rebalance *rssRebalance; /* NULL until first enabled */
 
    struct net_device  linNetDev __attribute__((aligned(NETDEV_ALIGN)));
    /*
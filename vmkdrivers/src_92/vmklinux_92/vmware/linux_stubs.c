@@ -67,6 +67,7 @@
 #include <linux/workqueue.h>
 #include <linux/utsname.h>
 #include <linux/firmware.h>
+#include <linux/vmalloc.h>
 #include <linux/net.h>
 #include <linux/random.h>
 #include <linux/usb.h>
@@ -2861,33 +2862,317 @@ unregister_ioctl32_conversion(unsigned int cmd)
 
 #endif
 
-int request_firmware(const struct firmware **firmware_p, const char *name, 
+/*
+ * Firmware cache.
+ *
+ * vmklinux has no filesystem to load firmware files from, so images are
+ * registered by name with vmklnx_register_firmware(), typically from a
+ * driver's or firmware module's init routine.  Each name maps to a single
+ * read-only copy of the image.  request_firmware() hands out references to
+ * that copy instead of duplicating it, so every adapter driven by the same
+ * firmware shares one image however many of them are probed.  An entry is
+ * freed once it has been unregistered and the last reference is released.
+ */
+struct vmklnx_firmware {
+   struct list_head list;
+   struct firmware  fw;
+   char             name[FIRMWARE_NAME_MAX];
+   int              registrations;
+   int              refs;
+};
+
+static LIST_HEAD(vmklnx_fw_cache);
+static DEFINE_MUTEX(vmklnx_fw_mutex);
+
+struct vmklnx_fw_request {
+   struct work_struct work;
+   struct module      *module;
+   struct device      *device;
+   void               *context;
+   void               (*cont)(const struct firmware *fw, void *context);
+   char               name[FIRMWARE_NAME_MAX];
+};
+
+/* Must be called with vmklnx_fw_mutex held. */
+static struct vmklnx_firmware *
+fw_cache_find(const char *name)
+{
+   struct vmklnx_firmware *entry;
+
+   list_for_each_entry(entry, &vmklnx_fw_cache, list) {
+      if (strcmp(entry->name, name) == 0) {
+         return entry;
+      }
+   }
+   return NULL;
+}
+
+/* Must be called with vmklnx_fw_mutex held. */
+static void
+fw_cache_release(struct vmklnx_firmware *entry)
+{
+   if (entry->registrations == 0 && entry->refs == 0) {
+      VMKLNX_DEBUG(1, "firmware %s freed", entry->name);
+      list_del(&entry->list);
+      vfree(entry->fw.data);
+      kfree(entry);
+   }
+}
+
+/**
+ *  vmklnx_register_firmware - make a firmware image available to drivers
+ *  @name: name drivers pass to request_firmware()
+ *  @data: firmware image
+ *  @size: size of @data in bytes
+ *
+ *  Copies @data into the vmklinux firmware cache under @name.  The caller's
+ *  buffer may be freed once this returns.  Registering a name that is
+ *  already present with an identical image only takes another
+ *  registration on the existing copy.
+ *
+ *  RETURN VALUE:
+ *  0 on success, -EINVAL on bad arguments, -EEXIST if @name is registered
+ *  with a different image, -ENOMEM if the copy could not be allocated.
+ */
+/* _VMKLNX_CODECHECK_: vmklnx_register_firmware */
+int
+vmklnx_register_firmware(const char *name, const void *data, size_t size)
+{
+   struct vmklnx_firmware *entry;
+   u8 *image;
+   int retval = 0;
+
+   VMK_ASSERT(vmk_PreemptionIsEnabled() == VMK_FALSE);
+
+   if (name == NULL || data == NULL || size == 0 ||
+       strlen(name) >= FIRMWARE_NAME_MAX) {
+      return -EINVAL;
+   }
+
+   mutex_lock(&vmklnx_fw_mutex);
+
+   entry = fw_cache_find(name);
+   if (entry != NULL) {
+      if (entry->fw.size != size || memcmp(entry->fw.data, data, size) != 0) {
+         VMKLNX_WARN("firmware %s already registered with a different image",
+                     name);
+         retval = -EEXIST;
+      } else {
+         entry->registrations++;
+      }
+      goto out;
+   }
+
+   entry = kzalloc(sizeof(*entry), GFP_KERNEL);
+   image = vmalloc(size);
+   if (entry == NULL || image == NULL) {
+      kfree(entry);
+      vfree(image);
+      retval = -ENOMEM;
+      goto out;
+   }
+
+   memcpy(image, data, size);
+   strcpy(entry->name, name);
+   entry->fw.data = image;
+   entry->fw.size = size;
+   entry->registrations = 1;
+   list_add(&entry->list, &vmklnx_fw_cache);
+
+   VMKLNX_DEBUG(1, "firmware %s registered, %lu bytes", name,
+                (unsigned long) size);
+
+out:
+   mutex_unlock(&vmklnx_fw_mutex);
+   return retval;
+}
+EXPORT_SYMBOL(vmklnx_register_firmware);
+
+/**
+ *  vmklnx_unregister_firmware - withdraw a registered firmware image
+ *  @name: name the image was registered under
+ *
+ *  Drops one registration of @name.  Once the last registration is gone,
+ *  request_firmware() no longer finds the image; the copy itself is freed
+ *  when the last driver holding it calls release_firmware().
+ *
+ *  RETURN VALUE:
+ *  None.
+ */
+/* _VMKLNX_CODECHECK_: vmklnx_unregister_firmware */
+void
+vmklnx_unregister_firmware(const char *name)
+{
+   struct vmklnx_firmware *entry;
+
+   VMK_ASSERT(vmk_PreemptionIsEnabled() == VMK_FALSE);
+
+   mutex_lock(&vmklnx_fw_mutex);
+   entry = fw_cache_find(name);
+   if (entry != NULL && entry->registrations > 0) {
+      entry->registrations--;
+      fw_cache_release(entry);
+   } else {
+      VMKLNX_WARN("firmware %s is not registered", name);
+   }
+   mutex_unlock(&vmklnx_fw_mutex);
+}
+EXPORT_SYMBOL(vmklnx_unregister_firmware);
+
+/**
+ *  request_firmware - look up a firmware image
+ *  @firmware_p: on success, set to the firmware image
+ *  @name: name of the firmware image
+ *  @device: device the firmware is loaded for
+ *
+ *  Looks up @name in the vmklinux firmware cache and returns a reference
+ *  to it in @firmware_p.  The image must be released with
+ *  release_firmware() when the driver is done with it.
+ *
+ *  ESX Deviation Notes:
+ *  Firmware is not loaded from a filesystem.  Only images registered with
+ *  vmklnx_register_firmware() can be found, and every caller requesting
+ *  the same name shares the same read-only image, which must not be
+ *  modified.
+ *
+ *  RETURN VALUE:
+ *  0 on success, -EINVAL on bad arguments, -ENOENT if @name is not
+ *  registered, in which case a driver with a built-in image should fall
+ *  back to it.
+ */
+/* _VMKLNX_CODECHECK_: request_firmware */
+int request_firmware(const struct firmware **firmware_p, const char *name,
 		     struct device *device)
 {
+   struct vmklnx_firmware *entry;
+
    VMK_ASSERT(vmk_PreemptionIsEnabled() == VMK_FALSE);
-   VMKLNX_WARN("request_firmware");
-   VMKLNX_ASSERT_NOT_IMPLEMENTED(0);
+
+   if (firmware_p == NULL) {
+      return -EINVAL;
+   }
+   *firmware_p = NULL;
+   if (name == NULL) {
+      return -EINVAL;
+   }
+
+   mutex_lock(&vmklnx_fw_mutex);
+   entry = fw_cache_find(name);
+   if (entry != NULL && entry->registrations > 0) {
+      entry->refs++;
+      *firmware_p = &entry->fw;
+   }
+   mutex_unlock(&vmklnx_fw_mutex);
+
+   if (*firmware_p == NULL) {
+      VMKLNX_DEBUG(1, "firmware %s is not registered", name);
+      return -ENOENT;
+   }
    return 0;
 }
 EXPORT_SYMBOL(request_firmware);
 
+static void
+request_firmware_work(struct work_struct *work)
+{
+   struct vmklnx_fw_request *req =
+      container_of(work, struct vmklnx_fw_request, work);
+   const struct firmware *fw;
+
+   if (request_firmware(&fw, req->name, req->device) != 0) {
+      fw = NULL;
+   }
+   req->cont(fw, req->context);
+
+   module_put(req->module);
+   kfree(req);
+}
+
+/**
+ *  request_firmware_nowait - asynchronous version of request_firmware
+ *  @module: module requesting the firmware
+ *  @uevent: ignored
+ *  @name: name of the firmware image
+ *  @device: device the firmware is loaded for
+ *  @context: passed through to @cont
+ *  @cont: called with the image, or NULL if it could not be found
+ *
+ *  Looks up @name from a work queue and passes the result to @cont.  If
+ *  @cont receives an image it must release it with release_firmware().
+ *  @module is held until @cont has returned.
+ *
+ *  ESX Deviation Notes:
+ *  See request_firmware().  @uevent is ignored since there is no hotplug
+ *  helper to notify.
+ *
+ *  RETURN VALUE:
+ *  0 if the request was queued, -EINVAL on bad arguments, -EFAULT if
+ *  @module is unloading, -ENOMEM on allocation failure.
+ */
+/* _VMKLNX_CODECHECK_: request_firmware_nowait */
+int request_firmware_nowait(
+	struct module *module, int uevent,
+	const char *name, struct device *device, void *context,
+	void (*cont)(const struct firmware *fw, void *context))
+{
+   struct vmklnx_fw_request *req;
+
+   VMK_ASSERT(vmk_PreemptionIsEnabled() == VMK_FALSE);
+
+   if (name == NULL || cont == NULL || strlen(name) >= FIRMWARE_NAME_MAX) {
+      return -EINVAL;
+   }
+
+   req = kzalloc(sizeof(*req), GFP_KERNEL);
+   if (req == NULL) {
+      return -ENOMEM;
+   }
+   if (!try_module_get(module)) {
+      kfree(req);
+      return -EFAULT;
+   }
+
+   req->module = module;
+   req->device = device;
+   req->context = context;
+   req->cont = cont;
+   strcpy(req->name, name);
+   INIT_WORK(&req->work, request_firmware_work);
+
+   /* the work runs in the caller's module context, see queue_work() */
+   schedule_work(&req->work);
+   return 0;
+}
+EXPORT_SYMBOL(request_firmware_nowait);
+
 /**                                          
  *  release_firmware - release the resource associated with a firmware image
  *  @fw: firmware resource to release
  *                                           
- *  Release the resource associated with a firmware image. This call is
- *  unimplemented in ESX and raises an ASSERT in developer builds.
+ *  Drops the reference taken by request_firmware().  @fw must not be used
+ *  after this call.  A NULL @fw is ignored.
  *
  *  ESX Deviation Notes:                     
- *  NOT IMPLEMENTED.
+ *  The image stays in the firmware cache while it remains registered.
  *                                           
  */                                          
 /* _VMKLNX_CODECHECK_: release_firmware */
 void release_firmware(const struct firmware *fw)
 {
+   struct vmklnx_firmware *entry;
+
    VMK_ASSERT(vmk_PreemptionIsEnabled() == VMK_FALSE);
-   VMKLNX_WARN("release_firmware");
-   VMKLNX_ASSERT_NOT_IMPLEMENTED(0);
+
+   if (fw == NULL) {
+      return;
+   }
+   entry = container_of(fw, struct vmklnx_firmware, fw);
+
+   mutex_lock(&vmklnx_fw_mutex);
+   VMK_ASSERT(entry->refs > 0);
+   entry->refs--;
+   fw_cache_release(entry);
+   mutex_unlock(&vmklnx_fw_mutex);
 }
 EXPORT_SYMBOL(release_firmware);
 
@@ -491,6 +491,7 @@ VMK_MODULE_EXPORT_ALIAS(release_firmware);
 VMK_MODULE_EXPORT_ALIAS(__release_region);
 VMK_MODULE_EXPORT_ALIAS(remove_wait_queue);
 VMK_MODULE_EXPORT_ALIAS(request_firmware);
+VMK_MODULE_EXPORT_ALIAS(request_firmware_nowait);
 VMK_MODULE_EXPORT_ALIAS(request_irq);
 VMK_MODULE_EXPORT_ALIAS(__request_region);
 VMK_MODULE_EXPORT_ALIAS(__round_jiffies);
@@ -701,6 +702,10 @@ VMK_MODULE_EXPORT_ALIAS(vmklnx_netdev_high_dma_overflow);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_netdev_set_vxlan_port_update_callback);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_netdev_get_geneve_port);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_netdev_set_geneve_offload_params);
+VMK_MODULE_EXPORT_ALIAS(vmklnx_netdev_set_busy_poll);
+VMK_MODULE_EXPORT_ALIAS(vmklnx_netdev_get_busy_poll_stats);
+VMK_MODULE_EXPORT_ALIAS(vmklnx_netdev_set_rss_rebalance);
+VMK_MODULE_EXPORT_ALIAS(vmklnx_netdev_get_rss_rebalance_stats);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_store_pt_ops);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_netif_start_tx_queue);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_netif_stop_tx_queue);
@@ -717,6 +722,7 @@ VMK_MODULE_EXPORT_ALIAS(vmklnx_rcu_init);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_register_random_driver);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_register_blkdev);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_register_event_callback);
+VMK_MODULE_EXPORT_ALIAS(vmklnx_register_firmware);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_register_module);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_register_usb_kbd_int_handler);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_remove_proc_entry);
@@ -746,6 +752,7 @@ VMK_MODULE_EXPORT_ALIAS(vmklnx_single_open);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_skb_real_size);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_synchronize_rcu);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_unregister_event_callback);
+VMK_MODULE_EXPORT_ALIAS(vmklnx_unregister_firmware);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_unregister_module);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_unregister_random_driver);
 VMK_MODULE_EXPORT_ALIAS(vmklnx_unregister_usb_kbd_int_handler);